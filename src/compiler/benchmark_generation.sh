@@ -0,0 +1,63 @@
+#!/bin/bash
+# Times protoc-gen-objc on the bundled unittest protos replicated many times,
+# once with a single job and once with the default worker pool.
+#
+# usage: benchmark_generation.sh [copies] [plugin]
+#
+# Each copy lives in its own package and class prefix, so the copies generate
+# the same amount of code as the originals without colliding on output names.
+# unittest_custom_options.proto is left out because it extends the descriptor
+# options with fixed field numbers, and the deliberately duplicated enum values
+# in unittest.proto are marked as aliases, which current protoc requires.
+
+set -e
+
+COPIES=${1:-50}
+SRCDIR=$(cd "$(dirname "$0")" && pwd)
+PLUGIN=${2:-$SRCDIR/protoc-gen-objc}
+PROTOC=${PROTOC:-protoc}
+
+PROTOS="unittest unittest_import unittest_import_lite unittest_lite
+        unittest_lite_imports_nonlite unittest_mset unittest_empty
+        unittest_optimize_for unittest_embed_optimize_for
+        unittest_no_generic_services unittest_enormous_descriptor"
+
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' EXIT
+
+for ((i = 1; i <= COPIES; i++)); do
+    mkdir -p "$WORKDIR/copy$i"
+    for name in $PROTOS; do
+        sed -e "s|\"google/protobuf/\(unittest[a-z_]*\)\.proto\"|\"copy$i/c${i}_\1.proto\"|" \
+            -e "s|^package \(.*\);|package copy$i.\1;\\
+import \"google/protobuf/objectivec-descriptor.proto\";\\
+option (.google.protobuf.objectivec_file_options).class_prefix = \"C$i\";|" \
+            -e "s|^enum TestEnumWithDupValue {|&\\
+  option allow_alias = true;|" \
+            "$SRCDIR/google/protobuf/$name.proto" > "$WORKDIR/copy$i/c${i}_$name.proto"
+    done
+done
+
+cd "$WORKDIR"
+FILES=$(ls copy*/*.proto)
+echo "$(echo "$FILES" | wc -l) files, $(cat $FILES | wc -c) bytes of .proto"
+
+run() {
+    rm -rf out && mkdir out
+    TIMEFORMAT="$2: %R s wall, %U s user"
+    # protoc has a built-in --objc_out, so the plugin is registered under another name.
+    time "$PROTOC" -I. -I"$SRCDIR" --plugin=protoc-gen-pbobjc="$PLUGIN" --pbobjc_out="${1:+$1:}out" $FILES
+}
+
+run jobs=1 "serial  "
+mv out serial
+run "" "parallel"
+
+# The worker pool must not change what is generated.
+echo "$(find out -type f | wc -l) files written"
+if diff -r serial out > /dev/null; then
+    echo "outputs identical"
+else
+    echo "outputs differ between jobs=1 and the worker pool" >&2
+    exit 1
+fi
@@ -17,7 +17,10 @@
 
 #include "objc_enum.h"
 
+#include <algorithm>
 #include <map>
+#include <set>
+#include <stdio.h>
 #include <string>
 
 #include <google/protobuf/descriptor.pb.h>
@@ -71,9 +74,18 @@ namespace protobuf {
                     "BOOL $classname$IsValidValue($classname$ value);\n",
                     "classname", ClassName(descriptor_));
 
+                if(!IsLiteRuntime()) {
+                    printer->Print(
+                        "$classname$ $classname$ReadTextFormat(PBTextFormatReader* reader);\n"
+                        "void $classname$WriteJSON(PBJSONWriter* writer, const char* name, $classname$ value);\n"
+                        "$classname$ $classname$ReadJSON(PBJSONReader* reader);\n",
+                        "classname", ClassName(descriptor_));
+                }
+
                 if(hasEnumStringRepresentationMethod(ClassName(descriptor_))) {
                     printer->Print(
                         "const char* $classname$StringRepresentation($classname$ value);\n"
+                        "BOOL $classname$FromStringRepresentation(const char* name, $classname$* value);\n"
                         "\n",
                         "classname", ClassName(descriptor_));
                 } else {
@@ -83,43 +95,292 @@ namespace protobuf {
                 }
             }
 
+            namespace {
+                // Must match PBEnumTableHashName in the runtime.
+                uint32 HashName(const string &name, uint32 seed) {
+                    uint32 hash = 2166136261U ^ seed;
+                    for(int i = 0; i < name.size(); i++) {
+                        hash = (hash ^ static_cast<uint8>(name[i])) * 16777619U;
+                    }
+                    hash ^= hash >> 16;
+                    hash *= 0x85ebca6bU;
+                    hash ^= hash >> 13;
+                    hash *= 0xc2b2ae35U;
+                    hash ^= hash >> 16;
+                    return hash;
+                }
+
+                bool CompareValueNumber(const EnumValueDescriptor *a, const EnumValueDescriptor *b) {
+                    return a->number() < b->number();
+                }
+
+                // Orders bucket indices by decreasing bucket size.
+                struct BucketOrder {
+                    explicit BucketOrder(const vector<vector<int> > &buckets) : buckets_(buckets) {}
+                    bool operator()(int a, int b) const {
+                        return buckets_[a].size() > buckets_[b].size();
+                    }
+                    const vector<vector<int> > &buckets_;
+                };
+
+                // Builds a two level perfect hash of names: names are spread over
+                // buckets by HashName(name, 0), and each bucket gets the first seed
+                // that puts all of its names into free slots.  The biggest buckets
+                // are placed first, while most slots are still free.  Returns false
+                // if some bucket cannot be placed, in which case the runtime
+                // searches the names in order.  Repeated names keep their first
+                // index.
+                bool BuildNameHash(const vector<string> &names, vector<uint32> *seeds, vector<int> *slots) {
+                    const uint32 kMaxSeed = 1 << 20;
+
+                    vector<int> unique;
+                    set<string> seen;
+                    for(int i = 0; i < names.size(); i++) {
+                        if(seen.insert(names[i]).second) {
+                            unique.push_back(i);
+                        }
+                    }
+
+                    const int bucket_count = (unique.size() + 3) / 4;
+                    vector<vector<int> > buckets(bucket_count);
+                    for(int i = 0; i < unique.size(); i++) {
+                        buckets[HashName(names[unique[i]], 0) % bucket_count].push_back(unique[i]);
+                    }
+                    vector<int> order(bucket_count);
+                    for(int i = 0; i < bucket_count; i++) {
+                        order[i] = i;
+                    }
+                    std::stable_sort(order.begin(), order.end(), BucketOrder(buckets));
+
+                    seeds->assign(bucket_count, 0);
+                    slots->assign(unique.size(), -1);
+                    for(int i = 0; i < bucket_count; i++) {
+                        const vector<int> &bucket = buckets[order[i]];
+                        if(bucket.empty()) {
+                            break;
+                        }
+
+                        uint32 seed = 1;
+                        vector<int> placed;
+                        for(; seed < kMaxSeed; seed++) {
+                            placed.clear();
+                            for(int j = 0; j < bucket.size(); j++) {
+                                int slot = HashName(names[bucket[j]], seed) % slots->size();
+                                if((*slots)[slot] != -1 || std::find(placed.begin(), placed.end(), slot) != placed.end()) {
+                                    break;
+                                }
+                                placed.push_back(slot);
+                            }
+                            if(placed.size() == bucket.size()) {
+                                break;
+                            }
+                        }
+                        if(seed == kMaxSeed) {
+                            return false;
+                        }
+
+                        (*seeds)[order[i]] = seed;
+                        for(int j = 0; j < bucket.size(); j++) {
+                            (*slots)[placed[j]] = bucket[j];
+                        }
+                    }
+                    return true;
+                }
+
+                string UnsignedLiteral(uint32 value) {
+                    return SimpleItoa(value) + "U";
+                }
+
+                string HexLiteral(uint32 value) {
+                    char buffer[16];
+                    snprintf(buffer, sizeof(buffer), "0x%08xU", value);
+                    return buffer;
+                }
+            } // namespace
+
             void EnumGenerator::GenerateSource(io::Printer *printer) {
-                // IsValidValue generation
-                printer->Print(
-                    "BOOL $classname$IsValidValue($classname$ value) {\n"
-                    "  switch (value) {\n",
-                    "classname", ClassName(descriptor_));
+                // canonical_values_ is in declaration order; the tables below
+                // are in value order.
+                vector<const EnumValueDescriptor *> values(canonical_values_);
+                std::sort(values.begin(), values.end(), CompareValueNumber);
 
-                for(int i = 0; i < canonical_values_.size(); i++) {
-                    printer->Print(
-                        "    case $name$:\n",
-                        "name", EnumValueName(canonical_values_[i]));
+                map<string, string> vars;
+                vars["classname"] = ClassName(descriptor_);
+                vars["count"]     = SimpleItoa(values.size());
+
+                const int32 min  = values.front()->number();
+                const int32 max  = values.back()->number();
+                const uint64 span = static_cast<int64>(max) - min + 1;
+                vars["min"]       = UnsignedLiteral(static_cast<uint32>(min));
+                vars["span"]      = UnsignedLiteral(static_cast<uint32>(span));
+
+                // Dense enums are one range of values.  Semi-dense ones get a
+                // bitmap over their range, as long as it is no bigger than the
+                // sorted value array that sparse enums are searched in.
+                const bool dense  = span == values.size();
+                const bool bitmap = !dense && span / 32 <= values.size();
+                const bool string_representation = hasEnumStringRepresentationMethod(ClassName(descriptor_));
+
+                if(!dense && (!bitmap || string_representation)) {
+                    printer->Print(vars,
+                        "static const int32_t $classname$Values[] = {\n");
+                    for(int i = 0; i < values.size(); i++) {
+                        printer->Print(
+                            "  $value$,\n",
+                            "value", SimpleItoa(values[i]->number()));
+                    }
+                    printer->Print("};\n");
                 }
 
-                printer->Print(
-                    "      return YES;\n"
-                    "    default:\n"
-                    "      return NO;\n"
-                    "  }\n"
-                    "}\n");
+                // IsValidValue generation
+                if(dense) {
+                    printer->Print(vars,
+                        "BOOL $classname$IsValidValue($classname$ value) {\n"
+                        "  return (uint32_t)value - $min$ < $span$;\n"
+                        "}\n");
+                } else if(bitmap) {
+                    vector<uint32> words((span + 31) / 32, 0);
+                    for(int i = 0; i < values.size(); i++) {
+                        uint32 offset = static_cast<uint32>(values[i]->number()) - static_cast<uint32>(min);
+                        words[offset / 32] |= 1U << (offset % 32);
+                    }
+                    printer->Print(vars,
+                        "static const uint32_t $classname$ValidBits[] = {\n");
+                    for(int i = 0; i < words.size(); i++) {
+                        printer->Print(
+                            "  $word$,\n",
+                            "word", HexLiteral(words[i]));
+                    }
+                    printer->Print(vars,
+                        "};\n"
+                        "BOOL $classname$IsValidValue($classname$ value) {\n"
+                        "  uint32_t offset = (uint32_t)value - $min$;\n"
+                        "  return offset < $span$ && ($classname$ValidBits[offset >> 5] & (1U << (offset & 31))) != 0;\n"
+                        "}\n");
+                } else {
+                    printer->Print(vars,
+                        "BOOL $classname$IsValidValue($classname$ value) {\n"
+                        "  return PBEnumTableIndexOfValue($classname$Values, $count$, value) >= 0;\n"
+                        "}\n");
+                }
 
                 // StringRepresentation generation
-                if(hasEnumStringRepresentationMethod(ClassName(descriptor_))) {
-                    printer->Print(
-                        "const char* $classname$StringRepresentation($classname$ value) {\n"
-                        "  switch (value) {\n",
-                        "classname", ClassName(descriptor_));
-
-                    for(int i = 0; i < canonical_values_.size(); i++) {
+                if(string_representation) {
+                    vector<string> names;
+                    printer->Print(vars,
+                        "static const char* const $classname$Names[] = {\n");
+                    for(int i = 0; i < values.size(); i++) {
+                        names.push_back(UnderscoresToCamelCase(SafeName(values[i]->name())));
                         printer->Print(
-                            (std::string("    case $name$:\n") + std::string("      return \"") + UnderscoresToCamelCase(SafeName(canonical_values_[i]->name())) + std::string("\";\n")).c_str(),
-                            "name", EnumValueName(canonical_values_[i]));
+                            "  \"$name$\",\n",
+                            "name", CEscape(names.back()));
+                    }
+                    printer->Print("};\n");
+
+                    vector<uint32> seeds;
+                    vector<int> slots;
+                    if(BuildNameHash(names, &seeds, &slots)) {
+                        printer->Print(vars,
+                            "static const uint32_t $classname$NameSeeds[] = {\n");
+                        for(int i = 0; i < seeds.size(); i++) {
+                            printer->Print(
+                                "  $seed$,\n",
+                                "seed", UnsignedLiteral(seeds[i]));
+                        }
+                        printer->Print(vars,
+                            "};\n"
+                            "static const int32_t $classname$NameSlots[] = {\n");
+                        for(int i = 0; i < slots.size(); i++) {
+                            printer->Print(
+                                "  $slot$,\n",
+                                "slot", SimpleItoa(slots[i]));
+                        }
+                        vars["seed_count"] = SimpleItoa(seeds.size());
+                        vars["slot_count"] = SimpleItoa(slots.size());
+                        printer->Print(vars,
+                            "};\n"
+                            "static const PBEnumNameTable $classname$NameTable = {\n"
+                            "  $classname$Names, $count$,\n"
+                            "  $classname$NameSeeds, $seed_count$,\n"
+                            "  $classname$NameSlots, $slot_count$,\n"
+                            "};\n");
+                    } else {
+                        printer->Print(vars,
+                            "static const PBEnumNameTable $classname$NameTable = { $classname$Names, $count$, NULL, 0, NULL, 0 };\n");
                     }
 
+                    if(dense) {
+                        printer->Print(vars,
+                            "const char* $classname$StringRepresentation($classname$ value) {\n"
+                            "  return $classname$IsValidValue(value) ? $classname$Names[(uint32_t)value - $min$] : NULL;\n"
+                            "}\n"
+                            "BOOL $classname$FromStringRepresentation(const char* name, $classname$* value) {\n"
+                            "  NSInteger index = PBEnumTableIndexOfName(&$classname$NameTable, name);\n"
+                            "  if (index < 0) {\n"
+                            "    return NO;\n"
+                            "  }\n"
+                            "  *value = ($classname$)($min$ + (uint32_t)index);\n"
+                            "  return YES;\n"
+                            "}\n");
+                    } else {
+                        printer->Print(vars,
+                            "const char* $classname$StringRepresentation($classname$ value) {\n"
+                            "  NSInteger index = PBEnumTableIndexOfValue($classname$Values, $count$, value);\n"
+                            "  return index < 0 ? NULL : $classname$Names[index];\n"
+                            "}\n"
+                            "BOOL $classname$FromStringRepresentation(const char* name, $classname$* value) {\n"
+                            "  NSInteger index = PBEnumTableIndexOfName(&$classname$NameTable, name);\n"
+                            "  if (index < 0) {\n"
+                            "    return NO;\n"
+                            "  }\n"
+                            "  *value = ($classname$)$classname$Values[index];\n"
+                            "  return YES;\n"
+                            "}\n");
+                    }
+                }
+
+                if(!IsLiteRuntime()) {
+                    GenerateTextFormatSource(printer);
+                }
+            }
+
+            void EnumGenerator::GenerateTextFormatSource(io::Printer *printer) {
+                // Text format names every value as written in the .proto file,
+                // aliases included.
+                map<string, string> vars;
+                vars["classname"] = ClassName(descriptor_);
+                vars["count"]     = SimpleItoa(descriptor_->value_count());
+
+                printer->Print(vars,
+                    "static const char* const $classname$TextFormatNames[] = {\n");
+                for(int i = 0; i < descriptor_->value_count(); i++) {
                     printer->Print(
-                        "  }\n"
-                        "}\n");
+                        "  \"$name$\",\n",
+                        "name", CEscape(descriptor_->value(i)->name()));
+                }
+                printer->Print(vars,
+                    "};\n"
+                    "static const int32_t $classname$TextFormatValues[] = {\n");
+                for(int i = 0; i < descriptor_->value_count(); i++) {
+                    printer->Print(
+                        "  $value$,\n",
+                        "value", SimpleItoa(descriptor_->value(i)->number()));
                 }
+                printer->Print(vars,
+                    "};\n"
+                    "$classname$ $classname$ReadTextFormat(PBTextFormatReader* reader) {\n"
+                    "  return ($classname$)PBTextFormatReaderReadEnum(reader, $classname$TextFormatNames, $classname$TextFormatValues, $count$);\n"
+                    "}\n");
+
+                // JSON uses the same names, and falls back to the number for values
+                // this version of the enum does not know.
+                printer->Print(vars,
+                    "void $classname$WriteJSON(PBJSONWriter* writer, const char* name, $classname$ value) {\n"
+                    "  PBJSONWriteEnum(writer, name, value, $classname$TextFormatNames, $classname$TextFormatValues, $count$);\n"
+                    "}\n"
+                    "$classname$ $classname$ReadJSON(PBJSONReader* reader) {\n"
+                    "  return ($classname$)PBJSONReaderReadEnum(reader, $classname$TextFormatNames, $classname$TextFormatValues, $count$);\n"
+                    "}\n");
             }
         } // namespace objectivec
     }     // namespace compiler
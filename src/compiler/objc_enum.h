@@ -43,6 +43,8 @@ namespace protobuf {
                 void GenerateSource(io::Printer *printer);
 
             private:
+                void GenerateTextFormatSource(io::Printer *printer);
+
                 const EnumDescriptor *descriptor_;
                 vector<const EnumValueDescriptor *> canonical_values_;
 
@@ -44,6 +44,7 @@ namespace protobuf {
                     (*variables)["name"]             = UnderscoresToCamelCase(descriptor);
                     (*variables)["capitalized_name"] = UnderscoresToCapitalizedCamelCase(descriptor);
                     (*variables)["list_name"]        = UnderscoresToCamelCase(descriptor) + "Array";
+                    (*variables)["json_name"]        = JSONFieldName(descriptor);
                     (*variables)["number"]           = SimpleItoa(descriptor->number());
                     (*variables)["type"]             = type;
                     (*variables)["default"]          = EnumValueName(default_value);
@@ -169,6 +170,16 @@ namespace protobuf {
                     "}\n");
             }
 
+            void EnumFieldGenerator::GenerateTextFormatParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "[self set$capitalized_name$:$type$ReadTextFormat(reader)];\n");
+            }
+
+            void EnumFieldGenerator::GenerateJSONParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "[self set$capitalized_name$:$type$ReadJSON(reader)];\n");
+            }
+
             void EnumFieldGenerator::GenerateSerializationCodeHeader(io::Printer *printer) const {
             }
 
@@ -192,7 +203,14 @@ namespace protobuf {
             void EnumFieldGenerator::GenerateDescriptionCodeSource(io::Printer *printer) const {
                 printer->Print(variables_,
                     "if (self.has$capitalized_name$) {\n"
-                    "  [output appendFormat:@\"%@%@: %d\\n\", indent, @\"$name$\", self.$name$];\n"
+                    "  PBTextFormatWriteInt32(writer, \"$name$\", self.$name$);\n"
+                    "}\n");
+            }
+
+            void EnumFieldGenerator::GenerateJSONWritingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "if (self.has$capitalized_name$) {\n"
+                    "  $type$WriteJSON(writer, \"$json_name$\", self.$name$);\n"
                     "}\n");
             }
 
@@ -209,6 +227,31 @@ namespace protobuf {
                     "}\n");
             }
 
+            void EnumFieldGenerator::GenerateFieldTableEntrySource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "{ \"$name$\", \"has$capitalized_name$\", PBFieldTableTypeEnum, $number$, 0 },\n");
+            }
+
+            void EnumFieldGenerator::GenerateDiffCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "if (self.has$capitalized_name$) {\n"
+                    "  if (!other.has$capitalized_name$ || self.$name$ != other.$name$) {\n"
+                    "    changes.has$capitalized_name$ = YES;\n"
+                    "    changes.$name$ = self.$name$;\n"
+                    "  }\n"
+                    "} else if (other.has$capitalized_name$) {\n"
+                    "  [clearedFields addObject:@$number$];\n"
+                    "}\n");
+            }
+
+            void EnumFieldGenerator::GenerateApplyDeltaCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "if ([clearedFields containsObject:@$number$]) {\n"
+                    "  [self clear$capitalized_name$];\n"
+                    "}\n");
+                GenerateMergingCodeSource(printer);
+            }
+
             string EnumFieldGenerator::GetBoxedType() const {
                 return ClassName(descriptor_->enum_type());
             }
@@ -372,6 +415,19 @@ namespace protobuf {
                 }
             }
 
+            void RepeatedEnumFieldGenerator::GenerateTextFormatParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "[self add$capitalized_name$:$type$ReadTextFormat(reader)];\n");
+            }
+
+            void RepeatedEnumFieldGenerator::GenerateJSONParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "PBJSONReaderBeginArray(reader);\n"
+                    "while (PBJSONReaderHasNextElement(reader)) {\n"
+                    "  [self add$capitalized_name$:$type$ReadJSON(reader)];\n"
+                    "}\n");
+            }
+
             void RepeatedEnumFieldGenerator::GenerateSerializationCodeSource(io::Printer *printer) const {
                 printer->Print(variables_,
                     "const NSUInteger $list_name$Count = self.$list_name$.count;\n"
@@ -438,12 +494,28 @@ namespace protobuf {
                 printer->Indent();
                 printer->Print(variables_,
                     "for (NSUInteger i = 0; i < $list_name$Count; ++i) {\n"
-                    "  [output appendFormat:@\"%@%@: %d\\n\", indent, @\"$name$\", $list_name$Values[i]];\n"
+                    "  PBTextFormatWriteInt32(writer, \"$name$\", $list_name$Values[i]);\n"
                     "}\n");
                 printer->Outdent();
                 printer->Print("}\n");
             }
 
+            void RepeatedEnumFieldGenerator::GenerateJSONWritingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "const NSUInteger $list_name$Count = self.$list_name$.count;\n"
+                    "if ($list_name$Count > 0) {\n"
+                    "  const $type$ *$list_name$Values = (const $type$ *)self.$list_name$.data;\n"
+                    "  PBJSONWriterBeginArray(writer, \"$json_name$\");\n");
+                printer->Indent();
+                printer->Print(variables_,
+                    "for (NSUInteger i = 0; i < $list_name$Count; ++i) {\n"
+                    "  $type$WriteJSON(writer, NULL, $list_name$Values[i]);\n"
+                    "}\n"
+                    "PBJSONWriterEndArray(writer);\n");
+                printer->Outdent();
+                printer->Print("}\n");
+            }
+
             void RepeatedEnumFieldGenerator::GenerateIsEqualCodeSource(io::Printer *printer) const {
                 printer->Print(variables_, "(self.$list_name$ == otherMessage.$list_name$ || [self.$list_name$ isEqualToArray:otherMessage.$list_name$]) &&");
             }
@@ -461,6 +533,31 @@ namespace protobuf {
                 printer->Outdent();
                 printer->Print("}\n");
             }
+
+            void RepeatedEnumFieldGenerator::GenerateFieldTableEntrySource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "{ \"$name$\", NULL, PBFieldTableTypeEnum, $number$, 0 },\n");
+            }
+
+            void RepeatedEnumFieldGenerator::GenerateDiffCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "if (self.$list_name$ != other.$list_name$ && ![self.$list_name$ isEqualToArray:other.$list_name$]) {\n"
+                    "  if (self.$list_name$.count > 0) {\n"
+                    "    changes.$list_name$ = self.$list_name$;\n"
+                    "  } else {\n"
+                    "    [clearedFields addObject:@$number$];\n"
+                    "  }\n"
+                    "}\n");
+            }
+
+            void RepeatedEnumFieldGenerator::GenerateApplyDeltaCodeSource(io::Printer *printer) const {
+                // A changed list replaces the old one; merging alone would append to it.
+                printer->Print(variables_,
+                    "if ([clearedFields containsObject:@$number$] || other.$list_name$.count > 0) {\n"
+                    "  [self clear$capitalized_name$];\n"
+                    "}\n");
+                GenerateMergingCodeSource(printer);
+            }
         } // namespace objectivec
     }     // namespace compiler
 } // namespace protobuf
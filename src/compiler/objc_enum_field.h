@@ -55,11 +55,17 @@ namespace protobuf {
                 void GenerateMergingCodeSource(io::Printer *printer) const;
                 void GenerateBuildingCodeSource(io::Printer *printer) const;
                 void GenerateParsingCodeSource(io::Printer *printer) const;
+                void GenerateTextFormatParsingCodeSource(io::Printer *printer) const;
+                void GenerateJSONParsingCodeSource(io::Printer *printer) const;
                 void GenerateSerializationCodeSource(io::Printer *printer) const;
                 void GenerateSerializedSizeCodeSource(io::Printer *printer) const;
                 void GenerateDescriptionCodeSource(io::Printer *printer) const;
+                void GenerateJSONWritingCodeSource(io::Printer *printer) const;
                 void GenerateIsEqualCodeSource(io::Printer *printer) const;
                 void GenerateHashCodeSource(io::Printer *printer) const;
+                void GenerateFieldTableEntrySource(io::Printer *printer) const;
+                void GenerateDiffCodeSource(io::Printer *printer) const;
+                void GenerateApplyDeltaCodeSource(io::Printer *printer) const;
                 void GenerateBuilderClearSource(io::Printer *printer) const;
                 void GenerateBuilderGetterSource(io::Printer *printer) const;
 
@@ -99,11 +105,17 @@ namespace protobuf {
                 void GenerateMergingCodeSource(io::Printer *printer) const;
                 void GenerateBuildingCodeSource(io::Printer *printer) const;
                 void GenerateParsingCodeSource(io::Printer *printer) const;
+                void GenerateTextFormatParsingCodeSource(io::Printer *printer) const;
+                void GenerateJSONParsingCodeSource(io::Printer *printer) const;
                 void GenerateSerializationCodeSource(io::Printer *printer) const;
                 void GenerateSerializedSizeCodeSource(io::Printer *printer) const;
                 void GenerateDescriptionCodeSource(io::Printer *printer) const;
+                void GenerateJSONWritingCodeSource(io::Printer *printer) const;
                 void GenerateIsEqualCodeSource(io::Printer *printer) const;
                 void GenerateHashCodeSource(io::Printer *printer) const;
+                void GenerateFieldTableEntrySource(io::Printer *printer) const;
+                void GenerateDiffCodeSource(io::Printer *printer) const;
+                void GenerateApplyDeltaCodeSource(io::Printer *printer) const;
                 void GenerateBuilderClearSource(io::Printer *printer) const;
                 void GenerateBuilderGetterSource(io::Printer *printer) const;
 
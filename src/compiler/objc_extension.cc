@@ -54,6 +54,20 @@ namespace protobuf {
                     "static id<PBExtensionField> $containing_type$_$name$ = nil;\n");
             }
 
+            void ExtensionGenerator::GenerateSharedFieldsSource(io::Printer *printer, bool declaration) {
+                map<string, string> vars;
+                vars["name"]            = UnderscoresToCamelCase(descriptor_);
+                vars["containing_type"] = classname_;
+
+                if(declaration) {
+                    printer->Print(vars,
+                        "extern id<PBExtensionField> $containing_type$_$name$;\n");
+                } else {
+                    printer->Print(vars,
+                        "id<PBExtensionField> $containing_type$_$name$ = nil;\n");
+                }
+            }
+
             void ExtensionGenerator::GenerateMembersSource(io::Printer *printer) {
                 map<string, string> vars;
                 vars["name"]            = UnderscoresToCamelCase(descriptor_);
@@ -146,7 +160,8 @@ namespace protobuf {
                 }
 
                 if(descriptor_->is_repeated()) {
-                    if(isObjectArray(descriptor_)) {
+                    // Repeated enum extensions are NSArrays of NSNumbers, not PBArrays.
+                    if(isObjectArray(descriptor_) || descriptor_->type() == FieldDescriptor::TYPE_ENUM) {
                         vars["default"] = string("[[NSArray alloc] init]");
                     } else {
                         vars["default"] = string("[PBArray arrayWithValueType:") + GetArrayValueType(descriptor_) + "]";
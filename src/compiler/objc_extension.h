@@ -40,6 +40,10 @@ namespace protobuf {
                 void GenerateMembersHeader(io::Printer *printer);
                 void GenerateMembersSource(io::Printer *printer);
                 void GenerateFieldsSource(io::Printer *printer);
+                // Like GenerateFieldsSource, but with external linkage so a message
+                // implementation in another .pb.m can reach the field.  With
+                // declaration set only the extern declaration is printed.
+                void GenerateSharedFieldsSource(io::Printer *printer, bool declaration);
                 void GenerateInitializationSource(io::Printer *printer);
                 void GenerateRegistrationSource(io::Printer *printer);
 
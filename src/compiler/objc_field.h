@@ -60,13 +60,19 @@ namespace protobuf {
                 virtual void GenerateMergingCodeSource(io::Printer *printer) const        = 0;
                 virtual void GenerateBuildingCodeSource(io::Printer *printer) const       = 0;
                 virtual void GenerateParsingCodeSource(io::Printer *printer) const        = 0;
+                virtual void GenerateTextFormatParsingCodeSource(io::Printer *printer) const = 0;
+                virtual void GenerateJSONParsingCodeSource(io::Printer *printer) const    = 0;
                 virtual void GenerateSerializationCodeSource(io::Printer *printer) const  = 0;
                 virtual void GenerateSerializedSizeCodeSource(io::Printer *printer) const = 0;
                 virtual void GenerateDescriptionCodeSource(io::Printer *printer) const    = 0;
+                virtual void GenerateJSONWritingCodeSource(io::Printer *printer) const    = 0;
                 virtual void GenerateIsEqualCodeSource(io::Printer *printer) const        = 0;
                 virtual void GenerateHashCodeSource(io::Printer *printer) const           = 0;
+                virtual void GenerateFieldTableEntrySource(io::Printer *printer) const    = 0;
                 virtual void GenerateBuilderClearSource(io::Printer *printer) const       = 0;
                 virtual void GenerateBuilderGetterSource(io::Printer *printer) const      = 0;
+                virtual void GenerateDiffCodeSource(io::Printer *printer) const           = 0;
+                virtual void GenerateApplyDeltaCodeSource(io::Printer *printer) const     = 0;
 
             private:
                 GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(FieldGenerator);
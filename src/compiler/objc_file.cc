@@ -36,7 +36,20 @@ namespace protobuf {
 
             FileGenerator::FileGenerator(const FileDescriptor *file)
                 : file_(file)
-                , classname_(FileClassName(file)) {
+                , classname_(FileClassName(file))
+                , enum_generators_(new scoped_ptr<EnumGenerator>[file->enum_type_count()])
+                , message_generators_(new scoped_ptr<MessageGenerator>[file->message_type_count()])
+                , extension_generators_(new scoped_ptr<ExtensionGenerator>[file->extension_count()]) {
+
+                for(int i = 0; i < file->enum_type_count(); i++) {
+                    enum_generators_[i].reset(new EnumGenerator(file->enum_type(i)));
+                }
+                for(int i = 0; i < file->message_type_count(); i++) {
+                    message_generators_[i].reset(new MessageGenerator(file->message_type(i)));
+                }
+                for(int i = 0; i < file->extension_count(); i++) {
+                    extension_generators_[i].reset(new ExtensionGenerator(classname_, file->extension(i)));
+                }
             }
 
             FileGenerator::~FileGenerator() {
@@ -55,6 +68,9 @@ namespace protobuf {
 
                     if(file_->dependency_count() > 0) {
                         for(int i = 0; i < file_->dependency_count(); i++) {
+                            if(!IsRuntimeDependency(file_->dependency(i))) {
+                                continue;
+                            }
                             printer->Print("#import <$prefix$/$header$.pb.h>\n",
                                 "prefix", importPrefix,
                                 "header", FilePath(file_->dependency(i)));
@@ -114,7 +130,7 @@ namespace protobuf {
                                "+ (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry;\n");
 
                 for(int i = 0; i < file_->extension_count(); i++) {
-                    ExtensionGenerator(classname_, file_->extension(i)).GenerateMembersHeader(printer);
+                    extension_generators_[i]->GenerateMembersHeader(printer);
                 }
 
                 printer->Print("@end\n\n");
@@ -125,42 +141,45 @@ namespace protobuf {
 
                 // need to write out all enums first
                 for(int i = 0; i < file_->enum_type_count(); i++) {
-                    EnumGenerator(file_->enum_type(i)).GenerateHeader(printer);
+                    enum_generators_[i]->GenerateHeader(printer);
                 }
 
                 for(int i = 0; i < file_->message_type_count(); i++) {
-                    MessageGenerator(file_->message_type(i)).GenerateEnumHeader(printer);
+                    message_generators_[i]->GenerateEnumHeader(printer);
                 }
             }
 
             void FileGenerator::GenerateHeaders(OutputDirectory *outputDirectory, string extension, string aggregateHeaderName) {
-
                 for(int i = 0; i < file_->message_type_count(); i++) {
-                    const Descriptor *descriptor = file_->message_type(i);
-                    string generatedClassName    = ClassName(descriptor);
+                    GenerateMessageHeader(outputDirectory, i, aggregateHeaderName);
+                }
+            }
 
-                    scoped_ptr<io::ZeroCopyOutputStream> output(outputDirectory->Open(generatedClassName + ".pb.h"));
-                    io::Printer printer(output.get(), '$');
+            void FileGenerator::GenerateMessageHeader(OutputDirectory *outputDirectory, int index, const string &aggregateHeaderName) {
+                const Descriptor *descriptor = file_->message_type(index);
+                string generatedClassName    = ClassName(descriptor);
 
-                    printer.Print("// Generated by the protocol buffer compiler.  DO NOT EDIT!\n\n");
+                scoped_ptr<io::ZeroCopyOutputStream> output(outputDirectory->Open(generatedClassName + ".pb.h"));
+                io::Printer printer(output.get(), '$');
 
-                    if(isDummyMessage(generatedClassName)) {
-                        printer.Print("// this message is explicitly excluded from generation");
-                        continue;
-                    }
+                printer.Print("// Generated by the protocol buffer compiler.  DO NOT EDIT!\n\n");
 
-                    if(!aggregateHeaderName.empty()) {
-                        printer.Print("#import \"$value$\"\n\n", "value", aggregateHeaderName);
-                    }
+                if(isDummyMessage(generatedClassName)) {
+                    printer.Print("// this message is explicitly excluded from generation");
+                    return;
+                }
 
-                    printer.Print("@class $value$;\n\n", "value", generatedClassName + "_Builder");
+                if(!aggregateHeaderName.empty()) {
+                    printer.Print("#import \"$value$\"\n\n", "value", aggregateHeaderName);
+                }
 
-                    printer.Print("NS_ASSUME_NONNULL_BEGIN\n\n");
+                printer.Print("@class $value$;\n\n", "value", generatedClassName + "_Builder");
 
-                    MessageGenerator(descriptor).GenerateMessageHeader(&printer);
+                printer.Print("NS_ASSUME_NONNULL_BEGIN\n\n");
 
-                    printer.Print("NS_ASSUME_NONNULL_END\n\n");
-                }
+                message_generators_[index]->GenerateMessageHeader(&printer);
+
+                printer.Print("NS_ASSUME_NONNULL_END\n\n");
             }
 
             void FileGenerator::GenerateHeader(io::Printer *printer) {
@@ -175,6 +194,9 @@ namespace protobuf {
 
                 if(file_->dependency_count() > 0) {
                     for(int i = 0; i < file_->dependency_count(); i++) {
+                        if(!IsRuntimeDependency(file_->dependency(i))) {
+                            continue;
+                        }
                         printer->Print(
                             "#import \"$header$.pb.h\"\n",
                             "header", FilePath(file_->dependency(i)));
@@ -206,10 +228,10 @@ namespace protobuf {
 
                 // need to write out all enums first
                 for(int i = 0; i < file_->enum_type_count(); i++) {
-                    EnumGenerator(file_->enum_type(i)).GenerateHeader(printer);
+                    enum_generators_[i]->GenerateHeader(printer);
                 }
                 for(int i = 0; i < file_->message_type_count(); i++) {
-                    MessageGenerator(file_->message_type(i)).GenerateEnumHeader(printer);
+                    message_generators_[i]->GenerateEnumHeader(printer);
                 }
 
                 printer->Print(
@@ -224,13 +246,24 @@ namespace protobuf {
                     "+ (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry;\n");
 
                 for(int i = 0; i < file_->extension_count(); i++) {
-                    ExtensionGenerator(classname_, file_->extension(i)).GenerateMembersHeader(printer);
+                    extension_generators_[i]->GenerateMembersHeader(printer);
                 }
 
                 printer->Print("@end\n\n");
 
                 for(int i = 0; i < file_->message_type_count(); i++) {
-                    MessageGenerator(file_->message_type(i)).GenerateMessageHeader(printer);
+                    message_generators_[i]->GenerateMessageHeader(printer);
+                }
+            }
+
+            // Imported files only contribute class names, so they are walked by
+            // descriptor instead of building generators for all of their fields.
+            void DetermineMessageDependencies(set<string> *dependencies, const Descriptor *descriptor) {
+                dependencies->insert("@class " + ClassName(descriptor));
+                dependencies->insert("@class " + ClassName(descriptor) + "_Builder");
+
+                for(int i = 0; i < descriptor->nested_type_count(); i++) {
+                    DetermineMessageDependencies(dependencies, descriptor->nested_type(i));
                 }
             }
 
@@ -246,17 +279,31 @@ namespace protobuf {
                     DetermineDependenciesWorker(dependencies, seen_files, file->dependency(i));
                 }
                 for(int i = 0; i < file->message_type_count(); i++) {
-                    MessageGenerator(file->message_type(i)).DetermineDependencies(dependencies);
+                    DetermineMessageDependencies(dependencies, file->message_type(i));
                 }
             }
 
             void FileGenerator::DetermineDependencies(set<string> *dependencies) {
                 set<string> seen_files;
-                DetermineDependenciesWorker(dependencies, &seen_files, file_);
+                seen_files.insert(file_->name());
+
+                for(int i = 0; i < file_->dependency_count(); i++) {
+                    DetermineDependenciesWorker(dependencies, &seen_files, file_->dependency(i));
+                }
+                for(int i = 0; i < file_->message_type_count(); i++) {
+                    message_generators_[i]->DetermineDependencies(dependencies);
+                }
             }
 
             void FileGenerator::GenerateSource(io::Printer *printer) {
-                FileGenerator file_generator(file_);
+                GenerateSource(printer, true);
+            }
+
+            void FileGenerator::GenerateRootSource(io::Printer *printer) {
+                GenerateSource(printer, false);
+            }
+
+            void FileGenerator::GenerateSource(io::Printer *printer, bool includeMessages) {
                 string header_file = FileName(file_) + ".pb.h";
 
                 printer->Print(
@@ -272,53 +319,70 @@ namespace protobuf {
                     "classname", classname_);
 
                 for(int i = 0; i < file_->extension_count(); i++) {
-                    ExtensionGenerator(classname_, file_->extension(i)).GenerateFieldsSource(printer);
+                    extension_generators_[i]->GenerateFieldsSource(printer);
                 }
 
+                // Extensions scoped to a message are returned from that message's
+                // implementation, which may live in its own file.
                 for(int i = 0; i < file_->message_type_count(); i++) {
-                    MessageGenerator(file_->message_type(i)).GenerateStaticVariablesSource(printer);
+                    if(includeMessages) {
+                        message_generators_[i]->GenerateStaticVariablesSource(printer);
+                    } else {
+                        message_generators_[i]->GenerateSharedVariablesSource(printer, false);
+                    }
                 }
 
+                // The registry covers this file's and its dependencies' extensions,
+                // so it is only assembled when somebody asks for it.
                 printer->Print(
-                    "static PBExtensionRegistry* extensionRegistry = nil;\n"
                     "+ (PBExtensionRegistry*) extensionRegistry {\n"
-                    "  return extensionRegistry;\n"
-                    "}\n"
-                    "\n"
-                    "+ (void) initialize {\n"
-                    "  if (self == [$classname$ class]) {\n",
+                    "  static PBExtensionRegistry* extensionRegistry = nil;\n"
+                    "  static dispatch_once_t onceToken;\n"
+                    "  dispatch_once(&onceToken, ^{\n"
+                    "    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];\n"
+                    "    [$classname$ registerAllExtensions:registry];\n",
                     "classname", classname_);
 
-                printer->Indent();
-                printer->Indent();
-
-                for(int i = 0; i < file_->extension_count(); i++) {
-                    ExtensionGenerator(classname_, file_->extension(i)).GenerateInitializationSource(printer);
-                }
-
-                for(int i = 0; i < file_->message_type_count(); i++) {
-                    MessageGenerator(file_->message_type(i)).GenerateStaticVariablesInitialization(printer);
-                }
-
-                printer->Print(
-                    "PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];\n"
-                    "[self registerAllExtensions:registry];\n");
-
                 for(int i = 0; i < file_->dependency_count(); i++) {
+                    if(!IsRuntimeDependency(file_->dependency(i))) {
+                        continue;
+                    }
                     printer->Print(
-                        "[$dependency$ registerAllExtensions:registry];\n",
+                        "    [$dependency$ registerAllExtensions:registry];\n",
                         "dependency", FileClassName(file_->dependency(i)));
                 }
 
                 printer->Print(
-                    "extensionRegistry = registry;\n");
+                    "    extensionRegistry = registry;\n"
+                    "  });\n"
+                    "  return extensionRegistry;\n"
+                    "}\n");
 
-                printer->Outdent();
-                printer->Outdent();
+                if(HasExtensions(file_)) {
+                    printer->Print(
+                        "\n"
+                        "+ (void) initialize {\n"
+                        "  if (self == [$classname$ class]) {\n",
+                        "classname", classname_);
 
-                printer->Print(
-                    "  }\n"
-                    "}\n");
+                    printer->Indent();
+                    printer->Indent();
+
+                    for(int i = 0; i < file_->extension_count(); i++) {
+                        extension_generators_[i]->GenerateInitializationSource(printer);
+                    }
+
+                    for(int i = 0; i < file_->message_type_count(); i++) {
+                        message_generators_[i]->GenerateStaticVariablesInitialization(printer);
+                    }
+
+                    printer->Outdent();
+                    printer->Outdent();
+
+                    printer->Print(
+                        "  }\n"
+                        "}\n");
+                }
 
                 // -----------------------------------------------------------------
 
@@ -327,13 +391,11 @@ namespace protobuf {
                 printer->Indent();
 
                 for(int i = 0; i < file_->extension_count(); i++) {
-                    ExtensionGenerator(classname_, file_->extension(i))
-                        .GenerateRegistrationSource(printer);
+                    extension_generators_[i]->GenerateRegistrationSource(printer);
                 }
 
                 for(int i = 0; i < file_->message_type_count(); i++) {
-                    MessageGenerator(file_->message_type(i))
-                        .GenerateExtensionRegistrationSource(printer);
+                    message_generators_[i]->GenerateExtensionRegistrationSource(printer);
                 }
 
                 printer->Outdent();
@@ -343,22 +405,50 @@ namespace protobuf {
                 // -----------------------------------------------------------------
 
                 for(int i = 0; i < file_->extension_count(); i++) {
-                    ExtensionGenerator(classname_, file_->extension(i)).GenerateMembersSource(printer);
+                    extension_generators_[i]->GenerateMembersSource(printer);
                 }
 
                 printer->Print(
                     "@end\n\n");
 
                 for(int i = 0; i < file_->enum_type_count(); i++) {
-                    EnumGenerator(file_->enum_type(i)).GenerateSource(printer);
+                    enum_generators_[i]->GenerateSource(printer);
                 }
-                for(int i = 0; i < file_->message_type_count(); i++) {
-                    MessageGenerator(file_->message_type(i)).GenerateSource(printer);
+                if(includeMessages) {
+                    for(int i = 0; i < file_->message_type_count(); i++) {
+                        message_generators_[i]->GenerateSource(printer);
+                    }
                 }
 
                 printer->Print("#pragma clang diagnostic pop\n");
             }
 
+            void FileGenerator::GenerateMessageSource(OutputDirectory *outputDirectory, int index) {
+                string generatedClassName = ClassName(file_->message_type(index));
+
+                scoped_ptr<io::ZeroCopyOutputStream> output(outputDirectory->Open(generatedClassName + ".pb.m"));
+                io::Printer printer(output.get(), '$');
+
+                printer.Print("// Generated by the protocol buffer compiler.  DO NOT EDIT!\n\n");
+
+                if(isDummyMessage(generatedClassName)) {
+                    printer.Print("// this message is explicitly excluded from generation");
+                    return;
+                }
+
+                printer.Print("#import \"$header_file$\"\n\n",
+                    "header_file", FileName(file_) + ".pb.h");
+
+                printer.Print("#pragma clang diagnostic push\n");
+                printer.Print("#pragma clang diagnostic ignored \"-Wshadow-ivar\"\n\n");
+
+                message_generators_[index]->GenerateSharedVariablesSource(&printer, true);
+
+                message_generators_[index]->GenerateSource(&printer);
+
+                printer.Print("#pragma clang diagnostic pop\n");
+            }
+
             std::string FileGenerator::GetImportPrefix() {
                 if(char *p = ::getenv("PROTOC_GEN_OBJC_IMPORT_PREFIX"); p != NULL) {
                     return string(p);
@@ -35,6 +35,9 @@ namespace protobuf {
     namespace compiler {
         class GeneratorContext;
         namespace objectivec {
+            class EnumGenerator;      // objc_enum.h
+            class ExtensionGenerator; // objc_extension.h
+            class MessageGenerator;   // objc_message.h
 
             class FileGenerator {
             public:
@@ -42,6 +45,11 @@ namespace protobuf {
                 ~FileGenerator();
 
                 void GenerateSource(io::Printer *printer);
+                // The file-level part of GenerateSource: the root class, extension
+                // registry and top-level enums.  Top-level messages are then written
+                // with GenerateMessageSource, one implementation file each.
+                void GenerateRootSource(io::Printer *printer);
+                void GenerateMessageSource(GeneratorContext *outputDirectory, int index);
                 void GenerateHeader(io::Printer *printer);
                 void DetermineDependencies(set<string> *dependencies);
 
@@ -49,15 +57,26 @@ namespace protobuf {
                 void GenerateAggregateHeader(io::Printer *printer, string enumsHeaderName);
                 void GenerateHeaders(GeneratorContext *outputDirectory, string extension, string aggregateHeaderName);
 
+                // Writes the divided header of the top-level message at index.
+                // Each message header goes to its own file, so these may be generated
+                // concurrently with each other and with the rest of the file.
+                void GenerateMessageHeader(GeneratorContext *outputDirectory, int index, const string &aggregateHeaderName);
+
                 const string &classname() { return classname_; }
 
             private:
                 static std::string GetImportPrefix();
+                void GenerateSource(io::Printer *printer, bool includeMessages);
 
             private:
                 const FileDescriptor *file_;
                 string classname_;
 
+                // Built once in the constructor and shared by every Generate* pass.
+                scoped_array<scoped_ptr<EnumGenerator>> enum_generators_;
+                scoped_array<scoped_ptr<MessageGenerator>> message_generators_;
+                scoped_array<scoped_ptr<ExtensionGenerator>> extension_generators_;
+
                 GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(FileGenerator);
             };
         } // namespace objectivec
@@ -17,9 +17,21 @@
 
 #include "objc_generator.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <thread>
+
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/io/printer.h>
 #include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/stubs/strutil.h>
 
 #include "objc_file.h"
@@ -35,7 +47,232 @@ namespace protobuf {
             ObjectiveCGenerator::~ObjectiveCGenerator() {
             }
 
+            namespace {
+                // Remembers a hash of every output written under "skip_unchanged=<manifest>".
+                // protoc writes exactly the files a plugin returns, so leaving an output
+                // whose content did not change out of the response leaves it untouched on
+                // disk, modification time included.  Outputs are looked up relative to the
+                // manifest's directory, so the manifest belongs in the root of the output
+                // directory.  The manifest only says which outputs are worth checking:
+                // one is skipped only if the file on disk still holds the generated
+                // bytes, so a protoc run that failed before writing its outputs cannot
+                // leave stale files behind.
+                class OutputManifest {
+                public:
+                    explicit OutputManifest(const string &path)
+                        : path_(path) {
+                        string::size_type slash = path.find_last_of('/');
+                        if(slash != string::npos) {
+                            root_ = path.substr(0, slash + 1);
+                        }
+                    }
+
+                    // A manifest that does not exist yet is empty.  Each line holds the
+                    // hash in hex, a space and the output name.
+                    bool Load(string *error) {
+                        std::ifstream input(path_.c_str());
+                        if(!input.is_open()) {
+                            return true;
+                        }
+                        string line;
+                        while(std::getline(input, line)) {
+                            string::size_type space = line.find(' ');
+                            if(space == string::npos || space == 0) {
+                                *error = "Malformed skip_unchanged manifest: " + path_;
+                                return false;
+                            }
+                            hashes_[line.substr(space + 1)] = strtoull(line.substr(0, space).c_str(), NULL, 16);
+                        }
+                        return true;
+                    }
+
+                    // Records the content generated for filename.  Returns false if the
+                    // previous run generated the same content and the file on disk
+                    // still matches it.
+                    bool Record(const string &filename, const string &content) {
+                        uint64 hash = Hash(content);
+                        std::map<string, uint64>::iterator entry = hashes_.find(filename);
+                        if(entry != hashes_.end() && entry->second == hash && FileMatches(root_ + filename, content)) {
+                            return false;
+                        }
+                        hashes_[filename] = hash;
+                        return true;
+                    }
+
+                    // Entries for outputs this run did not produce are kept, so protoc
+                    // can be invoked once per .proto against the same manifest.  The new
+                    // manifest replaces the old one only once it is complete.
+                    bool Save(string *error) const {
+                        string temporary = path_ + ".tmp";
+                        {
+                            std::ofstream output(temporary.c_str(), std::ios::out | std::ios::trunc);
+                            char hash[17];
+                            for(std::map<string, uint64>::const_iterator i(hashes_.begin()); i != hashes_.end(); ++i) {
+                                snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)i->second);
+                                output << hash << ' ' << i->first << '\n';
+                            }
+                            if(!output.flush()) {
+                                *error = "Could not write skip_unchanged manifest: " + temporary;
+                                return false;
+                            }
+                        }
+                        if(rename(temporary.c_str(), path_.c_str()) != 0) {
+                            *error = "Could not replace skip_unchanged manifest: " + path_;
+                            return false;
+                        }
+                        return true;
+                    }
+
+                private:
+                    static bool FileMatches(const string &path, const string &content) {
+                        std::ifstream input(path.c_str(), std::ios::in | std::ios::binary);
+                        if(!input.is_open()) {
+                            return false;
+                        }
+                        string existing((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+                        return !input.bad() && existing == content;
+                    }
+
+                    // 64-bit FNV-1a.  Stable across platforms and compilers, unlike
+                    // std::hash, so the manifest stays valid when the plugin is rebuilt.
+                    static uint64 Hash(const string &content) {
+                        uint64 hash = 14695981039346656037ULL;
+                        for(string::size_type i = 0; i < content.size(); i++) {
+                            hash ^= (uint8)content[i];
+                            hash *= 1099511628211ULL;
+                        }
+                        return hash;
+                    }
+
+                    string path_;
+                    string root_;
+                    std::map<string, uint64> hashes_;
+
+                    GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(OutputManifest);
+                };
+
+                // Collects everything one generation task writes in memory.  protoc's
+                // GeneratorContext is not thread-safe, so workers never touch it;
+                // their buffers are flushed into it from the main thread afterwards.
+                class BufferedOutputDirectory : public OutputDirectory {
+                public:
+                    BufferedOutputDirectory() {}
+
+                    io::ZeroCopyOutputStream *Open(const string &filename) {
+                        files_.push_back(std::make_pair(filename, string()));
+                        return new io::StringOutputStream(&files_.back().second);
+                    }
+
+                    // Files the manifest, if any, reports as unchanged are not written.
+                    void WriteTo(OutputDirectory *output_directory, OutputManifest *manifest) const {
+                        for(std::deque<pair<string, string>>::const_iterator i(files_.begin()); i != files_.end(); ++i) {
+                            if(manifest != NULL && !manifest->Record(i->first, i->second)) {
+                                continue;
+                            }
+                            scoped_ptr<io::ZeroCopyOutputStream> output(output_directory->Open(i->first));
+                            const char *data = i->second.data();
+                            int remaining    = i->second.size();
+                            void *buffer;
+                            int size;
+                            while(remaining > 0 && output->Next(&buffer, &size)) {
+                                int count = std::min(size, remaining);
+                                memcpy(buffer, data, count);
+                                data += count;
+                                remaining -= count;
+                                if(count < size) {
+                                    output->BackUp(size - count);
+                                }
+                            }
+                        }
+                    }
+
+                private:
+                    // A deque so the strings handed to open streams never move.
+                    std::deque<pair<string, string>> files_;
+
+                    GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(BufferedOutputDirectory);
+                };
+
+                // Returns true and the type's full name if field refers to, or extends,
+                // a type from descriptor.proto, which the lite runtime leaves out.
+                bool UsesBootstrapType(const FieldDescriptor *field, string *type) {
+                    if(field->is_extension() && IsBootstrapFile(field->containing_type()->file())) {
+                        *type = field->containing_type()->full_name();
+                        return true;
+                    }
+                    if(field->message_type() != NULL && IsBootstrapFile(field->message_type()->file())) {
+                        *type = field->message_type()->full_name();
+                        return true;
+                    }
+                    if(field->enum_type() != NULL && IsBootstrapFile(field->enum_type()->file())) {
+                        *type = field->enum_type()->full_name();
+                        return true;
+                    }
+                    return false;
+                }
+
+                bool UsesBootstrapType(const Descriptor *descriptor, string *type) {
+                    for(int i = 0; i < descriptor->field_count(); i++) {
+                        if(UsesBootstrapType(descriptor->field(i), type)) {
+                            return true;
+                        }
+                    }
+                    for(int i = 0; i < descriptor->extension_count(); i++) {
+                        if(UsesBootstrapType(descriptor->extension(i), type)) {
+                            return true;
+                        }
+                    }
+                    for(int i = 0; i < descriptor->nested_type_count(); i++) {
+                        if(UsesBootstrapType(descriptor->nested_type(i), type)) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                bool UsesBootstrapType(const FileDescriptor *file, string *type) {
+                    for(int i = 0; i < file->extension_count(); i++) {
+                        if(UsesBootstrapType(file->extension(i), type)) {
+                            return true;
+                        }
+                    }
+                    for(int i = 0; i < file->message_type_count(); i++) {
+                        if(UsesBootstrapType(file->message_type(i), type)) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                // Runs task(0) .. task(count - 1) on up to jobs threads, including the
+                // calling one.  Tasks are claimed in index order but may finish in any.
+                void RunInParallel(int count, int jobs, const std::function<void(int)> &task) {
+                    std::atomic<int> next(0);
+                    auto worker = [&] {
+                        for(int i = next++; i < count; i = next++) {
+                            task(i);
+                        }
+                    };
+
+                    vector<std::thread> threads;
+                    for(int i = 1; i < std::min(jobs, count); i++) {
+                        threads.push_back(std::thread(worker));
+                    }
+                    worker();
+                    for(int i = 0; i < threads.size(); i++) {
+                        threads[i].join();
+                    }
+                }
+            } // namespace
+
             bool ObjectiveCGenerator::Generate(const FileDescriptor *file,
+                const string &parameter,
+                OutputDirectory *output_directory,
+                string *error) const {
+                return GenerateAll(vector<const FileDescriptor *>(1, file), parameter, output_directory, error);
+            }
+
+            bool ObjectiveCGenerator::GenerateAll(const vector<const FileDescriptor *> &files,
                 const string &parameter,
                 OutputDirectory *output_directory,
                 string *error) const {
@@ -43,69 +280,151 @@ namespace protobuf {
                 ParseGeneratorParameter(parameter, &options);
 
                 string output_list_file;
+                string skip_unchanged;
+                bool lite_runtime = false;
+                int jobs = std::max(1u, std::thread::hardware_concurrency());
 
+                // Options are applied before any worker starts; the feature sets they
+                // fill are only read while generating.
                 for(int i = 0; i < options.size(); i++) {
                     if(options[i].first == "output_list_file") {
                         output_list_file = options[i].second;
-                    } else {
+                    } else if(options[i].first == "skip_unchanged") {
+                        skip_unchanged = options[i].second;
+                    } else if(options[i].first == "lite_runtime") {
+                        lite_runtime = true;
+                    } else if(options[i].first == "jobs") {
+                        jobs = atoi(options[i].second.c_str());
+                        if(jobs <= 0) {
+                            *error = "Invalid value for jobs: " + options[i].second;
+                            return false;
+                        }
+                    } else if(!AddClassSpecificFeatureParameter(options[i].first, options[i].second)) {
                         *error = "Unknown generator option: " + options[i].first;
                         return false;
                     }
                 }
 
-                FileGenerator file_generator(file);
+                SetLiteRuntime(lite_runtime);
+                if(lite_runtime) {
+                    for(int i = 0; i < files.size(); i++) {
+                        string type;
+                        if(UsesBootstrapType(files[i], &type)) {
+                            *error = files[i]->name() + " uses " + type + ", which the lite runtime does not have";
+                            return false;
+                        }
+                    }
+                }
 
-                string filepath = FilePath(file);
+                scoped_ptr<OutputManifest> manifest;
+                if(!skip_unchanged.empty()) {
+                    manifest.reset(new OutputManifest(skip_unchanged));
+                    if(!manifest->Load(error)) {
+                        return false;
+                    }
+                }
+
+                // Descriptors are immutable, so the generator trees of all files can
+                // be built side by side.
+                scoped_array<scoped_ptr<FileGenerator>> file_generators(new scoped_ptr<FileGenerator>[files.size()]);
+                RunInParallel(files.size(), jobs, [&](int i) {
+                    file_generators[i].reset(new FileGenerator(files[i]));
+                });
 
                 // default: old way. Do not divide headers. User can set PROTOC_GEN_OBJC_DIVIDE_HEADERS in order to split headers
                 bool shouldDivideHeaders = ::getenv("PROTOC_GEN_OBJC_DIVIDE_HEADERS") != 0;
-                if(shouldDivideHeaders) {
-                    string enumsHeaderName     = filepath + ".enums.pb.h";
-                    string aggregateHeaderName = filepath + ".pb.h";
-
-                    // Generate aggregate header which consists of:
-                    // Enums header import
-                    // Forward declarations
-                    // Dependencies imports
-                    // Root class
-                    {
-                        scoped_ptr<io::ZeroCopyOutputStream> output(output_directory->Open(aggregateHeaderName));
-                        io::Printer printer(output.get(), '$');
-                        file_generator.GenerateAggregateHeader(&printer, enumsHeaderName);
-                    }
-
-                    // Generate enums header. Just enums.
-                    {
-                        scoped_ptr<io::ZeroCopyOutputStream> output(output_directory->Open(enumsHeaderName));
-                        io::Printer printer(output.get(), '$');
-                        file_generator.GenerateEnumsHeader(&printer);
-                    }
-
-                    // Generate headers for each class. Each header consists of:
-                    // Aggregate header import
-                    // _Builder class forward declaration
-                    // Class interface
-                    // _Builder class interface
-                    {
-                        file_generator.GenerateHeaders(output_directory, ".pb.h", aggregateHeaderName);
-                    }
-                } else {
-
-                    // Generate header.
-                    {
-                        scoped_ptr<io::ZeroCopyOutputStream> output(
-                            output_directory->Open(filepath + ".pb.h"));
-                        io::Printer printer(output.get(), '$');
-                        file_generator.GenerateHeader(&printer);
+                // Likewise PROTOC_GEN_OBJC_DIVIDE_SOURCES writes each top-level message to
+                // its own ClassName.pb.m next to a root .pb.m, so they compile in parallel.
+                bool shouldDivideSources = ::getenv("PROTOC_GEN_OBJC_DIVIDE_SOURCES") != 0;
+
+                // One task per output file, listed in the order the serial generator
+                // used to write them.
+                vector<std::function<void(OutputDirectory *)>> tasks;
+                for(int i = 0; i < files.size(); i++) {
+                    FileGenerator *file_generator = file_generators[i].get();
+                    string filepath               = FilePath(files[i]);
+
+                    if(shouldDivideHeaders) {
+                        string enumsHeaderName     = filepath + ".enums.pb.h";
+                        string aggregateHeaderName = filepath + ".pb.h";
+
+                        // Generate aggregate header which consists of:
+                        // Enums header import
+                        // Forward declarations
+                        // Dependencies imports
+                        // Root class
+                        // followed by the enums header. Just enums.
+                        tasks.push_back([=](OutputDirectory *output_directory) {
+                            {
+                                scoped_ptr<io::ZeroCopyOutputStream> output(output_directory->Open(aggregateHeaderName));
+                                io::Printer printer(output.get(), '$');
+                                file_generator->GenerateAggregateHeader(&printer, enumsHeaderName);
+                            }
+                            {
+                                scoped_ptr<io::ZeroCopyOutputStream> output(output_directory->Open(enumsHeaderName));
+                                io::Printer printer(output.get(), '$');
+                                file_generator->GenerateEnumsHeader(&printer);
+                            }
+                        });
+
+                        // Generate headers for each class. Each header consists of:
+                        // Aggregate header import
+                        // _Builder class forward declaration
+                        // Class interface
+                        // _Builder class interface
+                        for(int j = 0; j < files[i]->message_type_count(); j++) {
+                            tasks.push_back([=](OutputDirectory *output_directory) {
+                                file_generator->GenerateMessageHeader(output_directory, j, aggregateHeaderName);
+                            });
+                        }
+                    } else {
+
+                        // Generate header.
+                        tasks.push_back([=](OutputDirectory *output_directory) {
+                            scoped_ptr<io::ZeroCopyOutputStream> output(
+                                output_directory->Open(filepath + ".pb.h"));
+                            io::Printer printer(output.get(), '$');
+                            file_generator->GenerateHeader(&printer);
+                        });
                     }
+
+                    if(shouldDivideSources) {
+                        // Generate root m file, then one m file for each class.
+                        tasks.push_back([=](OutputDirectory *output_directory) {
+                            scoped_ptr<io::ZeroCopyOutputStream> output(
+                                output_directory->Open(filepath + ".pb.m"));
+                            io::Printer printer(output.get(), '$');
+                            file_generator->GenerateRootSource(&printer);
+                        });
+
+                        for(int j = 0; j < files[i]->message_type_count(); j++) {
+                            tasks.push_back([=](OutputDirectory *output_directory) {
+                                file_generator->GenerateMessageSource(output_directory, j);
+                            });
+                        }
+                    } else {
+
+                        // Generate m file.
+                        tasks.push_back([=](OutputDirectory *output_directory) {
+                            scoped_ptr<io::ZeroCopyOutputStream> output(
+                                output_directory->Open(filepath + ".pb.m"));
+                            io::Printer printer(output.get(), '$');
+                            file_generator->GenerateSource(&printer);
+                        });
+                    }
+                }
+
+                scoped_array<BufferedOutputDirectory> outputs(new BufferedOutputDirectory[tasks.size()]);
+                RunInParallel(tasks.size(), jobs, [&](int i) {
+                    tasks[i](&outputs[i]);
+                });
+
+                for(int i = 0; i < tasks.size(); i++) {
+                    outputs[i].WriteTo(output_directory, manifest.get());
                 }
 
-                // Generate m file.
-                {
-                    scoped_ptr<io::ZeroCopyOutputStream> output(
-                        output_directory->Open(filepath + ".pb.m"));
-                    io::Printer printer(output.get(), '$');
-                    file_generator.GenerateSource(&printer);
+                if(manifest.get() != NULL && !manifest->Save(error)) {
+                    return false;
                 }
 
                 return true;
@@ -20,6 +20,7 @@
 
 #include <google/protobuf/compiler/code_generator.h>
 #include <string>
+#include <vector>
 
 namespace google {
 namespace protobuf {
@@ -36,6 +37,24 @@ namespace protobuf {
                     OutputDirectory *output_directory,
                     string *error) const;
 
+                // Generates every file of the request on a pool of worker threads.
+                // The outputs are buffered per file and written to output_directory
+                // in request order once all workers finish, so the result does not
+                // depend on scheduling.  The "jobs=N" parameter bounds the pool size;
+                // it defaults to the number of hardware threads.
+                //
+                // With "skip_unchanged=<manifest>" a hash of each output is kept in the
+                // manifest, and outputs whose content matches both the previous run
+                // and the file already on disk are left out of the response so protoc
+                // does not touch them.
+                //
+                // "lite_runtime" generates code for the runtime built with
+                // PB_LITE_RUNTIME; see IsLiteRuntime().
+                bool GenerateAll(const vector<const FileDescriptor *> &files,
+                    const string &parameter,
+                    OutputDirectory *output_directory,
+                    string *error) const;
+
             private:
                 GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ObjectiveCGenerator);
             };
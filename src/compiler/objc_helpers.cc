@@ -18,6 +18,7 @@
 #include "objc_helpers.h"
 
 #include <limits>
+#include <set>
 #include <vector>
 
 #include <google/protobuf/descriptor.pb.h>
@@ -25,7 +26,6 @@
 #include <google/protobuf/stubs/strutil.h>
 
 #include "google/protobuf/objectivec-descriptor.pb.h"
-#include <sstream>
 #include <string>
 
 namespace google {
@@ -125,6 +125,25 @@ namespace protobuf {
                 return UnderscoresToCamelCase(method->name());
             }
 
+            string JSONFieldName(const FieldDescriptor *field) {
+                // Same as protoc's ToJsonName: drop each underscore and upper-case
+                // the character after it, leaving everything else alone.
+                string result;
+                bool capitalize_next = false;
+                for(int i = 0; i < field->name().size(); i++) {
+                    char c = field->name()[i];
+                    if(c == '_') {
+                        capitalize_next = true;
+                    } else if(capitalize_next) {
+                        result += toupper(c);
+                        capitalize_next = false;
+                    } else {
+                        result += c;
+                    }
+                }
+                return result;
+            }
+
             string FilenameToCamelCase(const string &filename) {
                 string result;
                 bool need_uppercase = true;
@@ -575,35 +594,159 @@ namespace protobuf {
                 return NULL;
             }
 
-            bool hasClassSpecificFeature(string classname, const char *featureName) {
-                char *p = ::getenv(featureName);
-                if(p != NULL) {
-                    string s(p);
-                    std::stringstream ss(s);
-                    std::string item;
-                    while(std::getline(ss, item, ',')) {
-                        if(item == classname) {
-                            return true;
+            namespace {
+                enum ClassSpecificFeature {
+                    FEATURE_PARTIALLY_MERGE,
+                    FEATURE_BUILDER_CLEAR,
+                    FEATURE_BUILDER_GETTERS,
+                    FEATURE_ENUM_STRING_REPRESENTATION,
+                    FEATURE_DUMMY_MESSAGES,
+                    FEATURE_DELTA,
+                    FEATURE_COUNT
+                };
+
+                // Indexed by ClassSpecificFeature.
+                const struct {
+                    const char *environment_variable;
+                    const char *parameter;
+                } kClassSpecificFeatures[FEATURE_COUNT] = {
+                    { "PROTOC_GEN_OBJC_CLASSES_WITH_PARTIALLY_MERGE", "classes_with_partially_merge" },
+                    { "PROTOC_GEN_OBJC_CLASSES_WITH_BUILDER_CLEAR", "classes_with_builder_clear" },
+                    { "PROTOC_GEN_OBJC_CLASSES_WITH_BUILDER_GETTERS", "classes_with_builder_getters" },
+                    { "PROTOC_GEN_OBJC_ENUM_WITH_STRING_REPRESENTATION", "enum_with_string_representation" },
+                    { "PROTOC_GEN_OBJC_DUMMY_MESSAGES", "dummy_messages" },
+                    { "PROTOC_GEN_OBJC_CLASSES_WITH_DELTA", "classes_with_delta" },
+                };
+
+                void AddClassNames(const string &list, char separator, hash_set<string> *classnames) {
+                    string::size_type start = 0;
+                    while(start <= list.size()) {
+                        string::size_type end = list.find(separator, start);
+                        if(end == string::npos) {
+                            end = list.size();
                         }
+                        if(end > start) {
+                            classnames->insert(list.substr(start, end - start));
+                        }
+                        start = end + 1;
+                    }
+                }
+
+                // The class lists for each feature, read from the environment the first
+                // time any feature is looked up.  Function-local statics are initialized
+                // exactly once even if generators run on several threads.
+                hash_set<string> *ClassSpecificFeatureClassNames() {
+                    static hash_set<string> *classnames = [] {
+                        hash_set<string> *result = new hash_set<string>[FEATURE_COUNT];
+                        for(int i = 0; i < FEATURE_COUNT; i++) {
+                            if(const char *p = ::getenv(kClassSpecificFeatures[i].environment_variable)) {
+                                AddClassNames(p, ',', &result[i]);
+                            }
+                        }
+                        return result;
+                    }();
+                    return classnames;
+                }
+
+                inline bool hasClassSpecificFeature(const string &classname, ClassSpecificFeature feature) {
+                    return ClassSpecificFeatureClassNames()[feature].count(classname) > 0;
+                }
+            } // namespace
+
+            bool AddClassSpecificFeatureParameter(const string &name, const string &value) {
+                for(int i = 0; i < FEATURE_COUNT; i++) {
+                    if(name == kClassSpecificFeatures[i].parameter) {
+                        AddClassNames(value, ':', &ClassSpecificFeatureClassNames()[i]);
+                        return true;
                     }
                 }
                 return false;
             }
 
-            bool hasPartiallyMerge(string classname) {
-                return hasClassSpecificFeature(classname, "PROTOC_GEN_OBJC_CLASSES_WITH_PARTIALLY_MERGE");
+            bool hasPartiallyMerge(const string &classname) {
+                return hasClassSpecificFeature(classname, FEATURE_PARTIALLY_MERGE);
+            }
+            bool hasBuilderClearMethods(const string &classname) {
+                return hasClassSpecificFeature(classname, FEATURE_BUILDER_CLEAR);
+            }
+            bool hasBuilderGetterInHeader(const string &classname) {
+                return hasClassSpecificFeature(classname, FEATURE_BUILDER_GETTERS);
+            }
+            bool hasEnumStringRepresentationMethod(const string &classname) {
+                return hasClassSpecificFeature(classname, FEATURE_ENUM_STRING_REPRESENTATION);
+            }
+            bool isDummyMessage(const string &classname) {
+                return hasClassSpecificFeature(classname, FEATURE_DUMMY_MESSAGES);
+            }
+            bool hasDeltaMethods(const string &classname) {
+                return hasClassSpecificFeature(classname, FEATURE_DELTA);
+            }
+
+            namespace {
+                // Set from the generator options before any generation starts.
+                bool lite_runtime = false;
+            } // namespace
+
+            void SetLiteRuntime(bool value) {
+                lite_runtime = value;
             }
-            bool hasBuilderClearMethods(string classname) {
-                return hasClassSpecificFeature(classname, "PROTOC_GEN_OBJC_CLASSES_WITH_BUILDER_CLEAR");
+
+            bool IsLiteRuntime() {
+                return lite_runtime;
             }
-            bool hasBuilderGetterInHeader(string classname) {
-                return hasClassSpecificFeature(classname, "PROTOC_GEN_OBJC_CLASSES_WITH_BUILDER_GETTERS");
+
+            bool IsRuntimeDependency(const FileDescriptor *file) {
+                return !lite_runtime ||
+                       (!IsBootstrapFile(file) && file->name() != "google/protobuf/objectivec-descriptor.proto");
             }
-            bool hasEnumStringRepresentationMethod(string classname) {
-                return hasClassSpecificFeature(classname, "PROTOC_GEN_OBJC_ENUM_WITH_STRING_REPRESENTATION");
+
+            namespace {
+                bool ReachesDefaultInstance(const Descriptor *from, const Descriptor *target, set<const Descriptor *> *visited) {
+                    for(int i = 0; i < from->field_count(); i++) {
+                        const Descriptor *type = from->field(i)->message_type();
+                        if(type == NULL || from->field(i)->is_repeated()) {
+                            continue;
+                        }
+                        if(type == target) {
+                            return true;
+                        }
+                        // Imports cannot be cyclic, so types from other files never lead back.
+                        if(type->file() == target->file() && visited->insert(type).second &&
+                           ReachesDefaultInstance(type, target, visited)) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                bool HasExtensions(const Descriptor *descriptor) {
+                    if(descriptor->extension_count() > 0) {
+                        return true;
+                    }
+                    for(int i = 0; i < descriptor->nested_type_count(); i++) {
+                        if(HasExtensions(descriptor->nested_type(i))) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+            } // namespace
+
+            bool HasRecursiveDefaultInstance(const Descriptor *descriptor) {
+                set<const Descriptor *> visited;
+                return ReachesDefaultInstance(descriptor, descriptor, &visited);
             }
-            bool isDummyMessage(string classname) {
-                return hasClassSpecificFeature(classname, "PROTOC_GEN_OBJC_DUMMY_MESSAGES");
+
+            bool HasExtensions(const FileDescriptor *file) {
+                if(file->extension_count() > 0) {
+                    return true;
+                }
+                for(int i = 0; i < file->message_type_count(); i++) {
+                    if(HasExtensions(file->message_type(i))) {
+                        return true;
+                    }
+                }
+                return false;
             }
 
             // Escape C++ trigraphs by escaping question marks to \?
@@ -38,6 +38,12 @@ namespace protobuf {
             // of lower-casing the first letter of the name.)
             string UnderscoresToCamelCase(const MethodDescriptor *method);
 
+            // The lowerCamelCase name the proto3 JSON mapping gives a field, e.g.
+            // "optional_int32" becomes "optionalInt32".  Unlike the accessor names,
+            // groups keep their lower-cased field name and digits do not start a
+            // new word.
+            string JSONFieldName(const FieldDescriptor *field);
+
             // Apply CamelCase-formatting to the given filename string.  Existing
             // capitalization is not modified, but non-alphanumeric characters are
             // removed and the following legal character is capitalized.
@@ -116,11 +122,41 @@ namespace protobuf {
 
             bool isObjectArray(const FieldDescriptor *field);
 
-            bool hasPartiallyMerge(string classname);
-            bool hasBuilderClearMethods(string classname);
-            bool hasBuilderGetterInHeader(string classname);
-            bool hasEnumStringRepresentationMethod(string classname);
-            bool isDummyMessage(string classname);
+            // Class-specific features take a list of class names, from a
+            // comma-separated environment variable such as
+            // PROTOC_GEN_OBJC_CLASSES_WITH_BUILDER_CLEAR=Foo,Bar or from a plugin
+            // parameter such as --objc_opt=classes_with_builder_clear=Foo:Bar.
+            // Parameters use ':' because protoc splits parameters on ','.
+            //
+            // Adds the classes listed by a plugin parameter.  Returns false if
+            // name is not a class-specific feature.
+            bool AddClassSpecificFeatureParameter(const string &name, const string &value);
+
+            bool hasPartiallyMerge(const string &classname);
+            bool hasBuilderClearMethods(const string &classname);
+            bool hasBuilderGetterInHeader(const string &classname);
+            bool hasEnumStringRepresentationMethod(const string &classname);
+            bool isDummyMessage(const string &classname);
+            bool hasDeltaMethods(const string &classname);
+
+            // The "lite_runtime" generator option targets the runtime built with
+            // PB_LITE_RUNTIME, which has no description support and no Descriptor.pb.m.
+            // Messages then get no writeDescriptionTo:withIndent:, and descriptor.proto
+            // and objectivec-descriptor.proto are neither imported nor registered.
+            void SetLiteRuntime(bool lite_runtime);
+            bool IsLiteRuntime();
+
+            // Returns false for dependencies that only supply options and are left
+            // out under the lite runtime.
+            bool IsRuntimeDependency(const FileDescriptor *file);
+
+            // Returns true if building descriptor's default instance asks for that same
+            // default instance again: -init sets each singular message field to its
+            // type's default instance, so a cycle of such fields leads back to it.
+            bool HasRecursiveDefaultInstance(const Descriptor *descriptor);
+
+            // Returns true if the file or any message in it declares extensions.
+            bool HasExtensions(const FileDescriptor *file);
 
             // Escape C++ trigraphs by escaping question marks to \?
             string EscapeTrigraphs(const string &to_escape);
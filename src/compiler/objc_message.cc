@@ -71,6 +71,34 @@ namespace protobuf {
                     }
                 };
 
+                // The name a field goes by in text format: groups are named after
+                // their type rather than the lower-cased field name.
+                const string &TextFormatFieldName(const FieldDescriptor *field) {
+                    if(field->type() == FieldDescriptor::TYPE_GROUP) {
+                        return field->message_type()->name();
+                    }
+                    return field->name();
+                }
+
+                struct FieldOrderingByTextFormatNameLength {
+                    inline bool operator()(const FieldDescriptor *a, const FieldDescriptor *b) const {
+                        return TextFormatFieldName(a).size() < TextFormatFieldName(b).size();
+                    }
+                };
+
+                // Builders accept both the JSON name and the .proto name of each
+                // field, matched the same way as text format field names.
+                struct JSONMemberName {
+                    string name;
+                    const FieldDescriptor *field;
+                };
+
+                struct JSONMemberNameOrderingByLength {
+                    inline bool operator()(const JSONMemberName &a, const JSONMemberName &b) const {
+                        return a.name.size() < b.name.size();
+                    }
+                };
+
                 struct ExtensionRangeOrdering {
                     bool operator()(const Descriptor::ExtensionRange *a,
                         const Descriptor::ExtensionRange *b) const {
@@ -100,13 +128,6 @@ namespace protobuf {
                     return fields;
                 }
 
-                // Get an identifier that uniquely identifies this type within the file.
-                // This is used to declare static variables related to this type at the
-                // outermost file scope.
-                string UniqueFileScopeIdentifier(const Descriptor *descriptor) {
-                    return "static_" + StringReplace(descriptor->full_name(), ".", "_", true);
-                }
-
                 // Returns true if the field has [required=true] flag
                 static bool HasRequiredTag(const FieldDescriptor *field) {
                     SourceLocation source;
@@ -173,59 +194,59 @@ namespace protobuf {
 
             MessageGenerator::MessageGenerator(const Descriptor *descriptor)
                 : descriptor_(descriptor)
-                , field_generators_(descriptor) {
+                , field_generators_(descriptor)
+                , enum_generators_(new scoped_ptr<EnumGenerator>[descriptor->enum_type_count()])
+                , nested_generators_(new scoped_ptr<MessageGenerator>[descriptor->nested_type_count()])
+                , extension_generators_(new scoped_ptr<ExtensionGenerator>[descriptor->extension_count()]) {
+
+                // Build the generators for everything nested in this message once;
+                // every pass over the file reuses them.
+                for(int i = 0; i < descriptor->enum_type_count(); i++) {
+                    enum_generators_[i].reset(new EnumGenerator(descriptor->enum_type(i)));
+                }
+                for(int i = 0; i < descriptor->nested_type_count(); i++) {
+                    nested_generators_[i].reset(new MessageGenerator(descriptor->nested_type(i)));
+                }
+                for(int i = 0; i < descriptor->extension_count(); i++) {
+                    extension_generators_[i].reset(new ExtensionGenerator(ClassName(descriptor), descriptor->extension(i)));
+                }
             }
 
             MessageGenerator::~MessageGenerator() {
             }
 
             void MessageGenerator::GenerateStaticVariablesHeader(io::Printer *printer) {
-                map<string, string> vars;
-                vars["identifier"] = UniqueFileScopeIdentifier(descriptor_);
-                vars["index"]      = SimpleItoa(descriptor_->index());
-                vars["classname"]  = ClassName(descriptor_);
-                if(descriptor_->containing_type() != NULL) {
-                    vars["parent"] = UniqueFileScopeIdentifier(descriptor_->containing_type());
-                }
-
                 for(int i = 0; i < descriptor_->nested_type_count(); i++) {
-                    MessageGenerator(descriptor_->nested_type(i)).GenerateStaticVariablesHeader(printer);
+                    nested_generators_[i]->GenerateStaticVariablesHeader(printer);
                 }
             }
 
             void MessageGenerator::GenerateStaticVariablesInitialization(io::Printer *printer) {
-                map<string, string> vars;
-                vars["identifier"] = UniqueFileScopeIdentifier(descriptor_);
-                vars["index"]      = SimpleItoa(descriptor_->index());
-                vars["classname"]  = ClassName(descriptor_);
-                if(descriptor_->containing_type() != NULL) {
-                    vars["parent"] = UniqueFileScopeIdentifier(descriptor_->containing_type());
-                }
-
                 for(int i = 0; i < descriptor_->extension_count(); i++) {
-                    ExtensionGenerator(ClassName(descriptor_), descriptor_->extension(i)).GenerateInitializationSource(printer);
+                    extension_generators_[i]->GenerateInitializationSource(printer);
                 }
                 for(int i = 0; i < descriptor_->nested_type_count(); i++) {
-                    MessageGenerator(descriptor_->nested_type(i)).GenerateStaticVariablesInitialization(printer);
+                    nested_generators_[i]->GenerateStaticVariablesInitialization(printer);
                 }
             }
 
             void MessageGenerator::GenerateStaticVariablesSource(io::Printer *printer) {
-                map<string, string> vars;
-                vars["identifier"] = UniqueFileScopeIdentifier(descriptor_);
-                vars["index"]      = SimpleItoa(descriptor_->index());
-                vars["classname"]  = ClassName(descriptor_);
-                if(descriptor_->containing_type() != NULL) {
-                    vars["parent"] = UniqueFileScopeIdentifier(descriptor_->containing_type());
+                for(int i = 0; i < descriptor_->extension_count(); i++) {
+                    extension_generators_[i]->GenerateFieldsSource(printer);
                 }
 
+                for(int i = 0; i < descriptor_->nested_type_count(); i++) {
+                    nested_generators_[i]->GenerateStaticVariablesSource(printer);
+                }
+            }
+
+            void MessageGenerator::GenerateSharedVariablesSource(io::Printer *printer, bool declaration) {
                 for(int i = 0; i < descriptor_->extension_count(); i++) {
-                    ExtensionGenerator(ClassName(descriptor_), descriptor_->extension(i))
-                        .GenerateFieldsSource(printer);
+                    extension_generators_[i]->GenerateSharedFieldsSource(printer, declaration);
                 }
 
                 for(int i = 0; i < descriptor_->nested_type_count(); i++) {
-                    MessageGenerator(descriptor_->nested_type(i)).GenerateStaticVariablesSource(printer);
+                    nested_generators_[i]->GenerateSharedVariablesSource(printer, declaration);
                 }
             }
 
@@ -234,29 +255,27 @@ namespace protobuf {
                 dependencies->insert("@class " + ClassName(descriptor_) + "_Builder");
 
                 for(int i = 0; i < descriptor_->nested_type_count(); i++) {
-                    MessageGenerator(descriptor_->nested_type(i)).DetermineDependencies(dependencies);
+                    nested_generators_[i]->DetermineDependencies(dependencies);
                 }
             }
 
             void MessageGenerator::GenerateEnumHeader(io::Printer *printer) {
                 for(int i = 0; i < descriptor_->enum_type_count(); i++) {
-                    EnumGenerator(descriptor_->enum_type(i)).GenerateHeader(printer);
+                    enum_generators_[i]->GenerateHeader(printer);
                 }
 
                 for(int i = 0; i < descriptor_->nested_type_count(); i++) {
-                    MessageGenerator(descriptor_->nested_type(i)).GenerateEnumHeader(printer);
+                    nested_generators_[i]->GenerateEnumHeader(printer);
                 }
             }
 
             void MessageGenerator::GenerateExtensionRegistrationSource(io::Printer *printer) {
                 for(int i = 0; i < descriptor_->extension_count(); i++) {
-                    ExtensionGenerator(ClassName(descriptor_), descriptor_->extension(i))
-                        .GenerateRegistrationSource(printer);
+                    extension_generators_[i]->GenerateRegistrationSource(printer);
                 }
 
                 for(int i = 0; i < descriptor_->nested_type_count(); i++) {
-                    MessageGenerator(descriptor_->nested_type(i))
-                        .GenerateExtensionRegistrationSource(printer);
+                    nested_generators_[i]->GenerateExtensionRegistrationSource(printer);
                 }
             }
 
@@ -291,12 +310,25 @@ namespace protobuf {
                 }
 
                 for(int i = 0; i < descriptor_->extension_count(); i++) {
-                    ExtensionGenerator(ClassName(descriptor_), descriptor_->extension(i)).GenerateMembersHeader(printer);
+                    extension_generators_[i]->GenerateMembersHeader(printer);
                 }
 
+                printer->Print(
+                    "\n"
+                    "+ ($classname$*) defaultInstance;\n"
+                    "- ($classname$*) defaultInstance;\n"
+                    "\n",
+                    "classname", ClassName(descriptor_));
+
                 GenerateIsInitializedHeader(printer);
                 GenerateMessageSerializationMethodsHeader(printer);
 
+                if(hasDeltaMethods(ClassName(descriptor_))) {
+                    printer->Print(
+                        "- (PBMessageDelta*) diffFrom:($classname$*) other;\n",
+                        "classname", ClassName(descriptor_));
+                }
+
                 printer->Print(
                     "- ($classname$_Builder*) builder;\n"
                     "+ ($classname$_Builder*) builder;\n"
@@ -307,7 +339,7 @@ namespace protobuf {
                 printer->Print("@end\n\n");
 
                 for(int i = 0; i < descriptor_->nested_type_count(); i++) {
-                    MessageGenerator(descriptor_->nested_type(i)).GenerateMessageHeader(printer);
+                    nested_generators_[i]->GenerateMessageHeader(printer);
                 }
 
                 GenerateBuilderHeader(printer);
@@ -348,8 +380,10 @@ namespace protobuf {
                     "  return self;\n"
                     "}\n");
 
+                GenerateDefaultInstanceSource(printer);
+
                 for(int i = 0; i < descriptor_->extension_count(); i++) {
-                    ExtensionGenerator(ClassName(descriptor_), descriptor_->extension(i)).GenerateMembersSource(printer);
+                    extension_generators_[i]->GenerateMembersSource(printer);
                 }
 
                 for(int i = 0; i < descriptor_->field_count(); i++) {
@@ -374,25 +408,76 @@ namespace protobuf {
                     "}\n",
                     "classname", ClassName(descriptor_));
 
-                GenerateMessageDescriptionSource(printer);
+                if(HasGeneratedMethods(descriptor_->file())) {
+                    if(!IsLiteRuntime()) {
+                        GenerateMessageDescriptionSource(printer);
+                    }
+
+                    GenerateMessageIsEqualSource(printer);
 
-                GenerateMessageIsEqualSource(printer);
+                    GenerateMessageHashSource(printer);
+                } else {
+                    GenerateFieldTableSource(printer);
+                }
 
-                GenerateMessageHashSource(printer);
+                if(!IsLiteRuntime() && HasGeneratedMethods(descriptor_->file())) {
+                    GenerateMessageJSONWritingSource(printer);
+                }
+
+                if(hasDeltaMethods(ClassName(descriptor_))) {
+                    GenerateMessageDiffSource(printer);
+                }
 
                 printer->Print("@end\n\n");
 
                 for(int i = 0; i < descriptor_->enum_type_count(); i++) {
-                    EnumGenerator(descriptor_->enum_type(i)).GenerateSource(printer);
+                    enum_generators_[i]->GenerateSource(printer);
                 }
 
                 for(int i = 0; i < descriptor_->nested_type_count(); i++) {
-                    MessageGenerator(descriptor_->nested_type(i)).GenerateSource(printer);
+                    nested_generators_[i]->GenerateSource(printer);
                 }
 
                 GenerateBuilderSource(printer);
             }
 
+            void MessageGenerator::GenerateDefaultInstanceSource(io::Printer *printer) {
+                // The default instance is built on first use rather than when the
+                // class is first messaged.  dispatch_once cannot be re-entered,
+                // though, so a message whose -init comes back around to its own
+                // default instance keeps building it in +initialize, where the
+                // nested request just sees nil.
+                if(HasRecursiveDefaultInstance(descriptor_)) {
+                    printer->Print(
+                        "static $classname$* default$classname$Instance = nil;\n"
+                        "+ (void) initialize {\n"
+                        "  if (self == [$classname$ class]) {\n"
+                        "    default$classname$Instance = [[$classname$ alloc] init];\n"
+                        "  }\n"
+                        "}\n"
+                        "+ ($classname$*) defaultInstance {\n"
+                        "  return default$classname$Instance;\n"
+                        "}\n",
+                        "classname", ClassName(descriptor_));
+                } else {
+                    printer->Print(
+                        "+ ($classname$*) defaultInstance {\n"
+                        "  static $classname$* default$classname$Instance = nil;\n"
+                        "  static dispatch_once_t onceToken;\n"
+                        "  dispatch_once(&onceToken, ^{\n"
+                        "    default$classname$Instance = [[$classname$ alloc] init];\n"
+                        "  });\n"
+                        "  return default$classname$Instance;\n"
+                        "}\n",
+                        "classname", ClassName(descriptor_));
+                }
+                printer->Print(
+                    "- ($classname$*) defaultInstance {\n"
+                    "  return [$classname$ defaultInstance];\n"
+                    "}\n",
+                    "classname", ClassName(descriptor_));
+            }
+
             void MessageGenerator::GenerateMessageSerializationMethodsHeader(io::Printer *printer) {
                 scoped_array<const FieldDescriptor *> sorted_fields(SortFieldsByNumber(descriptor_));
 
@@ -443,12 +528,18 @@ namespace protobuf {
                     GenerateBuilderPartiallyMergeMethod(printer);
                 }
 
+                if(hasDeltaMethods(ClassName(descriptor_))) {
+                    printer->Print(
+                        "- ($classname$_Builder*) applyDelta:(PBMessageDelta*) delta;\n",
+                        "classname", ClassName(descriptor_));
+                }
+
                 for(int i = 0; i < descriptor_->field_count(); i++) {
                     printer->Print("\n");
                     if(hasPartiallyMerge(ClassName(descriptor_)) || hasBuilderGetterInHeader(ClassName(descriptor_))) {
                         field_generators_.get(descriptor_->field(i)).GenerateBuilderGetterHeader(printer);
                     }
-                    if(hasBuilderClearMethods(ClassName(descriptor_))) {
+                    if(hasBuilderClearMethods(ClassName(descriptor_)) || hasDeltaMethods(ClassName(descriptor_))) {
                         field_generators_.get(descriptor_->field(i)).GenerateBuilderClearHeader(printer);
                     }
                     field_generators_.get(descriptor_->field(i)).GenerateBuilderMembersHeader(printer);
@@ -584,7 +675,7 @@ namespace protobuf {
                     ExtensionRangeOrdering());
 
                 printer->Print(
-                    "- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {\n");
+                    "- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {\n");
                 printer->Indent();
 
                 // Merge the fields and the extension ranges, both sorted by field number.
@@ -602,8 +693,23 @@ namespace protobuf {
                 }
 
                 printer->Print(
-                    "[self.unknownFields writeDescriptionTo:output withIndent:indent];\n");
+                    "[self.unknownFields writeTextFormatTo:writer];\n");
+
+                printer->Outdent();
+                printer->Print(
+                    "}\n");
+            }
+
+            void MessageGenerator::GenerateMessageJSONWritingSource(io::Printer *printer) {
+                // Extensions and unknown fields have no JSON names, so they are left out.
+                scoped_array<const FieldDescriptor *> sorted_fields(SortFieldsByNumber(descriptor_));
 
+                printer->Print(
+                    "- (void) writeJSONTo:(PBJSONWriter*) writer {\n");
+                printer->Indent();
+                for(int i = 0; i < descriptor_->field_count(); i++) {
+                    field_generators_.get(sorted_fields[i]).GenerateJSONWritingCodeSource(printer);
+                }
                 printer->Outdent();
                 printer->Print(
                     "}\n");
@@ -702,6 +808,93 @@ namespace protobuf {
                     "}\n");
             }
 
+            // With optimize_for = CODE_SIZE, description, isEqual: and hash walk a
+            // static table of the fields and extension ranges in number order,
+            // instead of being generated field by field.
+            void MessageGenerator::GenerateFieldTableSource(io::Printer *printer) {
+                scoped_array<const FieldDescriptor *> sorted_fields(SortFieldsByNumber(descriptor_));
+
+                vector<const Descriptor::ExtensionRange *> sorted_extensions;
+                for(int i = 0; i < descriptor_->extension_range_count(); ++i) {
+                    sorted_extensions.push_back(descriptor_->extension_range(i));
+                }
+                sort(sorted_extensions.begin(), sorted_extensions.end(),
+                    ExtensionRangeOrdering());
+
+                map<string, string> vars;
+                vars["classname"] = ClassName(descriptor_);
+                vars["count"]     = SimpleItoa(descriptor_->field_count() + sorted_extensions.size());
+
+                // C has no empty arrays, so a message without fields gets an empty table.
+                if(descriptor_->field_count() + sorted_extensions.size() == 0) {
+                    printer->Print(vars,
+                        "static PBFieldTable $classname$FieldTable = { NULL, 0 };\n");
+                } else {
+                    printer->Print(vars,
+                        "static const PBFieldTableEntry $classname$FieldTableEntries[] = {\n");
+                    printer->Indent();
+
+                    // Merge the fields and the extension ranges, both sorted by field number.
+                    for(int i = 0, j = 0;
+                        i < descriptor_->field_count() || j < sorted_extensions.size();) {
+                        if(i < descriptor_->field_count() &&
+                           (j == sorted_extensions.size() || sorted_fields[i]->number() < sorted_extensions[j]->start)) {
+                            field_generators_.get(sorted_fields[i++]).GenerateFieldTableEntrySource(printer);
+                        } else {
+                            printer->Print(
+                                "{ NULL, NULL, PBFieldTableTypeExtensionRange, $from$, $to$ },\n",
+                                "from", SimpleItoa(sorted_extensions[j]->start),
+                                "to", SimpleItoa(sorted_extensions[j]->end));
+                            j++;
+                        }
+                    }
+
+                    printer->Outdent();
+                    printer->Print(vars,
+                        "};\n"
+                        "static PBFieldTable $classname$FieldTable = { $classname$FieldTableEntries, $count$ };\n");
+                }
+
+                if(!IsLiteRuntime()) {
+                    printer->Print(vars,
+                        "- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {\n"
+                        "  PBFieldTableWriteTextFormat(&$classname$FieldTable, self, writer);\n"
+                        "}\n");
+                }
+                printer->Print(vars,
+                    "- (BOOL) isEqual:(id)other {\n"
+                    "  return PBFieldTableIsEqual(&$classname$FieldTable, self, other);\n"
+                    "}\n"
+                    "- (NSUInteger) hash {\n"
+                    "  return PBFieldTableHash(&$classname$FieldTable, self);\n"
+                    "}\n");
+            }
+
+            void MessageGenerator::GenerateMessageDiffSource(io::Printer *printer) {
+                scoped_array<const FieldDescriptor *> sorted_fields(SortFieldsByNumber(descriptor_));
+
+                printer->Print(
+                    "- (PBMessageDelta*) diffFrom:($classname$*) other {\n"
+                    "  $classname$* changes = [[$classname$ alloc] init];\n"
+                    "  NSMutableArray* clearedFields = [NSMutableArray array];\n"
+                    "  NSMutableDictionary* fieldDeltas = [NSMutableDictionary dictionary];\n",
+                    "classname", ClassName(descriptor_));
+                printer->Indent();
+
+                for(int i = 0; i < descriptor_->field_count(); i++) {
+                    field_generators_.get(sorted_fields[i]).GenerateDiffCodeSource(printer);
+                }
+
+                printer->Print(
+                    "return [PBMessageDelta deltaWithChanges:changes.data\n"
+                    "                          clearedFields:clearedFields\n"
+                    "                            fieldDeltas:fieldDeltas];\n");
+
+                printer->Outdent();
+                printer->Print(
+                    "}\n");
+            }
+
             void MessageGenerator::GenerateParseFromMethodsSource(io::Printer *printer) {
             }
 
@@ -728,10 +921,9 @@ namespace protobuf {
             void MessageGenerator::GenerateDescriptionOneExtensionRangeSource(
                 io::Printer *printer, const Descriptor::ExtensionRange *range) {
                 printer->Print(
-                    "[self writeExtensionDescriptionToMutableString:(NSMutableString*)output\n"
-                    "                                          from:$from$\n"
-                    "                                            to:$to$\n"
-                    "                                    withIndent:indent];\n",
+                    "[self writeExtensionTextFormatTo:writer\n"
+                    "                            from:$from$\n"
+                    "                              to:$to$];\n",
                     "from", SimpleItoa(range->start),
                     "to", SimpleItoa(range->end));
             }
@@ -781,16 +973,26 @@ namespace protobuf {
 
                 GenerateCommonBuilderMethodsSource(printer);
                 GenerateBuilderParsingMethodsSource(printer);
+                if(!IsLiteRuntime() && HasGeneratedMethods(descriptor_->file())) {
+                    // CODE_SIZE builders leave text format and JSON parsing to
+                    // the base class, which throws.
+                    GenerateBuilderTextFormatParsingSource(printer);
+                    GenerateBuilderJSONParsingSource(printer);
+                }
                 if(hasPartiallyMerge(ClassName(descriptor_))) {
                     GenerateBuilderPartiallyMergeMethodSource(printer);
                 }
+                if(hasDeltaMethods(ClassName(descriptor_))) {
+                    GenerateBuilderApplyDeltaSource(printer);
+                }
 
                 for(int i = 0; i < descriptor_->field_count(); i++) {
                     field_generators_.get(descriptor_->field(i)).GenerateBuilderMembersSource(printer);
                     if(hasPartiallyMerge(ClassName(descriptor_)) || hasBuilderGetterInHeader(ClassName(descriptor_))) {
                         field_generators_.get(descriptor_->field(i)).GenerateBuilderGetterSource(printer);
                     }
-                    if(hasPartiallyMerge(ClassName(descriptor_)) || hasBuilderClearMethods(ClassName(descriptor_))) {
+                    if(hasPartiallyMerge(ClassName(descriptor_)) || hasBuilderClearMethods(ClassName(descriptor_)) ||
+                        hasDeltaMethods(ClassName(descriptor_))) {
                         field_generators_.get(descriptor_->field(i)).GenerateBuilderClearSource(printer);
                     }
                 }
@@ -923,6 +1125,173 @@ namespace protobuf {
                     "}\n");
             }
 
+            void MessageGenerator::GenerateBuilderTextFormatParsingSource(io::Printer *printer) {
+                // Field names are matched without copying them out of the input:
+                // switch on the length, then compare the few names of that length.
+                vector<const FieldDescriptor *> fields;
+                for(int i = 0; i < descriptor_->field_count(); i++) {
+                    fields.push_back(descriptor_->field(i));
+                }
+                stable_sort(fields.begin(), fields.end(), FieldOrderingByTextFormatNameLength());
+
+                printer->Print(
+                    "- ($classname$_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {\n"
+                    "  const char* name;\n"
+                    "  NSUInteger length;\n"
+                    "  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {\n",
+                    "classname", ClassName(descriptor_));
+                printer->Indent();
+                printer->Indent();
+
+                if(!fields.empty()) {
+                    printer->Print("switch (length) {\n");
+                    printer->Indent();
+
+                    for(int i = 0; i < fields.size(); i++) {
+                        const string &name = TextFormatFieldName(fields[i]);
+                        if(i == 0 || TextFormatFieldName(fields[i - 1]).size() != name.size()) {
+                            printer->Print(
+                                "case $length$:\n",
+                                "length", SimpleItoa(name.size()));
+                        }
+                        printer->Print(
+                            "  if (memcmp(name, \"$name$\", $length$) == 0) {\n",
+                            "name", name,
+                            "length", SimpleItoa(name.size()));
+                        printer->Indent();
+                        printer->Indent();
+                        field_generators_.get(fields[i]).GenerateTextFormatParsingCodeSource(printer);
+                        printer->Print("continue;\n");
+                        printer->Outdent();
+                        printer->Outdent();
+                        printer->Print("  }\n");
+                        if(i + 1 == fields.size() || TextFormatFieldName(fields[i + 1]).size() != name.size()) {
+                            printer->Print("  break;\n");
+                        }
+                    }
+
+                    printer->Outdent();
+                    printer->Print("}\n");
+                }
+
+                printer->Print("PBTextFormatReaderUnknownField(reader, name, length);\n");
+                printer->Outdent();
+                printer->Outdent();
+                printer->Print(
+                    "  }\n"
+                    "  return self;\n"
+                    "}\n");
+            }
+
+            void MessageGenerator::GenerateBuilderJSONParsingSource(io::Printer *printer) {
+                // Each field can go by two names, so the names are first matched to a
+                // field number and the value is then read once per field.
+                vector<JSONMemberName> names;
+                for(int i = 0; i < descriptor_->field_count(); i++) {
+                    const FieldDescriptor *field = descriptor_->field(i);
+                    JSONMemberName member = { JSONFieldName(field), field };
+                    names.push_back(member);
+                    if(field->name() != member.name) {
+                        member.name = field->name();
+                        names.push_back(member);
+                    }
+                }
+                stable_sort(names.begin(), names.end(), JSONMemberNameOrderingByLength());
+
+                printer->Print(
+                    "- ($classname$_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {\n"
+                    "  const char* name;\n"
+                    "  NSUInteger length;\n"
+                    "  while (PBJSONReaderReadMemberName(reader, &name, &length)) {\n"
+                    "    if (PBJSONReaderReadNull(reader)) {\n"
+                    "      continue;\n"
+                    "    }\n",
+                    "classname", ClassName(descriptor_));
+                printer->Indent();
+                printer->Indent();
+
+                if(!names.empty()) {
+                    printer->Print(
+                        "int32_t number = 0;\n"
+                        "switch (length) {\n");
+                    printer->Indent();
+
+                    for(int i = 0; i < names.size(); i++) {
+                        const string &name = names[i].name;
+                        bool first = i == 0 || names[i - 1].name.size() != name.size();
+                        if(first) {
+                            printer->Print(
+                                "case $length$:\n",
+                                "length", SimpleItoa(name.size()));
+                        }
+                        printer->Print(
+                            first ? "  if (memcmp(name, \"$name$\", $length$) == 0) {\n"
+                                  : "  } else if (memcmp(name, \"$name$\", $length$) == 0) {\n",
+                            "name", name,
+                            "length", SimpleItoa(name.size()));
+                        printer->Print(
+                            "    number = $number$;\n",
+                            "number", SimpleItoa(names[i].field->number()));
+                        if(i + 1 == names.size() || names[i + 1].name.size() != name.size()) {
+                            printer->Print(
+                                "  }\n"
+                                "  break;\n");
+                        }
+                    }
+
+                    printer->Outdent();
+                    printer->Print(
+                        "}\n"
+                        "switch (number) {\n");
+                    printer->Indent();
+
+                    scoped_array<const FieldDescriptor *> sorted_fields(SortFieldsByNumber(descriptor_));
+                    for(int i = 0; i < descriptor_->field_count(); i++) {
+                        printer->Print(
+                            "case $number$: {\n",
+                            "number", SimpleItoa(sorted_fields[i]->number()));
+                        printer->Indent();
+                        field_generators_.get(sorted_fields[i]).GenerateJSONParsingCodeSource(printer);
+                        printer->Print("continue;\n");
+                        printer->Outdent();
+                        printer->Print("}\n");
+                    }
+
+                    printer->Outdent();
+                    printer->Print("}\n");
+                }
+
+                printer->Print("PBJSONReaderUnknownMember(reader, name, length);\n");
+                printer->Outdent();
+                printer->Outdent();
+                printer->Print(
+                    "  }\n"
+                    "  return self;\n"
+                    "}\n");
+            }
+
+            void MessageGenerator::GenerateBuilderApplyDeltaSource(io::Printer *printer) {
+                scoped_array<const FieldDescriptor *> sorted_fields(SortFieldsByNumber(descriptor_));
+
+                printer->Print(
+                    "- ($classname$_Builder*) applyDelta:(PBMessageDelta*) delta {\n"
+                    "  $classname$_Builder* changes = [$classname$ builder];\n"
+                    "  [changes mergeFromData:delta.changes];\n"
+                    "  $classname$* other = [changes buildPartial];\n"
+                    "  NSSet* clearedFields = [NSSet setWithArray:delta.clearedFields];\n",
+                    "classname", ClassName(descriptor_));
+                printer->Indent();
+
+                for(int i = 0; i < descriptor_->field_count(); i++) {
+                    field_generators_.get(sorted_fields[i]).GenerateApplyDeltaCodeSource(printer);
+                }
+
+                printer->Outdent();
+                printer->Print(
+                    "  return self;\n"
+                    "}\n");
+            }
+
             void MessageGenerator::GenerateBuilderPartiallyMergeMethodSource(io::Printer *printer) {
                 scoped_array<const FieldDescriptor *> sorted_fields(SortFieldsByNumber(descriptor_));
 
@@ -34,6 +34,8 @@ namespace protobuf {
 namespace protobuf {
     namespace compiler {
         namespace objectivec {
+            class EnumGenerator;      // objc_enum.h
+            class ExtensionGenerator; // objc_extension.h
 
             class MessageGenerator {
             public:
@@ -43,6 +45,7 @@ namespace protobuf {
                 void GenerateStaticVariablesHeader(io::Printer *printer);
                 void GenerateStaticVariablesInitialization(io::Printer *printer);
                 void GenerateStaticVariablesSource(io::Printer *printer);
+                void GenerateSharedVariablesSource(io::Printer *printer, bool declaration);
                 void GenerateEnumHeader(io::Printer *printer);
                 void GenerateMessageHeader(io::Printer *printer);
                 void GenerateSource(io::Printer *printer);
@@ -65,6 +68,7 @@ namespace protobuf {
 
                 void GenerateMessageSerializationMethodsSource(io::Printer *printer);
                 void GenerateParseFromMethodsSource(io::Printer *printer);
+                void GenerateDefaultInstanceSource(io::Printer *printer);
                 void GenerateSerializeOneFieldSource(io::Printer *printer,
                     const FieldDescriptor *field);
                 void GenerateSerializeOneExtensionRangeSource(
@@ -76,6 +80,7 @@ namespace protobuf {
                 void GenerateDescriptionOneExtensionRangeSource(
                     io::Printer *printer, const Descriptor::ExtensionRange *range);
 
+                void GenerateMessageJSONWritingSource(io::Printer *printer);
                 void GenerateMessageIsEqualSource(io::Printer *printer);
                 void GenerateIsEqualOneFieldSource(io::Printer *printer,
                     const FieldDescriptor *field);
@@ -83,6 +88,9 @@ namespace protobuf {
                     io::Printer *printer, const Descriptor::ExtensionRange *range);
 
                 void GenerateMessageHashSource(io::Printer *printer);
+                void GenerateFieldTableSource(io::Printer *printer);
+                void GenerateMessageDiffSource(io::Printer *printer);
+                void GenerateBuilderApplyDeltaSource(io::Printer *printer);
                 void GenerateHashOneFieldSource(io::Printer *printer,
                     const FieldDescriptor *field);
                 void GenerateHashOneExtensionRangeSource(
@@ -91,6 +99,8 @@ namespace protobuf {
                 void GenerateBuilderSource(io::Printer *printer);
                 void GenerateCommonBuilderMethodsSource(io::Printer *printer);
                 void GenerateBuilderParsingMethodsSource(io::Printer *printer);
+                void GenerateBuilderTextFormatParsingSource(io::Printer *printer);
+                void GenerateBuilderJSONParsingSource(io::Printer *printer);
                 void GenerateBuilderPartiallyMergeMethodSource(io::Printer *printer);
                 void GenerateIsInitializedSource(io::Printer *printer);
                 void GenerateRequiredFieldCheckSourceIfNeeded(
@@ -98,6 +108,9 @@ namespace protobuf {
 
                 const Descriptor *descriptor_;
                 FieldGeneratorMap field_generators_;
+                scoped_array<scoped_ptr<EnumGenerator>> enum_generators_;
+                scoped_array<scoped_ptr<MessageGenerator>> nested_generators_;
+                scoped_array<scoped_ptr<ExtensionGenerator>> extension_generators_;
 
                 GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(MessageGenerator);
             };
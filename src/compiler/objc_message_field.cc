@@ -45,6 +45,7 @@ namespace protobuf {
                     }
 
                     (*variables)["list_name"] = UnderscoresToCamelCase(descriptor) + "Array";
+                    (*variables)["json_name"] = JSONFieldName(descriptor);
                     (*variables)["number"]    = SimpleItoa(descriptor->number());
                     (*variables)["type"]      = ClassName(descriptor->message_type());
                     if(IsPrimitiveType(GetObjectiveCType(descriptor))) {
@@ -198,6 +199,26 @@ namespace protobuf {
                     "[self set$capitalized_name$:[subBuilder buildPartial]];\n");
             }
 
+            void MessageFieldGenerator::GenerateTextFormatParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "$type$_Builder* subBuilder = [$type$ builder];\n"
+                    "if (self.builder_result.has$capitalized_name$) {\n"
+                    "  [subBuilder mergeFrom:self.builder_result.$name$];\n"
+                    "}\n"
+                    "PBTextFormatReaderReadMessage(reader, subBuilder);\n"
+                    "[self set$capitalized_name$:[subBuilder buildPartial]];\n");
+            }
+
+            void MessageFieldGenerator::GenerateJSONParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "$type$_Builder* subBuilder = [$type$ builder];\n"
+                    "if (self.builder_result.has$capitalized_name$) {\n"
+                    "  [subBuilder mergeFrom:self.builder_result.$name$];\n"
+                    "}\n"
+                    "PBJSONReaderReadMessage(reader, subBuilder);\n"
+                    "[self set$capitalized_name$:[subBuilder buildPartial]];\n");
+            }
+
             void MessageFieldGenerator::GenerateSerializationCodeHeader(io::Printer *printer) const {
             }
 
@@ -221,10 +242,14 @@ namespace protobuf {
             void MessageFieldGenerator::GenerateDescriptionCodeSource(io::Printer *printer) const {
                 printer->Print(variables_,
                     "if (self.has$capitalized_name$) {\n"
-                    "  [output appendFormat:@\"%@%@ {\\n\", indent, @\"$name$\"];\n"
-                    "  [self.$name$ writeDescriptionTo:output\n"
-                    "                       withIndent:[NSString stringWithFormat:@\"%@  \", indent]];\n"
-                    "  [output appendFormat:@\"%@}\\n\", indent];\n"
+                    "  PBTextFormatWriteMessage(writer, \"$name$\", self.$name$);\n"
+                    "}\n");
+            }
+
+            void MessageFieldGenerator::GenerateJSONWritingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "if (self.has$capitalized_name$) {\n"
+                    "  PBJSONWriteMessage(writer, \"$json_name$\", self.$name$);\n"
                     "}\n");
             }
 
@@ -241,6 +266,55 @@ namespace protobuf {
                     "}\n");
             }
 
+            void MessageFieldGenerator::GenerateFieldTableEntrySource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "{ \"$name$\", \"has$capitalized_name$\", PBFieldTableTypeMessage, $number$, 0 },\n");
+            }
+
+            void MessageFieldGenerator::GenerateDiffCodeSource(io::Printer *printer) const {
+                // Recurse into the submessage only if its type can apply the result.
+                if(hasDeltaMethods(ClassName(descriptor_->message_type()))) {
+                    printer->Print(variables_,
+                        "if (self.has$capitalized_name$) {\n"
+                        "  if (!other.has$capitalized_name$) {\n"
+                        "    changes.has$capitalized_name$ = YES;\n"
+                        "    changes.$name$ = self.$name$;\n"
+                        "  } else if (![self.$name$ isEqual:other.$name$]) {\n"
+                        "    [fieldDeltas setObject:[self.$name$ diffFrom:other.$name$] forKey:@$number$];\n"
+                        "  }\n");
+                } else {
+                    printer->Print(variables_,
+                        "if (self.has$capitalized_name$) {\n"
+                        "  if (!other.has$capitalized_name$ || ![self.$name$ isEqual:other.$name$]) {\n"
+                        "    changes.has$capitalized_name$ = YES;\n"
+                        "    changes.$name$ = self.$name$;\n"
+                        "  }\n");
+                }
+                printer->Print(variables_,
+                    "} else if (other.has$capitalized_name$) {\n"
+                    "  [clearedFields addObject:@$number$];\n"
+                    "}\n");
+            }
+
+            void MessageFieldGenerator::GenerateApplyDeltaCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "if ([clearedFields containsObject:@$number$]) {\n"
+                    "  [self clear$capitalized_name$];\n"
+                    "}\n");
+                // Changed submessages replace the old value rather than merging into it.
+                printer->Print(variables_,
+                    "if (other.has$capitalized_name$) {\n"
+                    "  [self set$capitalized_name$:other.$name$];\n"
+                    "}\n");
+                if(hasDeltaMethods(ClassName(descriptor_->message_type()))) {
+                    printer->Print(variables_,
+                        "PBMessageDelta* $name$Delta = [delta deltaForField:$number$];\n"
+                        "if ($name$Delta != nil) {\n"
+                        "  [self set$capitalized_name$:[[[$type$ builderWithPrototype:builder_result.$name$] applyDelta:$name$Delta] buildPartial]];\n"
+                        "}\n");
+                }
+            }
+
             void MessageFieldGenerator::GenerateMembersSource(io::Printer *printer) const {
             }
 
@@ -435,6 +509,23 @@ namespace protobuf {
                     "[self add$capitalized_name$:[subBuilder buildPartial]];\n");
             }
 
+            void RepeatedMessageFieldGenerator::GenerateTextFormatParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "$type$_Builder* subBuilder = [$type$ builder];\n"
+                    "PBTextFormatReaderReadMessage(reader, subBuilder);\n"
+                    "[self add$capitalized_name$:[subBuilder buildPartial]];\n");
+            }
+
+            void RepeatedMessageFieldGenerator::GenerateJSONParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "PBJSONReaderBeginArray(reader);\n"
+                    "while (PBJSONReaderHasNextElement(reader)) {\n"
+                    "  $type$_Builder* subBuilder = [$type$ builder];\n"
+                    "  PBJSONReaderReadMessage(reader, subBuilder);\n"
+                    "  [self add$capitalized_name$:[subBuilder buildPartial]];\n"
+                    "}\n");
+            }
+
             void RepeatedMessageFieldGenerator::GenerateSerializationCodeSource(io::Printer *printer) const {
                 printer->Print(variables_,
                     "for ($type$ *element in self.$list_name$) {\n"
@@ -452,10 +543,18 @@ namespace protobuf {
             void RepeatedMessageFieldGenerator::GenerateDescriptionCodeSource(io::Printer *printer) const {
                 printer->Print(variables_,
                     "for ($type$* element in self.$list_name$) {\n"
-                    "  [output appendFormat:@\"%@%@ {\\n\", indent, @\"$name$\"];\n"
-                    "  [element writeDescriptionTo:output\n"
-                    "                   withIndent:[NSString stringWithFormat:@\"%@  \", indent]];\n"
-                    "  [output appendFormat:@\"%@}\\n\", indent];\n"
+                    "  PBTextFormatWriteMessage(writer, \"$name$\", element);\n"
+                    "}\n");
+            }
+
+            void RepeatedMessageFieldGenerator::GenerateJSONWritingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "if (self.$list_name$.count > 0) {\n"
+                    "  PBJSONWriterBeginArray(writer, \"$json_name$\");\n"
+                    "  for ($type$* element in self.$list_name$) {\n"
+                    "    PBJSONWriteMessage(writer, NULL, element);\n"
+                    "  }\n"
+                    "  PBJSONWriterEndArray(writer);\n"
                     "}\n");
             }
 
@@ -475,6 +574,31 @@ namespace protobuf {
                 }
             }
 
+            void RepeatedMessageFieldGenerator::GenerateFieldTableEntrySource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "{ \"$name$\", NULL, PBFieldTableTypeMessage, $number$, 0 },\n");
+            }
+
+            void RepeatedMessageFieldGenerator::GenerateDiffCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "if (self.$list_name$ != other.$list_name$ && ![self.$list_name$ isEqualToArray:other.$list_name$]) {\n"
+                    "  if (self.$list_name$.count > 0) {\n"
+                    "    changes.$list_name$ = self.$list_name$;\n"
+                    "  } else {\n"
+                    "    [clearedFields addObject:@$number$];\n"
+                    "  }\n"
+                    "}\n");
+            }
+
+            void RepeatedMessageFieldGenerator::GenerateApplyDeltaCodeSource(io::Printer *printer) const {
+                // A changed list replaces the old one; merging alone would append to it.
+                printer->Print(variables_,
+                    "if ([clearedFields containsObject:@$number$] || other.$list_name$.count > 0) {\n"
+                    "  [self clear$capitalized_name$];\n"
+                    "}\n");
+                GenerateMergingCodeSource(printer);
+            }
+
             string RepeatedMessageFieldGenerator::GetBoxedType() const {
                 return ClassName(descriptor_->message_type());
             }
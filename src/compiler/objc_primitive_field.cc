@@ -79,6 +79,174 @@ namespace protobuf {
                     return NULL;
                 }
 
+                const char *GetFieldTableType(const FieldDescriptor *field) {
+                    switch(field->type()) {
+                    case FieldDescriptor::TYPE_INT32:
+                    case FieldDescriptor::TYPE_SINT32:
+                    case FieldDescriptor::TYPE_SFIXED32:
+                        return "PBFieldTableTypeInt32";
+                    case FieldDescriptor::TYPE_UINT32:
+                    case FieldDescriptor::TYPE_FIXED32:
+                        return "PBFieldTableTypeUInt32";
+                    case FieldDescriptor::TYPE_INT64:
+                    case FieldDescriptor::TYPE_SINT64:
+                    case FieldDescriptor::TYPE_SFIXED64:
+                        return "PBFieldTableTypeInt64";
+                    case FieldDescriptor::TYPE_UINT64:
+                    case FieldDescriptor::TYPE_FIXED64:
+                        return "PBFieldTableTypeUInt64";
+                    case FieldDescriptor::TYPE_FLOAT:
+                        return "PBFieldTableTypeFloat";
+                    case FieldDescriptor::TYPE_DOUBLE:
+                        return "PBFieldTableTypeDouble";
+                    case FieldDescriptor::TYPE_BOOL:
+                        return "PBFieldTableTypeBool";
+                    case FieldDescriptor::TYPE_STRING:
+                    case FieldDescriptor::TYPE_BYTES:
+                        return "PBFieldTableTypeObject";
+                    default:
+                        return NULL;
+                    }
+
+                    GOOGLE_LOG(FATAL) << "Can't get here.";
+                    return NULL;
+                }
+
+                const char *GetTextFormatWriteFunction(const FieldDescriptor *field) {
+                    switch(field->type()) {
+                    case FieldDescriptor::TYPE_INT32:
+                    case FieldDescriptor::TYPE_SINT32:
+                    case FieldDescriptor::TYPE_SFIXED32:
+                        return "PBTextFormatWriteInt32";
+                    case FieldDescriptor::TYPE_UINT32:
+                    case FieldDescriptor::TYPE_FIXED32:
+                        return "PBTextFormatWriteUInt32";
+                    case FieldDescriptor::TYPE_INT64:
+                    case FieldDescriptor::TYPE_SINT64:
+                    case FieldDescriptor::TYPE_SFIXED64:
+                        return "PBTextFormatWriteInt64";
+                    case FieldDescriptor::TYPE_UINT64:
+                    case FieldDescriptor::TYPE_FIXED64:
+                        return "PBTextFormatWriteUInt64";
+                    case FieldDescriptor::TYPE_FLOAT:
+                        return "PBTextFormatWriteFloat";
+                    case FieldDescriptor::TYPE_DOUBLE:
+                        return "PBTextFormatWriteDouble";
+                    case FieldDescriptor::TYPE_BOOL:
+                        return "PBTextFormatWriteBool";
+                    case FieldDescriptor::TYPE_STRING:
+                    case FieldDescriptor::TYPE_BYTES:
+                        return "PBTextFormatWriteObject";
+                    default:
+                        return NULL;
+                    }
+
+                    GOOGLE_LOG(FATAL) << "Can't get here.";
+                    return NULL;
+                }
+
+                const char *GetTextFormatReadFunction(const FieldDescriptor *field) {
+                    switch(field->type()) {
+                    case FieldDescriptor::TYPE_INT32:
+                    case FieldDescriptor::TYPE_SINT32:
+                    case FieldDescriptor::TYPE_SFIXED32:
+                        return "PBTextFormatReaderReadInt32";
+                    case FieldDescriptor::TYPE_UINT32:
+                    case FieldDescriptor::TYPE_FIXED32:
+                        return "PBTextFormatReaderReadUInt32";
+                    case FieldDescriptor::TYPE_INT64:
+                    case FieldDescriptor::TYPE_SINT64:
+                    case FieldDescriptor::TYPE_SFIXED64:
+                        return "PBTextFormatReaderReadInt64";
+                    case FieldDescriptor::TYPE_UINT64:
+                    case FieldDescriptor::TYPE_FIXED64:
+                        return "PBTextFormatReaderReadUInt64";
+                    case FieldDescriptor::TYPE_FLOAT:
+                        return "PBTextFormatReaderReadFloat";
+                    case FieldDescriptor::TYPE_DOUBLE:
+                        return "PBTextFormatReaderReadDouble";
+                    case FieldDescriptor::TYPE_BOOL:
+                        return "PBTextFormatReaderReadBool";
+                    case FieldDescriptor::TYPE_STRING:
+                        return "PBTextFormatReaderReadString";
+                    case FieldDescriptor::TYPE_BYTES:
+                        return "PBTextFormatReaderReadData";
+                    default:
+                        return NULL;
+                    }
+
+                    GOOGLE_LOG(FATAL) << "Can't get here.";
+                    return NULL;
+                }
+
+                const char *GetJSONWriteFunction(const FieldDescriptor *field) {
+                    switch(field->type()) {
+                    case FieldDescriptor::TYPE_INT32:
+                    case FieldDescriptor::TYPE_SINT32:
+                    case FieldDescriptor::TYPE_SFIXED32:
+                        return "PBJSONWriteInt32";
+                    case FieldDescriptor::TYPE_UINT32:
+                    case FieldDescriptor::TYPE_FIXED32:
+                        return "PBJSONWriteUInt32";
+                    case FieldDescriptor::TYPE_INT64:
+                    case FieldDescriptor::TYPE_SINT64:
+                    case FieldDescriptor::TYPE_SFIXED64:
+                        return "PBJSONWriteInt64";
+                    case FieldDescriptor::TYPE_UINT64:
+                    case FieldDescriptor::TYPE_FIXED64:
+                        return "PBJSONWriteUInt64";
+                    case FieldDescriptor::TYPE_FLOAT:
+                        return "PBJSONWriteFloat";
+                    case FieldDescriptor::TYPE_DOUBLE:
+                        return "PBJSONWriteDouble";
+                    case FieldDescriptor::TYPE_BOOL:
+                        return "PBJSONWriteBool";
+                    case FieldDescriptor::TYPE_STRING:
+                        return "PBJSONWriteString";
+                    case FieldDescriptor::TYPE_BYTES:
+                        return "PBJSONWriteData";
+                    default:
+                        return NULL;
+                    }
+
+                    GOOGLE_LOG(FATAL) << "Can't get here.";
+                    return NULL;
+                }
+
+                const char *GetJSONReadFunction(const FieldDescriptor *field) {
+                    switch(field->type()) {
+                    case FieldDescriptor::TYPE_INT32:
+                    case FieldDescriptor::TYPE_SINT32:
+                    case FieldDescriptor::TYPE_SFIXED32:
+                        return "PBJSONReaderReadInt32";
+                    case FieldDescriptor::TYPE_UINT32:
+                    case FieldDescriptor::TYPE_FIXED32:
+                        return "PBJSONReaderReadUInt32";
+                    case FieldDescriptor::TYPE_INT64:
+                    case FieldDescriptor::TYPE_SINT64:
+                    case FieldDescriptor::TYPE_SFIXED64:
+                        return "PBJSONReaderReadInt64";
+                    case FieldDescriptor::TYPE_UINT64:
+                    case FieldDescriptor::TYPE_FIXED64:
+                        return "PBJSONReaderReadUInt64";
+                    case FieldDescriptor::TYPE_FLOAT:
+                        return "PBJSONReaderReadFloat";
+                    case FieldDescriptor::TYPE_DOUBLE:
+                        return "PBJSONReaderReadDouble";
+                    case FieldDescriptor::TYPE_BOOL:
+                        return "PBJSONReaderReadBool";
+                    case FieldDescriptor::TYPE_STRING:
+                        return "PBJSONReaderReadString";
+                    case FieldDescriptor::TYPE_BYTES:
+                        return "PBJSONReaderReadData";
+                    default:
+                        return NULL;
+                    }
+
+                    GOOGLE_LOG(FATAL) << "Can't get here.";
+                    return NULL;
+                }
+
                 const char *GetArrayValueTypeName(const FieldDescriptor *field) {
                     switch(field->type()) {
                     case FieldDescriptor::TYPE_INT32:
@@ -274,8 +442,14 @@ namespace protobuf {
                     }
 
                     (*variables)["list_name"] = UnderscoresToCamelCase(descriptor) + "Array";
+                    (*variables)["json_name"] = JSONFieldName(descriptor);
                     (*variables)["number"]    = SimpleItoa(descriptor->number());
                     (*variables)["type"]      = PrimitiveTypeName(descriptor);
+                    (*variables)["field_table_type"] = GetFieldTableType(descriptor);
+                    (*variables)["text_format_write"] = GetTextFormatWriteFunction(descriptor);
+                    (*variables)["text_format_read"]  = GetTextFormatReadFunction(descriptor);
+                    (*variables)["json_write"]        = GetJSONWriteFunction(descriptor);
+                    (*variables)["json_read"]         = GetJSONReadFunction(descriptor);
 
                     if(IsPrimitiveType(GetObjectiveCType(descriptor))) {
                         (*variables)["storage_type"]      = PrimitiveTypeName(descriptor);
@@ -444,6 +618,16 @@ namespace protobuf {
                     "[self set$capitalized_name$:[input read$capitalized_type$]];\n");
             }
 
+            void PrimitiveFieldGenerator::GenerateTextFormatParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "[self set$capitalized_name$:$text_format_read$(reader)];\n");
+            }
+
+            void PrimitiveFieldGenerator::GenerateJSONParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "[self set$capitalized_name$:$json_read$(reader)];\n");
+            }
+
             void PrimitiveFieldGenerator::GenerateSerializationCodeSource(io::Printer *printer) const {
                 printer->Print(variables_,
                     "if (self.has$capitalized_name$) {\n"
@@ -461,11 +645,14 @@ namespace protobuf {
             void PrimitiveFieldGenerator::GenerateDescriptionCodeSource(io::Printer *printer) const {
                 printer->Print(variables_,
                     "if (self.has$capitalized_name$) {\n"
-                    "  [output appendFormat:@\"%@%@: %@\\n\", indent, @\"$name$\", ");
-                printer->Print(variables_,
-                    BoxValue(descriptor_, "self.$name$").c_str()); //RAGY
+                    "  $text_format_write$(writer, \"$name$\", self.$name$);\n"
+                    "}\n");
+            }
+
+            void PrimitiveFieldGenerator::GenerateJSONWritingCodeSource(io::Printer *printer) const {
                 printer->Print(variables_,
-                    "];\n"
+                    "if (self.has$capitalized_name$) {\n"
+                    "  $json_write$(writer, \"$json_name$\", self.$name$);\n"
                     "}\n");
             }
 
@@ -490,6 +677,37 @@ namespace protobuf {
                     "}\n");
             }
 
+            void PrimitiveFieldGenerator::GenerateFieldTableEntrySource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "{ \"$name$\", \"has$capitalized_name$\", $field_table_type$, $number$, 0 },\n");
+            }
+
+            void PrimitiveFieldGenerator::GenerateDiffCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "if (self.has$capitalized_name$) {\n"
+                    "  if (!other.has$capitalized_name$ || ");
+                if(ReturnsPrimitiveType(descriptor_)) {
+                    printer->Print(variables_, "self.$name$ != other.$name$) {\n");
+                } else {
+                    printer->Print(variables_, "![self.$name$ isEqual:other.$name$]) {\n");
+                }
+                printer->Print(variables_,
+                    "    changes.has$capitalized_name$ = YES;\n"
+                    "    changes.$name$ = self.$name$;\n"
+                    "  }\n"
+                    "} else if (other.has$capitalized_name$) {\n"
+                    "  [clearedFields addObject:@$number$];\n"
+                    "}\n");
+            }
+
+            void PrimitiveFieldGenerator::GenerateApplyDeltaCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "if ([clearedFields containsObject:@$number$]) {\n"
+                    "  [self clear$capitalized_name$];\n"
+                    "}\n");
+                GenerateMergingCodeSource(printer);
+            }
+
             RepeatedPrimitiveFieldGenerator::RepeatedPrimitiveFieldGenerator(const FieldDescriptor *descriptor)
                 : descriptor_(descriptor) {
                 SetPrimitiveVariables(descriptor, &variables_);
@@ -711,6 +929,19 @@ namespace protobuf {
                 }
             }
 
+            void RepeatedPrimitiveFieldGenerator::GenerateTextFormatParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "[self add$capitalized_name$:$text_format_read$(reader)];\n");
+            }
+
+            void RepeatedPrimitiveFieldGenerator::GenerateJSONParsingCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "PBJSONReaderBeginArray(reader);\n"
+                    "while (PBJSONReaderHasNextElement(reader)) {\n"
+                    "  [self add$capitalized_name$:$json_read$(reader)];\n"
+                    "}\n");
+            }
+
             void RepeatedPrimitiveFieldGenerator::GenerateSerializationCodeSource(io::Printer *printer) const {
                 if(isObjectArray(descriptor_)) {
                     printer->Print(variables_,
@@ -789,17 +1020,40 @@ namespace protobuf {
                     printer->Print(variables_,
                         "NSUInteger $list_name$Count=self.$list_name$.count;\n"
                         "for(NSUInteger i=0;i<$list_name$Count;i++){\n"
-                        "  [output appendFormat:@\"%@%@: %d\\n\", indent, @\"$name$\", [self.$list_name$ $array_value_type_name$AtIndex:i]];\n"
+                        "  $text_format_write$(writer, \"$name$\", [self.$list_name$ $array_value_type_name$AtIndex:i]);\n"
                         "}\n");
-                    //RAGY need to adjust the string format from %@
                 } else {
                     printer->Print(variables_,
                         "for ($storage_type$ element in self.$list_name$) {\n"
-                        "  [output appendFormat:@\"%@%@: %@\\n\", indent, @\"$name$\", element];\n"
+                        "  $text_format_write$(writer, \"$name$\", element);\n"
                         "}\n");
                 }
             }
 
+            void RepeatedPrimitiveFieldGenerator::GenerateJSONWritingCodeSource(io::Printer *printer) const {
+                // Empty repeated fields are left out, like unset singular ones.
+                printer->Print(variables_,
+                    "if (self.$list_name$.count > 0) {\n"
+                    "  PBJSONWriterBeginArray(writer, \"$json_name$\");\n");
+                printer->Indent();
+                if(ReturnsPrimitiveType(descriptor_)) {
+                    printer->Print(variables_,
+                        "NSUInteger $list_name$Count=self.$list_name$.count;\n"
+                        "for(NSUInteger i=0;i<$list_name$Count;i++){\n"
+                        "  $json_write$(writer, NULL, [self.$list_name$ $array_value_type_name$AtIndex:i]);\n"
+                        "}\n");
+                } else {
+                    printer->Print(variables_,
+                        "for ($storage_type$ element in self.$list_name$) {\n"
+                        "  $json_write$(writer, NULL, element);\n"
+                        "}\n");
+                }
+                printer->Outdent();
+                printer->Print(
+                    "  PBJSONWriterEndArray(writer);\n"
+                    "}\n");
+            }
+
             void RepeatedPrimitiveFieldGenerator::GenerateIsEqualCodeSource(io::Printer *printer) const {
                 printer->Print(variables_, "(self.$list_name$ == otherMessage.$list_name$ || [self.$list_name$ isEqualToArray:otherMessage.$list_name$]) &&");
             }
@@ -818,6 +1072,31 @@ namespace protobuf {
                         "}\n");
                 }
             }
+
+            void RepeatedPrimitiveFieldGenerator::GenerateFieldTableEntrySource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "{ \"$name$\", NULL, $field_table_type$, $number$, 0 },\n");
+            }
+
+            void RepeatedPrimitiveFieldGenerator::GenerateDiffCodeSource(io::Printer *printer) const {
+                printer->Print(variables_,
+                    "if (self.$list_name$ != other.$list_name$ && ![self.$list_name$ isEqualToArray:other.$list_name$]) {\n"
+                    "  if (self.$list_name$.count > 0) {\n"
+                    "    changes.$list_name$ = self.$list_name$;\n"
+                    "  } else {\n"
+                    "    [clearedFields addObject:@$number$];\n"
+                    "  }\n"
+                    "}\n");
+            }
+
+            void RepeatedPrimitiveFieldGenerator::GenerateApplyDeltaCodeSource(io::Printer *printer) const {
+                // A changed list replaces the old one; merging alone would append to it.
+                printer->Print(variables_,
+                    "if ([clearedFields containsObject:@$number$] || other.$list_name$.count > 0) {\n"
+                    "  [self clear$capitalized_name$];\n"
+                    "}\n");
+                GenerateMergingCodeSource(printer);
+            }
         } // namespace objectivec
     }     // namespace compiler
 } // namespace protobuf
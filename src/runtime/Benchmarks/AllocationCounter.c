@@ -0,0 +1,86 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "AllocationCounter.h"
+
+#include <errno.h>
+#include <stdlib.h>
+
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t count, size_t size);
+extern void* __libc_realloc(void* pointer, size_t size);
+extern void* __libc_memalign(size_t alignment, size_t size);
+
+// Read only through PBBenchmarkAllocationCount: callers in the same file as
+// the wrappers could be compiled on the assumption that malloc leaves it alone.
+static uint64_t allocationCount;
+
+
+static void countAllocation(void) {
+  __atomic_fetch_add(&allocationCount, 1, __ATOMIC_RELAXED);
+}
+
+
+uint64_t PBBenchmarkAllocationCount(void) {
+  return __atomic_load_n(&allocationCount, __ATOMIC_RELAXED);
+}
+
+
+void* malloc(size_t size) {
+  countAllocation();
+  return __libc_malloc(size);
+}
+
+
+void* calloc(size_t count, size_t size) {
+  countAllocation();
+  return __libc_calloc(count, size);
+}
+
+
+void* realloc(void* pointer, size_t size) {
+  if (pointer == NULL) {
+    countAllocation();
+  }
+  return __libc_realloc(pointer, size);
+}
+
+
+int posix_memalign(void** result, size_t alignment, size_t size) {
+  if (alignment < sizeof(void*) || (alignment & (alignment - 1)) != 0) {
+    return EINVAL;
+  }
+  countAllocation();
+  void* pointer = __libc_memalign(alignment, size);
+  if (pointer == NULL) {
+    return ENOMEM;
+  }
+  *result = pointer;
+  return 0;
+}
+
+
+void* aligned_alloc(size_t alignment, size_t size) {
+  countAllocation();
+  return __libc_memalign(alignment, size);
+}
+
+
+void* memalign(size_t alignment, size_t size) {
+  countAllocation();
+  return __libc_memalign(alignment, size);
+}
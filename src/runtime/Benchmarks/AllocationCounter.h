@@ -0,0 +1,30 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdint.h>
+
+/**
+ * Counts heap allocations in the benchmark process by replacing malloc,
+ * calloc, realloc and the aligned allocators with wrappers around glibc's
+ * own entry points.  Foundation and libobjc2 allocate objects through these
+ * as well, so the count covers objects, buffers and strings alike.  Only
+ * new blocks are counted; free and in-place realloc are not.
+ *
+ * This relies on glibc exporting __libc_malloc and friends, so it is only
+ * built into the Linux benchmark.
+ */
+uint64_t PBBenchmarkAllocationCount(void);
@@ -0,0 +1,40 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+
+/**
+ * The median of count values, which need not be sorted.
+ */
+double PBBenchmarkMedian(const double* values, NSUInteger count);
+
+
+/**
+ * Compares the reports of two builds of runtime-benchmark, each run with
+ * --samples so every case carries its per-sample timings.  Samples of the
+ * same case from several reports of one side are pooled.  For each case this
+ * prints the median and median absolute deviation of both sides, the change
+ * of the median and the two-sided p-value of a Mann-Whitney U test.
+ *
+ * A case regresses when its median is more than threshold percent slower
+ * and p is below alpha.  Returns the number of regressed cases, or -1 if a
+ * report could not be read.
+ */
+int PBBenchmarkCompare(NSArray* baselinePaths,
+                       NSArray* currentPaths,
+                       double threshold,
+                       double alpha);
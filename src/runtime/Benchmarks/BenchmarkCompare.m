@@ -0,0 +1,212 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "BenchmarkCompare.h"
+
+#import <math.h>
+#import <stdlib.h>
+#import <string.h>
+
+
+static int compareDoubles(const void* a, const void* b) {
+  double x = *(const double*)a;
+  double y = *(const double*)b;
+  return x < y ? -1 : x > y ? 1 : 0;
+}
+
+
+// values must be sorted.
+static double median(const double* values, NSUInteger count) {
+  if (count % 2 == 1) {
+    return values[count / 2];
+  }
+  return (values[count / 2 - 1] + values[count / 2]) / 2;
+}
+
+
+// values must be sorted.
+static double medianAbsoluteDeviation(const double* values, NSUInteger count) {
+  double center = median(values, count);
+  double* deviations = malloc(count * sizeof(double));
+  for (NSUInteger i = 0; i < count; i++) {
+    deviations[i] = fabs(values[i] - center);
+  }
+  qsort(deviations, count, sizeof(double), compareDoubles);
+  double result = median(deviations, count);
+  free(deviations);
+  return result;
+}
+
+
+/**
+ * Two-sided p-value of the Mann-Whitney U test of a against b, from the
+ * normal approximation with tie correction and continuity correction.  With
+ * the dozens of samples the comparison pools, the approximation is close.
+ */
+static double mannWhitneyP(const double* a, NSUInteger countA, const double* b, NSUInteger countB) {
+  NSUInteger count = countA + countB;
+  if (countA == 0 || countB == 0) {
+    return 1;
+  }
+
+  // Each pooled value keeps which side it came from in its index.
+  typedef struct {
+    double value;
+    NSUInteger index;
+  } Entry;
+  Entry* entries = malloc(count * sizeof(Entry));
+  for (NSUInteger i = 0; i < countA; i++) {
+    entries[i].value = a[i];
+    entries[i].index = i;
+  }
+  for (NSUInteger i = 0; i < countB; i++) {
+    entries[countA + i].value = b[i];
+    entries[countA + i].index = countA + i;
+  }
+  // value comes first, so compareDoubles orders entries by it.
+  qsort(entries, count, sizeof(Entry), compareDoubles);
+
+  double rankSumA = 0;
+  double tieTerm = 0;
+  for (NSUInteger i = 0; i < count;) {
+    NSUInteger end = i + 1;
+    while (end < count && entries[end].value == entries[i].value) {
+      end++;
+    }
+    // Tied values all get the mean of the ranks they span, 1-based.
+    double rank = (i + 1 + end) / 2.0;
+    for (NSUInteger j = i; j < end; j++) {
+      if (entries[j].index < countA) {
+        rankSumA += rank;
+      }
+    }
+    double ties = end - i;
+    tieTerm += ties * ties * ties - ties;
+    i = end;
+  }
+  free(entries);
+
+  double u = rankSumA - countA * (countA + 1) / 2.0;
+  double mean = countA * (double)countB / 2;
+  double variance = countA * (double)countB / 12 * ((count + 1) - tieTerm / (count * (double)(count - 1)));
+  if (variance <= 0) {
+    return 1;
+  }
+  double distance = fmax(fabs(u - mean) - 0.5, 0);
+  return erfc(distance / sqrt(2 * variance));
+}
+
+
+/**
+ * Collects the samples of every case in the given reports, keyed by
+ * "payload/case".  Case order is that of the first report that has the case.
+ */
+static NSDictionary* readSamples(NSArray* paths, NSMutableArray* order) {
+  NSMutableDictionary* samples = [NSMutableDictionary dictionary];
+  for (NSString* path in paths) {
+    NSData* data = [NSData dataWithContentsOfFile:path];
+    NSDictionary* report = data != nil ? [NSJSONSerialization JSONObjectWithData:data options:0 error:NULL] : nil;
+    if (![report isKindOfClass:[NSDictionary class]]) {
+      fprintf(stderr, "runtime-benchmark: cannot read report %s\n", path.UTF8String);
+      return nil;
+    }
+    for (NSDictionary* result in [report objectForKey:@"benchmarks"]) {
+      NSString* name = [NSString stringWithFormat:@"%@/%@",
+                        [result objectForKey:@"payload"], [result objectForKey:@"case"]];
+      NSMutableArray* values = [samples objectForKey:name];
+      if (values == nil) {
+        values = [NSMutableArray array];
+        [samples setObject:values forKey:name];
+        if (![order containsObject:name]) {
+          [order addObject:name];
+        }
+      }
+      [values addObjectsFromArray:[result objectForKey:@"samples"]];
+    }
+  }
+  return samples;
+}
+
+
+double PBBenchmarkMedian(const double* values, NSUInteger count) {
+  double* sorted = malloc(count * sizeof(double));
+  memcpy(sorted, values, count * sizeof(double));
+  qsort(sorted, count, sizeof(double), compareDoubles);
+  double result = median(sorted, count);
+  free(sorted);
+  return result;
+}
+
+
+static double* sortedValues(NSArray* numbers) {
+  double* values = malloc(MAX(numbers.count, 1) * sizeof(double));
+  for (NSUInteger i = 0; i < numbers.count; i++) {
+    values[i] = [[numbers objectAtIndex:i] doubleValue];
+  }
+  qsort(values, numbers.count, sizeof(double), compareDoubles);
+  return values;
+}
+
+
+int PBBenchmarkCompare(NSArray* baselinePaths,
+                       NSArray* currentPaths,
+                       double threshold,
+                       double alpha) {
+  NSMutableArray* order = [NSMutableArray array];
+  NSDictionary* baseline = readSamples(baselinePaths, order);
+  NSDictionary* current = readSamples(currentPaths, order);
+  if (baseline == nil || current == nil) {
+    return -1;
+  }
+
+  printf("%-44s %12s %7s %12s %7s %8s %9s\n",
+         "case", "baseline ns", "MAD", "current ns", "MAD", "change", "p");
+  int regressions = 0;
+  for (NSString* name in order) {
+    NSArray* before = [baseline objectForKey:name];
+    NSArray* after = [current objectForKey:name];
+    if (before.count == 0 || after.count == 0) {
+      printf("%-44s only in the %s report\n", name.UTF8String, before.count == 0 ? "current" : "baseline");
+      continue;
+    }
+
+    double* a = sortedValues(before);
+    double* b = sortedValues(after);
+    double medianA = median(a, before.count);
+    double medianB = median(b, after.count);
+    double change = (medianB - medianA) * 100 / medianA;
+    double p = mannWhitneyP(a, before.count, b, after.count);
+    const char* verdict = "";
+    if (p < alpha && change > threshold) {
+      verdict = "  slower";
+      regressions++;
+    } else if (p < alpha && change < -threshold) {
+      verdict = "  faster";
+    }
+    printf("%-44s %12.1f %6.1f%% %12.1f %6.1f%% %+7.1f%% %9.4f%s\n",
+           name.UTF8String,
+           medianA, medianAbsoluteDeviation(a, before.count) * 100 / medianA,
+           medianB, medianAbsoluteDeviation(b, after.count) * 100 / medianB,
+           change, p, verdict);
+    free(a);
+    free(b);
+  }
+
+  printf("%d case%s slower by more than %.1f%% at p < %g\n",
+         regressions, regressions == 1 ? "" : "s", threshold, alpha);
+  return regressions;
+}
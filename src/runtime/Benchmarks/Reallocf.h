@@ -0,0 +1,26 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stddef.h>
+
+/**
+ * The BSD reallocf, which glibc does not provide: resizes ptr like realloc,
+ * and frees it if the allocation fails.  Revisions of the runtime from before
+ * PBReallocf call it, so bench_compare.sh force-includes this header and
+ * links Reallocf.c into both builds to compare against them on Linux.
+ */
+void* reallocf(void* ptr, size_t size);
@@ -0,0 +1,577 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+#import <time.h>
+
+#import "ProtocolBuffers.h"
+#import "Unittest.pb.h"
+
+#import "AllocationCounter.h"
+#import "BenchmarkCompare.h"
+
+/**
+ * Times the runtime's core operations on a fixed set of payloads and prints
+ * the results as JSON on stdout:
+ *
+ *   {"benchmarks": [{"payload": "golden_message", "case": "parse",
+ *                    "bytes": 487, "iterations": 131072, "ns_per_op": 1930.2,
+ *                    "mb_per_s": 288.1, "allocs_per_op": 61.0,
+ *                    "samples": [1930.2]}, ...]}
+ *
+ * usage: runtime-benchmark [--suite full|compare] [--samples count]
+ *                          [--min-time seconds] [--filter text] [--data-dir dir]
+ *        runtime-benchmark --compare [--threshold percent] [--alpha p]
+ *                          --baseline report... --current report...
+ *
+ * Each case first grows its batch size by doubling, untimed, then takes
+ * --samples (default 1) samples, each running whole batches until at least
+ * --min-time (default 0.5) seconds have been timed.  ns_per_op is the median
+ * sample.  MB/s is always relative to the payload's encoded size, so the
+ * cases can be compared with each other.  Allocations are counted while the
+ * timed loops run only.
+ *
+ * The full suite runs every case on every payload.  The compare suite is the
+ * fixed set bench_compare.sh runs against two builds: PBCodedInputStream and
+ * PBCodedOutputStream on their own, then parse and serialize of each payload.
+ * It only uses API that older revisions of the runtime have as well, and the
+ * whole file compiles against them: the full suite skips pooledData on a
+ * runtime without -pooledData.
+ * --compare reads reports of both builds and exits 1 if a case regressed; see
+ * BenchmarkCompare.h.
+ *
+ * serializedSize is memoized, so it is timed on fresh copies parsed before
+ * each batch; serialize runs on one message whose sizes are already known,
+ * which is what repeated sends of the same message cost.  pooledData should
+ * report one allocation per op, the view it returns.
+ */
+
+static const NSUInteger kMaxBatch = 65536;
+
+// Copies made for serializedSize take memory, so its batches stop growing here.
+static const NSUInteger kMaxFreshCopies = 64;
+
+// Values per buffer in the coded stream cases.
+static const int32_t kCodedValues = 4096;
+
+// -pooledData is newer than the oldest runtimes bench_compare.sh builds
+// against, so it is declared here rather than taken from Message.h.
+@protocol PBBenchmarkPooledData
+- (NSData*) pooledData;
+@end
+
+typedef id (^PBBenchmarkSetup)(NSUInteger count);
+typedef void (^PBBenchmarkOperation)(id inputs, NSUInteger index);
+
+
+@interface PBBenchmarkPayload : NSObject
+@property (copy) NSString* name;
+@property (strong) PBGeneratedMessage* message;
+@property (strong) NSData* data;
+@property (copy) PBGeneratedMessage* (^parse)(NSData* data);
+@property (copy) PBGeneratedMessage* (^merge)(PBGeneratedMessage* message);
+@end
+
+@implementation PBBenchmarkPayload
+@synthesize name;
+@synthesize message;
+@synthesize data;
+@synthesize parse;
+@synthesize merge;
+@end
+
+
+// The options every case runs with, and whether a result was printed yet.
+@interface PBBenchmarkRun : NSObject
+@property double minTime;
+@property NSUInteger samples;
+@property (copy) NSString* filter;
+@property BOOL printedResult;
+@end
+
+@implementation PBBenchmarkRun
+@synthesize minTime;
+@synthesize samples;
+@synthesize filter;
+@synthesize printedResult;
+@end
+
+
+static PBBenchmarkPayload* AllTypesPayload(NSString* name, TestAllTypes* message) {
+  PBBenchmarkPayload* payload = [[PBBenchmarkPayload alloc] init];
+  payload.name = name;
+  payload.message = message;
+  payload.data = message.data;
+  payload.parse = ^PBGeneratedMessage*(NSData* data) {
+    return [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromData:data] build];
+  };
+  payload.merge = ^PBGeneratedMessage*(PBGeneratedMessage* other) {
+    return [[[TestAllTypes builder] mergeFrom:(TestAllTypes*)other] build];
+  };
+  return payload;
+}
+
+
+static PBBenchmarkPayload* PackedTypesPayload(NSString* name, TestPackedTypes* message) {
+  PBBenchmarkPayload* payload = [[PBBenchmarkPayload alloc] init];
+  payload.name = name;
+  payload.message = message;
+  payload.data = message.data;
+  payload.parse = ^PBGeneratedMessage*(NSData* data) {
+    return [(TestPackedTypes_Builder*)[[TestPackedTypes builder] mergeFromData:data] build];
+  };
+  payload.merge = ^PBGeneratedMessage*(PBGeneratedMessage* other) {
+    return [[[TestPackedTypes builder] mergeFrom:(TestPackedTypes*)other] build];
+  };
+  return payload;
+}
+
+
+static NSData* ReadGoldenFile(NSString* directory, NSString* name) {
+  NSString* path = [directory stringByAppendingPathComponent:name];
+  NSData* data = [NSData dataWithContentsOfFile:path];
+  if (data == nil) {
+    fprintf(stderr, "runtime-benchmark: cannot read %s\n", path.UTF8String);
+    exit(1);
+  }
+  return data;
+}
+
+
+/**
+ * The payloads: the two golden messages from the unit tests, each merged
+ * into itself until its repeated fields hold hundreds of values, and a
+ * message that is almost all strings and bytes of mixed lengths.
+ */
+static NSArray* MakePayloads(NSString* dataDirectory) {
+  TestAllTypes* golden = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromData:ReadGoldenFile(dataDirectory, @"golden_message")] build];
+  TestPackedTypes* packed = [(TestPackedTypes_Builder*)[[TestPackedTypes builder] mergeFromData:ReadGoldenFile(dataDirectory, @"golden_packed_fields_message")] build];
+
+  TestAllTypes_Builder* largeAllTypes = [TestAllTypes builder];
+  for (int32_t i = 0; i < 256; i++) {
+    [largeAllTypes mergeFrom:golden];
+  }
+
+  TestPackedTypes_Builder* largePackedTypes = [TestPackedTypes builder];
+  for (int32_t i = 0; i < 1024; i++) {
+    [largePackedTypes mergeFrom:packed];
+  }
+
+  TestAllTypes_Builder* strings = [TestAllTypes builder];
+  NSString* fragments[] = { @"ascii ", @"gr\u00fc\u00dfe \u20ac ", @"" };
+  for (int32_t i = 0; i < 8192; i++) {
+    NSMutableString* value = [NSMutableString string];
+    for (int32_t j = 0; j < i % 24; j++) {
+      [value appendString:fragments[(i + j) % 3]];
+    }
+    [strings addRepeatedString:value];
+    if (i % 4 == 0) {
+      [strings addRepeatedBytes:[value dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+  }
+
+  return @[AllTypesPayload(@"golden_message", golden),
+           PackedTypesPayload(@"golden_packed_fields_message", packed),
+           AllTypesPayload(@"large_TestAllTypes", [largeAllTypes build]),
+           PackedTypesPayload(@"large_TestPackedTypes", [largePackedTypes build]),
+           AllTypesPayload(@"strings", [strings build])];
+}
+
+
+static double Now(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+
+static void PrintJSONString(NSString* value) {
+  // Payload and case names are plain ASCII identifiers.
+  printf("\"%s\"", value.UTF8String);
+}
+
+
+static void RunCase(PBBenchmarkRun* run,
+                    NSString* payloadName,
+                    NSString* name,
+                    NSUInteger bytes,
+                    NSUInteger maxBatch,
+                    PBBenchmarkSetup setup,
+                    PBBenchmarkOperation operation) {
+  NSString* fullName = [NSString stringWithFormat:@"%@/%@", payloadName, name];
+  if (run.filter != nil && [fullName rangeOfString:run.filter].location == NSNotFound) {
+    return;
+  }
+
+  // One untimed run, so first-use costs stay out of the numbers.
+  @autoreleasepool {
+    operation(setup != nil ? setup(1) : nil, 0);
+  }
+
+  // Batches grow until one takes a tenth of a sample, so reading the clock
+  // costs little next to the operations in between.
+  NSUInteger batch = 1;
+  while (batch < maxBatch) {
+    @autoreleasepool {
+      id inputs = setup != nil ? setup(batch) : nil;
+      double start = Now();
+      for (NSUInteger i = 0; i < batch; i++) {
+        operation(inputs, i);
+      }
+      if (Now() - start >= run.minTime / 10) {
+        break;
+      }
+    }
+    batch *= 2;
+  }
+
+  NSUInteger sampleCount = MAX(run.samples, 1);
+  double* samples = malloc(sampleCount * sizeof(double));
+  uint64_t totalIterations = 0;
+  uint64_t allocations = 0;
+  for (NSUInteger sample = 0; sample < sampleCount; sample++) {
+    uint64_t iterations = 0;
+    double seconds = 0;
+    while (seconds < run.minTime || iterations == 0) {
+      @autoreleasepool {
+        id inputs = setup != nil ? setup(batch) : nil;
+        uint64_t allocationsBefore = PBBenchmarkAllocationCount();
+        double start = Now();
+        for (NSUInteger i = 0; i < batch; i++) {
+          operation(inputs, i);
+        }
+        seconds += Now() - start;
+        allocations += PBBenchmarkAllocationCount() - allocationsBefore;
+        iterations += batch;
+      }
+    }
+    samples[sample] = seconds * 1e9 / iterations;
+    totalIterations += iterations;
+  }
+
+  double nanoseconds = PBBenchmarkMedian(samples, sampleCount);
+
+  printf("%s\n    {\"payload\": ", run.printedResult ? "," : "");
+  PrintJSONString(payloadName);
+  printf(", \"case\": ");
+  PrintJSONString(name);
+  printf(", \"bytes\": %lu, \"iterations\": %llu, \"ns_per_op\": %.1f, \"mb_per_s\": %.2f, \"allocs_per_op\": %.2f, \"samples\": [",
+         (unsigned long)bytes,
+         (unsigned long long)totalIterations,
+         nanoseconds,
+         bytes * 1e9 / (nanoseconds * 1024 * 1024),
+         allocations / (double)totalIterations);
+  for (NSUInteger sample = 0; sample < sampleCount; sample++) {
+    printf("%s%.1f", sample == 0 ? "" : ", ", samples[sample]);
+  }
+  printf("]}");
+  fflush(stdout);
+  free(samples);
+  run.printedResult = YES;
+}
+
+
+static void RunPayload(PBBenchmarkRun* run, PBBenchmarkPayload* payload, NSArray* order) {
+  PBGeneratedMessage* message = payload.message;
+  NSData* data = payload.data;
+  PBGeneratedMessage* (^parse)(NSData*) = payload.parse;
+  PBGeneratedMessage* (^merge)(PBGeneratedMessage*) = payload.merge;
+
+  // An equal message that is not the same object, so isEqual: compares fields.
+  PBGeneratedMessage* copy = parse(data);
+  [message serializedSize];
+
+  NSMutableDictionary* operations = [NSMutableDictionary dictionaryWithDictionary:@{
+    @"parse": ^(id inputs, NSUInteger index) {
+      parse(data);
+    },
+    @"serialize": ^(id inputs, NSUInteger index) {
+      [message data];
+    },
+    @"serializedSize": ^(id inputs, NSUInteger index) {
+      [[inputs objectAtIndex:index] serializedSize];
+    },
+    @"mergeFrom": ^(id inputs, NSUInteger index) {
+      merge(message);
+    },
+    @"isEqual": ^(id inputs, NSUInteger index) {
+      if (![message isEqual:copy]) {
+        abort();
+      }
+    },
+    @"hash": ^(id inputs, NSUInteger index) {
+      [message hash];
+    },
+    @"description": ^(id inputs, NSUInteger index) {
+      [message description];
+    },
+  }];
+  if ([message respondsToSelector:@selector(pooledData)]) {
+    [operations setObject:^(id inputs, NSUInteger index) {
+      // Released right away, so its buffer is back in the pool for the next one.
+      @autoreleasepool {
+        [(id<PBBenchmarkPooledData>)message pooledData];
+      }
+    } forKey:@"pooledData"];
+  }
+  PBBenchmarkSetup freshCopies = ^id(NSUInteger count) {
+    NSMutableArray* copies = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+      [copies addObject:parse(data)];
+    }
+    return copies;
+  };
+
+  for (NSString* name in order) {
+    if ([operations objectForKey:name] == nil) {
+      continue;
+    }
+    BOOL fresh = [name isEqualToString:@"serializedSize"];
+    RunCase(run, payload.name, name, data.length,
+            fresh ? kMaxFreshCopies : kMaxBatch,
+            fresh ? freshCopies : nil,
+            [operations objectForKey:name]);
+  }
+}
+
+
+static NSData* Encode(void (^write)(PBCodedOutputStream* output)) {
+  NSOutputStream* memory = [NSOutputStream outputStreamToMemory];
+  [memory open];
+  PBCodedOutputStream* output = [PBCodedOutputStream streamWithOutputStream:memory];
+  write(output);
+  [output flush];
+  NSData* data = [memory propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+  [memory close];
+  return data;
+}
+
+
+// Mixes every encoded length from one byte up, 64-bit values including negative ones.
+static int64_t MixedValue(int32_t i) {
+  uint64_t bits = (uint64_t)(i + 1) * 0x9E3779B97F4A7C15ull;
+  return (int64_t)(bits >> (i % 64));
+}
+
+
+static int32_t MixedValue32(int32_t i) {
+  uint64_t bits = (uint64_t)(i + 1) * 0x9E3779B97F4A7C15ull;
+  return (int32_t)(bits >> (33 + i % 31));
+}
+
+
+/**
+ * PBCodedInputStream and PBCodedOutputStream on their own, over buffers of
+ * kCodedValues values each.  The reads run over an NSData and, for varints,
+ * over an NSInputStream as well, which refills the buffer as it goes; the
+ * writes go to a buffer of exactly the right size, as -data does, and, for
+ * varints, through the ring buffer to an NSOutputStream.
+ */
+static void RunCodedStreamCases(PBBenchmarkRun* run, NSData* golden) {
+  NSData* varints32 = Encode(^(PBCodedOutputStream* output) {
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [output writeRawVarint32:MixedValue32(i)];
+    }
+  });
+  NSData* varints64 = Encode(^(PBCodedOutputStream* output) {
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [output writeRawVarint64:MixedValue(i)];
+    }
+  });
+  NSData* doubles = Encode(^(PBCodedOutputStream* output) {
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [output writeDoubleNoTag:i * 0.37];
+    }
+  });
+  NSMutableArray* stringValues = [NSMutableArray arrayWithCapacity:kCodedValues];
+  NSString* fragments[] = { @"ascii ", @"gr\u00fc\u00dfe \u20ac " };
+  for (int32_t i = 0; i < kCodedValues; i++) {
+    NSMutableString* value = [NSMutableString string];
+    for (int32_t j = 0; j < i % 12; j++) {
+      [value appendString:fragments[(i + j) % 2]];
+    }
+    [stringValues addObject:value];
+  }
+  NSData* strings = Encode(^(PBCodedOutputStream* output) {
+    for (NSString* value in stringValues) {
+      [output writeStringNoTag:value];
+    }
+  });
+
+  NSString* payloadName = @"coded_stream";
+  RunCase(run, payloadName, @"readRawVarint32", varints32.length, kMaxBatch, nil, ^(id inputs, NSUInteger index) {
+    PBCodedInputStream* input = [PBCodedInputStream streamWithData:varints32];
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [input readRawVarint32];
+    }
+  });
+  RunCase(run, payloadName, @"readRawVarint64", varints64.length, kMaxBatch, nil, ^(id inputs, NSUInteger index) {
+    PBCodedInputStream* input = [PBCodedInputStream streamWithData:varints64];
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [input readRawVarint64];
+    }
+  });
+  RunCase(run, payloadName, @"readDouble", doubles.length, kMaxBatch, nil, ^(id inputs, NSUInteger index) {
+    PBCodedInputStream* input = [PBCodedInputStream streamWithData:doubles];
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [input readDouble];
+    }
+  });
+  RunCase(run, payloadName, @"readString", strings.length, kMaxBatch, nil, ^(id inputs, NSUInteger index) {
+    PBCodedInputStream* input = [PBCodedInputStream streamWithData:strings];
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [input readString];
+    }
+  });
+  RunCase(run, payloadName, @"skipField", golden.length, kMaxBatch, nil, ^(id inputs, NSUInteger index) {
+    PBCodedInputStream* input = [PBCodedInputStream streamWithData:golden];
+    int32_t tag;
+    while ((tag = [input readTag]) != 0) {
+      [input skipField:tag];
+    }
+  });
+  RunCase(run, payloadName, @"readRawVarint32FromInputStream", varints32.length, kMaxBatch, nil, ^(id inputs, NSUInteger index) {
+    NSInputStream* stream = [NSInputStream inputStreamWithData:varints32];
+    [stream open];
+    PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:stream];
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [input readRawVarint32];
+    }
+    [stream close];
+  });
+
+  RunCase(run, payloadName, @"writeRawVarint32", varints32.length, kMaxBatch, nil, ^(id inputs, NSUInteger index) {
+    PBCodedOutputStream* output = [PBCodedOutputStream streamWithData:[NSMutableData dataWithLength:varints32.length]];
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [output writeRawVarint32:MixedValue32(i)];
+    }
+  });
+  RunCase(run, payloadName, @"writeRawVarint64", varints64.length, kMaxBatch, nil, ^(id inputs, NSUInteger index) {
+    PBCodedOutputStream* output = [PBCodedOutputStream streamWithData:[NSMutableData dataWithLength:varints64.length]];
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [output writeRawVarint64:MixedValue(i)];
+    }
+  });
+  RunCase(run, payloadName, @"writeDoubleNoTag", doubles.length, kMaxBatch, nil, ^(id inputs, NSUInteger index) {
+    PBCodedOutputStream* output = [PBCodedOutputStream streamWithData:[NSMutableData dataWithLength:doubles.length]];
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [output writeDoubleNoTag:i * 0.37];
+    }
+  });
+  RunCase(run, payloadName, @"writeStringNoTag", strings.length, kMaxBatch, nil, ^(id inputs, NSUInteger index) {
+    PBCodedOutputStream* output = [PBCodedOutputStream streamWithData:[NSMutableData dataWithLength:strings.length]];
+    for (NSString* value in stringValues) {
+      [output writeStringNoTag:value];
+    }
+  });
+  RunCase(run, payloadName, @"writeRawVarint32ToOutputStream", varints32.length, kMaxBatch, nil, ^(id inputs, NSUInteger index) {
+    NSOutputStream* memory = [NSOutputStream outputStreamToMemory];
+    [memory open];
+    PBCodedOutputStream* output = [PBCodedOutputStream streamWithOutputStream:memory];
+    for (int32_t i = 0; i < kCodedValues; i++) {
+      [output writeRawVarint32:MixedValue32(i)];
+    }
+    [output flush];
+    [memory close];
+  });
+}
+
+
+static int RunComparison(int argc, char** argv) {
+  double threshold = 5;
+  double alpha = 0.01;
+  NSMutableArray* baselinePaths = [NSMutableArray array];
+  NSMutableArray* currentPaths = [NSMutableArray array];
+  NSMutableArray* paths = nil;
+  BOOL usage = NO;
+  for (int i = 2; i < argc && !usage; i++) {
+    if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+      threshold = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--alpha") == 0 && i + 1 < argc) {
+      alpha = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--baseline") == 0) {
+      paths = baselinePaths;
+    } else if (strcmp(argv[i], "--current") == 0) {
+      paths = currentPaths;
+    } else if (paths != nil && argv[i][0] != '-') {
+      [paths addObject:[NSString stringWithUTF8String:argv[i]]];
+    } else {
+      usage = YES;
+    }
+  }
+  if (usage || baselinePaths.count == 0 || currentPaths.count == 0) {
+    fprintf(stderr, "usage: %s --compare [--threshold percent] [--alpha p] --baseline report... --current report...\n", argv[0]);
+    return 2;
+  }
+
+  int regressions = PBBenchmarkCompare(baselinePaths, currentPaths, threshold, alpha);
+  return regressions < 0 ? 2 : regressions > 0 ? 1 : 0;
+}
+
+
+int main(int argc, char** argv) {
+  @autoreleasepool {
+    if (argc > 1 && strcmp(argv[1], "--compare") == 0) {
+      return RunComparison(argc, argv);
+    }
+
+    PBBenchmarkRun* run = [[PBBenchmarkRun alloc] init];
+    run.minTime = 0.5;
+    run.samples = 1;
+    BOOL compareSuite = NO;
+#ifdef PB_BENCHMARK_DATA_DIR
+    NSString* dataDirectory = @PB_BENCHMARK_DATA_DIR;
+#else
+    NSString* dataDirectory = @".";
+#endif
+
+    for (int i = 1; i < argc; i++) {
+      if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+        run.minTime = atof(argv[++i]);
+      } else if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc) {
+        run.samples = strtoul(argv[++i], NULL, 10);
+      } else if (strcmp(argv[i], "--suite") == 0 && i + 1 < argc
+                 && (strcmp(argv[i + 1], "full") == 0 || strcmp(argv[i + 1], "compare") == 0)) {
+        compareSuite = strcmp(argv[++i], "compare") == 0;
+      } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+        run.filter = [NSString stringWithUTF8String:argv[++i]];
+      } else if (strcmp(argv[i], "--data-dir") == 0 && i + 1 < argc) {
+        dataDirectory = [NSString stringWithUTF8String:argv[++i]];
+      } else {
+        fprintf(stderr, "usage: %s [--suite full|compare] [--samples count] [--min-time seconds] [--filter text] [--data-dir dir]\n"
+                        "       %s --compare [--threshold percent] [--alpha p] --baseline report... --current report...\n",
+                argv[0], argv[0]);
+        return 2;
+      }
+    }
+
+    NSArray* payloads = MakePayloads(dataDirectory);
+    printf("{\"benchmarks\": [");
+    if (compareSuite) {
+      RunCodedStreamCases(run, [[payloads objectAtIndex:0] data]);
+      for (PBBenchmarkPayload* payload in payloads) {
+        RunPayload(run, payload, @[@"parse", @"serialize"]);
+      }
+    } else {
+      for (PBBenchmarkPayload* payload in payloads) {
+        RunPayload(run, payload, @[@"parse", @"serialize", @"pooledData", @"serializedSize", @"mergeFrom", @"isEqual", @"hash", @"description"]);
+      }
+    }
+    printf("\n]}\n");
+  }
+  return 0;
+}
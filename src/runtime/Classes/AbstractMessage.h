@@ -15,7 +15,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#import <dispatch/dispatch.h>
+
 #import "Message.h"
+#import "PBJSONWriter.h"
+#import "PBTextFormatWriter.h"
 
 /**
  * A partial implementation of the {@link Message} interface which implements
@@ -27,11 +31,62 @@
 @private
 }
 
+#ifndef PB_LITE_RUNTIME
 /**
  * Writes a string description of the message into the given mutable string
- * respecting a given indent.
+ * respecting a given indent.  The lite runtime, built with PB_LITE_RUNTIME
+ * defined, leaves out descriptions altogether, so messages fall back to
+ * NSObject's {@code -description}.
  */
 - (void)writeDescriptionTo:(NSMutableString*) output
                 withIndent:(NSString*) indent;
 
+/**
+ * Writes the same description into a {@link PBTextFormatWriter}, which is
+ * what generated messages implement and what {@code -description} uses.
+ * Messages generated before the writer existed only implement
+ * writeDescriptionTo:withIndent:, and each method falls back on the other.
+ */
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer;
+
+/**
+ * Writes the members of the message's JSON object, without the enclosing
+ * braces, into a {@link PBJSONWriter}.  Generated messages implement this,
+ * except those from files with optimize_for = CODE_SIZE, for which the
+ * default implementation throws.  Only fields that are set are written, by
+ * their lowerCamelCase JSON name; extensions and unknown fields are left out.
+ */
+- (void) writeJSONTo:(PBJSONWriter*) writer;
+
+/**
+ * Returns the message as a UTF-8 JSON object, following the proto3 JSON
+ * mapping.  {@link PBMessage_Builder#mergeFromJSON:} reads it back.
+ */
+- (NSData*) JSONData;
+#endif
+
+/**
+ * Serializes the message on a background queue and writes it to
+ * {@code channel}, then calls {@code completion} on {@code queue} with zero
+ * or the errno of the failed write.  Separate calls are not ordered with
+ * respect to each other; use a {@link PBChannelWriter} to keep a series of
+ * writes in order and bound how many are in flight.  This is for
+ * DISPATCH_IO_STREAM channels: on a DISPATCH_IO_RANDOM channel every call
+ * would write at offset zero, so use the variant that takes an offset.
+ */
+- (void) writeToChannel:(dispatch_io_t) channel
+                  queue:(dispatch_queue_t) queue
+             completion:(void (^)(int error)) completion;
+
+/**
+ * Like {@link #writeToChannel:queue:completion:}, but writes at
+ * {@code offset} into a DISPATCH_IO_RANDOM channel.  The caller places
+ * separate messages, for instance by adding up their serializedSize; a
+ * {@link PBChannelWriter} does that for a series of writes.
+ */
+- (void) writeToChannel:(dispatch_io_t) channel
+                 offset:(off_t) offset
+                  queue:(dispatch_queue_t) queue
+             completion:(void (^)(int error)) completion;
+
 @end
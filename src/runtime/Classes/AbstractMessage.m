@@ -18,6 +18,8 @@
 #import "AbstractMessage.h"
 
 #import "CodedOutputStream.h"
+#import "PBBufferPool.h"
+#import "PBChannelWriter.h"
 
 @implementation PBAbstractMessage
 
@@ -37,6 +39,20 @@
 }
 
 
+- (NSData*) pooledData {
+  int32_t size = self.serializedSize;
+  PBBufferPool* pool = [PBBufferPool currentPool];
+  NSMutableData* buffer = [pool takeBufferWithCapacity:size];
+  PBCodedOutputStream* stream = [pool takeStreamWritingToBuffer:buffer];
+  @try {
+    [self writeToCodedOutputStream:stream];
+  } @finally {
+    [pool returnStream:stream];
+  }
+  return [[PBPooledData alloc] initWithBuffer:buffer length:size];
+}
+
+
 - (BOOL) isInitialized {
   @throw [NSException exceptionWithName:@"ImproperSubclassing" reason:@"" userInfo:nil];
 }
@@ -59,6 +75,22 @@
 }
 
 
+- (void) writeToChannel:(dispatch_io_t) channel
+                  queue:(dispatch_queue_t) queue
+             completion:(void (^)(int error)) completion {
+  [self writeToChannel:channel offset:0 queue:queue completion:completion];
+}
+
+
+- (void) writeToChannel:(dispatch_io_t) channel
+                 offset:(off_t) offset
+                  queue:(dispatch_queue_t) queue
+             completion:(void (^)(int error)) completion {
+  PBChannelWriter* writer = [PBChannelWriter writerWithChannel:channel offset:offset queue:queue maxPendingWrites:1];
+  [writer writeMessage:self completion:completion];
+}
+
+
 - (id<PBMessage>) defaultInstance {
   @throw [NSException exceptionWithName:@"ImproperSubclassing" reason:@"" userInfo:nil];
 }
@@ -79,17 +111,55 @@
 }
 
 
+#ifndef PB_LITE_RUNTIME
 - (void) writeDescriptionTo:(NSMutableString*) output
                  withIndent:(NSString*) indent {
+  PBTextFormatWriter writer;
+  PBTextFormatWriterInit(&writer, indent);
+  [self writeTextFormatTo:&writer];
+  [output appendString:PBTextFormatWriterString(&writer)];
+  PBTextFormatWriterDestroy(&writer);
+}
+
+
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  SEL selector = @selector(writeDescriptionTo:withIndent:);
+  if ([self methodForSelector:selector] == [PBAbstractMessage instanceMethodForSelector:selector]) {
+    @throw [NSException exceptionWithName:@"ImproperSubclassing" reason:@"" userInfo:nil];
+  }
+  NSMutableString* output = [NSMutableString string];
+  [self writeDescriptionTo:output withIndent:PBTextFormatWriterIndent(writer)];
+  PBTextFormatWriterAppendString(writer, output);
+}
+
+
+- (void) writeJSONTo:(PBJSONWriter*) writer {
   @throw [NSException exceptionWithName:@"ImproperSubclassing" reason:@"" userInfo:nil];
 }
 
 
+- (NSData*) JSONData {
+  PBJSONWriter writer;
+  PBJSONWriterInit(&writer);
+  @try {
+    PBJSONWriteMessage(&writer, NULL, self);
+    return PBJSONWriterTakeData(&writer);
+  }
+  @finally {
+    PBJSONWriterDestroy(&writer);
+  }
+}
+
+
 - (NSString*) description {
-  NSMutableString* output = [NSMutableString string];
-  [self writeDescriptionTo:output withIndent:@""];
+  PBTextFormatWriter writer;
+  PBTextFormatWriterInit(&writer, nil);
+  [self writeTextFormatTo:&writer];
+  NSString* output = PBTextFormatWriterString(&writer);
+  PBTextFormatWriterDestroy(&writer);
   return output;
 }
+#endif
 
 
 @end
@@ -91,6 +91,39 @@
 }
 
 
+#ifndef PB_LITE_RUNTIME
+- (id<PBMessage_Builder>) mergeFromTextFormat:(NSData*) data {
+  PBTextFormatReader reader;
+  PBTextFormatReaderInit(&reader, data.bytes, data.length);
+  PBTextFormatReaderReadRootMessage(&reader, self);
+  return self;
+}
+
+
+- (id<PBMessage_Builder>) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  @throw [NSException exceptionWithName:@"ImproperSubclassing" reason:@"" userInfo:nil];
+}
+
+
+- (id<PBMessage_Builder>) mergeFromJSON:(NSData*) data {
+  PBJSONReader reader;
+  PBJSONReaderInit(&reader, data.bytes, data.length);
+  @try {
+    PBJSONReaderReadRootMessage(&reader, self);
+  }
+  @finally {
+    PBJSONReaderDestroy(&reader);
+  }
+  return self;
+}
+
+
+- (id<PBMessage_Builder>) mergeFromJSONReader:(PBJSONReader*) reader {
+  @throw [NSException exceptionWithName:@"ImproperSubclassing" reason:@"" userInfo:nil];
+}
+#endif
+
+
 - (id<PBMessage>) build {
   @throw [NSException exceptionWithName:@"ImproperSubclassing" reason:@"" userInfo:nil];
 }
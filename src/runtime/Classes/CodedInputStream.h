@@ -16,9 +16,43 @@
 // limitations under the License.
 
 @class PBExtensionRegistry;
+@class ReadAheadBuffer;
 @class PBUnknownFieldSet_Builder;
 @protocol PBMessage_Builder;
 
+#ifdef PB_STREAM_STATISTICS
+/**
+ * What a PBCodedInputStream has done so far, to tell streams that wait on
+ * their input (many refills for few bytes) from streams that spend their
+ * time decoding.  Only kept when the runtime is built with
+ * PB_STREAM_STATISTICS defined; otherwise none of it is compiled in.
+ */
+typedef struct {
+  /** Bytes read past, including skipped ones, since the stream was made. */
+  int64_t bytesConsumed;
+
+  /** Calls to refillBuffer:, including the ones isAtEnd makes at the end. */
+  int64_t refillCalls;
+
+  /** The most limits pushed with pushLimit: at once. */
+  int32_t maxLimitDepth;
+
+  /** Unknown fields read into an unknown field set, nested ones included. */
+  int64_t unknownFields;
+
+  /** Bytes passed over by skipRawData:, and so by skipField:. */
+  int64_t skippedBytes;
+
+  /** Non-empty strings allocated by readString, and their UTF-8 bytes. */
+  int64_t stringCount;
+  int64_t stringBytes;
+
+  /** Data objects allocated by readData, and their bytes. */
+  int64_t dataCount;
+  int64_t dataBytes;
+} PBCodedInputStreamStatistics;
+#endif
+
 /**
  * Reads and decodes protocol message fields.
  *
@@ -38,6 +72,7 @@
   int32_t bufferSizeAfterLimit;
   int32_t bufferPos;
   NSInputStream* input;
+  ReadAheadBuffer* reader;
   int32_t lastTag;
 
   /**
@@ -56,11 +91,55 @@
 
   /** See setSizeLimit() */
   int32_t sizeLimit;
+
+  /**
+   * While reading a checksummed record, the CRC32C of the bytes consumed
+   * before {@code checksumPos} in the current buffer.
+   */
+  BOOL checksumming;
+  uint32_t checksum;
+  int32_t checksumPos;
+
+#ifdef PB_STREAM_STATISTICS
+  PBCodedInputStreamStatistics statistics;
+  /** Bytes consumed before the last resetSizeCounter. */
+  int64_t bytesBeforeSizeReset;
+  int32_t limitDepth;
+#endif
 }
 
 + (PBCodedInputStream*) streamWithData:(NSData*) data;
 + (PBCodedInputStream*) streamWithInputStream:(NSInputStream*) input;
 
+/**
+ * Create a stream reading from {@code input} through a buffer of
+ * {@code bufferSize} bytes instead of the default 4K.  Fields at least as
+ * large as the buffer are read straight into their destination.
+ */
++ (PBCodedInputStream*) streamWithInputStream:(NSInputStream*) input bufferSize:(int32_t) bufferSize;
+
+/**
+ * Create a stream reading from a file descriptor with read(2) through a
+ * 64K buffer.  The descriptor is not closed by the stream, and must stay
+ * open until the stream is released.
+ */
++ (PBCodedInputStream*) streamWithFileDescriptor:(int) fileDescriptor;
+
+/**
+ * Create a stream reading from a file descriptor through buffers of
+ * {@code bufferSize} bytes.  If {@code readAhead} is YES a background
+ * thread reads the next buffer while the current one is being decoded, so
+ * parsing overlaps disk or pipe I/O.  Skipping fields seeks over them when
+ * the descriptor is seekable and there is no read-ahead thread.
+ *
+ * The descriptor must not be closed until the stream is deallocated.  With
+ * read-ahead, deallocation waits for the thread's read(2) in progress, so
+ * the thread never reads from a descriptor number that has been reused.
+ */
++ (PBCodedInputStream*) streamWithFileDescriptor:(int) fileDescriptor
+                                      bufferSize:(int32_t) bufferSize
+                                       readAhead:(BOOL) readAhead;
+
 /**
  * Attempt to read a field tag, returning zero if we have reached EOF.
  * Protocol message parsers use this to read tags, since a protocol message
@@ -137,6 +216,14 @@
 - (void) popLimit:(int32_t) oldLimit;
 - (int32_t) bytesUntilLimit;
 
+#ifdef PB_STREAM_STATISTICS
+/** A copy of the stream's counters as they are now. */
+- (PBCodedInputStreamStatistics) statistics;
+
+/** Called by PBUnknownFieldSet_Builder for each unknown field it reads. */
+- (void) countUnknownField;
+#endif
+
 
 /** Read an embedded message field value from the stream. */
 - (void) readMessage:(id<PBMessage_Builder>) builder extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
@@ -145,6 +232,19 @@
 - (NSString*) readString;
 - (NSData*) readData;
 
+/**
+ * Reads a record written by {@code -[PBCodedOutputStream writeRecord:checksum:]}
+ * into {@code builder}, returning NO if the input has ended instead.  With
+ * {@code checksum} the CRC32C is accumulated over each buffer as it is
+ * consumed and compared at the end of the record.
+ *
+ * @throws InvalidProtocolBuffer The record is malformed or its checksum
+ *                                        does not match.
+ */
+- (BOOL) readRecord:(id<PBMessage_Builder>) builder
+  extensionRegistry:(PBExtensionRegistry*) extensionRegistry
+           checksum:(BOOL) checksum;
+
 - (void) readGroup:(int32_t) fieldNumber builder:(id<PBMessage_Builder>) builder extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
 /**
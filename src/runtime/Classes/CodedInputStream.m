@@ -18,6 +18,7 @@
 #import "CodedInputStream.h"
 
 #import "Message_Builder.h"
+#import "ReadAheadBuffer.h"
 #import "Utilities.h"
 #import "WireFormat.h"
 #import "UnknownFieldSet_Builder.h"
@@ -25,6 +26,11 @@
 @interface PBCodedInputStream ()
 @property (strong) NSMutableData* buffer;
 @property (strong) NSInputStream* input;
+@property (strong) ReadAheadBuffer* reader;
+- (void) checkRawDataSize:(int32_t) size;
+- (void) readRawBytes:(uint8_t*) bytes size:(int32_t) size;
+- (BOOL) seekInput:(int32_t) count;
+- (void) updateChecksumTo:(int32_t) end;
 @end
 
 
@@ -33,12 +39,15 @@
 const int32_t DEFAULT_RECURSION_LIMIT = 64;
 const int32_t DEFAULT_SIZE_LIMIT = 64 << 20;  // 64MB
 const int32_t BUFFER_SIZE = 4096;
+const int32_t FILE_DESCRIPTOR_BUFFER_SIZE = 64 << 10;  // 64K
 
 @synthesize buffer;
 @synthesize input;
+@synthesize reader;
 
 - (void) dealloc {
   [input close];
+  [reader close];
 }
 
 
@@ -62,8 +71,16 @@ const int32_t BUFFER_SIZE = 4096;
 
 
 - (id) initWithInputStream:(NSInputStream*) input_ {
+  return [self initWithInputStream:input_ bufferSize:BUFFER_SIZE];
+}
+
+
+- (id) initWithInputStream:(NSInputStream*) input_ bufferSize:(int32_t) bufferSize_ {
+  if (bufferSize_ <= 0) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Buffer size must be positive" userInfo:nil];
+  }
   if ((self = [super init])) {
-    self.buffer = [NSMutableData dataWithLength:BUFFER_SIZE];
+    self.buffer = [NSMutableData dataWithLength:bufferSize_];
     bufferSize = 0;
     self.input = input_;
     [input open];
@@ -74,6 +91,23 @@ const int32_t BUFFER_SIZE = 4096;
 }
 
 
+- (id) initWithFileDescriptor:(int) fileDescriptor bufferSize:(int32_t) bufferSize_ readAhead:(BOOL) readAhead {
+  if (bufferSize_ <= 0) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Buffer size must be positive" userInfo:nil];
+  }
+  if ((self = [super init])) {
+    self.buffer = [NSMutableData dataWithLength:bufferSize_];
+    bufferSize = 0;
+    self.reader = [[ReadAheadBuffer alloc] initWithFileDescriptor:fileDescriptor
+                                                       bufferSize:bufferSize_
+                                                        readAhead:readAhead];
+    [self commonInit];
+  }
+
+  return self;
+}
+
+
 + (PBCodedInputStream*) streamWithData:(NSData*) data {
   return [[PBCodedInputStream alloc] initWithData:data];
 }
@@ -84,6 +118,27 @@ const int32_t BUFFER_SIZE = 4096;
 }
 
 
++ (PBCodedInputStream*) streamWithInputStream:(NSInputStream*) input bufferSize:(int32_t) bufferSize {
+  return [[PBCodedInputStream alloc] initWithInputStream:input bufferSize:bufferSize];
+}
+
+
++ (PBCodedInputStream*) streamWithFileDescriptor:(int) fileDescriptor {
+  return [[PBCodedInputStream alloc] initWithFileDescriptor:fileDescriptor
+                                                 bufferSize:FILE_DESCRIPTOR_BUFFER_SIZE
+                                                  readAhead:NO];
+}
+
+
++ (PBCodedInputStream*) streamWithFileDescriptor:(int) fileDescriptor
+                                      bufferSize:(int32_t) bufferSize
+                                       readAhead:(BOOL) readAhead {
+  return [[PBCodedInputStream alloc] initWithFileDescriptor:fileDescriptor
+                                                 bufferSize:bufferSize
+                                                  readAhead:readAhead];
+}
+
+
 /**
  * Attempt to read a field tag, returning zero if we have reached EOF.
  * Protocol message parsers use this to read tags, since a protocol message
@@ -213,22 +268,59 @@ const int32_t BUFFER_SIZE = 4096;
 }
 
 
+/**
+ * Builds a string from UTF-8 bytes, returning nil if they are malformed.
+ * The bytes are validated up front so that pure ASCII, the common case,
+ * can use the 8-bit encoding which Foundation stores without transcoding.
+ */
+static NSString* decodeUTF8String(const uint8_t* bytes, int32_t length) {
+  BOOL isASCII;
+  if (!isValidUTF8(bytes, length, &isASCII)) {
+    return nil;
+  }
+  return [[NSString alloc] initWithBytes:bytes
+                                  length:length
+                                encoding:(isASCII ? NSASCIIStringEncoding : NSUTF8StringEncoding)];
+}
+
+
 /** Read a {@code string} field value from the stream. */
 - (NSString*) readString {
   int32_t size = [self readRawVarint32];
+#ifdef PB_STREAM_STATISTICS
+  if (size > 0) {
+    statistics.stringCount++;
+    statistics.stringBytes += size;
+  }
+#endif
   if (size <= (bufferSize - bufferPos) && size > 0) {
     // Fast path:  We already have the bytes in a contiguous buffer, so
     //   just copy directly from it.
-    //  new String(buffer, bufferPos, size, "UTF-8");
-    NSString* result = [[NSString alloc] initWithBytes:(((uint8_t*) buffer.bytes) + bufferPos)
-                                                 length:size
-                                               encoding:NSUTF8StringEncoding] ;
+    NSString* result = decodeUTF8String(((uint8_t*) buffer.bytes) + bufferPos, size);
     bufferPos += size;
     return result;
+  } else if (size == 0) {
+    return @"";
   } else {
-    // Slow path:  Build a byte array first then copy it.
-    NSData* data = [self readRawData:size];
-    return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding] ;
+    // Slow path:  Read the bytes into a buffer which the string then takes
+    //   ownership of, so they are only copied once.
+    [self checkRawDataSize:size];
+    uint8_t* bytes = malloc(size);
+    @try {
+      [self readRawBytes:bytes size:size];
+    } @catch (NSException* exception) {
+      free(bytes);
+      @throw exception;
+    }
+    BOOL isASCII;
+    if (!isValidUTF8(bytes, size, &isASCII)) {
+      free(bytes);
+      return nil;
+    }
+    return [[NSString alloc] initWithBytesNoCopy:bytes
+                                          length:size
+                                        encoding:(isASCII ? NSASCIIStringEncoding : NSUTF8StringEncoding)
+                                    freeWhenDone:YES];
   }
 }
 
@@ -279,9 +371,55 @@ const int32_t BUFFER_SIZE = 4096;
 }
 
 
+/**
+ * Folds the bytes of the current buffer from {@code checksumPos} up to
+ * {@code end} into the record checksum, if one is being computed.
+ */
+- (void) updateChecksumTo:(int32_t) end {
+  if (checksumming) {
+    checksum = computeCRC32C(checksum, ((uint8_t*) buffer.bytes) + checksumPos, end - checksumPos);
+  }
+  checksumPos = end;
+}
+
+
+- (BOOL) readRecord:(id<PBMessage_Builder>) builder
+  extensionRegistry:(PBExtensionRegistry*) extensionRegistry
+           checksum:(BOOL) checksum_ {
+  if (self.isAtEnd) {
+    return NO;
+  }
+  if (!checksum_) {
+    [self readMessage:builder extensionRegistry:extensionRegistry];
+    return YES;
+  }
+
+  checksumming = YES;
+  checksum = 0;
+  checksumPos = bufferPos;
+  @try {
+    [self readMessage:builder extensionRegistry:extensionRegistry];
+    [self updateChecksumTo:bufferPos];
+  } @finally {
+    checksumming = NO;
+  }
+
+  if ((uint32_t)[self readRawLittleEndian32] != checksum) {
+    @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"checksumMismatch" userInfo:nil];
+  }
+  return YES;
+}
+
+
 /** Read a {@code bytes} field value from the stream. */
 - (NSData*) readData {
   int32_t size = [self readRawVarint32];
+#ifdef PB_STREAM_STATISTICS
+  if (size >= 0) {
+    statistics.dataCount++;
+    statistics.dataBytes += size;
+  }
+#endif
   if (size < bufferSize - bufferPos && size > 0) {
     // Fast path:  We already have the bytes in a contiguous buffer, so
     //   just copy directly from it.
@@ -289,7 +427,7 @@ const int32_t BUFFER_SIZE = 4096;
     bufferPos += size;
     return result;
   } else {
-    // Slow path:  Build a byte array first then copy it.
+    // Slow path:  readRawData: fills the result in place.
     return [self readRawData:size];
   }
 }
@@ -469,6 +607,9 @@ const int32_t BUFFER_SIZE = 4096;
  * Resets the current size counter to zero (see {@link #setSizeLimit(int)}).
  */
 - (void) resetSizeCounter {
+#ifdef PB_STREAM_STATISTICS
+  bytesBeforeSizeReset += totalBytesRetired;
+#endif
   totalBytesRetired = 0;
 }
 
@@ -489,6 +630,9 @@ const int32_t BUFFER_SIZE = 4096;
     @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"truncatedMessage" userInfo:nil];
   }
   currentLimit = byteLimit;
+#ifdef PB_STREAM_STATISTICS
+  statistics.maxLimitDepth = MAX(statistics.maxLimitDepth, ++limitDepth);
+#endif
 
   [self recomputeBufferSizeAfterLimit];
 
@@ -516,6 +660,9 @@ const int32_t BUFFER_SIZE = 4096;
  */
 - (void) popLimit:(int32_t) oldLimit {
   currentLimit = oldLimit;
+#ifdef PB_STREAM_STATISTICS
+  limitDepth--;
+#endif
   [self recomputeBufferSizeAfterLimit];
 }
 
@@ -551,6 +698,9 @@ const int32_t BUFFER_SIZE = 4096;
  * refillBuffer() returns NO if no more bytes were available.
  */
 - (BOOL) refillBuffer:(BOOL) mustSucceed {
+#ifdef PB_STREAM_STATISTICS
+  statistics.refillCalls++;
+#endif
   if (bufferPos < bufferSize) {
     @throw [NSException exceptionWithName:@"IllegalState" reason:@"refillBuffer called when buffer wasn't empty." userInfo:nil];
   }
@@ -564,14 +714,18 @@ const int32_t BUFFER_SIZE = 4096;
     }
   }
 
+  [self updateChecksumTo:bufferPos];
   totalBytesRetired += bufferSize;
 
   // TODO(cyrusn): does NSInputStream behave the same as java.io.InputStream
   // when there is no more data?
   bufferPos = 0;
   bufferSize = 0;
+  checksumPos = 0;
   if (input != nil) {
     bufferSize = [input read:buffer.mutableBytes maxLength:buffer.length];
+  } else if (reader != nil) {
+    self.buffer = [reader exchangeBuffer:buffer length:&bufferSize];
   }
 
   if (bufferSize <= 0) {
@@ -608,12 +762,17 @@ const int32_t BUFFER_SIZE = 4096;
 
 
 /**
- * Read a fixed size of bytes from the input.
+ * Checks that {@code size} more bytes may be read, before anything is
+ * allocated to hold them.  The size comes directly from the input, so a
+ * maliciously-crafted message could provide a bogus very large size in order
+ * to trick the app into allocating a lot of memory.  The size must fit within
+ * the current limit and, when reading from an {@code NSInputStream}, within
+ * the size limit; raw data streams can never hold more than their buffer.
  *
  * @throws InvalidProtocolBufferException The end of the stream or the current
  *                                        limit was reached.
  */
-- (NSData*) readRawData:(int32_t) size {
+- (void) checkRawDataSize:(int32_t) size {
   if (size < 0) {
     @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"negativeSize" userInfo:nil];
   }
@@ -625,95 +784,100 @@ const int32_t BUFFER_SIZE = 4096;
     @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"truncatedMessage" userInfo:nil];
   }
 
+  if (size <= bufferSize - bufferPos) {
+    return;
+  }
+
+  if (input == nil && reader == nil) {
+    @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"truncatedMessage" userInfo:nil];
+  }
+
+  if (size > sizeLimit - (totalBytesRetired + bufferPos)) {
+    @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"sizeLimitExceeded" userInfo:nil];
+  }
+}
+
+
+/**
+ * Reads {@code size} bytes into {@code bytes}, which the caller has already
+ * checked with {@code checkRawDataSize:}.
+ */
+- (void) readRawBytes:(uint8_t*) bytes size:(int32_t) size {
   if (size <= bufferSize - bufferPos) {
     // We have all the bytes we need already.
-    NSData* data = [NSData dataWithBytes:(((int8_t*) buffer.bytes) + bufferPos) length:size];
+    memcpy(bytes, ((uint8_t*) buffer.bytes) + bufferPos, size);
     bufferPos += size;
-    return data;
-  } else if (size < BUFFER_SIZE) {
-    // Reading more bytes than are in the buffer, but not an excessive number
-    // of bytes.  We can safely allocate the resulting array ahead of time.
+    return;
+  }
 
-    // First copy what we have.
-    NSMutableData* bytes = [NSMutableData dataWithLength:size];
-    int32_t pos = bufferSize - bufferPos;
-    memcpy(bytes.mutableBytes, ((int8_t*)buffer.bytes) + bufferPos, pos);
-    bufferPos = bufferSize;
+  // First copy what we have.
+  int32_t pos = bufferSize - bufferPos;
+  memcpy(bytes, ((uint8_t*) buffer.bytes) + bufferPos, pos);
+  bufferPos = bufferSize;
 
+  if (size < (int32_t) buffer.length || input == nil) {
+    // Reading more bytes than are in the buffer, but fewer than it holds,
+    // or reading from a file descriptor whose buffers are already large.
     // We want to use refillBuffer() and then copy from the buffer into our
     // byte array rather than reading directly into our byte array because
     // the input may be unbuffered.
     [self refillBuffer:YES];
 
     while (size - pos > bufferSize) {
-      memcpy(((int8_t*)bytes.mutableBytes) + pos, buffer.bytes, bufferSize);
+      memcpy(bytes + pos, buffer.bytes, bufferSize);
       pos += bufferSize;
       bufferPos = bufferSize;
       [self refillBuffer:YES];
     }
 
-    memcpy(((int8_t*)bytes.mutableBytes) + pos, buffer.bytes, size - pos);
+    memcpy(bytes + pos, buffer.bytes, size - pos);
     bufferPos = size - pos;
-
-    return bytes;
   } else {
-    // The size is very large.  For security reasons, we can't allocate the
-    // entire byte array yet.  The size comes directly from the input, so a
-    // maliciously-crafted message could provide a bogus very large size in
-    // order to trick the app into allocating a lot of memory.  We avoid this
-    // by allocating and reading only a small chunk at a time, so that the
-    // malicious message must actuall* e* extremely large to cause
-    // problems.  Meanwhile, we limit the allowed size of a message elsewhere.
-
-    // Remember the buffer markers since we'll have to copy the bytes out of
-    // it later.
-    int32_t originalBufferPos = bufferPos;
-    int32_t originalBufferSize = bufferSize;
-
-    // Mark the current buffer consumed.
+    // The field is at least as large as the buffer.  Going through the
+    // buffer would only add a copy, so read the rest straight into the
+    // destination.  Mark the current buffer consumed first.
+    [self updateChecksumTo:bufferSize];
     totalBytesRetired += bufferSize;
     bufferPos = 0;
     bufferSize = 0;
+    checksumPos = 0;
 
-    // Read all the rest of the bytes we need.
-    int32_t sizeLeft = size - (originalBufferSize - originalBufferPos);
-    NSMutableArray* chunks = [NSMutableArray array];
-
-    while (sizeLeft > 0) {
-      NSMutableData* chunk = [NSMutableData dataWithLength:MIN(sizeLeft, BUFFER_SIZE)];
-
-      int32_t pos = 0;
-      while (pos < chunk.length) {
-        int32_t n = 0;
-        if (input != nil) {
-          n = [input read:(((uint8_t*) chunk.mutableBytes) + pos) maxLength:chunk.length - pos];
-        }
-        if (n <= 0) {
-          @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"truncatedMessage" userInfo:nil];
-        }
-        totalBytesRetired += n;
-        pos += n;
+    while (pos < size) {
+      int32_t n = (int32_t)[input read:(bytes + pos) maxLength:(size - pos)];
+      if (n <= 0) {
+        @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"truncatedMessage" userInfo:nil];
       }
-      sizeLeft -= chunk.length;
-      [chunks addObject:chunk];
+      if (checksumming) {
+        checksum = computeCRC32C(checksum, bytes + pos, n);
+      }
+      totalBytesRetired += n;
+      pos += n;
     }
+  }
+}
 
-    // OK, got everything.  Now concatenate it all into one buffer.
-    NSMutableData* bytes = [NSMutableData dataWithLength:size];
-
-    // Start by copying the leftover bytes from this.buffer.
-    int32_t pos = originalBufferSize - originalBufferPos;
-    memcpy(bytes.mutableBytes, ((int8_t*)buffer.bytes) + originalBufferPos, pos);
 
-    // And now all the chunks.
-    for (NSData* chunk in chunks) {
-      memcpy(((int8_t*)bytes.mutableBytes) + pos, chunk.bytes, chunk.length);
-      pos += chunk.length;
-    }
+/**
+ * Read a fixed size of bytes from the input.  The result is allocated once,
+ * after its size has been checked against the current and size limits, and
+ * filled in place.
+ *
+ * @throws InvalidProtocolBufferException The end of the stream or the current
+ *                                        limit was reached.
+ */
+- (NSData*) readRawData:(int32_t) size {
+  [self checkRawDataSize:size];
 
-    // Done.
-    return bytes;
+  if (size <= bufferSize - bufferPos) {
+    // We have all the bytes we need already.
+    NSData* data = [NSData dataWithBytes:(((int8_t*) buffer.bytes) + bufferPos) length:size];
+    bufferPos += size;
+    return data;
   }
+
+  NSMutableData* bytes = [NSMutableData dataWithLength:size];
+  [self readRawBytes:bytes.mutableBytes size:size];
+  return bytes;
 }
 
 
@@ -734,6 +898,9 @@ const int32_t BUFFER_SIZE = 4096;
     // Then fail.
     @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"truncatedMessage" userInfo:nil];
   }
+#ifdef PB_STREAM_STATISTICS
+  statistics.skippedBytes += size;
+#endif
 
   if (size <= (bufferSize - bufferPos)) {
     // We have all the bytes we need already.
@@ -741,17 +908,44 @@ const int32_t BUFFER_SIZE = 4096;
   } else {
     // Skipping more bytes than are in the buffer.  First skip what we have.
     int32_t pos = bufferSize - bufferPos;
-    totalBytesRetired += pos;
+    [self updateChecksumTo:bufferSize];
+    totalBytesRetired += bufferSize;
     bufferPos = 0;
     bufferSize = 0;
+    checksumPos = 0;
+
+    if (reader != nil) {
+      // Seek over the rest if the descriptor allows it, otherwise refill
+      // and discard whole buffers until the last one, which is kept.
+      // Checksummed bytes have to be read.
+      if (!checksumming && [reader skip:size - pos]) {
+        totalBytesRetired += size - pos;
+        return;
+      }
+      while (pos < size) {
+        [self refillBuffer:YES];
+        bufferPos = MIN(bufferSize, size - pos);
+        pos += bufferPos;
+      }
+      return;
+    }
 
-    // Then skip directly from the InputStream for the rest.
+    // Then skip directly from the InputStream for the rest.  Seek over the
+    // bytes if it can, otherwise read them into our own buffer, which is
+    // empty now, and discard them.
+    if (input != nil && !checksumming && [self seekInput:size - pos]) {
+      totalBytesRetired += size - pos;
+      return;
+    }
     while (pos < size) {
-      NSMutableData* data = [NSMutableData dataWithLength:(size - pos)];
-      int32_t n = (input == nil) ? -1 : (int32_t)[input read:data.mutableBytes maxLength:(size - pos)];
+      int32_t n = (input == nil) ? -1 : (int32_t)[input read:buffer.mutableBytes
+                                                   maxLength:MIN(size - pos, (int32_t) buffer.length)];
       if (n <= 0) {
         @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"truncatedMessage" userInfo:nil];
       }
+      if (checksumming) {
+        checksum = computeCRC32C(checksum, buffer.bytes, n);
+      }
       pos += n;
       totalBytesRetired += n;
     }
@@ -759,5 +953,39 @@ const int32_t BUFFER_SIZE = 4096;
 }
 
 
+/**
+ * Moves a file-backed input forward by {@code count} bytes without reading
+ * them, returning NO if the input can't seek.  The last skipped byte is read
+ * so that skipping past the end of the file still fails as truncation.
+ */
+- (BOOL) seekInput:(int32_t) count {
+  NSNumber* offset = [input propertyForKey:NSStreamFileCurrentOffsetKey];
+  if (offset == nil) {
+    return NO;
+  }
+  NSNumber* target = [NSNumber numberWithLongLong:offset.longLongValue + count - 1];
+  if (![input setProperty:target forKey:NSStreamFileCurrentOffsetKey]) {
+    return NO;
+  }
+  uint8_t last;
+  if ([input read:&last maxLength:1] != 1) {
+    @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"truncatedMessage" userInfo:nil];
+  }
+  return YES;
+}
+
+
+#ifdef PB_STREAM_STATISTICS
+- (PBCodedInputStreamStatistics) statistics {
+  PBCodedInputStreamStatistics result = statistics;
+  result.bytesConsumed = bytesBeforeSizeReset + totalBytesRetired + bufferPos;
+  return result;
+}
+
+
+- (void) countUnknownField {
+  statistics.unknownFields++;
+}
+#endif
 
 @end
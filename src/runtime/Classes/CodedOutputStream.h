@@ -32,23 +32,90 @@
 
 @class PBUnknownFieldSet;
 @class RingBuffer;
+@class WriteBehindBuffer;
 @protocol PBMessage;
 
+#ifdef PB_STREAM_STATISTICS
+/**
+ * What a PBCodedOutputStream has done so far; see
+ * PBCodedInputStreamStatistics.  Only kept when the runtime is built with
+ * PB_STREAM_STATISTICS defined.
+ */
+typedef struct {
+  /** Bytes written to the stream, whether or not they have left its buffer. */
+  int64_t bytesProduced;
+
+  /** Calls to flush. */
+  int64_t flushCalls;
+
+  /** Times the buffer was emptied into the output, by flush or when full. */
+  int64_t bufferFlushes;
+
+  /** Strings encoded to UTF-8 by writeStringNoTag:, and their UTF-8 bytes. */
+  int64_t stringCount;
+  int64_t stringBytes;
+
+  /** Data objects written by writeDataNoTag:, and their bytes. */
+  int64_t dataCount;
+  int64_t dataBytes;
+} PBCodedOutputStreamStatistics;
+#endif
+
 @interface PBCodedOutputStream : NSObject {
     NSOutputStream *output;
+    WriteBehindBuffer *writer;
     RingBuffer *buffer;
+#ifdef PB_STREAM_STATISTICS
+    PBCodedOutputStreamStatistics statistics;
+#endif
 }
 
 + (PBCodedOutputStream*) streamWithData:(NSMutableData*) data;
+
+/**
+ * Points a stream made with {@link #streamWithData:} at the start of
+ * {@code data}, as if it had just been made for it.  This lets a stream be
+ * reused without allocating.
+ */
+- (void) resetWithData:(NSMutableData*) data;
 + (PBCodedOutputStream*) streamWithOutputStream:(NSOutputStream*) output;
 + (PBCodedOutputStream*) streamWithOutputStream:(NSOutputStream*) output bufferSize:(int32_t) bufferSize;
 
 /**
- * Flushes the stream and forces any buffered bytes to be written.  This
- * does not flush the underlying NSOutputStream. Returns free space in buffer.
+ * Create a stream writing to a file descriptor with write(2) through a
+ * buffer of {@code bufferSize} bytes.  Each write is retried until all of
+ * its bytes are written.  The descriptor is not closed by the stream.
+ */
++ (PBCodedOutputStream*) streamWithFileDescriptor:(int) fileDescriptor bufferSize:(int32_t) bufferSize;
+
+/**
+ * Like {@link #streamWithFileDescriptor:bufferSize:}.  If {@code writeBehind}
+ * is YES a background thread writes each full buffer while the next one is
+ * being encoded; {@code flush} waits for it to finish.
+ *
+ * The descriptor must not be closed until the stream is deallocated.  With
+ * write-behind, deallocation waits for the thread's write in progress, so
+ * no bytes land in a file that has since reused the descriptor number.
+ */
++ (PBCodedOutputStream*) streamWithFileDescriptor:(int) fileDescriptor
+                                       bufferSize:(int32_t) bufferSize
+                                      writeBehind:(BOOL) writeBehind;
+
+/**
+ * Flushes the stream and forces any buffered bytes to be written, retrying
+ * until the output has accepted all of them.  This does not flush the
+ * underlying NSOutputStream.
+ *
+ * @throws OutOfSpace The output stopped accepting bytes.
+ * @throws IOError Writing to the file descriptor failed.
  */
 - (void) flush;
 
+#ifdef PB_STREAM_STATISTICS
+/** A copy of the stream's counters as they are now. */
+- (PBCodedOutputStreamStatistics) statistics;
+#endif
+
 /** Write a single byte. */
 - (void) writeRawByte:(uint8_t) value;
 
@@ -113,6 +180,15 @@
 - (void) writeSInt64NoTag:(int64_t) value;
 
 
+/**
+ * Writes {@code message} as a record: its size as a varint followed by the
+ * message, as {@link #writeMessageNoTag:} does.  If {@code checksum} is YES
+ * the record ends with the CRC32C of the size and message as a
+ * little-endian 32-bit integer.  The checksum is computed over the output
+ * buffer while the bytes are still there, not in a second pass.
+ */
+- (void) writeRecord:(const id<PBMessage>) message checksum:(BOOL) checksum;
+
 /**
  * Write a MessageSet extension field to the stream.  For historical reasons,
  * the wire format differs from normal fields.
@@ -21,6 +21,7 @@
 #import "Utilities.h"
 #import "WireFormat.h"
 #import "UnknownFieldSet.h"
+#import "WriteBehindBuffer.h"
 
 
 @implementation PBCodedOutputStream
@@ -54,19 +55,86 @@ const int32_t DEFAULT_BUFFER_SIZE = 4 * 1024;
 }
 
 
-- (void)flush {
+- (void)resetWithData:(NSMutableData*)data {
+	[buffer resetWithData:data];
+}
+
+
+- (id)initWithFileDescriptor:(int)fileDescriptor bufferSize:(int32_t)bufferSize writeBehind:(BOOL)writeBehind {
+	if (bufferSize <= 0) {
+		@throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Buffer size must be positive" userInfo:nil];
+	}
+	if ( (self = [super init]) ) {
+		writer = [[WriteBehindBuffer alloc] initWithFileDescriptor:fileDescriptor bufferSize:bufferSize writeBehind:writeBehind];
+		buffer = [[RingBuffer alloc] initWithData:[NSMutableData dataWithLength:bufferSize]];
+	}
+	return self;
+}
+
+
++ (PBCodedOutputStream*)streamWithFileDescriptor:(int)fileDescriptor bufferSize:(int32_t)bufferSize {
+	return [PBCodedOutputStream streamWithFileDescriptor:fileDescriptor bufferSize:bufferSize writeBehind:NO];
+}
+
+
++ (PBCodedOutputStream*)streamWithFileDescriptor:(int)fileDescriptor bufferSize:(int32_t)bufferSize writeBehind:(BOOL)writeBehind {
+	return [[PBCodedOutputStream alloc] initWithFileDescriptor:fileDescriptor bufferSize:bufferSize writeBehind:writeBehind];
+}
+
+
+- (void)dealloc {
+	[writer close];
+}
+
+
+// Empties the buffer into the output.  A write-behind writer may still be
+// writing the bytes when this returns.
+- (void)flushBuffer {
+#ifdef PB_STREAM_STATISTICS
+	if (writer != nil || output != nil) {
+		statistics.bytesProduced += buffer.length;
+		statistics.bufferFlushes++;
+	}
+#endif
+	if (writer != nil) {
+		[buffer flushToWriter:writer];
+		return;
+	}
+
 	if (output == nil) {
 		// We're writing to a single buffer.
 		@throw [NSException exceptionWithName:@"OutOfSpace" reason:@"" userInfo:nil];
 	}
 
-	[buffer flushToOutputStream:output];
+	while (buffer.length > 0) {
+		if ([buffer flushToOutputStream:output] <= 0) {
+			@throw [NSException exceptionWithName:@"OutOfSpace" reason:@"Output stream did not accept buffered bytes" userInfo:nil];
+		}
+	}
+}
+
+
+- (void)flush {
+#ifdef PB_STREAM_STATISTICS
+	statistics.flushCalls++;
+#endif
+	[self flushBuffer];
+	[writer synchronize];
+}
+
+
+#ifdef PB_STREAM_STATISTICS
+- (PBCodedOutputStreamStatistics)statistics {
+	PBCodedOutputStreamStatistics result = statistics;
+	result.bytesProduced += buffer.length;
+	return result;
 }
+#endif
 
 
 - (void)writeRawByte:(uint8_t)value {
 	while (![buffer appendByte:value]) {
-        [self flush];
+        [self flushBuffer];
 	}
 }
 
@@ -82,7 +150,7 @@ const int32_t DEFAULT_BUFFER_SIZE = 4 * 1024;
 		offset += written;
 		length -= written;
 		if (!written || length > 0) {
-            [self flush];
+            [self flushBuffer];
 		}
 	}
 }
@@ -191,6 +259,10 @@ const int32_t DEFAULT_BUFFER_SIZE = 4 * 1024;
 
 - (void)writeStringNoTag:(const NSString*)value {
 	NSData* data = [value dataUsingEncoding:NSUTF8StringEncoding];
+#ifdef PB_STREAM_STATISTICS
+	statistics.stringCount++;
+	statistics.stringBytes += data.length;
+#endif
 	[self writeRawVarint32:data.length];
 	[self writeRawData:data];
 }
@@ -235,6 +307,17 @@ const int32_t DEFAULT_BUFFER_SIZE = 4 * 1024;
 }
 
 
+- (void)writeRecord:(const id<PBMessage>)message checksum:(BOOL)checksum {
+	if (!checksum) {
+		[self writeMessageNoTag:message];
+		return;
+	}
+	[buffer beginChecksum];
+	[self writeMessageNoTag:message];
+	[self writeRawLittleEndian32:(int32_t)[buffer endChecksum]];
+}
+
+
 /** Write an embedded message field, including tag, to the stream. */
 - (void)writeMessage:(int32_t)fieldNumber value:(const id<PBMessage>)value {
 	[self writeTag:fieldNumber format:PBWireFormatLengthDelimited];
@@ -243,6 +326,10 @@ const int32_t DEFAULT_BUFFER_SIZE = 4 * 1024;
 
 
 - (void)writeDataNoTag:(const NSData*)value {
+#ifdef PB_STREAM_STATISTICS
+	statistics.dataCount++;
+	statistics.dataBytes += value.length;
+#endif
 	[self writeRawVarint32:value.length];
 	[self writeRawData:value];
 }
@@ -346,9 +346,9 @@ int32_t typeSize(PBExtensionType type) {
 }
 
 
-- (void) writeDescriptionOfSingleValue:(id) value
-                                    to:(NSMutableString*) output
-                            withIndent:(NSString*) indent {
+#ifndef PB_LITE_RUNTIME
+- (void) writeTextFormatOfSingleValue:(id) value
+                                  to:(PBTextFormatWriter*) writer {
   switch (type) {
     case PBExtensionTypeBool:
     case PBExtensionTypeFixed32:
@@ -366,15 +366,18 @@ int32_t typeSize(PBExtensionType type) {
     case PBExtensionTypeBytes:
     case PBExtensionTypeString:
     case PBExtensionTypeEnum:
-      [output appendFormat:@"%@%@\n", indent, value];
+      PBTextFormatWriterAppendIndent(writer);
+      PBTextFormatWriterAppendObject(writer, value);
+      PBTextFormatWriterAppendBytes(writer, "\n", 1);
       return;
     case PBExtensionTypeGroup:
     case PBExtensionTypeMessage:
-      [((PBAbstractMessage *)value) writeDescriptionTo:output withIndent:indent];
+      [((PBAbstractMessage *)value) writeTextFormatTo:writer];
       return;
   }
   @throw [NSException exceptionWithName:@"InternalError" reason:@"" userInfo:nil];
 }
+#endif
 
 
 - (void)         writeRepeatedValues:(NSArray*) values
@@ -440,18 +443,19 @@ int32_t typeSize(PBExtensionType type) {
 }
 
 
-- (void) writeDescriptionOf:(id)value
-                         to:(NSMutableString *)output
-                 withIndent:(NSString *)indent {
+#ifndef PB_LITE_RUNTIME
+- (void) writeTextFormatOf:(id) value
+                        to:(PBTextFormatWriter*) writer {
   if (isRepeated) {
     NSArray* values = value;
     for (id singleValue in values) {
-      [self writeDescriptionOfSingleValue:singleValue to:output withIndent:indent];
+      [self writeTextFormatOfSingleValue:singleValue to:writer];
     }
   } else {
-    [self writeDescriptionOfSingleValue:value to:output withIndent:indent];
+    [self writeTextFormatOfSingleValue:value to:writer];
   }
 }
+#endif
 
 - (void) mergeMessageSetExtentionFromCodedInputStream:(PBCodedInputStream*) input
                                         unknownFields:(PBUnknownFieldSet_Builder*) unknownFields {
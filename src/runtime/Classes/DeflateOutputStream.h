@@ -0,0 +1,55 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <zlib.h>
+
+/**
+ * An output stream that deflates everything written to it with zlib and
+ * passes the compressed bytes on to another stream, so that a
+ * {@link PBCodedOutputStream} writing to it compresses messages while they
+ * are encoded.  Compressed bytes are written to the underlying stream in
+ * blocks of up to {@code blockSize} bytes.
+ *
+ * The compressed stream is only complete once this stream is closed, which
+ * also closes the underlying stream.  {@code flushCompressed} makes
+ * everything written so far decodable without ending the stream.
+ */
+@interface PBDeflateOutputStream : NSOutputStream {
+@private
+  NSOutputStream* output;
+  NSMutableData* block;
+  z_stream zstream;
+  int level;
+  BOOL initialized;
+  BOOL failed;
+}
+
+/**
+ * {@code level} is a zlib compression level from 0 to 9, or
+ * {@code Z_DEFAULT_COMPRESSION}.
+ */
++ (PBDeflateOutputStream*) streamWithOutputStream:(NSOutputStream*) output
+                                            level:(int) level
+                                        blockSize:(int32_t) blockSize;
+
+/**
+ * Compresses and writes out everything written so far, ending on a byte
+ * boundary.  Returns NO if the underlying stream failed.
+ */
+- (BOOL) flushCompressed;
+
+@end
@@ -0,0 +1,148 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "DeflateOutputStream.h"
+
+@implementation PBDeflateOutputStream
+
+- (id) initWithOutputStream:(NSOutputStream*) output_
+                      level:(int) level_
+                  blockSize:(int32_t) blockSize {
+  if (blockSize <= 0) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Block size must be positive" userInfo:nil];
+  }
+  if ((self = [super init])) {
+    output = output_;
+    level = level_;
+    block = [NSMutableData dataWithLength:blockSize];
+  }
+
+  return self;
+}
+
+
++ (PBDeflateOutputStream*) streamWithOutputStream:(NSOutputStream*) output
+                                            level:(int) level
+                                        blockSize:(int32_t) blockSize {
+  return [[PBDeflateOutputStream alloc] initWithOutputStream:output level:level blockSize:blockSize];
+}
+
+
+- (void) dealloc {
+  if (initialized) {
+    deflateEnd(&zstream);
+  }
+}
+
+
+- (void) open {
+  if (deflateInit(&zstream, level) != Z_OK) {
+    failed = YES;
+    return;
+  }
+  initialized = YES;
+  [output open];
+}
+
+
+/** Writes all of {@code length} bytes of the block to the underlying stream. */
+- (BOOL) writeBlock:(NSUInteger) length {
+  const uint8_t* bytes = block.bytes;
+  while (length > 0) {
+    NSInteger written = [output write:bytes maxLength:length];
+    if (written <= 0) {
+      return NO;
+    }
+    bytes += written;
+    length -= written;
+  }
+  return YES;
+}
+
+
+/**
+ * Runs deflate over the pending input with {@code flush}, writing out each
+ * block as it fills.  Stops once the input is consumed and, when flushing,
+ * deflate has nothing more to emit.
+ */
+- (BOOL) deflateWithFlush:(int) flush {
+  if (!initialized || failed) {
+    return NO;
+  }
+  while (YES) {
+    zstream.next_out = block.mutableBytes;
+    zstream.avail_out = (uInt)block.length;
+    int result = deflate(&zstream, flush);
+    if (result == Z_STREAM_ERROR) {
+      failed = YES;
+      return NO;
+    }
+    NSUInteger produced = block.length - zstream.avail_out;
+    if (produced > 0 && ![self writeBlock:produced]) {
+      failed = YES;
+      return NO;
+    }
+    if (result == Z_STREAM_END || (zstream.avail_in == 0 && zstream.avail_out > 0)) {
+      return YES;
+    }
+  }
+}
+
+
+- (NSInteger) write:(const uint8_t*) buffer maxLength:(NSUInteger) len {
+  zstream.next_in = (Bytef*)buffer;
+  zstream.avail_in = (uInt)len;
+  if (![self deflateWithFlush:Z_NO_FLUSH]) {
+    return -1;
+  }
+  return len;
+}
+
+
+- (BOOL) hasSpaceAvailable {
+  return !failed;
+}
+
+
+- (BOOL) flushCompressed {
+  zstream.avail_in = 0;
+  return [self deflateWithFlush:Z_SYNC_FLUSH];
+}
+
+
+- (void) close {
+  zstream.avail_in = 0;
+  [self deflateWithFlush:Z_FINISH];
+  [output close];
+}
+
+
+- (NSError*) streamError {
+  return failed ? [NSError errorWithDomain:@"zlib" code:Z_STREAM_ERROR userInfo:nil] : output.streamError;
+}
+
+
+- (id) propertyForKey:(NSString*) key {
+  return nil;
+}
+
+
+- (BOOL) setProperty:(id) property forKey:(NSString*) key {
+  return NO;
+}
+
+@end
@@ -76,6 +76,9 @@ typedef enum {
 } PBFieldDescriptorProto_Type;
 
 BOOL PBFieldDescriptorProto_TypeIsValidValue(PBFieldDescriptorProto_Type value);
+PBFieldDescriptorProto_Type PBFieldDescriptorProto_TypeReadTextFormat(PBTextFormatReader* reader);
+void PBFieldDescriptorProto_TypeWriteJSON(PBJSONWriter* writer, const char* name, PBFieldDescriptorProto_Type value);
+PBFieldDescriptorProto_Type PBFieldDescriptorProto_TypeReadJSON(PBJSONReader* reader);
 
 typedef enum {
   PBFieldDescriptorProto_LabelLabelOptional = 1,
@@ -84,6 +87,9 @@ typedef enum {
 } PBFieldDescriptorProto_Label;
 
 BOOL PBFieldDescriptorProto_LabelIsValidValue(PBFieldDescriptorProto_Label value);
+PBFieldDescriptorProto_Label PBFieldDescriptorProto_LabelReadTextFormat(PBTextFormatReader* reader);
+void PBFieldDescriptorProto_LabelWriteJSON(PBJSONWriter* writer, const char* name, PBFieldDescriptorProto_Label value);
+PBFieldDescriptorProto_Label PBFieldDescriptorProto_LabelReadJSON(PBJSONReader* reader);
 
 typedef enum {
   PBFileOptions_OptimizeModeSpeed = 1,
@@ -92,6 +98,9 @@ typedef enum {
 } PBFileOptions_OptimizeMode;
 
 BOOL PBFileOptions_OptimizeModeIsValidValue(PBFileOptions_OptimizeMode value);
+PBFileOptions_OptimizeMode PBFileOptions_OptimizeModeReadTextFormat(PBTextFormatReader* reader);
+void PBFileOptions_OptimizeModeWriteJSON(PBJSONWriter* writer, const char* name, PBFileOptions_OptimizeMode value);
+PBFileOptions_OptimizeMode PBFileOptions_OptimizeModeReadJSON(PBJSONReader* reader);
 
 typedef enum {
   PBFieldOptions_CTypeString = 0,
@@ -100,6 +109,9 @@ typedef enum {
 } PBFieldOptions_CType;
 
 BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value);
+PBFieldOptions_CType PBFieldOptions_CTypeReadTextFormat(PBTextFormatReader* reader);
+void PBFieldOptions_CTypeWriteJSON(PBJSONWriter* writer, const char* name, PBFieldOptions_CType value);
+PBFieldOptions_CType PBFieldOptions_CTypeReadJSON(PBJSONReader* reader);
 
 
 @interface PBDescriptorRoot : NSObject {
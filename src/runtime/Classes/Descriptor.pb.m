@@ -3,17 +3,15 @@
 #import "Descriptor.pb.h"
 
 @implementation PBDescriptorRoot
-static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
-  return extensionRegistry;
-}
-
-+ (void) initialize {
-  if (self == [PBDescriptorRoot class]) {
+  static PBExtensionRegistry* extensionRegistry = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
     PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
+    [PBDescriptorRoot registerAllExtensions:registry];
     extensionRegistry = registry;
-  }
+  });
+  return extensionRegistry;
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
 }
@@ -32,17 +30,16 @@ static PBExtensionRegistry* extensionRegistry = nil;
   }
   return self;
 }
-static PBFileDescriptorSet* defaultPBFileDescriptorSetInstance = nil;
-+ (void) initialize {
-  if (self == [PBFileDescriptorSet class]) {
-    defaultPBFileDescriptorSetInstance = [[PBFileDescriptorSet alloc] init];
-  }
-}
 + (PBFileDescriptorSet*) defaultInstance {
+  static PBFileDescriptorSet* defaultPBFileDescriptorSetInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBFileDescriptorSetInstance = [[PBFileDescriptorSet alloc] init];
+  });
   return defaultPBFileDescriptorSetInstance;
 }
 - (PBFileDescriptorSet*) defaultInstance {
-  return defaultPBFileDescriptorSetInstance;
+  return [PBFileDescriptorSet defaultInstance];
 }
 - (NSArray *)file {
   return fileArray;
@@ -137,6 +134,15 @@ static PBFileDescriptorSet* defaultPBFileDescriptorSetInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.fileArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "file");
+    for (PBFileDescriptorProto* element in self.fileArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 @interface PBFileDescriptorSet_Builder()
@@ -214,6 +220,54 @@ static PBFileDescriptorSet* defaultPBFileDescriptorSetInstance = nil;
     }
   }
 }
+- (PBFileDescriptorSet_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "file", 4) == 0) {
+          PBFileDescriptorProto_Builder* subBuilder = [PBFileDescriptorProto builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addFile:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBFileDescriptorSet_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "file", 4) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBFileDescriptorProto_Builder* subBuilder = [PBFileDescriptorProto builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addFile:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (NSMutableArray *)file {
   return result.fileArray;
 }
@@ -304,17 +358,16 @@ static PBFileDescriptorSet* defaultPBFileDescriptorSetInstance = nil;
   }
   return self;
 }
-static PBFileDescriptorProto* defaultPBFileDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBFileDescriptorProto class]) {
-    defaultPBFileDescriptorProtoInstance = [[PBFileDescriptorProto alloc] init];
-  }
-}
 + (PBFileDescriptorProto*) defaultInstance {
+  static PBFileDescriptorProto* defaultPBFileDescriptorProtoInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBFileDescriptorProtoInstance = [[PBFileDescriptorProto alloc] init];
+  });
   return defaultPBFileDescriptorProtoInstance;
 }
 - (PBFileDescriptorProto*) defaultInstance {
-  return defaultPBFileDescriptorProtoInstance;
+  return [PBFileDescriptorProto defaultInstance];
 }
 - (NSArray *)dependency {
   return dependencyArray;
@@ -646,6 +699,71 @@ static PBFileDescriptorProto* defaultPBFileDescriptorProtoInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasName) {
+    PBJSONWriteString(writer, "name", self.name);
+  }
+  if (self.hasPackage) {
+    PBJSONWriteString(writer, "package", self.package);
+  }
+  if (self.dependencyArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "dependency");
+    for (NSString* element in self.dependencyArray) {
+      PBJSONWriteString(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.messageTypeArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "messageType");
+    for (PBDescriptorProto* element in self.messageTypeArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.enumTypeArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "enumType");
+    for (PBEnumDescriptorProto* element in self.enumTypeArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.serviceArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "service");
+    for (PBServiceDescriptorProto* element in self.serviceArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.extensionArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "extension");
+    for (PBFieldDescriptorProto* element in self.extensionArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.hasOptions) {
+    PBJSONWriteMessage(writer, "options", self.options);
+  }
+  if (self.hasSourceCodeInfo) {
+    PBJSONWriteMessage(writer, "sourceCodeInfo", self.sourceCodeInfo);
+  }
+  if (self.publicDependencyArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "publicDependency");
+    NSUInteger publicDependencyArrayCount=self.publicDependencyArray.count;
+    for(NSUInteger i=0;i<publicDependencyArrayCount;i++){
+      PBJSONWriteInt32(writer, NULL, [self.publicDependencyArray int32AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.weakDependencyArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "weakDependency");
+    NSUInteger weakDependencyArrayCount=self.weakDependencyArray.count;
+    for(NSUInteger i=0;i<weakDependencyArrayCount;i++){
+      PBJSONWriteInt32(writer, NULL, [self.weakDependencyArray int32AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 @interface PBFileDescriptorProto_Builder()
@@ -833,6 +951,258 @@ static PBFileDescriptorProto* defaultPBFileDescriptorProtoInstance = nil;
     }
   }
 }
+- (PBFileDescriptorProto_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          [self setName:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "package", 7) == 0) {
+          [self setPackage:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        if (memcmp(name, "service", 7) == 0) {
+          PBServiceDescriptorProto_Builder* subBuilder = [PBServiceDescriptorProto builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addService:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "options", 7) == 0) {
+          PBFileOptions_Builder* subBuilder = [PBFileOptions builder];
+          if (self.hasOptions) {
+            [subBuilder mergeFrom:self.options];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptions:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 9:
+        if (memcmp(name, "enum_type", 9) == 0) {
+          PBEnumDescriptorProto_Builder* subBuilder = [PBEnumDescriptorProto builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addEnumType:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "extension", 9) == 0) {
+          PBFieldDescriptorProto_Builder* subBuilder = [PBFieldDescriptorProto builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addExtension:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 10:
+        if (memcmp(name, "dependency", 10) == 0) {
+          [self addDependency:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "message_type", 12) == 0) {
+          PBDescriptorProto_Builder* subBuilder = [PBDescriptorProto builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addMessageType:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 15:
+        if (memcmp(name, "weak_dependency", 15) == 0) {
+          [self addWeakDependency:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+      case 16:
+        if (memcmp(name, "source_code_info", 16) == 0) {
+          PBSourceCodeInfo_Builder* subBuilder = [PBSourceCodeInfo builder];
+          if (self.hasSourceCodeInfo) {
+            [subBuilder mergeFrom:self.sourceCodeInfo];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setSourceCodeInfo:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 17:
+        if (memcmp(name, "public_dependency", 17) == 0) {
+          [self addPublicDependency:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBFileDescriptorProto_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          number = 1;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "package", 7) == 0) {
+          number = 2;
+        } else if (memcmp(name, "service", 7) == 0) {
+          number = 6;
+        } else if (memcmp(name, "options", 7) == 0) {
+          number = 8;
+        }
+        break;
+      case 8:
+        if (memcmp(name, "enumType", 8) == 0) {
+          number = 5;
+        }
+        break;
+      case 9:
+        if (memcmp(name, "enum_type", 9) == 0) {
+          number = 5;
+        } else if (memcmp(name, "extension", 9) == 0) {
+          number = 7;
+        }
+        break;
+      case 10:
+        if (memcmp(name, "dependency", 10) == 0) {
+          number = 3;
+        }
+        break;
+      case 11:
+        if (memcmp(name, "messageType", 11) == 0) {
+          number = 4;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "message_type", 12) == 0) {
+          number = 4;
+        }
+        break;
+      case 14:
+        if (memcmp(name, "weakDependency", 14) == 0) {
+          number = 11;
+        } else if (memcmp(name, "sourceCodeInfo", 14) == 0) {
+          number = 9;
+        }
+        break;
+      case 15:
+        if (memcmp(name, "weak_dependency", 15) == 0) {
+          number = 11;
+        }
+        break;
+      case 16:
+        if (memcmp(name, "publicDependency", 16) == 0) {
+          number = 10;
+        } else if (memcmp(name, "source_code_info", 16) == 0) {
+          number = 9;
+        }
+        break;
+      case 17:
+        if (memcmp(name, "public_dependency", 17) == 0) {
+          number = 10;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setName:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 2: {
+        [self setPackage:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 3: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addDependency:PBJSONReaderReadString(reader)];
+        }
+        continue;
+      }
+      case 4: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBDescriptorProto_Builder* subBuilder = [PBDescriptorProto builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addMessageType:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 5: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBEnumDescriptorProto_Builder* subBuilder = [PBEnumDescriptorProto builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addEnumType:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 6: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBServiceDescriptorProto_Builder* subBuilder = [PBServiceDescriptorProto builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addService:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 7: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBFieldDescriptorProto_Builder* subBuilder = [PBFieldDescriptorProto builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addExtension:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 8: {
+        PBFileOptions_Builder* subBuilder = [PBFileOptions builder];
+        if (self.hasOptions) {
+          [subBuilder mergeFrom:self.options];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptions:[subBuilder buildPartial]];
+        continue;
+      }
+      case 9: {
+        PBSourceCodeInfo_Builder* subBuilder = [PBSourceCodeInfo builder];
+        if (self.hasSourceCodeInfo) {
+          [subBuilder mergeFrom:self.sourceCodeInfo];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setSourceCodeInfo:[subBuilder buildPartial]];
+        continue;
+      }
+      case 10: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPublicDependency:PBJSONReaderReadInt32(reader)];
+        }
+        continue;
+      }
+      case 11: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addWeakDependency:PBJSONReaderReadInt32(reader)];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasName {
   return result.hasName;
 }
@@ -1125,17 +1495,16 @@ static PBFileDescriptorProto* defaultPBFileDescriptorProtoInstance = nil;
   }
   return self;
 }
-static PBDescriptorProto* defaultPBDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBDescriptorProto class]) {
-    defaultPBDescriptorProtoInstance = [[PBDescriptorProto alloc] init];
-  }
-}
 + (PBDescriptorProto*) defaultInstance {
+  static PBDescriptorProto* defaultPBDescriptorProtoInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBDescriptorProtoInstance = [[PBDescriptorProto alloc] init];
+  });
   return defaultPBDescriptorProtoInstance;
 }
 - (PBDescriptorProto*) defaultInstance {
-  return defaultPBDescriptorProtoInstance;
+  return [PBDescriptorProto defaultInstance];
 }
 - (NSArray *)field {
   return fieldArray;
@@ -1369,6 +1738,49 @@ static PBDescriptorProto* defaultPBDescriptorProtoInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasName) {
+    PBJSONWriteString(writer, "name", self.name);
+  }
+  if (self.fieldArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "field");
+    for (PBFieldDescriptorProto* element in self.fieldArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.nestedTypeArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "nestedType");
+    for (PBDescriptorProto* element in self.nestedTypeArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.enumTypeArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "enumType");
+    for (PBEnumDescriptorProto* element in self.enumTypeArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.extensionRangeArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "extensionRange");
+    for (PBDescriptorProto_ExtensionRange* element in self.extensionRangeArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.extensionArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "extension");
+    for (PBFieldDescriptorProto* element in self.extensionArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.hasOptions) {
+    PBJSONWriteMessage(writer, "options", self.options);
+  }
+}
 @end
 
 @interface PBDescriptorProto_ExtensionRange ()
@@ -1399,17 +1811,16 @@ static PBDescriptorProto* defaultPBDescriptorProtoInstance = nil;
   }
   return self;
 }
-static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRangeInstance = nil;
-+ (void) initialize {
-  if (self == [PBDescriptorProto_ExtensionRange class]) {
-    defaultPBDescriptorProto_ExtensionRangeInstance = [[PBDescriptorProto_ExtensionRange alloc] init];
-  }
-}
 + (PBDescriptorProto_ExtensionRange*) defaultInstance {
+  static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRangeInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBDescriptorProto_ExtensionRangeInstance = [[PBDescriptorProto_ExtensionRange alloc] init];
+  });
   return defaultPBDescriptorProto_ExtensionRangeInstance;
 }
 - (PBDescriptorProto_ExtensionRange*) defaultInstance {
-  return defaultPBDescriptorProto_ExtensionRangeInstance;
+  return [PBDescriptorProto_ExtensionRange defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1505,6 +1916,14 @@ static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRange
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasStart) {
+    PBJSONWriteInt32(writer, "start", self.start);
+  }
+  if (self.hasEnd) {
+    PBJSONWriteInt32(writer, "end", self.end);
+  }
+}
 @end
 
 @interface PBDescriptorProto_ExtensionRange_Builder()
@@ -1583,6 +2002,62 @@ static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRange
     }
   }
 }
+- (PBDescriptorProto_ExtensionRange_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 3:
+        if (memcmp(name, "end", 3) == 0) {
+          [self setEnd:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+      case 5:
+        if (memcmp(name, "start", 5) == 0) {
+          [self setStart:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBDescriptorProto_ExtensionRange_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 3:
+        if (memcmp(name, "end", 3) == 0) {
+          number = 2;
+        }
+        break;
+      case 5:
+        if (memcmp(name, "start", 5) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setStart:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 2: {
+        [self setEnd:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasStart {
   return result.hasStart;
 }
@@ -1763,6 +2238,192 @@ static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRange
     }
   }
 }
+- (PBDescriptorProto_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          [self setName:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 5:
+        if (memcmp(name, "field", 5) == 0) {
+          PBFieldDescriptorProto_Builder* subBuilder = [PBFieldDescriptorProto builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addField:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          PBMessageOptions_Builder* subBuilder = [PBMessageOptions builder];
+          if (self.hasOptions) {
+            [subBuilder mergeFrom:self.options];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptions:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 9:
+        if (memcmp(name, "extension", 9) == 0) {
+          PBFieldDescriptorProto_Builder* subBuilder = [PBFieldDescriptorProto builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addExtension:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "enum_type", 9) == 0) {
+          PBEnumDescriptorProto_Builder* subBuilder = [PBEnumDescriptorProto builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addEnumType:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 11:
+        if (memcmp(name, "nested_type", 11) == 0) {
+          PBDescriptorProto_Builder* subBuilder = [PBDescriptorProto builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addNestedType:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 15:
+        if (memcmp(name, "extension_range", 15) == 0) {
+          PBDescriptorProto_ExtensionRange_Builder* subBuilder = [PBDescriptorProto_ExtensionRange builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addExtensionRange:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBDescriptorProto_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          number = 1;
+        }
+        break;
+      case 5:
+        if (memcmp(name, "field", 5) == 0) {
+          number = 2;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          number = 7;
+        }
+        break;
+      case 8:
+        if (memcmp(name, "enumType", 8) == 0) {
+          number = 4;
+        }
+        break;
+      case 9:
+        if (memcmp(name, "extension", 9) == 0) {
+          number = 6;
+        } else if (memcmp(name, "enum_type", 9) == 0) {
+          number = 4;
+        }
+        break;
+      case 10:
+        if (memcmp(name, "nestedType", 10) == 0) {
+          number = 3;
+        }
+        break;
+      case 11:
+        if (memcmp(name, "nested_type", 11) == 0) {
+          number = 3;
+        }
+        break;
+      case 14:
+        if (memcmp(name, "extensionRange", 14) == 0) {
+          number = 5;
+        }
+        break;
+      case 15:
+        if (memcmp(name, "extension_range", 15) == 0) {
+          number = 5;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setName:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 2: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBFieldDescriptorProto_Builder* subBuilder = [PBFieldDescriptorProto builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addField:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 3: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBDescriptorProto_Builder* subBuilder = [PBDescriptorProto builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addNestedType:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 4: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBEnumDescriptorProto_Builder* subBuilder = [PBEnumDescriptorProto builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addEnumType:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 5: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBDescriptorProto_ExtensionRange_Builder* subBuilder = [PBDescriptorProto_ExtensionRange builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addExtensionRange:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 6: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBFieldDescriptorProto_Builder* subBuilder = [PBFieldDescriptorProto builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addExtension:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 7: {
+        PBMessageOptions_Builder* subBuilder = [PBMessageOptions builder];
+        if (self.hasOptions) {
+          [subBuilder mergeFrom:self.options];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptions:[subBuilder buildPartial]];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasName {
   return result.hasName;
 }
@@ -1998,17 +2659,16 @@ static PBDescriptorProto_ExtensionRange* defaultPBDescriptorProto_ExtensionRange
   }
   return self;
 }
-static PBFieldDescriptorProto* defaultPBFieldDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBFieldDescriptorProto class]) {
-    defaultPBFieldDescriptorProtoInstance = [[PBFieldDescriptorProto alloc] init];
-  }
-}
 + (PBFieldDescriptorProto*) defaultInstance {
+  static PBFieldDescriptorProto* defaultPBFieldDescriptorProtoInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBFieldDescriptorProtoInstance = [[PBFieldDescriptorProto alloc] init];
+  });
   return defaultPBFieldDescriptorProtoInstance;
 }
 - (PBFieldDescriptorProto*) defaultInstance {
-  return defaultPBFieldDescriptorProtoInstance;
+  return [PBFieldDescriptorProto defaultInstance];
 }
 - (BOOL) isInitialized {
   if (self.hasOptions) {
@@ -2196,42 +2856,107 @@ static PBFieldDescriptorProto* defaultPBFieldDescriptorProtoInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasName) {
+    PBJSONWriteString(writer, "name", self.name);
+  }
+  if (self.hasExtendee) {
+    PBJSONWriteString(writer, "extendee", self.extendee);
+  }
+  if (self.hasNumber) {
+    PBJSONWriteInt32(writer, "number", self.number);
+  }
+  if (self.hasLabel) {
+    PBFieldDescriptorProto_LabelWriteJSON(writer, "label", self.label);
+  }
+  if (self.hasType) {
+    PBFieldDescriptorProto_TypeWriteJSON(writer, "type", self.type);
+  }
+  if (self.hasTypeName) {
+    PBJSONWriteString(writer, "typeName", self.typeName);
+  }
+  if (self.hasDefaultValue) {
+    PBJSONWriteString(writer, "defaultValue", self.defaultValue);
+  }
+  if (self.hasOptions) {
+    PBJSONWriteMessage(writer, "options", self.options);
+  }
+}
 @end
 
 BOOL PBFieldDescriptorProto_TypeIsValidValue(PBFieldDescriptorProto_Type value) {
-  switch (value) {
-    case PBFieldDescriptorProto_TypeTypeDouble:
-    case PBFieldDescriptorProto_TypeTypeFloat:
-    case PBFieldDescriptorProto_TypeTypeInt64:
-    case PBFieldDescriptorProto_TypeTypeUint64:
-    case PBFieldDescriptorProto_TypeTypeInt32:
-    case PBFieldDescriptorProto_TypeTypeFixed64:
-    case PBFieldDescriptorProto_TypeTypeFixed32:
-    case PBFieldDescriptorProto_TypeTypeBool:
-    case PBFieldDescriptorProto_TypeTypeString:
-    case PBFieldDescriptorProto_TypeTypeGroup:
-    case PBFieldDescriptorProto_TypeTypeMessage:
-    case PBFieldDescriptorProto_TypeTypeBytes:
-    case PBFieldDescriptorProto_TypeTypeUint32:
-    case PBFieldDescriptorProto_TypeTypeEnum:
-    case PBFieldDescriptorProto_TypeTypeSfixed32:
-    case PBFieldDescriptorProto_TypeTypeSfixed64:
-    case PBFieldDescriptorProto_TypeTypeSint32:
-    case PBFieldDescriptorProto_TypeTypeSint64:
-      return YES;
-    default:
-      return NO;
-  }
+  return (uint32_t)value - 1U < 18U;
+}
+static const char* const PBFieldDescriptorProto_TypeTextFormatNames[] = {
+  "TYPE_DOUBLE",
+  "TYPE_FLOAT",
+  "TYPE_INT64",
+  "TYPE_UINT64",
+  "TYPE_INT32",
+  "TYPE_FIXED64",
+  "TYPE_FIXED32",
+  "TYPE_BOOL",
+  "TYPE_STRING",
+  "TYPE_GROUP",
+  "TYPE_MESSAGE",
+  "TYPE_BYTES",
+  "TYPE_UINT32",
+  "TYPE_ENUM",
+  "TYPE_SFIXED32",
+  "TYPE_SFIXED64",
+  "TYPE_SINT32",
+  "TYPE_SINT64",
+};
+static const int32_t PBFieldDescriptorProto_TypeTextFormatValues[] = {
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  9,
+  10,
+  11,
+  12,
+  13,
+  14,
+  15,
+  16,
+  17,
+  18,
+};
+PBFieldDescriptorProto_Type PBFieldDescriptorProto_TypeReadTextFormat(PBTextFormatReader* reader) {
+  return (PBFieldDescriptorProto_Type)PBTextFormatReaderReadEnum(reader, PBFieldDescriptorProto_TypeTextFormatNames, PBFieldDescriptorProto_TypeTextFormatValues, 18);
+}
+void PBFieldDescriptorProto_TypeWriteJSON(PBJSONWriter* writer, const char* name, PBFieldDescriptorProto_Type value) {
+  PBJSONWriteEnum(writer, name, value, PBFieldDescriptorProto_TypeTextFormatNames, PBFieldDescriptorProto_TypeTextFormatValues, 18);
+}
+PBFieldDescriptorProto_Type PBFieldDescriptorProto_TypeReadJSON(PBJSONReader* reader) {
+  return (PBFieldDescriptorProto_Type)PBJSONReaderReadEnum(reader, PBFieldDescriptorProto_TypeTextFormatNames, PBFieldDescriptorProto_TypeTextFormatValues, 18);
 }
 BOOL PBFieldDescriptorProto_LabelIsValidValue(PBFieldDescriptorProto_Label value) {
-  switch (value) {
-    case PBFieldDescriptorProto_LabelLabelOptional:
-    case PBFieldDescriptorProto_LabelLabelRequired:
-    case PBFieldDescriptorProto_LabelLabelRepeated:
-      return YES;
-    default:
-      return NO;
-  }
+  return (uint32_t)value - 1U < 3U;
+}
+static const char* const PBFieldDescriptorProto_LabelTextFormatNames[] = {
+  "LABEL_OPTIONAL",
+  "LABEL_REQUIRED",
+  "LABEL_REPEATED",
+};
+static const int32_t PBFieldDescriptorProto_LabelTextFormatValues[] = {
+  1,
+  2,
+  3,
+};
+PBFieldDescriptorProto_Label PBFieldDescriptorProto_LabelReadTextFormat(PBTextFormatReader* reader) {
+  return (PBFieldDescriptorProto_Label)PBTextFormatReaderReadEnum(reader, PBFieldDescriptorProto_LabelTextFormatNames, PBFieldDescriptorProto_LabelTextFormatValues, 3);
+}
+void PBFieldDescriptorProto_LabelWriteJSON(PBJSONWriter* writer, const char* name, PBFieldDescriptorProto_Label value) {
+  PBJSONWriteEnum(writer, name, value, PBFieldDescriptorProto_LabelTextFormatNames, PBFieldDescriptorProto_LabelTextFormatValues, 3);
+}
+PBFieldDescriptorProto_Label PBFieldDescriptorProto_LabelReadJSON(PBJSONReader* reader) {
+  return (PBFieldDescriptorProto_Label)PBJSONReaderReadEnum(reader, PBFieldDescriptorProto_LabelTextFormatNames, PBFieldDescriptorProto_LabelTextFormatValues, 3);
 }
 @interface PBFieldDescriptorProto_Builder()
 @property (strong) PBFieldDescriptorProto* result;
@@ -2366,6 +3091,164 @@ BOOL PBFieldDescriptorProto_LabelIsValidValue(PBFieldDescriptorProto_Label value
     }
   }
 }
+- (PBFieldDescriptorProto_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          [self setName:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        if (memcmp(name, "type", 4) == 0) {
+          [self setType:PBFieldDescriptorProto_TypeReadTextFormat(reader)];
+          continue;
+        }
+        break;
+      case 5:
+        if (memcmp(name, "label", 5) == 0) {
+          [self setLabel:PBFieldDescriptorProto_LabelReadTextFormat(reader)];
+          continue;
+        }
+        break;
+      case 6:
+        if (memcmp(name, "number", 6) == 0) {
+          [self setNumber:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          PBFieldOptions_Builder* subBuilder = [PBFieldOptions builder];
+          if (self.hasOptions) {
+            [subBuilder mergeFrom:self.options];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptions:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 8:
+        if (memcmp(name, "extendee", 8) == 0) {
+          [self setExtendee:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 9:
+        if (memcmp(name, "type_name", 9) == 0) {
+          [self setTypeName:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 13:
+        if (memcmp(name, "default_value", 13) == 0) {
+          [self setDefaultValue:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBFieldDescriptorProto_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          number = 1;
+        } else if (memcmp(name, "type", 4) == 0) {
+          number = 5;
+        }
+        break;
+      case 5:
+        if (memcmp(name, "label", 5) == 0) {
+          number = 4;
+        }
+        break;
+      case 6:
+        if (memcmp(name, "number", 6) == 0) {
+          number = 3;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          number = 8;
+        }
+        break;
+      case 8:
+        if (memcmp(name, "typeName", 8) == 0) {
+          number = 6;
+        } else if (memcmp(name, "extendee", 8) == 0) {
+          number = 2;
+        }
+        break;
+      case 9:
+        if (memcmp(name, "type_name", 9) == 0) {
+          number = 6;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "defaultValue", 12) == 0) {
+          number = 7;
+        }
+        break;
+      case 13:
+        if (memcmp(name, "default_value", 13) == 0) {
+          number = 7;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setName:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 2: {
+        [self setExtendee:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 3: {
+        [self setNumber:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 4: {
+        [self setLabel:PBFieldDescriptorProto_LabelReadJSON(reader)];
+        continue;
+      }
+      case 5: {
+        [self setType:PBFieldDescriptorProto_TypeReadJSON(reader)];
+        continue;
+      }
+      case 6: {
+        [self setTypeName:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 7: {
+        [self setDefaultValue:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 8: {
+        PBFieldOptions_Builder* subBuilder = [PBFieldOptions builder];
+        if (self.hasOptions) {
+          [subBuilder mergeFrom:self.options];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptions:[subBuilder buildPartial]];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasName {
   return result.hasName;
 }
@@ -2541,17 +3424,16 @@ BOOL PBFieldDescriptorProto_LabelIsValidValue(PBFieldDescriptorProto_Label value
   }
   return self;
 }
-static PBEnumDescriptorProto* defaultPBEnumDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBEnumDescriptorProto class]) {
-    defaultPBEnumDescriptorProtoInstance = [[PBEnumDescriptorProto alloc] init];
-  }
-}
 + (PBEnumDescriptorProto*) defaultInstance {
+  static PBEnumDescriptorProto* defaultPBEnumDescriptorProtoInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBEnumDescriptorProtoInstance = [[PBEnumDescriptorProto alloc] init];
+  });
   return defaultPBEnumDescriptorProtoInstance;
 }
 - (PBEnumDescriptorProto*) defaultInstance {
-  return defaultPBEnumDescriptorProtoInstance;
+  return [PBEnumDescriptorProto defaultInstance];
 }
 - (NSArray *)value {
   return valueArray;
@@ -2682,6 +3564,21 @@ static PBEnumDescriptorProto* defaultPBEnumDescriptorProtoInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasName) {
+    PBJSONWriteString(writer, "name", self.name);
+  }
+  if (self.valueArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "value");
+    for (PBEnumValueDescriptorProto* element in self.valueArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.hasOptions) {
+    PBJSONWriteMessage(writer, "options", self.options);
+  }
+}
 @end
 
 @interface PBEnumDescriptorProto_Builder()
@@ -2778,6 +3675,94 @@ static PBEnumDescriptorProto* defaultPBEnumDescriptorProtoInstance = nil;
     }
   }
 }
+- (PBEnumDescriptorProto_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          [self setName:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 5:
+        if (memcmp(name, "value", 5) == 0) {
+          PBEnumValueDescriptorProto_Builder* subBuilder = [PBEnumValueDescriptorProto builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addValue:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          PBEnumOptions_Builder* subBuilder = [PBEnumOptions builder];
+          if (self.hasOptions) {
+            [subBuilder mergeFrom:self.options];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptions:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBEnumDescriptorProto_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          number = 1;
+        }
+        break;
+      case 5:
+        if (memcmp(name, "value", 5) == 0) {
+          number = 2;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          number = 3;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setName:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 2: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBEnumValueDescriptorProto_Builder* subBuilder = [PBEnumValueDescriptorProto builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addValue:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 3: {
+        PBEnumOptions_Builder* subBuilder = [PBEnumOptions builder];
+        if (self.hasOptions) {
+          [subBuilder mergeFrom:self.options];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptions:[subBuilder buildPartial]];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasName {
   return result.hasName;
 }
@@ -2884,17 +3869,16 @@ static PBEnumDescriptorProto* defaultPBEnumDescriptorProtoInstance = nil;
   }
   return self;
 }
-static PBEnumValueDescriptorProto* defaultPBEnumValueDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBEnumValueDescriptorProto class]) {
-    defaultPBEnumValueDescriptorProtoInstance = [[PBEnumValueDescriptorProto alloc] init];
-  }
-}
 + (PBEnumValueDescriptorProto*) defaultInstance {
+  static PBEnumValueDescriptorProto* defaultPBEnumValueDescriptorProtoInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBEnumValueDescriptorProtoInstance = [[PBEnumValueDescriptorProto alloc] init];
+  });
   return defaultPBEnumValueDescriptorProtoInstance;
 }
 - (PBEnumValueDescriptorProto*) defaultInstance {
-  return defaultPBEnumValueDescriptorProtoInstance;
+  return [PBEnumValueDescriptorProto defaultInstance];
 }
 - (BOOL) isInitialized {
   if (self.hasOptions) {
@@ -3012,6 +3996,17 @@ static PBEnumValueDescriptorProto* defaultPBEnumValueDescriptorProtoInstance = n
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasName) {
+    PBJSONWriteString(writer, "name", self.name);
+  }
+  if (self.hasNumber) {
+    PBJSONWriteInt32(writer, "number", self.number);
+  }
+  if (self.hasOptions) {
+    PBJSONWriteMessage(writer, "options", self.options);
+  }
+}
 @end
 
 @interface PBEnumValueDescriptorProto_Builder()
@@ -3102,6 +4097,87 @@ static PBEnumValueDescriptorProto* defaultPBEnumValueDescriptorProtoInstance = n
     }
   }
 }
+- (PBEnumValueDescriptorProto_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          [self setName:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 6:
+        if (memcmp(name, "number", 6) == 0) {
+          [self setNumber:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          PBEnumValueOptions_Builder* subBuilder = [PBEnumValueOptions builder];
+          if (self.hasOptions) {
+            [subBuilder mergeFrom:self.options];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptions:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBEnumValueDescriptorProto_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          number = 1;
+        }
+        break;
+      case 6:
+        if (memcmp(name, "number", 6) == 0) {
+          number = 2;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          number = 3;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setName:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 2: {
+        [self setNumber:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 3: {
+        PBEnumValueOptions_Builder* subBuilder = [PBEnumValueOptions builder];
+        if (self.hasOptions) {
+          [subBuilder mergeFrom:self.options];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptions:[subBuilder buildPartial]];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasName {
   return result.hasName;
 }
@@ -3197,17 +4273,16 @@ static PBEnumValueDescriptorProto* defaultPBEnumValueDescriptorProtoInstance = n
   }
   return self;
 }
-static PBServiceDescriptorProto* defaultPBServiceDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBServiceDescriptorProto class]) {
-    defaultPBServiceDescriptorProtoInstance = [[PBServiceDescriptorProto alloc] init];
-  }
-}
 + (PBServiceDescriptorProto*) defaultInstance {
+  static PBServiceDescriptorProto* defaultPBServiceDescriptorProtoInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBServiceDescriptorProtoInstance = [[PBServiceDescriptorProto alloc] init];
+  });
   return defaultPBServiceDescriptorProtoInstance;
 }
 - (PBServiceDescriptorProto*) defaultInstance {
-  return defaultPBServiceDescriptorProtoInstance;
+  return [PBServiceDescriptorProto defaultInstance];
 }
 - (NSArray *)method {
   return methodArray;
@@ -3338,6 +4413,21 @@ static PBServiceDescriptorProto* defaultPBServiceDescriptorProtoInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasName) {
+    PBJSONWriteString(writer, "name", self.name);
+  }
+  if (self.methodArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "method");
+    for (PBMethodDescriptorProto* element in self.methodArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.hasOptions) {
+    PBJSONWriteMessage(writer, "options", self.options);
+  }
+}
 @end
 
 @interface PBServiceDescriptorProto_Builder()
@@ -3434,6 +4524,94 @@ static PBServiceDescriptorProto* defaultPBServiceDescriptorProtoInstance = nil;
     }
   }
 }
+- (PBServiceDescriptorProto_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          [self setName:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 6:
+        if (memcmp(name, "method", 6) == 0) {
+          PBMethodDescriptorProto_Builder* subBuilder = [PBMethodDescriptorProto builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addMethod:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          PBServiceOptions_Builder* subBuilder = [PBServiceOptions builder];
+          if (self.hasOptions) {
+            [subBuilder mergeFrom:self.options];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptions:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBServiceDescriptorProto_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          number = 1;
+        }
+        break;
+      case 6:
+        if (memcmp(name, "method", 6) == 0) {
+          number = 2;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          number = 3;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setName:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 2: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBMethodDescriptorProto_Builder* subBuilder = [PBMethodDescriptorProto builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addMethod:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 3: {
+        PBServiceOptions_Builder* subBuilder = [PBServiceOptions builder];
+        if (self.hasOptions) {
+          [subBuilder mergeFrom:self.options];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptions:[subBuilder buildPartial]];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasName {
   return result.hasName;
 }
@@ -3549,17 +4727,16 @@ static PBServiceDescriptorProto* defaultPBServiceDescriptorProtoInstance = nil;
   }
   return self;
 }
-static PBMethodDescriptorProto* defaultPBMethodDescriptorProtoInstance = nil;
-+ (void) initialize {
-  if (self == [PBMethodDescriptorProto class]) {
-    defaultPBMethodDescriptorProtoInstance = [[PBMethodDescriptorProto alloc] init];
-  }
-}
 + (PBMethodDescriptorProto*) defaultInstance {
+  static PBMethodDescriptorProto* defaultPBMethodDescriptorProtoInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBMethodDescriptorProtoInstance = [[PBMethodDescriptorProto alloc] init];
+  });
   return defaultPBMethodDescriptorProtoInstance;
 }
 - (PBMethodDescriptorProto*) defaultInstance {
-  return defaultPBMethodDescriptorProtoInstance;
+  return [PBMethodDescriptorProto defaultInstance];
 }
 - (BOOL) isInitialized {
   if (self.hasOptions) {
@@ -3691,6 +4868,20 @@ static PBMethodDescriptorProto* defaultPBMethodDescriptorProtoInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasName) {
+    PBJSONWriteString(writer, "name", self.name);
+  }
+  if (self.hasInputType) {
+    PBJSONWriteString(writer, "inputType", self.inputType);
+  }
+  if (self.hasOutputType) {
+    PBJSONWriteString(writer, "outputType", self.outputType);
+  }
+  if (self.hasOptions) {
+    PBJSONWriteMessage(writer, "options", self.options);
+  }
+}
 @end
 
 @interface PBMethodDescriptorProto_Builder()
@@ -3788,6 +4979,109 @@ static PBMethodDescriptorProto* defaultPBMethodDescriptorProtoInstance = nil;
     }
   }
 }
+- (PBMethodDescriptorProto_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          [self setName:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          PBMethodOptions_Builder* subBuilder = [PBMethodOptions builder];
+          if (self.hasOptions) {
+            [subBuilder mergeFrom:self.options];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptions:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 10:
+        if (memcmp(name, "input_type", 10) == 0) {
+          [self setInputType:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 11:
+        if (memcmp(name, "output_type", 11) == 0) {
+          [self setOutputType:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBMethodDescriptorProto_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          number = 1;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "options", 7) == 0) {
+          number = 4;
+        }
+        break;
+      case 9:
+        if (memcmp(name, "inputType", 9) == 0) {
+          number = 2;
+        }
+        break;
+      case 10:
+        if (memcmp(name, "input_type", 10) == 0) {
+          number = 2;
+        } else if (memcmp(name, "outputType", 10) == 0) {
+          number = 3;
+        }
+        break;
+      case 11:
+        if (memcmp(name, "output_type", 11) == 0) {
+          number = 3;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setName:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 2: {
+        [self setInputType:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 3: {
+        [self setOutputType:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 4: {
+        PBMethodOptions_Builder* subBuilder = [PBMethodOptions builder];
+        if (self.hasOptions) {
+          [subBuilder mergeFrom:self.options];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptions:[subBuilder buildPartial]];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasName {
   return result.hasName;
 }
@@ -3987,17 +5281,16 @@ static PBMethodDescriptorProto* defaultPBMethodDescriptorProtoInstance = nil;
   }
   return self;
 }
-static PBFileOptions* defaultPBFileOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBFileOptions class]) {
-    defaultPBFileOptionsInstance = [[PBFileOptions alloc] init];
-  }
-}
 + (PBFileOptions*) defaultInstance {
+  static PBFileOptions* defaultPBFileOptionsInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBFileOptionsInstance = [[PBFileOptions alloc] init];
+  });
   return defaultPBFileOptionsInstance;
 }
 - (PBFileOptions*) defaultInstance {
-  return defaultPBFileOptionsInstance;
+  return [PBFileOptions defaultInstance];
 }
 - (NSArray *)uninterpretedOption {
   return uninterpretedOptionArray;
@@ -4232,17 +5525,65 @@ static PBFileOptions* defaultPBFileOptionsInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasJavaPackage) {
+    PBJSONWriteString(writer, "javaPackage", self.javaPackage);
+  }
+  if (self.hasJavaOuterClassname) {
+    PBJSONWriteString(writer, "javaOuterClassname", self.javaOuterClassname);
+  }
+  if (self.hasOptimizeFor) {
+    PBFileOptions_OptimizeModeWriteJSON(writer, "optimizeFor", self.optimizeFor);
+  }
+  if (self.hasJavaMultipleFiles) {
+    PBJSONWriteBool(writer, "javaMultipleFiles", self.javaMultipleFiles);
+  }
+  if (self.hasGoPackage) {
+    PBJSONWriteString(writer, "goPackage", self.goPackage);
+  }
+  if (self.hasCcGenericServices) {
+    PBJSONWriteBool(writer, "ccGenericServices", self.ccGenericServices);
+  }
+  if (self.hasJavaGenericServices) {
+    PBJSONWriteBool(writer, "javaGenericServices", self.javaGenericServices);
+  }
+  if (self.hasPyGenericServices) {
+    PBJSONWriteBool(writer, "pyGenericServices", self.pyGenericServices);
+  }
+  if (self.hasJavaGenerateEqualsAndHash) {
+    PBJSONWriteBool(writer, "javaGenerateEqualsAndHash", self.javaGenerateEqualsAndHash);
+  }
+  if (self.uninterpretedOptionArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "uninterpretedOption");
+    for (PBUninterpretedOption* element in self.uninterpretedOptionArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 BOOL PBFileOptions_OptimizeModeIsValidValue(PBFileOptions_OptimizeMode value) {
-  switch (value) {
-    case PBFileOptions_OptimizeModeSpeed:
-    case PBFileOptions_OptimizeModeCodeSize:
-    case PBFileOptions_OptimizeModeLiteRuntime:
-      return YES;
-    default:
-      return NO;
-  }
+  return (uint32_t)value - 1U < 3U;
+}
+static const char* const PBFileOptions_OptimizeModeTextFormatNames[] = {
+  "SPEED",
+  "CODE_SIZE",
+  "LITE_RUNTIME",
+};
+static const int32_t PBFileOptions_OptimizeModeTextFormatValues[] = {
+  1,
+  2,
+  3,
+};
+PBFileOptions_OptimizeMode PBFileOptions_OptimizeModeReadTextFormat(PBTextFormatReader* reader) {
+  return (PBFileOptions_OptimizeMode)PBTextFormatReaderReadEnum(reader, PBFileOptions_OptimizeModeTextFormatNames, PBFileOptions_OptimizeModeTextFormatValues, 3);
+}
+void PBFileOptions_OptimizeModeWriteJSON(PBJSONWriter* writer, const char* name, PBFileOptions_OptimizeMode value) {
+  PBJSONWriteEnum(writer, name, value, PBFileOptions_OptimizeModeTextFormatNames, PBFileOptions_OptimizeModeTextFormatValues, 3);
+}
+PBFileOptions_OptimizeMode PBFileOptions_OptimizeModeReadJSON(PBJSONReader* reader) {
+  return (PBFileOptions_OptimizeMode)PBJSONReaderReadEnum(reader, PBFileOptions_OptimizeModeTextFormatNames, PBFileOptions_OptimizeModeTextFormatValues, 3);
 }
 @interface PBFileOptions_Builder()
 @property (strong) PBFileOptions* result;
@@ -4388,6 +5729,204 @@ BOOL PBFileOptions_OptimizeModeIsValidValue(PBFileOptions_OptimizeMode value) {
     }
   }
 }
+- (PBFileOptions_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 10:
+        if (memcmp(name, "go_package", 10) == 0) {
+          [self setGoPackage:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "java_package", 12) == 0) {
+          [self setJavaPackage:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        if (memcmp(name, "optimize_for", 12) == 0) {
+          [self setOptimizeFor:PBFileOptions_OptimizeModeReadTextFormat(reader)];
+          continue;
+        }
+        break;
+      case 19:
+        if (memcmp(name, "java_multiple_files", 19) == 0) {
+          [self setJavaMultipleFiles:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        if (memcmp(name, "cc_generic_services", 19) == 0) {
+          [self setCcGenericServices:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        if (memcmp(name, "py_generic_services", 19) == 0) {
+          [self setPyGenericServices:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "java_outer_classname", 20) == 0) {
+          [self setJavaOuterClassname:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 21:
+        if (memcmp(name, "java_generic_services", 21) == 0) {
+          [self setJavaGenericServices:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        break;
+      case 29:
+        if (memcmp(name, "java_generate_equals_and_hash", 29) == 0) {
+          [self setJavaGenerateEqualsAndHash:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBFileOptions_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 9:
+        if (memcmp(name, "goPackage", 9) == 0) {
+          number = 11;
+        }
+        break;
+      case 10:
+        if (memcmp(name, "go_package", 10) == 0) {
+          number = 11;
+        }
+        break;
+      case 11:
+        if (memcmp(name, "javaPackage", 11) == 0) {
+          number = 1;
+        } else if (memcmp(name, "optimizeFor", 11) == 0) {
+          number = 9;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "java_package", 12) == 0) {
+          number = 1;
+        } else if (memcmp(name, "optimize_for", 12) == 0) {
+          number = 9;
+        }
+        break;
+      case 17:
+        if (memcmp(name, "javaMultipleFiles", 17) == 0) {
+          number = 10;
+        } else if (memcmp(name, "ccGenericServices", 17) == 0) {
+          number = 16;
+        } else if (memcmp(name, "pyGenericServices", 17) == 0) {
+          number = 18;
+        }
+        break;
+      case 18:
+        if (memcmp(name, "javaOuterClassname", 18) == 0) {
+          number = 8;
+        }
+        break;
+      case 19:
+        if (memcmp(name, "java_multiple_files", 19) == 0) {
+          number = 10;
+        } else if (memcmp(name, "cc_generic_services", 19) == 0) {
+          number = 16;
+        } else if (memcmp(name, "javaGenericServices", 19) == 0) {
+          number = 17;
+        } else if (memcmp(name, "py_generic_services", 19) == 0) {
+          number = 18;
+        } else if (memcmp(name, "uninterpretedOption", 19) == 0) {
+          number = 999;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "java_outer_classname", 20) == 0) {
+          number = 8;
+        } else if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          number = 999;
+        }
+        break;
+      case 21:
+        if (memcmp(name, "java_generic_services", 21) == 0) {
+          number = 17;
+        }
+        break;
+      case 25:
+        if (memcmp(name, "javaGenerateEqualsAndHash", 25) == 0) {
+          number = 20;
+        }
+        break;
+      case 29:
+        if (memcmp(name, "java_generate_equals_and_hash", 29) == 0) {
+          number = 20;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setJavaPackage:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 8: {
+        [self setJavaOuterClassname:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 9: {
+        [self setOptimizeFor:PBFileOptions_OptimizeModeReadJSON(reader)];
+        continue;
+      }
+      case 10: {
+        [self setJavaMultipleFiles:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 11: {
+        [self setGoPackage:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 16: {
+        [self setCcGenericServices:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 17: {
+        [self setJavaGenericServices:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 18: {
+        [self setPyGenericServices:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 20: {
+        [self setJavaGenerateEqualsAndHash:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 999: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasJavaPackage {
   return result.hasJavaPackage;
 }
@@ -4596,17 +6135,16 @@ BOOL PBFileOptions_OptimizeModeIsValidValue(PBFileOptions_OptimizeMode value) {
   }
   return self;
 }
-static PBMessageOptions* defaultPBMessageOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBMessageOptions class]) {
-    defaultPBMessageOptionsInstance = [[PBMessageOptions alloc] init];
-  }
-}
 + (PBMessageOptions*) defaultInstance {
+  static PBMessageOptions* defaultPBMessageOptionsInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBMessageOptionsInstance = [[PBMessageOptions alloc] init];
+  });
   return defaultPBMessageOptionsInstance;
 }
 - (PBMessageOptions*) defaultInstance {
-  return defaultPBMessageOptionsInstance;
+  return [PBMessageOptions defaultInstance];
 }
 - (NSArray *)uninterpretedOption {
   return uninterpretedOptionArray;
@@ -4743,6 +6281,21 @@ static PBMessageOptions* defaultPBMessageOptionsInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasMessageSetWireFormat) {
+    PBJSONWriteBool(writer, "messageSetWireFormat", self.messageSetWireFormat);
+  }
+  if (self.hasNoStandardDescriptorAccessor) {
+    PBJSONWriteBool(writer, "noStandardDescriptorAccessor", self.noStandardDescriptorAccessor);
+  }
+  if (self.uninterpretedOptionArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "uninterpretedOption");
+    for (PBUninterpretedOption* element in self.uninterpretedOptionArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 @interface PBMessageOptions_Builder()
@@ -4835,6 +6388,96 @@ static PBMessageOptions* defaultPBMessageOptionsInstance = nil;
     }
   }
 }
+- (PBMessageOptions_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 20:
+        if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 23:
+        if (memcmp(name, "message_set_wire_format", 23) == 0) {
+          [self setMessageSetWireFormat:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        break;
+      case 31:
+        if (memcmp(name, "no_standard_descriptor_accessor", 31) == 0) {
+          [self setNoStandardDescriptorAccessor:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBMessageOptions_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 19:
+        if (memcmp(name, "uninterpretedOption", 19) == 0) {
+          number = 999;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "messageSetWireFormat", 20) == 0) {
+          number = 1;
+        } else if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          number = 999;
+        }
+        break;
+      case 23:
+        if (memcmp(name, "message_set_wire_format", 23) == 0) {
+          number = 1;
+        }
+        break;
+      case 28:
+        if (memcmp(name, "noStandardDescriptorAccessor", 28) == 0) {
+          number = 2;
+        }
+        break;
+      case 31:
+        if (memcmp(name, "no_standard_descriptor_accessor", 31) == 0) {
+          number = 2;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setMessageSetWireFormat:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 2: {
+        [self setNoStandardDescriptorAccessor:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 999: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasMessageSetWireFormat {
   return result.hasMessageSetWireFormat;
 }
@@ -4977,17 +6620,16 @@ static PBMessageOptions* defaultPBMessageOptionsInstance = nil;
   }
   return self;
 }
-static PBFieldOptions* defaultPBFieldOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBFieldOptions class]) {
-    defaultPBFieldOptionsInstance = [[PBFieldOptions alloc] init];
-  }
-}
 + (PBFieldOptions*) defaultInstance {
+  static PBFieldOptions* defaultPBFieldOptionsInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBFieldOptionsInstance = [[PBFieldOptions alloc] init];
+  });
   return defaultPBFieldOptionsInstance;
 }
 - (PBFieldOptions*) defaultInstance {
-  return defaultPBFieldOptionsInstance;
+  return [PBFieldOptions defaultInstance];
 }
 - (NSArray *)uninterpretedOption {
   return uninterpretedOptionArray;
@@ -5180,17 +6822,56 @@ static PBFieldOptions* defaultPBFieldOptionsInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasCtype) {
+    PBFieldOptions_CTypeWriteJSON(writer, "ctype", self.ctype);
+  }
+  if (self.hasPacked) {
+    PBJSONWriteBool(writer, "packed", self.packed);
+  }
+  if (self.hasDeprecated) {
+    PBJSONWriteBool(writer, "deprecated", self.deprecated);
+  }
+  if (self.hasLazy) {
+    PBJSONWriteBool(writer, "lazy", self.lazy);
+  }
+  if (self.hasExperimentalMapKey) {
+    PBJSONWriteString(writer, "experimentalMapKey", self.experimentalMapKey);
+  }
+  if (self.hasWeak) {
+    PBJSONWriteBool(writer, "weak", self.weak);
+  }
+  if (self.uninterpretedOptionArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "uninterpretedOption");
+    for (PBUninterpretedOption* element in self.uninterpretedOptionArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value) {
-  switch (value) {
-    case PBFieldOptions_CTypeString:
-    case PBFieldOptions_CTypeCord:
-    case PBFieldOptions_CTypeStringPiece:
-      return YES;
-    default:
-      return NO;
-  }
+  return (uint32_t)value - 0U < 3U;
+}
+static const char* const PBFieldOptions_CTypeTextFormatNames[] = {
+  "STRING",
+  "CORD",
+  "STRING_PIECE",
+};
+static const int32_t PBFieldOptions_CTypeTextFormatValues[] = {
+  0,
+  1,
+  2,
+};
+PBFieldOptions_CType PBFieldOptions_CTypeReadTextFormat(PBTextFormatReader* reader) {
+  return (PBFieldOptions_CType)PBTextFormatReaderReadEnum(reader, PBFieldOptions_CTypeTextFormatNames, PBFieldOptions_CTypeTextFormatValues, 3);
+}
+void PBFieldOptions_CTypeWriteJSON(PBJSONWriter* writer, const char* name, PBFieldOptions_CType value) {
+  PBJSONWriteEnum(writer, name, value, PBFieldOptions_CTypeTextFormatNames, PBFieldOptions_CTypeTextFormatValues, 3);
+}
+PBFieldOptions_CType PBFieldOptions_CTypeReadJSON(PBJSONReader* reader) {
+  return (PBFieldOptions_CType)PBJSONReaderReadEnum(reader, PBFieldOptions_CTypeTextFormatNames, PBFieldOptions_CTypeTextFormatValues, 3);
 }
 @interface PBFieldOptions_Builder()
 @property (strong) PBFieldOptions* result;
@@ -5315,6 +6996,144 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value) {
     }
   }
 }
+- (PBFieldOptions_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "lazy", 4) == 0) {
+          [self setLazy:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        if (memcmp(name, "weak", 4) == 0) {
+          [self setWeak:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        break;
+      case 5:
+        if (memcmp(name, "ctype", 5) == 0) {
+          [self setCtype:PBFieldOptions_CTypeReadTextFormat(reader)];
+          continue;
+        }
+        break;
+      case 6:
+        if (memcmp(name, "packed", 6) == 0) {
+          [self setPacked:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        break;
+      case 10:
+        if (memcmp(name, "deprecated", 10) == 0) {
+          [self setDeprecated:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "experimental_map_key", 20) == 0) {
+          [self setExperimentalMapKey:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBFieldOptions_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "lazy", 4) == 0) {
+          number = 5;
+        } else if (memcmp(name, "weak", 4) == 0) {
+          number = 10;
+        }
+        break;
+      case 5:
+        if (memcmp(name, "ctype", 5) == 0) {
+          number = 1;
+        }
+        break;
+      case 6:
+        if (memcmp(name, "packed", 6) == 0) {
+          number = 2;
+        }
+        break;
+      case 10:
+        if (memcmp(name, "deprecated", 10) == 0) {
+          number = 3;
+        }
+        break;
+      case 18:
+        if (memcmp(name, "experimentalMapKey", 18) == 0) {
+          number = 9;
+        }
+        break;
+      case 19:
+        if (memcmp(name, "uninterpretedOption", 19) == 0) {
+          number = 999;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "experimental_map_key", 20) == 0) {
+          number = 9;
+        } else if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          number = 999;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setCtype:PBFieldOptions_CTypeReadJSON(reader)];
+        continue;
+      }
+      case 2: {
+        [self setPacked:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 3: {
+        [self setDeprecated:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 5: {
+        [self setLazy:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 9: {
+        [self setExperimentalMapKey:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 10: {
+        [self setWeak:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 999: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasCtype {
   return result.hasCtype;
 }
@@ -5461,17 +7280,16 @@ BOOL PBFieldOptions_CTypeIsValidValue(PBFieldOptions_CType value) {
   }
   return self;
 }
-static PBEnumOptions* defaultPBEnumOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBEnumOptions class]) {
-    defaultPBEnumOptionsInstance = [[PBEnumOptions alloc] init];
-  }
-}
 + (PBEnumOptions*) defaultInstance {
+  static PBEnumOptions* defaultPBEnumOptionsInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBEnumOptionsInstance = [[PBEnumOptions alloc] init];
+  });
   return defaultPBEnumOptionsInstance;
 }
 - (PBEnumOptions*) defaultInstance {
-  return defaultPBEnumOptionsInstance;
+  return [PBEnumOptions defaultInstance];
 }
 - (NSArray *)uninterpretedOption {
   return uninterpretedOptionArray;
@@ -5594,6 +7412,18 @@ static PBEnumOptions* defaultPBEnumOptionsInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasAllowAlias) {
+    PBJSONWriteBool(writer, "allowAlias", self.allowAlias);
+  }
+  if (self.uninterpretedOptionArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "uninterpretedOption");
+    for (PBUninterpretedOption* element in self.uninterpretedOptionArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 @interface PBEnumOptions_Builder()
@@ -5679,6 +7509,79 @@ static PBEnumOptions* defaultPBEnumOptionsInstance = nil;
     }
   }
 }
+- (PBEnumOptions_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 11:
+        if (memcmp(name, "allow_alias", 11) == 0) {
+          [self setAllowAlias:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBEnumOptions_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 10:
+        if (memcmp(name, "allowAlias", 10) == 0) {
+          number = 2;
+        }
+        break;
+      case 11:
+        if (memcmp(name, "allow_alias", 11) == 0) {
+          number = 2;
+        }
+        break;
+      case 19:
+        if (memcmp(name, "uninterpretedOption", 19) == 0) {
+          number = 999;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          number = 999;
+        }
+        break;
+    }
+    switch (number) {
+      case 2: {
+        [self setAllowAlias:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 999: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasAllowAlias {
   return result.hasAllowAlias;
 }
@@ -5731,17 +7634,16 @@ static PBEnumOptions* defaultPBEnumOptionsInstance = nil;
   }
   return self;
 }
-static PBEnumValueOptions* defaultPBEnumValueOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBEnumValueOptions class]) {
-    defaultPBEnumValueOptionsInstance = [[PBEnumValueOptions alloc] init];
-  }
-}
 + (PBEnumValueOptions*) defaultInstance {
+  static PBEnumValueOptions* defaultPBEnumValueOptionsInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBEnumValueOptionsInstance = [[PBEnumValueOptions alloc] init];
+  });
   return defaultPBEnumValueOptionsInstance;
 }
 - (PBEnumValueOptions*) defaultInstance {
-  return defaultPBEnumValueOptionsInstance;
+  return [PBEnumValueOptions defaultInstance];
 }
 - (NSArray *)uninterpretedOption {
   return uninterpretedOptionArray;
@@ -5850,6 +7752,15 @@ static PBEnumValueOptions* defaultPBEnumValueOptionsInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.uninterpretedOptionArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "uninterpretedOption");
+    for (PBUninterpretedOption* element in self.uninterpretedOptionArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 @interface PBEnumValueOptions_Builder()
@@ -5928,6 +7839,59 @@ static PBEnumValueOptions* defaultPBEnumValueOptionsInstance = nil;
     }
   }
 }
+- (PBEnumValueOptions_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 20:
+        if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBEnumValueOptions_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 19:
+        if (memcmp(name, "uninterpretedOption", 19) == 0) {
+          number = 999;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          number = 999;
+        }
+        break;
+    }
+    switch (number) {
+      case 999: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (NSMutableArray *)uninterpretedOption {
   return result.uninterpretedOptionArray;
 }
@@ -5964,17 +7928,16 @@ static PBEnumValueOptions* defaultPBEnumValueOptionsInstance = nil;
   }
   return self;
 }
-static PBServiceOptions* defaultPBServiceOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBServiceOptions class]) {
-    defaultPBServiceOptionsInstance = [[PBServiceOptions alloc] init];
-  }
-}
 + (PBServiceOptions*) defaultInstance {
+  static PBServiceOptions* defaultPBServiceOptionsInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBServiceOptionsInstance = [[PBServiceOptions alloc] init];
+  });
   return defaultPBServiceOptionsInstance;
 }
 - (PBServiceOptions*) defaultInstance {
-  return defaultPBServiceOptionsInstance;
+  return [PBServiceOptions defaultInstance];
 }
 - (NSArray *)uninterpretedOption {
   return uninterpretedOptionArray;
@@ -6083,6 +8046,15 @@ static PBServiceOptions* defaultPBServiceOptionsInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.uninterpretedOptionArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "uninterpretedOption");
+    for (PBUninterpretedOption* element in self.uninterpretedOptionArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 @interface PBServiceOptions_Builder()
@@ -6161,6 +8133,59 @@ static PBServiceOptions* defaultPBServiceOptionsInstance = nil;
     }
   }
 }
+- (PBServiceOptions_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 20:
+        if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBServiceOptions_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 19:
+        if (memcmp(name, "uninterpretedOption", 19) == 0) {
+          number = 999;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          number = 999;
+        }
+        break;
+    }
+    switch (number) {
+      case 999: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (NSMutableArray *)uninterpretedOption {
   return result.uninterpretedOptionArray;
 }
@@ -6197,17 +8222,16 @@ static PBServiceOptions* defaultPBServiceOptionsInstance = nil;
   }
   return self;
 }
-static PBMethodOptions* defaultPBMethodOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [PBMethodOptions class]) {
-    defaultPBMethodOptionsInstance = [[PBMethodOptions alloc] init];
-  }
-}
 + (PBMethodOptions*) defaultInstance {
+  static PBMethodOptions* defaultPBMethodOptionsInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBMethodOptionsInstance = [[PBMethodOptions alloc] init];
+  });
   return defaultPBMethodOptionsInstance;
 }
 - (PBMethodOptions*) defaultInstance {
-  return defaultPBMethodOptionsInstance;
+  return [PBMethodOptions defaultInstance];
 }
 - (NSArray *)uninterpretedOption {
   return uninterpretedOptionArray;
@@ -6316,6 +8340,15 @@ static PBMethodOptions* defaultPBMethodOptionsInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.uninterpretedOptionArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "uninterpretedOption");
+    for (PBUninterpretedOption* element in self.uninterpretedOptionArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 @interface PBMethodOptions_Builder()
@@ -6394,6 +8427,59 @@ static PBMethodOptions* defaultPBMethodOptionsInstance = nil;
     }
   }
 }
+- (PBMethodOptions_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 20:
+        if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBMethodOptions_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 19:
+        if (memcmp(name, "uninterpretedOption", 19) == 0) {
+          number = 999;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "uninterpreted_option", 20) == 0) {
+          number = 999;
+        }
+        break;
+    }
+    switch (number) {
+      case 999: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBUninterpretedOption_Builder* subBuilder = [PBUninterpretedOption builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addUninterpretedOption:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (NSMutableArray *)uninterpretedOption {
   return result.uninterpretedOptionArray;
 }
@@ -6484,17 +8570,16 @@ static PBMethodOptions* defaultPBMethodOptionsInstance = nil;
   }
   return self;
 }
-static PBUninterpretedOption* defaultPBUninterpretedOptionInstance = nil;
-+ (void) initialize {
-  if (self == [PBUninterpretedOption class]) {
-    defaultPBUninterpretedOptionInstance = [[PBUninterpretedOption alloc] init];
-  }
-}
 + (PBUninterpretedOption*) defaultInstance {
+  static PBUninterpretedOption* defaultPBUninterpretedOptionInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBUninterpretedOptionInstance = [[PBUninterpretedOption alloc] init];
+  });
   return defaultPBUninterpretedOptionInstance;
 }
 - (PBUninterpretedOption*) defaultInstance {
-  return defaultPBUninterpretedOptionInstance;
+  return [PBUninterpretedOption defaultInstance];
 }
 - (NSArray *)name {
   return nameArray;
@@ -6673,6 +8758,33 @@ static PBUninterpretedOption* defaultPBUninterpretedOptionInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.nameArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "name");
+    for (PBUninterpretedOption_NamePart* element in self.nameArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.hasIdentifierValue) {
+    PBJSONWriteString(writer, "identifierValue", self.identifierValue);
+  }
+  if (self.hasPositiveIntValue) {
+    PBJSONWriteUInt64(writer, "positiveIntValue", self.positiveIntValue);
+  }
+  if (self.hasNegativeIntValue) {
+    PBJSONWriteInt64(writer, "negativeIntValue", self.negativeIntValue);
+  }
+  if (self.hasDoubleValue) {
+    PBJSONWriteDouble(writer, "doubleValue", self.doubleValue);
+  }
+  if (self.hasStringValue) {
+    PBJSONWriteData(writer, "stringValue", self.stringValue);
+  }
+  if (self.hasAggregateValue) {
+    PBJSONWriteString(writer, "aggregateValue", self.aggregateValue);
+  }
+}
 @end
 
 @interface PBUninterpretedOption_NamePart ()
@@ -6708,17 +8820,16 @@ static PBUninterpretedOption* defaultPBUninterpretedOptionInstance = nil;
   }
   return self;
 }
-static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInstance = nil;
-+ (void) initialize {
-  if (self == [PBUninterpretedOption_NamePart class]) {
-    defaultPBUninterpretedOption_NamePartInstance = [[PBUninterpretedOption_NamePart alloc] init];
-  }
-}
 + (PBUninterpretedOption_NamePart*) defaultInstance {
+  static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBUninterpretedOption_NamePartInstance = [[PBUninterpretedOption_NamePart alloc] init];
+  });
   return defaultPBUninterpretedOption_NamePartInstance;
 }
 - (PBUninterpretedOption_NamePart*) defaultInstance {
-  return defaultPBUninterpretedOption_NamePartInstance;
+  return [PBUninterpretedOption_NamePart defaultInstance];
 }
 - (BOOL) isInitialized {
   if (!self.hasNamePart) {
@@ -6820,6 +8931,14 @@ static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInst
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasNamePart) {
+    PBJSONWriteString(writer, "namePart", self.namePart);
+  }
+  if (self.hasIsExtension) {
+    PBJSONWriteBool(writer, "isExtension", self.isExtension);
+  }
+}
 @end
 
 @interface PBUninterpretedOption_NamePart_Builder()
@@ -6898,6 +9017,72 @@ static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInst
     }
   }
 }
+- (PBUninterpretedOption_NamePart_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 9:
+        if (memcmp(name, "name_part", 9) == 0) {
+          [self setNamePart:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "is_extension", 12) == 0) {
+          [self setIsExtension:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBUninterpretedOption_NamePart_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 8:
+        if (memcmp(name, "namePart", 8) == 0) {
+          number = 1;
+        }
+        break;
+      case 9:
+        if (memcmp(name, "name_part", 9) == 0) {
+          number = 1;
+        }
+        break;
+      case 11:
+        if (memcmp(name, "isExtension", 11) == 0) {
+          number = 2;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "is_extension", 12) == 0) {
+          number = 2;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setNamePart:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 2: {
+        [self setIsExtension:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (BOOL) hasNamePart {
   return result.hasNamePart;
 }
@@ -7049,6 +9234,152 @@ static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInst
     }
   }
 }
+- (PBUninterpretedOption_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          PBUninterpretedOption_NamePart_Builder* subBuilder = [PBUninterpretedOption_NamePart builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addName:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "double_value", 12) == 0) {
+          [self setDoubleValue:PBTextFormatReaderReadDouble(reader)];
+          continue;
+        }
+        if (memcmp(name, "string_value", 12) == 0) {
+          [self setStringValue:PBTextFormatReaderReadData(reader)];
+          continue;
+        }
+        break;
+      case 15:
+        if (memcmp(name, "aggregate_value", 15) == 0) {
+          [self setAggregateValue:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 16:
+        if (memcmp(name, "identifier_value", 16) == 0) {
+          [self setIdentifierValue:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 18:
+        if (memcmp(name, "positive_int_value", 18) == 0) {
+          [self setPositiveIntValue:PBTextFormatReaderReadUInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "negative_int_value", 18) == 0) {
+          [self setNegativeIntValue:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBUninterpretedOption_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "name", 4) == 0) {
+          number = 2;
+        }
+        break;
+      case 11:
+        if (memcmp(name, "doubleValue", 11) == 0) {
+          number = 6;
+        } else if (memcmp(name, "stringValue", 11) == 0) {
+          number = 7;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "double_value", 12) == 0) {
+          number = 6;
+        } else if (memcmp(name, "string_value", 12) == 0) {
+          number = 7;
+        }
+        break;
+      case 14:
+        if (memcmp(name, "aggregateValue", 14) == 0) {
+          number = 8;
+        }
+        break;
+      case 15:
+        if (memcmp(name, "identifierValue", 15) == 0) {
+          number = 3;
+        } else if (memcmp(name, "aggregate_value", 15) == 0) {
+          number = 8;
+        }
+        break;
+      case 16:
+        if (memcmp(name, "identifier_value", 16) == 0) {
+          number = 3;
+        } else if (memcmp(name, "positiveIntValue", 16) == 0) {
+          number = 4;
+        } else if (memcmp(name, "negativeIntValue", 16) == 0) {
+          number = 5;
+        }
+        break;
+      case 18:
+        if (memcmp(name, "positive_int_value", 18) == 0) {
+          number = 4;
+        } else if (memcmp(name, "negative_int_value", 18) == 0) {
+          number = 5;
+        }
+        break;
+    }
+    switch (number) {
+      case 2: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBUninterpretedOption_NamePart_Builder* subBuilder = [PBUninterpretedOption_NamePart builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addName:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 3: {
+        [self setIdentifierValue:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 4: {
+        [self setPositiveIntValue:PBJSONReaderReadUInt64(reader)];
+        continue;
+      }
+      case 5: {
+        [self setNegativeIntValue:PBJSONReaderReadInt64(reader)];
+        continue;
+      }
+      case 6: {
+        [self setDoubleValue:PBJSONReaderReadDouble(reader)];
+        continue;
+      }
+      case 7: {
+        [self setStringValue:PBJSONReaderReadData(reader)];
+        continue;
+      }
+      case 8: {
+        [self setAggregateValue:PBJSONReaderReadString(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (NSMutableArray *)name {
   return result.nameArray;
 }
@@ -7181,17 +9512,16 @@ static PBUninterpretedOption_NamePart* defaultPBUninterpretedOption_NamePartInst
   }
   return self;
 }
-static PBSourceCodeInfo* defaultPBSourceCodeInfoInstance = nil;
-+ (void) initialize {
-  if (self == [PBSourceCodeInfo class]) {
-    defaultPBSourceCodeInfoInstance = [[PBSourceCodeInfo alloc] init];
-  }
-}
 + (PBSourceCodeInfo*) defaultInstance {
+  static PBSourceCodeInfo* defaultPBSourceCodeInfoInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBSourceCodeInfoInstance = [[PBSourceCodeInfo alloc] init];
+  });
   return defaultPBSourceCodeInfoInstance;
 }
 - (PBSourceCodeInfo*) defaultInstance {
-  return defaultPBSourceCodeInfoInstance;
+  return [PBSourceCodeInfo defaultInstance];
 }
 - (NSArray *)location {
   return locationArray;
@@ -7281,6 +9611,15 @@ static PBSourceCodeInfo* defaultPBSourceCodeInfoInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.locationArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "location");
+    for (PBSourceCodeInfo_Location* element in self.locationArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 @interface PBSourceCodeInfo_Location ()
@@ -7317,17 +9656,16 @@ static PBSourceCodeInfo* defaultPBSourceCodeInfoInstance = nil;
   }
   return self;
 }
-static PBSourceCodeInfo_Location* defaultPBSourceCodeInfo_LocationInstance = nil;
-+ (void) initialize {
-  if (self == [PBSourceCodeInfo_Location class]) {
-    defaultPBSourceCodeInfo_LocationInstance = [[PBSourceCodeInfo_Location alloc] init];
-  }
-}
 + (PBSourceCodeInfo_Location*) defaultInstance {
+  static PBSourceCodeInfo_Location* defaultPBSourceCodeInfo_LocationInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultPBSourceCodeInfo_LocationInstance = [[PBSourceCodeInfo_Location alloc] init];
+  });
   return defaultPBSourceCodeInfo_LocationInstance;
 }
 - (PBSourceCodeInfo_Location*) defaultInstance {
-  return defaultPBSourceCodeInfo_LocationInstance;
+  return [PBSourceCodeInfo_Location defaultInstance];
 }
 - (PBArray *)path {
   return pathArray;
@@ -7499,6 +9837,30 @@ static PBSourceCodeInfo_Location* defaultPBSourceCodeInfo_LocationInstance = nil
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.pathArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "path");
+    NSUInteger pathArrayCount=self.pathArray.count;
+    for(NSUInteger i=0;i<pathArrayCount;i++){
+      PBJSONWriteInt32(writer, NULL, [self.pathArray int32AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.spanArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "span");
+    NSUInteger spanArrayCount=self.spanArray.count;
+    for(NSUInteger i=0;i<spanArrayCount;i++){
+      PBJSONWriteInt32(writer, NULL, [self.spanArray int32AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.hasLeadingComments) {
+    PBJSONWriteString(writer, "leadingComments", self.leadingComments);
+  }
+  if (self.hasTrailingComments) {
+    PBJSONWriteString(writer, "trailingComments", self.trailingComments);
+  }
+}
 @end
 
 @interface PBSourceCodeInfo_Location_Builder()
@@ -7615,6 +9977,100 @@ static PBSourceCodeInfo_Location* defaultPBSourceCodeInfo_LocationInstance = nil
     }
   }
 }
+- (PBSourceCodeInfo_Location_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "path", 4) == 0) {
+          [self addPath:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "span", 4) == 0) {
+          [self addSpan:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+      case 16:
+        if (memcmp(name, "leading_comments", 16) == 0) {
+          [self setLeadingComments:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 17:
+        if (memcmp(name, "trailing_comments", 17) == 0) {
+          [self setTrailingComments:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBSourceCodeInfo_Location_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "path", 4) == 0) {
+          number = 1;
+        } else if (memcmp(name, "span", 4) == 0) {
+          number = 2;
+        }
+        break;
+      case 15:
+        if (memcmp(name, "leadingComments", 15) == 0) {
+          number = 3;
+        }
+        break;
+      case 16:
+        if (memcmp(name, "leading_comments", 16) == 0) {
+          number = 3;
+        } else if (memcmp(name, "trailingComments", 16) == 0) {
+          number = 4;
+        }
+        break;
+      case 17:
+        if (memcmp(name, "trailing_comments", 17) == 0) {
+          number = 4;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPath:PBJSONReaderReadInt32(reader)];
+        }
+        continue;
+      }
+      case 2: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addSpan:PBJSONReaderReadInt32(reader)];
+        }
+        continue;
+      }
+      case 3: {
+        [self setLeadingComments:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 4: {
+        [self setTrailingComments:PBJSONReaderReadString(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (PBAppendableArray *)path {
   return result.pathArray;
 }
@@ -7774,6 +10230,54 @@ static PBSourceCodeInfo_Location* defaultPBSourceCodeInfo_LocationInstance = nil
     }
   }
 }
+- (PBSourceCodeInfo_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 8:
+        if (memcmp(name, "location", 8) == 0) {
+          PBSourceCodeInfo_Location_Builder* subBuilder = [PBSourceCodeInfo_Location builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addLocation:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (PBSourceCodeInfo_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 8:
+        if (memcmp(name, "location", 8) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          PBSourceCodeInfo_Location_Builder* subBuilder = [PBSourceCodeInfo_Location builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addLocation:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 - (NSMutableArray *)location {
   return result.locationArray;
 }
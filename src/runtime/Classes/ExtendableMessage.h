@@ -72,10 +72,15 @@
 - (void) writeExtensionsToCodedOutputStream:(PBCodedOutputStream*) output
                                        from:(int32_t) startInclusive
                                          to:(int32_t) endExclusive;
+#ifndef PB_LITE_RUNTIME
 - (void) writeExtensionDescriptionToMutableString:(NSMutableString*) output
                                              from:(int32_t) startInclusive
                                                to:(int32_t) endExclusive
                                        withIndent:(NSString*) indent;
+- (void) writeExtensionTextFormatTo:(PBTextFormatWriter*) writer
+                               from:(int32_t) startInclusive
+                                 to:(int32_t) endExclusive;
+#endif
 - (BOOL) isEqualExtensionsInOther:(PBExtendableMessage*)otherMessage
                              from:(int32_t) startInclusive
                                to:(int32_t) endExclusive;
@@ -91,20 +91,33 @@
 }
 
 
+#ifndef PB_LITE_RUNTIME
 - (void) writeExtensionDescriptionToMutableString:(NSMutableString*) output
                                              from:(int32_t) startInclusive
                                                to:(int32_t) endExclusive
                                        withIndent:(NSString*) indent {
+  PBTextFormatWriter writer;
+  PBTextFormatWriterInit(&writer, indent);
+  [self writeExtensionTextFormatTo:&writer from:startInclusive to:endExclusive];
+  [output appendString:PBTextFormatWriterString(&writer)];
+  PBTextFormatWriterDestroy(&writer);
+}
+
+
+- (void) writeExtensionTextFormatTo:(PBTextFormatWriter*) writer
+                               from:(int32_t) startInclusive
+                                 to:(int32_t) endExclusive {
   NSArray* sortedKeys = [extensionMap.allKeys sortedArrayUsingSelector:@selector(compare:)];
   for (NSNumber* number in sortedKeys) {
     int32_t fieldNumber = [number intValue];
     if (fieldNumber >= startInclusive && fieldNumber < endExclusive) {
       id<PBExtensionField> extension = [extensionRegistry objectForKey:number];
       id value = [extensionMap objectForKey:number];
-      [extension writeDescriptionOf:value to:output withIndent:indent];
+      [extension writeTextFormatOf:value to:writer];
     }
-  }  
+  }
 }
+#endif
 
 
 - (BOOL) isEqualExtensionsInOther:(PBExtendableMessage*)otherMessage
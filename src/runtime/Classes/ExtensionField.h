@@ -15,6 +15,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#import "PBTextFormatWriter.h"
 #import "WireFormat.h"
 
 @class PBCodedInputStream;
@@ -37,7 +38,8 @@
                                tag:(int32_t) tag;
 - (void) writeValue:(id) value includingTagToCodedOutputStream:(PBCodedOutputStream*) output;
 - (int32_t) computeSerializedSizeIncludingTag:(id) value;
-- (void) writeDescriptionOf:(id) value
-                         to:(NSMutableString*) output
-                 withIndent:(NSString*) indent;
+#ifndef PB_LITE_RUNTIME
+- (void) writeTextFormatOf:(id) value
+                        to:(PBTextFormatWriter*) writer;
+#endif
 @end
@@ -17,6 +17,8 @@
 
 #import <Foundation/Foundation.h>
 
+#import "PBTextFormatWriter.h"
+
 @class PBArray;
 @class PBAppendableArray;
 @class PBCodedOutputStream;
@@ -44,7 +46,8 @@
 
 - (void)writeTo:(int32_t) fieldNumber output:(PBCodedOutputStream *)output;
 - (void)writeAsMessageSetExtensionTo:(int32_t)fieldNumber output:(PBCodedOutputStream *)output;
-- (void)writeDescriptionFor:(int32_t) fieldNumber
-                         to:(NSMutableString*) output
-                 withIndent:(NSString*) indent;
+#ifndef PB_LITE_RUNTIME
+- (void)writeTextFormatFor:(int32_t) fieldNumber
+                        to:(PBTextFormatWriter*) writer;
+#endif
 @end
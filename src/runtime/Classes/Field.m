@@ -125,36 +125,56 @@ static PBField *sDefaultInstance = nil;
 	}
 }
 
-- (void)writeDescriptionFor:(int32_t) fieldNumber
-                         to:(NSMutableString*) output
-                 withIndent:(NSString*) indent {
-    NSInteger arraySize;
-    
-    arraySize=_varintArray.count;
-    for (int i=0; i<arraySize ; i++) {
-        [output appendFormat:@"%@%d: %qi\n", indent, fieldNumber, [_varintArray int64AtIndex:i]];
-    }
-    
-    arraySize=_fixed32Array.count;
-    for (int i=0; i<arraySize ; i++) {
-        [output appendFormat:@"%@%d: %d\n", indent, fieldNumber, [_fixed32Array int32AtIndex:i]];
-    }
-
- 
-  arraySize=_fixed64Array.count;
-  for (int i=0; i<arraySize ; i++) {
-      [output appendFormat:@"%@%d: %qi\n", indent, fieldNumber, [_fixed64Array int64AtIndex:i]];
+#ifndef PB_LITE_RUNTIME
+// Writes the indent and "fieldNumber: ".
+static void PBFieldWriteNumber(PBTextFormatWriter* writer, int32_t fieldNumber) {
+  PBTextFormatWriterAppendIndent(writer);
+  PBTextFormatWriterAppendInt64(writer, fieldNumber);
+  PBTextFormatWriterAppendBytes(writer, ": ", 2);
+}
+
+
+- (void)writeTextFormatFor:(int32_t) fieldNumber
+                        to:(PBTextFormatWriter*) writer {
+  NSUInteger count = _varintArray.count;
+  for (NSUInteger i = 0; i < count; ++i) {
+    PBFieldWriteNumber(writer, fieldNumber);
+    PBTextFormatWriterAppendInt64(writer, [_varintArray int64AtIndex:i]);
+    PBTextFormatWriterAppendBytes(writer, "\n", 1);
   }
- 
-  for (NSData* value in self.lengthDelimitedArray) {
-    [output appendFormat:@"%@%d: %@\n", indent, fieldNumber, value];
+
+  count = _fixed32Array.count;
+  for (NSUInteger i = 0; i < count; ++i) {
+    PBFieldWriteNumber(writer, fieldNumber);
+    PBTextFormatWriterAppendInt64(writer, [_fixed32Array int32AtIndex:i]);
+    PBTextFormatWriterAppendBytes(writer, "\n", 1);
   }
-  for (PBUnknownFieldSet* value in self.groupArray) {
-    [output appendFormat:@"%@%d: [\n", indent, fieldNumber];
-    [value writeDescriptionTo:output withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@]", indent];
+
+  count = _fixed64Array.count;
+  for (NSUInteger i = 0; i < count; ++i) {
+    PBFieldWriteNumber(writer, fieldNumber);
+    PBTextFormatWriterAppendInt64(writer, [_fixed64Array int64AtIndex:i]);
+    PBTextFormatWriterAppendBytes(writer, "\n", 1);
+  }
+
+  for (NSData* value in _lengthDelimitedArray) {
+    PBFieldWriteNumber(writer, fieldNumber);
+    PBTextFormatWriterAppendObject(writer, value);
+    PBTextFormatWriterAppendBytes(writer, "\n", 1);
+  }
+
+  // Groups have always been closed without a newline.
+  for (PBUnknownFieldSet* value in _groupArray) {
+    PBFieldWriteNumber(writer, fieldNumber);
+    PBTextFormatWriterAppendBytes(writer, "[\n", 2);
+    PBTextFormatWriterPushIndent(writer);
+    [value writeTextFormatTo:writer];
+    PBTextFormatWriterPopIndent(writer);
+    PBTextFormatWriterAppendIndent(writer);
+    PBTextFormatWriterAppendBytes(writer, "]", 1);
   }
 }
+#endif
 
 - (void)writeAsMessageSetExtensionTo:(int32_t)fieldNumber output:(PBCodedOutputStream *) output {
 	for (NSData *value in _lengthDelimitedArray) {
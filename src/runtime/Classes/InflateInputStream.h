@@ -0,0 +1,43 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <zlib.h>
+
+/**
+ * An input stream that inflates zlib data read from another stream, as
+ * written by {@link PBDeflateOutputStream}, so that a
+ * {@link PBCodedInputStream} reading from it decompresses messages while
+ * they are decoded.  Compressed bytes are read from the underlying stream in
+ * blocks of up to {@code blockSize} bytes and inflated straight into the
+ * reader's buffer.
+ *
+ * Reads return 0 at the end of the compressed data and -1 if it is corrupt
+ * or the underlying stream ends first.
+ */
+@interface PBInflateInputStream : NSInputStream {
+@private
+  NSInputStream* input;
+  NSMutableData* block;
+  z_stream zstream;
+  BOOL initialized;
+  BOOL ended;
+  BOOL failed;
+}
+
++ (PBInflateInputStream*) streamWithInputStream:(NSInputStream*) input blockSize:(int32_t) blockSize;
+
+@end
@@ -0,0 +1,123 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "InflateInputStream.h"
+
+@implementation PBInflateInputStream
+
+- (id) initWithInputStream:(NSInputStream*) input_ blockSize:(int32_t) blockSize {
+  if (blockSize <= 0) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Block size must be positive" userInfo:nil];
+  }
+  if ((self = [super init])) {
+    input = input_;
+    block = [NSMutableData dataWithLength:blockSize];
+  }
+
+  return self;
+}
+
+
++ (PBInflateInputStream*) streamWithInputStream:(NSInputStream*) input blockSize:(int32_t) blockSize {
+  return [[PBInflateInputStream alloc] initWithInputStream:input blockSize:blockSize];
+}
+
+
+- (void) dealloc {
+  if (initialized) {
+    inflateEnd(&zstream);
+  }
+}
+
+
+- (void) open {
+  if (inflateInit(&zstream) != Z_OK) {
+    failed = YES;
+    return;
+  }
+  initialized = YES;
+  [input open];
+}
+
+
+- (void) close {
+  [input close];
+}
+
+
+- (NSInteger) read:(uint8_t*) buffer maxLength:(NSUInteger) len {
+  if (!initialized || failed) {
+    return -1;
+  }
+  if (ended || len == 0) {
+    return 0;
+  }
+
+  zstream.next_out = buffer;
+  zstream.avail_out = (uInt)len;
+  while (zstream.avail_out == len) {
+    if (zstream.avail_in == 0) {
+      NSInteger n = [input read:block.mutableBytes maxLength:block.length];
+      if (n <= 0) {
+        // The compressed data was cut short.
+        failed = YES;
+        return -1;
+      }
+      zstream.next_in = block.mutableBytes;
+      zstream.avail_in = (uInt)n;
+    }
+
+    int result = inflate(&zstream, Z_NO_FLUSH);
+    if (result == Z_STREAM_END) {
+      ended = YES;
+      break;
+    }
+    if (result != Z_OK && result != Z_BUF_ERROR) {
+      failed = YES;
+      return -1;
+    }
+  }
+  return len - zstream.avail_out;
+}
+
+
+- (BOOL) getBuffer:(uint8_t**) buffer length:(NSUInteger*) len {
+  return NO;
+}
+
+
+- (BOOL) hasBytesAvailable {
+  return !ended && !failed;
+}
+
+
+- (NSError*) streamError {
+  return failed ? [NSError errorWithDomain:@"zlib" code:Z_DATA_ERROR userInfo:nil] : input.streamError;
+}
+
+
+// Decompressed data can't be seeked over.
+- (id) propertyForKey:(NSString*) key {
+  return nil;
+}
+
+
+- (BOOL) setProperty:(id) property forKey:(NSString*) key {
+  return NO;
+}
+
+@end
@@ -66,6 +66,14 @@
  */
 - (NSData*) data;
 
+/**
+ * Like {@link #data}, but serializes into a buffer from the calling
+ * thread's {@link PBBufferPool} and returns a view of it without copying.
+ * The buffer is reused once the returned data is released, so repeated
+ * serialization doesn't allocate a new one each time.
+ */
+- (NSData*) pooledData;
+
 /**
  * Constructs a new builder for a message of the same type as this message.
  */
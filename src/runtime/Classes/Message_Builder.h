@@ -16,6 +16,8 @@
 // limitations under the License.
 
 #import "Message.h"
+#import "PBJSONReader.h"
+#import "PBTextFormatReader.h"
 
 @class PBCodedInputStream;
 @class PBExtensionRegistry;
@@ -133,4 +135,41 @@
  * {@link #mergeFrom(CodedInputStream,ExtensionRegistry)}.
  */
 - (id<PBMessage_Builder>) mergeFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+
+#ifndef PB_LITE_RUNTIME
+/**
+ * Parse {@code data} as UTF-8 protocol buffer text format and merge it with
+ * the message being built.  Like {@link #mergeFromData(NSData)}, this does
+ * not check that required fields are present.
+ * @throws ParseError The text is malformed or names a field this message
+ *         does not have.
+ */
+- (id<PBMessage_Builder>) mergeFromTextFormat:(NSData*) data;
+
+/**
+ * Merges the fields read from {@code reader} up to the end of the input or
+ * of the enclosing message.  Generated builders implement this; see
+ * PBTextFormatReader.h.  Builders from files with optimize_for = CODE_SIZE
+ * do not, and the default implementation throws.
+ */
+- (id<PBMessage_Builder>) mergeFromTextFormatReader:(PBTextFormatReader*) reader;
+
+/**
+ * Parse {@code data} as a UTF-8 JSON object in the proto3 JSON mapping and
+ * merge it with the message being built.  Members may use either the JSON
+ * name or the .proto name of a field.  Like {@link #mergeFromData(NSData)},
+ * this does not check that required fields are present.
+ * @throws ParseError The JSON is malformed, does not fit the message's
+ *         field types, or names a field this message does not have.
+ */
+- (id<PBMessage_Builder>) mergeFromJSON:(NSData*) data;
+
+/**
+ * Merges the members read from {@code reader} up to and including the "}"
+ * that closes the current object.  Generated builders implement this; see
+ * PBJSONReader.h.  Builders from files with optimize_for = CODE_SIZE do
+ * not, and the default implementation throws.
+ */
+- (id<PBMessage_Builder>) mergeFromJSONReader:(PBJSONReader*) reader;
+#endif
 @end
@@ -18,6 +18,8 @@
 
 #import "PBArray.h"
 
+#import "Utilities.h"
+
 NSString * const PBArrayTypeMismatchException = @"PBArrayTypeMismatchException";
 NSString * const PBArrayNumberExpectedException = @"PBArrayNumberExpectedException";
 NSString * const PBArrayAllocationFailureException = @"PBArrayAllocationFailureException";
@@ -380,7 +382,7 @@ static PBArrayValueTypeInfo PBValueTypes[] =
 			}
 		}
         const size_t size = _capacity * PBArrayValueTypeSize(_valueType);
-        _data = reallocf(_data, size);
+        _data = PBReallocf(_data, size);
         PBArrayAllocationAssert(_data, size);
 	}
 }
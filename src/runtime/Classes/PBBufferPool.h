@@ -0,0 +1,74 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+@class PBCodedOutputStream;
+
+/**
+ * A per-thread pool of serialization buffers.  Buffers are grouped in
+ * power-of-two size classes from 64 bytes to 64K; larger requests are
+ * allocated exactly and never pooled.  Each class keeps at most 16 free
+ * buffers.  Buffers may be returned on any thread and join that thread's
+ * pool, which is freed when the thread exits.
+ *
+ * The pool also keeps one coded output stream to serialize into its
+ * buffers, so steady-state serialization allocates only the returned view.
+ */
+@interface PBBufferPool : NSObject {
+@private
+  NSMutableArray* freeBuffers[11];
+  PBCodedOutputStream* stream;
+  BOOL streamInUse;
+}
+
+/** The calling thread's pool. */
++ (PBBufferPool*) currentPool;
+
+/** Returns a buffer holding at least {@code length} bytes. */
+- (NSMutableData*) takeBufferWithCapacity:(NSUInteger) length;
+
+/** Gives back a buffer from {@code takeBufferWithCapacity:}. */
+- (void) returnBuffer:(NSMutableData*) buffer;
+
+/**
+ * Returns the pool's coded output stream, writing into the start of
+ * {@code buffer}.  If that stream is already in use, as when a message's
+ * serialization serializes another message, this returns a new one.
+ */
+- (PBCodedOutputStream*) takeStreamWritingToBuffer:(NSMutableData*) buffer;
+
+/** Gives back a stream from {@code takeStreamWritingToBuffer:}. */
+- (void) returnStream:(PBCodedOutputStream*) stream;
+
+/** Frees every buffer the pool is holding. */
+- (void) drain;
+
+@end
+
+
+/**
+ * A read-only view of the first bytes of a pooled buffer.  The buffer goes
+ * back to the releasing thread's pool when the view is deallocated.
+ */
+@interface PBPooledData : NSData {
+@private
+  NSMutableData* buffer;
+  NSUInteger length;
+}
+
+- (id) initWithBuffer:(NSMutableData*) buffer length:(NSUInteger) length;
+
+@end
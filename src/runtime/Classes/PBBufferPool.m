@@ -0,0 +1,167 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "PBBufferPool.h"
+
+#import <pthread.h>
+
+#import "CodedOutputStream.h"
+
+static const NSUInteger kSmallestPooledBuffer = 64;
+static const NSUInteger kSizeClassCount = 11;  // 64 bytes to 64K
+static const NSUInteger kMaxFreeBuffersPerClass = 16;
+
+static pthread_key_t currentPoolKey;
+static pthread_once_t currentPoolKeyOnce = PTHREAD_ONCE_INIT;
+
+static void releasePool(void* pool) {
+  CFRelease(pool);
+}
+
+
+static void createCurrentPoolKey() {
+  pthread_key_create(&currentPoolKey, releasePool);
+}
+
+
+/**
+ * Returns the size class whose buffers hold {@code length} bytes, or
+ * kSizeClassCount if it is too large to pool.
+ */
+static NSUInteger sizeClassForLength(NSUInteger length) {
+  NSUInteger sizeClass = 0;
+  NSUInteger capacity = kSmallestPooledBuffer;
+  while (capacity < length && sizeClass < kSizeClassCount) {
+    capacity <<= 1;
+    sizeClass++;
+  }
+  return sizeClass;
+}
+
+
+@implementation PBBufferPool
+
+- (id) init {
+  if ((self = [super init])) {
+    for (NSUInteger i = 0; i < kSizeClassCount; i++) {
+      freeBuffers[i] = [[NSMutableArray alloc] initWithCapacity:kMaxFreeBuffersPerClass];
+    }
+  }
+
+  return self;
+}
+
+
++ (PBBufferPool*) currentPool {
+  pthread_once(&currentPoolKeyOnce, createCurrentPoolKey);
+  void* pool = pthread_getspecific(currentPoolKey);
+  if (pool == NULL) {
+    pool = (void*)CFBridgingRetain([[PBBufferPool alloc] init]);
+    pthread_setspecific(currentPoolKey, pool);
+  }
+  return (__bridge PBBufferPool*)pool;
+}
+
+
+- (NSMutableData*) takeBufferWithCapacity:(NSUInteger) length {
+  NSUInteger sizeClass = sizeClassForLength(length);
+  if (sizeClass == kSizeClassCount) {
+    return [NSMutableData dataWithLength:length];
+  }
+
+  NSMutableArray* buffers = freeBuffers[sizeClass];
+  NSMutableData* buffer = [buffers lastObject];
+  if (buffer == nil) {
+    return [NSMutableData dataWithLength:(kSmallestPooledBuffer << sizeClass)];
+  }
+  [buffers removeLastObject];
+  return buffer;
+}
+
+
+- (void) returnBuffer:(NSMutableData*) buffer {
+  NSUInteger sizeClass = sizeClassForLength(buffer.length);
+  if (sizeClass == kSizeClassCount || buffer.length != (kSmallestPooledBuffer << sizeClass)) {
+    return;
+  }
+
+  NSMutableArray* buffers = freeBuffers[sizeClass];
+  if (buffers.count < kMaxFreeBuffersPerClass) {
+    [buffers addObject:buffer];
+  }
+}
+
+
+- (PBCodedOutputStream*) takeStreamWritingToBuffer:(NSMutableData*) buffer {
+  if (streamInUse) {
+    return [PBCodedOutputStream streamWithData:buffer];
+  }
+  if (stream == nil) {
+    stream = [PBCodedOutputStream streamWithData:buffer];
+  } else {
+    [stream resetWithData:buffer];
+  }
+  streamInUse = YES;
+  return stream;
+}
+
+
+- (void) returnStream:(PBCodedOutputStream*) stream_ {
+  if (stream_ == stream) {
+    // Don't keep the buffer alive; it belongs to a PBPooledData now.
+    [stream resetWithData:nil];
+    streamInUse = NO;
+  }
+}
+
+
+- (void) drain {
+  for (NSUInteger i = 0; i < kSizeClassCount; i++) {
+    [freeBuffers[i] removeAllObjects];
+  }
+}
+
+@end
+
+
+@implementation PBPooledData
+
+- (id) initWithBuffer:(NSMutableData*) buffer_ length:(NSUInteger) length_ {
+  if ((self = [super init])) {
+    buffer = buffer_;
+    length = length_;
+  }
+
+  return self;
+}
+
+
+- (void) dealloc {
+  [[PBBufferPool currentPool] returnBuffer:buffer];
+}
+
+
+- (NSUInteger) length {
+  return length;
+}
+
+
+- (const void*) bytes {
+  return buffer.bytes;
+}
+
+@end
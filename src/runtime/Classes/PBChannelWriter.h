@@ -0,0 +1,73 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <dispatch/dispatch.h>
+
+@protocol PBMessage;
+
+/**
+ * Serializes messages on a background queue and writes them to a
+ * {@code dispatch_io_t} channel, so the calling thread neither encodes nor
+ * waits for I/O.  Writes reach the channel in the order they were
+ * submitted.
+ *
+ * On a {@code DISPATCH_IO_RANDOM} channel each write goes at the offset
+ * where the previous one ended, starting from {@code offset}, so the
+ * messages follow each other in the file as they do on a
+ * {@code DISPATCH_IO_STREAM} channel, which ignores offsets.
+ *
+ * At most {@code maxPendingWrites} writes may be in flight.  Submitting
+ * another blocks the caller until an earlier one completes, which keeps a
+ * slow file or pipe from letting serialized data pile up in memory.
+ *
+ * Each completion block is called on {@code queue} with zero on success or
+ * the errno of the failed write.
+ */
+@interface PBChannelWriter : NSObject {
+@private
+  dispatch_io_t channel;
+  dispatch_queue_t queue;
+  dispatch_queue_t serializationQueue;
+  dispatch_semaphore_t pendingWrites;
+  dispatch_group_t group;
+  /** Where the next write goes; only used on the serialization queue. */
+  off_t offset;
+}
+
+/** A writer starting at offset zero. */
++ (PBChannelWriter*) writerWithChannel:(dispatch_io_t) channel
+                                 queue:(dispatch_queue_t) queue
+                      maxPendingWrites:(long) maxPendingWrites;
+
++ (PBChannelWriter*) writerWithChannel:(dispatch_io_t) channel
+                                offset:(off_t) offset
+                                 queue:(dispatch_queue_t) queue
+                      maxPendingWrites:(long) maxPendingWrites;
+
+/** Writes {@code message} as with {@code writeToOutputStream:}. */
+- (void) writeMessage:(id<PBMessage>) message completion:(void (^)(int error)) completion;
+
+/**
+ * Writes {@code messages} as a single write, each preceded by its size as a
+ * varint so that they can be read back one at a time.
+ */
+- (void) writeDelimitedMessages:(NSArray*) messages completion:(void (^)(int error)) completion;
+
+/** Blocks until every write submitted so far has completed. */
+- (void) waitUntilDone;
+
+@end
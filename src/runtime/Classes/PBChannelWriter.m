@@ -0,0 +1,140 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "PBChannelWriter.h"
+
+#import "CodedOutputStream.h"
+#import "Message.h"
+#import "Utilities.h"
+
+@implementation PBChannelWriter
+
+- (id) initWithChannel:(dispatch_io_t) channel_
+                offset:(off_t) offset_
+                 queue:(dispatch_queue_t) queue_
+      maxPendingWrites:(long) maxPendingWrites {
+  if (maxPendingWrites <= 0) {
+    @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"maxPendingWrites must be positive" userInfo:nil];
+  }
+  if ((self = [super init])) {
+    channel = channel_;
+    offset = offset_;
+    queue = queue_;
+    serializationQueue = dispatch_queue_create("PBChannelWriter", DISPATCH_QUEUE_SERIAL);
+    pendingWrites = dispatch_semaphore_create(maxPendingWrites);
+    group = dispatch_group_create();
+#if !OS_OBJECT_USE_OBJC
+    dispatch_retain(channel);
+    dispatch_retain(queue);
+#endif
+  }
+
+  return self;
+}
+
+
++ (PBChannelWriter*) writerWithChannel:(dispatch_io_t) channel
+                                 queue:(dispatch_queue_t) queue
+                      maxPendingWrites:(long) maxPendingWrites {
+  return [[PBChannelWriter alloc] initWithChannel:channel offset:0 queue:queue maxPendingWrites:maxPendingWrites];
+}
+
+
++ (PBChannelWriter*) writerWithChannel:(dispatch_io_t) channel
+                                offset:(off_t) offset
+                                 queue:(dispatch_queue_t) queue
+                      maxPendingWrites:(long) maxPendingWrites {
+  return [[PBChannelWriter alloc] initWithChannel:channel offset:offset queue:queue maxPendingWrites:maxPendingWrites];
+}
+
+
+- (void) dealloc {
+#if !OS_OBJECT_USE_OBJC
+  dispatch_release(channel);
+  dispatch_release(queue);
+  dispatch_release(serializationQueue);
+  dispatch_release(pendingWrites);
+  dispatch_release(group);
+#endif
+}
+
+
+/**
+ * Waits for a write slot, then runs {@code serialize} on the serialization
+ * queue and writes the data it returns.
+ */
+- (void) submit:(NSData* (^)(void)) serialize completion:(void (^)(int error)) completion {
+  dispatch_semaphore_wait(pendingWrites, DISPATCH_TIME_FOREVER);
+  dispatch_group_enter(group);
+
+  dispatch_async(serializationQueue, ^{
+    NSData* data = serialize();
+    // Serialization is serial, so offsets are handed out in submission order.
+    off_t writeOffset = offset;
+    offset += data.length;
+    // The dispatch data refers to the bytes of data, which the destructor
+    // keeps alive until the write is finished with them.
+    dispatch_data_t dispatchData = dispatch_data_create(data.bytes, data.length, serializationQueue, ^{
+      (void) data;
+    });
+    dispatch_io_write(channel, writeOffset, dispatchData, queue, ^(bool done, dispatch_data_t remaining, int error) {
+      if (!done) {
+        return;
+      }
+      if (completion != nil) {
+        completion(error);
+      }
+      dispatch_semaphore_signal(pendingWrites);
+      dispatch_group_leave(group);
+    });
+#if !OS_OBJECT_USE_OBJC
+    dispatch_release(dispatchData);
+#endif
+  });
+}
+
+
+- (void) writeMessage:(id<PBMessage>) message completion:(void (^)(int error)) completion {
+  [self submit:^{ return [message data]; } completion:completion];
+}
+
+
+- (void) writeDelimitedMessages:(NSArray*) messages completion:(void (^)(int error)) completion {
+  NSArray* batch = [messages copy];
+  [self submit:^{
+    int32_t size = 0;
+    for (id<PBMessage> message in batch) {
+      int32_t messageSize = message.serializedSize;
+      size += computeRawVarint32Size(messageSize) + messageSize;
+    }
+
+    NSMutableData* data = [NSMutableData dataWithLength:size];
+    PBCodedOutputStream* output = [PBCodedOutputStream streamWithData:data];
+    for (id<PBMessage> message in batch) {
+      [output writeRawVarint32:message.serializedSize];
+      [message writeToCodedOutputStream:output];
+    }
+    return (NSData*)data;
+  } completion:completion];
+}
+
+
+- (void) waitUntilDone {
+  dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+}
+
+@end
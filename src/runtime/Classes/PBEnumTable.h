@@ -0,0 +1,49 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Lookup tables behind the generated enum functions.  The generator sorts an
+ * enum's values, so an index into the sorted values is also an index into
+ * the matching name table.
+ *
+ * Enums whose values are not one contiguous range keep their sorted values
+ * in an array, searched with PBEnumTableIndexOfValue().
+ */
+NSInteger PBEnumTableIndexOfValue(const int32_t* values, NSUInteger count, int32_t value);
+
+/**
+ * Names are looked up through a two level perfect hash built by the
+ * generator: the seed for a name's bucket picks the one slot the name can
+ * be in, so a lookup costs two hashes and one strcmp.  If the generator
+ * found no seeds, seeds is NULL and the names are searched in order.
+ */
+typedef struct _PBEnumNameTable
+{
+	const char* const*  names;
+	NSUInteger          count;
+	const uint32_t*     seeds;          // One per bucket, or NULL.
+	NSUInteger          seedCount;
+	const int32_t*      slots;          // Index into names of the name in each slot.
+	NSUInteger          slotCount;
+} PBEnumNameTable;
+
+uint32_t PBEnumTableHashName(const char* name, uint32_t seed);
+
+/**
+ * Returns the index of name in the table, or -1.
+ */
+NSInteger PBEnumTableIndexOfName(const PBEnumNameTable* table, const char* name);
@@ -0,0 +1,68 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "PBEnumTable.h"
+
+NSInteger PBEnumTableIndexOfValue(const int32_t* values, NSUInteger count, int32_t value) {
+  NSUInteger low = 0;
+  NSUInteger high = count;
+  while (low < high) {
+    NSUInteger middle = low + (high - low) / 2;
+    if (values[middle] < value) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return (low < count && values[low] == value) ? (NSInteger)low : -1;
+}
+
+
+// FNV-1a with the seed mixed into the offset basis, followed by the
+// MurmurHash3 finalizer so that every bit of the result depends on the
+// seed.  The generator computes the same function; the two must not drift.
+uint32_t PBEnumTableHashName(const char* name, uint32_t seed) {
+  uint32_t hash = 2166136261U ^ seed;
+  for (const uint8_t* c = (const uint8_t*)name; *c != 0; ++c) {
+    hash = (hash ^ *c) * 16777619U;
+  }
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bU;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35U;
+  hash ^= hash >> 16;
+  return hash;
+}
+
+
+NSInteger PBEnumTableIndexOfName(const PBEnumNameTable* table, const char* name) {
+  if (name == NULL) {
+    return -1;
+  }
+  if (table->seeds == NULL) {
+    for (NSUInteger i = 0; i < table->count; ++i) {
+      if (strcmp(table->names[i], name) == 0) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  uint32_t seed = table->seeds[PBEnumTableHashName(name, 0) % table->seedCount];
+  int32_t index = table->slots[PBEnumTableHashName(name, seed) % table->slotCount];
+  return strcmp(table->names[index], name) == 0 ? index : -1;
+}
@@ -0,0 +1,72 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <dispatch/dispatch.h>
+
+#import "PBTextFormatWriter.h"
+
+@class PBGeneratedMessage;
+
+/**
+ * Messages in files with {@code option optimize_for = CODE_SIZE} do not get
+ * generated per-field description, equality and hash code.  Instead the
+ * generator emits a static PBFieldTable listing the fields and extension
+ * ranges in field number order, and the three methods forward to the
+ * functions below, which walk the table through the message's accessors.
+ *
+ * The results are the same as the generated code's, except that repeated
+ * 64-bit and floating point values print correctly in descriptions.
+ */
+typedef enum _PBFieldTableType
+{
+	PBFieldTableTypeBool,
+	PBFieldTableTypeInt32,
+	PBFieldTableTypeUInt32,
+	PBFieldTableTypeInt64,
+	PBFieldTableTypeUInt64,
+	PBFieldTableTypeFloat,
+	PBFieldTableTypeDouble,
+	PBFieldTableTypeEnum,
+	PBFieldTableTypeObject,             // NSString or NSData
+	PBFieldTableTypeMessage,
+	PBFieldTableTypeExtensionRange,
+} PBFieldTableType;
+
+typedef struct _PBFieldTableEntry
+{
+	const char*       name;             // The getter, also printed by descriptions.
+	const char*       hasSelector;      // NULL for repeated fields.
+	PBFieldTableType  type;
+	int32_t           number;           // Start of an extension range.
+	int32_t           end;              // End of an extension range, else 0.
+} PBFieldTableEntry;
+
+typedef struct _PBFieldTable
+{
+	const PBFieldTableEntry* entries;
+	NSUInteger               count;
+
+	// Selectors are looked up by name once, on first use.
+	dispatch_once_t          resolved;
+	SEL*                     selectors;
+} PBFieldTable;
+
+#ifndef PB_LITE_RUNTIME
+void PBFieldTableWriteTextFormat(PBFieldTable* table, PBGeneratedMessage* message, PBTextFormatWriter* writer);
+#endif
+BOOL PBFieldTableIsEqual(PBFieldTable* table, PBGeneratedMessage* message, id other);
+NSUInteger PBFieldTableHash(PBFieldTable* table, PBGeneratedMessage* message);
@@ -0,0 +1,318 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "PBFieldTable.h"
+
+#import <objc/runtime.h>
+
+#import "ExtendableMessage.h"
+#import "PBArray.h"
+#import "PBGeneratedMessage.h"
+#import "UnknownFieldSet.h"
+
+// Calls a getter through its IMP cast to the getter's real type, which is
+// correct for every return type on every ABI, unlike -valueForKey:.
+#define PBFieldTableGet(type, message, selector) \
+  (((type (*)(id, SEL))[message methodForSelector:selector])(message, selector))
+
+static SEL* PBFieldTableSelectors(PBFieldTable* table) {
+  dispatch_once(&table->resolved, ^{
+    SEL* selectors = calloc(table->count * 2, sizeof(SEL));
+    for (NSUInteger i = 0; i < table->count; ++i) {
+      const PBFieldTableEntry* entry = &table->entries[i];
+      if (entry->name != NULL) {
+        selectors[i * 2] = sel_registerName(entry->name);
+      }
+      if (entry->hasSelector != NULL) {
+        selectors[i * 2 + 1] = sel_registerName(entry->hasSelector);
+      }
+    }
+    table->selectors = selectors;
+  });
+  return table->selectors;
+}
+
+
+static BOOL PBFieldTableIsRepeated(const PBFieldTableEntry* entry) {
+  return entry->hasSelector == NULL;
+}
+
+
+static BOOL PBFieldTableIsObject(const PBFieldTableEntry* entry) {
+  return entry->type == PBFieldTableTypeObject || entry->type == PBFieldTableTypeMessage;
+}
+
+
+// Boxes a singular field the way generated code does with @(self.field).
+static id PBFieldTableBoxedValue(const PBFieldTableEntry* entry, PBGeneratedMessage* message, SEL getter) {
+  switch (entry->type) {
+    case PBFieldTableTypeBool:
+      return @(PBFieldTableGet(BOOL, message, getter));
+    case PBFieldTableTypeInt32:
+    case PBFieldTableTypeEnum:
+      return @(PBFieldTableGet(int32_t, message, getter));
+    case PBFieldTableTypeUInt32:
+      return @(PBFieldTableGet(uint32_t, message, getter));
+    case PBFieldTableTypeInt64:
+      return @(PBFieldTableGet(int64_t, message, getter));
+    case PBFieldTableTypeUInt64:
+      return @(PBFieldTableGet(uint64_t, message, getter));
+    case PBFieldTableTypeFloat:
+      return @(PBFieldTableGet(Float32, message, getter));
+    case PBFieldTableTypeDouble:
+      return @(PBFieldTableGet(Float64, message, getter));
+    case PBFieldTableTypeObject:
+    case PBFieldTableTypeMessage:
+    case PBFieldTableTypeExtensionRange:
+      return PBFieldTableGet(id, message, getter);
+  }
+  return nil;
+}
+
+
+#ifndef PB_LITE_RUNTIME
+static void PBFieldTableWriteArray(const PBFieldTableEntry* entry, PBArray* array, PBTextFormatWriter* writer) {
+  const NSUInteger count = array.count;
+  for (NSUInteger i = 0; i < count; ++i) {
+    switch (array.valueType) {
+      case PBArrayValueTypeBool:
+        PBTextFormatWriteBool(writer, entry->name, [array boolAtIndex:i]);
+        break;
+      case PBArrayValueTypeInt32:
+        PBTextFormatWriteInt32(writer, entry->name, [array int32AtIndex:i]);
+        break;
+      case PBArrayValueTypeUInt32:
+        PBTextFormatWriteUInt32(writer, entry->name, [array uint32AtIndex:i]);
+        break;
+      case PBArrayValueTypeInt64:
+        PBTextFormatWriteInt64(writer, entry->name, [array int64AtIndex:i]);
+        break;
+      case PBArrayValueTypeUInt64:
+        PBTextFormatWriteUInt64(writer, entry->name, [array uint64AtIndex:i]);
+        break;
+      case PBArrayValueTypeFloat:
+        PBTextFormatWriteFloat(writer, entry->name, [array floatAtIndex:i]);
+        break;
+      case PBArrayValueTypeDouble:
+        PBTextFormatWriteDouble(writer, entry->name, [array doubleAtIndex:i]);
+        break;
+    }
+  }
+}
+
+
+static void PBFieldTableWriteValue(const PBFieldTableEntry* entry, PBGeneratedMessage* message, SEL getter, PBTextFormatWriter* writer) {
+  switch (entry->type) {
+    case PBFieldTableTypeBool:
+      PBTextFormatWriteBool(writer, entry->name, PBFieldTableGet(BOOL, message, getter));
+      return;
+    case PBFieldTableTypeInt32:
+    case PBFieldTableTypeEnum:
+      PBTextFormatWriteInt32(writer, entry->name, PBFieldTableGet(int32_t, message, getter));
+      return;
+    case PBFieldTableTypeUInt32:
+      PBTextFormatWriteUInt32(writer, entry->name, PBFieldTableGet(uint32_t, message, getter));
+      return;
+    case PBFieldTableTypeInt64:
+      PBTextFormatWriteInt64(writer, entry->name, PBFieldTableGet(int64_t, message, getter));
+      return;
+    case PBFieldTableTypeUInt64:
+      PBTextFormatWriteUInt64(writer, entry->name, PBFieldTableGet(uint64_t, message, getter));
+      return;
+    case PBFieldTableTypeFloat:
+      PBTextFormatWriteFloat(writer, entry->name, PBFieldTableGet(Float32, message, getter));
+      return;
+    case PBFieldTableTypeDouble:
+      PBTextFormatWriteDouble(writer, entry->name, PBFieldTableGet(Float64, message, getter));
+      return;
+    case PBFieldTableTypeObject:
+      PBTextFormatWriteObject(writer, entry->name, PBFieldTableGet(id, message, getter));
+      return;
+    case PBFieldTableTypeMessage:
+      PBTextFormatWriteMessage(writer, entry->name, PBFieldTableGet(id, message, getter));
+      return;
+    case PBFieldTableTypeExtensionRange:
+      return;
+  }
+}
+
+
+void PBFieldTableWriteTextFormat(PBFieldTable* table, PBGeneratedMessage* message, PBTextFormatWriter* writer) {
+  SEL* selectors = PBFieldTableSelectors(table);
+  for (NSUInteger i = 0; i < table->count; ++i) {
+    const PBFieldTableEntry* entry = &table->entries[i];
+    SEL getter = selectors[i * 2];
+
+    if (entry->type == PBFieldTableTypeExtensionRange) {
+      [(PBExtendableMessage*)message writeExtensionTextFormatTo:writer
+                                                          from:entry->number
+                                                            to:entry->end];
+    } else if (PBFieldTableIsRepeated(entry)) {
+      id values = PBFieldTableGet(id, message, getter);
+      if (entry->type == PBFieldTableTypeMessage) {
+        for (PBGeneratedMessage* element in values) {
+          PBTextFormatWriteMessage(writer, entry->name, element);
+        }
+      } else if (entry->type == PBFieldTableTypeObject) {
+        for (id element in values) {
+          PBTextFormatWriteObject(writer, entry->name, element);
+        }
+      } else {
+        PBFieldTableWriteArray(entry, values, writer);
+      }
+    } else if (PBFieldTableGet(BOOL, message, selectors[i * 2 + 1])) {
+      PBFieldTableWriteValue(entry, message, getter, writer);
+    }
+  }
+  [message.unknownFields writeTextFormatTo:writer];
+}
+#endif
+
+
+static BOOL PBFieldTableValuesEqual(const PBFieldTableEntry* entry, PBGeneratedMessage* message, PBGeneratedMessage* other, SEL getter) {
+  switch (entry->type) {
+    case PBFieldTableTypeBool:
+      return PBFieldTableGet(BOOL, message, getter) == PBFieldTableGet(BOOL, other, getter);
+    case PBFieldTableTypeInt32:
+    case PBFieldTableTypeEnum:
+      return PBFieldTableGet(int32_t, message, getter) == PBFieldTableGet(int32_t, other, getter);
+    case PBFieldTableTypeUInt32:
+      return PBFieldTableGet(uint32_t, message, getter) == PBFieldTableGet(uint32_t, other, getter);
+    case PBFieldTableTypeInt64:
+      return PBFieldTableGet(int64_t, message, getter) == PBFieldTableGet(int64_t, other, getter);
+    case PBFieldTableTypeUInt64:
+      return PBFieldTableGet(uint64_t, message, getter) == PBFieldTableGet(uint64_t, other, getter);
+    case PBFieldTableTypeFloat:
+      return PBFieldTableGet(Float32, message, getter) == PBFieldTableGet(Float32, other, getter);
+    case PBFieldTableTypeDouble:
+      return PBFieldTableGet(Float64, message, getter) == PBFieldTableGet(Float64, other, getter);
+    case PBFieldTableTypeObject:
+    case PBFieldTableTypeMessage:
+    case PBFieldTableTypeExtensionRange:
+      return [PBFieldTableGet(id, message, getter) isEqual:PBFieldTableGet(id, other, getter)];
+  }
+  return NO;
+}
+
+
+BOOL PBFieldTableIsEqual(PBFieldTable* table, PBGeneratedMessage* message, id other) {
+  if (other == message) {
+    return YES;
+  }
+  if (![other isKindOfClass:[message class]]) {
+    return NO;
+  }
+  PBGeneratedMessage* otherMessage = other;
+
+  SEL* selectors = PBFieldTableSelectors(table);
+  for (NSUInteger i = 0; i < table->count; ++i) {
+    const PBFieldTableEntry* entry = &table->entries[i];
+    SEL getter = selectors[i * 2];
+
+    if (entry->type == PBFieldTableTypeExtensionRange) {
+      if (![(PBExtendableMessage*)message isEqualExtensionsInOther:(PBExtendableMessage*)otherMessage
+                                                              from:entry->number
+                                                                to:entry->end]) {
+        return NO;
+      }
+    } else if (PBFieldTableIsRepeated(entry)) {
+      id values = PBFieldTableGet(id, message, getter);
+      id otherValues = PBFieldTableGet(id, otherMessage, getter);
+      if (values != otherValues && ![values isEqualToArray:otherValues]) {
+        return NO;
+      }
+    } else {
+      SEL hasSelector = selectors[i * 2 + 1];
+      BOOL has = PBFieldTableGet(BOOL, message, hasSelector);
+      if (has != PBFieldTableGet(BOOL, otherMessage, hasSelector)) {
+        return NO;
+      }
+      if (has && !PBFieldTableValuesEqual(entry, message, otherMessage, getter)) {
+        return NO;
+      }
+    }
+  }
+
+  return message.unknownFields == otherMessage.unknownFields ||
+         (message.unknownFields != nil && [message.unknownFields isEqual:otherMessage.unknownFields]);
+}
+
+
+// Hashes each element of a primitive array the way generated code does,
+// by adding its value in the array's own type.
+static NSUInteger PBFieldTableHashArray(NSUInteger hashCode, PBArray* array) {
+  const NSUInteger count = array.count;
+  for (NSUInteger i = 0; i < count; ++i) {
+    switch (array.valueType) {
+      case PBArrayValueTypeBool:
+        hashCode = hashCode * 31 + [array boolAtIndex:i];
+        break;
+      case PBArrayValueTypeInt32:
+        hashCode = hashCode * 31 + [array int32AtIndex:i];
+        break;
+      case PBArrayValueTypeUInt32:
+        hashCode = hashCode * 31 + [array uint32AtIndex:i];
+        break;
+      case PBArrayValueTypeInt64:
+        hashCode = hashCode * 31 + [array int64AtIndex:i];
+        break;
+      case PBArrayValueTypeUInt64:
+        hashCode = hashCode * 31 + [array uint64AtIndex:i];
+        break;
+      case PBArrayValueTypeFloat:
+        hashCode = hashCode * 31 + [array floatAtIndex:i];
+        break;
+      case PBArrayValueTypeDouble:
+        hashCode = hashCode * 31 + [array doubleAtIndex:i];
+        break;
+    }
+  }
+  return hashCode;
+}
+
+
+NSUInteger PBFieldTableHash(PBFieldTable* table, PBGeneratedMessage* message) {
+  NSUInteger hashCode = 7;
+
+  SEL* selectors = PBFieldTableSelectors(table);
+  for (NSUInteger i = 0; i < table->count; ++i) {
+    const PBFieldTableEntry* entry = &table->entries[i];
+    SEL getter = selectors[i * 2];
+
+    if (entry->type == PBFieldTableTypeExtensionRange) {
+      hashCode = hashCode * 31 + [(PBExtendableMessage*)message hashExtensionsFrom:entry->number to:entry->end];
+    } else if (PBFieldTableIsRepeated(entry)) {
+      id values = PBFieldTableGet(id, message, getter);
+      if (PBFieldTableIsObject(entry)) {
+        for (id element in values) {
+          hashCode = hashCode * 31 + [element hash];
+        }
+      } else {
+        hashCode = PBFieldTableHashArray(hashCode, values);
+      }
+    } else if (PBFieldTableGet(BOOL, message, selectors[i * 2 + 1])) {
+      if (entry->type == PBFieldTableTypeEnum) {
+        hashCode = hashCode * 31 + PBFieldTableGet(int32_t, message, getter);
+      } else {
+        hashCode = hashCode * 31 + [PBFieldTableBoxedValue(entry, message, getter) hash];
+      }
+    }
+  }
+
+  hashCode = hashCode * 31 + [message.unknownFields hash];
+  return hashCode;
+}
@@ -0,0 +1,124 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PB_LITE_RUNTIME
+
+@protocol PBMessage_Builder;
+
+/**
+ * Parses the proto3 JSON form of a message straight from a UTF-8 buffer,
+ * without building NSDictionary or NSArray trees.  Members may be named by
+ * their lowerCamelCase JSON name or by their name in the .proto file, and
+ * null leaves a field unset.  Integers may be quoted, 64-bit ones usually
+ * are, and integral values in exponent form are accepted.  Enum values may
+ * be given by name or by number.
+ *
+ * Generated builders implement -mergeFromJSONReader: by calling
+ * PBJSONReaderReadMemberName in a loop and one of the value readers below for
+ * each member they recognize.  Names and numbers are scanned in place; only
+ * names and strings that contain escapes are decoded, into a buffer that the
+ * reader reuses.  Malformed input throws a "ParseError" exception whose
+ * reason starts with the line and column of the problem.
+ *
+ * Extensions ("[full.name]" members) and Any are not supported.
+ */
+typedef struct _PBJSONReader
+{
+	const uint8_t*  start;
+	const uint8_t*  position;
+	const uint8_t*  end;
+
+	int32_t         recursionDepth;
+	int32_t         recursionLimit;
+
+	// Unknown members are skipped when set, and throw otherwise.
+	BOOL            ignoreUnknownFields;
+
+	// Set right after "{", "[" or ",", where a member or element must follow.
+	BOOL            expectingItem;
+
+	// Where the member name last read starts, for error messages.
+	const uint8_t*  memberPosition;
+
+	// Escaped names and strings are decoded here.
+	uint8_t*        scratch;
+	NSUInteger      scratchLength;
+	NSUInteger      scratchCapacity;
+} PBJSONReader;
+
+/**
+ * Sets up a reader over length bytes, which must stay alive and unchanged
+ * while it is used.  Every reader must be passed to PBJSONReaderDestroy.
+ */
+void PBJSONReaderInit(PBJSONReader* reader, const void* bytes, NSUInteger length);
+void PBJSONReaderDestroy(PBJSONReader* reader);
+
+/**
+ * Merges the object that makes up the input into builder, and throws if
+ * anything other than whitespace is left over.
+ */
+void PBJSONReaderReadRootMessage(PBJSONReader* reader, id<PBMessage_Builder> builder);
+
+/**
+ * Reads the next member name and the ":" after it into name and length,
+ * which point into the input or into the reader's buffer until the next
+ * string is read.  Returns NO instead once it has read the closing "}".
+ */
+BOOL PBJSONReaderReadMemberName(PBJSONReader* reader, const char** name, NSUInteger* length);
+
+/** Reads a null value and returns YES, or returns NO if the value is not null. */
+BOOL PBJSONReaderReadNull(PBJSONReader* reader);
+
+/**
+ * Skips the value of a member the builder did not recognize, or throws if
+ * the reader does not ignore unknown fields.
+ */
+void PBJSONReaderUnknownMember(PBJSONReader* reader, const char* name, NSUInteger length);
+
+/**
+ * Reads the "[" that starts the value of a repeated field.
+ * PBJSONReaderHasNextElement then returns YES before each element and NO
+ * once it has read the closing "]".
+ */
+void PBJSONReaderBeginArray(PBJSONReader* reader);
+BOOL PBJSONReaderHasNextElement(PBJSONReader* reader);
+
+int32_t PBJSONReaderReadInt32(PBJSONReader* reader);
+uint32_t PBJSONReaderReadUInt32(PBJSONReader* reader);
+int64_t PBJSONReaderReadInt64(PBJSONReader* reader);
+uint64_t PBJSONReaderReadUInt64(PBJSONReader* reader);
+BOOL PBJSONReaderReadBool(PBJSONReader* reader);
+Float32 PBJSONReaderReadFloat(PBJSONReader* reader);
+Float64 PBJSONReaderReadDouble(PBJSONReader* reader);
+NSString* PBJSONReaderReadString(PBJSONReader* reader);
+
+/** Reads base64, in either the standard or the URL-safe alphabet, with or without padding. */
+NSData* PBJSONReaderReadData(PBJSONReader* reader);
+
+/**
+ * Reads an enum value given either as one of the count names or as a
+ * number, and returns the matching entry of values.  Anything else throws.
+ */
+int32_t PBJSONReaderReadEnum(PBJSONReader* reader, const char* const* names, const int32_t* values, NSUInteger count);
+
+/**
+ * Reads an object and merges its members into builder through
+ * -mergeFromJSONReader:.
+ */
+void PBJSONReaderReadMessage(PBJSONReader* reader, id<PBMessage_Builder> builder);
+
+#endif
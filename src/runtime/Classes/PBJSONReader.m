@@ -0,0 +1,759 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "PBJSONReader.h"
+
+#ifndef PB_LITE_RUNTIME
+
+#import "Message_Builder.h"
+#import "Utilities.h"
+
+static const int32_t kDefaultRecursionLimit = 64;
+static const NSUInteger kInitialScratchCapacity = 64;
+
+static void PBJSONReaderFail(PBJSONReader* reader, NSString* format, ...) NS_FORMAT_FUNCTION(2,3) __attribute__((noreturn));
+
+
+static void PBJSONReaderFail(PBJSONReader* reader, NSString* format, ...) {
+  // Lines and columns are only counted once something has gone wrong.
+  NSUInteger line = 1;
+  const uint8_t* lineStart = reader->start;
+  for (const uint8_t* p = reader->start; p < reader->position; ++p) {
+    if (*p == '\n') {
+      ++line;
+      lineStart = p + 1;
+    }
+  }
+
+  va_list arguments;
+  va_start(arguments, format);
+  NSString* message = [[NSString alloc] initWithFormat:format arguments:arguments];
+  va_end(arguments);
+
+  NSString* reason = [NSString stringWithFormat:@"%lu:%lu: %@",
+                      (unsigned long)line, (unsigned long)(reader->position - lineStart + 1), message];
+  @throw [NSException exceptionWithName:@"ParseError" reason:reason userInfo:nil];
+}
+
+
+static inline BOOL PBJSONIsDigit(int c) {
+  return c >= '0' && c <= '9';
+}
+
+
+static inline BOOL PBJSONIsHexDigit(int c) {
+  return PBJSONIsDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+
+static inline uint32_t PBJSONHexValue(uint8_t c) {
+  if (c <= '9') {
+    return c - '0';
+  }
+  return (c | 0x20) - 'a' + 10;
+}
+
+
+/** Returns the next byte after any whitespace, or -1 at the end. */
+static int PBJSONReaderPeek(PBJSONReader* reader) {
+  const uint8_t* p = reader->position;
+  const uint8_t* end = reader->end;
+  while (p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t')) {
+    ++p;
+  }
+  reader->position = p;
+  return p < end ? *p : -1;
+}
+
+
+static void PBJSONReaderConsume(PBJSONReader* reader, uint8_t c) {
+  if (PBJSONReaderPeek(reader) != c) {
+    PBJSONReaderFail(reader, @"Expected \"%c\".", c);
+  }
+  ++reader->position;
+}
+
+
+/** Reads true, false or null, which must not run on into letters or digits. */
+static BOOL PBJSONReaderTryConsumeLiteral(PBJSONReader* reader, const char* literal, NSUInteger length) {
+  PBJSONReaderPeek(reader);
+  const uint8_t* p = reader->position;
+  if ((NSUInteger)(reader->end - p) < length || memcmp(p, literal, length) != 0) {
+    return NO;
+  }
+  p += length;
+  if (p < reader->end && (isalnum(*p) || *p == '_')) {
+    return NO;
+  }
+  reader->position = p;
+  return YES;
+}
+
+
+void PBJSONReaderInit(PBJSONReader* reader, const void* bytes, NSUInteger length) {
+  memset(reader, 0, sizeof(*reader));
+  reader->start = bytes;
+  reader->position = bytes;
+  reader->end = reader->start + length;
+  reader->recursionLimit = kDefaultRecursionLimit;
+}
+
+
+void PBJSONReaderDestroy(PBJSONReader* reader) {
+  free(reader->scratch);
+  memset(reader, 0, sizeof(*reader));
+}
+
+
+static void PBJSONReaderScratchAppend(PBJSONReader* reader, const void* bytes, NSUInteger length) {
+  if (reader->scratchCapacity - reader->scratchLength < length) {
+    reader->scratchCapacity = MAX(MAX(kInitialScratchCapacity, reader->scratchCapacity * 2),
+                                  reader->scratchLength + length);
+    reader->scratch = PBReallocf(reader->scratch, reader->scratchCapacity);
+    if (reader->scratch == NULL) {
+      @throw [NSException exceptionWithName:NSMallocException reason:@"" userInfo:nil];
+    }
+  }
+  if (length > 0) {
+    memcpy(reader->scratch + reader->scratchLength, bytes, length);
+    reader->scratchLength += length;
+  }
+}
+
+
+static void PBJSONReaderScratchAppendCodePoint(PBJSONReader* reader, uint32_t codePoint) {
+  uint8_t bytes[4];
+  NSUInteger length;
+  if (codePoint < 0x80) {
+    bytes[0] = (uint8_t)codePoint;
+    length = 1;
+  } else if (codePoint < 0x800) {
+    bytes[0] = (uint8_t)(0xC0 | (codePoint >> 6));
+    bytes[1] = (uint8_t)(0x80 | (codePoint & 0x3F));
+    length = 2;
+  } else if (codePoint < 0x10000) {
+    bytes[0] = (uint8_t)(0xE0 | (codePoint >> 12));
+    bytes[1] = (uint8_t)(0x80 | ((codePoint >> 6) & 0x3F));
+    bytes[2] = (uint8_t)(0x80 | (codePoint & 0x3F));
+    length = 3;
+  } else {
+    bytes[0] = (uint8_t)(0xF0 | (codePoint >> 18));
+    bytes[1] = (uint8_t)(0x80 | ((codePoint >> 12) & 0x3F));
+    bytes[2] = (uint8_t)(0x80 | ((codePoint >> 6) & 0x3F));
+    bytes[3] = (uint8_t)(0x80 | (codePoint & 0x3F));
+    length = 4;
+  }
+  PBJSONReaderScratchAppend(reader, bytes, length);
+}
+
+
+static uint32_t PBJSONReaderScanHex4(PBJSONReader* reader, const uint8_t* p) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i, ++p) {
+    if (p == reader->end || !PBJSONIsHexDigit(*p)) {
+      reader->position = p;
+      PBJSONReaderFail(reader, @"Invalid Unicode escape sequence.");
+    }
+    value = (value << 4) | PBJSONHexValue(*p);
+  }
+  return value;
+}
+
+
+/**
+ * Decodes the escape sequence after a backslash at p into the scratch
+ * buffer and returns the position after it.
+ */
+static const uint8_t* PBJSONReaderScanEscape(PBJSONReader* reader, const uint8_t* p) {
+  if (p == reader->end) {
+    PBJSONReaderFail(reader, @"Unterminated string.");
+  }
+  uint8_t byte;
+  switch (*p++) {
+    case '"':  byte = '"';  break;
+    case '\\': byte = '\\'; break;
+    case '/':  byte = '/';  break;
+    case 'b':  byte = '\b'; break;
+    case 'f':  byte = '\f'; break;
+    case 'n':  byte = '\n'; break;
+    case 'r':  byte = '\r'; break;
+    case 't':  byte = '\t'; break;
+
+    case 'u': {
+      uint32_t codePoint = PBJSONReaderScanHex4(reader, p);
+      p += 4;
+      // Characters outside the BMP are written as a UTF-16 surrogate pair.
+      if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+        if (reader->end - p < 6 || p[0] != '\\' || p[1] != 'u') {
+          reader->position = p;
+          PBJSONReaderFail(reader, @"Unpaired surrogate in Unicode escape sequence.");
+        }
+        uint32_t low = PBJSONReaderScanHex4(reader, p + 2);
+        if (low < 0xDC00 || low > 0xDFFF) {
+          reader->position = p;
+          PBJSONReaderFail(reader, @"Unpaired surrogate in Unicode escape sequence.");
+        }
+        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+        p += 6;
+      } else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+        reader->position = p - 6;
+        PBJSONReaderFail(reader, @"Unpaired surrogate in Unicode escape sequence.");
+      }
+      PBJSONReaderScratchAppendCodePoint(reader, codePoint);
+      return p;
+    }
+
+    default:
+      reader->position = p - 2;
+      PBJSONReaderFail(reader, @"Invalid escape sequence.");
+  }
+  PBJSONReaderScratchAppend(reader, &byte, 1);
+  return p;
+}
+
+
+/**
+ * Scans the string that starts at the current position, which must be a
+ * quote.  The contents are left in place when there are no escapes, and
+ * decoded into the scratch buffer otherwise.
+ */
+static void PBJSONReaderScanString(PBJSONReader* reader, const uint8_t** bytes, NSUInteger* length) {
+  const uint8_t* p = reader->position + 1;
+  const uint8_t* end = reader->end;
+  const uint8_t* run = p;
+  while (p < end && *p != '"' && *p != '\\' && *p >= 0x20) {
+    ++p;
+  }
+  if (p < end && *p == '"') {
+    *bytes = run;
+    *length = p - run;
+    reader->position = p + 1;
+    return;
+  }
+
+  reader->scratchLength = 0;
+  for (;;) {
+    PBJSONReaderScratchAppend(reader, run, p - run);
+    if (p == end) {
+      PBJSONReaderFail(reader, @"Unterminated string.");
+    }
+    if (*p == '"') {
+      break;
+    }
+    if (*p < 0x20) {
+      reader->position = p;
+      PBJSONReaderFail(reader, @"Control character in string.");
+    }
+    p = PBJSONReaderScanEscape(reader, p + 1);
+    run = p;
+    while (p < end && *p != '"' && *p != '\\' && *p >= 0x20) {
+      ++p;
+    }
+  }
+  *bytes = reader->scratch;
+  *length = reader->scratchLength;
+  reader->position = p + 1;
+}
+
+
+BOOL PBJSONReaderReadMemberName(PBJSONReader* reader, const char** name, NSUInteger* length) {
+  int c = PBJSONReaderPeek(reader);
+  if (reader->expectingItem) {
+    reader->expectingItem = NO;
+    if (c == '}') {
+      ++reader->position;
+      return NO;
+    }
+  } else if (c == '}') {
+    ++reader->position;
+    return NO;
+  } else if (c == ',') {
+    ++reader->position;
+    c = PBJSONReaderPeek(reader);
+  } else {
+    PBJSONReaderFail(reader, @"Expected \",\" or \"}\".");
+  }
+
+  if (c != '"') {
+    PBJSONReaderFail(reader, @"Expected a member name.");
+  }
+  reader->memberPosition = reader->position;
+  const uint8_t* bytes;
+  PBJSONReaderScanString(reader, &bytes, length);
+  if (*length > 0 && bytes[0] == '[') {
+    reader->position = reader->memberPosition;
+    PBJSONReaderFail(reader, @"Extensions are not supported.");
+  }
+  *name = (const char*)bytes;
+  PBJSONReaderConsume(reader, ':');
+  return YES;
+}
+
+
+BOOL PBJSONReaderReadNull(PBJSONReader* reader) {
+  return PBJSONReaderTryConsumeLiteral(reader, "null", 4);
+}
+
+
+void PBJSONReaderBeginArray(PBJSONReader* reader) {
+  PBJSONReaderConsume(reader, '[');
+  reader->expectingItem = YES;
+}
+
+
+BOOL PBJSONReaderHasNextElement(PBJSONReader* reader) {
+  int c = PBJSONReaderPeek(reader);
+  if (reader->expectingItem) {
+    reader->expectingItem = NO;
+    if (c == ']') {
+      ++reader->position;
+      return NO;
+    }
+    return YES;
+  }
+  if (c == ']') {
+    ++reader->position;
+    return NO;
+  }
+  if (c != ',') {
+    PBJSONReaderFail(reader, @"Expected \",\" or \"]\".");
+  }
+  ++reader->position;
+  return YES;
+}
+
+
+/**
+ * Scans an unsigned JSON number (no leading zeros, and digits on both sides
+ * of any decimal point) into up to 19 significant digits and a decimal
+ * exponent for convertDecimalToFloat64.
+ */
+static Float64 PBJSONReaderScanUnsignedDouble(PBJSONReader* reader) {
+  const uint8_t* p = reader->position;
+  const uint8_t* end = reader->end;
+  const uint8_t* numberStart = p;
+  uint64_t mantissa = 0;
+  int32_t significantDigits = 0;
+  int32_t exponent = 0;
+  BOOL exact = YES;
+
+  if (p == end || !PBJSONIsDigit(*p)) {
+    PBJSONReaderFail(reader, @"Expected a number.");
+  }
+  if (*p == '0' && p + 1 < end && PBJSONIsDigit(p[1])) {
+    PBJSONReaderFail(reader, @"Numbers may not have leading zeros.");
+  }
+  for (; p < end && PBJSONIsDigit(*p); ++p) {
+    if (significantDigits < 19) {
+      mantissa = mantissa * 10 + (*p - '0');
+      significantDigits += (mantissa != 0);
+    } else {
+      exact = NO;
+      ++exponent;
+    }
+  }
+  if (p < end && *p == '.') {
+    ++p;
+    if (p == end || !PBJSONIsDigit(*p)) {
+      reader->position = p;
+      PBJSONReaderFail(reader, @"Expected a digit.");
+    }
+    for (; p < end && PBJSONIsDigit(*p); ++p) {
+      if (significantDigits < 19) {
+        mantissa = mantissa * 10 + (*p - '0');
+        significantDigits += (mantissa != 0);
+        --exponent;
+      } else {
+        exact = NO;
+      }
+    }
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    BOOL negativeExponent = NO;
+    if (p < end && (*p == '+' || *p == '-')) {
+      negativeExponent = (*p == '-');
+      ++p;
+    }
+    if (p == end || !PBJSONIsDigit(*p)) {
+      reader->position = p;
+      PBJSONReaderFail(reader, @"Expected an exponent.");
+    }
+    int32_t explicitExponent = 0;
+    for (; p < end && PBJSONIsDigit(*p); ++p) {
+      if (explicitExponent < 100000) {
+        explicitExponent = explicitExponent * 10 + (*p - '0');
+      }
+    }
+    exponent += negativeExponent ? -explicitExponent : explicitExponent;
+  }
+
+  reader->position = p;
+  return convertDecimalToFloat64(mantissa, exponent, exact, numberStart, p - numberStart);
+}
+
+
+static Float64 PBJSONReaderScanDouble(PBJSONReader* reader) {
+  BOOL negative = reader->position < reader->end && *reader->position == '-';
+  if (negative) {
+    ++reader->position;
+  }
+  Float64 value = PBJSONReaderScanUnsignedDouble(reader);
+  return negative ? -value : value;
+}
+
+
+/**
+ * Scans an integer, which may be quoted, and returns its magnitude.  Values
+ * written with a fraction or an exponent are accepted if they are integral.
+ */
+static uint64_t PBJSONReaderScanInteger(PBJSONReader* reader, BOOL* negative) {
+  BOOL quoted = PBJSONReaderPeek(reader) == '"';
+  if (quoted) {
+    ++reader->position;
+  }
+  const uint8_t* start = reader->position;
+  const uint8_t* p = start;
+  const uint8_t* end = reader->end;
+
+  *negative = (p < end && *p == '-');
+  if (*negative) {
+    ++p;
+  }
+  const uint8_t* digits = p;
+  uint64_t value = 0;
+  BOOL overflow = NO;
+  for (; p < end && PBJSONIsDigit(*p); ++p) {
+    uint64_t digit = *p - '0';
+    if (value > (UINT64_MAX - digit) / 10) {
+      overflow = YES;
+    }
+    value = value * 10 + digit;
+  }
+  if (p == digits) {
+    PBJSONReaderFail(reader, @"Expected an integer.");
+  }
+  if (*digits == '0' && p - digits > 1) {
+    PBJSONReaderFail(reader, @"Numbers may not have leading zeros.");
+  }
+
+  if (p < end && (*p == '.' || *p == 'e' || *p == 'E')) {
+    reader->position = digits;
+    Float64 magnitude = PBJSONReaderScanUnsignedDouble(reader);
+    if (magnitude != floor(magnitude) || magnitude >= 18446744073709551616.0) {
+      reader->position = start;
+      PBJSONReaderFail(reader, @"Expected an integer.");
+    }
+    value = (uint64_t)magnitude;
+  } else if (overflow) {
+    reader->position = start;
+    PBJSONReaderFail(reader, @"Integer out of range.");
+  } else {
+    reader->position = p;
+  }
+
+  if (quoted) {
+    if (reader->position == end || *reader->position != '"') {
+      PBJSONReaderFail(reader, @"Expected \"\\\"\".");
+    }
+    ++reader->position;
+  }
+  return value;
+}
+
+
+static int64_t PBJSONReaderScanSigned(PBJSONReader* reader, uint64_t max) {
+  const uint8_t* start = reader->position;
+  BOOL negative;
+  uint64_t magnitude = PBJSONReaderScanInteger(reader, &negative);
+  // The most negative value has a magnitude one more than the maximum.
+  if (magnitude > (negative ? max + 1 : max)) {
+    reader->position = start;
+    PBJSONReaderFail(reader, @"Integer out of range.");
+  }
+  return negative ? (int64_t)(0 - magnitude) : (int64_t)magnitude;
+}
+
+
+static uint64_t PBJSONReaderScanUnsigned(PBJSONReader* reader, uint64_t max) {
+  const uint8_t* start = reader->position;
+  BOOL negative;
+  uint64_t magnitude = PBJSONReaderScanInteger(reader, &negative);
+  if ((negative && magnitude != 0) || magnitude > max) {
+    reader->position = start;
+    PBJSONReaderFail(reader, @"Integer out of range.");
+  }
+  return magnitude;
+}
+
+
+int32_t PBJSONReaderReadInt32(PBJSONReader* reader) {
+  return (int32_t)PBJSONReaderScanSigned(reader, INT32_MAX);
+}
+
+
+uint32_t PBJSONReaderReadUInt32(PBJSONReader* reader) {
+  return (uint32_t)PBJSONReaderScanUnsigned(reader, UINT32_MAX);
+}
+
+
+int64_t PBJSONReaderReadInt64(PBJSONReader* reader) {
+  return PBJSONReaderScanSigned(reader, INT64_MAX);
+}
+
+
+uint64_t PBJSONReaderReadUInt64(PBJSONReader* reader) {
+  return PBJSONReaderScanUnsigned(reader, UINT64_MAX);
+}
+
+
+BOOL PBJSONReaderReadBool(PBJSONReader* reader) {
+  if (PBJSONReaderTryConsumeLiteral(reader, "true", 4)) {
+    return YES;
+  }
+  if (PBJSONReaderTryConsumeLiteral(reader, "false", 5)) {
+    return NO;
+  }
+  PBJSONReaderFail(reader, @"Expected \"true\" or \"false\".");
+}
+
+
+static BOOL PBJSONReaderTryConsumeQuoted(PBJSONReader* reader, const char* quoted, NSUInteger length) {
+  if ((NSUInteger)(reader->end - reader->position) < length ||
+      memcmp(reader->position, quoted, length) != 0) {
+    return NO;
+  }
+  reader->position += length;
+  return YES;
+}
+
+
+Float64 PBJSONReaderReadDouble(PBJSONReader* reader) {
+  if (PBJSONReaderPeek(reader) != '"') {
+    return PBJSONReaderScanDouble(reader);
+  }
+  if (PBJSONReaderTryConsumeQuoted(reader, "\"NaN\"", 5)) {
+    return NAN;
+  }
+  if (PBJSONReaderTryConsumeQuoted(reader, "\"Infinity\"", 10)) {
+    return INFINITY;
+  }
+  if (PBJSONReaderTryConsumeQuoted(reader, "\"-Infinity\"", 11)) {
+    return -INFINITY;
+  }
+  ++reader->position;
+  Float64 value = PBJSONReaderScanDouble(reader);
+  if (reader->position == reader->end || *reader->position != '"') {
+    PBJSONReaderFail(reader, @"Expected \"\\\"\".");
+  }
+  ++reader->position;
+  return value;
+}
+
+
+Float32 PBJSONReaderReadFloat(PBJSONReader* reader) {
+  const uint8_t* start = reader->position;
+  Float64 value = PBJSONReaderReadDouble(reader);
+  if (isfinite(value) && fabs(value) > FLT_MAX) {
+    reader->position = start;
+    PBJSONReaderFail(reader, @"Float out of range.");
+  }
+  return (Float32)value;
+}
+
+
+NSString* PBJSONReaderReadString(PBJSONReader* reader) {
+  if (PBJSONReaderPeek(reader) != '"') {
+    PBJSONReaderFail(reader, @"Expected a string.");
+  }
+  const uint8_t* start = reader->position;
+  const uint8_t* bytes;
+  NSUInteger length;
+  PBJSONReaderScanString(reader, &bytes, &length);
+  if (length == 0) {
+    return @"";
+  }
+  NSString* value = [[NSString alloc] initWithBytes:bytes length:length encoding:NSUTF8StringEncoding];
+  if (value == nil) {
+    reader->position = start;
+    PBJSONReaderFail(reader, @"String is not valid UTF-8.");
+  }
+  return value;
+}
+
+
+/** Returns the six bits of a standard or URL-safe base64 digit, or -1. */
+static inline int32_t PBJSONBase64Value(uint8_t c) {
+  if (c >= 'A' && c <= 'Z') {
+    return c - 'A';
+  } else if (c >= 'a' && c <= 'z') {
+    return c - 'a' + 26;
+  } else if (c >= '0' && c <= '9') {
+    return c - '0' + 52;
+  } else if (c == '+' || c == '-') {
+    return 62;
+  } else if (c == '/' || c == '_') {
+    return 63;
+  }
+  return -1;
+}
+
+
+NSData* PBJSONReaderReadData(PBJSONReader* reader) {
+  if (PBJSONReaderPeek(reader) != '"') {
+    PBJSONReaderFail(reader, @"Expected a base64 string.");
+  }
+  const uint8_t* start = reader->position;
+  const uint8_t* bytes;
+  NSUInteger length;
+  PBJSONReaderScanString(reader, &bytes, &length);
+
+  if (length % 4 == 0 && length > 0 && bytes[length - 1] == '=') {
+    length -= (bytes[length - 2] == '=') ? 2 : 1;
+  }
+  if (length % 4 == 1) {
+    reader->position = start;
+    PBJSONReaderFail(reader, @"Invalid base64.");
+  }
+
+  NSUInteger outputLength = length / 4 * 3 + (length % 4 == 0 ? 0 : length % 4 - 1);
+  if (outputLength == 0) {
+    return [NSData data];
+  }
+  uint8_t* output = malloc(outputLength);
+  if (output == NULL) {
+    @throw [NSException exceptionWithName:NSMallocException reason:@"" userInfo:nil];
+  }
+  uint8_t* out = output;
+  uint32_t bits = 0;
+  int32_t bitCount = 0;
+  for (NSUInteger i = 0; i < length; ++i) {
+    int32_t value = PBJSONBase64Value(bytes[i]);
+    if (value < 0) {
+      free(output);
+      reader->position = start;
+      PBJSONReaderFail(reader, @"Invalid base64.");
+    }
+    bits = (bits << 6) | (uint32_t)value;
+    bitCount += 6;
+    if (bitCount >= 8) {
+      bitCount -= 8;
+      *out++ = (uint8_t)(bits >> bitCount);
+    }
+  }
+  return [[NSData alloc] initWithBytesNoCopy:output length:outputLength freeWhenDone:YES];
+}
+
+
+int32_t PBJSONReaderReadEnum(PBJSONReader* reader, const char* const* names, const int32_t* values, NSUInteger count) {
+  const uint8_t* start = reader->position;
+  if (PBJSONReaderPeek(reader) == '"') {
+    start = reader->position;
+    const uint8_t* bytes;
+    NSUInteger length;
+    PBJSONReaderScanString(reader, &bytes, &length);
+    for (NSUInteger i = 0; i < count; ++i) {
+      if (strncmp(names[i], (const char*)bytes, length) == 0 && names[i][length] == '\0') {
+        return values[i];
+      }
+    }
+    reader->position = start;
+    PBJSONReaderFail(reader, @"Unknown enum value \"%.*s\".", (int)length, (const char*)bytes);
+  }
+
+  start = reader->position;
+  int32_t value = (int32_t)PBJSONReaderScanSigned(reader, INT32_MAX);
+  for (NSUInteger i = 0; i < count; ++i) {
+    if (values[i] == value) {
+      return value;
+    }
+  }
+  reader->position = start;
+  PBJSONReaderFail(reader, @"Unknown enum value %d.", value);
+}
+
+
+static void PBJSONReaderEnter(PBJSONReader* reader) {
+  if (reader->recursionDepth >= reader->recursionLimit) {
+    PBJSONReaderFail(reader, @"Messages are nested too deeply.");
+  }
+  ++reader->recursionDepth;
+  reader->expectingItem = YES;
+}
+
+
+static void PBJSONReaderSkipValue(PBJSONReader* reader) {
+  const char* name;
+  NSUInteger length;
+  const uint8_t* bytes;
+  switch (PBJSONReaderPeek(reader)) {
+    case '"':
+      PBJSONReaderScanString(reader, &bytes, &length);
+      break;
+    case '{':
+      ++reader->position;
+      PBJSONReaderEnter(reader);
+      while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+        PBJSONReaderSkipValue(reader);
+      }
+      --reader->recursionDepth;
+      break;
+    case '[':
+      ++reader->position;
+      PBJSONReaderEnter(reader);
+      while (PBJSONReaderHasNextElement(reader)) {
+        PBJSONReaderSkipValue(reader);
+      }
+      --reader->recursionDepth;
+      break;
+    default:
+      if (!PBJSONReaderTryConsumeLiteral(reader, "true", 4) &&
+          !PBJSONReaderTryConsumeLiteral(reader, "false", 5) &&
+          !PBJSONReaderTryConsumeLiteral(reader, "null", 4)) {
+        PBJSONReaderScanDouble(reader);
+      }
+      break;
+  }
+}
+
+
+void PBJSONReaderUnknownMember(PBJSONReader* reader, const char* name, NSUInteger length) {
+  if (reader->ignoreUnknownFields) {
+    PBJSONReaderSkipValue(reader);
+    return;
+  }
+  reader->position = reader->memberPosition;
+  PBJSONReaderFail(reader, @"Unknown field \"%.*s\".", (int)length, name);
+}
+
+
+void PBJSONReaderReadMessage(PBJSONReader* reader, id<PBMessage_Builder> builder) {
+  PBJSONReaderConsume(reader, '{');
+  PBJSONReaderEnter(reader);
+  [builder mergeFromJSONReader:reader];
+  --reader->recursionDepth;
+}
+
+
+void PBJSONReaderReadRootMessage(PBJSONReader* reader, id<PBMessage_Builder> builder) {
+  PBJSONReaderReadMessage(reader, builder);
+  if (PBJSONReaderPeek(reader) >= 0) {
+    PBJSONReaderFail(reader, @"Unexpected \"%c\".", *reader->position);
+  }
+}
+
+#endif
@@ -0,0 +1,85 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PB_LITE_RUNTIME
+
+@class PBAbstractMessage;
+
+/**
+ * Builds the JSON form of a message as UTF-8 in one growable buffer, with no
+ * intermediate Foundation collections.  Generated writeJSONTo: methods call
+ * the PBJSONWrite functions below once per field value.  Each takes the
+ * member name, or NULL for an element of the array being written, and puts
+ * in the "," that separates it from the previous member or element.
+ *
+ * Values follow the proto3 JSON mapping: 64-bit integers are quoted, bytes
+ * are base64 with padding, enums are written by name (or number, for values
+ * the enum does not know), and non-finite floats are the strings "NaN",
+ * "Infinity" and "-Infinity".  Floating point values print with the fewest
+ * digits that read back to the same value.
+ */
+typedef struct _PBJSONWriter
+{
+	uint8_t*    bytes;
+	NSUInteger  length;
+	NSUInteger  capacity;
+
+	// Set once a member or element has been written at the current level.
+	BOOL        needsSeparator;
+} PBJSONWriter;
+
+/**
+ * Sets up an empty writer.  Every writer must be passed to
+ * PBJSONWriterDestroy.
+ */
+void PBJSONWriterInit(PBJSONWriter* writer);
+void PBJSONWriterDestroy(PBJSONWriter* writer);
+
+/**
+ * Hands the bytes written so far to an NSData without copying them, and
+ * leaves the writer empty.
+ */
+NSData* PBJSONWriterTakeData(PBJSONWriter* writer);
+
+void PBJSONWriterBeginObject(PBJSONWriter* writer, const char* name);
+void PBJSONWriterEndObject(PBJSONWriter* writer);
+void PBJSONWriterBeginArray(PBJSONWriter* writer, const char* name);
+void PBJSONWriterEndArray(PBJSONWriter* writer);
+
+void PBJSONWriteInt32(PBJSONWriter* writer, const char* name, int32_t value);
+void PBJSONWriteUInt32(PBJSONWriter* writer, const char* name, uint32_t value);
+void PBJSONWriteInt64(PBJSONWriter* writer, const char* name, int64_t value);
+void PBJSONWriteUInt64(PBJSONWriter* writer, const char* name, uint64_t value);
+void PBJSONWriteBool(PBJSONWriter* writer, const char* name, BOOL value);
+void PBJSONWriteFloat(PBJSONWriter* writer, const char* name, Float32 value);
+void PBJSONWriteDouble(PBJSONWriter* writer, const char* name, Float64 value);
+void PBJSONWriteString(PBJSONWriter* writer, const char* name, NSString* value);
+void PBJSONWriteData(PBJSONWriter* writer, const char* name, NSData* value);
+
+/**
+ * Writes the name that names[i] gives the first values[i] equal to value,
+ * or the number itself if there is none.
+ */
+void PBJSONWriteEnum(PBJSONWriter* writer, const char* name, int32_t value,
+                     const char* const* names, const int32_t* values, NSUInteger count);
+
+/**
+ * Writes the message's fields as a nested object.
+ */
+void PBJSONWriteMessage(PBJSONWriter* writer, const char* name, PBAbstractMessage* message);
+
+#endif
@@ -0,0 +1,386 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "PBJSONWriter.h"
+
+#ifndef PB_LITE_RUNTIME
+
+#import "AbstractMessage.h"
+#import "Utilities.h"
+
+static const NSUInteger kInitialCapacity = 256;
+
+static const char kBase64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+
+static void PBJSONWriterReserve(PBJSONWriter* writer, NSUInteger length) {
+  if (writer->capacity - writer->length >= length) {
+    return;
+  }
+  NSUInteger capacity = MAX(writer->capacity * 2, writer->length + length);
+  writer->bytes = PBReallocf(writer->bytes, capacity);
+  if (writer->bytes == NULL) {
+    @throw [NSException exceptionWithName:NSMallocException reason:@"" userInfo:nil];
+  }
+  writer->capacity = capacity;
+}
+
+
+static void PBJSONWriterAppendBytes(PBJSONWriter* writer, const void* bytes, NSUInteger length) {
+  PBJSONWriterReserve(writer, length);
+  memcpy(writer->bytes + writer->length, bytes, length);
+  writer->length += length;
+}
+
+
+void PBJSONWriterInit(PBJSONWriter* writer) {
+  memset(writer, 0, sizeof(*writer));
+  writer->bytes = malloc(kInitialCapacity);
+  if (writer->bytes == NULL) {
+    @throw [NSException exceptionWithName:NSMallocException reason:@"" userInfo:nil];
+  }
+  writer->capacity = kInitialCapacity;
+}
+
+
+void PBJSONWriterDestroy(PBJSONWriter* writer) {
+  free(writer->bytes);
+  memset(writer, 0, sizeof(*writer));
+}
+
+
+NSData* PBJSONWriterTakeData(PBJSONWriter* writer) {
+  NSData* data;
+  if (writer->length == 0) {
+    data = [NSData data];
+    free(writer->bytes);
+  } else {
+    data = [[NSData alloc] initWithBytesNoCopy:writer->bytes length:writer->length freeWhenDone:YES];
+  }
+  memset(writer, 0, sizeof(*writer));
+  return data;
+}
+
+
+/**
+ * Writes the "," before every member or element but the first at its level,
+ * then the member's quoted name and ":".  Names are proto identifiers and
+ * never need escaping.
+ */
+static void PBJSONWriterAppendName(PBJSONWriter* writer, const char* name) {
+  size_t nameLength = name == NULL ? 0 : strlen(name);
+  PBJSONWriterReserve(writer, nameLength + 4);
+  uint8_t* output = writer->bytes + writer->length;
+  if (writer->needsSeparator) {
+    *output++ = ',';
+  }
+  if (name != NULL) {
+    *output++ = '"';
+    memcpy(output, name, nameLength);
+    output += nameLength;
+    *output++ = '"';
+    *output++ = ':';
+  }
+  writer->length = output - writer->bytes;
+  writer->needsSeparator = YES;
+}
+
+
+void PBJSONWriterBeginObject(PBJSONWriter* writer, const char* name) {
+  PBJSONWriterAppendName(writer, name);
+  PBJSONWriterAppendBytes(writer, "{", 1);
+  writer->needsSeparator = NO;
+}
+
+
+void PBJSONWriterEndObject(PBJSONWriter* writer) {
+  PBJSONWriterAppendBytes(writer, "}", 1);
+  writer->needsSeparator = YES;
+}
+
+
+void PBJSONWriterBeginArray(PBJSONWriter* writer, const char* name) {
+  PBJSONWriterAppendName(writer, name);
+  PBJSONWriterAppendBytes(writer, "[", 1);
+  writer->needsSeparator = NO;
+}
+
+
+void PBJSONWriterEndArray(PBJSONWriter* writer) {
+  PBJSONWriterAppendBytes(writer, "]", 1);
+  writer->needsSeparator = YES;
+}
+
+
+static void PBJSONWriterAppendUInt64(PBJSONWriter* writer, uint64_t value) {
+  char digits[20];
+  char* end = digits + sizeof(digits);
+  char* start = end;
+  do {
+    *--start = '0' + (char)(value % 10);
+    value /= 10;
+  } while (value != 0);
+  PBJSONWriterAppendBytes(writer, start, end - start);
+}
+
+
+static void PBJSONWriterAppendInt64(PBJSONWriter* writer, int64_t value) {
+  if (value < 0) {
+    PBJSONWriterAppendBytes(writer, "-", 1);
+    // Negating in unsigned arithmetic also handles INT64_MIN.
+    PBJSONWriterAppendUInt64(writer, 0 - (uint64_t)value);
+  } else {
+    PBJSONWriterAppendUInt64(writer, (uint64_t)value);
+  }
+}
+
+
+void PBJSONWriteInt32(PBJSONWriter* writer, const char* name, int32_t value) {
+  PBJSONWriterAppendName(writer, name);
+  PBJSONWriterAppendInt64(writer, value);
+}
+
+
+void PBJSONWriteUInt32(PBJSONWriter* writer, const char* name, uint32_t value) {
+  PBJSONWriterAppendName(writer, name);
+  PBJSONWriterAppendUInt64(writer, value);
+}
+
+
+// JavaScript numbers lose precision past 2^53, so 64-bit values are quoted.
+void PBJSONWriteInt64(PBJSONWriter* writer, const char* name, int64_t value) {
+  PBJSONWriterAppendName(writer, name);
+  PBJSONWriterAppendBytes(writer, "\"", 1);
+  PBJSONWriterAppendInt64(writer, value);
+  PBJSONWriterAppendBytes(writer, "\"", 1);
+}
+
+
+void PBJSONWriteUInt64(PBJSONWriter* writer, const char* name, uint64_t value) {
+  PBJSONWriterAppendName(writer, name);
+  PBJSONWriterAppendBytes(writer, "\"", 1);
+  PBJSONWriterAppendUInt64(writer, value);
+  PBJSONWriterAppendBytes(writer, "\"", 1);
+}
+
+
+void PBJSONWriteBool(PBJSONWriter* writer, const char* name, BOOL value) {
+  PBJSONWriterAppendName(writer, name);
+  if (value) {
+    PBJSONWriterAppendBytes(writer, "true", 4);
+  } else {
+    PBJSONWriterAppendBytes(writer, "false", 5);
+  }
+}
+
+
+/**
+ * Appends NaN and the infinities as strings and returns YES, or returns NO
+ * for finite values.
+ */
+static BOOL PBJSONWriterAppendNonFinite(PBJSONWriter* writer, Float64 value) {
+  if (isnan(value)) {
+    PBJSONWriterAppendBytes(writer, "\"NaN\"", 5);
+  } else if (isinf(value)) {
+    if (value > 0) {
+      PBJSONWriterAppendBytes(writer, "\"Infinity\"", 10);
+    } else {
+      PBJSONWriterAppendBytes(writer, "\"-Infinity\"", 11);
+    }
+  } else {
+    return NO;
+  }
+  return YES;
+}
+
+
+void PBJSONWriteFloat(PBJSONWriter* writer, const char* name, Float32 value) {
+  PBJSONWriterAppendName(writer, name);
+  if (PBJSONWriterAppendNonFinite(writer, value)) {
+    return;
+  }
+  if (value > -1e7f && value < 1e7f && value == (int32_t)value && !(value == 0 && signbit(value))) {
+    PBJSONWriterAppendInt64(writer, (int32_t)value);
+    return;
+  }
+  // Six significant digits are enough for most floats that came from
+  // decimal text; the rest need all nine.
+  char buffer[32];
+  int length = snprintf(buffer, sizeof(buffer), "%.6g", value);
+  if (strtof(buffer, NULL) != value) {
+    length = snprintf(buffer, sizeof(buffer), "%.9g", value);
+  }
+  PBJSONWriterAppendBytes(writer, buffer, length);
+}
+
+
+void PBJSONWriteDouble(PBJSONWriter* writer, const char* name, Float64 value) {
+  PBJSONWriterAppendName(writer, name);
+  if (PBJSONWriterAppendNonFinite(writer, value)) {
+    return;
+  }
+  if (value > -1e15 && value < 1e15 && value == (int64_t)value && !(value == 0 && signbit(value))) {
+    PBJSONWriterAppendInt64(writer, (int64_t)value);
+    return;
+  }
+  char buffer[32];
+  int length = snprintf(buffer, sizeof(buffer), "%.15g", value);
+  if (strtod(buffer, NULL) != value) {
+    length = snprintf(buffer, sizeof(buffer), "%.17g", value);
+  }
+  PBJSONWriterAppendBytes(writer, buffer, length);
+}
+
+
+static BOOL PBJSONNeedsEscape(uint8_t c) {
+  return c < 0x20 || c == '"' || c == '\\';
+}
+
+
+static void PBJSONWriterAppendEscaped(PBJSONWriter* writer, const uint8_t* bytes, NSUInteger length) {
+  static const char kHexDigits[] = "0123456789abcdef";
+  const uint8_t* end = bytes + length;
+  while (bytes < end) {
+    const uint8_t* run = bytes;
+    while (bytes < end && !PBJSONNeedsEscape(*bytes)) {
+      ++bytes;
+    }
+    PBJSONWriterAppendBytes(writer, run, bytes - run);
+    if (bytes == end) {
+      break;
+    }
+
+    uint8_t c = *bytes++;
+    char escape[6] = { '\\', 0 };
+    NSUInteger escapeLength = 2;
+    switch (c) {
+      case '"':  escape[1] = '"'; break;
+      case '\\': escape[1] = '\\'; break;
+      case '\b': escape[1] = 'b'; break;
+      case '\f': escape[1] = 'f'; break;
+      case '\n': escape[1] = 'n'; break;
+      case '\r': escape[1] = 'r'; break;
+      case '\t': escape[1] = 't'; break;
+      default:
+        escape[1] = 'u';
+        escape[2] = '0';
+        escape[3] = '0';
+        escape[4] = kHexDigits[c >> 4];
+        escape[5] = kHexDigits[c & 0xF];
+        escapeLength = 6;
+        break;
+    }
+    PBJSONWriterAppendBytes(writer, escape, escapeLength);
+  }
+}
+
+
+void PBJSONWriteString(PBJSONWriter* writer, const char* name, NSString* value) {
+  PBJSONWriterAppendName(writer, name);
+
+  // The UTF-8 goes straight into the buffer, and as long as nothing in it
+  // needs escaping, which is the usual case, it stays there.
+  NSUInteger maxLength = [value maximumLengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+  PBJSONWriterReserve(writer, maxLength + 2);
+  uint8_t* output = writer->bytes + writer->length;
+  *output++ = '"';
+  NSUInteger used = 0;
+  [value getBytes:output
+        maxLength:maxLength
+       usedLength:&used
+         encoding:NSUTF8StringEncoding
+          options:0
+            range:NSMakeRange(0, value.length)
+   remainingRange:NULL];
+
+  NSUInteger clean = 0;
+  while (clean < used && !PBJSONNeedsEscape(output[clean])) {
+    ++clean;
+  }
+  if (clean == used) {
+    output[used] = '"';
+    writer->length += used + 2;
+    return;
+  }
+
+  // Escaping may move the buffer, so the rest is copied out first.
+  NSUInteger restLength = used - clean;
+  uint8_t* rest = malloc(restLength);
+  if (rest == NULL) {
+    @throw [NSException exceptionWithName:NSMallocException reason:@"" userInfo:nil];
+  }
+  memcpy(rest, output + clean, restLength);
+  writer->length += 1 + clean;
+  PBJSONWriterAppendEscaped(writer, rest, restLength);
+  free(rest);
+  PBJSONWriterAppendBytes(writer, "\"", 1);
+}
+
+
+void PBJSONWriteData(PBJSONWriter* writer, const char* name, NSData* value) {
+  PBJSONWriterAppendName(writer, name);
+
+  const uint8_t* input = value.bytes;
+  NSUInteger length = value.length;
+  PBJSONWriterReserve(writer, (length + 2) / 3 * 4 + 2);
+  uint8_t* output = writer->bytes + writer->length;
+  *output++ = '"';
+  NSUInteger i = 0;
+  for (; i + 3 <= length; i += 3) {
+    uint32_t triple = (input[i] << 16) | (input[i + 1] << 8) | input[i + 2];
+    *output++ = kBase64Alphabet[(triple >> 18) & 0x3F];
+    *output++ = kBase64Alphabet[(triple >> 12) & 0x3F];
+    *output++ = kBase64Alphabet[(triple >> 6) & 0x3F];
+    *output++ = kBase64Alphabet[triple & 0x3F];
+  }
+  if (i < length) {
+    uint32_t triple = input[i] << 16;
+    if (i + 1 < length) {
+      triple |= input[i + 1] << 8;
+    }
+    *output++ = kBase64Alphabet[(triple >> 18) & 0x3F];
+    *output++ = kBase64Alphabet[(triple >> 12) & 0x3F];
+    *output++ = i + 1 < length ? kBase64Alphabet[(triple >> 6) & 0x3F] : '=';
+    *output++ = '=';
+  }
+  *output++ = '"';
+  writer->length = output - writer->bytes;
+}
+
+
+void PBJSONWriteEnum(PBJSONWriter* writer, const char* name, int32_t value,
+                     const char* const* names, const int32_t* values, NSUInteger count) {
+  for (NSUInteger i = 0; i < count; ++i) {
+    if (values[i] == value) {
+      PBJSONWriterAppendName(writer, name);
+      PBJSONWriterAppendBytes(writer, "\"", 1);
+      PBJSONWriterAppendBytes(writer, names[i], strlen(names[i]));
+      PBJSONWriterAppendBytes(writer, "\"", 1);
+      return;
+    }
+  }
+  PBJSONWriteInt32(writer, name, value);
+}
+
+
+void PBJSONWriteMessage(PBJSONWriter* writer, const char* name, PBAbstractMessage* message) {
+  PBJSONWriterBeginObject(writer, name);
+  [message writeJSONTo:writer];
+  PBJSONWriterEndObject(writer);
+}
+
+#endif
@@ -0,0 +1,68 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+@class PBCodedInputStream;
+@class PBCodedOutputStream;
+
+/**
+ * The difference between two messages of the same type, as returned by a
+ * generated {@code -diffFrom:} and consumed by the builder's
+ * {@code -applyDelta:}.  Applying {@code [newer diffFrom:older]} to a
+ * builder holding {@code older} yields {@code newer}.
+ *
+ * A delta records three things:  the serialized values of the fields that
+ * were set or changed, the numbers of the fields that were cleared, and a
+ * nested delta for each changed submessage whose type also generates
+ * delta methods.  Repeated fields are replaced as a whole.  Extensions and
+ * unknown fields are not compared.
+ */
+@interface PBMessageDelta : NSObject {
+@private
+  NSData* changes;
+  NSArray* clearedFields;
+  NSDictionary* fieldDeltas;
+  int32_t memoizedSerializedSize;
+}
+
+/** A message of the diffed type holding just the changed fields. */
+@property (readonly, strong) NSData* changes;
+
+/** NSNumbers of the cleared field numbers. */
+@property (readonly, strong) NSArray* clearedFields;
+
+/** Nested PBMessageDeltas keyed by the NSNumber of their field. */
+@property (readonly, strong) NSDictionary* fieldDeltas;
+
++ (PBMessageDelta*) deltaWithChanges:(NSData*) changes
+                       clearedFields:(NSArray*) clearedFields
+                         fieldDeltas:(NSDictionary*) fieldDeltas;
+
++ (PBMessageDelta*) parseFromData:(NSData*) data;
++ (PBMessageDelta*) parseFromCodedInputStream:(PBCodedInputStream*) input;
+
+/** Returns YES if applying the delta would change nothing. */
+- (BOOL) isEmpty;
+
+/** Returns the delta for the submessage in field {@code number}, or nil. */
+- (PBMessageDelta*) deltaForField:(int32_t) number;
+
+- (int32_t) serializedSize;
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
+- (NSData*) data;
+
+@end
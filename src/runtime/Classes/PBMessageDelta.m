@@ -0,0 +1,209 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import "PBMessageDelta.h"
+
+#import "CodedInputStream.h"
+#import "CodedOutputStream.h"
+#import "Utilities.h"
+#import "WireFormat.h"
+
+// Matches the recursion limit of PBCodedInputStream.
+static const int32_t kMaxDeltaDepth = 64;
+
+@interface PBMessageDelta()
+@property (strong) NSData* changes;
+@property (strong) NSArray* clearedFields;
+@property (strong) NSDictionary* fieldDeltas;
++ (PBMessageDelta*) parseFromCodedInputStream:(PBCodedInputStream*) input depth:(int32_t) depth;
+@end
+
+
+@implementation PBMessageDelta
+
+@synthesize changes;
+@synthesize clearedFields;
+@synthesize fieldDeltas;
+
+
+- (id) initWithChanges:(NSData*) changes_
+         clearedFields:(NSArray*) clearedFields_
+           fieldDeltas:(NSDictionary*) fieldDeltas_ {
+  if ((self = [super init])) {
+    self.changes = changes_ != nil ? changes_ : [NSData data];
+    self.clearedFields = clearedFields_ != nil ? clearedFields_ : [NSArray array];
+    self.fieldDeltas = fieldDeltas_ != nil ? fieldDeltas_ : [NSDictionary dictionary];
+    memoizedSerializedSize = -1;
+  }
+
+  return self;
+}
+
+
++ (PBMessageDelta*) deltaWithChanges:(NSData*) changes
+                       clearedFields:(NSArray*) clearedFields
+                         fieldDeltas:(NSDictionary*) fieldDeltas {
+  return [[PBMessageDelta alloc] initWithChanges:changes
+                                   clearedFields:clearedFields
+                                     fieldDeltas:fieldDeltas];
+}
+
+
+- (BOOL) isEmpty {
+  return changes.length == 0 && clearedFields.count == 0 && fieldDeltas.count == 0;
+}
+
+
+- (PBMessageDelta*) deltaForField:(int32_t) number {
+  return [fieldDeltas objectForKey:[NSNumber numberWithInt:number]];
+}
+
+
+/**
+ * The delta is itself encoded as a message:
+ *
+ *   message FieldDelta {
+ *     optional int32 number = 1;
+ *     optional MessageDelta delta = 2;
+ *   }
+ *   optional bytes changes = 1;
+ *   repeated int32 cleared_fields = 2;
+ *   repeated FieldDelta field_deltas = 3;
+ */
+static int32_t computeFieldDeltaSizeNoTag(int32_t number, PBMessageDelta* delta) {
+  int32_t deltaSize = [delta serializedSize];
+  return computeInt32Size(1, number) + computeTagSize(2) + computeRawVarint32Size(deltaSize) + deltaSize;
+}
+
+
+- (int32_t) serializedSize {
+  if (memoizedSerializedSize != -1) {
+    return memoizedSerializedSize;
+  }
+
+  int32_t size = 0;
+  if (changes.length > 0) {
+    size += computeDataSize(1, changes);
+  }
+  for (NSNumber* number in clearedFields) {
+    size += computeInt32Size(2, number.intValue);
+  }
+  for (NSNumber* number in fieldDeltas) {
+    int32_t entrySize = computeFieldDeltaSizeNoTag(number.intValue, [fieldDeltas objectForKey:number]);
+    size += computeTagSize(3) + computeRawVarint32Size(entrySize) + entrySize;
+  }
+  memoizedSerializedSize = size;
+  return size;
+}
+
+
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
+  if (changes.length > 0) {
+    [output writeData:1 value:changes];
+  }
+  for (NSNumber* number in clearedFields) {
+    [output writeInt32:2 value:number.intValue];
+  }
+  NSArray* sortedKeys = [fieldDeltas.allKeys sortedArrayUsingSelector:@selector(compare:)];
+  for (NSNumber* number in sortedKeys) {
+    PBMessageDelta* delta = [fieldDeltas objectForKey:number];
+    [output writeTag:3 format:PBWireFormatLengthDelimited];
+    [output writeRawVarint32:computeFieldDeltaSizeNoTag(number.intValue, delta)];
+    [output writeInt32:1 value:number.intValue];
+    [output writeTag:2 format:PBWireFormatLengthDelimited];
+    [output writeRawVarint32:[delta serializedSize]];
+    [delta writeToCodedOutputStream:output];
+  }
+}
+
+
+- (NSData*) data {
+  NSMutableData* data = [NSMutableData dataWithLength:[self serializedSize]];
+  PBCodedOutputStream* stream = [PBCodedOutputStream streamWithData:data];
+  [self writeToCodedOutputStream:stream];
+  return data;
+}
+
+
++ (PBMessageDelta*) parseFromData:(NSData*) data {
+  return [PBMessageDelta parseFromCodedInputStream:[PBCodedInputStream streamWithData:data]];
+}
+
+
++ (PBMessageDelta*) parseFromCodedInputStream:(PBCodedInputStream*) input {
+  return [PBMessageDelta parseFromCodedInputStream:input depth:0];
+}
+
+
++ (PBMessageDelta*) parseFromCodedInputStream:(PBCodedInputStream*) input depth:(int32_t) depth {
+  if (depth >= kMaxDeltaDepth) {
+    @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"Recursion Limit Exceeded" userInfo:nil];
+  }
+
+  NSData* changes = nil;
+  NSMutableArray* clearedFields = [NSMutableArray array];
+  NSMutableDictionary* fieldDeltas = [NSMutableDictionary dictionary];
+  while (YES) {
+    int32_t tag = [input readTag];
+    switch (tag) {
+      case 0:
+        return [PBMessageDelta deltaWithChanges:changes
+                                  clearedFields:clearedFields
+                                    fieldDeltas:fieldDeltas];
+      case 10:
+        changes = [input readData];
+        break;
+      case 16:
+        [clearedFields addObject:[NSNumber numberWithInt:[input readInt32]]];
+        break;
+      case 26: {
+        int32_t length = [input readRawVarint32];
+        int32_t oldLimit = [input pushLimit:length];
+        int32_t number = 0;
+        PBMessageDelta* delta = nil;
+        int32_t entryTag;
+        while ((entryTag = [input readTag]) != 0) {
+          if (entryTag == 8) {
+            number = [input readInt32];
+          } else if (entryTag == 18) {
+            int32_t deltaLength = [input readRawVarint32];
+            int32_t entryLimit = [input pushLimit:deltaLength];
+            delta = [PBMessageDelta parseFromCodedInputStream:input depth:depth + 1];
+            [input popLimit:entryLimit];
+          } else {
+            [input skipField:entryTag];
+          }
+        }
+        [input popLimit:oldLimit];
+        if (delta != nil) {
+          [fieldDeltas setObject:delta forKey:[NSNumber numberWithInt:number]];
+        }
+        break;
+      }
+      default:
+        if (![input skipField:tag]) {
+          return [PBMessageDelta deltaWithChanges:changes
+                                    clearedFields:clearedFields
+                                      fieldDeltas:fieldDeltas];
+        }
+        break;
+    }
+  }
+}
+
+@end
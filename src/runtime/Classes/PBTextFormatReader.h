@@ -0,0 +1,89 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PB_LITE_RUNTIME
+
+@protocol PBMessage_Builder;
+
+/**
+ * Parses protocol buffer text format, as printed by the C++ and Java
+ * TextFormat classes, straight from a UTF-8 buffer.  Field names are the
+ * names in the .proto file (the type name for groups), and enum values may
+ * be given by name or by number.
+ *
+ * Generated builders implement -mergeFromTextFormatReader: by calling
+ * PBTextFormatReaderReadFieldName in a loop and one of the value readers
+ * below for each field they recognize.  Names and numbers are scanned in
+ * place, so the only objects created are the string, bytes and message
+ * values themselves.  Malformed input throws a "ParseError" exception whose
+ * reason starts with the line and column of the problem.
+ *
+ * Extensions ([full.name] syntax), Any expansion and the [a, b] shorthand
+ * for repeated fields are not supported.
+ */
+typedef struct _PBTextFormatReader
+{
+	const uint8_t*  start;
+	const uint8_t*  position;
+	const uint8_t*  end;
+
+	int32_t         recursionDepth;
+	int32_t         recursionLimit;
+} PBTextFormatReader;
+
+void PBTextFormatReaderInit(PBTextFormatReader* reader, const void* bytes, NSUInteger length);
+
+/**
+ * Merges every field in the input into builder, and throws if anything
+ * other than whitespace and comments is left over.
+ */
+void PBTextFormatReaderReadRootMessage(PBTextFormatReader* reader, id<PBMessage_Builder> builder);
+
+/**
+ * Reads the next field name into name and length, which point into the
+ * input.  Returns NO instead at the end of the input or of the enclosing
+ * message, leaving the closing bracket for PBTextFormatReaderReadMessage.
+ */
+BOOL PBTextFormatReaderReadFieldName(PBTextFormatReader* reader, const char** name, NSUInteger* length);
+
+/** Throws for a field name that the builder did not recognize. */
+void PBTextFormatReaderUnknownField(PBTextFormatReader* reader, const char* name, NSUInteger length) __attribute__((noreturn));
+
+// Each reads the ":" after a field name, then the value.
+int32_t PBTextFormatReaderReadInt32(PBTextFormatReader* reader);
+uint32_t PBTextFormatReaderReadUInt32(PBTextFormatReader* reader);
+int64_t PBTextFormatReaderReadInt64(PBTextFormatReader* reader);
+uint64_t PBTextFormatReaderReadUInt64(PBTextFormatReader* reader);
+BOOL PBTextFormatReaderReadBool(PBTextFormatReader* reader);
+Float32 PBTextFormatReaderReadFloat(PBTextFormatReader* reader);
+Float64 PBTextFormatReaderReadDouble(PBTextFormatReader* reader);
+NSString* PBTextFormatReaderReadString(PBTextFormatReader* reader);
+NSData* PBTextFormatReaderReadData(PBTextFormatReader* reader);
+
+/**
+ * Reads an enum value given either as one of the count names or as a
+ * number, and returns the matching entry of values.  Anything else throws.
+ */
+int32_t PBTextFormatReaderReadEnum(PBTextFormatReader* reader, const char* const* names, const int32_t* values, NSUInteger count);
+
+/**
+ * Reads "{" (or "<"), merges the fields up to the matching "}" (or ">")
+ * into builder through -mergeFromTextFormatReader:, and reads the bracket.
+ */
+void PBTextFormatReaderReadMessage(PBTextFormatReader* reader, id<PBMessage_Builder> builder);
+
+#endif
@@ -0,0 +1,732 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "PBTextFormatReader.h"
+
+#ifndef PB_LITE_RUNTIME
+
+#import "Message_Builder.h"
+#import "Utilities.h"
+
+static const int32_t kDefaultRecursionLimit = 64;
+
+// Literals are decoded in place when they contain no escapes, and copied
+// into a buffer of at least this size otherwise.
+static const NSUInteger kInitialBufferCapacity = 64;
+
+static void PBTextFormatReaderFail(PBTextFormatReader* reader, NSString* format, ...) NS_FORMAT_FUNCTION(2,3) __attribute__((noreturn));
+
+
+static void PBTextFormatReaderFail(PBTextFormatReader* reader, NSString* format, ...) {
+  // Lines and columns are only counted once something has gone wrong.
+  NSUInteger line = 1;
+  const uint8_t* lineStart = reader->start;
+  for (const uint8_t* p = reader->start; p < reader->position; ++p) {
+    if (*p == '\n') {
+      ++line;
+      lineStart = p + 1;
+    }
+  }
+
+  va_list arguments;
+  va_start(arguments, format);
+  NSString* message = [[NSString alloc] initWithFormat:format arguments:arguments];
+  va_end(arguments);
+
+  NSString* reason = [NSString stringWithFormat:@"%lu:%lu: %@",
+                      (unsigned long)line, (unsigned long)(reader->position - lineStart + 1), message];
+  @throw [NSException exceptionWithName:@"ParseError" reason:reason userInfo:nil];
+}
+
+
+static inline BOOL PBTextFormatIsDigit(int c) {
+  return c >= '0' && c <= '9';
+}
+
+
+static inline BOOL PBTextFormatIsHexDigit(int c) {
+  return PBTextFormatIsDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+
+static inline BOOL PBTextFormatIsIdentifierStart(int c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+
+static inline BOOL PBTextFormatIsIdentifierPart(int c) {
+  return PBTextFormatIsIdentifierStart(c) || PBTextFormatIsDigit(c);
+}
+
+
+static inline uint32_t PBTextFormatHexValue(uint8_t c) {
+  if (c <= '9') {
+    return c - '0';
+  }
+  return (c | 0x20) - 'a' + 10;
+}
+
+
+/** Returns the next byte after any whitespace and comments, or -1 at the end. */
+static int PBTextFormatReaderPeek(PBTextFormatReader* reader) {
+  const uint8_t* p = reader->position;
+  const uint8_t* end = reader->end;
+  while (p < end) {
+    uint8_t c = *p;
+    if (c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' || c == '\v') {
+      ++p;
+    } else if (c == '#') {
+      const uint8_t* newline = memchr(p, '\n', end - p);
+      p = newline == NULL ? end : newline + 1;
+    } else {
+      reader->position = p;
+      return c;
+    }
+  }
+  reader->position = p;
+  return -1;
+}
+
+
+static BOOL PBTextFormatReaderTryConsume(PBTextFormatReader* reader, uint8_t c) {
+  if (PBTextFormatReaderPeek(reader) == c) {
+    ++reader->position;
+    return YES;
+  }
+  return NO;
+}
+
+
+static void PBTextFormatReaderConsume(PBTextFormatReader* reader, uint8_t c) {
+  if (!PBTextFormatReaderTryConsume(reader, c)) {
+    PBTextFormatReaderFail(reader, @"Expected \"%c\".", c);
+  }
+}
+
+
+/** Fields may be separated by a "," or a ";" as well as by whitespace. */
+static void PBTextFormatReaderEndValue(PBTextFormatReader* reader) {
+  if (!PBTextFormatReaderTryConsume(reader, ',')) {
+    PBTextFormatReaderTryConsume(reader, ';');
+  }
+}
+
+
+/**
+ * Returns the end of the identifier starting at the current position,
+ * which Peek has already found to be an identifier start.
+ */
+static const uint8_t* PBTextFormatReaderIdentifierEnd(PBTextFormatReader* reader) {
+  const uint8_t* p = reader->position + 1;
+  while (p < reader->end && PBTextFormatIsIdentifierPart(*p)) {
+    ++p;
+  }
+  return p;
+}
+
+
+/** Numbers must not run straight into letters or a second decimal point. */
+static void PBTextFormatReaderCheckNumberEnd(PBTextFormatReader* reader, const uint8_t* p) {
+  if (p < reader->end && (PBTextFormatIsIdentifierPart(*p) || *p == '.')) {
+    PBTextFormatReaderFail(reader, @"Invalid number.");
+  }
+}
+
+
+void PBTextFormatReaderInit(PBTextFormatReader* reader, const void* bytes, NSUInteger length) {
+  reader->start = bytes;
+  reader->position = bytes;
+  reader->end = reader->start + length;
+  reader->recursionDepth = 0;
+  reader->recursionLimit = kDefaultRecursionLimit;
+}
+
+
+BOOL PBTextFormatReaderReadFieldName(PBTextFormatReader* reader, const char** name, NSUInteger* length) {
+  int c = PBTextFormatReaderPeek(reader);
+  if (c < 0 || c == '}' || c == '>') {
+    return NO;
+  }
+  if (c == '[') {
+    PBTextFormatReaderFail(reader, @"Extensions are not supported.");
+  }
+  if (!PBTextFormatIsIdentifierStart(c)) {
+    PBTextFormatReaderFail(reader, @"Expected a field name.");
+  }
+  const uint8_t* end = PBTextFormatReaderIdentifierEnd(reader);
+  *name = (const char*)reader->position;
+  *length = end - reader->position;
+  reader->position = end;
+  return YES;
+}
+
+
+void PBTextFormatReaderUnknownField(PBTextFormatReader* reader, const char* name, NSUInteger length) {
+  reader->position = (const uint8_t*)name;
+  PBTextFormatReaderFail(reader, @"Unknown field \"%.*s\".", (int)length, name);
+}
+
+
+/**
+ * Scans an optional "-" and a decimal, hexadecimal ("0x") or octal
+ * (leading "0") integer, and returns its magnitude.
+ */
+static uint64_t PBTextFormatReaderScanInteger(PBTextFormatReader* reader, BOOL* negative) {
+  PBTextFormatReaderPeek(reader);
+  const uint8_t* p = reader->position;
+  const uint8_t* end = reader->end;
+
+  *negative = (p < end && *p == '-');
+  if (*negative) {
+    ++p;
+  }
+  if (p == end || !PBTextFormatIsDigit(*p)) {
+    PBTextFormatReaderFail(reader, @"Expected an integer.");
+  }
+
+  uint64_t value = 0;
+  if (*p == '0' && p + 1 < end && (p[1] == 'x' || p[1] == 'X')) {
+    p += 2;
+    const uint8_t* digits = p;
+    for (; p < end && PBTextFormatIsHexDigit(*p); ++p) {
+      if (value >> 60 != 0) {
+        PBTextFormatReaderFail(reader, @"Integer out of range.");
+      }
+      value = (value << 4) | PBTextFormatHexValue(*p);
+    }
+    if (p == digits) {
+      PBTextFormatReaderFail(reader, @"Expected hex digits.");
+    }
+  } else if (*p == '0') {
+    for (++p; p < end && *p >= '0' && *p <= '7'; ++p) {
+      if (value >> 61 != 0) {
+        PBTextFormatReaderFail(reader, @"Integer out of range.");
+      }
+      value = (value << 3) | (*p - '0');
+    }
+  } else {
+    for (; p < end && PBTextFormatIsDigit(*p); ++p) {
+      uint64_t digit = *p - '0';
+      if (value > (UINT64_MAX - digit) / 10) {
+        PBTextFormatReaderFail(reader, @"Integer out of range.");
+      }
+      value = value * 10 + digit;
+    }
+  }
+
+  PBTextFormatReaderCheckNumberEnd(reader, p);
+  reader->position = p;
+  return value;
+}
+
+
+static int64_t PBTextFormatReaderScanSigned(PBTextFormatReader* reader, uint64_t max) {
+  const uint8_t* start = reader->position;
+  BOOL negative;
+  uint64_t magnitude = PBTextFormatReaderScanInteger(reader, &negative);
+  // The most negative value has a magnitude one more than the maximum.
+  if (magnitude > (negative ? max + 1 : max)) {
+    reader->position = start;
+    PBTextFormatReaderFail(reader, @"Integer out of range.");
+  }
+  return negative ? (int64_t)(0 - magnitude) : (int64_t)magnitude;
+}
+
+
+static uint64_t PBTextFormatReaderScanUnsigned(PBTextFormatReader* reader, uint64_t max) {
+  const uint8_t* start = reader->position;
+  BOOL negative;
+  uint64_t magnitude = PBTextFormatReaderScanInteger(reader, &negative);
+  if ((negative && magnitude != 0) || magnitude > max) {
+    reader->position = start;
+    PBTextFormatReaderFail(reader, @"Integer out of range.");
+  }
+  return magnitude;
+}
+
+
+int32_t PBTextFormatReaderReadInt32(PBTextFormatReader* reader) {
+  PBTextFormatReaderConsume(reader, ':');
+  int32_t value = (int32_t)PBTextFormatReaderScanSigned(reader, INT32_MAX);
+  PBTextFormatReaderEndValue(reader);
+  return value;
+}
+
+
+uint32_t PBTextFormatReaderReadUInt32(PBTextFormatReader* reader) {
+  PBTextFormatReaderConsume(reader, ':');
+  uint32_t value = (uint32_t)PBTextFormatReaderScanUnsigned(reader, UINT32_MAX);
+  PBTextFormatReaderEndValue(reader);
+  return value;
+}
+
+
+int64_t PBTextFormatReaderReadInt64(PBTextFormatReader* reader) {
+  PBTextFormatReaderConsume(reader, ':');
+  int64_t value = PBTextFormatReaderScanSigned(reader, INT64_MAX);
+  PBTextFormatReaderEndValue(reader);
+  return value;
+}
+
+
+uint64_t PBTextFormatReaderReadUInt64(PBTextFormatReader* reader) {
+  PBTextFormatReaderConsume(reader, ':');
+  uint64_t value = PBTextFormatReaderScanUnsigned(reader, UINT64_MAX);
+  PBTextFormatReaderEndValue(reader);
+  return value;
+}
+
+
+static BOOL PBTextFormatReaderIdentifierIs(const uint8_t* start, const uint8_t* end, const char* identifier) {
+  NSUInteger length = end - start;
+  return strncmp((const char*)start, identifier, length) == 0 && identifier[length] == '\0';
+}
+
+
+BOOL PBTextFormatReaderReadBool(PBTextFormatReader* reader) {
+  PBTextFormatReaderConsume(reader, ':');
+  BOOL value;
+  if (PBTextFormatIsDigit(PBTextFormatReaderPeek(reader))) {
+    value = PBTextFormatReaderScanUnsigned(reader, 1) != 0;
+  } else if (PBTextFormatIsIdentifierStart(PBTextFormatReaderPeek(reader))) {
+    const uint8_t* end = PBTextFormatReaderIdentifierEnd(reader);
+    if (PBTextFormatReaderIdentifierIs(reader->position, end, "true") ||
+        PBTextFormatReaderIdentifierIs(reader->position, end, "True") ||
+        PBTextFormatReaderIdentifierIs(reader->position, end, "t")) {
+      value = YES;
+    } else if (PBTextFormatReaderIdentifierIs(reader->position, end, "false") ||
+               PBTextFormatReaderIdentifierIs(reader->position, end, "False") ||
+               PBTextFormatReaderIdentifierIs(reader->position, end, "f")) {
+      value = NO;
+    } else {
+      PBTextFormatReaderFail(reader, @"Expected \"true\" or \"false\".");
+    }
+    reader->position = end;
+  } else {
+    PBTextFormatReaderFail(reader, @"Expected \"true\" or \"false\".");
+  }
+  PBTextFormatReaderEndValue(reader);
+  return value;
+}
+
+
+static Float64 PBTextFormatReaderScanSpecialDouble(PBTextFormatReader* reader, const uint8_t* start) {
+  const uint8_t* end = start;
+  while (end < reader->end && PBTextFormatIsIdentifierPart(*end)) {
+    ++end;
+  }
+  Float64 value;
+  NSUInteger length = end - start;
+  if ((length == 3 && strncasecmp((const char*)start, "inf", 3) == 0) ||
+      (length == 8 && strncasecmp((const char*)start, "infinity", 8) == 0)) {
+    value = INFINITY;
+  } else if (length == 3 && strncasecmp((const char*)start, "nan", 3) == 0) {
+    value = NAN;
+  } else {
+    PBTextFormatReaderFail(reader, @"Expected a number.");
+  }
+  reader->position = end;
+  return value;
+}
+
+
+/**
+ * Scans a decimal floating point number, with an optional "f" suffix, into
+ * up to 19 significant digits and a decimal exponent for
+ * convertDecimalToFloat64.
+ */
+static Float64 PBTextFormatReaderScanDouble(PBTextFormatReader* reader) {
+  PBTextFormatReaderPeek(reader);
+  const uint8_t* p = reader->position;
+  const uint8_t* end = reader->end;
+
+  BOOL negative = (p < end && *p == '-');
+  if (negative) {
+    ++p;
+  }
+  if (p < end && PBTextFormatIsIdentifierStart(*p)) {
+    Float64 value = PBTextFormatReaderScanSpecialDouble(reader, p);
+    return negative ? -value : value;
+  }
+
+  const uint8_t* numberStart = p;
+  uint64_t mantissa = 0;
+  int32_t significantDigits = 0;
+  int32_t exponent = 0;
+  BOOL exact = YES;
+  BOOL sawDigit = NO;
+
+  for (; p < end && PBTextFormatIsDigit(*p); ++p) {
+    sawDigit = YES;
+    if (significantDigits < 19) {
+      mantissa = mantissa * 10 + (*p - '0');
+      significantDigits += (mantissa != 0);
+    } else {
+      exact = NO;
+    }
+  }
+  if (p < end && *p == '.') {
+    for (++p; p < end && PBTextFormatIsDigit(*p); ++p) {
+      sawDigit = YES;
+      if (significantDigits < 19) {
+        mantissa = mantissa * 10 + (*p - '0');
+        significantDigits += (mantissa != 0);
+        --exponent;
+      } else {
+        exact = NO;
+      }
+    }
+  }
+  if (!sawDigit) {
+    PBTextFormatReaderFail(reader, @"Expected a number.");
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    BOOL negativeExponent = NO;
+    if (p < end && (*p == '+' || *p == '-')) {
+      negativeExponent = (*p == '-');
+      ++p;
+    }
+    if (p == end || !PBTextFormatIsDigit(*p)) {
+      PBTextFormatReaderFail(reader, @"Expected an exponent.");
+    }
+    int32_t explicitExponent = 0;
+    for (; p < end && PBTextFormatIsDigit(*p); ++p) {
+      if (explicitExponent < 100000) {
+        explicitExponent = explicitExponent * 10 + (*p - '0');
+      }
+    }
+    exponent += negativeExponent ? -explicitExponent : explicitExponent;
+  }
+  const uint8_t* numberEnd = p;
+  if (p < end && (*p == 'f' || *p == 'F')) {
+    ++p;
+  }
+  PBTextFormatReaderCheckNumberEnd(reader, p);
+
+  Float64 value = convertDecimalToFloat64(mantissa, exponent, exact, numberStart, numberEnd - numberStart);
+  reader->position = p;
+  return negative ? -value : value;
+}
+
+
+Float32 PBTextFormatReaderReadFloat(PBTextFormatReader* reader) {
+  return (Float32)PBTextFormatReaderReadDouble(reader);
+}
+
+
+Float64 PBTextFormatReaderReadDouble(PBTextFormatReader* reader) {
+  PBTextFormatReaderConsume(reader, ':');
+  Float64 value = PBTextFormatReaderScanDouble(reader);
+  PBTextFormatReaderEndValue(reader);
+  return value;
+}
+
+
+typedef struct _PBTextFormatLiteral
+{
+	const uint8_t*  bytes;
+	NSUInteger      length;
+
+	// Set once the literal needed unescaping or concatenating, and then
+	// owned by whoever takes the bytes.
+	uint8_t*        buffer;
+	NSUInteger      capacity;
+} PBTextFormatLiteral;
+
+
+static void PBTextFormatReaderFailInLiteral(PBTextFormatReader* reader, PBTextFormatLiteral* literal, NSString* message) __attribute__((noreturn));
+
+
+/** Frees the literal's buffer, which nobody has taken yet, and fails. */
+static void PBTextFormatReaderFailInLiteral(PBTextFormatReader* reader, PBTextFormatLiteral* literal, NSString* message) {
+  free(literal->buffer);
+  literal->buffer = NULL;
+  PBTextFormatReaderFail(reader, @"%@", message);
+}
+
+
+static void PBTextFormatLiteralAppend(PBTextFormatLiteral* literal, const void* bytes, NSUInteger length) {
+  if (literal->buffer == NULL) {
+    // Copy whatever was found in place so far.
+    literal->capacity = MAX(kInitialBufferCapacity, (literal->length + length) * 2);
+    literal->buffer = malloc(literal->capacity);
+    if (literal->buffer == NULL) {
+      @throw [NSException exceptionWithName:NSMallocException reason:@"" userInfo:nil];
+    }
+    if (literal->length > 0) {
+      memcpy(literal->buffer, literal->bytes, literal->length);
+    }
+    literal->bytes = literal->buffer;
+  } else if (literal->capacity - literal->length < length) {
+    literal->capacity = MAX(literal->capacity * 2, literal->length + length);
+    literal->buffer = PBReallocf(literal->buffer, literal->capacity);
+    if (literal->buffer == NULL) {
+      @throw [NSException exceptionWithName:NSMallocException reason:@"" userInfo:nil];
+    }
+    literal->bytes = literal->buffer;
+  }
+  memcpy(literal->buffer + literal->length, bytes, length);
+  literal->length += length;
+}
+
+
+static void PBTextFormatLiteralAppendCodePoint(PBTextFormatLiteral* literal, uint32_t codePoint) {
+  uint8_t bytes[4];
+  NSUInteger length;
+  if (codePoint < 0x80) {
+    bytes[0] = (uint8_t)codePoint;
+    length = 1;
+  } else if (codePoint < 0x800) {
+    bytes[0] = (uint8_t)(0xC0 | (codePoint >> 6));
+    bytes[1] = (uint8_t)(0x80 | (codePoint & 0x3F));
+    length = 2;
+  } else if (codePoint < 0x10000) {
+    bytes[0] = (uint8_t)(0xE0 | (codePoint >> 12));
+    bytes[1] = (uint8_t)(0x80 | ((codePoint >> 6) & 0x3F));
+    bytes[2] = (uint8_t)(0x80 | (codePoint & 0x3F));
+    length = 3;
+  } else {
+    bytes[0] = (uint8_t)(0xF0 | (codePoint >> 18));
+    bytes[1] = (uint8_t)(0x80 | ((codePoint >> 12) & 0x3F));
+    bytes[2] = (uint8_t)(0x80 | ((codePoint >> 6) & 0x3F));
+    bytes[3] = (uint8_t)(0x80 | (codePoint & 0x3F));
+    length = 4;
+  }
+  PBTextFormatLiteralAppend(literal, bytes, length);
+}
+
+
+/**
+ * Decodes the escape sequence after a backslash at p and returns the
+ * position after it.
+ */
+static const uint8_t* PBTextFormatReaderScanEscape(PBTextFormatReader* reader, const uint8_t* p, PBTextFormatLiteral* literal) {
+  const uint8_t* end = reader->end;
+  if (p == end) {
+    PBTextFormatReaderFailInLiteral(reader, literal, @"Unterminated string.");
+  }
+  uint8_t c = *p++;
+  uint8_t byte;
+  switch (c) {
+    case 'a':  byte = 0x07; break;
+    case 'b':  byte = '\b'; break;
+    case 'f':  byte = '\f'; break;
+    case 'n':  byte = '\n'; break;
+    case 'r':  byte = '\r'; break;
+    case 't':  byte = '\t'; break;
+    case 'v':  byte = 0x0b; break;
+    case '\\': byte = '\\'; break;
+    case '\'': byte = '\''; break;
+    case '"':  byte = '"';  break;
+    case '?':  byte = '?';  break;
+
+    case '0': case '1': case '2': case '3':
+    case '4': case '5': case '6': case '7': {
+      uint32_t code = c - '0';
+      for (int i = 1; i < 3 && p < end && *p >= '0' && *p <= '7'; ++i, ++p) {
+        code = code * 8 + (*p - '0');
+      }
+      byte = (uint8_t)code;
+      break;
+    }
+
+    case 'x':
+    case 'X': {
+      if (p == end || !PBTextFormatIsHexDigit(*p)) {
+        PBTextFormatReaderFailInLiteral(reader, literal, @"Invalid escape sequence: '\\x' with no digits.");
+      }
+      uint32_t code = PBTextFormatHexValue(*p++);
+      if (p < end && PBTextFormatIsHexDigit(*p)) {
+        code = code * 16 + PBTextFormatHexValue(*p++);
+      }
+      byte = (uint8_t)code;
+      break;
+    }
+
+    case 'u':
+    case 'U': {
+      int digits = (c == 'u') ? 4 : 8;
+      uint32_t codePoint = 0;
+      for (int i = 0; i < digits; ++i, ++p) {
+        if (p == end || !PBTextFormatIsHexDigit(*p)) {
+          PBTextFormatReaderFailInLiteral(reader, literal, @"Invalid Unicode escape sequence.");
+        }
+        codePoint = (codePoint << 4) | PBTextFormatHexValue(*p);
+      }
+      if (codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+        PBTextFormatReaderFailInLiteral(reader, literal, @"Invalid Unicode escape sequence.");
+      }
+      PBTextFormatLiteralAppendCodePoint(literal, codePoint);
+      return p;
+    }
+
+    default:
+      PBTextFormatReaderFailInLiteral(reader, literal, @"Invalid escape sequence.");
+  }
+  PBTextFormatLiteralAppend(literal, &byte, 1);
+  return p;
+}
+
+
+/** Reads one or more adjacent quoted strings as a single value. */
+static void PBTextFormatReaderScanLiteral(PBTextFormatReader* reader, PBTextFormatLiteral* literal) {
+  memset(literal, 0, sizeof(*literal));
+
+  int quote = PBTextFormatReaderPeek(reader);
+  if (quote != '"' && quote != '\'') {
+    PBTextFormatReaderFail(reader, @"Expected a string.");
+  }
+
+  const uint8_t* end = reader->end;
+  do {
+    const uint8_t* p = reader->position + 1;
+    while (YES) {
+      const uint8_t* run = p;
+      while (p < end && *p != quote && *p != '\\' && *p != '\n') {
+        ++p;
+      }
+      if (run == reader->position + 1 && p < end && *p == quote && literal->length == 0 && literal->buffer == NULL) {
+        // The common case: one literal with no escapes, used in place.
+        literal->bytes = run;
+        literal->length = p - run;
+      } else if (p > run) {
+        PBTextFormatLiteralAppend(literal, run, p - run);
+      }
+      if (p == end || *p == '\n') {
+        PBTextFormatReaderFailInLiteral(reader, literal, @"Unterminated string.");
+      }
+      if (*p == quote) {
+        reader->position = p + 1;
+        break;
+      }
+      p = PBTextFormatReaderScanEscape(reader, p + 1, literal);
+    }
+  } while ((quote = PBTextFormatReaderPeek(reader)) == '"' || quote == '\'');
+}
+
+
+NSString* PBTextFormatReaderReadString(PBTextFormatReader* reader) {
+  PBTextFormatReaderConsume(reader, ':');
+  const uint8_t* start = reader->position;
+  PBTextFormatLiteral literal;
+  PBTextFormatReaderScanLiteral(reader, &literal);
+
+  NSString* value;
+  if (literal.buffer != NULL) {
+    value = [[NSString alloc] initWithBytesNoCopy:literal.buffer
+                                           length:literal.length
+                                         encoding:NSUTF8StringEncoding
+                                     freeWhenDone:YES];
+    if (value == nil) {
+      free(literal.buffer);
+    }
+  } else if (literal.length == 0) {
+    value = @"";
+  } else {
+    value = [[NSString alloc] initWithBytes:literal.bytes length:literal.length encoding:NSUTF8StringEncoding];
+  }
+  if (value == nil) {
+    reader->position = start;
+    PBTextFormatReaderFail(reader, @"String is not valid UTF-8.");
+  }
+
+  PBTextFormatReaderEndValue(reader);
+  return value;
+}
+
+
+NSData* PBTextFormatReaderReadData(PBTextFormatReader* reader) {
+  PBTextFormatReaderConsume(reader, ':');
+  PBTextFormatLiteral literal;
+  PBTextFormatReaderScanLiteral(reader, &literal);
+
+  NSData* value;
+  if (literal.buffer != NULL) {
+    value = [NSData dataWithBytesNoCopy:literal.buffer length:literal.length freeWhenDone:YES];
+  } else {
+    value = [NSData dataWithBytes:literal.bytes length:literal.length];
+  }
+
+  PBTextFormatReaderEndValue(reader);
+  return value;
+}
+
+
+int32_t PBTextFormatReaderReadEnum(PBTextFormatReader* reader, const char* const* names, const int32_t* values, NSUInteger count) {
+  PBTextFormatReaderConsume(reader, ':');
+  int32_t value;
+  if (PBTextFormatIsIdentifierStart(PBTextFormatReaderPeek(reader))) {
+    const uint8_t* end = PBTextFormatReaderIdentifierEnd(reader);
+    NSUInteger i = 0;
+    while (i < count && !PBTextFormatReaderIdentifierIs(reader->position, end, names[i])) {
+      ++i;
+    }
+    if (i == count) {
+      PBTextFormatReaderFail(reader, @"Unknown enum value \"%.*s\".",
+                             (int)(end - reader->position), (const char*)reader->position);
+    }
+    value = values[i];
+    reader->position = end;
+  } else {
+    const uint8_t* start = reader->position;
+    value = (int32_t)PBTextFormatReaderScanSigned(reader, INT32_MAX);
+    NSUInteger i = 0;
+    while (i < count && values[i] != value) {
+      ++i;
+    }
+    if (i == count) {
+      reader->position = start;
+      PBTextFormatReaderFail(reader, @"Unknown enum value %d.", value);
+    }
+  }
+  PBTextFormatReaderEndValue(reader);
+  return value;
+}
+
+
+void PBTextFormatReaderReadMessage(PBTextFormatReader* reader, id<PBMessage_Builder> builder) {
+  PBTextFormatReaderTryConsume(reader, ':');
+  uint8_t close;
+  if (PBTextFormatReaderTryConsume(reader, '{')) {
+    close = '}';
+  } else if (PBTextFormatReaderTryConsume(reader, '<')) {
+    close = '>';
+  } else {
+    PBTextFormatReaderFail(reader, @"Expected \"{\".");
+  }
+
+  if (reader->recursionDepth >= reader->recursionLimit) {
+    PBTextFormatReaderFail(reader, @"Messages are nested too deeply.");
+  }
+  ++reader->recursionDepth;
+  [builder mergeFromTextFormatReader:reader];
+  --reader->recursionDepth;
+
+  PBTextFormatReaderConsume(reader, close);
+  PBTextFormatReaderEndValue(reader);
+}
+
+
+void PBTextFormatReaderReadRootMessage(PBTextFormatReader* reader, id<PBMessage_Builder> builder) {
+  [builder mergeFromTextFormatReader:reader];
+  if (PBTextFormatReaderPeek(reader) >= 0) {
+    PBTextFormatReaderFail(reader, @"Unexpected \"%c\".", *reader->position);
+  }
+}
+
+#endif
@@ -0,0 +1,87 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PB_LITE_RUNTIME
+
+@class PBAbstractMessage;
+@class PBUnknownFieldSet;
+
+/**
+ * Builds the text that -[PBAbstractMessage description] returns, as UTF-8
+ * in one growable buffer.  Generated writeTextFormatTo: methods call the
+ * PBTextFormatWrite functions below once per field value; each writes the
+ * current indent, the field name and the value in the same form that the
+ * old NSMutableString based writeDescriptionTo:withIndent: produced.
+ *
+ * Integers are formatted by hand.  Floating point values match NSNumber's
+ * description (%0.7g for float, %0.16g for double); integral values are
+ * formatted by hand and the rest go through snprintf.
+ */
+typedef struct _PBTextFormatWriter
+{
+	uint8_t*    bytes;
+	NSUInteger  length;
+	NSUInteger  capacity;
+
+	// The current indent, two spaces per level of nesting.
+	uint8_t*    indent;
+	NSUInteger  indentLength;
+	NSUInteger  indentCapacity;
+} PBTextFormatWriter;
+
+/**
+ * Sets up an empty writer whose first level is indented by indent, which
+ * may be nil.  Every writer must be passed to PBTextFormatWriterDestroy.
+ */
+void PBTextFormatWriterInit(PBTextFormatWriter* writer, NSString* indent);
+void PBTextFormatWriterDestroy(PBTextFormatWriter* writer);
+
+NSString* PBTextFormatWriterString(PBTextFormatWriter* writer);
+NSString* PBTextFormatWriterIndent(PBTextFormatWriter* writer);
+
+void PBTextFormatWriterAppendBytes(PBTextFormatWriter* writer, const void* bytes, NSUInteger length);
+void PBTextFormatWriterAppendCString(PBTextFormatWriter* writer, const char* string);
+void PBTextFormatWriterAppendString(PBTextFormatWriter* writer, NSString* string);
+void PBTextFormatWriterAppendInt64(PBTextFormatWriter* writer, int64_t value);
+void PBTextFormatWriterAppendUInt64(PBTextFormatWriter* writer, uint64_t value);
+
+/**
+ * Appends value the way a %@ format would: strings as they are and other
+ * objects through -description.
+ */
+void PBTextFormatWriterAppendObject(PBTextFormatWriter* writer, id value);
+
+void PBTextFormatWriterAppendIndent(PBTextFormatWriter* writer);
+void PBTextFormatWriterPushIndent(PBTextFormatWriter* writer);
+void PBTextFormatWriterPopIndent(PBTextFormatWriter* writer);
+
+// One "name: value" line each.
+void PBTextFormatWriteInt32(PBTextFormatWriter* writer, const char* name, int32_t value);
+void PBTextFormatWriteUInt32(PBTextFormatWriter* writer, const char* name, uint32_t value);
+void PBTextFormatWriteInt64(PBTextFormatWriter* writer, const char* name, int64_t value);
+void PBTextFormatWriteUInt64(PBTextFormatWriter* writer, const char* name, uint64_t value);
+void PBTextFormatWriteBool(PBTextFormatWriter* writer, const char* name, BOOL value);
+void PBTextFormatWriteFloat(PBTextFormatWriter* writer, const char* name, Float32 value);
+void PBTextFormatWriteDouble(PBTextFormatWriter* writer, const char* name, Float64 value);
+void PBTextFormatWriteObject(PBTextFormatWriter* writer, const char* name, id value);
+
+/**
+ * Writes "name {", the message's fields one level further in, and "}".
+ */
+void PBTextFormatWriteMessage(PBTextFormatWriter* writer, const char* name, PBAbstractMessage* message);
+
+#endif
@@ -0,0 +1,259 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "PBTextFormatWriter.h"
+
+#ifndef PB_LITE_RUNTIME
+
+#import "AbstractMessage.h"
+#import "Utilities.h"
+
+static const NSUInteger kInitialCapacity = 256;
+
+
+static void PBTextFormatWriterReserve(PBTextFormatWriter* writer, NSUInteger length) {
+  if (writer->capacity - writer->length >= length) {
+    return;
+  }
+  NSUInteger capacity = MAX(writer->capacity * 2, writer->length + length);
+  writer->bytes = PBReallocf(writer->bytes, capacity);
+  if (writer->bytes == NULL) {
+    @throw [NSException exceptionWithName:NSMallocException reason:@"" userInfo:nil];
+  }
+  writer->capacity = capacity;
+}
+
+
+void PBTextFormatWriterInit(PBTextFormatWriter* writer, NSString* indent) {
+  memset(writer, 0, sizeof(*writer));
+  writer->bytes = malloc(kInitialCapacity);
+  writer->capacity = kInitialCapacity;
+
+  const char* utf8 = indent.UTF8String;
+  NSUInteger length = utf8 == NULL ? 0 : strlen(utf8);
+  writer->indentCapacity = MAX(length * 2, (NSUInteger)32);
+  writer->indent = malloc(writer->indentCapacity);
+  memcpy(writer->indent, utf8, length);
+  writer->indentLength = length;
+}
+
+
+void PBTextFormatWriterDestroy(PBTextFormatWriter* writer) {
+  free(writer->bytes);
+  free(writer->indent);
+  memset(writer, 0, sizeof(*writer));
+}
+
+
+NSString* PBTextFormatWriterString(PBTextFormatWriter* writer) {
+  return [[NSString alloc] initWithBytes:writer->bytes length:writer->length encoding:NSUTF8StringEncoding];
+}
+
+
+NSString* PBTextFormatWriterIndent(PBTextFormatWriter* writer) {
+  return [[NSString alloc] initWithBytes:writer->indent length:writer->indentLength encoding:NSUTF8StringEncoding];
+}
+
+
+void PBTextFormatWriterAppendBytes(PBTextFormatWriter* writer, const void* bytes, NSUInteger length) {
+  PBTextFormatWriterReserve(writer, length);
+  memcpy(writer->bytes + writer->length, bytes, length);
+  writer->length += length;
+}
+
+
+void PBTextFormatWriterAppendCString(PBTextFormatWriter* writer, const char* string) {
+  PBTextFormatWriterAppendBytes(writer, string, strlen(string));
+}
+
+
+void PBTextFormatWriterAppendString(PBTextFormatWriter* writer, NSString* string) {
+  if (string == nil) {
+    PBTextFormatWriterAppendBytes(writer, "(null)", 6);
+    return;
+  }
+  // Most strings are ASCII or short, and their UTF-8 fits in the
+  // worst-case estimate, which saves asking for the exact length first.
+  NSUInteger maxLength = [string maximumLengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+  PBTextFormatWriterReserve(writer, maxLength);
+  NSUInteger used = 0;
+  [string getBytes:writer->bytes + writer->length
+         maxLength:maxLength
+        usedLength:&used
+          encoding:NSUTF8StringEncoding
+           options:0
+             range:NSMakeRange(0, string.length)
+    remainingRange:NULL];
+  writer->length += used;
+}
+
+
+void PBTextFormatWriterAppendUInt64(PBTextFormatWriter* writer, uint64_t value) {
+  char digits[20];
+  char* end = digits + sizeof(digits);
+  char* start = end;
+  do {
+    *--start = '0' + (char)(value % 10);
+    value /= 10;
+  } while (value != 0);
+  PBTextFormatWriterAppendBytes(writer, start, end - start);
+}
+
+
+void PBTextFormatWriterAppendInt64(PBTextFormatWriter* writer, int64_t value) {
+  if (value < 0) {
+    PBTextFormatWriterAppendBytes(writer, "-", 1);
+    // Negating in unsigned arithmetic also handles INT64_MIN.
+    PBTextFormatWriterAppendUInt64(writer, 0 - (uint64_t)value);
+  } else {
+    PBTextFormatWriterAppendUInt64(writer, (uint64_t)value);
+  }
+}
+
+
+// Matches printf's %.<precision>g.  Integral values below 10^precision print
+// without an exponent or a decimal point, so they are formatted by hand.
+static void PBTextFormatWriterAppendFloatingPoint(PBTextFormatWriter* writer, Float64 value, int precision, Float64 limit) {
+  if (value > -limit && value < limit && value == (int64_t)value && !(value == 0 && signbit(value))) {
+    PBTextFormatWriterAppendInt64(writer, (int64_t)value);
+    return;
+  }
+  char buffer[32];
+  int length = snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+  PBTextFormatWriterAppendBytes(writer, buffer, length);
+}
+
+
+void PBTextFormatWriterAppendObject(PBTextFormatWriter* writer, id value) {
+  if ([value isKindOfClass:[NSString class]]) {
+    PBTextFormatWriterAppendString(writer, value);
+  } else {
+    PBTextFormatWriterAppendString(writer, [value description]);
+  }
+}
+
+
+void PBTextFormatWriterAppendIndent(PBTextFormatWriter* writer) {
+  PBTextFormatWriterAppendBytes(writer, writer->indent, writer->indentLength);
+}
+
+
+void PBTextFormatWriterPushIndent(PBTextFormatWriter* writer) {
+  if (writer->indentCapacity - writer->indentLength < 2) {
+    writer->indentCapacity *= 2;
+    writer->indent = PBReallocf(writer->indent, writer->indentCapacity);
+    if (writer->indent == NULL) {
+      @throw [NSException exceptionWithName:NSMallocException reason:@"" userInfo:nil];
+    }
+  }
+  writer->indent[writer->indentLength++] = ' ';
+  writer->indent[writer->indentLength++] = ' ';
+}
+
+
+void PBTextFormatWriterPopIndent(PBTextFormatWriter* writer) {
+  writer->indentLength -= 2;
+}
+
+
+static void PBTextFormatWriteName(PBTextFormatWriter* writer, const char* name) {
+  size_t nameLength = strlen(name);
+  PBTextFormatWriterReserve(writer, writer->indentLength + nameLength + 2);
+  uint8_t* output = writer->bytes + writer->length;
+  memcpy(output, writer->indent, writer->indentLength);
+  output += writer->indentLength;
+  memcpy(output, name, nameLength);
+  output += nameLength;
+  *output++ = ':';
+  *output++ = ' ';
+  writer->length = output - writer->bytes;
+}
+
+
+static void PBTextFormatWriteNewline(PBTextFormatWriter* writer) {
+  PBTextFormatWriterAppendBytes(writer, "\n", 1);
+}
+
+
+void PBTextFormatWriteInt32(PBTextFormatWriter* writer, const char* name, int32_t value) {
+  PBTextFormatWriteName(writer, name);
+  PBTextFormatWriterAppendInt64(writer, value);
+  PBTextFormatWriteNewline(writer);
+}
+
+
+void PBTextFormatWriteUInt32(PBTextFormatWriter* writer, const char* name, uint32_t value) {
+  PBTextFormatWriteName(writer, name);
+  PBTextFormatWriterAppendUInt64(writer, value);
+  PBTextFormatWriteNewline(writer);
+}
+
+
+void PBTextFormatWriteInt64(PBTextFormatWriter* writer, const char* name, int64_t value) {
+  PBTextFormatWriteName(writer, name);
+  PBTextFormatWriterAppendInt64(writer, value);
+  PBTextFormatWriteNewline(writer);
+}
+
+
+void PBTextFormatWriteUInt64(PBTextFormatWriter* writer, const char* name, uint64_t value) {
+  PBTextFormatWriteName(writer, name);
+  PBTextFormatWriterAppendUInt64(writer, value);
+  PBTextFormatWriteNewline(writer);
+}
+
+
+void PBTextFormatWriteBool(PBTextFormatWriter* writer, const char* name, BOOL value) {
+  PBTextFormatWriteName(writer, name);
+  PBTextFormatWriterAppendBytes(writer, value ? "1" : "0", 1);
+  PBTextFormatWriteNewline(writer);
+}
+
+
+void PBTextFormatWriteFloat(PBTextFormatWriter* writer, const char* name, Float32 value) {
+  PBTextFormatWriteName(writer, name);
+  PBTextFormatWriterAppendFloatingPoint(writer, value, 7, 1e7);
+  PBTextFormatWriteNewline(writer);
+}
+
+
+void PBTextFormatWriteDouble(PBTextFormatWriter* writer, const char* name, Float64 value) {
+  PBTextFormatWriteName(writer, name);
+  PBTextFormatWriterAppendFloatingPoint(writer, value, 16, 1e16);
+  PBTextFormatWriteNewline(writer);
+}
+
+
+void PBTextFormatWriteObject(PBTextFormatWriter* writer, const char* name, id value) {
+  PBTextFormatWriteName(writer, name);
+  PBTextFormatWriterAppendObject(writer, value);
+  PBTextFormatWriteNewline(writer);
+}
+
+
+void PBTextFormatWriteMessage(PBTextFormatWriter* writer, const char* name, PBAbstractMessage* message) {
+  PBTextFormatWriterAppendIndent(writer);
+  PBTextFormatWriterAppendCString(writer, name);
+  PBTextFormatWriterAppendBytes(writer, " {\n", 3);
+  PBTextFormatWriterPushIndent(writer);
+  [message writeTextFormatTo:writer];
+  PBTextFormatWriterPopIndent(writer);
+  PBTextFormatWriterAppendIndent(writer);
+  PBTextFormatWriterAppendBytes(writer, "}\n", 2);
+}
+
+#endif
@@ -34,6 +34,15 @@
 #import "PBMutableExtensionRegistry.h"
 #import "MutableField.h"
 #import "PBArray.h"
+#import "PBBufferPool.h"
+#import "PBChannelWriter.h"
+#import "PBEnumTable.h"
+#import "PBFieldTable.h"
+#import "PBJSONReader.h"
+#import "PBJSONWriter.h"
+#import "PBMessageDelta.h"
+#import "PBTextFormatReader.h"
+#import "PBTextFormatWriter.h"
 #import "UnknownFieldSet.h"
 #import "UnknownFieldSet_Builder.h"
 #import "Utilities.h"
@@ -0,0 +1,71 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Fills buffers from a file descriptor with read(2) for
+ * {@link PBCodedInputStream}.  The stream hands back each buffer it has
+ * finished with and receives a full one in exchange, so bytes are never
+ * copied between the two.
+ *
+ * With read-ahead, a background thread fills the next buffer while the
+ * current one is being decoded, overlapping I/O with parsing.  The thread
+ * exits once {@code close} is called and any read(2) it is blocked in
+ * returns; {@code close} waits for that.  The descriptor is never closed
+ * here, and must stay open until {@code close} has returned, which
+ * PBCodedInputStream does when it is deallocated.
+ */
+@interface ReadAheadBuffer : NSObject {
+@private
+  int fileDescriptor;
+  BOOL readAhead;
+
+  /** Guards everything below, which the read-ahead thread shares. */
+  NSCondition* condition;
+  NSMutableData* emptyBuffer;
+  NSMutableData* fullBuffer;
+  NSInteger fullLength;
+  BOOL closed;
+  /** YES until the read-ahead thread stops using the descriptor. */
+  BOOL running;
+}
+
+- (id) initWithFileDescriptor:(int) fileDescriptor bufferSize:(int32_t) bufferSize readAhead:(BOOL) readAhead;
+
+/**
+ * Takes back {@code consumed} and returns a buffer holding the next bytes
+ * of the file, storing their count in {@code length}.  The count is zero at
+ * end of file and negative if read(2) failed.
+ */
+- (NSMutableData*) exchangeBuffer:(NSMutableData*) consumed length:(int32_t*) length;
+
+/**
+ * Moves the file offset forward by {@code count} bytes without reading
+ * them.  Returns NO if the descriptor can't seek or a read-ahead thread owns
+ * the offset, in which case the caller must read the bytes instead.
+ *
+ * @throws InvalidProtocolBuffer The file ends before the skipped bytes.
+ */
+- (BOOL) skip:(int32_t) count;
+
+/**
+ * Stops the read-ahead thread, if there is one, and waits until it is done
+ * with the descriptor.  If the thread is blocked in read(2), as on a pipe
+ * with no writer activity, this waits for that read to return.
+ */
+- (void) close;
+
+@end
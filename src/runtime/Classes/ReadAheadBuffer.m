@@ -0,0 +1,145 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "ReadAheadBuffer.h"
+
+#import <errno.h>
+#import <unistd.h>
+
+@interface ReadAheadBuffer ()
+- (void) readAheadLoop;
+@end
+
+
+@implementation ReadAheadBuffer
+
+- (id) initWithFileDescriptor:(int) fileDescriptor_ bufferSize:(int32_t) bufferSize readAhead:(BOOL) readAhead_ {
+  if ((self = [super init])) {
+    fileDescriptor = fileDescriptor_;
+    readAhead = readAhead_;
+    condition = [[NSCondition alloc] init];
+    if (readAhead) {
+      emptyBuffer = [NSMutableData dataWithLength:bufferSize];
+      running = YES;
+      [NSThread detachNewThreadSelector:@selector(readAheadLoop) toTarget:self withObject:nil];
+    }
+  }
+
+  return self;
+}
+
+
+/** One read(2), retried if interrupted by a signal. */
+static NSInteger readRetryingInterrupts(int fileDescriptor, uint8_t* bytes, NSUInteger length) {
+  NSInteger n;
+  do {
+    n = read(fileDescriptor, bytes, length);
+  } while (n < 0 && errno == EINTR);
+  return n;
+}
+
+
+- (void) readAheadLoop {
+  @autoreleasepool {
+    while (YES) {
+      [condition lock];
+      while (!closed && emptyBuffer == nil) {
+        [condition wait];
+      }
+      if (closed) {
+        [condition unlock];
+        break;
+      }
+      NSMutableData* data = emptyBuffer;
+      emptyBuffer = nil;
+      [condition unlock];
+
+      NSInteger n = readRetryingInterrupts(fileDescriptor, data.mutableBytes, data.length);
+
+      [condition lock];
+      fullBuffer = data;
+      fullLength = n;
+      [condition broadcast];
+      [condition unlock];
+
+      if (n <= 0) {
+        // End of file or an error; there is nothing more to read ahead.
+        break;
+      }
+    }
+
+    // The descriptor is no longer touched; let close return.
+    [condition lock];
+    running = NO;
+    [condition broadcast];
+    [condition unlock];
+  }
+}
+
+
+- (NSMutableData*) exchangeBuffer:(NSMutableData*) consumed length:(int32_t*) length {
+  if (!readAhead) {
+    *length = (int32_t)readRetryingInterrupts(fileDescriptor, consumed.mutableBytes, consumed.length);
+    return consumed;
+  }
+
+  [condition lock];
+  while (fullBuffer == nil) {
+    [condition wait];
+  }
+  NSMutableData* data = fullBuffer;
+  *length = (int32_t)fullLength;
+  fullBuffer = nil;
+  if (fullLength > 0) {
+    // Let the thread start on the next buffer while this one is decoded.
+    emptyBuffer = consumed;
+    [condition broadcast];
+  } else {
+    // The thread has exited; keep reporting the same result.
+    fullBuffer = data;
+  }
+  [condition unlock];
+  return data;
+}
+
+
+- (BOOL) skip:(int32_t) count {
+  if (readAhead || lseek(fileDescriptor, count - 1, SEEK_CUR) < 0) {
+    return NO;
+  }
+
+  // Seeking past the end of a file succeeds, so read the last skipped byte
+  // to make sure it exists.
+  uint8_t last;
+  if (readRetryingInterrupts(fileDescriptor, &last, 1) != 1) {
+    @throw [NSException exceptionWithName:@"InvalidProtocolBuffer" reason:@"truncatedMessage" userInfo:nil];
+  }
+  return YES;
+}
+
+
+- (void) close {
+  [condition lock];
+  closed = YES;
+  [condition broadcast];
+  while (running) {
+    [condition wait];
+  }
+  [condition unlock];
+}
+
+@end
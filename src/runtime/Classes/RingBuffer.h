@@ -1,14 +1,27 @@
 #import <Foundation/Foundation.h>
 
+@class WriteBehindBuffer;
+
+// Buffered bytes are kept contiguous, from tail up to position, so that each
+// flush is a single write.  Space freed at the front by a partial flush is
+// reclaimed by moving the remaining bytes down once the end is reached.
 @interface RingBuffer : NSObject {
 	NSMutableData *buffer;
 	NSInteger position;
 	NSInteger tail;
+	BOOL checksumming;
+	uint32_t checksum;
+	NSInteger checksumPosition;
 }
 @property (nonatomic, readonly) NSUInteger freeSpace;
+// Number of bytes waiting to be flushed
+@property (nonatomic, readonly) NSUInteger length;
 
 - (id)initWithData:(NSMutableData*)data;
 
+// Starts over, empty, on data
+- (void)resetWithData:(NSMutableData*)data;
+
 // Returns false if there is not enough free space in buffer
 - (BOOL)appendByte:(uint8_t)byte;
 
@@ -18,4 +31,15 @@
 // Returns number of bytes written
 - (NSInteger)flushToOutputStream:(NSOutputStream*)stream;
 
+// Starts a CRC32C over the bytes appended from now on.  Bytes are checksummed
+// in the buffer, just before they are flushed or moved, or when it ends.
+- (void)beginChecksum;
+
+// Returns the CRC32C of the bytes appended since beginChecksum
+- (uint32_t)endChecksum;
+
+// Hands the buffered bytes and their backing data to writer, and carries on
+// with the empty data it returns
+- (void)flushToWriter:(WriteBehindBuffer*)writer;
+
 @end
@@ -1,4 +1,6 @@
 #import "RingBuffer.h"
+#import "Utilities.h"
+#import "WriteBehindBuffer.h"
 
 @implementation RingBuffer
 
@@ -10,83 +12,100 @@
 }
 
 
+- (void)resetWithData:(NSMutableData*)data {
+	buffer = data;
+	position = tail = checksumPosition = 0;
+	checksumming = NO;
+}
+
+
 - (NSUInteger)freeSpace {
-	return (position < tail ? tail - position : (buffer.length - position) + tail) - (tail ? 1 : 0);
+	return buffer.length - position + tail;
+}
+
+
+- (NSUInteger)length {
+	return position - tail;
+}
+
+
+// Checksums the bytes appended since the last update.
+- (void)updateChecksum {
+	if (checksumming) {
+		checksum = computeCRC32C(checksum, (const uint8_t*)buffer.bytes + checksumPosition, position - checksumPosition);
+	}
+	checksumPosition = position;
+}
+
+
+- (void)beginChecksum {
+	checksumming = YES;
+	checksum = 0;
+	checksumPosition = position;
+}
+
+
+- (uint32_t)endChecksum {
+	[self updateChecksum];
+	checksumming = NO;
+	return checksum;
+}
+
+
+// Moves the buffered bytes to the front to make room after them.
+- (void)compact {
+	[self updateChecksum];
+	uint8_t *data = buffer.mutableBytes;
+	memmove(data, data + tail, position - tail);
+	position -= tail;
+	tail = 0;
+	checksumPosition = position;
 }
 
 
 - (BOOL)appendByte:(uint8_t)byte {
-	if (self.freeSpace < 1) return NO;
+	if (position == buffer.length) {
+		if (tail == 0) return NO;
+		[self compact];
+	}
 	((uint8_t*)buffer.mutableBytes)[position++] = byte;
 	return YES;
 }
 
 
 - (NSInteger)appendData:(const NSData*)value offset:(NSInteger)offset length:(NSInteger)length {
-	NSInteger totalWritten = 0;
-	const uint8_t *input = value.bytes;
-	uint8_t *data = buffer.mutableBytes;
-	
-	if (position >= tail) {
-		totalWritten = MIN(buffer.length - position, length);
-		memcpy(data + position, input + offset, totalWritten);
-		position += totalWritten;
-		if (totalWritten == length) return length;
-		length -= totalWritten;
-		offset += totalWritten;
-	}
-	
-	NSUInteger freeSpace = self.freeSpace;
-	if (!freeSpace) return totalWritten;
-	
-	if (position == buffer.length) {
-		position = 0;
+	if (length > buffer.length - position && tail > 0) {
+		[self compact];
 	}
-	
-	// position < tail
-	int32_t written = MIN(freeSpace, length);
-	memcpy(data + position, input + offset, written);
+
+	NSInteger written = MIN(buffer.length - position, length);
+	memcpy((uint8_t*)buffer.mutableBytes + position, (const uint8_t*)value.bytes + offset, written);
 	position += written;
-	totalWritten += written;
-	
-	return totalWritten;
+	return written;
 }
 
 
 - (NSInteger)flushToOutputStream:(NSOutputStream*)stream {
-	NSInteger totalWritten = 0;
-	const uint8_t *data = buffer.bytes;
-	
-	if (tail > position) {
-		int32_t written = [stream write:data + tail maxLength:buffer.length - tail];
-        if (written <= 0) return totalWritten;
-        totalWritten += written;
-		tail += written;
-		if (tail == buffer.length) {
-			tail = 0;
-		}
-	}
+	if (tail == position) return 0;
+	[self updateChecksum];
+
+	NSInteger written = [stream write:(const uint8_t*)buffer.bytes + tail maxLength:position - tail];
+	if (written <= 0) return 0;
+	tail += written;
 
-	if (tail < position) {
-		int32_t written = [stream write:data + tail maxLength:position - tail];
-		if (written <= 0) return totalWritten;
-		totalWritten += written;
-		tail += written;
+	if (tail == position) {
+		tail = position = checksumPosition = 0;
 	}
+	return written;
+}
 
-    if (tail == position) {
-        tail = position = 0;
-    }
 
-    if (position == buffer.length && tail > 0) {
-        position = 0;
-    }
+- (void)flushToWriter:(WriteBehindBuffer*)writer {
+	if (tail == position) return;
+	[self updateChecksum];
 
-    if (tail == buffer.length) {
-        tail = 0;
-    }
-	
-	return totalWritten;
+	buffer = [writer writeData:buffer range:NSMakeRange(tail, position - tail)];
+	tail = position = checksumPosition = 0;
 }
 
 @end
@@ -15,6 +15,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#import "PBTextFormatWriter.h"
+
 @class PBCodedOutputStream;
 @class PBField;
 @class PBUnknownFieldSet_Builder;
@@ -44,7 +46,10 @@
 - (BOOL) hasField:(int32_t) number;
 - (PBField*) getField:(int32_t) number;
 
+#ifndef PB_LITE_RUNTIME
 - (void) writeDescriptionTo:(NSMutableString*) output
                  withIndent:(NSString*) indent;
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer;
+#endif
 
 @end
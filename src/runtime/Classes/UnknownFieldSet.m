@@ -87,14 +87,28 @@ static PBUnknownFieldSet* defaultInstance = nil;
 }
 
 
+#ifndef PB_LITE_RUNTIME
 - (void) writeDescriptionTo:(NSMutableString*) output
                  withIndent:(NSString *)indent {
+  PBTextFormatWriter writer;
+  PBTextFormatWriterInit(&writer, indent);
+  [self writeTextFormatTo:&writer];
+  [output appendString:PBTextFormatWriterString(&writer)];
+  PBTextFormatWriterDestroy(&writer);
+}
+
+
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  if (fields.count == 0) {
+    return;
+  }
   NSArray* sortedKeys = [fields.allKeys sortedArrayUsingSelector:@selector(compare:)];
   for (NSNumber* number in sortedKeys) {
     PBField* value = [fields objectForKey:number];
-    [value writeDescriptionFor:number.intValue to:output withIndent:indent];
+    [value writeTextFormatFor:number.intValue to:writer];
   }
 }
+#endif
 
 
 + (PBUnknownFieldSet*) parseFromCodedInputStream:(PBCodedInputStream*) input {
@@ -198,6 +198,24 @@
   @throw [NSException exceptionWithName:@"UnsupportedMethod" reason:@"" userInfo:nil];
 }
 
+#ifndef PB_LITE_RUNTIME
+- (PBUnknownFieldSet_Builder*) mergeFromTextFormat:(NSData*) data {
+  @throw [NSException exceptionWithName:@"UnsupportedMethod" reason:@"" userInfo:nil];
+}
+
+- (PBUnknownFieldSet_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  @throw [NSException exceptionWithName:@"UnsupportedMethod" reason:@"" userInfo:nil];
+}
+
+- (PBUnknownFieldSet_Builder*) mergeFromJSON:(NSData*) data {
+  @throw [NSException exceptionWithName:@"UnsupportedMethod" reason:@"" userInfo:nil];
+}
+
+- (PBUnknownFieldSet_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  @throw [NSException exceptionWithName:@"UnsupportedMethod" reason:@"" userInfo:nil];
+}
+#endif
+
 - (PBUnknownFieldSet_Builder*) mergeVarintField:(int32_t) number value:(int32_t) value {
   if (number == 0) {
     @throw [NSException exceptionWithName:@"IllegalArgument" reason:@"Zero is not a valid field number." userInfo:nil];
@@ -215,6 +233,11 @@
  */
 - (BOOL) mergeFieldFrom:(int32_t) tag input:(PBCodedInputStream*) input {
   int32_t number = PBWireFormatGetTagFieldNumber(tag);
+#ifdef PB_STREAM_STATISTICS
+  if (PBWireFormatGetTagWireType(tag) != PBWireFormatEndGroup) {
+    [input countUnknownField];
+  }
+#endif
   switch (PBWireFormatGetTagWireType(tag)) {
     case PBWireFormatVarint:
       [[self getFieldBuilder:number] addVarint:[input readInt64]];
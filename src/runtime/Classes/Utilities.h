@@ -30,6 +30,13 @@ int64_t  convertUInt32ToInt32(uint32_t u);
 int32_t logicalRightShift32(int32_t value, int32_t spaces);
 int64_t logicalRightShift64(int64_t value, int32_t spaces);
 
+/**
+ * Resizes {@code ptr} like realloc(3), but frees it if the allocation fails,
+ * so callers can overwrite their only pointer with the result.  This is the
+ * BSD reallocf, which glibc does not provide.
+ */
+void* PBReallocf(void* ptr, size_t size);
+
 
 /**
  * Decode a ZigZag-encoded 32-bit value.  ZigZag encodes signed integers
@@ -333,3 +340,33 @@ int32_t computeRawMessageSetExtensionSize(int32_t fieldNumber, const NSData* val
  * enum value to its numeric value.
  */
 int32_t computeEnumSize(int32_t fieldNumber, int32_t value);
+
+/**
+ * Returns the number of leading bytes in {@code bytes} that are 7-bit ASCII.
+ * Uses SSE2 or NEON where available to test sixteen bytes at a time.
+ */
+int32_t countASCIIPrefix(const uint8_t* bytes, int32_t length);
+
+/**
+ * Returns YES if {@code bytes} is well-formed UTF-8, rejecting overlong
+ * encodings, surrogates and code points above U+10FFFF.  Runs of ASCII are
+ * skipped with {@link countASCIIPrefix}.  On success {@code isASCII} is set
+ * to YES if every byte was below 0x80.
+ */
+BOOL isValidUTF8(const uint8_t* bytes, int32_t length, BOOL* isASCII);
+
+/**
+ * Converts the unsigned decimal number in {@code text} to the nearest double.
+ * The caller has scanned it as {@code mantissa} times ten to the
+ * {@code exponent}, with {@code exact} cleared if digits were dropped.  Up to
+ * 2^53 with a power of ten below 10^23 this is one correctly rounded multiply
+ * or divide; anything else goes through strtod.
+ */
+Float64 convertDecimalToFloat64(uint64_t mantissa, int32_t exponent, BOOL exact, const uint8_t* text, NSUInteger length);
+
+/**
+ * Extends the CRC32C (Castagnoli) checksum {@code crc} over {@code length}
+ * more bytes.  Start with 0; checksums of consecutive ranges chain.  Uses the
+ * SSE4.2 or ARMv8 crc32c instructions when available and a table otherwise.
+ */
+uint32_t computeCRC32C(uint32_t crc, const uint8_t* bytes, size_t length);
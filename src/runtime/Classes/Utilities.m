@@ -17,9 +17,22 @@
 
 #import "Utilities.h"
 
+#import <dispatch/dispatch.h>
+
 #import "UnknownFieldSet.h"
 #import "WireFormat.h"
 
+#if defined(__SSE2__)
+#import <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#import <arm_neon.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#import <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#import <arm_acle.h>
+#endif
+
 const int32_t LITTLE_ENDIAN_32_SIZE = 4;
 const int32_t LITTLE_ENDIAN_64_SIZE = 8;
 
@@ -89,6 +102,15 @@ int64_t logicalRightShift64(int64_t value, int32_t spaces) {
 }
 
 
+void* PBReallocf(void* ptr, size_t size) {
+  void* result = realloc(ptr, size);
+  if (result == NULL && size != 0) {
+    free(ptr);
+  }
+  return result;
+}
+
+
 int32_t decodeZigZag32(int32_t n) {
 	return logicalRightShift32(n, 1) ^ -(n & 1);
 }
@@ -349,3 +371,231 @@ int32_t computeRawMessageSetExtensionSize(int32_t fieldNumber, const NSData* val
 	computeUInt32Size(PBWireFormatMessageSetTypeId, fieldNumber) +
 	computeDataSize(PBWireFormatMessageSetMessage, value);
 }
+
+
+int32_t countASCIIPrefix(const uint8_t* bytes, int32_t length) {
+  int32_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= length; i += 16) {
+    int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(bytes + i)));
+    if (mask != 0) {
+      return i + __builtin_ctz(mask);
+    }
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 16 <= length; i += 16) {
+    if (vmaxvq_u8(vld1q_u8(bytes + i)) >= 0x80) {
+      break;
+    }
+  }
+#endif
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    memcpy(&word, bytes + i, sizeof(word));
+    if (word & 0x8080808080808080ULL) {
+      break;
+    }
+  }
+  while (i < length && bytes[i] < 0x80) {
+    i++;
+  }
+  return i;
+}
+
+BOOL isValidUTF8(const uint8_t* bytes, int32_t length, BOOL* isASCII) {
+  int32_t i = countASCIIPrefix(bytes, length);
+  *isASCII = (i == length);
+  while (i < length) {
+    uint8_t lead = bytes[i];
+    if (lead < 0x80) {
+      i += countASCIIPrefix(bytes + i, length - i);
+      continue;
+    }
+    // Lead bytes and second-byte ranges follow Table 3-7 of the Unicode
+    // standard, which excludes overlongs and surrogates.
+    int32_t trailing;
+    uint8_t lower = 0x80;
+    uint8_t upper = 0xBF;
+    if (lead < 0xC2) {
+      return NO;
+    } else if (lead < 0xE0) {
+      trailing = 1;
+    } else if (lead < 0xF0) {
+      trailing = 2;
+      if (lead == 0xE0) {
+        lower = 0xA0;
+      } else if (lead == 0xED) {
+        upper = 0x9F;
+      }
+    } else if (lead < 0xF5) {
+      trailing = 3;
+      if (lead == 0xF0) {
+        lower = 0x90;
+      } else if (lead == 0xF4) {
+        upper = 0x8F;
+      }
+    } else {
+      return NO;
+    }
+    if (length - i <= trailing) {
+      return NO;
+    }
+    if (bytes[i + 1] < lower || bytes[i + 1] > upper) {
+      return NO;
+    }
+    for (int32_t k = 2; k <= trailing; k++) {
+      if ((bytes[i + k] & 0xC0) != 0x80) {
+        return NO;
+      }
+    }
+    i += trailing + 1;
+  }
+  return YES;
+}
+
+
+static const uint32_t kCRC32CTable[256] = {
+  0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c,
+  0x26a1e7e8, 0xd4ca64eb, 0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b,
+  0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24, 0x105ec76f, 0xe235446c,
+  0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+  0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc,
+  0xbc267848, 0x4e4dfb4b, 0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a,
+  0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35, 0xaa64d611, 0x580f5512,
+  0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+  0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad,
+  0x1642ae59, 0xe4292d5a, 0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a,
+  0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595, 0x417b1dbc, 0xb3109ebf,
+  0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+  0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f,
+  0xed03a29b, 0x1f682198, 0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927,
+  0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38, 0xdbfc821c, 0x2997011f,
+  0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+  0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e,
+  0x4767748a, 0xb50cf789, 0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859,
+  0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46, 0x7198540d, 0x83f3d70e,
+  0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+  0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de,
+  0xdde0eb2a, 0x2f8b6829, 0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c,
+  0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93, 0x082f63b7, 0xfa44e0b4,
+  0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+  0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b,
+  0xb4091bff, 0x466298fc, 0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c,
+  0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033, 0xa24bb5a6, 0x502036a5,
+  0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+  0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975,
+  0x0e330a81, 0xfc588982, 0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d,
+  0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622, 0x38cc2a06, 0xcaa7a905,
+  0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+  0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8,
+  0xe52cc12c, 0x1747422f, 0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff,
+  0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0, 0xd3d3e1ab, 0x21b862a8,
+  0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+  0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78,
+  0x7fab5e8c, 0x8dc0dd8f, 0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee,
+  0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1, 0x69e9f0d5, 0x9b8273d6,
+  0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+  0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69,
+  0xd5cf889d, 0x27a40b9e, 0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e,
+  0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351
+};
+
+
+static uint32_t updateCRC32CTable(uint32_t crc, const uint8_t* bytes, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    crc = kCRC32CTable[(crc ^ bytes[i]) & 0xff] ^ (crc >> 8);
+  }
+  return crc;
+}
+
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("sse4.2")))
+static uint32_t updateCRC32CSSE42(uint32_t crc, const uint8_t* bytes, size_t length) {
+  for (; length > 0 && ((uintptr_t)bytes & 7) != 0; length--) {
+    crc = _mm_crc32_u8(crc, *bytes++);
+  }
+#if defined(__x86_64__)
+  uint64_t crc64 = crc;
+  for (; length >= 8; length -= 8, bytes += 8) {
+    crc64 = _mm_crc32_u64(crc64, *(const uint64_t*)bytes);
+  }
+  crc = (uint32_t)crc64;
+#endif
+  for (; length >= 4; length -= 4, bytes += 4) {
+    crc = _mm_crc32_u32(crc, *(const uint32_t*)bytes);
+  }
+  for (; length > 0; length--) {
+    crc = _mm_crc32_u8(crc, *bytes++);
+  }
+  return crc;
+}
+#elif defined(__ARM_FEATURE_CRC32)
+static uint32_t updateCRC32CARM(uint32_t crc, const uint8_t* bytes, size_t length) {
+  for (; length > 0 && ((uintptr_t)bytes & 7) != 0; length--) {
+    crc = __crc32cb(crc, *bytes++);
+  }
+  for (; length >= 8; length -= 8, bytes += 8) {
+    crc = __crc32cd(crc, *(const uint64_t*)bytes);
+  }
+  for (; length > 0; length--) {
+    crc = __crc32cb(crc, *bytes++);
+  }
+  return crc;
+}
+#endif
+
+
+typedef uint32_t (*CRC32CUpdater)(uint32_t crc, const uint8_t* bytes, size_t length);
+
+
+// The SSE4.2 crc32 instruction computes CRC32C.  It is used whenever the
+// CPU has it, whatever the compiler was told to target, so the CPU is asked
+// once and the answer kept.  ARMv8 has the equivalent when the target
+// includes the CRC extension.
+static CRC32CUpdater resolveCRC32CUpdater(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  if (__builtin_cpu_supports("sse4.2")) {
+    return updateCRC32CSSE42;
+  }
+#elif defined(__ARM_FEATURE_CRC32)
+  return updateCRC32CARM;
+#endif
+  return updateCRC32CTable;
+}
+
+
+uint32_t computeCRC32C(uint32_t crc, const uint8_t* bytes, size_t length) {
+  static CRC32CUpdater update;
+  static dispatch_once_t resolved;
+  dispatch_once(&resolved, ^{
+    update = resolveCRC32CUpdater();
+  });
+  return ~update(~crc, bytes, length);
+}
+
+
+Float64 convertDecimalToFloat64(uint64_t mantissa, int32_t exponent, BOOL exact, const uint8_t* text, NSUInteger length) {
+  static const Float64 kPowersOfTen[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+  };
+
+  if (exact && mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+    return exponent < 0 ? (Float64)mantissa / kPowersOfTen[-exponent]
+                        : (Float64)mantissa * kPowersOfTen[exponent];
+  }
+
+  char stackBuffer[64];
+  char* buffer = length < sizeof(stackBuffer) ? stackBuffer : malloc(length + 1);
+  if (buffer == NULL) {
+    @throw [NSException exceptionWithName:NSMallocException reason:@"" userInfo:nil];
+  }
+  memcpy(buffer, text, length);
+  buffer[length] = '\0';
+  Float64 value = strtod(buffer, NULL);
+  if (buffer != stackBuffer) {
+    free(buffer);
+  }
+  return value;
+}
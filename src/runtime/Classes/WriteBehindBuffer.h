@@ -0,0 +1,71 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * Writes buffers to a file descriptor with write(2) for
+ * {@link PBCodedOutputStream}, retrying until every byte is written.  The
+ * stream hands over each buffer it has filled and receives an empty one in
+ * exchange.
+ *
+ * With write-behind, a background thread writes the filled buffer while the
+ * stream fills the next, so encoding overlaps disk or pipe I/O.  At most one
+ * buffer is in flight; handing over another waits for it.  Errors from the
+ * thread are raised by the next call.  The descriptor is never closed here,
+ * and must stay open until {@code close} has returned, which
+ * PBCodedOutputStream does when it is deallocated.
+ */
+@interface WriteBehindBuffer : NSObject {
+@private
+  int fileDescriptor;
+  BOOL writeBehind;
+
+  /** Guards everything below, which the write-behind thread shares. */
+  NSCondition* condition;
+  NSMutableData* pendingBuffer;
+  NSRange pendingRange;
+  NSMutableData* spareBuffer;
+  int writeError;
+  BOOL closed;
+  /** YES until the write-behind thread stops using the descriptor. */
+  BOOL running;
+}
+
+- (id) initWithFileDescriptor:(int) fileDescriptor bufferSize:(int32_t) bufferSize writeBehind:(BOOL) writeBehind;
+
+/**
+ * Writes the bytes of {@code data} in {@code range} and returns a buffer of
+ * the same size that is free to be filled.
+ *
+ * @throws IOError write(2) failed.
+ */
+- (NSMutableData*) writeData:(NSMutableData*) data range:(NSRange) range;
+
+/**
+ * Waits until everything handed over has been written.
+ *
+ * @throws IOError write(2) failed.
+ */
+- (void) synchronize;
+
+/**
+ * Stops the write-behind thread once it has written what it holds, and
+ * waits until it is done with the descriptor.  Errors from that last write
+ * are not raised; call {@code synchronize} first to see them.
+ */
+- (void) close;
+
+@end
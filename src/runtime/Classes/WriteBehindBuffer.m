@@ -0,0 +1,168 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "WriteBehindBuffer.h"
+
+#import <errno.h>
+#import <string.h>
+#import <unistd.h>
+
+@interface WriteBehindBuffer ()
+- (void) writeBehindLoop;
+@end
+
+
+@implementation WriteBehindBuffer
+
+- (id) initWithFileDescriptor:(int) fileDescriptor_ bufferSize:(int32_t) bufferSize writeBehind:(BOOL) writeBehind_ {
+  if ((self = [super init])) {
+    fileDescriptor = fileDescriptor_;
+    writeBehind = writeBehind_;
+    condition = [[NSCondition alloc] init];
+    if (writeBehind) {
+      spareBuffer = [NSMutableData dataWithLength:bufferSize];
+      running = YES;
+      [NSThread detachNewThreadSelector:@selector(writeBehindLoop) toTarget:self withObject:nil];
+    }
+  }
+
+  return self;
+}
+
+
+/**
+ * Writes all of {@code length} bytes, retrying after short writes and
+ * signals.  Returns zero, or the errno of the write that failed.
+ */
+static int writeFully(int fileDescriptor, const uint8_t* bytes, NSUInteger length) {
+  while (length > 0) {
+    ssize_t n = write(fileDescriptor, bytes, length);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return errno;
+    }
+    bytes += n;
+    length -= n;
+  }
+  return 0;
+}
+
+
+static void raiseWriteError(int error) {
+  @throw [NSException exceptionWithName:@"IOError"
+                                 reason:[NSString stringWithUTF8String:strerror(error)]
+                               userInfo:nil];
+}
+
+
+- (void) writeBehindLoop {
+  @autoreleasepool {
+    while (YES) {
+      [condition lock];
+      while (!closed && pendingBuffer == nil) {
+        [condition wait];
+      }
+      if (pendingBuffer == nil) {
+        [condition unlock];
+        break;
+      }
+      NSMutableData* data = pendingBuffer;
+      NSRange range = pendingRange;
+      [condition unlock];
+
+      int error = writeError == 0 ? writeFully(fileDescriptor, (const uint8_t*)data.bytes + range.location, range.length) : 0;
+
+      [condition lock];
+      if (error != 0) {
+        writeError = error;
+      }
+      pendingBuffer = nil;
+      spareBuffer = data;
+      [condition broadcast];
+      [condition unlock];
+    }
+
+    // The descriptor is no longer touched; let close return.
+    [condition lock];
+    running = NO;
+    [condition broadcast];
+    [condition unlock];
+  }
+}
+
+
+- (NSMutableData*) writeData:(NSMutableData*) data range:(NSRange) range {
+  if (!writeBehind) {
+    int error = writeFully(fileDescriptor, (const uint8_t*)data.bytes + range.location, range.length);
+    if (error != 0) {
+      raiseWriteError(error);
+    }
+    return data;
+  }
+
+  [condition lock];
+  while (pendingBuffer != nil) {
+    [condition wait];
+  }
+  int error = writeError;
+  NSMutableData* spare = spareBuffer;
+  if (error == 0) {
+    pendingBuffer = data;
+    pendingRange = range;
+    spareBuffer = nil;
+    [condition broadcast];
+  }
+  [condition unlock];
+
+  if (error != 0) {
+    raiseWriteError(error);
+  }
+  return spare;
+}
+
+
+- (void) synchronize {
+  if (!writeBehind) {
+    return;
+  }
+
+  [condition lock];
+  while (pendingBuffer != nil) {
+    [condition wait];
+  }
+  int error = writeError;
+  [condition unlock];
+
+  if (error != 0) {
+    raiseWriteError(error);
+  }
+}
+
+
+- (void) close {
+  [condition lock];
+  closed = YES;
+  [condition broadcast];
+  while (running) {
+    [condition wait];
+  }
+  [condition unlock];
+}
+
+@end
@@ -0,0 +1,99 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import "BufferPoolTests.h"
+
+#import "PBBufferPool.h"
+#import "TestUtilities.h"
+#import "Unittest.pb.h"
+
+@implementation BufferPoolTests
+
+- (void) testPooledDataMatchesData {
+  TestAllTypes* message = [TestUtilities allSet];
+  STAssertEqualObjects(message.data, message.pooledData, @"");
+  STAssertEqualObjects([NSData data], [[TestAllTypes defaultInstance] pooledData], @"");
+
+  // Too large to pool.
+  TestAllTypes* huge = [[[TestAllTypes builderWithPrototype:message]
+                         setOptionalBytes:[NSMutableData dataWithLength:1 << 20]] build];
+  STAssertEqualObjects(huge.data, huge.pooledData, @"");
+}
+
+
+- (void) testBuffersAreReused {
+  TestAllTypes* message = [TestUtilities allSet];
+  const void* bytes;
+  @autoreleasepool {
+    NSData* data = message.pooledData;
+    bytes = data.bytes;
+  }
+  @autoreleasepool {
+    NSData* data = message.pooledData;
+    STAssertTrue(bytes == data.bytes, @"");
+
+    // A second view while the first is alive needs its own buffer.
+    NSData* other = message.pooledData;
+    STAssertTrue(data.bytes != other.bytes, @"");
+    STAssertEqualObjects(data, other, @"");
+  }
+
+  [[PBBufferPool currentPool] drain];
+  STAssertEqualObjects(message.data, message.pooledData, @"");
+}
+
+
+- (void) testStreamIsReused {
+  PBBufferPool* pool = [PBBufferPool currentPool];
+  NSMutableData* buffer = [pool takeBufferWithCapacity:64];
+  PBCodedOutputStream* stream = [pool takeStreamWritingToBuffer:buffer];
+  [stream writeRawByte:1];
+
+  // Taken again while in use, as by nested serialization.
+  NSMutableData* otherBuffer = [pool takeBufferWithCapacity:64];
+  PBCodedOutputStream* other = [pool takeStreamWritingToBuffer:otherBuffer];
+  STAssertTrue(stream != other, @"");
+  [other writeRawByte:2];
+  [pool returnStream:other];
+  [pool returnStream:stream];
+  STAssertTrue(1 == ((uint8_t*)buffer.bytes)[0], @"");
+  STAssertTrue(2 == ((uint8_t*)otherBuffer.bytes)[0], @"");
+
+  // Given back, the same stream starts over on the next buffer.
+  STAssertTrue(stream == [pool takeStreamWritingToBuffer:otherBuffer], @"");
+  [stream writeRawByte:3];
+  [pool returnStream:stream];
+  STAssertTrue(3 == ((uint8_t*)otherBuffer.bytes)[0], @"");
+
+  // pooledData gives it back when it is done.
+  TestAllTypes* message = [TestUtilities allSet];
+  STAssertEqualObjects(message.data, message.pooledData, @"");
+  STAssertTrue(stream == [pool takeStreamWritingToBuffer:buffer], @"");
+  [pool returnStream:stream];
+}
+
+
+- (void) testBufferCapacity {
+  PBBufferPool* pool = [PBBufferPool currentPool];
+  STAssertTrue(64 == [pool takeBufferWithCapacity:0].length, @"");
+  STAssertTrue(64 == [pool takeBufferWithCapacity:64].length, @"");
+  STAssertTrue(128 == [pool takeBufferWithCapacity:65].length, @"");
+  STAssertTrue(65536 == [pool takeBufferWithCapacity:65536].length, @"");
+  STAssertTrue(65537 == [pool takeBufferWithCapacity:65537].length, @"");
+}
+
+@end
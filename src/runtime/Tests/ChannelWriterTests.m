@@ -0,0 +1,180 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import "ChannelWriterTests.h"
+
+#import <fcntl.h>
+#import <unistd.h>
+
+#import "PBChannelWriter.h"
+#import "TestUtilities.h"
+#import "Unittest.pb.h"
+
+@implementation ChannelWriterTests
+
+- (NSString*) path {
+  return [NSTemporaryDirectory() stringByAppendingPathComponent:@"ChannelWriterTests.out"];
+}
+
+
+- (dispatch_io_t) openChannel {
+  return [self openChannelOfType:DISPATCH_IO_STREAM];
+}
+
+
+- (dispatch_io_t) openChannelOfType:(dispatch_io_type_t) type {
+  int fileDescriptor = open([self.path fileSystemRepresentation], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  STAssertTrue(fileDescriptor >= 0, @"");
+  return dispatch_io_create(type,
+                            fileDescriptor,
+                            dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),
+                            ^(int error) { close(fileDescriptor); });
+}
+
+
+- (void) closeChannel:(dispatch_io_t) channel {
+  // Closing without DISPATCH_IO_STOP lets queued writes finish; the barrier
+  // runs once they have.
+  dispatch_semaphore_t closed = dispatch_semaphore_create(0);
+  dispatch_io_barrier(channel, ^{ dispatch_semaphore_signal(closed); });
+  dispatch_semaphore_wait(closed, DISPATCH_TIME_FOREVER);
+  dispatch_io_close(channel, 0);
+}
+
+
+- (void) testWriteToChannel {
+  TestAllTypes* message = [TestUtilities allSet];
+  dispatch_io_t channel = [self openChannel];
+  dispatch_semaphore_t done = dispatch_semaphore_create(0);
+  __block int result = -1;
+
+  [message writeToChannel:channel
+                    queue:dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)
+               completion:^(int error) {
+                 result = error;
+                 dispatch_semaphore_signal(done);
+               }];
+  dispatch_semaphore_wait(done, DISPATCH_TIME_FOREVER);
+  [self closeChannel:channel];
+
+  STAssertTrue(result == 0, @"");
+  STAssertEqualObjects(message.data, [NSData dataWithContentsOfFile:self.path], @"");
+}
+
+
+/** Tests that messages written at their own offsets don't overwrite each other. */
+- (void) testWriteToRandomChannelAtOffsets {
+  TestAllTypes* first = [TestUtilities allSet];
+  TestAllTypes* second = [[[TestAllTypes builder] setOptionalInt32:101] build];
+  dispatch_io_t channel = [self openChannelOfType:DISPATCH_IO_RANDOM];
+  dispatch_group_t writes = dispatch_group_create();
+  __block int32_t failures = 0;
+  void (^completion)(int) = ^(int error) {
+    if (error != 0) {
+      __sync_fetch_and_add(&failures, 1);
+    }
+    dispatch_group_leave(writes);
+  };
+
+  dispatch_group_enter(writes);
+  [first writeToChannel:channel
+                 offset:0
+                  queue:dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)
+             completion:completion];
+  dispatch_group_enter(writes);
+  [second writeToChannel:channel
+                  offset:first.serializedSize
+                   queue:dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)
+              completion:completion];
+  dispatch_group_wait(writes, DISPATCH_TIME_FOREVER);
+  [self closeChannel:channel];
+
+  NSMutableData* expected = [NSMutableData dataWithData:first.data];
+  [expected appendData:second.data];
+  STAssertTrue(failures == 0, @"");
+  STAssertEqualObjects(expected, [NSData dataWithContentsOfFile:self.path], @"");
+  [[NSFileManager defaultManager] removeItemAtPath:self.path error:NULL];
+}
+
+
+- (void) testWritesStayInOrder {
+  dispatch_io_t channel = [self openChannel];
+  PBChannelWriter* writer =
+  [PBChannelWriter writerWithChannel:channel
+                               queue:dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)
+                    maxPendingWrites:2];
+
+  __block int32_t failures = 0;
+  void (^completion)(int) = ^(int error) {
+    if (error != 0) {
+      __sync_fetch_and_add(&failures, 1);
+    }
+  };
+
+  NSMutableData* expected = [NSMutableData data];
+  NSMutableArray* batch = [NSMutableArray array];
+  for (int32_t i = 0; i < 200; i++) {
+    TestAllTypes* message = [[[TestAllTypes builder] setOptionalInt32:i] build];
+    if (i % 2 == 0) {
+      [writer writeMessage:message completion:completion];
+      [expected appendData:message.data];
+    } else {
+      [batch addObject:message];
+      if (batch.count == 5) {
+        [writer writeDelimitedMessages:batch completion:completion];
+        for (TestAllTypes* delimited in batch) {
+          NSMutableData* size = [NSMutableData dataWithLength:computeRawVarint32Size(delimited.serializedSize)];
+          [[PBCodedOutputStream streamWithData:size] writeRawVarint32:delimited.serializedSize];
+          [expected appendData:size];
+          [expected appendData:delimited.data];
+        }
+        [batch removeAllObjects];
+      }
+    }
+  }
+  [writer waitUntilDone];
+  [self closeChannel:channel];
+
+  STAssertTrue(failures == 0, @"");
+  STAssertEqualObjects(expected, [NSData dataWithContentsOfFile:self.path], @"");
+  [[NSFileManager defaultManager] removeItemAtPath:self.path error:NULL];
+}
+
+
+/** Tests that writes to a random-access channel follow each other. */
+- (void) testWritesFollowEachOtherOnRandomChannel {
+  dispatch_io_t channel = [self openChannelOfType:DISPATCH_IO_RANDOM];
+  PBChannelWriter* writer =
+  [PBChannelWriter writerWithChannel:channel
+                              offset:3
+                               queue:dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0)
+                    maxPendingWrites:4];
+
+  NSMutableData* expected = [NSMutableData dataWithLength:3];
+  for (int32_t i = 0; i < 20; i++) {
+    TestAllTypes* message = [[[TestAllTypes builder] setOptionalInt32:i] build];
+    [writer writeMessage:message completion:nil];
+    [expected appendData:message.data];
+  }
+  [writer waitUntilDone];
+  [self closeChannel:channel];
+
+  STAssertEqualObjects(expected, [NSData dataWithContentsOfFile:self.path], @"");
+  [[NSFileManager defaultManager] removeItemAtPath:self.path error:NULL];
+}
+
+@end
@@ -17,6 +17,10 @@
 
 #import "CodedInputStreamTests.h"
 
+#import <fcntl.h>
+#import <unistd.h>
+
+#import "ReadAheadBuffer.h"
 #import "SmallBlockInputStream.h"
 #import "TestUtilities.h"
 #import "Unittest.pb.h"
@@ -219,13 +223,13 @@
   NSData* rawBytes = message.data;
   STAssertTrue(rawBytes.length == message.serializedSize, @"");
 
-  TestAllTypes* message2 = [TestAllTypes parseFromData:rawBytes];
+  TestAllTypes* message2 = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromData:rawBytes] build];
   [TestUtilities assertAllFieldsSet:message2];
 
   // Try different block sizes.
   for (int32_t blockSize = 1; blockSize < 256; blockSize *= 2) {
-    message2 = [TestAllTypes parseFromInputStream:
-                [SmallBlockInputStream streamWithData:rawBytes blockSize:blockSize]];
+    message2 = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromInputStream:
+                [SmallBlockInputStream streamWithData:rawBytes blockSize:blockSize]] build];
     [TestUtilities assertAllFieldsSet:message2];
   }
 }
@@ -254,6 +258,255 @@
 }
 
 
+/** Tests skipRawData: over fields larger than the buffer. */
+- (void) testSkipLargeField {
+  NSData* blob = [NSMutableData dataWithLength:100000];
+  NSMutableData* fields = [NSMutableData dataWithLength:computeDataSizeNoTag(blob) + 1];
+  PBCodedOutputStream* output = [PBCodedOutputStream streamWithData:fields];
+  [output writeDataNoTag:blob];
+  [output writeRawByte:42];
+
+  // Skipped by seeking.
+  NSString* path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"CodedInputStreamTests.skip"];
+  STAssertTrue([fields writeToFile:path atomically:NO], @"");
+  PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:[NSInputStream inputStreamWithFileAtPath:path]];
+  [input skipRawData:[input readRawVarint32]];
+  STAssertTrue(42 == [input readRawByte], @"");
+  STAssertTrue([input isAtEnd], @"");
+
+  // Skipped by reading, since the stream can't seek.
+  input = [PBCodedInputStream streamWithInputStream:[SmallBlockInputStream streamWithData:fields blockSize:1000]];
+  [input skipRawData:[input readRawVarint32]];
+  STAssertTrue(42 == [input readRawByte], @"");
+  STAssertTrue([input isAtEnd], @"");
+
+  // Seeking past the end of the file is still truncation.
+  STAssertTrue([[fields subdataWithRange:NSMakeRange(0, 50000)] writeToFile:path atomically:NO], @"");
+  input = [PBCodedInputStream streamWithInputStream:[NSInputStream inputStreamWithFileAtPath:path]];
+  STAssertThrows([input skipRawData:[input readRawVarint32]], @"");
+  [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+}
+
+
+#ifdef PB_STREAM_STATISTICS
+/** Tests the counters kept when built with PB_STREAM_STATISTICS. */
+- (void) testStatistics {
+  TestAllTypes* message = [TestUtilities allSet];
+  NSData* rawBytes = message.data;
+
+  // Read as unknown fields, 16 bytes per refill.
+  PBCodedInputStream* input =
+    [PBCodedInputStream streamWithInputStream:[SmallBlockInputStream streamWithData:rawBytes blockSize:16]];
+  [[PBUnknownFieldSet builder] mergeFromCodedInputStream:input];
+  PBCodedInputStreamStatistics statistics = input.statistics;
+  STAssertTrue(statistics.bytesConsumed == rawBytes.length, @"");
+  STAssertTrue(statistics.refillCalls > rawBytes.length / 16, @"");
+  STAssertTrue(statistics.unknownFields > 0, @"");
+  STAssertTrue(statistics.dataCount > 0, @"");
+  STAssertTrue(statistics.stringCount == 0, @"");
+  STAssertTrue(statistics.maxLimitDepth == 0, @"");
+
+  // Parsed, so strings are decoded and nested messages push limits.
+  input = [PBCodedInputStream streamWithData:rawBytes];
+  [[TestAllTypes builder] mergeFromCodedInputStream:input];
+  statistics = input.statistics;
+  STAssertTrue(statistics.bytesConsumed == rawBytes.length, @"");
+  STAssertTrue(statistics.unknownFields == 0, @"");
+  STAssertTrue(statistics.stringCount > 0, @"");
+  STAssertTrue(statistics.stringBytes >= statistics.stringCount, @"");
+  STAssertTrue(statistics.maxLimitDepth == 1, @"");
+  STAssertTrue(statistics.skippedBytes == 0, @"");
+
+  input = [PBCodedInputStream streamWithData:rawBytes];
+  [input skipMessage];
+  statistics = input.statistics;
+  STAssertTrue(statistics.bytesConsumed == rawBytes.length, @"");
+  STAssertTrue(statistics.skippedBytes > 0, @"");
+  STAssertTrue(statistics.dataCount == 0, @"");
+}
+#endif
+
+
+- (PBCodedInputStream*) streamWithContentsOfFile:(NSString*) path
+                                       bufferSize:(int32_t) bufferSize
+                                        readAhead:(BOOL) readAhead
+                                   fileDescriptor:(int*) fileDescriptor {
+  *fileDescriptor = open([path fileSystemRepresentation], O_RDONLY);
+  STAssertTrue(*fileDescriptor >= 0, @"");
+  return [PBCodedInputStream streamWithFileDescriptor:*fileDescriptor bufferSize:bufferSize readAhead:readAhead];
+}
+
+
+/** Tests reading from a file descriptor, with and without read-ahead. */
+- (void) testReadFromFileDescriptor {
+  NSMutableData* blob = [NSMutableData dataWithLength:100000];
+  for (int32_t i = 0; i < blob.length; i++) {
+    ((uint8_t*)blob.mutableBytes)[i] = (uint8_t)i;
+  }
+  TestAllTypes_Builder* builder = [TestAllTypes builder];
+  [TestUtilities setAllFields:builder];
+  [builder setOptionalBytes:blob];
+  TestAllTypes* message = [builder build];
+  NSData* data = message.data;
+
+  NSString* path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"CodedInputStreamTests.fd"];
+  STAssertTrue([data writeToFile:path atomically:NO], @"");
+
+  for (int32_t bufferSize = 16; bufferSize <= 1 << 20; bufferSize *= 16) {
+    for (int32_t readAhead = 0; readAhead < 2; readAhead++) {
+      int fileDescriptor;
+      @autoreleasepool {
+        PBCodedInputStream* input = [self streamWithContentsOfFile:path
+                                                        bufferSize:bufferSize
+                                                         readAhead:readAhead
+                                                    fileDescriptor:&fileDescriptor];
+        STAssertEqualObjects(message, [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromCodedInputStream:input] build], @"");
+      }
+      close(fileDescriptor);
+
+      // Skip every field, by seeking or by reading, then check that
+      // nothing was left over.
+      @autoreleasepool {
+        PBCodedInputStream* input = [self streamWithContentsOfFile:path
+                                                        bufferSize:bufferSize
+                                                         readAhead:readAhead
+                                                    fileDescriptor:&fileDescriptor];
+        [input skipMessage];
+        STAssertTrue([input isAtEnd], @"");
+      }
+      close(fileDescriptor);
+    }
+  }
+
+  // A file cut short is still truncated, whether skipped by seeking or not.
+  STAssertTrue([[data subdataWithRange:NSMakeRange(0, data.length - 1)] writeToFile:path atomically:NO], @"");
+  for (int32_t readAhead = 0; readAhead < 2; readAhead++) {
+    int fileDescriptor;
+    @autoreleasepool {
+      PBCodedInputStream* input = [self streamWithContentsOfFile:path
+                                                      bufferSize:4096
+                                                       readAhead:readAhead
+                                                  fileDescriptor:&fileDescriptor];
+      STAssertThrows([input skipMessage], @"");
+    }
+    close(fileDescriptor);
+  }
+  [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+}
+
+
+/**
+ * Tests that closing a read-ahead buffer waits for the read(2) its thread
+ * is blocked in, and that nothing is read from the descriptor afterwards.
+ */
+- (void) testReadAheadCloseWaitsForRead {
+  int pipeDescriptors[2];
+  STAssertTrue(pipe(pipeDescriptors) == 0, @"");
+  STAssertTrue(write(pipeDescriptors[1], "a", 1) == 1, @"");
+
+  ReadAheadBuffer* reader = [[ReadAheadBuffer alloc] initWithFileDescriptor:pipeDescriptors[0]
+                                                                 bufferSize:16
+                                                                  readAhead:YES];
+  int32_t length;
+  NSMutableData* buffer = [reader exchangeBuffer:[NSMutableData dataWithLength:16] length:&length];
+  STAssertTrue(length == 1 && ((uint8_t*)buffer.bytes)[0] == 'a', @"");
+  // Give the thread time to block reading the next buffer from the empty pipe.
+  usleep(100000);
+
+  dispatch_semaphore_t closed = dispatch_semaphore_create(0);
+  dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    [reader close];
+    dispatch_semaphore_signal(closed);
+  });
+  STAssertTrue(dispatch_semaphore_wait(closed, dispatch_time(DISPATCH_TIME_NOW, 100 * NSEC_PER_MSEC)) != 0,
+               @"close returned while a read was in progress");
+
+  // Ends the blocked read, after which close returns.
+  STAssertTrue(write(pipeDescriptors[1], "b", 1) == 1, @"");
+  dispatch_semaphore_wait(closed, DISPATCH_TIME_FOREVER);
+
+  STAssertTrue(write(pipeDescriptors[1], "c", 1) == 1, @"");
+  uint8_t next = 0;
+  STAssertTrue(read(pipeDescriptors[0], &next, 1) == 1 && next == 'c', @"");
+  close(pipeDescriptors[0]);
+  close(pipeDescriptors[1]);
+}
+
+
+- (NSString*) readStringFrom:(NSData*) data blockSize:(int32_t) blockSize {
+  int32_t length = (int32_t)data.length;
+  NSMutableData* field = [NSMutableData dataWithLength:computeRawVarint32Size(length) + length];
+  PBCodedOutputStream* output = [PBCodedOutputStream streamWithData:field];
+  [output writeRawVarint32:length];
+  [output writeRawData:data];
+
+  PBCodedInputStream* input;
+  if (blockSize == 0) {
+    input = [PBCodedInputStream streamWithData:field];
+  } else {
+    input = [PBCodedInputStream streamWithInputStream:
+             [SmallBlockInputStream streamWithData:field blockSize:blockSize]];
+  }
+  return [input readString];
+}
+
+
+- (void) testReadString {
+  NSArray* strings = [NSArray arrayWithObjects:
+                      @"",
+                      @"ascii only",
+                      @"caf\u00e9 na\u00efve \u20ac \U0001F600",
+                      [@"" stringByPaddingToLength:5000 withString:@"long ascii " startingAtIndex:0],
+                      [@"" stringByPaddingToLength:5000 withString:@"\u00fcber " startingAtIndex:0],
+                      nil];
+  for (NSString* string in strings) {
+    NSData* data = [string dataUsingEncoding:NSUTF8StringEncoding];
+    for (int32_t blockSize = 0; blockSize <= 64; blockSize = (blockSize == 0 ? 1 : blockSize * 4)) {
+      STAssertEqualObjects(string, [self readStringFrom:data blockSize:blockSize], @"");
+    }
+  }
+
+  // Malformed UTF-8 decodes to nil, as it did through NSString.
+  STAssertNil([self readStringFrom:bytes(0x61, 0xc0, 0xaf) blockSize:0], @"");
+  STAssertNil([self readStringFrom:bytes(0xed, 0xa0, 0x80) blockSize:1], @"");
+}
+
+
+- (void) testReadDataWithBufferSize {
+  // Fields shorter than, equal to and longer than the buffer, read in
+  // blocks smaller and larger than it, so that every copy path is used.
+  for (int32_t length = 0; length <= 200; length += 7) {
+    NSMutableData* blob = [NSMutableData dataWithLength:length];
+    for (int32_t i = 0; i < length; i++) {
+      ((uint8_t*)blob.mutableBytes)[i] = (uint8_t)(i * 31);
+    }
+    NSString* string = [@"" stringByPaddingToLength:length withString:@"\u00e9t\u00e9 " startingAtIndex:0];
+
+    NSMutableData* fields = [NSMutableData dataWithLength:
+                             computeDataSizeNoTag(blob) + computeStringSizeNoTag(string) + 1];
+    PBCodedOutputStream* output = [PBCodedOutputStream streamWithData:fields];
+    [output writeDataNoTag:blob];
+    [output writeStringNoTag:string];
+    [output writeRawByte:42];
+
+    for (int32_t bufferSize = 1; bufferSize <= 256; bufferSize *= 4) {
+      for (int32_t blockSize = 1; blockSize <= 256; blockSize *= 8) {
+        PBCodedInputStream* input =
+        [PBCodedInputStream streamWithInputStream:[SmallBlockInputStream streamWithData:fields blockSize:blockSize]
+                                       bufferSize:bufferSize];
+        STAssertEqualObjects(blob, [input readData], @"");
+        STAssertEqualObjects(string, [input readString], @"");
+        STAssertTrue(42 == [input readRawByte], @"");
+        STAssertTrue([input isAtEnd], @"");
+      }
+    }
+  }
+
+  STAssertThrows([PBCodedInputStream streamWithInputStream:[NSInputStream inputStreamWithData:[NSData data]]
+                                                bufferSize:0], @"");
+}
+
+
 - (void) testReadHugeBlob {
   // Allocate and initialize a 1MB blob.
   NSMutableData* blob = [NSMutableData dataWithLength:1 << 20];
@@ -271,7 +524,7 @@
   // directly from a ByteString, so that CodedInputStream uses buffered
   // reading.
   TestAllTypes* message2 =
-  [TestAllTypes parseFromInputStream:[NSInputStream inputStreamWithData:message.data]];
+  [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromInputStream:[NSInputStream inputStreamWithData:message.data]] build];
 
   STAssertEqualObjects(message.optionalBytes, message2.optionalBytes, @"");
 
@@ -302,4 +555,67 @@
   STAssertThrows([input readData], @"");
 }
 
+- (void) testReadMaliciouslyLargeBlobFromStream {
+  // The claimed size is checked against the size limit before anything is
+  // allocated for it.
+  int32_t tag = PBWireFormatMakeTag(1, PBWireFormatLengthDelimited);
+  NSMutableData* data = [NSMutableData dataWithLength:computeRawVarint32Size(tag) + computeRawVarint32Size(0x7FFFFFFF) + 32];
+  PBCodedOutputStream* output = [PBCodedOutputStream streamWithData:data];
+  [output writeRawVarint32:tag];
+  [output writeRawVarint32:0x7FFFFFFF];
+
+  PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:[NSInputStream inputStreamWithData:data]];
+  STAssertTrue(tag == [input readTag], @"");
+  STAssertThrows([input readData], @"");
+}
+
+- (void) testChecksummedRecords {
+  TestAllTypes* small = [TestUtilities allSet];
+  TestAllTypes* large = [[[TestAllTypes builderWithPrototype:small]
+                          setOptionalBytes:[NSMutableData dataWithLength:20000]] build];
+  NSArray* messages = [NSArray arrayWithObjects:small, large, small, [TestAllTypes defaultInstance], large, nil];
+
+  for (int32_t bufferSize = 16; bufferSize <= 1 << 16; bufferSize *= 32) {
+    NSOutputStream* rawOutput = [NSOutputStream outputStreamToMemory];
+    [rawOutput open];
+    PBCodedOutputStream* output = [PBCodedOutputStream streamWithOutputStream:rawOutput bufferSize:bufferSize];
+    for (TestAllTypes* message in messages) {
+      [output writeRecord:message checksum:YES];
+    }
+    [output flush];
+    NSData* data = [rawOutput propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+
+    for (int32_t blockSize = 1; blockSize <= 1 << 16; blockSize *= 64) {
+      // Parsed, and skipped as unknown fields of an empty message.
+      PBCodedInputStream* input =
+      [PBCodedInputStream streamWithInputStream:[SmallBlockInputStream streamWithData:data blockSize:blockSize]
+                                     bufferSize:bufferSize];
+      PBCodedInputStream* skipInput =
+      [PBCodedInputStream streamWithInputStream:[SmallBlockInputStream streamWithData:data blockSize:blockSize]
+                                     bufferSize:bufferSize];
+      for (TestAllTypes* message in messages) {
+        TestAllTypes_Builder* builder = [TestAllTypes builder];
+        STAssertTrue([input readRecord:builder extensionRegistry:[PBExtensionRegistry emptyRegistry] checksum:YES], @"");
+        STAssertEqualObjects(message, [builder build], @"");
+        STAssertTrue([skipInput readRecord:[TestEmptyMessage builder]
+                         extensionRegistry:[PBExtensionRegistry emptyRegistry]
+                                  checksum:YES], @"");
+      }
+      STAssertFalse([input readRecord:[TestAllTypes builder] extensionRegistry:[PBExtensionRegistry emptyRegistry] checksum:YES], @"");
+      STAssertFalse([skipInput readRecord:[TestEmptyMessage builder] extensionRegistry:[PBExtensionRegistry emptyRegistry] checksum:YES], @"");
+    }
+
+    // A flipped bit inside a bytes field still parses, but fails the check.
+    // The middle of the last record is in its 20000 byte field.
+    NSMutableData* corrupt = [NSMutableData dataWithData:data];
+    ((uint8_t*)corrupt.mutableBytes)[data.length - large.serializedSize / 2] ^= 0x10;
+    PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:[NSInputStream inputStreamWithData:corrupt]
+                                                               bufferSize:bufferSize];
+    for (NSUInteger i = 0; i < messages.count - 1; i++) {
+      [input readRecord:[TestAllTypes builder] extensionRegistry:[PBExtensionRegistry emptyRegistry] checksum:YES];
+    }
+    STAssertThrows([input readRecord:[TestAllTypes builder] extensionRegistry:[PBExtensionRegistry emptyRegistry] checksum:YES], @"");
+  }
+}
+
 @end
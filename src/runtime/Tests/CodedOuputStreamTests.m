@@ -17,8 +17,13 @@
 
 #import "CodedOuputStreamTests.h"
 
+#import <fcntl.h>
+#import <unistd.h>
+
+#import "SmallBlockOutputStream.h"
 #import "TestUtilities.h"
 #import "Unittest.pb.h"
+#import "WriteBehindBuffer.h"
 
 @implementation CodedOutputStreamTests
 
@@ -295,4 +300,129 @@
   }
 }
 
+
+
+/** Tests flushing to an output stream that accepts only part of each write. */
+- (void) testWriteToShortWritingStream {
+  TestAllTypes* message = [TestUtilities allSet];
+  NSData* rawBytes = message.data;
+
+  for (int blockSize = 1; blockSize < 256; blockSize *= 3) {
+    for (int bufferSize = 1; bufferSize < 256; bufferSize *= 4) {
+      SmallBlockOutputStream* rawOutput = [SmallBlockOutputStream streamWithBlockSize:blockSize];
+      [rawOutput open];
+      PBCodedOutputStream* output = [PBCodedOutputStream streamWithOutputStream:rawOutput bufferSize:bufferSize];
+      [message writeToCodedOutputStream:output];
+      [output flush];
+
+      NSData* actual = [rawOutput propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+      STAssertEqualObjects(rawBytes, actual, @"");
+    }
+  }
+}
+
+
+#ifdef PB_STREAM_STATISTICS
+/** Tests the counters kept when built with PB_STREAM_STATISTICS. */
+- (void) testStatistics {
+  TestAllTypes* message = [TestUtilities allSet];
+  NSOutputStream* rawOutput = [self openMemoryStream];
+  PBCodedOutputStream* output = [PBCodedOutputStream streamWithOutputStream:rawOutput bufferSize:64];
+  [message writeToCodedOutputStream:output];
+
+  PBCodedOutputStreamStatistics statistics = output.statistics;
+  STAssertTrue(statistics.bytesProduced == message.serializedSize, @"");
+  STAssertTrue(statistics.flushCalls == 0, @"");
+  STAssertTrue(statistics.bufferFlushes > 0, @"");
+  STAssertTrue(statistics.stringCount > 0, @"");
+  STAssertTrue(statistics.dataCount > 0, @"");
+
+  [output flush];
+  statistics = output.statistics;
+  STAssertTrue(statistics.bytesProduced == message.serializedSize, @"");
+  STAssertTrue(statistics.flushCalls == 1, @"");
+}
+#endif
+
+
+/** Tests writing to a file descriptor, with and without write-behind. */
+- (void) testWriteToFileDescriptor {
+  TestAllTypes* message = [TestUtilities allSet];
+  NSMutableData* expected = [NSMutableData data];
+  for (int i = 0; i < 100; i++) {
+    [expected appendData:message.data];
+  }
+
+  NSString* path = [NSTemporaryDirectory() stringByAppendingPathComponent:@"CodedOutputStreamTests.fd"];
+  for (int bufferSize = 1; bufferSize <= 1 << 16; bufferSize *= 16) {
+    for (int writeBehind = 0; writeBehind < 2; writeBehind++) {
+      int fileDescriptor = open([path fileSystemRepresentation], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      STAssertTrue(fileDescriptor >= 0, @"");
+      @autoreleasepool {
+        PBCodedOutputStream* output = [PBCodedOutputStream streamWithFileDescriptor:fileDescriptor
+                                                                         bufferSize:bufferSize
+                                                                        writeBehind:writeBehind];
+        for (int i = 0; i < 100; i++) {
+          [message writeToCodedOutputStream:output];
+        }
+        [output flush];
+      }
+      close(fileDescriptor);
+
+      STAssertEqualObjects(expected, [NSData dataWithContentsOfFile:path], @"");
+    }
+  }
+
+  // Errors are raised, from the write-behind thread too.
+  for (int writeBehind = 0; writeBehind < 2; writeBehind++) {
+    int fileDescriptor = open([path fileSystemRepresentation], O_RDONLY);
+    @autoreleasepool {
+      PBCodedOutputStream* output = [PBCodedOutputStream streamWithFileDescriptor:fileDescriptor
+                                                                       bufferSize:1 << 16
+                                                                      writeBehind:writeBehind];
+      [message writeToCodedOutputStream:output];
+      STAssertThrows([output flush], @"");
+    }
+    close(fileDescriptor);
+  }
+  [[NSFileManager defaultManager] removeItemAtPath:path error:NULL];
+}
+
+
+/**
+ * Tests that closing a write-behind buffer waits for the write its thread
+ * is blocked in, so every byte is written before close returns.
+ */
+- (void) testWriteBehindCloseWaitsForWrite {
+  int pipeDescriptors[2];
+  STAssertTrue(pipe(pipeDescriptors) == 0, @"");
+
+  // More than a pipe holds, so the write blocks until the bytes are read.
+  NSMutableData* data = [NSMutableData dataWithLength:1 << 20];
+  memset(data.mutableBytes, 'x', data.length);
+  WriteBehindBuffer* writer = [[WriteBehindBuffer alloc] initWithFileDescriptor:pipeDescriptors[1]
+                                                                    bufferSize:(int32_t)data.length
+                                                                   writeBehind:YES];
+  [writer writeData:data range:NSMakeRange(0, data.length)];
+
+  dispatch_semaphore_t closed = dispatch_semaphore_create(0);
+  dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+    [writer close];
+    dispatch_semaphore_signal(closed);
+  });
+  STAssertTrue(dispatch_semaphore_wait(closed, dispatch_time(DISPATCH_TIME_NOW, 100 * NSEC_PER_MSEC)) != 0,
+               @"close returned while a write was in progress");
+
+  NSUInteger total = 0;
+  uint8_t bytes[4096];
+  while (total < data.length) {
+    ssize_t n = read(pipeDescriptors[0], bytes, sizeof(bytes));
+    STAssertTrue(n > 0, @"");
+    total += n;
+  }
+  dispatch_semaphore_wait(closed, DISPATCH_TIME_FOREVER);
+  close(pipeDescriptors[0]);
+  close(pipeDescriptors[1]);
+}
+
 @end
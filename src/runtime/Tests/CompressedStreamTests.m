@@ -0,0 +1,119 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import "CompressedStreamTests.h"
+
+#import "DeflateOutputStream.h"
+#import "InflateInputStream.h"
+#import "SmallBlockInputStream.h"
+#import "TestUtilities.h"
+#import "Unittest.pb.h"
+
+@implementation CompressedStreamTests
+
+static const int32_t kMessageCount = 100;
+
+- (NSData*) compressMessage:(TestAllTypes*) message level:(int) level blockSize:(int32_t) blockSize {
+  NSOutputStream* rawOutput = [NSOutputStream outputStreamToMemory];
+  PBDeflateOutputStream* deflateOutput = [PBDeflateOutputStream streamWithOutputStream:rawOutput
+                                                                                level:level
+                                                                            blockSize:blockSize];
+  [deflateOutput open];
+  PBCodedOutputStream* output = [PBCodedOutputStream streamWithOutputStream:deflateOutput];
+  for (int32_t i = 0; i < kMessageCount; i++) {
+    [output writeMessageNoTag:message];
+  }
+  [output flush];
+  [deflateOutput close];
+  return [rawOutput propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+}
+
+
+- (void) readMessages:(PBCodedInputStream*) input expected:(TestAllTypes*) message {
+  for (int32_t i = 0; i < kMessageCount; i++) {
+    TestAllTypes_Builder* builder = [TestAllTypes builder];
+    [input readMessage:builder extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+    STAssertEqualObjects(message, [builder build], @"");
+  }
+}
+
+
+- (void) testRoundTrip {
+  TestAllTypes* message = [TestUtilities allSet];
+  NSInteger uncompressedLength = kMessageCount * (computeRawVarint32Size(message.serializedSize) + message.serializedSize);
+
+  int levels[] = { 0, 1, Z_DEFAULT_COMPRESSION, 9 };
+  for (int i = 0; i < 4; i++) {
+    for (int32_t blockSize = 1; blockSize <= 1 << 16; blockSize *= 16) {
+      NSData* compressed = [self compressMessage:message level:levels[i] blockSize:blockSize];
+      if (levels[i] != 0) {
+        STAssertTrue(compressed.length < uncompressedLength / 4, @"");
+      }
+
+      for (int32_t readBlockSize = 1; readBlockSize <= 1 << 16; readBlockSize *= 64) {
+        PBInflateInputStream* inflateInput =
+        [PBInflateInputStream streamWithInputStream:[SmallBlockInputStream streamWithData:compressed blockSize:17]
+                                          blockSize:readBlockSize];
+        PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:inflateInput];
+        [self readMessages:input expected:message];
+        STAssertTrue([input isAtEnd], @"");
+      }
+    }
+  }
+}
+
+
+- (void) testFlushCompressed {
+  // Everything written before a flush can be decoded without closing.
+  TestAllTypes* message = [TestUtilities allSet];
+  NSOutputStream* rawOutput = [NSOutputStream outputStreamToMemory];
+  PBDeflateOutputStream* deflateOutput = [PBDeflateOutputStream streamWithOutputStream:rawOutput
+                                                                                level:Z_DEFAULT_COMPRESSION
+                                                                            blockSize:4096];
+  [deflateOutput open];
+  PBCodedOutputStream* output = [PBCodedOutputStream streamWithOutputStream:deflateOutput];
+  [output writeMessageNoTag:message];
+  [output flush];
+  STAssertTrue([deflateOutput flushCompressed], @"");
+
+  NSData* compressed = [rawOutput propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+  PBInflateInputStream* inflateInput =
+  [PBInflateInputStream streamWithInputStream:[NSInputStream inputStreamWithData:compressed] blockSize:4096];
+  PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:inflateInput];
+  TestAllTypes_Builder* builder = [TestAllTypes builder];
+  [input readMessage:builder extensionRegistry:[PBExtensionRegistry emptyRegistry]];
+  STAssertEqualObjects(message, [builder build], @"");
+}
+
+
+- (void) testCorruptOrTruncatedInput {
+  TestAllTypes* message = [TestUtilities allSet];
+  NSData* compressed = [self compressMessage:message level:Z_DEFAULT_COMPRESSION blockSize:4096];
+
+  NSData* truncated = [compressed subdataWithRange:NSMakeRange(0, compressed.length / 2)];
+  NSMutableData* corrupt = [NSMutableData dataWithData:compressed];
+  ((uint8_t*)corrupt.mutableBytes)[corrupt.length / 2] ^= 0xff;
+
+  for (NSData* data in [NSArray arrayWithObjects:truncated, corrupt, nil]) {
+    PBInflateInputStream* inflateInput =
+    [PBInflateInputStream streamWithInputStream:[NSInputStream inputStreamWithData:data] blockSize:4096];
+    PBCodedInputStream* input = [PBCodedInputStream streamWithInputStream:inflateInput];
+    STAssertThrows([self readMessages:input expected:message], @"");
+  }
+}
+
+@end
@@ -19,6 +19,7 @@
 
 #import "TestUtilities.h"
 #import "Unittest.pb.h"
+#import "UnittestOptimizeFor.pb.h"
 
 @implementation GeneratedMessageTests
 
@@ -104,4 +105,363 @@
   [TestUtilities assertExtensionsClear:[[TestAllExtensions builder] build]];
 }
 
+
+- (void) testFieldTableMethods {
+  // unittest_optimize_for.proto is optimize_for = CODE_SIZE, so these
+  // messages describe, compare and hash themselves through a PBFieldTable.
+  ForeignMessage* foreignMessage = [[[ForeignMessage builder] setC:7] build];
+  TestOptimizedForSize* message1 = [self optimizedForSizeWithMessage:foreignMessage];
+  TestOptimizedForSize* message2 = [self optimizedForSizeWithMessage:foreignMessage];
+  TestOptimizedForSize* message3 = [[[TestOptimizedForSize builder] setI:3] build];
+
+  STAssertEqualObjects(message1, message2, @"");
+  STAssertTrue(message1.hash == message2.hash, @"");
+  STAssertFalse([message1 isEqual:message3], @"");
+  STAssertFalse([message1 isEqual:foreignMessage], @"");
+  STAssertFalse([message3 isEqual:[TestOptimizedForSize defaultInstance]], @"");
+  STAssertEqualObjects([TestOptimizedForSize defaultInstance], [[TestOptimizedForSize builder] build], @"");
+
+  // Each repeated field and the extension range is compared on its own.
+  TestOptimizedForSize_Builder* builder = [message1 toBuilder];
+  [builder addRepeatedI:0];
+  STAssertFalse([message1 isEqual:[builder build]], @"");
+  builder = [message1 toBuilder];
+  [builder setRepeatedMsgArray:[NSArray arrayWithObject:foreignMessage]];
+  STAssertFalse([message1 isEqual:[builder build]], @"");
+  builder = [message1 toBuilder];
+  [builder setExtension:[TestOptimizedForSize testExtension] value:[NSNumber numberWithInt:6]];
+  TestOptimizedForSize* message4 = [builder build];
+  STAssertFalse([message1 isEqual:message4], @"");
+  STAssertFalse(message1.hash == message4.hash, @"");
+
+  STAssertEqualObjects(message1.description,
+                       @"i: 3\n"
+                       @"repeatedI: 1\n"
+                       @"repeatedI: 5000000000\n"
+                       @"msg {\n  c: 7\n}\n"
+                       @"repeatedMsg {\n  c: 1\n}\n"
+                       @"repeatedMsg {\n  c: 2\n}\n"
+                       @"5\n", @"");
+  STAssertEqualObjects([TestOptimizedForSize defaultInstance].description, @"", @"");
+}
+
+
+- (TestOptimizedForSize*) optimizedForSizeWithMessage:(ForeignMessage*) foreignMessage {
+  TestOptimizedForSize_Builder* builder = [[[TestOptimizedForSize builder] setI:3] setMsg:foreignMessage];
+  [builder addRepeatedI:1];
+  [builder addRepeatedI:5000000000LL];
+  [builder addRepeatedMsg:[[[ForeignMessage builder] setC:1] build]];
+  [builder addRepeatedMsg:[[[ForeignMessage builder] setC:2] build]];
+  [builder setExtension:[TestOptimizedForSize testExtension] value:[NSNumber numberWithInt:5]];
+  return [builder build];
+}
+
+
+- (void) testEnumValidity {
+  // ForeignEnum is a range of values, TestSemiDenseEnum a bitmap and
+  // TestSparseEnum a sorted array.
+  STAssertTrue(ForeignEnumIsValidValue(ForeignEnumForeignFoo), @"");
+  STAssertTrue(ForeignEnumIsValidValue(ForeignEnumForeignBaz), @"");
+  STAssertFalse(ForeignEnumIsValidValue((ForeignEnum)3), @"");
+  STAssertFalse(ForeignEnumIsValidValue((ForeignEnum)7), @"");
+  STAssertFalse(ForeignEnumIsValidValue((ForeignEnum)-1), @"");
+
+  STAssertTrue(TestSparseEnumIsValidValue(TestSparseEnumSparseA), @"");
+  STAssertTrue(TestSparseEnumIsValidValue(TestSparseEnumSparseE), @"");
+  STAssertTrue(TestSparseEnumIsValidValue(TestSparseEnumSparseC), @"");
+  STAssertFalse(TestSparseEnumIsValidValue((TestSparseEnum)1), @"");
+  STAssertFalse(TestSparseEnumIsValidValue((TestSparseEnum)-53453), @"");
+  STAssertFalse(TestSparseEnumIsValidValue((TestSparseEnum)12589235), @"");
+
+  STAssertTrue(TestSemiDenseEnumIsValidValue(TestSemiDenseEnumSemiDenseA), @"");
+  STAssertTrue(TestSemiDenseEnumIsValidValue(TestSemiDenseEnumSemiDenseB), @"");
+  STAssertTrue(TestSemiDenseEnumIsValidValue(TestSemiDenseEnumSemiDenseC), @"");
+  STAssertTrue(TestSemiDenseEnumIsValidValue(TestSemiDenseEnumSemiDenseD), @"");
+  STAssertTrue(TestSemiDenseEnumIsValidValue(TestSemiDenseEnumSemiDenseE), @"");
+  STAssertFalse(TestSemiDenseEnumIsValidValue((TestSemiDenseEnum)-4), @"");
+  STAssertFalse(TestSemiDenseEnumIsValidValue((TestSemiDenseEnum)0), @"");
+  STAssertFalse(TestSemiDenseEnumIsValidValue((TestSemiDenseEnum)3), @"");
+  STAssertFalse(TestSemiDenseEnumIsValidValue((TestSemiDenseEnum)41), @"");
+  STAssertFalse(TestSemiDenseEnumIsValidValue((TestSemiDenseEnum)71), @"");
+}
+
+
+- (void) testEnumStringRepresentation {
+  ForeignEnum foreign;
+  STAssertTrue(strcmp(ForeignEnumStringRepresentation(ForeignEnumForeignBar), "foreignBar") == 0, @"");
+  STAssertTrue(ForeignEnumFromStringRepresentation("foreignBar", &foreign), @"");
+  STAssertEquals(foreign, ForeignEnumForeignBar, @"");
+  STAssertTrue(ForeignEnumStringRepresentation((ForeignEnum)3) == NULL, @"");
+  STAssertFalse(ForeignEnumFromStringRepresentation("foreignQux", &foreign), @"");
+
+  TestSemiDenseEnum semiDenseValue;
+  const TestSemiDenseEnum semiDense[] = {
+    TestSemiDenseEnumSemiDenseA, TestSemiDenseEnumSemiDenseB, TestSemiDenseEnumSemiDenseC,
+    TestSemiDenseEnumSemiDenseD, TestSemiDenseEnumSemiDenseE,
+  };
+  for (size_t i = 0; i < sizeof(semiDense) / sizeof(semiDense[0]); ++i) {
+    TestSemiDenseEnum value;
+    STAssertTrue(TestSemiDenseEnumFromStringRepresentation(TestSemiDenseEnumStringRepresentation(semiDense[i]), &value), @"");
+    STAssertEquals(value, semiDense[i], @"");
+  }
+  STAssertTrue(strcmp(TestSemiDenseEnumStringRepresentation(TestSemiDenseEnumSemiDenseD), "semiDenseD") == 0, @"");
+  STAssertTrue(TestSemiDenseEnumStringRepresentation((TestSemiDenseEnum)41) == NULL, @"");
+  STAssertFalse(TestSemiDenseEnumFromStringRepresentation("semiDenseF", &semiDenseValue), @"");
+
+  TestSparseEnum sparseValue;
+  const TestSparseEnum sparse[] = {
+    TestSparseEnumSparseA, TestSparseEnumSparseB, TestSparseEnumSparseC, TestSparseEnumSparseD,
+    TestSparseEnumSparseE, TestSparseEnumSparseF, TestSparseEnumSparseG,
+  };
+  for (size_t i = 0; i < sizeof(sparse) / sizeof(sparse[0]); ++i) {
+    TestSparseEnum value;
+    STAssertTrue(TestSparseEnumFromStringRepresentation(TestSparseEnumStringRepresentation(sparse[i]), &value), @"");
+    STAssertEquals(value, sparse[i], @"");
+  }
+  STAssertTrue(TestSparseEnumStringRepresentation((TestSparseEnum)1) == NULL, @"");
+  STAssertFalse(TestSparseEnumFromStringRepresentation("sparseH", &sparseValue), @"");
+}
+
+
+- (void) testEnumNameTable {
+  // Seeds and slots as the generator builds them for these names.
+  static const char* const names[] = { "foreignFoo", "foreignBar", "foreignBaz" };
+  static const uint32_t seeds[] = { 5U };
+  static const int32_t slots[] = { 0, 2, 1 };
+  const PBEnumNameTable hashed = { names, 3, seeds, 1, slots, 3 };
+  const PBEnumNameTable unhashed = { names, 3, NULL, 0, NULL, 0 };
+
+  for (NSInteger i = 0; i < 3; ++i) {
+    STAssertEquals(PBEnumTableIndexOfName(&hashed, names[i]), i, @"");
+    STAssertEquals(PBEnumTableIndexOfName(&unhashed, names[i]), i, @"");
+  }
+  STAssertEquals(PBEnumTableIndexOfName(&hashed, "foreignQux"), (NSInteger)-1, @"");
+  STAssertEquals(PBEnumTableIndexOfName(&unhashed, "foreignQux"), (NSInteger)-1, @"");
+  STAssertEquals(PBEnumTableIndexOfName(&hashed, NULL), (NSInteger)-1, @"");
+}
+
+
+- (void) testTextFormatWriter {
+  PBTextFormatWriter writer;
+  PBTextFormatWriterInit(&writer, nil);
+  PBTextFormatWriteInt32(&writer, "a", -17);
+  PBTextFormatWriteInt64(&writer, "b", INT64_MIN);
+  PBTextFormatWriteUInt64(&writer, "c", UINT64_MAX);
+  PBTextFormatWriteBool(&writer, "d", YES);
+  PBTextFormatWriteFloat(&writer, "e", 1.5f);
+  PBTextFormatWriteDouble(&writer, "f", 0.1);
+  PBTextFormatWriterPushIndent(&writer);
+  PBTextFormatWriteObject(&writer, "g", @"text");
+  PBTextFormatWriterPopIndent(&writer);
+  STAssertEqualObjects(PBTextFormatWriterString(&writer),
+                       @"a: -17\n"
+                       @"b: -9223372036854775808\n"
+                       @"c: 18446744073709551615\n"
+                       @"d: 1\n"
+                       @"e: 1.5\n"
+                       @"f: 0.1\n"
+                       @"  g: text\n", @"");
+  PBTextFormatWriterDestroy(&writer);
+
+  // Floating point values print the way NSNumber describes them.
+  const Float64 doubles[] = { 0, -0.0, 3, 1e15, 1e16, 1e100, 0.3, -2.5e-8 };
+  for (NSUInteger i = 0; i < sizeof(doubles) / sizeof(doubles[0]); ++i) {
+    PBTextFormatWriterInit(&writer, nil);
+    PBTextFormatWriteDouble(&writer, "x", doubles[i]);
+    NSString* expected = [NSString stringWithFormat:@"x: %@\n", @(doubles[i])];
+    STAssertEqualObjects(PBTextFormatWriterString(&writer), expected, @"");
+    PBTextFormatWriterDestroy(&writer);
+  }
+
+  TestAllTypes* message = [[[[TestAllTypes builder] setOptionalInt32:5]
+                            setOptionalNestedMessage:[[[TestAllTypes_NestedMessage builder] setBb:6] build]] build];
+  STAssertEqualObjects(message.description, @"optionalInt32: 5\noptionalNestedMessage {\n  bb: 6\n}\n", @"");
+}
+
+
+- (TestAllTypes*) parseTextFormat:(NSString*) text {
+  NSData* data = [text dataUsingEncoding:NSUTF8StringEncoding];
+  return [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromTextFormat:data] build];
+}
+
+
+- (void) testTextFormatParsing {
+  TestAllTypes* message = [self parseTextFormat:
+                           @"# comment\n"
+                           @"optional_int32: -17\n"
+                           @"optional_int64: -9223372036854775808\n"
+                           @"optional_uint32: 0xFFFFFFFF\n"
+                           @"optional_uint64: 18446744073709551615\n"
+                           @"optional_sint32: 017, optional_bool: t;\n"
+                           @"optional_float: 1.5f optional_double: -2.5e-8\n"
+                           @"optional_string: \"tab\\there\" ' \\u00fc'\n"
+                           @"optional_bytes: \"\\001\\x02\\377\"\n"
+                           @"optional_nested_enum: BAZ\n"
+                           @"optional_foreign_enum: 5\n"
+                           @"optional_nested_message { bb: 1 }\n"
+                           @"optional_nested_message: < bb: 2 >\n"
+                           @"OptionalGroup { a: 3 }\n"
+                           @"repeated_int32: 1 repeated_int32: 2\n"
+                           @"repeated_double: inf repeated_double: -Infinity\n"
+                           @"repeated_nested_message { bb: 4 } repeated_nested_message { }\n"];
+  STAssertEquals(message.optionalInt32, -17, @"");
+  STAssertEquals(message.optionalInt64, INT64_MIN, @"");
+  STAssertEquals(message.optionalUint32, UINT32_MAX, @"");
+  STAssertEquals(message.optionalUint64, UINT64_MAX, @"");
+  STAssertEquals(message.optionalSint32, 15, @"");
+  STAssertTrue(message.optionalBool, @"");
+  STAssertEquals(message.optionalFloat, 1.5f, @"");
+  STAssertEquals(message.optionalDouble, -2.5e-8, @"");
+  STAssertEqualObjects(message.optionalString, @"tab\there \u00fc", @"");
+  const uint8_t bytes[] = { 1, 2, 255 };
+  STAssertEqualObjects(message.optionalBytes, [NSData dataWithBytes:bytes length:sizeof(bytes)], @"");
+  STAssertEquals(message.optionalNestedEnum, TestAllTypes_NestedEnumBaz, @"");
+  STAssertEquals(message.optionalForeignEnum, ForeignEnumForeignBar, @"");
+  STAssertEquals(message.optionalNestedMessage.bb, 2, @"");
+  STAssertEquals(message.optionalGroup.a, 3, @"");
+  STAssertEquals(message.repeatedInt32.count, (NSUInteger)2, @"");
+  STAssertEquals([message repeatedInt32AtIndex:1], 2, @"");
+  STAssertEquals([message repeatedDoubleAtIndex:0], (Float64)INFINITY, @"");
+  STAssertEquals([message repeatedDoubleAtIndex:1], (Float64)-INFINITY, @"");
+  STAssertEquals(message.repeatedNestedMessage.count, (NSUInteger)2, @"");
+  STAssertEquals([message repeatedNestedMessageAtIndex:0].bb, 4, @"");
+  STAssertFalse([message repeatedNestedMessageAtIndex:1].hasBb, @"");
+
+  TestAllTypes* empty = [self parseTextFormat:@"  \n"];
+  STAssertEqualObjects(empty, [TestAllTypes defaultInstance], @"");
+
+  NSArray* malformed = @[@"no_such_field: 1",
+                         @"optional_int32: 2147483648",
+                         @"optional_int32: 1.5",
+                         @"optional_uint32: -1",
+                         @"optional_int32 1",
+                         @"optional_string: \"unterminated",
+                         @"optional_string: \"\\xff\"",
+                         @"optional_nested_enum: QUUX",
+                         @"optional_nested_enum: 7",
+                         @"optional_nested_message { bb: 1",
+                         @"optional_nested_message { bb: 1 >",
+                         @"optional_int32: 1 }"];
+  for (NSString* text in malformed) {
+    STAssertThrowsSpecificNamed([self parseTextFormat:text], NSException, @"ParseError", @"%@", text);
+  }
+  @try {
+    [self parseTextFormat:@"optional_int32: 1\n  bogus: 2"];
+    STFail(@"");
+  } @catch (NSException* exception) {
+    STAssertTrue([exception.reason hasPrefix:@"2:3:"], @"%@", exception.reason);
+  }
+}
+
+
+- (TestAllTypes*) parseJSON:(NSString*) json {
+  NSData* data = [json dataUsingEncoding:NSUTF8StringEncoding];
+  return [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromJSON:data] build];
+}
+
+
+- (void) testJSONRoundTrip {
+  TestAllTypes* message = [TestUtilities allSet];
+  NSData* json = message.JSONData;
+  TestAllTypes* parsed = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromJSON:json] build];
+  [TestUtilities assertAllFieldsSet:parsed];
+  STAssertEqualObjects(parsed, message, @"");
+
+  // The writer's output is plain JSON that Foundation reads the same way.
+  NSDictionary* object = [NSJSONSerialization JSONObjectWithData:json options:0 error:NULL];
+  STAssertEqualObjects([object objectForKey:@"optionalInt32"], @101, @"");
+  STAssertEqualObjects([object objectForKey:@"optionalInt64"], @"102", @"");
+  STAssertEqualObjects([object objectForKey:@"optionalNestedEnum"], @"BAZ", @"");
+  STAssertEqualObjects([[object objectForKey:@"optionalgroup"] objectForKey:@"a"], @117, @"");
+  STAssertEquals([[object objectForKey:@"repeatedString"] count], (NSUInteger)2, @"");
+
+  NSString* empty = [[NSString alloc] initWithData:[TestAllTypes defaultInstance].JSONData
+                                          encoding:NSUTF8StringEncoding];
+  STAssertEqualObjects(empty, @"{}", @"");
+}
+
+
+- (void) testJSONParsing {
+  TestAllTypes* message = [self parseJSON:
+                           @" {\"optionalInt32\": -17, \"optional_int64\": \"-9223372036854775808\",\n"
+                           @"  \"optionalUint32\": 4294967295, \"optionalUint64\": \"18446744073709551615\",\n"
+                           @"  \"optionalSint32\": \"15\", \"optionalFixed32\": 1e3, \"optionalBool\": true,\n"
+                           @"  \"optionalFloat\": 1.5, \"optionalDouble\": \"-Infinity\",\n"
+                           @"  \"optionalString\": \"tab\\there \\u00fc\\ud83d\\ude00\",\n"
+                           @"  \"optionalBytes\": \"AQL/\", \"optionalNestedEnum\": \"BAZ\", \"optionalForeignEnum\": 5,\n"
+                           @"  \"optionalNestedMessage\": {\"bb\": 1}, \"optional_nested_message\": {},\n"
+                           @"  \"optionalgroup\": {\"a\": 3}, \"optionalImportMessage\": null,\n"
+                           @"  \"repeatedInt32\": [1, 2], \"repeatedNestedMessage\": [{\"bb\": 4}, {}],\n"
+                           @"  \"repeatedNestedEnum\": [\"FOO\", 2], \"repeatedString\": []}"];
+  STAssertEquals(message.optionalInt32, -17, @"");
+  STAssertEquals(message.optionalInt64, INT64_MIN, @"");
+  STAssertEquals(message.optionalUint32, UINT32_MAX, @"");
+  STAssertEquals(message.optionalUint64, UINT64_MAX, @"");
+  STAssertEquals(message.optionalSint32, 15, @"");
+  STAssertEquals(message.optionalFixed32, (uint32_t)1000, @"");
+  STAssertTrue(message.optionalBool, @"");
+  STAssertEquals(message.optionalFloat, 1.5f, @"");
+  STAssertEquals(message.optionalDouble, (Float64)-INFINITY, @"");
+  STAssertEqualObjects(message.optionalString, @"tab\there \u00fc\U0001F600", @"");
+  const uint8_t bytes[] = { 1, 2, 255 };
+  STAssertEqualObjects(message.optionalBytes, [NSData dataWithBytes:bytes length:sizeof(bytes)], @"");
+  STAssertEquals(message.optionalNestedEnum, TestAllTypes_NestedEnumBaz, @"");
+  STAssertEquals(message.optionalForeignEnum, ForeignEnumForeignBar, @"");
+  STAssertEquals(message.optionalNestedMessage.bb, 1, @"");
+  STAssertEquals(message.optionalGroup.a, 3, @"");
+  STAssertFalse(message.hasOptionalImportMessage, @"");
+  STAssertEquals(message.repeatedInt32.count, (NSUInteger)2, @"");
+  STAssertEquals([message repeatedInt32AtIndex:1], 2, @"");
+  STAssertEquals(message.repeatedNestedMessage.count, (NSUInteger)2, @"");
+  STAssertEquals([message repeatedNestedMessageAtIndex:0].bb, 4, @"");
+  STAssertFalse([message repeatedNestedMessageAtIndex:1].hasBb, @"");
+  STAssertEquals([message repeatedNestedEnumAtIndex:0], TestAllTypes_NestedEnumFoo, @"");
+  STAssertEquals([message repeatedNestedEnumAtIndex:1], TestAllTypes_NestedEnumBar, @"");
+  STAssertEquals(message.repeatedString.count, (NSUInteger)0, @"");
+
+  NSArray* malformed = @[@"",
+                         @"[]",
+                         @"{\"noSuchField\": 1}",
+                         @"{\"optionalInt32\": 2147483648}",
+                         @"{\"optionalInt32\": 1.5}",
+                         @"{\"optionalInt32\": 01}",
+                         @"{\"optionalUint32\": -1}",
+                         @"{\"optionalInt32\" 1}",
+                         @"{\"optionalInt32\": 1,}",
+                         @"{\"optionalBool\": 1}",
+                         @"{\"optionalString\": \"unterminated}",
+                         @"{\"optionalString\": \"\\ud83d\"}",
+                         @"{\"optionalBytes\": \"A\"}",
+                         @"{\"optionalNestedEnum\": \"QUUX\"}",
+                         @"{\"optionalNestedMessage\": {\"bb\": 1}",
+                         @"{\"repeatedInt32\": [1, ]}",
+                         @"{\"repeatedInt32\": 1}",
+                         @"{\"[protobuf_unittest.optional_int32_extension]\": 1}",
+                         @"{} {}"];
+  for (NSString* json in malformed) {
+    STAssertThrowsSpecificNamed([self parseJSON:json], NSException, @"ParseError", @"%@", json);
+  }
+  @try {
+    [self parseJSON:@"{\"optionalInt32\": 1,\n  \"bogus\": 2}"];
+    STFail(@"");
+  } @catch (NSException* exception) {
+    STAssertTrue([exception.reason hasPrefix:@"2:3:"], @"%@", exception.reason);
+  }
+}
+
+
+- (void) testDefaultInstances {
+  STAssertTrue([TestAllTypes defaultInstance] == [TestAllTypes defaultInstance], @"");
+  STAssertTrue([[TestAllTypes builder] defaultInstance] == [TestAllTypes defaultInstance], @"");
+  STAssertTrue([TestAllTypes defaultInstance].optionalNestedMessage == [TestAllTypes_NestedMessage defaultInstance], @"");
+
+  // These refer back to themselves, so they are built in +initialize.
+  STAssertNotNil([TestRecursiveMessage defaultInstance], @"");
+  STAssertNotNil([TestMutualRecursionA defaultInstance], @"");
+
+  PBExtensionRegistry* registry = [UnittestRoot extensionRegistry];
+  STAssertTrue(registry == [UnittestRoot extensionRegistry], @"");
+  STAssertNotNil([registry getExtension:[TestAllExtensions class] fieldNumber:1], @"");
+}
+
 @end
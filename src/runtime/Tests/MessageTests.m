@@ -17,6 +17,7 @@
 
 #import "MessageTests.h"
 
+#import "TestUtilities.h"
 #import "Unittest.pb.h"
 
 @implementation MessageTests
@@ -158,7 +159,7 @@
 
 
 - (void) testParseUnititialized {
-  STAssertThrows([TestRequired parseFromData:[NSData data]], @"");
+  STAssertThrows([(TestRequired_Builder*)[[TestRequired builder] mergeFromData:[NSData data]] build], @"");
 }
 
 
@@ -172,7 +173,113 @@
 
   NSData* data = message.data;
 
-  STAssertThrows([TestRequiredForeign parseFromData:data], @"");
+  STAssertThrows([(TestRequiredForeign_Builder*)[[TestRequiredForeign builder] mergeFromData:data] build], @"");
+}
+
+- (void) testMessageDeltaRoundTrip {
+  NSData* changes = [self mergeSource].data;
+  PBMessageDelta* nested =
+  [PBMessageDelta deltaWithChanges:[[[TestAllTypes_NestedMessage builder] setBb:7] build].data
+                     clearedFields:nil
+                       fieldDeltas:nil];
+  PBMessageDelta* delta =
+  [PBMessageDelta deltaWithChanges:changes
+                     clearedFields:[NSArray arrayWithObjects:@2, @14, nil]
+                       fieldDeltas:[NSDictionary dictionaryWithObject:nested forKey:@18]];
+  STAssertFalse(delta.isEmpty, @"");
+
+  NSData* data = delta.data;
+  STAssertEquals((NSUInteger)delta.serializedSize, data.length, @"");
+
+  PBMessageDelta* parsed = [PBMessageDelta parseFromData:data];
+  STAssertEqualObjects(parsed.changes, changes, @"");
+  STAssertEqualObjects(parsed.clearedFields, delta.clearedFields, @"");
+  STAssertEqualObjects([parsed deltaForField:18].changes, nested.changes, @"");
+  STAssertNil([parsed deltaForField:19], @"");
+  STAssertEqualObjects(parsed.data, data, @"");
+}
+
+
+- (void) testEmptyMessageDelta {
+  PBMessageDelta* delta = [PBMessageDelta deltaWithChanges:nil clearedFields:nil fieldDeltas:nil];
+  STAssertTrue(delta.isEmpty, @"");
+  STAssertEquals(delta.serializedSize, 0, @"");
+  STAssertTrue([PBMessageDelta parseFromData:[NSData data]].isEmpty, @"");
+}
+
+
+/** Applies {@code [newer diffFrom:older]}, before and after a round trip through its encoding. */
+- (PBMessageDelta*) assertDeltaFrom:(TestAllTypes*) older to:(TestAllTypes*) newer {
+  PBMessageDelta* delta = [newer diffFrom:older];
+  STAssertEqualObjects(newer, [[[older toBuilder] applyDelta:delta] build], @"");
+  STAssertEqualObjects(newer, [[[older toBuilder] applyDelta:[PBMessageDelta parseFromData:delta.data]] build], @"");
+  return delta;
+}
+
+
+- (void) testDiffOfEqualMessagesIsEmpty {
+  TestAllTypes* message = [TestUtilities allSet];
+  STAssertTrue([message diffFrom:[TestUtilities allSet]].isEmpty, @"");
+  STAssertTrue([[TestAllTypes defaultInstance] diffFrom:[TestAllTypes defaultInstance]].isEmpty, @"");
+}
+
+
+- (void) testDeltaOfAllFields {
+  [self assertDeltaFrom:[TestAllTypes defaultInstance] to:[TestUtilities allSet]];
+  [self assertDeltaFrom:[TestUtilities allSet] to:[TestAllTypes defaultInstance]];
+}
+
+
+- (void) testDeltaOfChangedScalar {
+  TestAllTypes* older = [TestUtilities allSet];
+  TestAllTypes* newer = [[[[older toBuilder] setOptionalInt32:1234] setOptionalString:@"changed"] build];
+  PBMessageDelta* delta = [self assertDeltaFrom:older to:newer];
+  STAssertEquals(delta.clearedFields.count, (NSUInteger)0, @"");
+  STAssertEquals(delta.fieldDeltas.count, (NSUInteger)0, @"");
+
+  TestAllTypes* changes = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromData:delta.changes] build];
+  STAssertEquals(changes.optionalInt32, 1234, @"");
+  STAssertEqualObjects(changes.optionalString, @"changed", @"");
+  STAssertFalse(changes.hasOptionalInt64, @"");
+}
+
+
+- (void) testDeltaOfClearedField {
+  TestAllTypes* older = [TestUtilities allSet];
+  TestAllTypes* newer = [[[[older toBuilder] clearOptionalString] clearOptionalForeignMessage] build];
+  PBMessageDelta* delta = [self assertDeltaFrom:older to:newer];
+  STAssertEquals(delta.changes.length, (NSUInteger)0, @"");
+  STAssertEqualObjects(delta.clearedFields, ([NSArray arrayWithObjects:@14, @19, nil]), @"");
+}
+
+
+- (void) testDeltaOfNestedMessage {
+  TestAllTypes* older = [TestUtilities allSet];
+  TestAllTypes* newer =
+  [[[older toBuilder] setOptionalNestedMessage:[[[TestAllTypes_NestedMessage builder] setBb:4321] build]] build];
+  PBMessageDelta* delta = [self assertDeltaFrom:older to:newer];
+  STAssertEquals(delta.changes.length, (NSUInteger)0, @"");
+  STAssertEquals(delta.fieldDeltas.count, (NSUInteger)1, @"");
+  STAssertEquals([(TestAllTypes_NestedMessage_Builder*)[[TestAllTypes_NestedMessage builder] mergeFromData:[delta deltaForField:18].changes] build].bb, 4321, @"");
+
+  // A submessage that was not set before is sent whole.
+  TestAllTypes* unset = [[[older toBuilder] clearOptionalNestedMessage] build];
+  delta = [self assertDeltaFrom:unset to:newer];
+  STAssertNil([delta deltaForField:18], @"");
+  STAssertTrue([(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromData:delta.changes] build].hasOptionalNestedMessage, @"");
+}
+
+
+- (void) testDeltaOfRepeatedField {
+  TestAllTypes* older = [TestUtilities allSet];
+  // Replaced, grown and emptied lists all come out as the newer list, not appended to the older one.
+  TestAllTypes* newer = [[[[[older toBuilder] clearRepeatedInt32] addRepeatedInt32:7] addRepeatedString:@"more"] build];
+  PBMessageDelta* delta = [self assertDeltaFrom:older to:newer];
+  STAssertEquals(delta.clearedFields.count, (NSUInteger)0, @"");
+
+  newer = [[[older toBuilder] clearRepeatedNestedMessage] build];
+  delta = [self assertDeltaFrom:older to:newer];
+  STAssertEqualObjects(delta.clearedFields, [NSArray arrayWithObject:@48], @"");
 }
 
 @end
@@ -0,0 +1,268 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "PerformanceTests.h"
+
+#import "Unittest.pb.h"
+#import "UnittestCustomOptions.pb.h"
+
+/**
+ * Throughput benchmarks.  These only log their timings; they assert
+ * correctness of what they decode but never fail on speed.
+ */
+@implementation PerformanceTests
+
+static const int32_t kIterations = 2000;
+
+
+/**
+ * Builds a chain of nested Aggregate messages, each carrying a string made
+ * by repeating {@code fragment}.
+ */
+- (Aggregate*) aggregateChainWithFragment:(NSString*) fragment depth:(int32_t) depth {
+  NSString* value = [@"" stringByPaddingToLength:256 withString:fragment startingAtIndex:0];
+  Aggregate* message = nil;
+  for (int32_t i = 0; i < depth; i++) {
+    Aggregate_Builder* builder = [[Aggregate builder] setI:i];
+    [builder setS:value];
+    if (message != nil) {
+      [builder setSub:message];
+    }
+    message = [builder build];
+  }
+  return message;
+}
+
+
+- (void) logThroughput:(NSString*) name
+                 bytes:(NSUInteger) bytes
+            iterations:(int32_t) iterations
+               seconds:(CFAbsoluteTime) seconds {
+  NSLog(@"%@: %.1f MB/s (%.0f ns/op)",
+        name,
+        (bytes * (double)iterations) / (seconds * 1024 * 1024),
+        seconds * 1e9 / iterations);
+}
+
+
+- (void) logThroughput:(NSString*) name bytes:(NSUInteger) bytes seconds:(CFAbsoluteTime) seconds {
+  [self logThroughput:name bytes:bytes iterations:kIterations seconds:seconds];
+}
+
+
+- (void) benchmarkStringsWithFragment:(NSString*) fragment name:(NSString*) name {
+  Aggregate* message = [self aggregateChainWithFragment:fragment depth:32];
+  NSData* data = message.data;
+
+  CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+  for (int32_t i = 0; i < kIterations; i++) {
+    @autoreleasepool {
+      Aggregate* parsed = [(Aggregate_Builder*)[[Aggregate builder] mergeFromData:data] build];
+      STAssertEquals(parsed.i, message.i, @"");
+    }
+  }
+  [self logThroughput:[NSString stringWithFormat:@"parse Aggregate (%@ strings)", name]
+                bytes:data.length
+              seconds:CFAbsoluteTimeGetCurrent() - start];
+
+  // The same string bytes through NSString's own UTF-8 decoder, for scale.
+  NSData* utf8 = [message.s dataUsingEncoding:NSUTF8StringEncoding];
+  start = CFAbsoluteTimeGetCurrent();
+  for (int32_t i = 0; i < kIterations * 32; i++) {
+    @autoreleasepool {
+      NSString* string = [[NSString alloc] initWithBytes:utf8.bytes
+                                                  length:utf8.length
+                                                encoding:NSUTF8StringEncoding];
+      STAssertNotNil(string, @"");
+    }
+  }
+  [self logThroughput:[NSString stringWithFormat:@"NSString UTF-8 decode (%@ strings, x32)", name]
+                bytes:utf8.length * 32
+              seconds:CFAbsoluteTimeGetCurrent() - start];
+}
+
+
+- (void) testStringDecodeThroughput {
+  [self benchmarkStringsWithFragment:@"plain ascii text " name:@"ASCII"];
+  [self benchmarkStringsWithFragment:@"gr\u00fc\u00dfe \u20ac " name:@"non-ASCII"];
+}
+
+
+/**
+ * A text format dump of about a megabyte: many repeated nested messages, each
+ * mixing integers, floats, strings with escapes and enum names.
+ */
+- (NSData*) largeTextFormatDump {
+  NSMutableString* text = [NSMutableString string];
+  for (int32_t i = 0; i < 8192; i++) {
+    [text appendFormat:@"repeated_int64: %d\n", i * 7919];
+    [text appendFormat:@"repeated_double: %.17g\n", i / 7.0];
+    [text appendFormat:@"repeated_string: \"entry %d\\twith \\\"quotes\\\"\"\n", i];
+    [text appendString:@"repeated_nested_enum: BAR\n"];
+    [text appendFormat:@"repeated_nested_message {\n  bb: %d\n}\n", -i];
+  }
+  return [text dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+
+- (void) testTextFormatParseThroughput {
+  NSData* text = [self largeTextFormatDump];
+  const int32_t iterations = 20;
+
+  TestAllTypes* expected = nil;
+  CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+  for (int32_t i = 0; i < iterations; i++) {
+    @autoreleasepool {
+      expected = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromTextFormat:text] build];
+      STAssertEquals(expected.repeatedNestedMessage.count, (NSUInteger)8192, @"");
+    }
+  }
+  [self logThroughput:@"parse TestAllTypes text format"
+                bytes:text.length
+           iterations:iterations
+              seconds:CFAbsoluteTimeGetCurrent() - start];
+
+  // The same message through the binary parser, for scale.
+  NSData* data = expected.data;
+  start = CFAbsoluteTimeGetCurrent();
+  for (int32_t i = 0; i < iterations; i++) {
+    @autoreleasepool {
+      TestAllTypes* parsed = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromData:data] build];
+      STAssertEqualObjects(parsed, expected, @"");
+    }
+  }
+  [self logThroughput:@"parse TestAllTypes binary (same message)"
+                bytes:data.length
+           iterations:iterations
+              seconds:CFAbsoluteTimeGetCurrent() - start];
+}
+
+
+/**
+ * What code without a generated JSON encoder does: copy the fields of a
+ * largeTextFormatDump message into Foundation collections for
+ * NSJSONSerialization, in the same shape the generated encoder writes.
+ */
+- (NSDictionary*) foundationObjectForMessage:(TestAllTypes*) message {
+  NSArray* enumNames = @[@"FOO", @"BAR", @"BAZ"];
+  NSMutableArray* int64s = [NSMutableArray array];
+  NSMutableArray* doubles = [NSMutableArray array];
+  NSMutableArray* enums = [NSMutableArray array];
+  NSMutableArray* nestedMessages = [NSMutableArray array];
+  for (NSUInteger i = 0; i < message.repeatedInt64.count; i++) {
+    [int64s addObject:[NSString stringWithFormat:@"%lld", [message repeatedInt64AtIndex:i]]];
+  }
+  for (NSUInteger i = 0; i < message.repeatedDouble.count; i++) {
+    [doubles addObject:[NSNumber numberWithDouble:[message repeatedDoubleAtIndex:i]]];
+  }
+  for (NSUInteger i = 0; i < message.repeatedNestedEnum.count; i++) {
+    [enums addObject:[enumNames objectAtIndex:[message repeatedNestedEnumAtIndex:i] - 1]];
+  }
+  for (TestAllTypes_NestedMessage* nested in message.repeatedNestedMessage) {
+    [nestedMessages addObject:[NSDictionary dictionaryWithObject:[NSNumber numberWithInt:nested.bb] forKey:@"bb"]];
+  }
+  return [NSDictionary dictionaryWithObjectsAndKeys:
+          int64s, @"repeatedInt64",
+          doubles, @"repeatedDouble",
+          message.repeatedString, @"repeatedString",
+          enums, @"repeatedNestedEnum",
+          nestedMessages, @"repeatedNestedMessage",
+          nil];
+}
+
+
+- (TestAllTypes*) messageFromFoundationObject:(NSDictionary*) object {
+  NSArray* enumNames = @[@"FOO", @"BAR", @"BAZ"];
+  TestAllTypes_Builder* builder = [TestAllTypes builder];
+  for (NSString* value in [object objectForKey:@"repeatedInt64"]) {
+    [builder addRepeatedInt64:value.longLongValue];
+  }
+  for (NSNumber* value in [object objectForKey:@"repeatedDouble"]) {
+    [builder addRepeatedDouble:value.doubleValue];
+  }
+  for (NSString* value in [object objectForKey:@"repeatedString"]) {
+    [builder addRepeatedString:value];
+  }
+  for (NSString* value in [object objectForKey:@"repeatedNestedEnum"]) {
+    [builder addRepeatedNestedEnum:(TestAllTypes_NestedEnum)([enumNames indexOfObject:value] + 1)];
+  }
+  for (NSDictionary* value in [object objectForKey:@"repeatedNestedMessage"]) {
+    TestAllTypes_NestedMessage_Builder* nested = [TestAllTypes_NestedMessage builder];
+    [nested setBb:[[value objectForKey:@"bb"] intValue]];
+    [builder addRepeatedNestedMessage:[nested build]];
+  }
+  return [builder build];
+}
+
+
+- (void) testJSONThroughput {
+  TestAllTypes* message = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromTextFormat:[self largeTextFormatDump]] build];
+  const int32_t iterations = 20;
+
+  NSData* json = nil;
+  CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+  for (int32_t i = 0; i < iterations; i++) {
+    @autoreleasepool {
+      json = message.JSONData;
+    }
+  }
+  [self logThroughput:@"serialize TestAllTypes JSON"
+                bytes:json.length
+           iterations:iterations
+              seconds:CFAbsoluteTimeGetCurrent() - start];
+
+  NSData* foundationJSON = nil;
+  start = CFAbsoluteTimeGetCurrent();
+  for (int32_t i = 0; i < iterations; i++) {
+    @autoreleasepool {
+      foundationJSON = [NSJSONSerialization dataWithJSONObject:[self foundationObjectForMessage:message]
+                                                       options:0
+                                                         error:NULL];
+    }
+  }
+  [self logThroughput:@"serialize TestAllTypes JSON via NSJSONSerialization"
+                bytes:foundationJSON.length
+           iterations:iterations
+              seconds:CFAbsoluteTimeGetCurrent() - start];
+
+  TestAllTypes* parsed = nil;
+  start = CFAbsoluteTimeGetCurrent();
+  for (int32_t i = 0; i < iterations; i++) {
+    @autoreleasepool {
+      parsed = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromJSON:json] build];
+    }
+  }
+  [self logThroughput:@"parse TestAllTypes JSON"
+                bytes:json.length
+           iterations:iterations
+              seconds:CFAbsoluteTimeGetCurrent() - start];
+  STAssertEqualObjects(parsed, message, @"");
+
+  start = CFAbsoluteTimeGetCurrent();
+  for (int32_t i = 0; i < iterations; i++) {
+    @autoreleasepool {
+      parsed = [self messageFromFoundationObject:[NSJSONSerialization JSONObjectWithData:json options:0 error:NULL]];
+    }
+  }
+  [self logThroughput:@"parse TestAllTypes JSON via NSJSONSerialization"
+                bytes:json.length
+           iterations:iterations
+              seconds:CFAbsoluteTimeGetCurrent() - start];
+  STAssertEquals(parsed.repeatedNestedMessage.count, message.repeatedNestedMessage.count, @"");
+}
+
+@end
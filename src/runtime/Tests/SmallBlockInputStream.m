@@ -65,4 +65,15 @@
   return underlyingStream.hasBytesAvailable;
 }
 
+
+// Like a socket or pipe, this stream can't seek.
+- (id) propertyForKey:(NSString*) key {
+  return nil;
+}
+
+
+- (BOOL) setProperty:(id) property forKey:(NSString*) key {
+  return NO;
+}
+
 @end
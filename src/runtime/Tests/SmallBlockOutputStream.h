@@ -0,0 +1,29 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Accepts at most blockSize bytes per write, like a socket or pipe that is
+// nearly full.  Bytes written end up in memory.
+@interface SmallBlockOutputStream : NSOutputStream {
+  NSOutputStream* underlyingStream;
+  int32_t blockSize;
+}
+
+@property (strong) NSOutputStream* underlyingStream;
+
++ (SmallBlockOutputStream*) streamWithBlockSize:(int32_t) blockSize;
+
+@end
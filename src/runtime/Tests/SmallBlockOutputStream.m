@@ -0,0 +1,66 @@
+// Protocol Buffers for Objective C
+//
+// Copyright 2010 Booyah Inc.
+// Copyright 2008 Cyrus Najmabadi
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "SmallBlockOutputStream.h"
+
+
+@implementation SmallBlockOutputStream
+
+@synthesize underlyingStream;
+
+
+- (id) initWithBlockSize:(int32_t) blockSize_ {
+  if ((self = [super init])) {
+    self.underlyingStream = [NSOutputStream outputStreamToMemory];
+    blockSize = blockSize_;
+  }
+
+  return self;
+}
+
+
++ (SmallBlockOutputStream*) streamWithBlockSize:(int32_t) blockSize {
+  return [[SmallBlockOutputStream alloc] initWithBlockSize:blockSize];
+}
+
+
+- (void) open {
+  [underlyingStream open];
+}
+
+
+- (void) close {
+  [underlyingStream close];
+}
+
+
+- (NSInteger) write:(const uint8_t*) buffer
+          maxLength:(NSUInteger) len {
+  return [underlyingStream write:buffer maxLength:MIN(len, blockSize)];
+}
+
+
+- (BOOL) hasSpaceAvailable {
+  return underlyingStream.hasSpaceAvailable;
+}
+
+
+- (id) propertyForKey:(NSString*) key {
+  return [underlyingStream propertyForKey:key];
+}
+
+@end
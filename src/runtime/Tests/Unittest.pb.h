@@ -1,6 +1,5 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 
-
 #import <ProtocolBuffers/ProtocolBuffers.h>
 
 #import "UnittestImport.pb.h"
@@ -101,23 +100,31 @@
   #endif
 #endif
 
-typedef enum {
+typedef NS_CLOSED_ENUM(int32_t, ForeignEnum) {
   ForeignEnumForeignFoo = 4,
   ForeignEnumForeignBar = 5,
   ForeignEnumForeignBaz = 6,
-} ForeignEnum;
+};
 
 BOOL ForeignEnumIsValidValue(ForeignEnum value);
+ForeignEnum ForeignEnumReadTextFormat(PBTextFormatReader* reader);
+void ForeignEnumWriteJSON(PBJSONWriter* writer, const char* name, ForeignEnum value);
+ForeignEnum ForeignEnumReadJSON(PBJSONReader* reader);
+const char* ForeignEnumStringRepresentation(ForeignEnum value);
+BOOL ForeignEnumFromStringRepresentation(const char* name, ForeignEnum* value);
 
-typedef enum {
+typedef NS_CLOSED_ENUM(int32_t, TestEnumWithDupValue) {
   TestEnumWithDupValueFoo1 = 1,
   TestEnumWithDupValueBar1 = 2,
   TestEnumWithDupValueBaz = 3,
-} TestEnumWithDupValue;
+};
 
 BOOL TestEnumWithDupValueIsValidValue(TestEnumWithDupValue value);
+TestEnumWithDupValue TestEnumWithDupValueReadTextFormat(PBTextFormatReader* reader);
+void TestEnumWithDupValueWriteJSON(PBJSONWriter* writer, const char* name, TestEnumWithDupValue value);
+TestEnumWithDupValue TestEnumWithDupValueReadJSON(PBJSONReader* reader);
 
-typedef enum {
+typedef NS_CLOSED_ENUM(int32_t, TestSparseEnum) {
   TestSparseEnumSparseA = 123,
   TestSparseEnumSparseB = 62374,
   TestSparseEnumSparseC = 12589234,
@@ -125,25 +132,51 @@ typedef enum {
   TestSparseEnumSparseE = -53452,
   TestSparseEnumSparseF = 0,
   TestSparseEnumSparseG = 2,
-} TestSparseEnum;
+};
 
 BOOL TestSparseEnumIsValidValue(TestSparseEnum value);
-
-typedef enum {
+TestSparseEnum TestSparseEnumReadTextFormat(PBTextFormatReader* reader);
+void TestSparseEnumWriteJSON(PBJSONWriter* writer, const char* name, TestSparseEnum value);
+TestSparseEnum TestSparseEnumReadJSON(PBJSONReader* reader);
+const char* TestSparseEnumStringRepresentation(TestSparseEnum value);
+BOOL TestSparseEnumFromStringRepresentation(const char* name, TestSparseEnum* value);
+
+typedef NS_CLOSED_ENUM(int32_t, TestSemiDenseEnum) {
+  TestSemiDenseEnumSemiDenseA = -3,
+  TestSemiDenseEnumSemiDenseB = 1,
+  TestSemiDenseEnumSemiDenseC = 2,
+  TestSemiDenseEnumSemiDenseD = 40,
+  TestSemiDenseEnumSemiDenseE = 70,
+};
+
+BOOL TestSemiDenseEnumIsValidValue(TestSemiDenseEnum value);
+TestSemiDenseEnum TestSemiDenseEnumReadTextFormat(PBTextFormatReader* reader);
+void TestSemiDenseEnumWriteJSON(PBJSONWriter* writer, const char* name, TestSemiDenseEnum value);
+TestSemiDenseEnum TestSemiDenseEnumReadJSON(PBJSONReader* reader);
+const char* TestSemiDenseEnumStringRepresentation(TestSemiDenseEnum value);
+BOOL TestSemiDenseEnumFromStringRepresentation(const char* name, TestSemiDenseEnum* value);
+
+typedef NS_CLOSED_ENUM(int32_t, TestAllTypes_NestedEnum) {
   TestAllTypes_NestedEnumFoo = 1,
   TestAllTypes_NestedEnumBar = 2,
   TestAllTypes_NestedEnumBaz = 3,
-} TestAllTypes_NestedEnum;
+};
 
 BOOL TestAllTypes_NestedEnumIsValidValue(TestAllTypes_NestedEnum value);
+TestAllTypes_NestedEnum TestAllTypes_NestedEnumReadTextFormat(PBTextFormatReader* reader);
+void TestAllTypes_NestedEnumWriteJSON(PBJSONWriter* writer, const char* name, TestAllTypes_NestedEnum value);
+TestAllTypes_NestedEnum TestAllTypes_NestedEnumReadJSON(PBJSONReader* reader);
 
-typedef enum {
+typedef NS_CLOSED_ENUM(int32_t, TestDynamicExtensions_DynamicEnumType) {
   TestDynamicExtensions_DynamicEnumTypeDynamicFoo = 2200,
   TestDynamicExtensions_DynamicEnumTypeDynamicBar = 2201,
   TestDynamicExtensions_DynamicEnumTypeDynamicBaz = 2202,
-} TestDynamicExtensions_DynamicEnumType;
+};
 
 BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_DynamicEnumType value);
+TestDynamicExtensions_DynamicEnumType TestDynamicExtensions_DynamicEnumTypeReadTextFormat(PBTextFormatReader* reader);
+void TestDynamicExtensions_DynamicEnumTypeWriteJSON(PBJSONWriter* writer, const char* name, TestDynamicExtensions_DynamicEnumType value);
+TestDynamicExtensions_DynamicEnumType TestDynamicExtensions_DynamicEnumTypeReadJSON(PBJSONReader* reader);
 
 
 @interface UnittestRoot : NSObject {
@@ -236,233 +269,119 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 + (id<PBExtensionField>) packedEnumExtension;
 @end
 
-@interface TestAllTypes : PBGeneratedMessage {
-@private
-  BOOL hasOptionalBool_:1;
-  BOOL hasDefaultBool_:1;
-  BOOL hasOptionalDouble_:1;
-  BOOL hasDefaultDouble_:1;
-  BOOL hasDefaultFloat_:1;
-  BOOL hasOptionalFloat_:1;
-  BOOL hasOptionalInt64_:1;
-  BOOL hasDefaultInt64_:1;
-  BOOL hasOptionalUint64_:1;
-  BOOL hasDefaultUint64_:1;
-  BOOL hasDefaultInt32_:1;
-  BOOL hasOptionalInt32_:1;
-  BOOL hasOptionalFixed64_:1;
-  BOOL hasDefaultFixed64_:1;
-  BOOL hasOptionalFixed32_:1;
-  BOOL hasDefaultFixed32_:1;
-  BOOL hasDefaultString_:1;
-  BOOL hasDefaultStringPiece_:1;
-  BOOL hasDefaultCord_:1;
-  BOOL hasOptionalCord_:1;
-  BOOL hasOptionalStringPiece_:1;
-  BOOL hasOptionalString_:1;
-  BOOL hasOptionalGroup_:1;
-  BOOL hasOptionalNestedMessage_:1;
-  BOOL hasOptionalForeignMessage_:1;
-  BOOL hasOptionalImportMessage_:1;
-  BOOL hasDefaultBytes_:1;
-  BOOL hasOptionalBytes_:1;
-  BOOL hasOptionalUint32_:1;
-  BOOL hasDefaultUint32_:1;
-  BOOL hasDefaultImportEnum_:1;
-  BOOL hasDefaultForeignEnum_:1;
-  BOOL hasDefaultNestedEnum_:1;
-  BOOL hasOptionalImportEnum_:1;
-  BOOL hasOptionalForeignEnum_:1;
-  BOOL hasOptionalNestedEnum_:1;
-  BOOL hasDefaultSfixed32_:1;
-  BOOL hasOptionalSfixed32_:1;
-  BOOL hasDefaultSfixed64_:1;
-  BOOL hasOptionalSfixed64_:1;
-  BOOL hasDefaultSint32_:1;
-  BOOL hasOptionalSint32_:1;
-  BOOL hasOptionalSint64_:1;
-  BOOL hasDefaultSint64_:1;
-  BOOL optionalBool_:1;
-  BOOL defaultBool_:1;
-  Float64 optionalDouble;
-  Float64 defaultDouble;
-  Float32 defaultFloat;
-  Float32 optionalFloat;
-  int64_t optionalInt64;
-  int64_t defaultInt64;
-  uint64_t optionalUint64;
-  uint64_t defaultUint64;
-  int32_t defaultInt32;
-  int32_t optionalInt32;
-  uint64_t optionalFixed64;
-  uint64_t defaultFixed64;
-  uint32_t optionalFixed32;
-  uint32_t defaultFixed32;
-  NSString* defaultString;
-  NSString* defaultStringPiece;
-  NSString* defaultCord;
-  NSString* optionalCord;
-  NSString* optionalStringPiece;
-  NSString* optionalString;
-  TestAllTypes_OptionalGroup* optionalGroup;
-  TestAllTypes_NestedMessage* optionalNestedMessage;
-  ForeignMessage* optionalForeignMessage;
-  ImportMessage* optionalImportMessage;
-  NSData* defaultBytes;
-  NSData* optionalBytes;
-  uint32_t optionalUint32;
-  uint32_t defaultUint32;
-  ImportEnum defaultImportEnum;
-  ForeignEnum defaultForeignEnum;
-  TestAllTypes_NestedEnum defaultNestedEnum;
-  ImportEnum optionalImportEnum;
-  ForeignEnum optionalForeignEnum;
-  TestAllTypes_NestedEnum optionalNestedEnum;
-  int32_t defaultSfixed32;
-  int32_t optionalSfixed32;
-  int64_t defaultSfixed64;
-  int64_t optionalSfixed64;
-  int32_t defaultSint32;
-  int32_t optionalSint32;
-  int64_t optionalSint64;
-  int64_t defaultSint64;
-  PBAppendableArray * repeatedBoolArray;
-  PBAppendableArray * repeatedDoubleArray;
-  PBAppendableArray * repeatedFloatArray;
-  PBAppendableArray * repeatedInt64Array;
-  PBAppendableArray * repeatedUint64Array;
-  PBAppendableArray * repeatedInt32Array;
-  PBAppendableArray * repeatedFixed64Array;
-  PBAppendableArray * repeatedFixed32Array;
-  NSMutableArray * repeatedStringArray;
-  NSMutableArray * repeatedCordArray;
-  NSMutableArray * repeatedStringPieceArray;
-  NSMutableArray * repeatedGroupArray;
-  NSMutableArray * repeatedImportMessageArray;
-  NSMutableArray * repeatedForeignMessageArray;
-  NSMutableArray * repeatedNestedMessageArray;
-  NSMutableArray * repeatedBytesArray;
-  PBAppendableArray * repeatedUint32Array;
-  PBAppendableArray * repeatedImportEnumArray;
-  PBAppendableArray * repeatedForeignEnumArray;
-  PBAppendableArray * repeatedNestedEnumArray;
-  PBAppendableArray * repeatedSfixed32Array;
-  PBAppendableArray * repeatedSfixed64Array;
-  PBAppendableArray * repeatedSint32Array;
-  PBAppendableArray * repeatedSint64Array;
-}
-- (BOOL) hasOptionalInt32;
-- (BOOL) hasOptionalInt64;
-- (BOOL) hasOptionalUint32;
-- (BOOL) hasOptionalUint64;
-- (BOOL) hasOptionalSint32;
-- (BOOL) hasOptionalSint64;
-- (BOOL) hasOptionalFixed32;
-- (BOOL) hasOptionalFixed64;
-- (BOOL) hasOptionalSfixed32;
-- (BOOL) hasOptionalSfixed64;
-- (BOOL) hasOptionalFloat;
-- (BOOL) hasOptionalDouble;
-- (BOOL) hasOptionalBool;
-- (BOOL) hasOptionalString;
-- (BOOL) hasOptionalBytes;
-- (BOOL) hasOptionalGroup;
-- (BOOL) hasOptionalNestedMessage;
-- (BOOL) hasOptionalForeignMessage;
-- (BOOL) hasOptionalImportMessage;
-- (BOOL) hasOptionalNestedEnum;
-- (BOOL) hasOptionalForeignEnum;
-- (BOOL) hasOptionalImportEnum;
-- (BOOL) hasOptionalStringPiece;
-- (BOOL) hasOptionalCord;
-- (BOOL) hasDefaultInt32;
-- (BOOL) hasDefaultInt64;
-- (BOOL) hasDefaultUint32;
-- (BOOL) hasDefaultUint64;
-- (BOOL) hasDefaultSint32;
-- (BOOL) hasDefaultSint64;
-- (BOOL) hasDefaultFixed32;
-- (BOOL) hasDefaultFixed64;
-- (BOOL) hasDefaultSfixed32;
-- (BOOL) hasDefaultSfixed64;
-- (BOOL) hasDefaultFloat;
-- (BOOL) hasDefaultDouble;
-- (BOOL) hasDefaultBool;
-- (BOOL) hasDefaultString;
-- (BOOL) hasDefaultBytes;
-- (BOOL) hasDefaultNestedEnum;
-- (BOOL) hasDefaultForeignEnum;
-- (BOOL) hasDefaultImportEnum;
-- (BOOL) hasDefaultStringPiece;
-- (BOOL) hasDefaultCord;
-@property (readonly) int32_t optionalInt32;
-@property (readonly) int64_t optionalInt64;
-@property (readonly) uint32_t optionalUint32;
-@property (readonly) uint64_t optionalUint64;
-@property (readonly) int32_t optionalSint32;
-@property (readonly) int64_t optionalSint64;
-@property (readonly) uint32_t optionalFixed32;
-@property (readonly) uint64_t optionalFixed64;
-@property (readonly) int32_t optionalSfixed32;
-@property (readonly) int64_t optionalSfixed64;
-@property (readonly) Float32 optionalFloat;
-@property (readonly) Float64 optionalDouble;
-- (BOOL) optionalBool;
-@property (readonly, strong) NSString* optionalString;
-@property (readonly, strong) NSData* optionalBytes;
-@property (readonly, strong) TestAllTypes_OptionalGroup* optionalGroup;
-@property (readonly, strong) TestAllTypes_NestedMessage* optionalNestedMessage;
-@property (readonly, strong) ForeignMessage* optionalForeignMessage;
-@property (readonly, strong) ImportMessage* optionalImportMessage;
-@property (readonly) TestAllTypes_NestedEnum optionalNestedEnum;
-@property (readonly) ForeignEnum optionalForeignEnum;
-@property (readonly) ImportEnum optionalImportEnum;
-@property (readonly, strong) NSString* optionalStringPiece;
-@property (readonly, strong) NSString* optionalCord;
-@property (readonly, strong) PBArray * repeatedInt32;
-@property (readonly, strong) PBArray * repeatedInt64;
-@property (readonly, strong) PBArray * repeatedUint32;
-@property (readonly, strong) PBArray * repeatedUint64;
-@property (readonly, strong) PBArray * repeatedSint32;
-@property (readonly, strong) PBArray * repeatedSint64;
-@property (readonly, strong) PBArray * repeatedFixed32;
-@property (readonly, strong) PBArray * repeatedFixed64;
-@property (readonly, strong) PBArray * repeatedSfixed32;
-@property (readonly, strong) PBArray * repeatedSfixed64;
-@property (readonly, strong) PBArray * repeatedFloat;
-@property (readonly, strong) PBArray * repeatedDouble;
-@property (readonly, strong) PBArray * repeatedBool;
-@property (readonly, strong) NSArray * repeatedString;
-@property (readonly, strong) NSArray * repeatedBytes;
-@property (readonly, strong) NSArray * repeatedGroup;
-@property (readonly, strong) NSArray * repeatedNestedMessage;
-@property (readonly, strong) NSArray * repeatedForeignMessage;
-@property (readonly, strong) NSArray * repeatedImportMessage;
-@property (readonly, strong) PBArray * repeatedNestedEnum;
-@property (readonly, strong) PBArray * repeatedForeignEnum;
-@property (readonly, strong) PBArray * repeatedImportEnum;
-@property (readonly, strong) NSArray * repeatedStringPiece;
-@property (readonly, strong) NSArray * repeatedCord;
-@property (readonly) int32_t defaultInt32;
-@property (readonly) int64_t defaultInt64;
-@property (readonly) uint32_t defaultUint32;
-@property (readonly) uint64_t defaultUint64;
-@property (readonly) int32_t defaultSint32;
-@property (readonly) int64_t defaultSint64;
-@property (readonly) uint32_t defaultFixed32;
-@property (readonly) uint64_t defaultFixed64;
-@property (readonly) int32_t defaultSfixed32;
-@property (readonly) int64_t defaultSfixed64;
-@property (readonly) Float32 defaultFloat;
-@property (readonly) Float64 defaultDouble;
-- (BOOL) defaultBool;
-@property (readonly, strong) NSString* defaultString;
-@property (readonly, strong) NSData* defaultBytes;
-@property (readonly) TestAllTypes_NestedEnum defaultNestedEnum;
-@property (readonly) ForeignEnum defaultForeignEnum;
-@property (readonly) ImportEnum defaultImportEnum;
-@property (readonly, strong) NSString* defaultStringPiece;
-@property (readonly, strong) NSString* defaultCord;
+@interface TestAllTypes : PBGeneratedMessage
+- (BOOL)hasOptionalInt32;
+- (BOOL)hasOptionalInt64;
+- (BOOL)hasOptionalUint32;
+- (BOOL)hasOptionalUint64;
+- (BOOL)hasOptionalSint32;
+- (BOOL)hasOptionalSint64;
+- (BOOL)hasOptionalFixed32;
+- (BOOL)hasOptionalFixed64;
+- (BOOL)hasOptionalSfixed32;
+- (BOOL)hasOptionalSfixed64;
+- (BOOL)hasOptionalFloat;
+- (BOOL)hasOptionalDouble;
+- (BOOL)hasOptionalBool;
+- (BOOL)hasOptionalString;
+- (BOOL)hasOptionalBytes;
+- (BOOL)hasOptionalGroup;
+- (BOOL)hasOptionalNestedMessage;
+- (BOOL)hasOptionalForeignMessage;
+- (BOOL)hasOptionalImportMessage;
+- (BOOL)hasOptionalNestedEnum;
+- (BOOL)hasOptionalForeignEnum;
+- (BOOL)hasOptionalImportEnum;
+- (BOOL)hasOptionalStringPiece;
+- (BOOL)hasOptionalCord;
+- (BOOL)hasDefaultInt32;
+- (BOOL)hasDefaultInt64;
+- (BOOL)hasDefaultUint32;
+- (BOOL)hasDefaultUint64;
+- (BOOL)hasDefaultSint32;
+- (BOOL)hasDefaultSint64;
+- (BOOL)hasDefaultFixed32;
+- (BOOL)hasDefaultFixed64;
+- (BOOL)hasDefaultSfixed32;
+- (BOOL)hasDefaultSfixed64;
+- (BOOL)hasDefaultFloat;
+- (BOOL)hasDefaultDouble;
+- (BOOL)hasDefaultBool;
+- (BOOL)hasDefaultString;
+- (BOOL)hasDefaultBytes;
+- (BOOL)hasDefaultNestedEnum;
+- (BOOL)hasDefaultForeignEnum;
+- (BOOL)hasDefaultImportEnum;
+- (BOOL)hasDefaultStringPiece;
+- (BOOL)hasDefaultCord;
+@property (nonatomic, readonly) int32_t optionalInt32;
+@property (nonatomic, readonly) int64_t optionalInt64;
+@property (nonatomic, readonly) uint32_t optionalUint32;
+@property (nonatomic, readonly) uint64_t optionalUint64;
+@property (nonatomic, readonly) int32_t optionalSint32;
+@property (nonatomic, readonly) int64_t optionalSint64;
+@property (nonatomic, readonly) uint32_t optionalFixed32;
+@property (nonatomic, readonly) uint64_t optionalFixed64;
+@property (nonatomic, readonly) int32_t optionalSfixed32;
+@property (nonatomic, readonly) int64_t optionalSfixed64;
+@property (nonatomic, readonly) Float32 optionalFloat;
+@property (nonatomic, readonly) Float64 optionalDouble;
+-(BOOL)optionalBool;
+@property (nonatomic, readonly) NSString* optionalString;
+@property (nonatomic, readonly) NSData* optionalBytes;
+@property (nonatomic, readonly) TestAllTypes_OptionalGroup* optionalGroup;
+@property (nonatomic, readonly) TestAllTypes_NestedMessage* optionalNestedMessage;
+@property (nonatomic, readonly) ForeignMessage* optionalForeignMessage;
+@property (nonatomic, readonly) ImportMessage* optionalImportMessage;
+@property (nonatomic, readonly) TestAllTypes_NestedEnum optionalNestedEnum;
+@property (nonatomic, readonly) ForeignEnum optionalForeignEnum;
+@property (nonatomic, readonly) ImportEnum optionalImportEnum;
+@property (nonatomic, readonly) NSString* optionalStringPiece;
+@property (nonatomic, readonly) NSString* optionalCord;
+@property (nonatomic, readonly, nullable) PBArray * repeatedInt32;
+@property (nonatomic, readonly, nullable) PBArray * repeatedInt64;
+@property (nonatomic, readonly, nullable) PBArray * repeatedUint32;
+@property (nonatomic, readonly, nullable) PBArray * repeatedUint64;
+@property (nonatomic, readonly, nullable) PBArray * repeatedSint32;
+@property (nonatomic, readonly, nullable) PBArray * repeatedSint64;
+@property (nonatomic, readonly, nullable) PBArray * repeatedFixed32;
+@property (nonatomic, readonly, nullable) PBArray * repeatedFixed64;
+@property (nonatomic, readonly, nullable) PBArray * repeatedSfixed32;
+@property (nonatomic, readonly, nullable) PBArray * repeatedSfixed64;
+@property (nonatomic, readonly, nullable) PBArray * repeatedFloat;
+@property (nonatomic, readonly, nullable) PBArray * repeatedDouble;
+@property (nonatomic, readonly, nullable) PBArray * repeatedBool;
+@property (nonatomic, readonly, nullable) NSArray<NSString*> * repeatedString;
+@property (nonatomic, readonly, nullable) NSArray<NSData*> * repeatedBytes;
+@property (nonatomic, readonly, nullable) NSArray<TestAllTypes_RepeatedGroup*> * repeatedGroup;
+@property (nonatomic, readonly, nullable) NSArray<TestAllTypes_NestedMessage*> * repeatedNestedMessage;
+@property (nonatomic, readonly, nullable) NSArray<ForeignMessage*> * repeatedForeignMessage;
+@property (nonatomic, readonly, nullable) NSArray<ImportMessage*> * repeatedImportMessage;
+@property (nonatomic, readonly, nullable) PBArray * repeatedNestedEnum;
+@property (nonatomic, readonly, nullable) PBArray * repeatedForeignEnum;
+@property (nonatomic, readonly, nullable) PBArray * repeatedImportEnum;
+@property (nonatomic, readonly, nullable) NSArray<NSString*> * repeatedStringPiece;
+@property (nonatomic, readonly, nullable) NSArray<NSString*> * repeatedCord;
+@property (nonatomic, readonly) int32_t defaultInt32;
+@property (nonatomic, readonly) int64_t defaultInt64;
+@property (nonatomic, readonly) uint32_t defaultUint32;
+@property (nonatomic, readonly) uint64_t defaultUint64;
+@property (nonatomic, readonly) int32_t defaultSint32;
+@property (nonatomic, readonly) int64_t defaultSint64;
+@property (nonatomic, readonly) uint32_t defaultFixed32;
+@property (nonatomic, readonly) uint64_t defaultFixed64;
+@property (nonatomic, readonly) int32_t defaultSfixed32;
+@property (nonatomic, readonly) int64_t defaultSfixed64;
+@property (nonatomic, readonly) Float32 defaultFloat;
+@property (nonatomic, readonly) Float64 defaultDouble;
+-(BOOL)defaultBool;
+@property (nonatomic, readonly) NSString* defaultString;
+@property (nonatomic, readonly) NSData* defaultBytes;
+@property (nonatomic, readonly) TestAllTypes_NestedEnum defaultNestedEnum;
+@property (nonatomic, readonly) ForeignEnum defaultForeignEnum;
+@property (nonatomic, readonly) ImportEnum defaultImportEnum;
+@property (nonatomic, readonly) NSString* defaultStringPiece;
+@property (nonatomic, readonly) NSString* defaultCord;
 - (int32_t)repeatedInt32AtIndex:(NSUInteger)index;
 - (int64_t)repeatedInt64AtIndex:(NSUInteger)index;
 - (uint32_t)repeatedUint32AtIndex:(NSUInteger)index;
@@ -491,1977 +410,1317 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 + (TestAllTypes*) defaultInstance;
 - (TestAllTypes*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
+- (PBMessageDelta*) diffFrom:(TestAllTypes*) other;
 - (TestAllTypes_Builder*) builder;
 + (TestAllTypes_Builder*) builder;
 + (TestAllTypes_Builder*) builderWithPrototype:(TestAllTypes*) prototype;
 - (TestAllTypes_Builder*) toBuilder;
-
-+ (TestAllTypes*) parseFromData:(NSData*) data;
-+ (TestAllTypes*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestAllTypes*) parseFromInputStream:(NSInputStream*) input;
-+ (TestAllTypes*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestAllTypes*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestAllTypes*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestAllTypes_NestedMessage : PBGeneratedMessage {
-@private
-  BOOL hasBb_:1;
-  int32_t bb;
-}
-- (BOOL) hasBb;
-@property (readonly) int32_t bb;
+@interface TestAllTypes_NestedMessage : PBGeneratedMessage
+- (BOOL)hasBb;
+@property (nonatomic, readonly) int32_t bb;
 
 + (TestAllTypes_NestedMessage*) defaultInstance;
 - (TestAllTypes_NestedMessage*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
+- (PBMessageDelta*) diffFrom:(TestAllTypes_NestedMessage*) other;
 - (TestAllTypes_NestedMessage_Builder*) builder;
 + (TestAllTypes_NestedMessage_Builder*) builder;
 + (TestAllTypes_NestedMessage_Builder*) builderWithPrototype:(TestAllTypes_NestedMessage*) prototype;
 - (TestAllTypes_NestedMessage_Builder*) toBuilder;
-
-+ (TestAllTypes_NestedMessage*) parseFromData:(NSData*) data;
-+ (TestAllTypes_NestedMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestAllTypes_NestedMessage*) parseFromInputStream:(NSInputStream*) input;
-+ (TestAllTypes_NestedMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestAllTypes_NestedMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestAllTypes_NestedMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestAllTypes_NestedMessage_Builder : PBGeneratedMessage_Builder {
-@private
-  TestAllTypes_NestedMessage* result;
-}
-
+@interface TestAllTypes_NestedMessage_Builder : PBGeneratedMessage_Builder
 - (TestAllTypes_NestedMessage*) defaultInstance;
 
-- (TestAllTypes_NestedMessage_Builder*) clear;
-- (TestAllTypes_NestedMessage_Builder*) clone;
-
 - (TestAllTypes_NestedMessage*) build;
 - (TestAllTypes_NestedMessage*) buildPartial;
 
 - (TestAllTypes_NestedMessage_Builder*) mergeFrom:(TestAllTypes_NestedMessage*) other;
-- (TestAllTypes_NestedMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestAllTypes_NestedMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+- (TestAllTypes_NestedMessage_Builder*) applyDelta:(PBMessageDelta*) delta;
 
-- (BOOL) hasBb;
 - (int32_t) bb;
+- (BOOL)hasBb;
+- (TestAllTypes_NestedMessage_Builder*)clearBb;
 - (TestAllTypes_NestedMessage_Builder*) setBb:(int32_t) value;
-- (TestAllTypes_NestedMessage_Builder*) clearBb;
 @end
 
-@interface TestAllTypes_OptionalGroup : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
-  int32_t a;
-}
-- (BOOL) hasA;
-@property (readonly) int32_t a;
+@interface TestAllTypes_OptionalGroup : PBGeneratedMessage
+- (BOOL)hasA;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestAllTypes_OptionalGroup*) defaultInstance;
 - (TestAllTypes_OptionalGroup*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestAllTypes_OptionalGroup_Builder*) builder;
 + (TestAllTypes_OptionalGroup_Builder*) builder;
 + (TestAllTypes_OptionalGroup_Builder*) builderWithPrototype:(TestAllTypes_OptionalGroup*) prototype;
 - (TestAllTypes_OptionalGroup_Builder*) toBuilder;
-
-+ (TestAllTypes_OptionalGroup*) parseFromData:(NSData*) data;
-+ (TestAllTypes_OptionalGroup*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestAllTypes_OptionalGroup*) parseFromInputStream:(NSInputStream*) input;
-+ (TestAllTypes_OptionalGroup*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestAllTypes_OptionalGroup*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestAllTypes_OptionalGroup*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestAllTypes_OptionalGroup_Builder : PBGeneratedMessage_Builder {
-@private
-  TestAllTypes_OptionalGroup* result;
-}
-
+@interface TestAllTypes_OptionalGroup_Builder : PBGeneratedMessage_Builder
 - (TestAllTypes_OptionalGroup*) defaultInstance;
 
-- (TestAllTypes_OptionalGroup_Builder*) clear;
-- (TestAllTypes_OptionalGroup_Builder*) clone;
-
 - (TestAllTypes_OptionalGroup*) build;
 - (TestAllTypes_OptionalGroup*) buildPartial;
 
 - (TestAllTypes_OptionalGroup_Builder*) mergeFrom:(TestAllTypes_OptionalGroup*) other;
-- (TestAllTypes_OptionalGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestAllTypes_OptionalGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (int32_t) a;
+- (BOOL)hasA;
+- (TestAllTypes_OptionalGroup_Builder*)clearA;
 - (TestAllTypes_OptionalGroup_Builder*) setA:(int32_t) value;
-- (TestAllTypes_OptionalGroup_Builder*) clearA;
 @end
 
-@interface TestAllTypes_RepeatedGroup : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
-  int32_t a;
-}
-- (BOOL) hasA;
-@property (readonly) int32_t a;
+@interface TestAllTypes_RepeatedGroup : PBGeneratedMessage
+- (BOOL)hasA;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestAllTypes_RepeatedGroup*) defaultInstance;
 - (TestAllTypes_RepeatedGroup*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestAllTypes_RepeatedGroup_Builder*) builder;
 + (TestAllTypes_RepeatedGroup_Builder*) builder;
 + (TestAllTypes_RepeatedGroup_Builder*) builderWithPrototype:(TestAllTypes_RepeatedGroup*) prototype;
 - (TestAllTypes_RepeatedGroup_Builder*) toBuilder;
-
-+ (TestAllTypes_RepeatedGroup*) parseFromData:(NSData*) data;
-+ (TestAllTypes_RepeatedGroup*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestAllTypes_RepeatedGroup*) parseFromInputStream:(NSInputStream*) input;
-+ (TestAllTypes_RepeatedGroup*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestAllTypes_RepeatedGroup*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestAllTypes_RepeatedGroup*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestAllTypes_RepeatedGroup_Builder : PBGeneratedMessage_Builder {
-@private
-  TestAllTypes_RepeatedGroup* result;
-}
-
+@interface TestAllTypes_RepeatedGroup_Builder : PBGeneratedMessage_Builder
 - (TestAllTypes_RepeatedGroup*) defaultInstance;
 
-- (TestAllTypes_RepeatedGroup_Builder*) clear;
-- (TestAllTypes_RepeatedGroup_Builder*) clone;
-
 - (TestAllTypes_RepeatedGroup*) build;
 - (TestAllTypes_RepeatedGroup*) buildPartial;
 
 - (TestAllTypes_RepeatedGroup_Builder*) mergeFrom:(TestAllTypes_RepeatedGroup*) other;
-- (TestAllTypes_RepeatedGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestAllTypes_RepeatedGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (int32_t) a;
+- (BOOL)hasA;
+- (TestAllTypes_RepeatedGroup_Builder*)clearA;
 - (TestAllTypes_RepeatedGroup_Builder*) setA:(int32_t) value;
-- (TestAllTypes_RepeatedGroup_Builder*) clearA;
 @end
 
-@interface TestAllTypes_Builder : PBGeneratedMessage_Builder {
-@private
-  TestAllTypes* result;
-}
-
+@interface TestAllTypes_Builder : PBGeneratedMessage_Builder
 - (TestAllTypes*) defaultInstance;
 
-- (TestAllTypes_Builder*) clear;
-- (TestAllTypes_Builder*) clone;
-
 - (TestAllTypes*) build;
 - (TestAllTypes*) buildPartial;
 
 - (TestAllTypes_Builder*) mergeFrom:(TestAllTypes*) other;
-- (TestAllTypes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestAllTypes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
+- (TestAllTypes_Builder*) applyDelta:(PBMessageDelta*) delta;
 
-- (BOOL) hasOptionalInt32;
 - (int32_t) optionalInt32;
+- (BOOL)hasOptionalInt32;
+- (TestAllTypes_Builder*)clearOptionalInt32;
 - (TestAllTypes_Builder*) setOptionalInt32:(int32_t) value;
-- (TestAllTypes_Builder*) clearOptionalInt32;
 
-- (BOOL) hasOptionalInt64;
 - (int64_t) optionalInt64;
+- (BOOL)hasOptionalInt64;
+- (TestAllTypes_Builder*)clearOptionalInt64;
 - (TestAllTypes_Builder*) setOptionalInt64:(int64_t) value;
-- (TestAllTypes_Builder*) clearOptionalInt64;
 
-- (BOOL) hasOptionalUint32;
 - (uint32_t) optionalUint32;
+- (BOOL)hasOptionalUint32;
+- (TestAllTypes_Builder*)clearOptionalUint32;
 - (TestAllTypes_Builder*) setOptionalUint32:(uint32_t) value;
-- (TestAllTypes_Builder*) clearOptionalUint32;
 
-- (BOOL) hasOptionalUint64;
 - (uint64_t) optionalUint64;
+- (BOOL)hasOptionalUint64;
+- (TestAllTypes_Builder*)clearOptionalUint64;
 - (TestAllTypes_Builder*) setOptionalUint64:(uint64_t) value;
-- (TestAllTypes_Builder*) clearOptionalUint64;
 
-- (BOOL) hasOptionalSint32;
 - (int32_t) optionalSint32;
+- (BOOL)hasOptionalSint32;
+- (TestAllTypes_Builder*)clearOptionalSint32;
 - (TestAllTypes_Builder*) setOptionalSint32:(int32_t) value;
-- (TestAllTypes_Builder*) clearOptionalSint32;
 
-- (BOOL) hasOptionalSint64;
 - (int64_t) optionalSint64;
+- (BOOL)hasOptionalSint64;
+- (TestAllTypes_Builder*)clearOptionalSint64;
 - (TestAllTypes_Builder*) setOptionalSint64:(int64_t) value;
-- (TestAllTypes_Builder*) clearOptionalSint64;
 
-- (BOOL) hasOptionalFixed32;
 - (uint32_t) optionalFixed32;
+- (BOOL)hasOptionalFixed32;
+- (TestAllTypes_Builder*)clearOptionalFixed32;
 - (TestAllTypes_Builder*) setOptionalFixed32:(uint32_t) value;
-- (TestAllTypes_Builder*) clearOptionalFixed32;
 
-- (BOOL) hasOptionalFixed64;
 - (uint64_t) optionalFixed64;
+- (BOOL)hasOptionalFixed64;
+- (TestAllTypes_Builder*)clearOptionalFixed64;
 - (TestAllTypes_Builder*) setOptionalFixed64:(uint64_t) value;
-- (TestAllTypes_Builder*) clearOptionalFixed64;
 
-- (BOOL) hasOptionalSfixed32;
 - (int32_t) optionalSfixed32;
+- (BOOL)hasOptionalSfixed32;
+- (TestAllTypes_Builder*)clearOptionalSfixed32;
 - (TestAllTypes_Builder*) setOptionalSfixed32:(int32_t) value;
-- (TestAllTypes_Builder*) clearOptionalSfixed32;
 
-- (BOOL) hasOptionalSfixed64;
 - (int64_t) optionalSfixed64;
+- (BOOL)hasOptionalSfixed64;
+- (TestAllTypes_Builder*)clearOptionalSfixed64;
 - (TestAllTypes_Builder*) setOptionalSfixed64:(int64_t) value;
-- (TestAllTypes_Builder*) clearOptionalSfixed64;
 
-- (BOOL) hasOptionalFloat;
 - (Float32) optionalFloat;
+- (BOOL)hasOptionalFloat;
+- (TestAllTypes_Builder*)clearOptionalFloat;
 - (TestAllTypes_Builder*) setOptionalFloat:(Float32) value;
-- (TestAllTypes_Builder*) clearOptionalFloat;
 
-- (BOOL) hasOptionalDouble;
 - (Float64) optionalDouble;
+- (BOOL)hasOptionalDouble;
+- (TestAllTypes_Builder*)clearOptionalDouble;
 - (TestAllTypes_Builder*) setOptionalDouble:(Float64) value;
-- (TestAllTypes_Builder*) clearOptionalDouble;
 
-- (BOOL) hasOptionalBool;
 - (BOOL) optionalBool;
+- (BOOL)hasOptionalBool;
+- (TestAllTypes_Builder*)clearOptionalBool;
 - (TestAllTypes_Builder*) setOptionalBool:(BOOL) value;
-- (TestAllTypes_Builder*) clearOptionalBool;
 
-- (BOOL) hasOptionalString;
 - (NSString*) optionalString;
+- (BOOL)hasOptionalString;
+- (TestAllTypes_Builder*)clearOptionalString;
 - (TestAllTypes_Builder*) setOptionalString:(NSString*) value;
-- (TestAllTypes_Builder*) clearOptionalString;
 
-- (BOOL) hasOptionalBytes;
 - (NSData*) optionalBytes;
+- (BOOL)hasOptionalBytes;
+- (TestAllTypes_Builder*)clearOptionalBytes;
 - (TestAllTypes_Builder*) setOptionalBytes:(NSData*) value;
-- (TestAllTypes_Builder*) clearOptionalBytes;
 
-- (BOOL) hasOptionalGroup;
 - (TestAllTypes_OptionalGroup*) optionalGroup;
+- (BOOL)hasOptionalGroup;
+- (TestAllTypes_Builder*)clearOptionalGroup;
 - (TestAllTypes_Builder*) setOptionalGroup:(TestAllTypes_OptionalGroup*) value;
 - (TestAllTypes_Builder*) setOptionalGroupBuilder:(TestAllTypes_OptionalGroup_Builder*) builderForValue;
 - (TestAllTypes_Builder*) mergeOptionalGroup:(TestAllTypes_OptionalGroup*) value;
-- (TestAllTypes_Builder*) clearOptionalGroup;
 
-- (BOOL) hasOptionalNestedMessage;
 - (TestAllTypes_NestedMessage*) optionalNestedMessage;
+- (BOOL)hasOptionalNestedMessage;
+- (TestAllTypes_Builder*)clearOptionalNestedMessage;
 - (TestAllTypes_Builder*) setOptionalNestedMessage:(TestAllTypes_NestedMessage*) value;
 - (TestAllTypes_Builder*) setOptionalNestedMessageBuilder:(TestAllTypes_NestedMessage_Builder*) builderForValue;
 - (TestAllTypes_Builder*) mergeOptionalNestedMessage:(TestAllTypes_NestedMessage*) value;
-- (TestAllTypes_Builder*) clearOptionalNestedMessage;
 
-- (BOOL) hasOptionalForeignMessage;
 - (ForeignMessage*) optionalForeignMessage;
+- (BOOL)hasOptionalForeignMessage;
+- (TestAllTypes_Builder*)clearOptionalForeignMessage;
 - (TestAllTypes_Builder*) setOptionalForeignMessage:(ForeignMessage*) value;
 - (TestAllTypes_Builder*) setOptionalForeignMessageBuilder:(ForeignMessage_Builder*) builderForValue;
 - (TestAllTypes_Builder*) mergeOptionalForeignMessage:(ForeignMessage*) value;
-- (TestAllTypes_Builder*) clearOptionalForeignMessage;
 
-- (BOOL) hasOptionalImportMessage;
 - (ImportMessage*) optionalImportMessage;
+- (BOOL)hasOptionalImportMessage;
+- (TestAllTypes_Builder*)clearOptionalImportMessage;
 - (TestAllTypes_Builder*) setOptionalImportMessage:(ImportMessage*) value;
 - (TestAllTypes_Builder*) setOptionalImportMessageBuilder:(ImportMessage_Builder*) builderForValue;
 - (TestAllTypes_Builder*) mergeOptionalImportMessage:(ImportMessage*) value;
-- (TestAllTypes_Builder*) clearOptionalImportMessage;
 
-- (BOOL) hasOptionalNestedEnum;
-- (TestAllTypes_NestedEnum) optionalNestedEnum;
-- (TestAllTypes_Builder*) setOptionalNestedEnum:(TestAllTypes_NestedEnum) value;
-- (TestAllTypes_Builder*) clearOptionalNestedEnum;
+- (TestAllTypes_NestedEnum)optionalNestedEnum;
+- (BOOL)hasOptionalNestedEnum;
+- (TestAllTypes_Builder*)clearOptionalNestedEnum;
+- (TestAllTypes_Builder*)setOptionalNestedEnum:(TestAllTypes_NestedEnum) value;
 
-- (BOOL) hasOptionalForeignEnum;
-- (ForeignEnum) optionalForeignEnum;
-- (TestAllTypes_Builder*) setOptionalForeignEnum:(ForeignEnum) value;
-- (TestAllTypes_Builder*) clearOptionalForeignEnum;
+- (ForeignEnum)optionalForeignEnum;
+- (BOOL)hasOptionalForeignEnum;
+- (TestAllTypes_Builder*)clearOptionalForeignEnum;
+- (TestAllTypes_Builder*)setOptionalForeignEnum:(ForeignEnum) value;
 
-- (BOOL) hasOptionalImportEnum;
-- (ImportEnum) optionalImportEnum;
-- (TestAllTypes_Builder*) setOptionalImportEnum:(ImportEnum) value;
-- (TestAllTypes_Builder*) clearOptionalImportEnum;
+- (ImportEnum)optionalImportEnum;
+- (BOOL)hasOptionalImportEnum;
+- (TestAllTypes_Builder*)clearOptionalImportEnum;
+- (TestAllTypes_Builder*)setOptionalImportEnum:(ImportEnum) value;
 
-- (BOOL) hasOptionalStringPiece;
 - (NSString*) optionalStringPiece;
+- (BOOL)hasOptionalStringPiece;
+- (TestAllTypes_Builder*)clearOptionalStringPiece;
 - (TestAllTypes_Builder*) setOptionalStringPiece:(NSString*) value;
-- (TestAllTypes_Builder*) clearOptionalStringPiece;
 
-- (BOOL) hasOptionalCord;
 - (NSString*) optionalCord;
+- (BOOL)hasOptionalCord;
+- (TestAllTypes_Builder*)clearOptionalCord;
 - (TestAllTypes_Builder*) setOptionalCord:(NSString*) value;
-- (TestAllTypes_Builder*) clearOptionalCord;
 
 - (PBAppendableArray *)repeatedInt32;
-- (int32_t)repeatedInt32AtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedInt32;
 - (TestAllTypes_Builder *)addRepeatedInt32:(int32_t)value;
-- (TestAllTypes_Builder *)setRepeatedInt32Array:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedInt32Values:(const int32_t *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedInt32;
+- (TestAllTypes_Builder *)setRepeatedInt32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedInt32Array(_:));
 
 - (PBAppendableArray *)repeatedInt64;
-- (int64_t)repeatedInt64AtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedInt64;
 - (TestAllTypes_Builder *)addRepeatedInt64:(int64_t)value;
-- (TestAllTypes_Builder *)setRepeatedInt64Array:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedInt64Values:(const int64_t *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedInt64;
+- (TestAllTypes_Builder *)setRepeatedInt64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedInt64Array(_:));
 
 - (PBAppendableArray *)repeatedUint32;
-- (uint32_t)repeatedUint32AtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedUint32;
 - (TestAllTypes_Builder *)addRepeatedUint32:(uint32_t)value;
-- (TestAllTypes_Builder *)setRepeatedUint32Array:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedUint32Values:(const uint32_t *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedUint32;
+- (TestAllTypes_Builder *)setRepeatedUint32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedUint32Array(_:));
 
 - (PBAppendableArray *)repeatedUint64;
-- (uint64_t)repeatedUint64AtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedUint64;
 - (TestAllTypes_Builder *)addRepeatedUint64:(uint64_t)value;
-- (TestAllTypes_Builder *)setRepeatedUint64Array:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedUint64Values:(const uint64_t *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedUint64;
+- (TestAllTypes_Builder *)setRepeatedUint64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedUint64Array(_:));
 
 - (PBAppendableArray *)repeatedSint32;
-- (int32_t)repeatedSint32AtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedSint32;
 - (TestAllTypes_Builder *)addRepeatedSint32:(int32_t)value;
-- (TestAllTypes_Builder *)setRepeatedSint32Array:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedSint32Values:(const int32_t *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedSint32;
+- (TestAllTypes_Builder *)setRepeatedSint32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedSint32Array(_:));
 
 - (PBAppendableArray *)repeatedSint64;
-- (int64_t)repeatedSint64AtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedSint64;
 - (TestAllTypes_Builder *)addRepeatedSint64:(int64_t)value;
-- (TestAllTypes_Builder *)setRepeatedSint64Array:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedSint64Values:(const int64_t *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedSint64;
+- (TestAllTypes_Builder *)setRepeatedSint64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedSint64Array(_:));
 
 - (PBAppendableArray *)repeatedFixed32;
-- (uint32_t)repeatedFixed32AtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedFixed32;
 - (TestAllTypes_Builder *)addRepeatedFixed32:(uint32_t)value;
-- (TestAllTypes_Builder *)setRepeatedFixed32Array:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedFixed32Values:(const uint32_t *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedFixed32;
+- (TestAllTypes_Builder *)setRepeatedFixed32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedFixed32Array(_:));
 
 - (PBAppendableArray *)repeatedFixed64;
-- (uint64_t)repeatedFixed64AtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedFixed64;
 - (TestAllTypes_Builder *)addRepeatedFixed64:(uint64_t)value;
-- (TestAllTypes_Builder *)setRepeatedFixed64Array:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedFixed64Values:(const uint64_t *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedFixed64;
+- (TestAllTypes_Builder *)setRepeatedFixed64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedFixed64Array(_:));
 
 - (PBAppendableArray *)repeatedSfixed32;
-- (int32_t)repeatedSfixed32AtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedSfixed32;
 - (TestAllTypes_Builder *)addRepeatedSfixed32:(int32_t)value;
-- (TestAllTypes_Builder *)setRepeatedSfixed32Array:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedSfixed32Values:(const int32_t *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedSfixed32;
+- (TestAllTypes_Builder *)setRepeatedSfixed32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedSfixed32Array(_:));
 
 - (PBAppendableArray *)repeatedSfixed64;
-- (int64_t)repeatedSfixed64AtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedSfixed64;
 - (TestAllTypes_Builder *)addRepeatedSfixed64:(int64_t)value;
-- (TestAllTypes_Builder *)setRepeatedSfixed64Array:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedSfixed64Values:(const int64_t *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedSfixed64;
+- (TestAllTypes_Builder *)setRepeatedSfixed64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedSfixed64Array(_:));
 
 - (PBAppendableArray *)repeatedFloat;
-- (Float32)repeatedFloatAtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedFloat;
 - (TestAllTypes_Builder *)addRepeatedFloat:(Float32)value;
-- (TestAllTypes_Builder *)setRepeatedFloatArray:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedFloatValues:(const Float32 *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedFloat;
+- (TestAllTypes_Builder *)setRepeatedFloatArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedFloatArray(_:));
 
 - (PBAppendableArray *)repeatedDouble;
-- (Float64)repeatedDoubleAtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedDouble;
 - (TestAllTypes_Builder *)addRepeatedDouble:(Float64)value;
-- (TestAllTypes_Builder *)setRepeatedDoubleArray:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedDoubleValues:(const Float64 *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedDouble;
+- (TestAllTypes_Builder *)setRepeatedDoubleArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedDoubleArray(_:));
 
 - (PBAppendableArray *)repeatedBool;
-- (BOOL)repeatedBoolAtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedBool;
 - (TestAllTypes_Builder *)addRepeatedBool:(BOOL)value;
-- (TestAllTypes_Builder *)setRepeatedBoolArray:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedBoolValues:(const BOOL *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedBool;
+- (TestAllTypes_Builder *)setRepeatedBoolArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedBoolArray(_:));
 
 - (NSMutableArray *)repeatedString;
-- (NSString*)repeatedStringAtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedString;
 - (TestAllTypes_Builder *)addRepeatedString:(NSString*)value;
-- (TestAllTypes_Builder *)setRepeatedStringArray:(NSArray *)array;
-- (TestAllTypes_Builder *)clearRepeatedString;
+- (TestAllTypes_Builder *)setRepeatedStringArray:(NSArray<NSString*> *)array NS_SWIFT_NAME(setRepeatedStringArray(_:));
++ (Class)expectedElementTypeForRepeatedStringArray;
 
 - (NSMutableArray *)repeatedBytes;
-- (NSData*)repeatedBytesAtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedBytes;
 - (TestAllTypes_Builder *)addRepeatedBytes:(NSData*)value;
-- (TestAllTypes_Builder *)setRepeatedBytesArray:(NSArray *)array;
-- (TestAllTypes_Builder *)clearRepeatedBytes;
+- (TestAllTypes_Builder *)setRepeatedBytesArray:(NSArray<NSData*> *)array NS_SWIFT_NAME(setRepeatedBytesArray(_:));
++ (Class)expectedElementTypeForRepeatedBytesArray;
 
 - (NSMutableArray *)repeatedGroup;
-- (TestAllTypes_RepeatedGroup*)repeatedGroupAtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedGroup;
 - (TestAllTypes_Builder *)addRepeatedGroup:(TestAllTypes_RepeatedGroup*)value;
-- (TestAllTypes_Builder *)setRepeatedGroupArray:(NSArray *)array;
-- (TestAllTypes_Builder *)clearRepeatedGroup;
+- (TestAllTypes_Builder *)setRepeatedGroupArray:(NSArray<TestAllTypes_RepeatedGroup*> *)array NS_SWIFT_NAME(setRepeatedGroupArray(_:));
++ (Class)expectedElementTypeForRepeatedGroupArray;
 
 - (NSMutableArray *)repeatedNestedMessage;
-- (TestAllTypes_NestedMessage*)repeatedNestedMessageAtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedNestedMessage;
 - (TestAllTypes_Builder *)addRepeatedNestedMessage:(TestAllTypes_NestedMessage*)value;
-- (TestAllTypes_Builder *)setRepeatedNestedMessageArray:(NSArray *)array;
-- (TestAllTypes_Builder *)clearRepeatedNestedMessage;
+- (TestAllTypes_Builder *)setRepeatedNestedMessageArray:(NSArray<TestAllTypes_NestedMessage*> *)array NS_SWIFT_NAME(setRepeatedNestedMessageArray(_:));
++ (Class)expectedElementTypeForRepeatedNestedMessageArray;
 
 - (NSMutableArray *)repeatedForeignMessage;
-- (ForeignMessage*)repeatedForeignMessageAtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedForeignMessage;
 - (TestAllTypes_Builder *)addRepeatedForeignMessage:(ForeignMessage*)value;
-- (TestAllTypes_Builder *)setRepeatedForeignMessageArray:(NSArray *)array;
-
-- (TestAllTypes_Builder *)clearRepeatedForeignMessage;
+- (TestAllTypes_Builder *)setRepeatedForeignMessageArray:(NSArray<ForeignMessage*> *)array NS_SWIFT_NAME(setRepeatedForeignMessageArray(_:));
++ (Class)expectedElementTypeForRepeatedForeignMessageArray;
 
 - (NSMutableArray *)repeatedImportMessage;
-- (ImportMessage*)repeatedImportMessageAtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedImportMessage;
 - (TestAllTypes_Builder *)addRepeatedImportMessage:(ImportMessage*)value;
-- (TestAllTypes_Builder *)setRepeatedImportMessageArray:(NSArray *)array;
-- (TestAllTypes_Builder *)clearRepeatedImportMessage;
+- (TestAllTypes_Builder *)setRepeatedImportMessageArray:(NSArray<ImportMessage*> *)array NS_SWIFT_NAME(setRepeatedImportMessageArray(_:));
++ (Class)expectedElementTypeForRepeatedImportMessageArray;
 
-- (PBAppendableArray *)repeatedNestedEnum;
-- (TestAllTypes_NestedEnum)repeatedNestedEnumAtIndex:(NSUInteger)index;
+- (PBAppendableArray*)repeatedNestedEnum;
+- (PBAppendableArray*)clearRepeatedNestedEnum;
 - (TestAllTypes_Builder *)addRepeatedNestedEnum:(TestAllTypes_NestedEnum)value;
-- (TestAllTypes_Builder *)setRepeatedNestedEnumArray:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedNestedEnumValues:(const TestAllTypes_NestedEnum *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedNestedEnum;
+- (TestAllTypes_Builder *)setRepeatedNestedEnumArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedNestedEnumArray(_:));
 
-- (PBAppendableArray *)repeatedForeignEnum;
-- (ForeignEnum)repeatedForeignEnumAtIndex:(NSUInteger)index;
+- (PBAppendableArray*)repeatedForeignEnum;
+- (PBAppendableArray*)clearRepeatedForeignEnum;
 - (TestAllTypes_Builder *)addRepeatedForeignEnum:(ForeignEnum)value;
-- (TestAllTypes_Builder *)setRepeatedForeignEnumArray:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedForeignEnumValues:(const ForeignEnum *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedForeignEnum;
+- (TestAllTypes_Builder *)setRepeatedForeignEnumArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedForeignEnumArray(_:));
 
-- (PBAppendableArray *)repeatedImportEnum;
-- (ImportEnum)repeatedImportEnumAtIndex:(NSUInteger)index;
+- (PBAppendableArray*)repeatedImportEnum;
+- (PBAppendableArray*)clearRepeatedImportEnum;
 - (TestAllTypes_Builder *)addRepeatedImportEnum:(ImportEnum)value;
-- (TestAllTypes_Builder *)setRepeatedImportEnumArray:(NSArray *)array;
-- (TestAllTypes_Builder *)setRepeatedImportEnumValues:(const ImportEnum *)values count:(NSUInteger)count;
-- (TestAllTypes_Builder *)clearRepeatedImportEnum;
+- (TestAllTypes_Builder *)setRepeatedImportEnumArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedImportEnumArray(_:));
 
 - (NSMutableArray *)repeatedStringPiece;
-- (NSString*)repeatedStringPieceAtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedStringPiece;
 - (TestAllTypes_Builder *)addRepeatedStringPiece:(NSString*)value;
-- (TestAllTypes_Builder *)setRepeatedStringPieceArray:(NSArray *)array;
-- (TestAllTypes_Builder *)clearRepeatedStringPiece;
+- (TestAllTypes_Builder *)setRepeatedStringPieceArray:(NSArray<NSString*> *)array NS_SWIFT_NAME(setRepeatedStringPieceArray(_:));
++ (Class)expectedElementTypeForRepeatedStringPieceArray;
 
 - (NSMutableArray *)repeatedCord;
-- (NSString*)repeatedCordAtIndex:(NSUInteger)index;
+- (TestAllTypes_Builder*)clearRepeatedCord;
 - (TestAllTypes_Builder *)addRepeatedCord:(NSString*)value;
-- (TestAllTypes_Builder *)setRepeatedCordArray:(NSArray *)array;
-- (TestAllTypes_Builder *)clearRepeatedCord;
+- (TestAllTypes_Builder *)setRepeatedCordArray:(NSArray<NSString*> *)array NS_SWIFT_NAME(setRepeatedCordArray(_:));
++ (Class)expectedElementTypeForRepeatedCordArray;
 
-- (BOOL) hasDefaultInt32;
 - (int32_t) defaultInt32;
+- (BOOL)hasDefaultInt32;
+- (TestAllTypes_Builder*)clearDefaultInt32;
 - (TestAllTypes_Builder*) setDefaultInt32:(int32_t) value;
-- (TestAllTypes_Builder*) clearDefaultInt32;
 
-- (BOOL) hasDefaultInt64;
 - (int64_t) defaultInt64;
+- (BOOL)hasDefaultInt64;
+- (TestAllTypes_Builder*)clearDefaultInt64;
 - (TestAllTypes_Builder*) setDefaultInt64:(int64_t) value;
-- (TestAllTypes_Builder*) clearDefaultInt64;
 
-- (BOOL) hasDefaultUint32;
 - (uint32_t) defaultUint32;
+- (BOOL)hasDefaultUint32;
+- (TestAllTypes_Builder*)clearDefaultUint32;
 - (TestAllTypes_Builder*) setDefaultUint32:(uint32_t) value;
-- (TestAllTypes_Builder*) clearDefaultUint32;
 
-- (BOOL) hasDefaultUint64;
 - (uint64_t) defaultUint64;
+- (BOOL)hasDefaultUint64;
+- (TestAllTypes_Builder*)clearDefaultUint64;
 - (TestAllTypes_Builder*) setDefaultUint64:(uint64_t) value;
-- (TestAllTypes_Builder*) clearDefaultUint64;
 
-- (BOOL) hasDefaultSint32;
 - (int32_t) defaultSint32;
+- (BOOL)hasDefaultSint32;
+- (TestAllTypes_Builder*)clearDefaultSint32;
 - (TestAllTypes_Builder*) setDefaultSint32:(int32_t) value;
-- (TestAllTypes_Builder*) clearDefaultSint32;
 
-- (BOOL) hasDefaultSint64;
 - (int64_t) defaultSint64;
+- (BOOL)hasDefaultSint64;
+- (TestAllTypes_Builder*)clearDefaultSint64;
 - (TestAllTypes_Builder*) setDefaultSint64:(int64_t) value;
-- (TestAllTypes_Builder*) clearDefaultSint64;
 
-- (BOOL) hasDefaultFixed32;
 - (uint32_t) defaultFixed32;
+- (BOOL)hasDefaultFixed32;
+- (TestAllTypes_Builder*)clearDefaultFixed32;
 - (TestAllTypes_Builder*) setDefaultFixed32:(uint32_t) value;
-- (TestAllTypes_Builder*) clearDefaultFixed32;
 
-- (BOOL) hasDefaultFixed64;
 - (uint64_t) defaultFixed64;
+- (BOOL)hasDefaultFixed64;
+- (TestAllTypes_Builder*)clearDefaultFixed64;
 - (TestAllTypes_Builder*) setDefaultFixed64:(uint64_t) value;
-- (TestAllTypes_Builder*) clearDefaultFixed64;
 
-- (BOOL) hasDefaultSfixed32;
 - (int32_t) defaultSfixed32;
+- (BOOL)hasDefaultSfixed32;
+- (TestAllTypes_Builder*)clearDefaultSfixed32;
 - (TestAllTypes_Builder*) setDefaultSfixed32:(int32_t) value;
-- (TestAllTypes_Builder*) clearDefaultSfixed32;
 
-- (BOOL) hasDefaultSfixed64;
 - (int64_t) defaultSfixed64;
+- (BOOL)hasDefaultSfixed64;
+- (TestAllTypes_Builder*)clearDefaultSfixed64;
 - (TestAllTypes_Builder*) setDefaultSfixed64:(int64_t) value;
-- (TestAllTypes_Builder*) clearDefaultSfixed64;
 
-- (BOOL) hasDefaultFloat;
 - (Float32) defaultFloat;
+- (BOOL)hasDefaultFloat;
+- (TestAllTypes_Builder*)clearDefaultFloat;
 - (TestAllTypes_Builder*) setDefaultFloat:(Float32) value;
-- (TestAllTypes_Builder*) clearDefaultFloat;
 
-- (BOOL) hasDefaultDouble;
 - (Float64) defaultDouble;
+- (BOOL)hasDefaultDouble;
+- (TestAllTypes_Builder*)clearDefaultDouble;
 - (TestAllTypes_Builder*) setDefaultDouble:(Float64) value;
-- (TestAllTypes_Builder*) clearDefaultDouble;
 
-- (BOOL) hasDefaultBool;
 - (BOOL) defaultBool;
+- (BOOL)hasDefaultBool;
+- (TestAllTypes_Builder*)clearDefaultBool;
 - (TestAllTypes_Builder*) setDefaultBool:(BOOL) value;
-- (TestAllTypes_Builder*) clearDefaultBool;
 
-- (BOOL) hasDefaultString;
 - (NSString*) defaultString;
+- (BOOL)hasDefaultString;
+- (TestAllTypes_Builder*)clearDefaultString;
 - (TestAllTypes_Builder*) setDefaultString:(NSString*) value;
-- (TestAllTypes_Builder*) clearDefaultString;
 
-- (BOOL) hasDefaultBytes;
 - (NSData*) defaultBytes;
+- (BOOL)hasDefaultBytes;
+- (TestAllTypes_Builder*)clearDefaultBytes;
 - (TestAllTypes_Builder*) setDefaultBytes:(NSData*) value;
-- (TestAllTypes_Builder*) clearDefaultBytes;
 
-- (BOOL) hasDefaultNestedEnum;
-- (TestAllTypes_NestedEnum) defaultNestedEnum;
-- (TestAllTypes_Builder*) setDefaultNestedEnum:(TestAllTypes_NestedEnum) value;
-- (TestAllTypes_Builder*) clearDefaultNestedEnum;
+- (TestAllTypes_NestedEnum)defaultNestedEnum;
+- (BOOL)hasDefaultNestedEnum;
+- (TestAllTypes_Builder*)clearDefaultNestedEnum;
+- (TestAllTypes_Builder*)setDefaultNestedEnum:(TestAllTypes_NestedEnum) value;
 
-- (BOOL) hasDefaultForeignEnum;
-- (ForeignEnum) defaultForeignEnum;
-- (TestAllTypes_Builder*) setDefaultForeignEnum:(ForeignEnum) value;
-- (TestAllTypes_Builder*) clearDefaultForeignEnum;
+- (ForeignEnum)defaultForeignEnum;
+- (BOOL)hasDefaultForeignEnum;
+- (TestAllTypes_Builder*)clearDefaultForeignEnum;
+- (TestAllTypes_Builder*)setDefaultForeignEnum:(ForeignEnum) value;
 
-- (BOOL) hasDefaultImportEnum;
-- (ImportEnum) defaultImportEnum;
-- (TestAllTypes_Builder*) setDefaultImportEnum:(ImportEnum) value;
-- (TestAllTypes_Builder*) clearDefaultImportEnum;
+- (ImportEnum)defaultImportEnum;
+- (BOOL)hasDefaultImportEnum;
+- (TestAllTypes_Builder*)clearDefaultImportEnum;
+- (TestAllTypes_Builder*)setDefaultImportEnum:(ImportEnum) value;
 
-- (BOOL) hasDefaultStringPiece;
 - (NSString*) defaultStringPiece;
+- (BOOL)hasDefaultStringPiece;
+- (TestAllTypes_Builder*)clearDefaultStringPiece;
 - (TestAllTypes_Builder*) setDefaultStringPiece:(NSString*) value;
-- (TestAllTypes_Builder*) clearDefaultStringPiece;
 
-- (BOOL) hasDefaultCord;
 - (NSString*) defaultCord;
+- (BOOL)hasDefaultCord;
+- (TestAllTypes_Builder*)clearDefaultCord;
 - (TestAllTypes_Builder*) setDefaultCord:(NSString*) value;
-- (TestAllTypes_Builder*) clearDefaultCord;
 @end
 
-@interface TestDeprecatedFields : PBGeneratedMessage {
-@private
-  BOOL hasDeprecatedInt32_:1;
-  int32_t deprecatedInt32;
-}
-- (BOOL) hasDeprecatedInt32;
-@property (readonly) int32_t deprecatedInt32;
+@interface TestDeprecatedFields : PBGeneratedMessage
+- (BOOL)hasDeprecatedInt32;
+@property (nonatomic, readonly) int32_t deprecatedInt32;
 
 + (TestDeprecatedFields*) defaultInstance;
 - (TestDeprecatedFields*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestDeprecatedFields_Builder*) builder;
 + (TestDeprecatedFields_Builder*) builder;
 + (TestDeprecatedFields_Builder*) builderWithPrototype:(TestDeprecatedFields*) prototype;
 - (TestDeprecatedFields_Builder*) toBuilder;
-
-+ (TestDeprecatedFields*) parseFromData:(NSData*) data;
-+ (TestDeprecatedFields*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDeprecatedFields*) parseFromInputStream:(NSInputStream*) input;
-+ (TestDeprecatedFields*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDeprecatedFields*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestDeprecatedFields*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestDeprecatedFields_Builder : PBGeneratedMessage_Builder {
-@private
-  TestDeprecatedFields* result;
-}
-
+@interface TestDeprecatedFields_Builder : PBGeneratedMessage_Builder
 - (TestDeprecatedFields*) defaultInstance;
 
-- (TestDeprecatedFields_Builder*) clear;
-- (TestDeprecatedFields_Builder*) clone;
-
 - (TestDeprecatedFields*) build;
 - (TestDeprecatedFields*) buildPartial;
 
 - (TestDeprecatedFields_Builder*) mergeFrom:(TestDeprecatedFields*) other;
-- (TestDeprecatedFields_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestDeprecatedFields_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasDeprecatedInt32;
 - (int32_t) deprecatedInt32;
+- (BOOL)hasDeprecatedInt32;
+- (TestDeprecatedFields_Builder*)clearDeprecatedInt32;
 - (TestDeprecatedFields_Builder*) setDeprecatedInt32:(int32_t) value;
-- (TestDeprecatedFields_Builder*) clearDeprecatedInt32;
 @end
 
-@interface ForeignMessage : PBGeneratedMessage {
-@private
-  BOOL hasC_:1;
-  int32_t c;
-}
-- (BOOL) hasC;
-@property (readonly) int32_t c;
+@interface ForeignMessage : PBGeneratedMessage
+- (BOOL)hasC;
+@property (nonatomic, readonly) int32_t c;
 
 + (ForeignMessage*) defaultInstance;
 - (ForeignMessage*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (ForeignMessage_Builder*) builder;
 + (ForeignMessage_Builder*) builder;
 + (ForeignMessage_Builder*) builderWithPrototype:(ForeignMessage*) prototype;
 - (ForeignMessage_Builder*) toBuilder;
-
-+ (ForeignMessage*) parseFromData:(NSData*) data;
-+ (ForeignMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ForeignMessage*) parseFromInputStream:(NSInputStream*) input;
-+ (ForeignMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ForeignMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (ForeignMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface ForeignMessage_Builder : PBGeneratedMessage_Builder {
-@private
-  ForeignMessage* result;
-}
-
+@interface ForeignMessage_Builder : PBGeneratedMessage_Builder
 - (ForeignMessage*) defaultInstance;
 
-- (ForeignMessage_Builder*) clear;
-- (ForeignMessage_Builder*) clone;
-
 - (ForeignMessage*) build;
 - (ForeignMessage*) buildPartial;
 
 - (ForeignMessage_Builder*) mergeFrom:(ForeignMessage*) other;
-- (ForeignMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (ForeignMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasC;
 - (int32_t) c;
+- (BOOL)hasC;
+- (ForeignMessage_Builder*)clearC;
 - (ForeignMessage_Builder*) setC:(int32_t) value;
-- (ForeignMessage_Builder*) clearC;
 @end
 
-@interface TestAllExtensions : PBExtendableMessage {
-@private
-}
+@interface TestAllExtensions : PBExtendableMessage
 
 + (TestAllExtensions*) defaultInstance;
 - (TestAllExtensions*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestAllExtensions_Builder*) builder;
 + (TestAllExtensions_Builder*) builder;
 + (TestAllExtensions_Builder*) builderWithPrototype:(TestAllExtensions*) prototype;
 - (TestAllExtensions_Builder*) toBuilder;
-
-+ (TestAllExtensions*) parseFromData:(NSData*) data;
-+ (TestAllExtensions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestAllExtensions*) parseFromInputStream:(NSInputStream*) input;
-+ (TestAllExtensions*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestAllExtensions*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestAllExtensions*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestAllExtensions_Builder : PBExtendableMessage_Builder {
-@private
-  TestAllExtensions* result;
-}
+@interface TestAllExtensions_Builder : PBExtendableMessage_Builder
 
 - (TestAllExtensions*) defaultInstance;
 
-- (TestAllExtensions_Builder*) clear;
-- (TestAllExtensions_Builder*) clone;
-
 - (TestAllExtensions*) build;
 - (TestAllExtensions*) buildPartial;
 
 - (TestAllExtensions_Builder*) mergeFrom:(TestAllExtensions*) other;
-- (TestAllExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestAllExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface OptionalGroup_extension : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
-  int32_t a;
-}
-- (BOOL) hasA;
-@property (readonly) int32_t a;
+@interface OptionalGroup_extension : PBGeneratedMessage
+- (BOOL)hasA;
+@property (nonatomic, readonly) int32_t a;
 
 + (OptionalGroup_extension*) defaultInstance;
 - (OptionalGroup_extension*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (OptionalGroup_extension_Builder*) builder;
 + (OptionalGroup_extension_Builder*) builder;
 + (OptionalGroup_extension_Builder*) builderWithPrototype:(OptionalGroup_extension*) prototype;
 - (OptionalGroup_extension_Builder*) toBuilder;
-
-+ (OptionalGroup_extension*) parseFromData:(NSData*) data;
-+ (OptionalGroup_extension*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (OptionalGroup_extension*) parseFromInputStream:(NSInputStream*) input;
-+ (OptionalGroup_extension*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (OptionalGroup_extension*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (OptionalGroup_extension*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface OptionalGroup_extension_Builder : PBGeneratedMessage_Builder {
-@private
-  OptionalGroup_extension* result;
-}
-
+@interface OptionalGroup_extension_Builder : PBGeneratedMessage_Builder
 - (OptionalGroup_extension*) defaultInstance;
 
-- (OptionalGroup_extension_Builder*) clear;
-- (OptionalGroup_extension_Builder*) clone;
-
 - (OptionalGroup_extension*) build;
 - (OptionalGroup_extension*) buildPartial;
 
 - (OptionalGroup_extension_Builder*) mergeFrom:(OptionalGroup_extension*) other;
-- (OptionalGroup_extension_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (OptionalGroup_extension_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (int32_t) a;
+- (BOOL)hasA;
+- (OptionalGroup_extension_Builder*)clearA;
 - (OptionalGroup_extension_Builder*) setA:(int32_t) value;
-- (OptionalGroup_extension_Builder*) clearA;
 @end
 
-@interface RepeatedGroup_extension : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
-  int32_t a;
-}
-- (BOOL) hasA;
-@property (readonly) int32_t a;
+@interface RepeatedGroup_extension : PBGeneratedMessage
+- (BOOL)hasA;
+@property (nonatomic, readonly) int32_t a;
 
 + (RepeatedGroup_extension*) defaultInstance;
 - (RepeatedGroup_extension*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (RepeatedGroup_extension_Builder*) builder;
 + (RepeatedGroup_extension_Builder*) builder;
 + (RepeatedGroup_extension_Builder*) builderWithPrototype:(RepeatedGroup_extension*) prototype;
 - (RepeatedGroup_extension_Builder*) toBuilder;
-
-+ (RepeatedGroup_extension*) parseFromData:(NSData*) data;
-+ (RepeatedGroup_extension*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (RepeatedGroup_extension*) parseFromInputStream:(NSInputStream*) input;
-+ (RepeatedGroup_extension*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (RepeatedGroup_extension*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (RepeatedGroup_extension*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface RepeatedGroup_extension_Builder : PBGeneratedMessage_Builder {
-@private
-  RepeatedGroup_extension* result;
-}
-
+@interface RepeatedGroup_extension_Builder : PBGeneratedMessage_Builder
 - (RepeatedGroup_extension*) defaultInstance;
 
-- (RepeatedGroup_extension_Builder*) clear;
-- (RepeatedGroup_extension_Builder*) clone;
-
 - (RepeatedGroup_extension*) build;
 - (RepeatedGroup_extension*) buildPartial;
 
 - (RepeatedGroup_extension_Builder*) mergeFrom:(RepeatedGroup_extension*) other;
-- (RepeatedGroup_extension_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (RepeatedGroup_extension_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (int32_t) a;
+- (BOOL)hasA;
+- (RepeatedGroup_extension_Builder*)clearA;
 - (RepeatedGroup_extension_Builder*) setA:(int32_t) value;
-- (RepeatedGroup_extension_Builder*) clearA;
 @end
 
-@interface TestNestedExtension : PBGeneratedMessage {
-@private
-}
+@interface TestNestedExtension : PBGeneratedMessage
++ (id<PBExtensionField>) test;
 
 + (TestNestedExtension*) defaultInstance;
 - (TestNestedExtension*) defaultInstance;
 
-+ (id<PBExtensionField>) test;
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestNestedExtension_Builder*) builder;
 + (TestNestedExtension_Builder*) builder;
 + (TestNestedExtension_Builder*) builderWithPrototype:(TestNestedExtension*) prototype;
 - (TestNestedExtension_Builder*) toBuilder;
-
-+ (TestNestedExtension*) parseFromData:(NSData*) data;
-+ (TestNestedExtension*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestNestedExtension*) parseFromInputStream:(NSInputStream*) input;
-+ (TestNestedExtension*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestNestedExtension*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestNestedExtension*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestNestedExtension_Builder : PBGeneratedMessage_Builder {
-@private
-  TestNestedExtension* result;
-}
-
+@interface TestNestedExtension_Builder : PBGeneratedMessage_Builder
 - (TestNestedExtension*) defaultInstance;
 
-- (TestNestedExtension_Builder*) clear;
-- (TestNestedExtension_Builder*) clone;
-
 - (TestNestedExtension*) build;
 - (TestNestedExtension*) buildPartial;
 
 - (TestNestedExtension_Builder*) mergeFrom:(TestNestedExtension*) other;
-- (TestNestedExtension_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestNestedExtension_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-@end
-
-@interface TestRequired : PBGeneratedMessage {
-@private
-  BOOL hasC_:1;
-  BOOL hasDummy32_:1;
-  BOOL hasDummy31_:1;
-  BOOL hasDummy30_:1;
-  BOOL hasDummy29_:1;
-  BOOL hasDummy28_:1;
-  BOOL hasDummy27_:1;
-  BOOL hasDummy26_:1;
-  BOOL hasDummy25_:1;
-  BOOL hasDummy24_:1;
-  BOOL hasDummy23_:1;
-  BOOL hasDummy22_:1;
-  BOOL hasDummy21_:1;
-  BOOL hasDummy20_:1;
-  BOOL hasDummy19_:1;
-  BOOL hasDummy18_:1;
-  BOOL hasA_:1;
-  BOOL hasDummy2_:1;
-  BOOL hasB_:1;
-  BOOL hasDummy4_:1;
-  BOOL hasDummy5_:1;
-  BOOL hasDummy6_:1;
-  BOOL hasDummy7_:1;
-  BOOL hasDummy8_:1;
-  BOOL hasDummy9_:1;
-  BOOL hasDummy10_:1;
-  BOOL hasDummy11_:1;
-  BOOL hasDummy12_:1;
-  BOOL hasDummy13_:1;
-  BOOL hasDummy14_:1;
-  BOOL hasDummy15_:1;
-  BOOL hasDummy16_:1;
-  BOOL hasDummy17_:1;
-  int32_t c;
-  int32_t dummy32;
-  int32_t dummy31;
-  int32_t dummy30;
-  int32_t dummy29;
-  int32_t dummy28;
-  int32_t dummy27;
-  int32_t dummy26;
-  int32_t dummy25;
-  int32_t dummy24;
-  int32_t dummy23;
-  int32_t dummy22;
-  int32_t dummy21;
-  int32_t dummy20;
-  int32_t dummy19;
-  int32_t dummy18;
-  int32_t a;
-  int32_t dummy2;
-  int32_t b;
-  int32_t dummy4;
-  int32_t dummy5;
-  int32_t dummy6;
-  int32_t dummy7;
-  int32_t dummy8;
-  int32_t dummy9;
-  int32_t dummy10;
-  int32_t dummy11;
-  int32_t dummy12;
-  int32_t dummy13;
-  int32_t dummy14;
-  int32_t dummy15;
-  int32_t dummy16;
-  int32_t dummy17;
-}
-- (BOOL) hasA;
-- (BOOL) hasDummy2;
-- (BOOL) hasB;
-- (BOOL) hasDummy4;
-- (BOOL) hasDummy5;
-- (BOOL) hasDummy6;
-- (BOOL) hasDummy7;
-- (BOOL) hasDummy8;
-- (BOOL) hasDummy9;
-- (BOOL) hasDummy10;
-- (BOOL) hasDummy11;
-- (BOOL) hasDummy12;
-- (BOOL) hasDummy13;
-- (BOOL) hasDummy14;
-- (BOOL) hasDummy15;
-- (BOOL) hasDummy16;
-- (BOOL) hasDummy17;
-- (BOOL) hasDummy18;
-- (BOOL) hasDummy19;
-- (BOOL) hasDummy20;
-- (BOOL) hasDummy21;
-- (BOOL) hasDummy22;
-- (BOOL) hasDummy23;
-- (BOOL) hasDummy24;
-- (BOOL) hasDummy25;
-- (BOOL) hasDummy26;
-- (BOOL) hasDummy27;
-- (BOOL) hasDummy28;
-- (BOOL) hasDummy29;
-- (BOOL) hasDummy30;
-- (BOOL) hasDummy31;
-- (BOOL) hasDummy32;
-- (BOOL) hasC;
-@property (readonly) int32_t a;
-@property (readonly) int32_t dummy2;
-@property (readonly) int32_t b;
-@property (readonly) int32_t dummy4;
-@property (readonly) int32_t dummy5;
-@property (readonly) int32_t dummy6;
-@property (readonly) int32_t dummy7;
-@property (readonly) int32_t dummy8;
-@property (readonly) int32_t dummy9;
-@property (readonly) int32_t dummy10;
-@property (readonly) int32_t dummy11;
-@property (readonly) int32_t dummy12;
-@property (readonly) int32_t dummy13;
-@property (readonly) int32_t dummy14;
-@property (readonly) int32_t dummy15;
-@property (readonly) int32_t dummy16;
-@property (readonly) int32_t dummy17;
-@property (readonly) int32_t dummy18;
-@property (readonly) int32_t dummy19;
-@property (readonly) int32_t dummy20;
-@property (readonly) int32_t dummy21;
-@property (readonly) int32_t dummy22;
-@property (readonly) int32_t dummy23;
-@property (readonly) int32_t dummy24;
-@property (readonly) int32_t dummy25;
-@property (readonly) int32_t dummy26;
-@property (readonly) int32_t dummy27;
-@property (readonly) int32_t dummy28;
-@property (readonly) int32_t dummy29;
-@property (readonly) int32_t dummy30;
-@property (readonly) int32_t dummy31;
-@property (readonly) int32_t dummy32;
-@property (readonly) int32_t c;
+@end
+
+@interface TestRequired : PBGeneratedMessage
+- (BOOL)hasA;
+- (BOOL)hasDummy2;
+- (BOOL)hasB;
+- (BOOL)hasDummy4;
+- (BOOL)hasDummy5;
+- (BOOL)hasDummy6;
+- (BOOL)hasDummy7;
+- (BOOL)hasDummy8;
+- (BOOL)hasDummy9;
+- (BOOL)hasDummy10;
+- (BOOL)hasDummy11;
+- (BOOL)hasDummy12;
+- (BOOL)hasDummy13;
+- (BOOL)hasDummy14;
+- (BOOL)hasDummy15;
+- (BOOL)hasDummy16;
+- (BOOL)hasDummy17;
+- (BOOL)hasDummy18;
+- (BOOL)hasDummy19;
+- (BOOL)hasDummy20;
+- (BOOL)hasDummy21;
+- (BOOL)hasDummy22;
+- (BOOL)hasDummy23;
+- (BOOL)hasDummy24;
+- (BOOL)hasDummy25;
+- (BOOL)hasDummy26;
+- (BOOL)hasDummy27;
+- (BOOL)hasDummy28;
+- (BOOL)hasDummy29;
+- (BOOL)hasDummy30;
+- (BOOL)hasDummy31;
+- (BOOL)hasDummy32;
+- (BOOL)hasC;
+@property (nonatomic, readonly) int32_t a;
+@property (nonatomic, readonly) int32_t dummy2;
+@property (nonatomic, readonly) int32_t b;
+@property (nonatomic, readonly) int32_t dummy4;
+@property (nonatomic, readonly) int32_t dummy5;
+@property (nonatomic, readonly) int32_t dummy6;
+@property (nonatomic, readonly) int32_t dummy7;
+@property (nonatomic, readonly) int32_t dummy8;
+@property (nonatomic, readonly) int32_t dummy9;
+@property (nonatomic, readonly) int32_t dummy10;
+@property (nonatomic, readonly) int32_t dummy11;
+@property (nonatomic, readonly) int32_t dummy12;
+@property (nonatomic, readonly) int32_t dummy13;
+@property (nonatomic, readonly) int32_t dummy14;
+@property (nonatomic, readonly) int32_t dummy15;
+@property (nonatomic, readonly) int32_t dummy16;
+@property (nonatomic, readonly) int32_t dummy17;
+@property (nonatomic, readonly) int32_t dummy18;
+@property (nonatomic, readonly) int32_t dummy19;
+@property (nonatomic, readonly) int32_t dummy20;
+@property (nonatomic, readonly) int32_t dummy21;
+@property (nonatomic, readonly) int32_t dummy22;
+@property (nonatomic, readonly) int32_t dummy23;
+@property (nonatomic, readonly) int32_t dummy24;
+@property (nonatomic, readonly) int32_t dummy25;
+@property (nonatomic, readonly) int32_t dummy26;
+@property (nonatomic, readonly) int32_t dummy27;
+@property (nonatomic, readonly) int32_t dummy28;
+@property (nonatomic, readonly) int32_t dummy29;
+@property (nonatomic, readonly) int32_t dummy30;
+@property (nonatomic, readonly) int32_t dummy31;
+@property (nonatomic, readonly) int32_t dummy32;
+@property (nonatomic, readonly) int32_t c;
++ (id<PBExtensionField>) single;
++ (id<PBExtensionField>) multi;
 
 + (TestRequired*) defaultInstance;
 - (TestRequired*) defaultInstance;
 
-+ (id<PBExtensionField>) single;
-+ (id<PBExtensionField>) multi;
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestRequired_Builder*) builder;
 + (TestRequired_Builder*) builder;
 + (TestRequired_Builder*) builderWithPrototype:(TestRequired*) prototype;
 - (TestRequired_Builder*) toBuilder;
-
-+ (TestRequired*) parseFromData:(NSData*) data;
-+ (TestRequired*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestRequired*) parseFromInputStream:(NSInputStream*) input;
-+ (TestRequired*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestRequired*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestRequired*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestRequired_Builder : PBGeneratedMessage_Builder {
-@private
-  TestRequired* result;
-}
-
+@interface TestRequired_Builder : PBGeneratedMessage_Builder
 - (TestRequired*) defaultInstance;
 
-- (TestRequired_Builder*) clear;
-- (TestRequired_Builder*) clone;
-
 - (TestRequired*) build;
 - (TestRequired*) buildPartial;
 
 - (TestRequired_Builder*) mergeFrom:(TestRequired*) other;
-- (TestRequired_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestRequired_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (int32_t) a;
+- (BOOL)hasA;
+- (TestRequired_Builder*)clearA;
 - (TestRequired_Builder*) setA:(int32_t) value;
-- (TestRequired_Builder*) clearA;
 
-- (BOOL) hasDummy2;
 - (int32_t) dummy2;
+- (BOOL)hasDummy2;
+- (TestRequired_Builder*)clearDummy2;
 - (TestRequired_Builder*) setDummy2:(int32_t) value;
-- (TestRequired_Builder*) clearDummy2;
 
-- (BOOL) hasB;
 - (int32_t) b;
+- (BOOL)hasB;
+- (TestRequired_Builder*)clearB;
 - (TestRequired_Builder*) setB:(int32_t) value;
-- (TestRequired_Builder*) clearB;
 
-- (BOOL) hasDummy4;
 - (int32_t) dummy4;
+- (BOOL)hasDummy4;
+- (TestRequired_Builder*)clearDummy4;
 - (TestRequired_Builder*) setDummy4:(int32_t) value;
-- (TestRequired_Builder*) clearDummy4;
 
-- (BOOL) hasDummy5;
 - (int32_t) dummy5;
+- (BOOL)hasDummy5;
+- (TestRequired_Builder*)clearDummy5;
 - (TestRequired_Builder*) setDummy5:(int32_t) value;
-- (TestRequired_Builder*) clearDummy5;
 
-- (BOOL) hasDummy6;
 - (int32_t) dummy6;
+- (BOOL)hasDummy6;
+- (TestRequired_Builder*)clearDummy6;
 - (TestRequired_Builder*) setDummy6:(int32_t) value;
-- (TestRequired_Builder*) clearDummy6;
 
-- (BOOL) hasDummy7;
 - (int32_t) dummy7;
+- (BOOL)hasDummy7;
+- (TestRequired_Builder*)clearDummy7;
 - (TestRequired_Builder*) setDummy7:(int32_t) value;
-- (TestRequired_Builder*) clearDummy7;
 
-- (BOOL) hasDummy8;
 - (int32_t) dummy8;
+- (BOOL)hasDummy8;
+- (TestRequired_Builder*)clearDummy8;
 - (TestRequired_Builder*) setDummy8:(int32_t) value;
-- (TestRequired_Builder*) clearDummy8;
 
-- (BOOL) hasDummy9;
 - (int32_t) dummy9;
+- (BOOL)hasDummy9;
+- (TestRequired_Builder*)clearDummy9;
 - (TestRequired_Builder*) setDummy9:(int32_t) value;
-- (TestRequired_Builder*) clearDummy9;
 
-- (BOOL) hasDummy10;
 - (int32_t) dummy10;
+- (BOOL)hasDummy10;
+- (TestRequired_Builder*)clearDummy10;
 - (TestRequired_Builder*) setDummy10:(int32_t) value;
-- (TestRequired_Builder*) clearDummy10;
 
-- (BOOL) hasDummy11;
 - (int32_t) dummy11;
+- (BOOL)hasDummy11;
+- (TestRequired_Builder*)clearDummy11;
 - (TestRequired_Builder*) setDummy11:(int32_t) value;
-- (TestRequired_Builder*) clearDummy11;
 
-- (BOOL) hasDummy12;
 - (int32_t) dummy12;
+- (BOOL)hasDummy12;
+- (TestRequired_Builder*)clearDummy12;
 - (TestRequired_Builder*) setDummy12:(int32_t) value;
-- (TestRequired_Builder*) clearDummy12;
 
-- (BOOL) hasDummy13;
 - (int32_t) dummy13;
+- (BOOL)hasDummy13;
+- (TestRequired_Builder*)clearDummy13;
 - (TestRequired_Builder*) setDummy13:(int32_t) value;
-- (TestRequired_Builder*) clearDummy13;
 
-- (BOOL) hasDummy14;
 - (int32_t) dummy14;
+- (BOOL)hasDummy14;
+- (TestRequired_Builder*)clearDummy14;
 - (TestRequired_Builder*) setDummy14:(int32_t) value;
-- (TestRequired_Builder*) clearDummy14;
 
-- (BOOL) hasDummy15;
 - (int32_t) dummy15;
+- (BOOL)hasDummy15;
+- (TestRequired_Builder*)clearDummy15;
 - (TestRequired_Builder*) setDummy15:(int32_t) value;
-- (TestRequired_Builder*) clearDummy15;
 
-- (BOOL) hasDummy16;
 - (int32_t) dummy16;
+- (BOOL)hasDummy16;
+- (TestRequired_Builder*)clearDummy16;
 - (TestRequired_Builder*) setDummy16:(int32_t) value;
-- (TestRequired_Builder*) clearDummy16;
 
-- (BOOL) hasDummy17;
 - (int32_t) dummy17;
+- (BOOL)hasDummy17;
+- (TestRequired_Builder*)clearDummy17;
 - (TestRequired_Builder*) setDummy17:(int32_t) value;
-- (TestRequired_Builder*) clearDummy17;
 
-- (BOOL) hasDummy18;
 - (int32_t) dummy18;
+- (BOOL)hasDummy18;
+- (TestRequired_Builder*)clearDummy18;
 - (TestRequired_Builder*) setDummy18:(int32_t) value;
-- (TestRequired_Builder*) clearDummy18;
 
-- (BOOL) hasDummy19;
 - (int32_t) dummy19;
+- (BOOL)hasDummy19;
+- (TestRequired_Builder*)clearDummy19;
 - (TestRequired_Builder*) setDummy19:(int32_t) value;
-- (TestRequired_Builder*) clearDummy19;
 
-- (BOOL) hasDummy20;
 - (int32_t) dummy20;
+- (BOOL)hasDummy20;
+- (TestRequired_Builder*)clearDummy20;
 - (TestRequired_Builder*) setDummy20:(int32_t) value;
-- (TestRequired_Builder*) clearDummy20;
 
-- (BOOL) hasDummy21;
 - (int32_t) dummy21;
+- (BOOL)hasDummy21;
+- (TestRequired_Builder*)clearDummy21;
 - (TestRequired_Builder*) setDummy21:(int32_t) value;
-- (TestRequired_Builder*) clearDummy21;
 
-- (BOOL) hasDummy22;
 - (int32_t) dummy22;
+- (BOOL)hasDummy22;
+- (TestRequired_Builder*)clearDummy22;
 - (TestRequired_Builder*) setDummy22:(int32_t) value;
-- (TestRequired_Builder*) clearDummy22;
 
-- (BOOL) hasDummy23;
 - (int32_t) dummy23;
+- (BOOL)hasDummy23;
+- (TestRequired_Builder*)clearDummy23;
 - (TestRequired_Builder*) setDummy23:(int32_t) value;
-- (TestRequired_Builder*) clearDummy23;
 
-- (BOOL) hasDummy24;
 - (int32_t) dummy24;
+- (BOOL)hasDummy24;
+- (TestRequired_Builder*)clearDummy24;
 - (TestRequired_Builder*) setDummy24:(int32_t) value;
-- (TestRequired_Builder*) clearDummy24;
 
-- (BOOL) hasDummy25;
 - (int32_t) dummy25;
+- (BOOL)hasDummy25;
+- (TestRequired_Builder*)clearDummy25;
 - (TestRequired_Builder*) setDummy25:(int32_t) value;
-- (TestRequired_Builder*) clearDummy25;
 
-- (BOOL) hasDummy26;
 - (int32_t) dummy26;
+- (BOOL)hasDummy26;
+- (TestRequired_Builder*)clearDummy26;
 - (TestRequired_Builder*) setDummy26:(int32_t) value;
-- (TestRequired_Builder*) clearDummy26;
 
-- (BOOL) hasDummy27;
 - (int32_t) dummy27;
+- (BOOL)hasDummy27;
+- (TestRequired_Builder*)clearDummy27;
 - (TestRequired_Builder*) setDummy27:(int32_t) value;
-- (TestRequired_Builder*) clearDummy27;
 
-- (BOOL) hasDummy28;
 - (int32_t) dummy28;
+- (BOOL)hasDummy28;
+- (TestRequired_Builder*)clearDummy28;
 - (TestRequired_Builder*) setDummy28:(int32_t) value;
-- (TestRequired_Builder*) clearDummy28;
 
-- (BOOL) hasDummy29;
 - (int32_t) dummy29;
+- (BOOL)hasDummy29;
+- (TestRequired_Builder*)clearDummy29;
 - (TestRequired_Builder*) setDummy29:(int32_t) value;
-- (TestRequired_Builder*) clearDummy29;
 
-- (BOOL) hasDummy30;
 - (int32_t) dummy30;
+- (BOOL)hasDummy30;
+- (TestRequired_Builder*)clearDummy30;
 - (TestRequired_Builder*) setDummy30:(int32_t) value;
-- (TestRequired_Builder*) clearDummy30;
 
-- (BOOL) hasDummy31;
 - (int32_t) dummy31;
+- (BOOL)hasDummy31;
+- (TestRequired_Builder*)clearDummy31;
 - (TestRequired_Builder*) setDummy31:(int32_t) value;
-- (TestRequired_Builder*) clearDummy31;
 
-- (BOOL) hasDummy32;
 - (int32_t) dummy32;
+- (BOOL)hasDummy32;
+- (TestRequired_Builder*)clearDummy32;
 - (TestRequired_Builder*) setDummy32:(int32_t) value;
-- (TestRequired_Builder*) clearDummy32;
 
-- (BOOL) hasC;
 - (int32_t) c;
+- (BOOL)hasC;
+- (TestRequired_Builder*)clearC;
 - (TestRequired_Builder*) setC:(int32_t) value;
-- (TestRequired_Builder*) clearC;
 @end
 
-@interface TestRequiredForeign : PBGeneratedMessage {
-@private
-  BOOL hasDummy_:1;
-  BOOL hasOptionalMessage_:1;
-  int32_t dummy;
-  TestRequired* optionalMessage;
-  NSMutableArray * repeatedMessageArray;
-}
-- (BOOL) hasOptionalMessage;
-- (BOOL) hasDummy;
-@property (readonly, strong) TestRequired* optionalMessage;
-@property (readonly, strong) NSArray * repeatedMessage;
-@property (readonly) int32_t dummy;
+@interface TestRequiredForeign : PBGeneratedMessage
+- (BOOL)hasOptionalMessage;
+- (BOOL)hasDummy;
+@property (nonatomic, readonly) TestRequired* optionalMessage;
+@property (nonatomic, readonly, nullable) NSArray<TestRequired*> * repeatedMessage;
+@property (nonatomic, readonly) int32_t dummy;
 - (TestRequired*)repeatedMessageAtIndex:(NSUInteger)index;
 
 + (TestRequiredForeign*) defaultInstance;
 - (TestRequiredForeign*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestRequiredForeign_Builder*) builder;
 + (TestRequiredForeign_Builder*) builder;
 + (TestRequiredForeign_Builder*) builderWithPrototype:(TestRequiredForeign*) prototype;
 - (TestRequiredForeign_Builder*) toBuilder;
-
-+ (TestRequiredForeign*) parseFromData:(NSData*) data;
-+ (TestRequiredForeign*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestRequiredForeign*) parseFromInputStream:(NSInputStream*) input;
-+ (TestRequiredForeign*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestRequiredForeign*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestRequiredForeign*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestRequiredForeign_Builder : PBGeneratedMessage_Builder {
-@private
-  TestRequiredForeign* result;
-}
-
+@interface TestRequiredForeign_Builder : PBGeneratedMessage_Builder
 - (TestRequiredForeign*) defaultInstance;
 
-- (TestRequiredForeign_Builder*) clear;
-- (TestRequiredForeign_Builder*) clone;
-
 - (TestRequiredForeign*) build;
 - (TestRequiredForeign*) buildPartial;
 
 - (TestRequiredForeign_Builder*) mergeFrom:(TestRequiredForeign*) other;
-- (TestRequiredForeign_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestRequiredForeign_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasOptionalMessage;
 - (TestRequired*) optionalMessage;
+- (BOOL)hasOptionalMessage;
+- (TestRequiredForeign_Builder*)clearOptionalMessage;
 - (TestRequiredForeign_Builder*) setOptionalMessage:(TestRequired*) value;
 - (TestRequiredForeign_Builder*) setOptionalMessageBuilder:(TestRequired_Builder*) builderForValue;
 - (TestRequiredForeign_Builder*) mergeOptionalMessage:(TestRequired*) value;
-- (TestRequiredForeign_Builder*) clearOptionalMessage;
 
-- (TestRequired*)repeatedMessageAtIndex:(NSUInteger)index;
+- (NSMutableArray *)repeatedMessage;
+- (TestRequiredForeign_Builder*)clearRepeatedMessage;
 - (TestRequiredForeign_Builder *)addRepeatedMessage:(TestRequired*)value;
-- (TestRequiredForeign_Builder *)setRepeatedMessageArray:(NSArray *)array;
-- (TestRequiredForeign_Builder *)clearRepeatedMessage;
+- (TestRequiredForeign_Builder *)setRepeatedMessageArray:(NSArray<TestRequired*> *)array NS_SWIFT_NAME(setRepeatedMessageArray(_:));
++ (Class)expectedElementTypeForRepeatedMessageArray;
 
-- (BOOL) hasDummy;
 - (int32_t) dummy;
+- (BOOL)hasDummy;
+- (TestRequiredForeign_Builder*)clearDummy;
 - (TestRequiredForeign_Builder*) setDummy:(int32_t) value;
-- (TestRequiredForeign_Builder*) clearDummy;
 @end
 
-@interface TestForeignNested : PBGeneratedMessage {
-@private
-  BOOL hasForeignNested_:1;
-  TestAllTypes_NestedMessage* foreignNested;
-}
-- (BOOL) hasForeignNested;
-@property (readonly, strong) TestAllTypes_NestedMessage* foreignNested;
+@interface TestForeignNested : PBGeneratedMessage
+- (BOOL)hasForeignNested;
+@property (nonatomic, readonly) TestAllTypes_NestedMessage* foreignNested;
 
 + (TestForeignNested*) defaultInstance;
 - (TestForeignNested*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestForeignNested_Builder*) builder;
 + (TestForeignNested_Builder*) builder;
 + (TestForeignNested_Builder*) builderWithPrototype:(TestForeignNested*) prototype;
 - (TestForeignNested_Builder*) toBuilder;
-
-+ (TestForeignNested*) parseFromData:(NSData*) data;
-+ (TestForeignNested*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestForeignNested*) parseFromInputStream:(NSInputStream*) input;
-+ (TestForeignNested*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestForeignNested*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestForeignNested*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestForeignNested_Builder : PBGeneratedMessage_Builder {
-@private
-  TestForeignNested* result;
-}
-
+@interface TestForeignNested_Builder : PBGeneratedMessage_Builder
 - (TestForeignNested*) defaultInstance;
 
-- (TestForeignNested_Builder*) clear;
-- (TestForeignNested_Builder*) clone;
-
 - (TestForeignNested*) build;
 - (TestForeignNested*) buildPartial;
 
 - (TestForeignNested_Builder*) mergeFrom:(TestForeignNested*) other;
-- (TestForeignNested_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestForeignNested_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasForeignNested;
 - (TestAllTypes_NestedMessage*) foreignNested;
+- (BOOL)hasForeignNested;
+- (TestForeignNested_Builder*)clearForeignNested;
 - (TestForeignNested_Builder*) setForeignNested:(TestAllTypes_NestedMessage*) value;
 - (TestForeignNested_Builder*) setForeignNestedBuilder:(TestAllTypes_NestedMessage_Builder*) builderForValue;
 - (TestForeignNested_Builder*) mergeForeignNested:(TestAllTypes_NestedMessage*) value;
-- (TestForeignNested_Builder*) clearForeignNested;
 @end
 
-@interface TestEmptyMessage : PBGeneratedMessage {
-@private
-}
+@interface TestEmptyMessage : PBGeneratedMessage
 
 + (TestEmptyMessage*) defaultInstance;
 - (TestEmptyMessage*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestEmptyMessage_Builder*) builder;
 + (TestEmptyMessage_Builder*) builder;
 + (TestEmptyMessage_Builder*) builderWithPrototype:(TestEmptyMessage*) prototype;
 - (TestEmptyMessage_Builder*) toBuilder;
-
-+ (TestEmptyMessage*) parseFromData:(NSData*) data;
-+ (TestEmptyMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestEmptyMessage*) parseFromInputStream:(NSInputStream*) input;
-+ (TestEmptyMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestEmptyMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestEmptyMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestEmptyMessage_Builder : PBGeneratedMessage_Builder {
-@private
-  TestEmptyMessage* result;
-}
-
+@interface TestEmptyMessage_Builder : PBGeneratedMessage_Builder
 - (TestEmptyMessage*) defaultInstance;
 
-- (TestEmptyMessage_Builder*) clear;
-- (TestEmptyMessage_Builder*) clone;
-
 - (TestEmptyMessage*) build;
 - (TestEmptyMessage*) buildPartial;
 
 - (TestEmptyMessage_Builder*) mergeFrom:(TestEmptyMessage*) other;
-- (TestEmptyMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestEmptyMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestEmptyMessageWithExtensions : PBExtendableMessage {
-@private
-}
+@interface TestEmptyMessageWithExtensions : PBExtendableMessage
 
 + (TestEmptyMessageWithExtensions*) defaultInstance;
 - (TestEmptyMessageWithExtensions*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestEmptyMessageWithExtensions_Builder*) builder;
 + (TestEmptyMessageWithExtensions_Builder*) builder;
 + (TestEmptyMessageWithExtensions_Builder*) builderWithPrototype:(TestEmptyMessageWithExtensions*) prototype;
 - (TestEmptyMessageWithExtensions_Builder*) toBuilder;
-
-+ (TestEmptyMessageWithExtensions*) parseFromData:(NSData*) data;
-+ (TestEmptyMessageWithExtensions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestEmptyMessageWithExtensions*) parseFromInputStream:(NSInputStream*) input;
-+ (TestEmptyMessageWithExtensions*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestEmptyMessageWithExtensions*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestEmptyMessageWithExtensions*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestEmptyMessageWithExtensions_Builder : PBExtendableMessage_Builder {
-@private
-  TestEmptyMessageWithExtensions* result;
-}
+@interface TestEmptyMessageWithExtensions_Builder : PBExtendableMessage_Builder
 
 - (TestEmptyMessageWithExtensions*) defaultInstance;
 
-- (TestEmptyMessageWithExtensions_Builder*) clear;
-- (TestEmptyMessageWithExtensions_Builder*) clone;
-
 - (TestEmptyMessageWithExtensions*) build;
 - (TestEmptyMessageWithExtensions*) buildPartial;
 
 - (TestEmptyMessageWithExtensions_Builder*) mergeFrom:(TestEmptyMessageWithExtensions*) other;
-- (TestEmptyMessageWithExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestEmptyMessageWithExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestMultipleExtensionRanges : PBExtendableMessage {
-@private
-}
+@interface TestMultipleExtensionRanges : PBExtendableMessage
 
 + (TestMultipleExtensionRanges*) defaultInstance;
 - (TestMultipleExtensionRanges*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestMultipleExtensionRanges_Builder*) builder;
 + (TestMultipleExtensionRanges_Builder*) builder;
 + (TestMultipleExtensionRanges_Builder*) builderWithPrototype:(TestMultipleExtensionRanges*) prototype;
 - (TestMultipleExtensionRanges_Builder*) toBuilder;
-
-+ (TestMultipleExtensionRanges*) parseFromData:(NSData*) data;
-+ (TestMultipleExtensionRanges*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestMultipleExtensionRanges*) parseFromInputStream:(NSInputStream*) input;
-+ (TestMultipleExtensionRanges*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestMultipleExtensionRanges*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestMultipleExtensionRanges*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestMultipleExtensionRanges_Builder : PBExtendableMessage_Builder {
-@private
-  TestMultipleExtensionRanges* result;
-}
+@interface TestMultipleExtensionRanges_Builder : PBExtendableMessage_Builder
 
 - (TestMultipleExtensionRanges*) defaultInstance;
 
-- (TestMultipleExtensionRanges_Builder*) clear;
-- (TestMultipleExtensionRanges_Builder*) clone;
-
 - (TestMultipleExtensionRanges*) build;
 - (TestMultipleExtensionRanges*) buildPartial;
 
 - (TestMultipleExtensionRanges_Builder*) mergeFrom:(TestMultipleExtensionRanges*) other;
-- (TestMultipleExtensionRanges_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestMultipleExtensionRanges_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestReallyLargeTagNumber : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
-  BOOL hasBb_:1;
-  int32_t a;
-  int32_t bb;
-}
-- (BOOL) hasA;
-- (BOOL) hasBb;
-@property (readonly) int32_t a;
-@property (readonly) int32_t bb;
+@interface TestReallyLargeTagNumber : PBGeneratedMessage
+- (BOOL)hasA;
+- (BOOL)hasBb;
+@property (nonatomic, readonly) int32_t a;
+@property (nonatomic, readonly) int32_t bb;
 
 + (TestReallyLargeTagNumber*) defaultInstance;
 - (TestReallyLargeTagNumber*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestReallyLargeTagNumber_Builder*) builder;
 + (TestReallyLargeTagNumber_Builder*) builder;
 + (TestReallyLargeTagNumber_Builder*) builderWithPrototype:(TestReallyLargeTagNumber*) prototype;
 - (TestReallyLargeTagNumber_Builder*) toBuilder;
-
-+ (TestReallyLargeTagNumber*) parseFromData:(NSData*) data;
-+ (TestReallyLargeTagNumber*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestReallyLargeTagNumber*) parseFromInputStream:(NSInputStream*) input;
-+ (TestReallyLargeTagNumber*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestReallyLargeTagNumber*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestReallyLargeTagNumber*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestReallyLargeTagNumber_Builder : PBGeneratedMessage_Builder {
-@private
-  TestReallyLargeTagNumber* result;
-}
-
+@interface TestReallyLargeTagNumber_Builder : PBGeneratedMessage_Builder
 - (TestReallyLargeTagNumber*) defaultInstance;
 
-- (TestReallyLargeTagNumber_Builder*) clear;
-- (TestReallyLargeTagNumber_Builder*) clone;
-
 - (TestReallyLargeTagNumber*) build;
 - (TestReallyLargeTagNumber*) buildPartial;
 
 - (TestReallyLargeTagNumber_Builder*) mergeFrom:(TestReallyLargeTagNumber*) other;
-- (TestReallyLargeTagNumber_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestReallyLargeTagNumber_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (int32_t) a;
+- (BOOL)hasA;
+- (TestReallyLargeTagNumber_Builder*)clearA;
 - (TestReallyLargeTagNumber_Builder*) setA:(int32_t) value;
-- (TestReallyLargeTagNumber_Builder*) clearA;
 
-- (BOOL) hasBb;
 - (int32_t) bb;
+- (BOOL)hasBb;
+- (TestReallyLargeTagNumber_Builder*)clearBb;
 - (TestReallyLargeTagNumber_Builder*) setBb:(int32_t) value;
-- (TestReallyLargeTagNumber_Builder*) clearBb;
 @end
 
-@interface TestRecursiveMessage : PBGeneratedMessage {
-@private
-  BOOL hasI_:1;
-  BOOL hasA_:1;
-  int32_t i;
-  TestRecursiveMessage* a;
-}
-- (BOOL) hasA;
-- (BOOL) hasI;
-@property (readonly, strong) TestRecursiveMessage* a;
-@property (readonly) int32_t i;
+@interface TestRecursiveMessage : PBGeneratedMessage
+- (BOOL)hasA;
+- (BOOL)hasI;
+@property (nonatomic, readonly) TestRecursiveMessage* a;
+@property (nonatomic, readonly) int32_t i;
 
 + (TestRecursiveMessage*) defaultInstance;
 - (TestRecursiveMessage*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestRecursiveMessage_Builder*) builder;
 + (TestRecursiveMessage_Builder*) builder;
 + (TestRecursiveMessage_Builder*) builderWithPrototype:(TestRecursiveMessage*) prototype;
 - (TestRecursiveMessage_Builder*) toBuilder;
-
-+ (TestRecursiveMessage*) parseFromData:(NSData*) data;
-+ (TestRecursiveMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestRecursiveMessage*) parseFromInputStream:(NSInputStream*) input;
-+ (TestRecursiveMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestRecursiveMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestRecursiveMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestRecursiveMessage_Builder : PBGeneratedMessage_Builder {
-@private
-  TestRecursiveMessage* result;
-}
-
+@interface TestRecursiveMessage_Builder : PBGeneratedMessage_Builder
 - (TestRecursiveMessage*) defaultInstance;
 
-- (TestRecursiveMessage_Builder*) clear;
-- (TestRecursiveMessage_Builder*) clone;
-
 - (TestRecursiveMessage*) build;
 - (TestRecursiveMessage*) buildPartial;
 
 - (TestRecursiveMessage_Builder*) mergeFrom:(TestRecursiveMessage*) other;
-- (TestRecursiveMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestRecursiveMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (TestRecursiveMessage*) a;
+- (BOOL)hasA;
+- (TestRecursiveMessage_Builder*)clearA;
 - (TestRecursiveMessage_Builder*) setA:(TestRecursiveMessage*) value;
 - (TestRecursiveMessage_Builder*) setABuilder:(TestRecursiveMessage_Builder*) builderForValue;
 - (TestRecursiveMessage_Builder*) mergeA:(TestRecursiveMessage*) value;
-- (TestRecursiveMessage_Builder*) clearA;
 
-- (BOOL) hasI;
 - (int32_t) i;
+- (BOOL)hasI;
+- (TestRecursiveMessage_Builder*)clearI;
 - (TestRecursiveMessage_Builder*) setI:(int32_t) value;
-- (TestRecursiveMessage_Builder*) clearI;
 @end
 
-@interface TestMutualRecursionA : PBGeneratedMessage {
-@private
-  BOOL hasBb_:1;
-  TestMutualRecursionB* bb;
-}
-- (BOOL) hasBb;
-@property (readonly, strong) TestMutualRecursionB* bb;
+@interface TestMutualRecursionA : PBGeneratedMessage
+- (BOOL)hasBb;
+@property (nonatomic, readonly) TestMutualRecursionB* bb;
 
 + (TestMutualRecursionA*) defaultInstance;
 - (TestMutualRecursionA*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestMutualRecursionA_Builder*) builder;
 + (TestMutualRecursionA_Builder*) builder;
 + (TestMutualRecursionA_Builder*) builderWithPrototype:(TestMutualRecursionA*) prototype;
 - (TestMutualRecursionA_Builder*) toBuilder;
-
-+ (TestMutualRecursionA*) parseFromData:(NSData*) data;
-+ (TestMutualRecursionA*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestMutualRecursionA*) parseFromInputStream:(NSInputStream*) input;
-+ (TestMutualRecursionA*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestMutualRecursionA*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestMutualRecursionA*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestMutualRecursionA_Builder : PBGeneratedMessage_Builder {
-@private
-  TestMutualRecursionA* result;
-}
-
+@interface TestMutualRecursionA_Builder : PBGeneratedMessage_Builder
 - (TestMutualRecursionA*) defaultInstance;
 
-- (TestMutualRecursionA_Builder*) clear;
-- (TestMutualRecursionA_Builder*) clone;
-
 - (TestMutualRecursionA*) build;
 - (TestMutualRecursionA*) buildPartial;
 
 - (TestMutualRecursionA_Builder*) mergeFrom:(TestMutualRecursionA*) other;
-- (TestMutualRecursionA_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestMutualRecursionA_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasBb;
 - (TestMutualRecursionB*) bb;
+- (BOOL)hasBb;
+- (TestMutualRecursionA_Builder*)clearBb;
 - (TestMutualRecursionA_Builder*) setBb:(TestMutualRecursionB*) value;
 - (TestMutualRecursionA_Builder*) setBbBuilder:(TestMutualRecursionB_Builder*) builderForValue;
 - (TestMutualRecursionA_Builder*) mergeBb:(TestMutualRecursionB*) value;
-- (TestMutualRecursionA_Builder*) clearBb;
 @end
 
-@interface TestMutualRecursionB : PBGeneratedMessage {
-@private
-  BOOL hasOptionalInt32_:1;
-  BOOL hasA_:1;
-  int32_t optionalInt32;
-  TestMutualRecursionA* a;
-}
-- (BOOL) hasA;
-- (BOOL) hasOptionalInt32;
-@property (readonly, strong) TestMutualRecursionA* a;
-@property (readonly) int32_t optionalInt32;
+@interface TestMutualRecursionB : PBGeneratedMessage
+- (BOOL)hasA;
+- (BOOL)hasOptionalInt32;
+@property (nonatomic, readonly) TestMutualRecursionA* a;
+@property (nonatomic, readonly) int32_t optionalInt32;
 
 + (TestMutualRecursionB*) defaultInstance;
 - (TestMutualRecursionB*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestMutualRecursionB_Builder*) builder;
 + (TestMutualRecursionB_Builder*) builder;
 + (TestMutualRecursionB_Builder*) builderWithPrototype:(TestMutualRecursionB*) prototype;
 - (TestMutualRecursionB_Builder*) toBuilder;
-
-+ (TestMutualRecursionB*) parseFromData:(NSData*) data;
-+ (TestMutualRecursionB*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestMutualRecursionB*) parseFromInputStream:(NSInputStream*) input;
-+ (TestMutualRecursionB*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestMutualRecursionB*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestMutualRecursionB*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestMutualRecursionB_Builder : PBGeneratedMessage_Builder {
-@private
-  TestMutualRecursionB* result;
-}
-
+@interface TestMutualRecursionB_Builder : PBGeneratedMessage_Builder
 - (TestMutualRecursionB*) defaultInstance;
 
-- (TestMutualRecursionB_Builder*) clear;
-- (TestMutualRecursionB_Builder*) clone;
-
 - (TestMutualRecursionB*) build;
 - (TestMutualRecursionB*) buildPartial;
 
 - (TestMutualRecursionB_Builder*) mergeFrom:(TestMutualRecursionB*) other;
-- (TestMutualRecursionB_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestMutualRecursionB_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (TestMutualRecursionA*) a;
+- (BOOL)hasA;
+- (TestMutualRecursionB_Builder*)clearA;
 - (TestMutualRecursionB_Builder*) setA:(TestMutualRecursionA*) value;
 - (TestMutualRecursionB_Builder*) setABuilder:(TestMutualRecursionA_Builder*) builderForValue;
 - (TestMutualRecursionB_Builder*) mergeA:(TestMutualRecursionA*) value;
-- (TestMutualRecursionB_Builder*) clearA;
 
-- (BOOL) hasOptionalInt32;
 - (int32_t) optionalInt32;
+- (BOOL)hasOptionalInt32;
+- (TestMutualRecursionB_Builder*)clearOptionalInt32;
 - (TestMutualRecursionB_Builder*) setOptionalInt32:(int32_t) value;
-- (TestMutualRecursionB_Builder*) clearOptionalInt32;
 @end
 
-@interface TestDupFieldNumber : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
-  BOOL hasFoo_:1;
-  BOOL hasBar_:1;
-  int32_t a;
-  TestDupFieldNumber_Foo* foo;
-  TestDupFieldNumber_Bar* bar;
-}
-- (BOOL) hasA;
-- (BOOL) hasFoo;
-- (BOOL) hasBar;
-@property (readonly) int32_t a;
-@property (readonly, strong) TestDupFieldNumber_Foo* foo;
-@property (readonly, strong) TestDupFieldNumber_Bar* bar;
+@interface TestDupFieldNumber : PBGeneratedMessage
+- (BOOL)hasA;
+- (BOOL)hasFoo;
+- (BOOL)hasBar;
+@property (nonatomic, readonly) int32_t a;
+@property (nonatomic, readonly) TestDupFieldNumber_Foo* foo;
+@property (nonatomic, readonly) TestDupFieldNumber_Bar* bar;
 
 + (TestDupFieldNumber*) defaultInstance;
 - (TestDupFieldNumber*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestDupFieldNumber_Builder*) builder;
 + (TestDupFieldNumber_Builder*) builder;
 + (TestDupFieldNumber_Builder*) builderWithPrototype:(TestDupFieldNumber*) prototype;
 - (TestDupFieldNumber_Builder*) toBuilder;
-
-+ (TestDupFieldNumber*) parseFromData:(NSData*) data;
-+ (TestDupFieldNumber*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDupFieldNumber*) parseFromInputStream:(NSInputStream*) input;
-+ (TestDupFieldNumber*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDupFieldNumber*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestDupFieldNumber*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestDupFieldNumber_Foo : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
-  int32_t a;
-}
-- (BOOL) hasA;
-@property (readonly) int32_t a;
+@interface TestDupFieldNumber_Foo : PBGeneratedMessage
+- (BOOL)hasA;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestDupFieldNumber_Foo*) defaultInstance;
 - (TestDupFieldNumber_Foo*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestDupFieldNumber_Foo_Builder*) builder;
 + (TestDupFieldNumber_Foo_Builder*) builder;
 + (TestDupFieldNumber_Foo_Builder*) builderWithPrototype:(TestDupFieldNumber_Foo*) prototype;
 - (TestDupFieldNumber_Foo_Builder*) toBuilder;
-
-+ (TestDupFieldNumber_Foo*) parseFromData:(NSData*) data;
-+ (TestDupFieldNumber_Foo*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDupFieldNumber_Foo*) parseFromInputStream:(NSInputStream*) input;
-+ (TestDupFieldNumber_Foo*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDupFieldNumber_Foo*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestDupFieldNumber_Foo*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestDupFieldNumber_Foo_Builder : PBGeneratedMessage_Builder {
-@private
-  TestDupFieldNumber_Foo* result;
-}
-
+@interface TestDupFieldNumber_Foo_Builder : PBGeneratedMessage_Builder
 - (TestDupFieldNumber_Foo*) defaultInstance;
 
-- (TestDupFieldNumber_Foo_Builder*) clear;
-- (TestDupFieldNumber_Foo_Builder*) clone;
-
 - (TestDupFieldNumber_Foo*) build;
 - (TestDupFieldNumber_Foo*) buildPartial;
 
 - (TestDupFieldNumber_Foo_Builder*) mergeFrom:(TestDupFieldNumber_Foo*) other;
-- (TestDupFieldNumber_Foo_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestDupFieldNumber_Foo_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (int32_t) a;
+- (BOOL)hasA;
+- (TestDupFieldNumber_Foo_Builder*)clearA;
 - (TestDupFieldNumber_Foo_Builder*) setA:(int32_t) value;
-- (TestDupFieldNumber_Foo_Builder*) clearA;
 @end
 
-@interface TestDupFieldNumber_Bar : PBGeneratedMessage {
-@private
-  BOOL hasA_:1;
-  int32_t a;
-}
-- (BOOL) hasA;
-@property (readonly) int32_t a;
+@interface TestDupFieldNumber_Bar : PBGeneratedMessage
+- (BOOL)hasA;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestDupFieldNumber_Bar*) defaultInstance;
 - (TestDupFieldNumber_Bar*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestDupFieldNumber_Bar_Builder*) builder;
 + (TestDupFieldNumber_Bar_Builder*) builder;
 + (TestDupFieldNumber_Bar_Builder*) builderWithPrototype:(TestDupFieldNumber_Bar*) prototype;
 - (TestDupFieldNumber_Bar_Builder*) toBuilder;
-
-+ (TestDupFieldNumber_Bar*) parseFromData:(NSData*) data;
-+ (TestDupFieldNumber_Bar*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDupFieldNumber_Bar*) parseFromInputStream:(NSInputStream*) input;
-+ (TestDupFieldNumber_Bar*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDupFieldNumber_Bar*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestDupFieldNumber_Bar*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestDupFieldNumber_Bar_Builder : PBGeneratedMessage_Builder {
-@private
-  TestDupFieldNumber_Bar* result;
-}
-
+@interface TestDupFieldNumber_Bar_Builder : PBGeneratedMessage_Builder
 - (TestDupFieldNumber_Bar*) defaultInstance;
 
-- (TestDupFieldNumber_Bar_Builder*) clear;
-- (TestDupFieldNumber_Bar_Builder*) clone;
-
 - (TestDupFieldNumber_Bar*) build;
 - (TestDupFieldNumber_Bar*) buildPartial;
 
 - (TestDupFieldNumber_Bar_Builder*) mergeFrom:(TestDupFieldNumber_Bar*) other;
-- (TestDupFieldNumber_Bar_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestDupFieldNumber_Bar_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (int32_t) a;
+- (BOOL)hasA;
+- (TestDupFieldNumber_Bar_Builder*)clearA;
 - (TestDupFieldNumber_Bar_Builder*) setA:(int32_t) value;
-- (TestDupFieldNumber_Bar_Builder*) clearA;
 @end
 
-@interface TestDupFieldNumber_Builder : PBGeneratedMessage_Builder {
-@private
-  TestDupFieldNumber* result;
-}
-
+@interface TestDupFieldNumber_Builder : PBGeneratedMessage_Builder
 - (TestDupFieldNumber*) defaultInstance;
 
-- (TestDupFieldNumber_Builder*) clear;
-- (TestDupFieldNumber_Builder*) clone;
-
 - (TestDupFieldNumber*) build;
 - (TestDupFieldNumber*) buildPartial;
 
 - (TestDupFieldNumber_Builder*) mergeFrom:(TestDupFieldNumber*) other;
-- (TestDupFieldNumber_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestDupFieldNumber_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (int32_t) a;
+- (BOOL)hasA;
+- (TestDupFieldNumber_Builder*)clearA;
 - (TestDupFieldNumber_Builder*) setA:(int32_t) value;
-- (TestDupFieldNumber_Builder*) clearA;
 
-- (BOOL) hasFoo;
 - (TestDupFieldNumber_Foo*) foo;
+- (BOOL)hasFoo;
+- (TestDupFieldNumber_Builder*)clearFoo;
 - (TestDupFieldNumber_Builder*) setFoo:(TestDupFieldNumber_Foo*) value;
 - (TestDupFieldNumber_Builder*) setFooBuilder:(TestDupFieldNumber_Foo_Builder*) builderForValue;
 - (TestDupFieldNumber_Builder*) mergeFoo:(TestDupFieldNumber_Foo*) value;
-- (TestDupFieldNumber_Builder*) clearFoo;
 
-- (BOOL) hasBar;
 - (TestDupFieldNumber_Bar*) bar;
+- (BOOL)hasBar;
+- (TestDupFieldNumber_Builder*)clearBar;
 - (TestDupFieldNumber_Builder*) setBar:(TestDupFieldNumber_Bar*) value;
 - (TestDupFieldNumber_Builder*) setBarBuilder:(TestDupFieldNumber_Bar_Builder*) builderForValue;
 - (TestDupFieldNumber_Builder*) mergeBar:(TestDupFieldNumber_Bar*) value;
-- (TestDupFieldNumber_Builder*) clearBar;
 @end
 
-@interface TestNestedMessageHasBits : PBGeneratedMessage {
-@private
-  BOOL hasOptionalNestedMessage_:1;
-  TestNestedMessageHasBits_NestedMessage* optionalNestedMessage;
-}
-- (BOOL) hasOptionalNestedMessage;
-@property (readonly, strong) TestNestedMessageHasBits_NestedMessage* optionalNestedMessage;
+@interface TestNestedMessageHasBits : PBGeneratedMessage
+- (BOOL)hasOptionalNestedMessage;
+@property (nonatomic, readonly) TestNestedMessageHasBits_NestedMessage* optionalNestedMessage;
 
 + (TestNestedMessageHasBits*) defaultInstance;
 - (TestNestedMessageHasBits*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestNestedMessageHasBits_Builder*) builder;
 + (TestNestedMessageHasBits_Builder*) builder;
 + (TestNestedMessageHasBits_Builder*) builderWithPrototype:(TestNestedMessageHasBits*) prototype;
 - (TestNestedMessageHasBits_Builder*) toBuilder;
-
-+ (TestNestedMessageHasBits*) parseFromData:(NSData*) data;
-+ (TestNestedMessageHasBits*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestNestedMessageHasBits*) parseFromInputStream:(NSInputStream*) input;
-+ (TestNestedMessageHasBits*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestNestedMessageHasBits*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestNestedMessageHasBits*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestNestedMessageHasBits_NestedMessage : PBGeneratedMessage {
-@private
-  PBAppendableArray * nestedmessageRepeatedInt32Array;
-  NSMutableArray * nestedmessageRepeatedForeignmessageArray;
-}
-@property (readonly, strong) PBArray * nestedmessageRepeatedInt32;
-@property (readonly, strong) NSArray * nestedmessageRepeatedForeignmessage;
+@interface TestNestedMessageHasBits_NestedMessage : PBGeneratedMessage
+@property (nonatomic, readonly, nullable) PBArray * nestedmessageRepeatedInt32;
+@property (nonatomic, readonly, nullable) NSArray<ForeignMessage*> * nestedmessageRepeatedForeignmessage;
 - (int32_t)nestedmessageRepeatedInt32AtIndex:(NSUInteger)index;
 - (ForeignMessage*)nestedmessageRepeatedForeignmessageAtIndex:(NSUInteger)index;
 
 + (TestNestedMessageHasBits_NestedMessage*) defaultInstance;
 - (TestNestedMessageHasBits_NestedMessage*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestNestedMessageHasBits_NestedMessage_Builder*) builder;
 + (TestNestedMessageHasBits_NestedMessage_Builder*) builder;
 + (TestNestedMessageHasBits_NestedMessage_Builder*) builderWithPrototype:(TestNestedMessageHasBits_NestedMessage*) prototype;
 - (TestNestedMessageHasBits_NestedMessage_Builder*) toBuilder;
-
-+ (TestNestedMessageHasBits_NestedMessage*) parseFromData:(NSData*) data;
-+ (TestNestedMessageHasBits_NestedMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestNestedMessageHasBits_NestedMessage*) parseFromInputStream:(NSInputStream*) input;
-+ (TestNestedMessageHasBits_NestedMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestNestedMessageHasBits_NestedMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestNestedMessageHasBits_NestedMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestNestedMessageHasBits_NestedMessage_Builder : PBGeneratedMessage_Builder {
-@private
-  TestNestedMessageHasBits_NestedMessage* result;
-}
-
+@interface TestNestedMessageHasBits_NestedMessage_Builder : PBGeneratedMessage_Builder
 - (TestNestedMessageHasBits_NestedMessage*) defaultInstance;
 
-- (TestNestedMessageHasBits_NestedMessage_Builder*) clear;
-- (TestNestedMessageHasBits_NestedMessage_Builder*) clone;
-
 - (TestNestedMessageHasBits_NestedMessage*) build;
 - (TestNestedMessageHasBits_NestedMessage*) buildPartial;
 
 - (TestNestedMessageHasBits_NestedMessage_Builder*) mergeFrom:(TestNestedMessageHasBits_NestedMessage*) other;
-- (TestNestedMessageHasBits_NestedMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestNestedMessageHasBits_NestedMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
 - (PBAppendableArray *)nestedmessageRepeatedInt32;
-- (int32_t)nestedmessageRepeatedInt32AtIndex:(NSUInteger)index;
+- (TestNestedMessageHasBits_NestedMessage_Builder*)clearNestedmessageRepeatedInt32;
 - (TestNestedMessageHasBits_NestedMessage_Builder *)addNestedmessageRepeatedInt32:(int32_t)value;
-- (TestNestedMessageHasBits_NestedMessage_Builder *)setNestedmessageRepeatedInt32Array:(NSArray *)array;
-- (TestNestedMessageHasBits_NestedMessage_Builder *)setNestedmessageRepeatedInt32Values:(const int32_t *)values count:(NSUInteger)count;
-- (TestNestedMessageHasBits_NestedMessage_Builder *)clearNestedmessageRepeatedInt32;
+- (TestNestedMessageHasBits_NestedMessage_Builder *)setNestedmessageRepeatedInt32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setNestedmessageRepeatedInt32Array(_:));
 
-- (ForeignMessage*)nestedmessageRepeatedForeignmessageAtIndex:(NSUInteger)index;
+- (NSMutableArray *)nestedmessageRepeatedForeignmessage;
+- (TestNestedMessageHasBits_NestedMessage_Builder*)clearNestedmessageRepeatedForeignmessage;
 - (TestNestedMessageHasBits_NestedMessage_Builder *)addNestedmessageRepeatedForeignmessage:(ForeignMessage*)value;
-- (TestNestedMessageHasBits_NestedMessage_Builder *)setNestedmessageRepeatedForeignmessageArray:(NSArray *)array;
-
-- (TestNestedMessageHasBits_NestedMessage_Builder *)clearNestedmessageRepeatedForeignmessage;
+- (TestNestedMessageHasBits_NestedMessage_Builder *)setNestedmessageRepeatedForeignmessageArray:(NSArray<ForeignMessage*> *)array NS_SWIFT_NAME(setNestedmessageRepeatedForeignmessageArray(_:));
++ (Class)expectedElementTypeForNestedmessageRepeatedForeignmessageArray;
 @end
 
-@interface TestNestedMessageHasBits_Builder : PBGeneratedMessage_Builder {
-@private
-  TestNestedMessageHasBits* result;
-}
-
+@interface TestNestedMessageHasBits_Builder : PBGeneratedMessage_Builder
 - (TestNestedMessageHasBits*) defaultInstance;
 
-- (TestNestedMessageHasBits_Builder*) clear;
-- (TestNestedMessageHasBits_Builder*) clone;
-
 - (TestNestedMessageHasBits*) build;
 - (TestNestedMessageHasBits*) buildPartial;
 
 - (TestNestedMessageHasBits_Builder*) mergeFrom:(TestNestedMessageHasBits*) other;
-- (TestNestedMessageHasBits_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestNestedMessageHasBits_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasOptionalNestedMessage;
 - (TestNestedMessageHasBits_NestedMessage*) optionalNestedMessage;
+- (BOOL)hasOptionalNestedMessage;
+- (TestNestedMessageHasBits_Builder*)clearOptionalNestedMessage;
 - (TestNestedMessageHasBits_Builder*) setOptionalNestedMessage:(TestNestedMessageHasBits_NestedMessage*) value;
 - (TestNestedMessageHasBits_Builder*) setOptionalNestedMessageBuilder:(TestNestedMessageHasBits_NestedMessage_Builder*) builderForValue;
 - (TestNestedMessageHasBits_Builder*) mergeOptionalNestedMessage:(TestNestedMessageHasBits_NestedMessage*) value;
-- (TestNestedMessageHasBits_Builder*) clearOptionalNestedMessage;
-@end
-
-@interface TestCamelCaseFieldNames : PBGeneratedMessage {
-@private
-  BOOL hasPrimitiveField_:1;
-  BOOL hasStringField_:1;
-  BOOL hasStringPieceField_:1;
-  BOOL hasCordField_:1;
-  BOOL hasMessageField_:1;
-  BOOL hasEnumField_:1;
-  int32_t primitiveField;
-  NSString* stringField;
-  NSString* stringPieceField;
-  NSString* cordField;
-  ForeignMessage* messageField;
-  ForeignEnum enumField;
-  PBAppendableArray * repeatedPrimitiveFieldArray;
-  NSMutableArray * repeatedStringFieldArray;
-  NSMutableArray * repeatedStringPieceFieldArray;
-  NSMutableArray * repeatedCordFieldArray;
-  NSMutableArray * repeatedMessageFieldArray;
-  PBAppendableArray * repeatedEnumFieldArray;
-}
-- (BOOL) hasPrimitiveField;
-- (BOOL) hasStringField;
-- (BOOL) hasEnumField;
-- (BOOL) hasMessageField;
-- (BOOL) hasStringPieceField;
-- (BOOL) hasCordField;
-@property (readonly) int32_t primitiveField;
-@property (readonly, strong) NSString* stringField;
-@property (readonly) ForeignEnum enumField;
-@property (readonly, strong) ForeignMessage* messageField;
-@property (readonly, strong) NSString* stringPieceField;
-@property (readonly, strong) NSString* cordField;
-@property (readonly, strong) PBArray * repeatedPrimitiveField;
-@property (readonly, strong) PBArray * repeatedStringField;
-@property (readonly, strong) PBArray * repeatedEnumField;
-@property (readonly, strong) PBArray * repeatedMessageField;
-@property (readonly, strong) PBArray * repeatedStringPieceField;
-@property (readonly, strong) PBArray * repeatedCordField;
+@end
+
+@interface TestCamelCaseFieldNames : PBGeneratedMessage
+- (BOOL)hasPrimitiveField;
+- (BOOL)hasStringField;
+- (BOOL)hasEnumField;
+- (BOOL)hasMessageField;
+- (BOOL)hasStringPieceField;
+- (BOOL)hasCordField;
+@property (nonatomic, readonly) int32_t primitiveField;
+@property (nonatomic, readonly) NSString* stringField;
+@property (nonatomic, readonly) ForeignEnum enumField;
+@property (nonatomic, readonly) ForeignMessage* messageField;
+@property (nonatomic, readonly) NSString* stringPieceField;
+@property (nonatomic, readonly) NSString* cordField;
+@property (nonatomic, readonly, nullable) PBArray * repeatedPrimitiveField;
+@property (nonatomic, readonly, nullable) NSArray<NSString*> * repeatedStringField;
+@property (nonatomic, readonly, nullable) PBArray * repeatedEnumField;
+@property (nonatomic, readonly, nullable) NSArray<ForeignMessage*> * repeatedMessageField;
+@property (nonatomic, readonly, nullable) NSArray<NSString*> * repeatedStringPieceField;
+@property (nonatomic, readonly, nullable) NSArray<NSString*> * repeatedCordField;
 - (int32_t)repeatedPrimitiveFieldAtIndex:(NSUInteger)index;
 - (NSString*)repeatedStringFieldAtIndex:(NSUInteger)index;
 - (ForeignEnum)repeatedEnumFieldAtIndex:(NSUInteger)index;
@@ -2472,588 +1731,385 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 + (TestCamelCaseFieldNames*) defaultInstance;
 - (TestCamelCaseFieldNames*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestCamelCaseFieldNames_Builder*) builder;
 + (TestCamelCaseFieldNames_Builder*) builder;
 + (TestCamelCaseFieldNames_Builder*) builderWithPrototype:(TestCamelCaseFieldNames*) prototype;
 - (TestCamelCaseFieldNames_Builder*) toBuilder;
-
-+ (TestCamelCaseFieldNames*) parseFromData:(NSData*) data;
-+ (TestCamelCaseFieldNames*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestCamelCaseFieldNames*) parseFromInputStream:(NSInputStream*) input;
-+ (TestCamelCaseFieldNames*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestCamelCaseFieldNames*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestCamelCaseFieldNames*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestCamelCaseFieldNames_Builder : PBGeneratedMessage_Builder {
-@private
-  TestCamelCaseFieldNames* result;
-}
-
+@interface TestCamelCaseFieldNames_Builder : PBGeneratedMessage_Builder
 - (TestCamelCaseFieldNames*) defaultInstance;
 
-- (TestCamelCaseFieldNames_Builder*) clear;
-- (TestCamelCaseFieldNames_Builder*) clone;
-
 - (TestCamelCaseFieldNames*) build;
 - (TestCamelCaseFieldNames*) buildPartial;
 
 - (TestCamelCaseFieldNames_Builder*) mergeFrom:(TestCamelCaseFieldNames*) other;
-- (TestCamelCaseFieldNames_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestCamelCaseFieldNames_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasPrimitiveField;
 - (int32_t) primitiveField;
+- (BOOL)hasPrimitiveField;
+- (TestCamelCaseFieldNames_Builder*)clearPrimitiveField;
 - (TestCamelCaseFieldNames_Builder*) setPrimitiveField:(int32_t) value;
-- (TestCamelCaseFieldNames_Builder*) clearPrimitiveField;
 
-- (BOOL) hasStringField;
 - (NSString*) stringField;
+- (BOOL)hasStringField;
+- (TestCamelCaseFieldNames_Builder*)clearStringField;
 - (TestCamelCaseFieldNames_Builder*) setStringField:(NSString*) value;
-- (TestCamelCaseFieldNames_Builder*) clearStringField;
 
-- (BOOL) hasEnumField;
-- (ForeignEnum) enumField;
-- (TestCamelCaseFieldNames_Builder*) setEnumField:(ForeignEnum) value;
-- (TestCamelCaseFieldNames_Builder*) clearEnumField;
+- (ForeignEnum)enumField;
+- (BOOL)hasEnumField;
+- (TestCamelCaseFieldNames_Builder*)clearEnumField;
+- (TestCamelCaseFieldNames_Builder*)setEnumField:(ForeignEnum) value;
 
-- (BOOL) hasMessageField;
 - (ForeignMessage*) messageField;
+- (BOOL)hasMessageField;
+- (TestCamelCaseFieldNames_Builder*)clearMessageField;
 - (TestCamelCaseFieldNames_Builder*) setMessageField:(ForeignMessage*) value;
 - (TestCamelCaseFieldNames_Builder*) setMessageFieldBuilder:(ForeignMessage_Builder*) builderForValue;
 - (TestCamelCaseFieldNames_Builder*) mergeMessageField:(ForeignMessage*) value;
-- (TestCamelCaseFieldNames_Builder*) clearMessageField;
 
-- (BOOL) hasStringPieceField;
 - (NSString*) stringPieceField;
+- (BOOL)hasStringPieceField;
+- (TestCamelCaseFieldNames_Builder*)clearStringPieceField;
 - (TestCamelCaseFieldNames_Builder*) setStringPieceField:(NSString*) value;
-- (TestCamelCaseFieldNames_Builder*) clearStringPieceField;
 
-- (BOOL) hasCordField;
 - (NSString*) cordField;
+- (BOOL)hasCordField;
+- (TestCamelCaseFieldNames_Builder*)clearCordField;
 - (TestCamelCaseFieldNames_Builder*) setCordField:(NSString*) value;
-- (TestCamelCaseFieldNames_Builder*) clearCordField;
 
 - (PBAppendableArray *)repeatedPrimitiveField;
-- (int32_t)repeatedPrimitiveFieldAtIndex:(NSUInteger)index;
+- (TestCamelCaseFieldNames_Builder*)clearRepeatedPrimitiveField;
 - (TestCamelCaseFieldNames_Builder *)addRepeatedPrimitiveField:(int32_t)value;
-- (TestCamelCaseFieldNames_Builder *)setRepeatedPrimitiveFieldArray:(NSArray *)array;
-- (TestCamelCaseFieldNames_Builder *)setRepeatedPrimitiveFieldValues:(const int32_t *)values count:(NSUInteger)count;
-- (TestCamelCaseFieldNames_Builder *)clearRepeatedPrimitiveField;
-
+- (TestCamelCaseFieldNames_Builder *)setRepeatedPrimitiveFieldArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedPrimitiveFieldArray(_:));
 
-- (NSString*)repeatedStringFieldAtIndex:(NSUInteger)index;
+- (NSMutableArray *)repeatedStringField;
+- (TestCamelCaseFieldNames_Builder*)clearRepeatedStringField;
 - (TestCamelCaseFieldNames_Builder *)addRepeatedStringField:(NSString*)value;
-- (TestCamelCaseFieldNames_Builder *)setRepeatedStringFieldArray:(NSArray *)array;
-- (TestCamelCaseFieldNames_Builder *)clearRepeatedStringField;
-
+- (TestCamelCaseFieldNames_Builder *)setRepeatedStringFieldArray:(NSArray<NSString*> *)array NS_SWIFT_NAME(setRepeatedStringFieldArray(_:));
++ (Class)expectedElementTypeForRepeatedStringFieldArray;
 
-- (ForeignEnum)repeatedEnumFieldAtIndex:(NSUInteger)index;
+- (PBAppendableArray*)repeatedEnumField;
+- (PBAppendableArray*)clearRepeatedEnumField;
 - (TestCamelCaseFieldNames_Builder *)addRepeatedEnumField:(ForeignEnum)value;
-- (TestCamelCaseFieldNames_Builder *)setRepeatedEnumFieldArray:(NSArray *)array;
-- (TestCamelCaseFieldNames_Builder *)setRepeatedEnumFieldValues:(const ForeignEnum *)values count:(NSUInteger)count;
-- (TestCamelCaseFieldNames_Builder *)clearRepeatedEnumField;
-
+- (TestCamelCaseFieldNames_Builder *)setRepeatedEnumFieldArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedEnumFieldArray(_:));
 
-- (ForeignMessage*)repeatedMessageFieldAtIndex:(NSUInteger)index;
+- (NSMutableArray *)repeatedMessageField;
+- (TestCamelCaseFieldNames_Builder*)clearRepeatedMessageField;
 - (TestCamelCaseFieldNames_Builder *)addRepeatedMessageField:(ForeignMessage*)value;
-- (TestCamelCaseFieldNames_Builder *)setRepeatedMessageFieldArray:(NSArray *)array;
-- (TestCamelCaseFieldNames_Builder *)clearRepeatedMessageField;
+- (TestCamelCaseFieldNames_Builder *)setRepeatedMessageFieldArray:(NSArray<ForeignMessage*> *)array NS_SWIFT_NAME(setRepeatedMessageFieldArray(_:));
++ (Class)expectedElementTypeForRepeatedMessageFieldArray;
 
-
-- (NSString*)repeatedStringPieceFieldAtIndex:(NSUInteger)index;
+- (NSMutableArray *)repeatedStringPieceField;
+- (TestCamelCaseFieldNames_Builder*)clearRepeatedStringPieceField;
 - (TestCamelCaseFieldNames_Builder *)addRepeatedStringPieceField:(NSString*)value;
-- (TestCamelCaseFieldNames_Builder *)setRepeatedStringPieceFieldArray:(NSArray *)array;
-- (TestCamelCaseFieldNames_Builder *)clearRepeatedStringPieceField;
+- (TestCamelCaseFieldNames_Builder *)setRepeatedStringPieceFieldArray:(NSArray<NSString*> *)array NS_SWIFT_NAME(setRepeatedStringPieceFieldArray(_:));
++ (Class)expectedElementTypeForRepeatedStringPieceFieldArray;
 
-
-- (NSString*)repeatedCordFieldAtIndex:(NSUInteger)index;
+- (NSMutableArray *)repeatedCordField;
+- (TestCamelCaseFieldNames_Builder*)clearRepeatedCordField;
 - (TestCamelCaseFieldNames_Builder *)addRepeatedCordField:(NSString*)value;
-- (TestCamelCaseFieldNames_Builder *)setRepeatedCordFieldArray:(NSArray *)array;
-- (TestCamelCaseFieldNames_Builder *)clearRepeatedCordField;
-@end
-
-@interface TestFieldOrderings : PBExtendableMessage {
-@private
-  BOOL hasMyFloat_:1;
-  BOOL hasMyInt_:1;
-  BOOL hasMyString_:1;
-  Float32 myFloat;
-  int64_t myInt;
-  NSString* myString;
-}
-- (BOOL) hasMyString;
-- (BOOL) hasMyInt;
-- (BOOL) hasMyFloat;
-@property (readonly, strong) NSString* myString;
-@property (readonly) int64_t myInt;
-@property (readonly) Float32 myFloat;
+- (TestCamelCaseFieldNames_Builder *)setRepeatedCordFieldArray:(NSArray<NSString*> *)array NS_SWIFT_NAME(setRepeatedCordFieldArray(_:));
++ (Class)expectedElementTypeForRepeatedCordFieldArray;
+@end
+
+@interface TestFieldOrderings : PBExtendableMessage
+- (BOOL)hasMyString;
+- (BOOL)hasMyInt;
+- (BOOL)hasMyFloat;
+@property (nonatomic, readonly) NSString* myString;
+@property (nonatomic, readonly) int64_t myInt;
+@property (nonatomic, readonly) Float32 myFloat;
 
 + (TestFieldOrderings*) defaultInstance;
 - (TestFieldOrderings*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestFieldOrderings_Builder*) builder;
 + (TestFieldOrderings_Builder*) builder;
 + (TestFieldOrderings_Builder*) builderWithPrototype:(TestFieldOrderings*) prototype;
 - (TestFieldOrderings_Builder*) toBuilder;
-
-+ (TestFieldOrderings*) parseFromData:(NSData*) data;
-+ (TestFieldOrderings*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestFieldOrderings*) parseFromInputStream:(NSInputStream*) input;
-+ (TestFieldOrderings*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestFieldOrderings*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestFieldOrderings*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestFieldOrderings_Builder : PBExtendableMessage_Builder {
-@private
-  TestFieldOrderings* result;
-}
+@interface TestFieldOrderings_Builder : PBExtendableMessage_Builder
 
 - (TestFieldOrderings*) defaultInstance;
 
-- (TestFieldOrderings_Builder*) clear;
-- (TestFieldOrderings_Builder*) clone;
-
 - (TestFieldOrderings*) build;
 - (TestFieldOrderings*) buildPartial;
 
 - (TestFieldOrderings_Builder*) mergeFrom:(TestFieldOrderings*) other;
-- (TestFieldOrderings_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestFieldOrderings_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasMyString;
 - (NSString*) myString;
+- (BOOL)hasMyString;
+- (TestFieldOrderings_Builder*)clearMyString;
 - (TestFieldOrderings_Builder*) setMyString:(NSString*) value;
-- (TestFieldOrderings_Builder*) clearMyString;
 
-- (BOOL) hasMyInt;
 - (int64_t) myInt;
+- (BOOL)hasMyInt;
+- (TestFieldOrderings_Builder*)clearMyInt;
 - (TestFieldOrderings_Builder*) setMyInt:(int64_t) value;
-- (TestFieldOrderings_Builder*) clearMyInt;
 
-- (BOOL) hasMyFloat;
 - (Float32) myFloat;
+- (BOOL)hasMyFloat;
+- (TestFieldOrderings_Builder*)clearMyFloat;
 - (TestFieldOrderings_Builder*) setMyFloat:(Float32) value;
-- (TestFieldOrderings_Builder*) clearMyFloat;
-@end
-
-@interface TestExtremeDefaultValues : PBGeneratedMessage {
-@private
-  BOOL hasNanDouble_:1;
-  BOOL hasNegInfDouble_:1;
-  BOOL hasInfDouble_:1;
-  BOOL hasInfFloat_:1;
-  BOOL hasSmallNegativeFloat_:1;
-  BOOL hasLargeFloat_:1;
-  BOOL hasNegativeFloat_:1;
-  BOOL hasNegativeOneFloat_:1;
-  BOOL hasSmallFloat_:1;
-  BOOL hasOneFloat_:1;
-  BOOL hasZeroFloat_:1;
-  BOOL hasNegInfFloat_:1;
-  BOOL hasNanFloat_:1;
-  BOOL hasSmallInt64_:1;
-  BOOL hasLargeUint64_:1;
-  BOOL hasSmallInt32_:1;
-  BOOL hasCppTrigraph_:1;
-  BOOL hasUtf8String_:1;
-  BOOL hasEscapedBytes_:1;
-  BOOL hasLargeUint32_:1;
-  Float64 nanDouble;
-  Float64 negInfDouble;
-  Float64 infDouble;
-  Float32 infFloat;
-  Float32 smallNegativeFloat;
-  Float32 largeFloat;
-  Float32 negativeFloat;
-  Float32 negativeOneFloat;
-  Float32 smallFloat;
-  Float32 oneFloat;
-  Float32 zeroFloat;
-  Float32 negInfFloat;
-  Float32 nanFloat;
-  int64_t smallInt64;
-  uint64_t largeUint64;
-  int32_t smallInt32;
-  NSString* cppTrigraph;
-  NSString* utf8String;
-  NSData* escapedBytes;
-  uint32_t largeUint32;
-}
-- (BOOL) hasEscapedBytes;
-- (BOOL) hasLargeUint32;
-- (BOOL) hasLargeUint64;
-- (BOOL) hasSmallInt32;
-- (BOOL) hasSmallInt64;
-- (BOOL) hasUtf8String;
-- (BOOL) hasZeroFloat;
-- (BOOL) hasOneFloat;
-- (BOOL) hasSmallFloat;
-- (BOOL) hasNegativeOneFloat;
-- (BOOL) hasNegativeFloat;
-- (BOOL) hasLargeFloat;
-- (BOOL) hasSmallNegativeFloat;
-- (BOOL) hasInfDouble;
-- (BOOL) hasNegInfDouble;
-- (BOOL) hasNanDouble;
-- (BOOL) hasInfFloat;
-- (BOOL) hasNegInfFloat;
-- (BOOL) hasNanFloat;
-- (BOOL) hasCppTrigraph;
-@property (readonly, strong) NSData* escapedBytes;
-@property (readonly) uint32_t largeUint32;
-@property (readonly) uint64_t largeUint64;
-@property (readonly) int32_t smallInt32;
-@property (readonly) int64_t smallInt64;
-@property (readonly, strong) NSString* utf8String;
-@property (readonly) Float32 zeroFloat;
-@property (readonly) Float32 oneFloat;
-@property (readonly) Float32 smallFloat;
-@property (readonly) Float32 negativeOneFloat;
-@property (readonly) Float32 negativeFloat;
-@property (readonly) Float32 largeFloat;
-@property (readonly) Float32 smallNegativeFloat;
-@property (readonly) Float64 infDouble;
-@property (readonly) Float64 negInfDouble;
-@property (readonly) Float64 nanDouble;
-@property (readonly) Float32 infFloat;
-@property (readonly) Float32 negInfFloat;
-@property (readonly) Float32 nanFloat;
-@property (readonly, strong) NSString* cppTrigraph;
+@end
+
+@interface TestExtremeDefaultValues : PBGeneratedMessage
+- (BOOL)hasEscapedBytes;
+- (BOOL)hasLargeUint32;
+- (BOOL)hasLargeUint64;
+- (BOOL)hasSmallInt32;
+- (BOOL)hasSmallInt64;
+- (BOOL)hasUtf8String;
+- (BOOL)hasZeroFloat;
+- (BOOL)hasOneFloat;
+- (BOOL)hasSmallFloat;
+- (BOOL)hasNegativeOneFloat;
+- (BOOL)hasNegativeFloat;
+- (BOOL)hasLargeFloat;
+- (BOOL)hasSmallNegativeFloat;
+- (BOOL)hasInfDouble;
+- (BOOL)hasNegInfDouble;
+- (BOOL)hasNanDouble;
+- (BOOL)hasInfFloat;
+- (BOOL)hasNegInfFloat;
+- (BOOL)hasNanFloat;
+- (BOOL)hasCppTrigraph;
+@property (nonatomic, readonly) NSData* escapedBytes;
+@property (nonatomic, readonly) uint32_t largeUint32;
+@property (nonatomic, readonly) uint64_t largeUint64;
+@property (nonatomic, readonly) int32_t smallInt32;
+@property (nonatomic, readonly) int64_t smallInt64;
+@property (nonatomic, readonly) NSString* utf8String;
+@property (nonatomic, readonly) Float32 zeroFloat;
+@property (nonatomic, readonly) Float32 oneFloat;
+@property (nonatomic, readonly) Float32 smallFloat;
+@property (nonatomic, readonly) Float32 negativeOneFloat;
+@property (nonatomic, readonly) Float32 negativeFloat;
+@property (nonatomic, readonly) Float32 largeFloat;
+@property (nonatomic, readonly) Float32 smallNegativeFloat;
+@property (nonatomic, readonly) Float64 infDouble;
+@property (nonatomic, readonly) Float64 negInfDouble;
+@property (nonatomic, readonly) Float64 nanDouble;
+@property (nonatomic, readonly) Float32 infFloat;
+@property (nonatomic, readonly) Float32 negInfFloat;
+@property (nonatomic, readonly) Float32 nanFloat;
+@property (nonatomic, readonly) NSString* cppTrigraph;
 
 + (TestExtremeDefaultValues*) defaultInstance;
 - (TestExtremeDefaultValues*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestExtremeDefaultValues_Builder*) builder;
 + (TestExtremeDefaultValues_Builder*) builder;
 + (TestExtremeDefaultValues_Builder*) builderWithPrototype:(TestExtremeDefaultValues*) prototype;
 - (TestExtremeDefaultValues_Builder*) toBuilder;
-
-+ (TestExtremeDefaultValues*) parseFromData:(NSData*) data;
-+ (TestExtremeDefaultValues*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestExtremeDefaultValues*) parseFromInputStream:(NSInputStream*) input;
-+ (TestExtremeDefaultValues*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestExtremeDefaultValues*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestExtremeDefaultValues*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestExtremeDefaultValues_Builder : PBGeneratedMessage_Builder {
-@private
-  TestExtremeDefaultValues* result;
-}
-
+@interface TestExtremeDefaultValues_Builder : PBGeneratedMessage_Builder
 - (TestExtremeDefaultValues*) defaultInstance;
 
-- (TestExtremeDefaultValues_Builder*) clear;
-- (TestExtremeDefaultValues_Builder*) clone;
-
 - (TestExtremeDefaultValues*) build;
 - (TestExtremeDefaultValues*) buildPartial;
 
 - (TestExtremeDefaultValues_Builder*) mergeFrom:(TestExtremeDefaultValues*) other;
-- (TestExtremeDefaultValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestExtremeDefaultValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasEscapedBytes;
 - (NSData*) escapedBytes;
+- (BOOL)hasEscapedBytes;
+- (TestExtremeDefaultValues_Builder*)clearEscapedBytes;
 - (TestExtremeDefaultValues_Builder*) setEscapedBytes:(NSData*) value;
-- (TestExtremeDefaultValues_Builder*) clearEscapedBytes;
 
-- (BOOL) hasLargeUint32;
 - (uint32_t) largeUint32;
+- (BOOL)hasLargeUint32;
+- (TestExtremeDefaultValues_Builder*)clearLargeUint32;
 - (TestExtremeDefaultValues_Builder*) setLargeUint32:(uint32_t) value;
-- (TestExtremeDefaultValues_Builder*) clearLargeUint32;
 
-- (BOOL) hasLargeUint64;
 - (uint64_t) largeUint64;
+- (BOOL)hasLargeUint64;
+- (TestExtremeDefaultValues_Builder*)clearLargeUint64;
 - (TestExtremeDefaultValues_Builder*) setLargeUint64:(uint64_t) value;
-- (TestExtremeDefaultValues_Builder*) clearLargeUint64;
 
-- (BOOL) hasSmallInt32;
 - (int32_t) smallInt32;
+- (BOOL)hasSmallInt32;
+- (TestExtremeDefaultValues_Builder*)clearSmallInt32;
 - (TestExtremeDefaultValues_Builder*) setSmallInt32:(int32_t) value;
-- (TestExtremeDefaultValues_Builder*) clearSmallInt32;
 
-- (BOOL) hasSmallInt64;
 - (int64_t) smallInt64;
+- (BOOL)hasSmallInt64;
+- (TestExtremeDefaultValues_Builder*)clearSmallInt64;
 - (TestExtremeDefaultValues_Builder*) setSmallInt64:(int64_t) value;
-- (TestExtremeDefaultValues_Builder*) clearSmallInt64;
 
-- (BOOL) hasUtf8String;
 - (NSString*) utf8String;
+- (BOOL)hasUtf8String;
+- (TestExtremeDefaultValues_Builder*)clearUtf8String;
 - (TestExtremeDefaultValues_Builder*) setUtf8String:(NSString*) value;
-- (TestExtremeDefaultValues_Builder*) clearUtf8String;
 
-- (BOOL) hasZeroFloat;
 - (Float32) zeroFloat;
+- (BOOL)hasZeroFloat;
+- (TestExtremeDefaultValues_Builder*)clearZeroFloat;
 - (TestExtremeDefaultValues_Builder*) setZeroFloat:(Float32) value;
-- (TestExtremeDefaultValues_Builder*) clearZeroFloat;
 
-- (BOOL) hasOneFloat;
 - (Float32) oneFloat;
+- (BOOL)hasOneFloat;
+- (TestExtremeDefaultValues_Builder*)clearOneFloat;
 - (TestExtremeDefaultValues_Builder*) setOneFloat:(Float32) value;
-- (TestExtremeDefaultValues_Builder*) clearOneFloat;
 
-- (BOOL) hasSmallFloat;
 - (Float32) smallFloat;
+- (BOOL)hasSmallFloat;
+- (TestExtremeDefaultValues_Builder*)clearSmallFloat;
 - (TestExtremeDefaultValues_Builder*) setSmallFloat:(Float32) value;
-- (TestExtremeDefaultValues_Builder*) clearSmallFloat;
 
-- (BOOL) hasNegativeOneFloat;
 - (Float32) negativeOneFloat;
+- (BOOL)hasNegativeOneFloat;
+- (TestExtremeDefaultValues_Builder*)clearNegativeOneFloat;
 - (TestExtremeDefaultValues_Builder*) setNegativeOneFloat:(Float32) value;
-- (TestExtremeDefaultValues_Builder*) clearNegativeOneFloat;
 
-- (BOOL) hasNegativeFloat;
 - (Float32) negativeFloat;
+- (BOOL)hasNegativeFloat;
+- (TestExtremeDefaultValues_Builder*)clearNegativeFloat;
 - (TestExtremeDefaultValues_Builder*) setNegativeFloat:(Float32) value;
-- (TestExtremeDefaultValues_Builder*) clearNegativeFloat;
 
-- (BOOL) hasLargeFloat;
 - (Float32) largeFloat;
+- (BOOL)hasLargeFloat;
+- (TestExtremeDefaultValues_Builder*)clearLargeFloat;
 - (TestExtremeDefaultValues_Builder*) setLargeFloat:(Float32) value;
-- (TestExtremeDefaultValues_Builder*) clearLargeFloat;
 
-- (BOOL) hasSmallNegativeFloat;
 - (Float32) smallNegativeFloat;
+- (BOOL)hasSmallNegativeFloat;
+- (TestExtremeDefaultValues_Builder*)clearSmallNegativeFloat;
 - (TestExtremeDefaultValues_Builder*) setSmallNegativeFloat:(Float32) value;
-- (TestExtremeDefaultValues_Builder*) clearSmallNegativeFloat;
 
-- (BOOL) hasInfDouble;
 - (Float64) infDouble;
+- (BOOL)hasInfDouble;
+- (TestExtremeDefaultValues_Builder*)clearInfDouble;
 - (TestExtremeDefaultValues_Builder*) setInfDouble:(Float64) value;
-- (TestExtremeDefaultValues_Builder*) clearInfDouble;
 
-- (BOOL) hasNegInfDouble;
 - (Float64) negInfDouble;
+- (BOOL)hasNegInfDouble;
+- (TestExtremeDefaultValues_Builder*)clearNegInfDouble;
 - (TestExtremeDefaultValues_Builder*) setNegInfDouble:(Float64) value;
-- (TestExtremeDefaultValues_Builder*) clearNegInfDouble;
 
-- (BOOL) hasNanDouble;
 - (Float64) nanDouble;
+- (BOOL)hasNanDouble;
+- (TestExtremeDefaultValues_Builder*)clearNanDouble;
 - (TestExtremeDefaultValues_Builder*) setNanDouble:(Float64) value;
-- (TestExtremeDefaultValues_Builder*) clearNanDouble;
 
-- (BOOL) hasInfFloat;
 - (Float32) infFloat;
+- (BOOL)hasInfFloat;
+- (TestExtremeDefaultValues_Builder*)clearInfFloat;
 - (TestExtremeDefaultValues_Builder*) setInfFloat:(Float32) value;
-- (TestExtremeDefaultValues_Builder*) clearInfFloat;
 
-- (BOOL) hasNegInfFloat;
 - (Float32) negInfFloat;
+- (BOOL)hasNegInfFloat;
+- (TestExtremeDefaultValues_Builder*)clearNegInfFloat;
 - (TestExtremeDefaultValues_Builder*) setNegInfFloat:(Float32) value;
-- (TestExtremeDefaultValues_Builder*) clearNegInfFloat;
 
-- (BOOL) hasNanFloat;
 - (Float32) nanFloat;
+- (BOOL)hasNanFloat;
+- (TestExtremeDefaultValues_Builder*)clearNanFloat;
 - (TestExtremeDefaultValues_Builder*) setNanFloat:(Float32) value;
-- (TestExtremeDefaultValues_Builder*) clearNanFloat;
 
-- (BOOL) hasCppTrigraph;
 - (NSString*) cppTrigraph;
+- (BOOL)hasCppTrigraph;
+- (TestExtremeDefaultValues_Builder*)clearCppTrigraph;
 - (TestExtremeDefaultValues_Builder*) setCppTrigraph:(NSString*) value;
-- (TestExtremeDefaultValues_Builder*) clearCppTrigraph;
 @end
 
-@interface SparseEnumMessage : PBGeneratedMessage {
-@private
-  BOOL hasSparseEnum_:1;
-  TestSparseEnum sparseEnum;
-}
-- (BOOL) hasSparseEnum;
-@property (readonly) TestSparseEnum sparseEnum;
+@interface SparseEnumMessage : PBGeneratedMessage
+- (BOOL)hasSparseEnum;
+@property (nonatomic, readonly) TestSparseEnum sparseEnum;
 
 + (SparseEnumMessage*) defaultInstance;
 - (SparseEnumMessage*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (SparseEnumMessage_Builder*) builder;
 + (SparseEnumMessage_Builder*) builder;
 + (SparseEnumMessage_Builder*) builderWithPrototype:(SparseEnumMessage*) prototype;
 - (SparseEnumMessage_Builder*) toBuilder;
-
-+ (SparseEnumMessage*) parseFromData:(NSData*) data;
-+ (SparseEnumMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (SparseEnumMessage*) parseFromInputStream:(NSInputStream*) input;
-+ (SparseEnumMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (SparseEnumMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (SparseEnumMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface SparseEnumMessage_Builder : PBGeneratedMessage_Builder {
-@private
-  SparseEnumMessage* result;
-}
-
+@interface SparseEnumMessage_Builder : PBGeneratedMessage_Builder
 - (SparseEnumMessage*) defaultInstance;
 
-- (SparseEnumMessage_Builder*) clear;
-- (SparseEnumMessage_Builder*) clone;
-
 - (SparseEnumMessage*) build;
 - (SparseEnumMessage*) buildPartial;
 
 - (SparseEnumMessage_Builder*) mergeFrom:(SparseEnumMessage*) other;
-- (SparseEnumMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (SparseEnumMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasSparseEnum;
-- (TestSparseEnum) sparseEnum;
-- (SparseEnumMessage_Builder*) setSparseEnum:(TestSparseEnum) value;
-- (SparseEnumMessage_Builder*) clearSparseEnum;
+- (TestSparseEnum)sparseEnum;
+- (BOOL)hasSparseEnum;
+- (SparseEnumMessage_Builder*)clearSparseEnum;
+- (SparseEnumMessage_Builder*)setSparseEnum:(TestSparseEnum) value;
 @end
 
-@interface OneString : PBGeneratedMessage {
-@private
-  BOOL hasData_:1;
-  NSString* data;
-}
-- (BOOL) hasData;
-@property (readonly, strong) NSString* data;
+@interface OneString : PBGeneratedMessage
+- (BOOL)hasData;
+@property (nonatomic, readonly) NSString* data;
 
 + (OneString*) defaultInstance;
 - (OneString*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (OneString_Builder*) builder;
 + (OneString_Builder*) builder;
 + (OneString_Builder*) builderWithPrototype:(OneString*) prototype;
 - (OneString_Builder*) toBuilder;
-
-+ (OneString*) parseFromData:(NSData*) data;
-+ (OneString*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (OneString*) parseFromInputStream:(NSInputStream*) input;
-+ (OneString*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (OneString*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (OneString*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface OneString_Builder : PBGeneratedMessage_Builder {
-@private
-  OneString* result;
-}
-
+@interface OneString_Builder : PBGeneratedMessage_Builder
 - (OneString*) defaultInstance;
 
-- (OneString_Builder*) clear;
-- (OneString_Builder*) clone;
-
 - (OneString*) build;
 - (OneString*) buildPartial;
 
 - (OneString_Builder*) mergeFrom:(OneString*) other;
-- (OneString_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (OneString_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasData;
 - (NSString*) data;
+- (BOOL)hasData;
+- (OneString_Builder*)clearData;
 - (OneString_Builder*) setData:(NSString*) value;
-- (OneString_Builder*) clearData;
 @end
 
-@interface OneBytes : PBGeneratedMessage {
-@private
-  BOOL hasData_:1;
-  NSData* data;
-}
-- (BOOL) hasData;
-@property (readonly, strong) NSData* data;
+@interface OneBytes : PBGeneratedMessage
+- (BOOL)hasData;
+@property (nonatomic, readonly) NSData* data;
 
 + (OneBytes*) defaultInstance;
 - (OneBytes*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (OneBytes_Builder*) builder;
 + (OneBytes_Builder*) builder;
 + (OneBytes_Builder*) builderWithPrototype:(OneBytes*) prototype;
 - (OneBytes_Builder*) toBuilder;
-
-+ (OneBytes*) parseFromData:(NSData*) data;
-+ (OneBytes*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (OneBytes*) parseFromInputStream:(NSInputStream*) input;
-+ (OneBytes*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (OneBytes*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (OneBytes*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface OneBytes_Builder : PBGeneratedMessage_Builder {
-@private
-  OneBytes* result;
-}
-
+@interface OneBytes_Builder : PBGeneratedMessage_Builder
 - (OneBytes*) defaultInstance;
 
-- (OneBytes_Builder*) clear;
-- (OneBytes_Builder*) clone;
-
 - (OneBytes*) build;
 - (OneBytes*) buildPartial;
 
 - (OneBytes_Builder*) mergeFrom:(OneBytes*) other;
-- (OneBytes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (OneBytes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasData;
 - (NSData*) data;
+- (BOOL)hasData;
+- (OneBytes_Builder*)clearData;
 - (OneBytes_Builder*) setData:(NSData*) value;
-- (OneBytes_Builder*) clearData;
-@end
-
-@interface TestPackedTypes : PBGeneratedMessage {
-@private
-  PBAppendableArray * packedBoolArray;
-  int32_t packedBoolMemoizedSerializedSize;
-  PBAppendableArray * packedDoubleArray;
-  int32_t packedDoubleMemoizedSerializedSize;
-  PBAppendableArray * packedFloatArray;
-  int32_t packedFloatMemoizedSerializedSize;
-  PBAppendableArray * packedInt64Array;
-  int32_t packedInt64MemoizedSerializedSize;
-  PBAppendableArray * packedUint64Array;
-  int32_t packedUint64MemoizedSerializedSize;
-  PBAppendableArray * packedInt32Array;
-  int32_t packedInt32MemoizedSerializedSize;
-  PBAppendableArray * packedFixed64Array;
-  int32_t packedFixed64MemoizedSerializedSize;
-  PBAppendableArray * packedFixed32Array;
-  int32_t packedFixed32MemoizedSerializedSize;
-  PBAppendableArray * packedUint32Array;
-  int32_t packedUint32MemoizedSerializedSize;
-  PBAppendableArray * packedEnumArray;
-  int32_t packedEnumMemoizedSerializedSize;
-  PBAppendableArray * packedSfixed32Array;
-  int32_t packedSfixed32MemoizedSerializedSize;
-  PBAppendableArray * packedSfixed64Array;
-  int32_t packedSfixed64MemoizedSerializedSize;
-  PBAppendableArray * packedSint32Array;
-  int32_t packedSint32MemoizedSerializedSize;
-  PBAppendableArray * packedSint64Array;
-  int32_t packedSint64MemoizedSerializedSize;
-}
-@property (readonly, strong) PBArray * packedInt32;
-@property (readonly, strong) PBArray * packedInt64;
-@property (readonly, strong) PBArray * packedUint32;
-@property (readonly, strong) PBArray * packedUint64;
-@property (readonly, strong) PBArray * packedSint32;
-@property (readonly, strong) PBArray * packedSint64;
-@property (readonly, strong) PBArray * packedFixed32;
-@property (readonly, strong) PBArray * packedFixed64;
-@property (readonly, strong) PBArray * packedSfixed32;
-@property (readonly, strong) PBArray * packedSfixed64;
-@property (readonly, strong) PBArray * packedFloat;
-@property (readonly, strong) PBArray * packedDouble;
-@property (readonly, strong) PBArray * packedBool;
-@property (readonly, strong) PBArray * packedEnum;
+@end
+
+@interface TestPackedTypes : PBGeneratedMessage
+@property (nonatomic, readonly, nullable) PBArray * packedInt32;
+@property (nonatomic, readonly, nullable) PBArray * packedInt64;
+@property (nonatomic, readonly, nullable) PBArray * packedUint32;
+@property (nonatomic, readonly, nullable) PBArray * packedUint64;
+@property (nonatomic, readonly, nullable) PBArray * packedSint32;
+@property (nonatomic, readonly, nullable) PBArray * packedSint64;
+@property (nonatomic, readonly, nullable) PBArray * packedFixed32;
+@property (nonatomic, readonly, nullable) PBArray * packedFixed64;
+@property (nonatomic, readonly, nullable) PBArray * packedSfixed32;
+@property (nonatomic, readonly, nullable) PBArray * packedSfixed64;
+@property (nonatomic, readonly, nullable) PBArray * packedFloat;
+@property (nonatomic, readonly, nullable) PBArray * packedDouble;
+@property (nonatomic, readonly, nullable) PBArray * packedBool;
+@property (nonatomic, readonly, nullable) PBArray * packedEnum;
 - (int32_t)packedInt32AtIndex:(NSUInteger)index;
 - (int64_t)packedInt64AtIndex:(NSUInteger)index;
 - (uint32_t)packedUint32AtIndex:(NSUInteger)index;
@@ -3072,168 +2128,106 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 + (TestPackedTypes*) defaultInstance;
 - (TestPackedTypes*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestPackedTypes_Builder*) builder;
 + (TestPackedTypes_Builder*) builder;
 + (TestPackedTypes_Builder*) builderWithPrototype:(TestPackedTypes*) prototype;
 - (TestPackedTypes_Builder*) toBuilder;
-
-+ (TestPackedTypes*) parseFromData:(NSData*) data;
-+ (TestPackedTypes*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestPackedTypes*) parseFromInputStream:(NSInputStream*) input;
-+ (TestPackedTypes*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestPackedTypes*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestPackedTypes*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestPackedTypes_Builder : PBGeneratedMessage_Builder {
-@private
-  TestPackedTypes* result;
-}
-
+@interface TestPackedTypes_Builder : PBGeneratedMessage_Builder
 - (TestPackedTypes*) defaultInstance;
 
-- (TestPackedTypes_Builder*) clear;
-- (TestPackedTypes_Builder*) clone;
-
 - (TestPackedTypes*) build;
 - (TestPackedTypes*) buildPartial;
 
 - (TestPackedTypes_Builder*) mergeFrom:(TestPackedTypes*) other;
-- (TestPackedTypes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestPackedTypes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
 - (PBAppendableArray *)packedInt32;
-- (int32_t)packedInt32AtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedInt32;
 - (TestPackedTypes_Builder *)addPackedInt32:(int32_t)value;
-- (TestPackedTypes_Builder *)setPackedInt32Array:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedInt32Values:(const int32_t *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedInt32;
+- (TestPackedTypes_Builder *)setPackedInt32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedInt32Array(_:));
 
 - (PBAppendableArray *)packedInt64;
-- (int64_t)packedInt64AtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedInt64;
 - (TestPackedTypes_Builder *)addPackedInt64:(int64_t)value;
-- (TestPackedTypes_Builder *)setPackedInt64Array:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedInt64Values:(const int64_t *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedInt64;
+- (TestPackedTypes_Builder *)setPackedInt64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedInt64Array(_:));
 
 - (PBAppendableArray *)packedUint32;
-- (uint32_t)packedUint32AtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedUint32;
 - (TestPackedTypes_Builder *)addPackedUint32:(uint32_t)value;
-- (TestPackedTypes_Builder *)setPackedUint32Array:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedUint32Values:(const uint32_t *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedUint32;
+- (TestPackedTypes_Builder *)setPackedUint32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedUint32Array(_:));
 
 - (PBAppendableArray *)packedUint64;
-- (uint64_t)packedUint64AtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedUint64;
 - (TestPackedTypes_Builder *)addPackedUint64:(uint64_t)value;
-- (TestPackedTypes_Builder *)setPackedUint64Array:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedUint64Values:(const uint64_t *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedUint64;
+- (TestPackedTypes_Builder *)setPackedUint64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedUint64Array(_:));
 
 - (PBAppendableArray *)packedSint32;
-- (int32_t)packedSint32AtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedSint32;
 - (TestPackedTypes_Builder *)addPackedSint32:(int32_t)value;
-- (TestPackedTypes_Builder *)setPackedSint32Array:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedSint32Values:(const int32_t *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedSint32;
+- (TestPackedTypes_Builder *)setPackedSint32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedSint32Array(_:));
 
 - (PBAppendableArray *)packedSint64;
-- (int64_t)packedSint64AtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedSint64;
 - (TestPackedTypes_Builder *)addPackedSint64:(int64_t)value;
-- (TestPackedTypes_Builder *)setPackedSint64Array:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedSint64Values:(const int64_t *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedSint64;
+- (TestPackedTypes_Builder *)setPackedSint64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedSint64Array(_:));
 
 - (PBAppendableArray *)packedFixed32;
-- (uint32_t)packedFixed32AtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedFixed32;
 - (TestPackedTypes_Builder *)addPackedFixed32:(uint32_t)value;
-- (TestPackedTypes_Builder *)setPackedFixed32Array:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedFixed32Values:(const uint32_t *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedFixed32;
+- (TestPackedTypes_Builder *)setPackedFixed32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedFixed32Array(_:));
 
 - (PBAppendableArray *)packedFixed64;
-- (uint64_t)packedFixed64AtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedFixed64;
 - (TestPackedTypes_Builder *)addPackedFixed64:(uint64_t)value;
-- (TestPackedTypes_Builder *)setPackedFixed64Array:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedFixed64Values:(const uint64_t *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedFixed64;
+- (TestPackedTypes_Builder *)setPackedFixed64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedFixed64Array(_:));
 
 - (PBAppendableArray *)packedSfixed32;
-- (int32_t)packedSfixed32AtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedSfixed32;
 - (TestPackedTypes_Builder *)addPackedSfixed32:(int32_t)value;
-- (TestPackedTypes_Builder *)setPackedSfixed32Array:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedSfixed32Values:(const int32_t *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedSfixed32;
+- (TestPackedTypes_Builder *)setPackedSfixed32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedSfixed32Array(_:));
 
 - (PBAppendableArray *)packedSfixed64;
-- (int64_t)packedSfixed64AtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedSfixed64;
 - (TestPackedTypes_Builder *)addPackedSfixed64:(int64_t)value;
-- (TestPackedTypes_Builder *)setPackedSfixed64Array:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedSfixed64Values:(const int64_t *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedSfixed64;
+- (TestPackedTypes_Builder *)setPackedSfixed64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedSfixed64Array(_:));
 
 - (PBAppendableArray *)packedFloat;
-- (Float32)packedFloatAtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedFloat;
 - (TestPackedTypes_Builder *)addPackedFloat:(Float32)value;
-- (TestPackedTypes_Builder *)setPackedFloatArray:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedFloatValues:(const Float32 *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedFloat;
+- (TestPackedTypes_Builder *)setPackedFloatArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedFloatArray(_:));
 
 - (PBAppendableArray *)packedDouble;
-- (Float64)packedDoubleAtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedDouble;
 - (TestPackedTypes_Builder *)addPackedDouble:(Float64)value;
-- (TestPackedTypes_Builder *)setPackedDoubleArray:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedDoubleValues:(const Float64 *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedDouble;
+- (TestPackedTypes_Builder *)setPackedDoubleArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedDoubleArray(_:));
 
 - (PBAppendableArray *)packedBool;
-- (BOOL)packedBoolAtIndex:(NSUInteger)index;
+- (TestPackedTypes_Builder*)clearPackedBool;
 - (TestPackedTypes_Builder *)addPackedBool:(BOOL)value;
-- (TestPackedTypes_Builder *)setPackedBoolArray:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedBoolValues:(const BOOL *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedBool;
+- (TestPackedTypes_Builder *)setPackedBoolArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedBoolArray(_:));
 
-- (PBAppendableArray *)packedEnum;
-- (ForeignEnum)packedEnumAtIndex:(NSUInteger)index;
+- (PBAppendableArray*)packedEnum;
+- (PBAppendableArray*)clearPackedEnum;
 - (TestPackedTypes_Builder *)addPackedEnum:(ForeignEnum)value;
-- (TestPackedTypes_Builder *)setPackedEnumArray:(NSArray *)array;
-- (TestPackedTypes_Builder *)setPackedEnumValues:(const ForeignEnum *)values count:(NSUInteger)count;
-- (TestPackedTypes_Builder *)clearPackedEnum;
-@end
-
-@interface TestUnpackedTypes : PBGeneratedMessage {
-@private
-  PBAppendableArray * unpackedBoolArray;
-  PBAppendableArray * unpackedDoubleArray;
-  PBAppendableArray * unpackedFloatArray;
-  PBAppendableArray * unpackedInt64Array;
-  PBAppendableArray * unpackedUint64Array;
-  PBAppendableArray * unpackedInt32Array;
-  PBAppendableArray * unpackedFixed64Array;
-  PBAppendableArray * unpackedFixed32Array;
-  PBAppendableArray * unpackedUint32Array;
-  PBAppendableArray * unpackedEnumArray;
-  PBAppendableArray * unpackedSfixed32Array;
-  PBAppendableArray * unpackedSfixed64Array;
-  PBAppendableArray * unpackedSint32Array;
-  PBAppendableArray * unpackedSint64Array;
-}
-@property (readonly, strong) PBArray * unpackedInt32;
-@property (readonly, strong) PBArray * unpackedInt64;
-@property (readonly, strong) PBArray * unpackedUint32;
-@property (readonly, strong) PBArray * unpackedUint64;
-@property (readonly, strong) PBArray * unpackedSint32;
-@property (readonly, strong) PBArray * unpackedSint64;
-@property (readonly, strong) PBArray * unpackedFixed32;
-@property (readonly, strong) PBArray * unpackedFixed64;
-@property (readonly, strong) PBArray * unpackedSfixed32;
-@property (readonly, strong) PBArray * unpackedSfixed64;
-@property (readonly, strong) PBArray * unpackedFloat;
-@property (readonly, strong) PBArray * unpackedDouble;
-@property (readonly, strong) PBArray * unpackedBool;
-@property (readonly, strong) PBArray * unpackedEnum;
+- (TestPackedTypes_Builder *)setPackedEnumArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedEnumArray(_:));
+@end
+
+@interface TestUnpackedTypes : PBGeneratedMessage
+@property (nonatomic, readonly, nullable) PBArray * unpackedInt32;
+@property (nonatomic, readonly, nullable) PBArray * unpackedInt64;
+@property (nonatomic, readonly, nullable) PBArray * unpackedUint32;
+@property (nonatomic, readonly, nullable) PBArray * unpackedUint64;
+@property (nonatomic, readonly, nullable) PBArray * unpackedSint32;
+@property (nonatomic, readonly, nullable) PBArray * unpackedSint64;
+@property (nonatomic, readonly, nullable) PBArray * unpackedFixed32;
+@property (nonatomic, readonly, nullable) PBArray * unpackedFixed64;
+@property (nonatomic, readonly, nullable) PBArray * unpackedSfixed32;
+@property (nonatomic, readonly, nullable) PBArray * unpackedSfixed64;
+@property (nonatomic, readonly, nullable) PBArray * unpackedFloat;
+@property (nonatomic, readonly, nullable) PBArray * unpackedDouble;
+@property (nonatomic, readonly, nullable) PBArray * unpackedBool;
+@property (nonatomic, readonly, nullable) PBArray * unpackedEnum;
 - (int32_t)unpackedInt32AtIndex:(NSUInteger)index;
 - (int64_t)unpackedInt64AtIndex:(NSUInteger)index;
 - (uint32_t)unpackedUint32AtIndex:(NSUInteger)index;
@@ -3252,348 +2246,220 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 + (TestUnpackedTypes*) defaultInstance;
 - (TestUnpackedTypes*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestUnpackedTypes_Builder*) builder;
 + (TestUnpackedTypes_Builder*) builder;
 + (TestUnpackedTypes_Builder*) builderWithPrototype:(TestUnpackedTypes*) prototype;
 - (TestUnpackedTypes_Builder*) toBuilder;
-
-+ (TestUnpackedTypes*) parseFromData:(NSData*) data;
-+ (TestUnpackedTypes*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestUnpackedTypes*) parseFromInputStream:(NSInputStream*) input;
-+ (TestUnpackedTypes*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestUnpackedTypes*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestUnpackedTypes*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestUnpackedTypes_Builder : PBGeneratedMessage_Builder {
-@private
-  TestUnpackedTypes* result;
-}
-
+@interface TestUnpackedTypes_Builder : PBGeneratedMessage_Builder
 - (TestUnpackedTypes*) defaultInstance;
 
-- (TestUnpackedTypes_Builder*) clear;
-- (TestUnpackedTypes_Builder*) clone;
-
 - (TestUnpackedTypes*) build;
 - (TestUnpackedTypes*) buildPartial;
 
 - (TestUnpackedTypes_Builder*) mergeFrom:(TestUnpackedTypes*) other;
-- (TestUnpackedTypes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestUnpackedTypes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
 - (PBAppendableArray *)unpackedInt32;
-- (int32_t)unpackedInt32AtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedInt32;
 - (TestUnpackedTypes_Builder *)addUnpackedInt32:(int32_t)value;
-- (TestUnpackedTypes_Builder *)setUnpackedInt32Array:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedInt32Values:(const int32_t *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedInt32;
+- (TestUnpackedTypes_Builder *)setUnpackedInt32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedInt32Array(_:));
 
 - (PBAppendableArray *)unpackedInt64;
-- (int64_t)unpackedInt64AtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedInt64;
 - (TestUnpackedTypes_Builder *)addUnpackedInt64:(int64_t)value;
-- (TestUnpackedTypes_Builder *)setUnpackedInt64Array:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedInt64Values:(const int64_t *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedInt64;
+- (TestUnpackedTypes_Builder *)setUnpackedInt64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedInt64Array(_:));
 
 - (PBAppendableArray *)unpackedUint32;
-- (uint32_t)unpackedUint32AtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedUint32;
 - (TestUnpackedTypes_Builder *)addUnpackedUint32:(uint32_t)value;
-- (TestUnpackedTypes_Builder *)setUnpackedUint32Array:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedUint32Values:(const uint32_t *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedUint32;
+- (TestUnpackedTypes_Builder *)setUnpackedUint32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedUint32Array(_:));
 
 - (PBAppendableArray *)unpackedUint64;
-- (uint64_t)unpackedUint64AtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedUint64;
 - (TestUnpackedTypes_Builder *)addUnpackedUint64:(uint64_t)value;
-- (TestUnpackedTypes_Builder *)setUnpackedUint64Array:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedUint64Values:(const uint64_t *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedUint64;
+- (TestUnpackedTypes_Builder *)setUnpackedUint64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedUint64Array(_:));
 
 - (PBAppendableArray *)unpackedSint32;
-- (int32_t)unpackedSint32AtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedSint32;
 - (TestUnpackedTypes_Builder *)addUnpackedSint32:(int32_t)value;
-- (TestUnpackedTypes_Builder *)setUnpackedSint32Array:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedSint32Values:(const int32_t *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedSint32;
+- (TestUnpackedTypes_Builder *)setUnpackedSint32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedSint32Array(_:));
 
 - (PBAppendableArray *)unpackedSint64;
-- (int64_t)unpackedSint64AtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedSint64;
 - (TestUnpackedTypes_Builder *)addUnpackedSint64:(int64_t)value;
-- (TestUnpackedTypes_Builder *)setUnpackedSint64Array:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedSint64Values:(const int64_t *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedSint64;
+- (TestUnpackedTypes_Builder *)setUnpackedSint64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedSint64Array(_:));
 
 - (PBAppendableArray *)unpackedFixed32;
-- (uint32_t)unpackedFixed32AtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedFixed32;
 - (TestUnpackedTypes_Builder *)addUnpackedFixed32:(uint32_t)value;
-- (TestUnpackedTypes_Builder *)setUnpackedFixed32Array:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedFixed32Values:(const uint32_t *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedFixed32;
+- (TestUnpackedTypes_Builder *)setUnpackedFixed32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedFixed32Array(_:));
 
 - (PBAppendableArray *)unpackedFixed64;
-- (uint64_t)unpackedFixed64AtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedFixed64;
 - (TestUnpackedTypes_Builder *)addUnpackedFixed64:(uint64_t)value;
-- (TestUnpackedTypes_Builder *)setUnpackedFixed64Array:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedFixed64Values:(const uint64_t *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedFixed64;
+- (TestUnpackedTypes_Builder *)setUnpackedFixed64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedFixed64Array(_:));
 
 - (PBAppendableArray *)unpackedSfixed32;
-- (int32_t)unpackedSfixed32AtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedSfixed32;
 - (TestUnpackedTypes_Builder *)addUnpackedSfixed32:(int32_t)value;
-- (TestUnpackedTypes_Builder *)setUnpackedSfixed32Array:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedSfixed32Values:(const int32_t *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedSfixed32;
+- (TestUnpackedTypes_Builder *)setUnpackedSfixed32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedSfixed32Array(_:));
 
 - (PBAppendableArray *)unpackedSfixed64;
-- (int64_t)unpackedSfixed64AtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedSfixed64;
 - (TestUnpackedTypes_Builder *)addUnpackedSfixed64:(int64_t)value;
-- (TestUnpackedTypes_Builder *)setUnpackedSfixed64Array:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedSfixed64Values:(const int64_t *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedSfixed64;
+- (TestUnpackedTypes_Builder *)setUnpackedSfixed64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedSfixed64Array(_:));
 
 - (PBAppendableArray *)unpackedFloat;
-- (Float32)unpackedFloatAtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedFloat;
 - (TestUnpackedTypes_Builder *)addUnpackedFloat:(Float32)value;
-- (TestUnpackedTypes_Builder *)setUnpackedFloatArray:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedFloatValues:(const Float32 *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedFloat;
+- (TestUnpackedTypes_Builder *)setUnpackedFloatArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedFloatArray(_:));
 
 - (PBAppendableArray *)unpackedDouble;
-- (Float64)unpackedDoubleAtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedDouble;
 - (TestUnpackedTypes_Builder *)addUnpackedDouble:(Float64)value;
-- (TestUnpackedTypes_Builder *)setUnpackedDoubleArray:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedDoubleValues:(const Float64 *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedDouble;
+- (TestUnpackedTypes_Builder *)setUnpackedDoubleArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedDoubleArray(_:));
 
 - (PBAppendableArray *)unpackedBool;
-- (BOOL)unpackedBoolAtIndex:(NSUInteger)index;
+- (TestUnpackedTypes_Builder*)clearUnpackedBool;
 - (TestUnpackedTypes_Builder *)addUnpackedBool:(BOOL)value;
-- (TestUnpackedTypes_Builder *)setUnpackedBoolArray:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedBoolValues:(const BOOL *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedBool;
+- (TestUnpackedTypes_Builder *)setUnpackedBoolArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedBoolArray(_:));
 
-- (PBAppendableArray *)unpackedEnum;
-- (ForeignEnum)unpackedEnumAtIndex:(NSUInteger)index;
+- (PBAppendableArray*)unpackedEnum;
+- (PBAppendableArray*)clearUnpackedEnum;
 - (TestUnpackedTypes_Builder *)addUnpackedEnum:(ForeignEnum)value;
-- (TestUnpackedTypes_Builder *)setUnpackedEnumArray:(NSArray *)array;
-- (TestUnpackedTypes_Builder *)setUnpackedEnumValues:(const ForeignEnum *)values count:(NSUInteger)count;
-- (TestUnpackedTypes_Builder *)clearUnpackedEnum;
+- (TestUnpackedTypes_Builder *)setUnpackedEnumArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setUnpackedEnumArray(_:));
 @end
 
-@interface TestPackedExtensions : PBExtendableMessage {
-@private
-}
+@interface TestPackedExtensions : PBExtendableMessage
 
 + (TestPackedExtensions*) defaultInstance;
 - (TestPackedExtensions*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestPackedExtensions_Builder*) builder;
 + (TestPackedExtensions_Builder*) builder;
 + (TestPackedExtensions_Builder*) builderWithPrototype:(TestPackedExtensions*) prototype;
 - (TestPackedExtensions_Builder*) toBuilder;
-
-+ (TestPackedExtensions*) parseFromData:(NSData*) data;
-+ (TestPackedExtensions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestPackedExtensions*) parseFromInputStream:(NSInputStream*) input;
-+ (TestPackedExtensions*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestPackedExtensions*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestPackedExtensions*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestPackedExtensions_Builder : PBExtendableMessage_Builder {
-@private
-  TestPackedExtensions* result;
-}
+@interface TestPackedExtensions_Builder : PBExtendableMessage_Builder
 
 - (TestPackedExtensions*) defaultInstance;
 
-- (TestPackedExtensions_Builder*) clear;
-- (TestPackedExtensions_Builder*) clone;
-
 - (TestPackedExtensions*) build;
 - (TestPackedExtensions*) buildPartial;
 
 - (TestPackedExtensions_Builder*) mergeFrom:(TestPackedExtensions*) other;
-- (TestPackedExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestPackedExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-@end
-
-@interface TestDynamicExtensions : PBGeneratedMessage {
-@private
-  BOOL hasScalarExtension_:1;
-  BOOL hasMessageExtension_:1;
-  BOOL hasDynamicMessageExtension_:1;
-  BOOL hasEnumExtension_:1;
-  BOOL hasDynamicEnumExtension_:1;
-  uint32_t scalarExtension;
-  ForeignMessage* messageExtension;
-  TestDynamicExtensions_DynamicMessageType* dynamicMessageExtension;
-  ForeignEnum enumExtension;
-  TestDynamicExtensions_DynamicEnumType dynamicEnumExtension;
-  NSMutableArray * repeatedExtensionArray;
-  PBAppendableArray * packedExtensionArray;
-  int32_t packedExtensionMemoizedSerializedSize;
-}
-- (BOOL) hasScalarExtension;
-- (BOOL) hasEnumExtension;
-- (BOOL) hasDynamicEnumExtension;
-- (BOOL) hasMessageExtension;
-- (BOOL) hasDynamicMessageExtension;
-@property (readonly) uint32_t scalarExtension;
-@property (readonly) ForeignEnum enumExtension;
-@property (readonly) TestDynamicExtensions_DynamicEnumType dynamicEnumExtension;
-@property (readonly, strong) ForeignMessage* messageExtension;
-@property (readonly, strong) TestDynamicExtensions_DynamicMessageType* dynamicMessageExtension;
-@property (readonly, strong) NSArray * repeatedExtension;
-@property (readonly, strong) PBArray * packedExtension;
+@end
+
+@interface TestDynamicExtensions : PBGeneratedMessage
+- (BOOL)hasScalarExtension;
+- (BOOL)hasEnumExtension;
+- (BOOL)hasDynamicEnumExtension;
+- (BOOL)hasMessageExtension;
+- (BOOL)hasDynamicMessageExtension;
+@property (nonatomic, readonly) uint32_t scalarExtension;
+@property (nonatomic, readonly) ForeignEnum enumExtension;
+@property (nonatomic, readonly) TestDynamicExtensions_DynamicEnumType dynamicEnumExtension;
+@property (nonatomic, readonly) ForeignMessage* messageExtension;
+@property (nonatomic, readonly) TestDynamicExtensions_DynamicMessageType* dynamicMessageExtension;
+@property (nonatomic, readonly, nullable) NSArray<NSString*> * repeatedExtension;
+@property (nonatomic, readonly, nullable) PBArray * packedExtension;
 - (NSString*)repeatedExtensionAtIndex:(NSUInteger)index;
 - (int32_t)packedExtensionAtIndex:(NSUInteger)index;
 
 + (TestDynamicExtensions*) defaultInstance;
 - (TestDynamicExtensions*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestDynamicExtensions_Builder*) builder;
 + (TestDynamicExtensions_Builder*) builder;
 + (TestDynamicExtensions_Builder*) builderWithPrototype:(TestDynamicExtensions*) prototype;
 - (TestDynamicExtensions_Builder*) toBuilder;
-
-+ (TestDynamicExtensions*) parseFromData:(NSData*) data;
-+ (TestDynamicExtensions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDynamicExtensions*) parseFromInputStream:(NSInputStream*) input;
-+ (TestDynamicExtensions*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDynamicExtensions*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestDynamicExtensions*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestDynamicExtensions_DynamicMessageType : PBGeneratedMessage {
-@private
-  BOOL hasDynamicField_:1;
-  int32_t dynamicField;
-}
-- (BOOL) hasDynamicField;
-@property (readonly) int32_t dynamicField;
+@interface TestDynamicExtensions_DynamicMessageType : PBGeneratedMessage
+- (BOOL)hasDynamicField;
+@property (nonatomic, readonly) int32_t dynamicField;
 
 + (TestDynamicExtensions_DynamicMessageType*) defaultInstance;
 - (TestDynamicExtensions_DynamicMessageType*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestDynamicExtensions_DynamicMessageType_Builder*) builder;
 + (TestDynamicExtensions_DynamicMessageType_Builder*) builder;
 + (TestDynamicExtensions_DynamicMessageType_Builder*) builderWithPrototype:(TestDynamicExtensions_DynamicMessageType*) prototype;
 - (TestDynamicExtensions_DynamicMessageType_Builder*) toBuilder;
-
-+ (TestDynamicExtensions_DynamicMessageType*) parseFromData:(NSData*) data;
-+ (TestDynamicExtensions_DynamicMessageType*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDynamicExtensions_DynamicMessageType*) parseFromInputStream:(NSInputStream*) input;
-+ (TestDynamicExtensions_DynamicMessageType*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestDynamicExtensions_DynamicMessageType*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestDynamicExtensions_DynamicMessageType*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestDynamicExtensions_DynamicMessageType_Builder : PBGeneratedMessage_Builder {
-@private
-  TestDynamicExtensions_DynamicMessageType* result;
-}
-
+@interface TestDynamicExtensions_DynamicMessageType_Builder : PBGeneratedMessage_Builder
 - (TestDynamicExtensions_DynamicMessageType*) defaultInstance;
 
-- (TestDynamicExtensions_DynamicMessageType_Builder*) clear;
-- (TestDynamicExtensions_DynamicMessageType_Builder*) clone;
-
 - (TestDynamicExtensions_DynamicMessageType*) build;
 - (TestDynamicExtensions_DynamicMessageType*) buildPartial;
 
 - (TestDynamicExtensions_DynamicMessageType_Builder*) mergeFrom:(TestDynamicExtensions_DynamicMessageType*) other;
-- (TestDynamicExtensions_DynamicMessageType_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestDynamicExtensions_DynamicMessageType_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasDynamicField;
 - (int32_t) dynamicField;
+- (BOOL)hasDynamicField;
+- (TestDynamicExtensions_DynamicMessageType_Builder*)clearDynamicField;
 - (TestDynamicExtensions_DynamicMessageType_Builder*) setDynamicField:(int32_t) value;
-- (TestDynamicExtensions_DynamicMessageType_Builder*) clearDynamicField;
 @end
 
-@interface TestDynamicExtensions_Builder : PBGeneratedMessage_Builder {
-@private
-  TestDynamicExtensions* result;
-}
-
+@interface TestDynamicExtensions_Builder : PBGeneratedMessage_Builder
 - (TestDynamicExtensions*) defaultInstance;
 
-- (TestDynamicExtensions_Builder*) clear;
-- (TestDynamicExtensions_Builder*) clone;
-
 - (TestDynamicExtensions*) build;
 - (TestDynamicExtensions*) buildPartial;
 
 - (TestDynamicExtensions_Builder*) mergeFrom:(TestDynamicExtensions*) other;
-- (TestDynamicExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestDynamicExtensions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasScalarExtension;
 - (uint32_t) scalarExtension;
+- (BOOL)hasScalarExtension;
+- (TestDynamicExtensions_Builder*)clearScalarExtension;
 - (TestDynamicExtensions_Builder*) setScalarExtension:(uint32_t) value;
-- (TestDynamicExtensions_Builder*) clearScalarExtension;
 
-- (BOOL) hasEnumExtension;
-- (ForeignEnum) enumExtension;
-- (TestDynamicExtensions_Builder*) setEnumExtension:(ForeignEnum) value;
-- (TestDynamicExtensions_Builder*) clearEnumExtension;
+- (ForeignEnum)enumExtension;
+- (BOOL)hasEnumExtension;
+- (TestDynamicExtensions_Builder*)clearEnumExtension;
+- (TestDynamicExtensions_Builder*)setEnumExtension:(ForeignEnum) value;
 
-- (BOOL) hasDynamicEnumExtension;
-- (TestDynamicExtensions_DynamicEnumType) dynamicEnumExtension;
-- (TestDynamicExtensions_Builder*) setDynamicEnumExtension:(TestDynamicExtensions_DynamicEnumType) value;
-- (TestDynamicExtensions_Builder*) clearDynamicEnumExtension;
+- (TestDynamicExtensions_DynamicEnumType)dynamicEnumExtension;
+- (BOOL)hasDynamicEnumExtension;
+- (TestDynamicExtensions_Builder*)clearDynamicEnumExtension;
+- (TestDynamicExtensions_Builder*)setDynamicEnumExtension:(TestDynamicExtensions_DynamicEnumType) value;
 
-- (BOOL) hasMessageExtension;
 - (ForeignMessage*) messageExtension;
+- (BOOL)hasMessageExtension;
+- (TestDynamicExtensions_Builder*)clearMessageExtension;
 - (TestDynamicExtensions_Builder*) setMessageExtension:(ForeignMessage*) value;
 - (TestDynamicExtensions_Builder*) setMessageExtensionBuilder:(ForeignMessage_Builder*) builderForValue;
 - (TestDynamicExtensions_Builder*) mergeMessageExtension:(ForeignMessage*) value;
-- (TestDynamicExtensions_Builder*) clearMessageExtension;
 
-- (BOOL) hasDynamicMessageExtension;
 - (TestDynamicExtensions_DynamicMessageType*) dynamicMessageExtension;
+- (BOOL)hasDynamicMessageExtension;
+- (TestDynamicExtensions_Builder*)clearDynamicMessageExtension;
 - (TestDynamicExtensions_Builder*) setDynamicMessageExtension:(TestDynamicExtensions_DynamicMessageType*) value;
 - (TestDynamicExtensions_Builder*) setDynamicMessageExtensionBuilder:(TestDynamicExtensions_DynamicMessageType_Builder*) builderForValue;
 - (TestDynamicExtensions_Builder*) mergeDynamicMessageExtension:(TestDynamicExtensions_DynamicMessageType*) value;
-- (TestDynamicExtensions_Builder*) clearDynamicMessageExtension;
 
-- (NSString*)repeatedExtensionAtIndex:(NSUInteger)index;
+- (NSMutableArray *)repeatedExtension;
+- (TestDynamicExtensions_Builder*)clearRepeatedExtension;
 - (TestDynamicExtensions_Builder *)addRepeatedExtension:(NSString*)value;
-- (TestDynamicExtensions_Builder *)setRepeatedExtensionArray:(NSArray *)array;
-- (TestDynamicExtensions_Builder *)clearRepeatedExtension;
+- (TestDynamicExtensions_Builder *)setRepeatedExtensionArray:(NSArray<NSString*> *)array NS_SWIFT_NAME(setRepeatedExtensionArray(_:));
++ (Class)expectedElementTypeForRepeatedExtensionArray;
 
-- (int32_t)packedExtensionAtIndex:(NSUInteger)index;
+- (PBAppendableArray *)packedExtension;
+- (TestDynamicExtensions_Builder*)clearPackedExtension;
 - (TestDynamicExtensions_Builder *)addPackedExtension:(int32_t)value;
-- (TestDynamicExtensions_Builder *)setPackedExtensionArray:(NSArray *)array;
-- (TestDynamicExtensions_Builder *)setPackedExtensionValues:(const int32_t *)values count:(NSUInteger)count;
-- (TestDynamicExtensions_Builder *)clearPackedExtension;
-@end
-
-@interface TestRepeatedScalarDifferentTagSizes : PBGeneratedMessage {
-@private
-  PBAppendableArray * repeatedFloatArray;
-  PBAppendableArray * repeatedInt64Array;
-  PBAppendableArray * repeatedUint64Array;
-  PBAppendableArray * repeatedInt32Array;
-  PBAppendableArray * repeatedFixed64Array;
-  PBAppendableArray * repeatedFixed32Array;
-}
-@property (readonly, strong) PBArray * repeatedFixed32;
-@property (readonly, strong) PBArray * repeatedInt32;
-@property (readonly, strong) PBArray * repeatedFixed64;
-@property (readonly, strong) PBArray * repeatedInt64;
-@property (readonly, strong) PBArray * repeatedFloat;
-@property (readonly, strong) PBArray * repeatedUint64;
+- (TestDynamicExtensions_Builder *)setPackedExtensionArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setPackedExtensionArray(_:));
+@end
+
+@interface TestRepeatedScalarDifferentTagSizes : PBGeneratedMessage
+@property (nonatomic, readonly, nullable) PBArray * repeatedFixed32;
+@property (nonatomic, readonly, nullable) PBArray * repeatedInt32;
+@property (nonatomic, readonly, nullable) PBArray * repeatedFixed64;
+@property (nonatomic, readonly, nullable) PBArray * repeatedInt64;
+@property (nonatomic, readonly, nullable) PBArray * repeatedFloat;
+@property (nonatomic, readonly, nullable) PBArray * repeatedUint64;
 - (uint32_t)repeatedFixed32AtIndex:(NSUInteger)index;
 - (int32_t)repeatedInt32AtIndex:(NSUInteger)index;
 - (uint64_t)repeatedFixed64AtIndex:(NSUInteger)index;
@@ -3604,238 +2470,128 @@ BOOL TestDynamicExtensions_DynamicEnumTypeIsValidValue(TestDynamicExtensions_Dyn
 + (TestRepeatedScalarDifferentTagSizes*) defaultInstance;
 - (TestRepeatedScalarDifferentTagSizes*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestRepeatedScalarDifferentTagSizes_Builder*) builder;
 + (TestRepeatedScalarDifferentTagSizes_Builder*) builder;
 + (TestRepeatedScalarDifferentTagSizes_Builder*) builderWithPrototype:(TestRepeatedScalarDifferentTagSizes*) prototype;
 - (TestRepeatedScalarDifferentTagSizes_Builder*) toBuilder;
-
-+ (TestRepeatedScalarDifferentTagSizes*) parseFromData:(NSData*) data;
-+ (TestRepeatedScalarDifferentTagSizes*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestRepeatedScalarDifferentTagSizes*) parseFromInputStream:(NSInputStream*) input;
-+ (TestRepeatedScalarDifferentTagSizes*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestRepeatedScalarDifferentTagSizes*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestRepeatedScalarDifferentTagSizes*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestRepeatedScalarDifferentTagSizes_Builder : PBGeneratedMessage_Builder {
-@private
-  TestRepeatedScalarDifferentTagSizes* result;
-}
-
+@interface TestRepeatedScalarDifferentTagSizes_Builder : PBGeneratedMessage_Builder
 - (TestRepeatedScalarDifferentTagSizes*) defaultInstance;
 
-- (TestRepeatedScalarDifferentTagSizes_Builder*) clear;
-- (TestRepeatedScalarDifferentTagSizes_Builder*) clone;
-
 - (TestRepeatedScalarDifferentTagSizes*) build;
 - (TestRepeatedScalarDifferentTagSizes*) buildPartial;
 
 - (TestRepeatedScalarDifferentTagSizes_Builder*) mergeFrom:(TestRepeatedScalarDifferentTagSizes*) other;
-- (TestRepeatedScalarDifferentTagSizes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestRepeatedScalarDifferentTagSizes_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
 - (PBAppendableArray *)repeatedFixed32;
-- (uint32_t)repeatedFixed32AtIndex:(NSUInteger)index;
+- (TestRepeatedScalarDifferentTagSizes_Builder*)clearRepeatedFixed32;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedFixed32:(uint32_t)value;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed32Array:(NSArray *)array;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed32Values:(const uint32_t *)values count:(NSUInteger)count;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedFixed32;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedFixed32Array(_:));
 
 - (PBAppendableArray *)repeatedInt32;
-- (int32_t)repeatedInt32AtIndex:(NSUInteger)index;
+- (TestRepeatedScalarDifferentTagSizes_Builder*)clearRepeatedInt32;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedInt32:(int32_t)value;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt32Array:(NSArray *)array;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt32Values:(const int32_t *)values count:(NSUInteger)count;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedInt32;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt32Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedInt32Array(_:));
 
 - (PBAppendableArray *)repeatedFixed64;
-- (uint64_t)repeatedFixed64AtIndex:(NSUInteger)index;
+- (TestRepeatedScalarDifferentTagSizes_Builder*)clearRepeatedFixed64;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedFixed64:(uint64_t)value;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed64Array:(NSArray *)array;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed64Values:(const uint64_t *)values count:(NSUInteger)count;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedFixed64;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFixed64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedFixed64Array(_:));
 
 - (PBAppendableArray *)repeatedInt64;
-- (int64_t)repeatedInt64AtIndex:(NSUInteger)index;
+- (TestRepeatedScalarDifferentTagSizes_Builder*)clearRepeatedInt64;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedInt64:(int64_t)value;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt64Array:(NSArray *)array;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt64Values:(const int64_t *)values count:(NSUInteger)count;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedInt64;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedInt64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedInt64Array(_:));
 
 - (PBAppendableArray *)repeatedFloat;
-- (Float32)repeatedFloatAtIndex:(NSUInteger)index;
+- (TestRepeatedScalarDifferentTagSizes_Builder*)clearRepeatedFloat;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedFloat:(Float32)value;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFloatArray:(NSArray *)array;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFloatValues:(const Float32 *)values count:(NSUInteger)count;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedFloat;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedFloatArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedFloatArray(_:));
 
 - (PBAppendableArray *)repeatedUint64;
-- (uint64_t)repeatedUint64AtIndex:(NSUInteger)index;
+- (TestRepeatedScalarDifferentTagSizes_Builder*)clearRepeatedUint64;
 - (TestRepeatedScalarDifferentTagSizes_Builder *)addRepeatedUint64:(uint64_t)value;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedUint64Array:(NSArray *)array;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedUint64Values:(const uint64_t *)values count:(NSUInteger)count;
-- (TestRepeatedScalarDifferentTagSizes_Builder *)clearRepeatedUint64;
+- (TestRepeatedScalarDifferentTagSizes_Builder *)setRepeatedUint64Array:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedUint64Array(_:));
 @end
 
-@interface FooRequest : PBGeneratedMessage {
-@private
-}
+@interface FooRequest : PBGeneratedMessage
 
 + (FooRequest*) defaultInstance;
 - (FooRequest*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (FooRequest_Builder*) builder;
 + (FooRequest_Builder*) builder;
 + (FooRequest_Builder*) builderWithPrototype:(FooRequest*) prototype;
 - (FooRequest_Builder*) toBuilder;
-
-+ (FooRequest*) parseFromData:(NSData*) data;
-+ (FooRequest*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (FooRequest*) parseFromInputStream:(NSInputStream*) input;
-+ (FooRequest*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (FooRequest*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (FooRequest*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface FooRequest_Builder : PBGeneratedMessage_Builder {
-@private
-  FooRequest* result;
-}
-
+@interface FooRequest_Builder : PBGeneratedMessage_Builder
 - (FooRequest*) defaultInstance;
 
-- (FooRequest_Builder*) clear;
-- (FooRequest_Builder*) clone;
-
 - (FooRequest*) build;
 - (FooRequest*) buildPartial;
 
 - (FooRequest_Builder*) mergeFrom:(FooRequest*) other;
-- (FooRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (FooRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface FooResponse : PBGeneratedMessage {
-@private
-}
+@interface FooResponse : PBGeneratedMessage
 
 + (FooResponse*) defaultInstance;
 - (FooResponse*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (FooResponse_Builder*) builder;
 + (FooResponse_Builder*) builder;
 + (FooResponse_Builder*) builderWithPrototype:(FooResponse*) prototype;
 - (FooResponse_Builder*) toBuilder;
-
-+ (FooResponse*) parseFromData:(NSData*) data;
-+ (FooResponse*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (FooResponse*) parseFromInputStream:(NSInputStream*) input;
-+ (FooResponse*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (FooResponse*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (FooResponse*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface FooResponse_Builder : PBGeneratedMessage_Builder {
-@private
-  FooResponse* result;
-}
-
+@interface FooResponse_Builder : PBGeneratedMessage_Builder
 - (FooResponse*) defaultInstance;
 
-- (FooResponse_Builder*) clear;
-- (FooResponse_Builder*) clone;
-
 - (FooResponse*) build;
 - (FooResponse*) buildPartial;
 
 - (FooResponse_Builder*) mergeFrom:(FooResponse*) other;
-- (FooResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (FooResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface BarRequest : PBGeneratedMessage {
-@private
-}
+@interface BarRequest : PBGeneratedMessage
 
 + (BarRequest*) defaultInstance;
 - (BarRequest*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (BarRequest_Builder*) builder;
 + (BarRequest_Builder*) builder;
 + (BarRequest_Builder*) builderWithPrototype:(BarRequest*) prototype;
 - (BarRequest_Builder*) toBuilder;
-
-+ (BarRequest*) parseFromData:(NSData*) data;
-+ (BarRequest*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (BarRequest*) parseFromInputStream:(NSInputStream*) input;
-+ (BarRequest*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (BarRequest*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (BarRequest*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface BarRequest_Builder : PBGeneratedMessage_Builder {
-@private
-  BarRequest* result;
-}
-
+@interface BarRequest_Builder : PBGeneratedMessage_Builder
 - (BarRequest*) defaultInstance;
 
-- (BarRequest_Builder*) clear;
-- (BarRequest_Builder*) clone;
-
 - (BarRequest*) build;
 - (BarRequest*) buildPartial;
 
 - (BarRequest_Builder*) mergeFrom:(BarRequest*) other;
-- (BarRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (BarRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface BarResponse : PBGeneratedMessage {
-@private
-}
+@interface BarResponse : PBGeneratedMessage
 
 + (BarResponse*) defaultInstance;
 - (BarResponse*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (BarResponse_Builder*) builder;
 + (BarResponse_Builder*) builder;
 + (BarResponse_Builder*) builderWithPrototype:(BarResponse*) prototype;
 - (BarResponse_Builder*) toBuilder;
-
-+ (BarResponse*) parseFromData:(NSData*) data;
-+ (BarResponse*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (BarResponse*) parseFromInputStream:(NSInputStream*) input;
-+ (BarResponse*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (BarResponse*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (BarResponse*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface BarResponse_Builder : PBGeneratedMessage_Builder {
-@private
-  BarResponse* result;
-}
-
+@interface BarResponse_Builder : PBGeneratedMessage_Builder
 - (BarResponse*) defaultInstance;
 
-- (BarResponse_Builder*) clear;
-- (BarResponse_Builder*) clone;
-
 - (BarResponse*) build;
 - (BarResponse*) buildPartial;
 
 - (BarResponse_Builder*) mergeFrom:(BarResponse*) other;
-- (BarResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (BarResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
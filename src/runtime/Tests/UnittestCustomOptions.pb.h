@@ -98,32 +98,44 @@
   #endif
 #endif
 
-typedef enum {
+typedef NS_CLOSED_ENUM(int32_t, MethodOpt1) {
   MethodOpt1Methodopt1Val1 = 1,
   MethodOpt1Methodopt1Val2 = 2,
-} MethodOpt1;
+};
 
 BOOL MethodOpt1IsValidValue(MethodOpt1 value);
+MethodOpt1 MethodOpt1ReadTextFormat(PBTextFormatReader* reader);
+void MethodOpt1WriteJSON(PBJSONWriter* writer, const char* name, MethodOpt1 value);
+MethodOpt1 MethodOpt1ReadJSON(PBJSONReader* reader);
 
-typedef enum {
+typedef NS_CLOSED_ENUM(int32_t, AggregateEnum) {
   AggregateEnumValue = 1,
-} AggregateEnum;
+};
 
 BOOL AggregateEnumIsValidValue(AggregateEnum value);
+AggregateEnum AggregateEnumReadTextFormat(PBTextFormatReader* reader);
+void AggregateEnumWriteJSON(PBJSONWriter* writer, const char* name, AggregateEnum value);
+AggregateEnum AggregateEnumReadJSON(PBJSONReader* reader);
 
-typedef enum {
+typedef NS_CLOSED_ENUM(int32_t, TestMessageWithCustomOptions_AnEnum) {
   TestMessageWithCustomOptions_AnEnumAnenumVal1 = 1,
   TestMessageWithCustomOptions_AnEnumAnenumVal2 = 2,
-} TestMessageWithCustomOptions_AnEnum;
+};
 
 BOOL TestMessageWithCustomOptions_AnEnumIsValidValue(TestMessageWithCustomOptions_AnEnum value);
+TestMessageWithCustomOptions_AnEnum TestMessageWithCustomOptions_AnEnumReadTextFormat(PBTextFormatReader* reader);
+void TestMessageWithCustomOptions_AnEnumWriteJSON(PBJSONWriter* writer, const char* name, TestMessageWithCustomOptions_AnEnum value);
+TestMessageWithCustomOptions_AnEnum TestMessageWithCustomOptions_AnEnumReadJSON(PBJSONReader* reader);
 
-typedef enum {
+typedef NS_CLOSED_ENUM(int32_t, DummyMessageContainingEnum_TestEnumType) {
   DummyMessageContainingEnum_TestEnumTypeTestOptionEnumType1 = 22,
   DummyMessageContainingEnum_TestEnumTypeTestOptionEnumType2 = -23,
-} DummyMessageContainingEnum_TestEnumType;
+};
 
 BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingEnum_TestEnumType value);
+DummyMessageContainingEnum_TestEnumType DummyMessageContainingEnum_TestEnumTypeReadTextFormat(PBTextFormatReader* reader);
+void DummyMessageContainingEnum_TestEnumTypeWriteJSON(PBJSONWriter* writer, const char* name, DummyMessageContainingEnum_TestEnumType value);
+DummyMessageContainingEnum_TestEnumType DummyMessageContainingEnum_TestEnumTypeReadJSON(PBJSONReader* reader);
 
 
 @interface UnittestCustomOptionsRoot : NSObject {
@@ -172,1029 +184,574 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 + (id<PBExtensionField>) methodopt;
 @end
 
-@interface TestMessageWithCustomOptions : PBGeneratedMessage {
-@private
-  BOOL hasField1_:1;
-  NSString* field1;
-}
-- (BOOL) hasField1;
-@property (readonly, strong) NSString* field1;
+@interface TestMessageWithCustomOptions : PBGeneratedMessage
+- (BOOL)hasField1;
+@property (nonatomic, readonly) NSString* field1;
 
 + (TestMessageWithCustomOptions*) defaultInstance;
 - (TestMessageWithCustomOptions*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestMessageWithCustomOptions_Builder*) builder;
 + (TestMessageWithCustomOptions_Builder*) builder;
 + (TestMessageWithCustomOptions_Builder*) builderWithPrototype:(TestMessageWithCustomOptions*) prototype;
 - (TestMessageWithCustomOptions_Builder*) toBuilder;
-
-+ (TestMessageWithCustomOptions*) parseFromData:(NSData*) data;
-+ (TestMessageWithCustomOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestMessageWithCustomOptions*) parseFromInputStream:(NSInputStream*) input;
-+ (TestMessageWithCustomOptions*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestMessageWithCustomOptions*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestMessageWithCustomOptions*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestMessageWithCustomOptions_Builder : PBGeneratedMessage_Builder {
-@private
-  TestMessageWithCustomOptions* result;
-}
-
+@interface TestMessageWithCustomOptions_Builder : PBGeneratedMessage_Builder
 - (TestMessageWithCustomOptions*) defaultInstance;
 
-- (TestMessageWithCustomOptions_Builder*) clear;
-- (TestMessageWithCustomOptions_Builder*) clone;
-
 - (TestMessageWithCustomOptions*) build;
 - (TestMessageWithCustomOptions*) buildPartial;
 
 - (TestMessageWithCustomOptions_Builder*) mergeFrom:(TestMessageWithCustomOptions*) other;
-- (TestMessageWithCustomOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestMessageWithCustomOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasField1;
 - (NSString*) field1;
+- (BOOL)hasField1;
+- (TestMessageWithCustomOptions_Builder*)clearField1;
 - (TestMessageWithCustomOptions_Builder*) setField1:(NSString*) value;
-- (TestMessageWithCustomOptions_Builder*) clearField1;
 @end
 
-@interface CustomOptionFooRequest : PBGeneratedMessage {
-@private
-}
+@interface CustomOptionFooRequest : PBGeneratedMessage
 
 + (CustomOptionFooRequest*) defaultInstance;
 - (CustomOptionFooRequest*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (CustomOptionFooRequest_Builder*) builder;
 + (CustomOptionFooRequest_Builder*) builder;
 + (CustomOptionFooRequest_Builder*) builderWithPrototype:(CustomOptionFooRequest*) prototype;
 - (CustomOptionFooRequest_Builder*) toBuilder;
-
-+ (CustomOptionFooRequest*) parseFromData:(NSData*) data;
-+ (CustomOptionFooRequest*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (CustomOptionFooRequest*) parseFromInputStream:(NSInputStream*) input;
-+ (CustomOptionFooRequest*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (CustomOptionFooRequest*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (CustomOptionFooRequest*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface CustomOptionFooRequest_Builder : PBGeneratedMessage_Builder {
-@private
-  CustomOptionFooRequest* result;
-}
-
+@interface CustomOptionFooRequest_Builder : PBGeneratedMessage_Builder
 - (CustomOptionFooRequest*) defaultInstance;
 
-- (CustomOptionFooRequest_Builder*) clear;
-- (CustomOptionFooRequest_Builder*) clone;
-
 - (CustomOptionFooRequest*) build;
 - (CustomOptionFooRequest*) buildPartial;
 
 - (CustomOptionFooRequest_Builder*) mergeFrom:(CustomOptionFooRequest*) other;
-- (CustomOptionFooRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (CustomOptionFooRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface CustomOptionFooResponse : PBGeneratedMessage {
-@private
-}
+@interface CustomOptionFooResponse : PBGeneratedMessage
 
 + (CustomOptionFooResponse*) defaultInstance;
 - (CustomOptionFooResponse*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (CustomOptionFooResponse_Builder*) builder;
 + (CustomOptionFooResponse_Builder*) builder;
 + (CustomOptionFooResponse_Builder*) builderWithPrototype:(CustomOptionFooResponse*) prototype;
 - (CustomOptionFooResponse_Builder*) toBuilder;
-
-+ (CustomOptionFooResponse*) parseFromData:(NSData*) data;
-+ (CustomOptionFooResponse*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (CustomOptionFooResponse*) parseFromInputStream:(NSInputStream*) input;
-+ (CustomOptionFooResponse*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (CustomOptionFooResponse*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (CustomOptionFooResponse*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface CustomOptionFooResponse_Builder : PBGeneratedMessage_Builder {
-@private
-  CustomOptionFooResponse* result;
-}
-
+@interface CustomOptionFooResponse_Builder : PBGeneratedMessage_Builder
 - (CustomOptionFooResponse*) defaultInstance;
 
-- (CustomOptionFooResponse_Builder*) clear;
-- (CustomOptionFooResponse_Builder*) clone;
-
 - (CustomOptionFooResponse*) build;
 - (CustomOptionFooResponse*) buildPartial;
 
 - (CustomOptionFooResponse_Builder*) mergeFrom:(CustomOptionFooResponse*) other;
-- (CustomOptionFooResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (CustomOptionFooResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface DummyMessageContainingEnum : PBGeneratedMessage {
-@private
-}
+@interface DummyMessageContainingEnum : PBGeneratedMessage
 
 + (DummyMessageContainingEnum*) defaultInstance;
 - (DummyMessageContainingEnum*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (DummyMessageContainingEnum_Builder*) builder;
 + (DummyMessageContainingEnum_Builder*) builder;
 + (DummyMessageContainingEnum_Builder*) builderWithPrototype:(DummyMessageContainingEnum*) prototype;
 - (DummyMessageContainingEnum_Builder*) toBuilder;
-
-+ (DummyMessageContainingEnum*) parseFromData:(NSData*) data;
-+ (DummyMessageContainingEnum*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (DummyMessageContainingEnum*) parseFromInputStream:(NSInputStream*) input;
-+ (DummyMessageContainingEnum*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (DummyMessageContainingEnum*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (DummyMessageContainingEnum*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface DummyMessageContainingEnum_Builder : PBGeneratedMessage_Builder {
-@private
-  DummyMessageContainingEnum* result;
-}
-
+@interface DummyMessageContainingEnum_Builder : PBGeneratedMessage_Builder
 - (DummyMessageContainingEnum*) defaultInstance;
 
-- (DummyMessageContainingEnum_Builder*) clear;
-- (DummyMessageContainingEnum_Builder*) clone;
-
 - (DummyMessageContainingEnum*) build;
 - (DummyMessageContainingEnum*) buildPartial;
 
 - (DummyMessageContainingEnum_Builder*) mergeFrom:(DummyMessageContainingEnum*) other;
-- (DummyMessageContainingEnum_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (DummyMessageContainingEnum_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface DummyMessageInvalidAsOptionType : PBGeneratedMessage {
-@private
-}
+@interface DummyMessageInvalidAsOptionType : PBGeneratedMessage
 
 + (DummyMessageInvalidAsOptionType*) defaultInstance;
 - (DummyMessageInvalidAsOptionType*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (DummyMessageInvalidAsOptionType_Builder*) builder;
 + (DummyMessageInvalidAsOptionType_Builder*) builder;
 + (DummyMessageInvalidAsOptionType_Builder*) builderWithPrototype:(DummyMessageInvalidAsOptionType*) prototype;
 - (DummyMessageInvalidAsOptionType_Builder*) toBuilder;
-
-+ (DummyMessageInvalidAsOptionType*) parseFromData:(NSData*) data;
-+ (DummyMessageInvalidAsOptionType*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (DummyMessageInvalidAsOptionType*) parseFromInputStream:(NSInputStream*) input;
-+ (DummyMessageInvalidAsOptionType*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (DummyMessageInvalidAsOptionType*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (DummyMessageInvalidAsOptionType*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface DummyMessageInvalidAsOptionType_Builder : PBGeneratedMessage_Builder {
-@private
-  DummyMessageInvalidAsOptionType* result;
-}
-
+@interface DummyMessageInvalidAsOptionType_Builder : PBGeneratedMessage_Builder
 - (DummyMessageInvalidAsOptionType*) defaultInstance;
 
-- (DummyMessageInvalidAsOptionType_Builder*) clear;
-- (DummyMessageInvalidAsOptionType_Builder*) clone;
-
 - (DummyMessageInvalidAsOptionType*) build;
 - (DummyMessageInvalidAsOptionType*) buildPartial;
 
 - (DummyMessageInvalidAsOptionType_Builder*) mergeFrom:(DummyMessageInvalidAsOptionType*) other;
-- (DummyMessageInvalidAsOptionType_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (DummyMessageInvalidAsOptionType_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface CustomOptionMinIntegerValues : PBGeneratedMessage {
-@private
-}
+@interface CustomOptionMinIntegerValues : PBGeneratedMessage
 
 + (CustomOptionMinIntegerValues*) defaultInstance;
 - (CustomOptionMinIntegerValues*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (CustomOptionMinIntegerValues_Builder*) builder;
 + (CustomOptionMinIntegerValues_Builder*) builder;
 + (CustomOptionMinIntegerValues_Builder*) builderWithPrototype:(CustomOptionMinIntegerValues*) prototype;
 - (CustomOptionMinIntegerValues_Builder*) toBuilder;
-
-+ (CustomOptionMinIntegerValues*) parseFromData:(NSData*) data;
-+ (CustomOptionMinIntegerValues*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (CustomOptionMinIntegerValues*) parseFromInputStream:(NSInputStream*) input;
-+ (CustomOptionMinIntegerValues*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (CustomOptionMinIntegerValues*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (CustomOptionMinIntegerValues*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface CustomOptionMinIntegerValues_Builder : PBGeneratedMessage_Builder {
-@private
-  CustomOptionMinIntegerValues* result;
-}
-
+@interface CustomOptionMinIntegerValues_Builder : PBGeneratedMessage_Builder
 - (CustomOptionMinIntegerValues*) defaultInstance;
 
-- (CustomOptionMinIntegerValues_Builder*) clear;
-- (CustomOptionMinIntegerValues_Builder*) clone;
-
 - (CustomOptionMinIntegerValues*) build;
 - (CustomOptionMinIntegerValues*) buildPartial;
 
 - (CustomOptionMinIntegerValues_Builder*) mergeFrom:(CustomOptionMinIntegerValues*) other;
-- (CustomOptionMinIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (CustomOptionMinIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface CustomOptionMaxIntegerValues : PBGeneratedMessage {
-@private
-}
+@interface CustomOptionMaxIntegerValues : PBGeneratedMessage
 
 + (CustomOptionMaxIntegerValues*) defaultInstance;
 - (CustomOptionMaxIntegerValues*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (CustomOptionMaxIntegerValues_Builder*) builder;
 + (CustomOptionMaxIntegerValues_Builder*) builder;
 + (CustomOptionMaxIntegerValues_Builder*) builderWithPrototype:(CustomOptionMaxIntegerValues*) prototype;
 - (CustomOptionMaxIntegerValues_Builder*) toBuilder;
-
-+ (CustomOptionMaxIntegerValues*) parseFromData:(NSData*) data;
-+ (CustomOptionMaxIntegerValues*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (CustomOptionMaxIntegerValues*) parseFromInputStream:(NSInputStream*) input;
-+ (CustomOptionMaxIntegerValues*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (CustomOptionMaxIntegerValues*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (CustomOptionMaxIntegerValues*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface CustomOptionMaxIntegerValues_Builder : PBGeneratedMessage_Builder {
-@private
-  CustomOptionMaxIntegerValues* result;
-}
-
+@interface CustomOptionMaxIntegerValues_Builder : PBGeneratedMessage_Builder
 - (CustomOptionMaxIntegerValues*) defaultInstance;
 
-- (CustomOptionMaxIntegerValues_Builder*) clear;
-- (CustomOptionMaxIntegerValues_Builder*) clone;
-
 - (CustomOptionMaxIntegerValues*) build;
 - (CustomOptionMaxIntegerValues*) buildPartial;
 
 - (CustomOptionMaxIntegerValues_Builder*) mergeFrom:(CustomOptionMaxIntegerValues*) other;
-- (CustomOptionMaxIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (CustomOptionMaxIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface CustomOptionOtherValues : PBGeneratedMessage {
-@private
-}
+@interface CustomOptionOtherValues : PBGeneratedMessage
 
 + (CustomOptionOtherValues*) defaultInstance;
 - (CustomOptionOtherValues*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (CustomOptionOtherValues_Builder*) builder;
 + (CustomOptionOtherValues_Builder*) builder;
 + (CustomOptionOtherValues_Builder*) builderWithPrototype:(CustomOptionOtherValues*) prototype;
 - (CustomOptionOtherValues_Builder*) toBuilder;
-
-+ (CustomOptionOtherValues*) parseFromData:(NSData*) data;
-+ (CustomOptionOtherValues*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (CustomOptionOtherValues*) parseFromInputStream:(NSInputStream*) input;
-+ (CustomOptionOtherValues*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (CustomOptionOtherValues*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (CustomOptionOtherValues*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface CustomOptionOtherValues_Builder : PBGeneratedMessage_Builder {
-@private
-  CustomOptionOtherValues* result;
-}
-
+@interface CustomOptionOtherValues_Builder : PBGeneratedMessage_Builder
 - (CustomOptionOtherValues*) defaultInstance;
 
-- (CustomOptionOtherValues_Builder*) clear;
-- (CustomOptionOtherValues_Builder*) clone;
-
 - (CustomOptionOtherValues*) build;
 - (CustomOptionOtherValues*) buildPartial;
 
 - (CustomOptionOtherValues_Builder*) mergeFrom:(CustomOptionOtherValues*) other;
-- (CustomOptionOtherValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (CustomOptionOtherValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface SettingRealsFromPositiveInts : PBGeneratedMessage {
-@private
-}
+@interface SettingRealsFromPositiveInts : PBGeneratedMessage
 
 + (SettingRealsFromPositiveInts*) defaultInstance;
 - (SettingRealsFromPositiveInts*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (SettingRealsFromPositiveInts_Builder*) builder;
 + (SettingRealsFromPositiveInts_Builder*) builder;
 + (SettingRealsFromPositiveInts_Builder*) builderWithPrototype:(SettingRealsFromPositiveInts*) prototype;
 - (SettingRealsFromPositiveInts_Builder*) toBuilder;
-
-+ (SettingRealsFromPositiveInts*) parseFromData:(NSData*) data;
-+ (SettingRealsFromPositiveInts*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (SettingRealsFromPositiveInts*) parseFromInputStream:(NSInputStream*) input;
-+ (SettingRealsFromPositiveInts*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (SettingRealsFromPositiveInts*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (SettingRealsFromPositiveInts*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface SettingRealsFromPositiveInts_Builder : PBGeneratedMessage_Builder {
-@private
-  SettingRealsFromPositiveInts* result;
-}
-
+@interface SettingRealsFromPositiveInts_Builder : PBGeneratedMessage_Builder
 - (SettingRealsFromPositiveInts*) defaultInstance;
 
-- (SettingRealsFromPositiveInts_Builder*) clear;
-- (SettingRealsFromPositiveInts_Builder*) clone;
-
 - (SettingRealsFromPositiveInts*) build;
 - (SettingRealsFromPositiveInts*) buildPartial;
 
 - (SettingRealsFromPositiveInts_Builder*) mergeFrom:(SettingRealsFromPositiveInts*) other;
-- (SettingRealsFromPositiveInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (SettingRealsFromPositiveInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface SettingRealsFromNegativeInts : PBGeneratedMessage {
-@private
-}
+@interface SettingRealsFromNegativeInts : PBGeneratedMessage
 
 + (SettingRealsFromNegativeInts*) defaultInstance;
 - (SettingRealsFromNegativeInts*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (SettingRealsFromNegativeInts_Builder*) builder;
 + (SettingRealsFromNegativeInts_Builder*) builder;
 + (SettingRealsFromNegativeInts_Builder*) builderWithPrototype:(SettingRealsFromNegativeInts*) prototype;
 - (SettingRealsFromNegativeInts_Builder*) toBuilder;
-
-+ (SettingRealsFromNegativeInts*) parseFromData:(NSData*) data;
-+ (SettingRealsFromNegativeInts*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (SettingRealsFromNegativeInts*) parseFromInputStream:(NSInputStream*) input;
-+ (SettingRealsFromNegativeInts*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (SettingRealsFromNegativeInts*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (SettingRealsFromNegativeInts*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface SettingRealsFromNegativeInts_Builder : PBGeneratedMessage_Builder {
-@private
-  SettingRealsFromNegativeInts* result;
-}
-
+@interface SettingRealsFromNegativeInts_Builder : PBGeneratedMessage_Builder
 - (SettingRealsFromNegativeInts*) defaultInstance;
 
-- (SettingRealsFromNegativeInts_Builder*) clear;
-- (SettingRealsFromNegativeInts_Builder*) clone;
-
 - (SettingRealsFromNegativeInts*) build;
 - (SettingRealsFromNegativeInts*) buildPartial;
 
 - (SettingRealsFromNegativeInts_Builder*) mergeFrom:(SettingRealsFromNegativeInts*) other;
-- (SettingRealsFromNegativeInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (SettingRealsFromNegativeInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface ComplexOptionType1 : PBExtendableMessage {
-@private
-  BOOL hasFoo_:1;
-  BOOL hasFoo2_:1;
-  BOOL hasFoo3_:1;
-  int32_t foo;
-  int32_t foo2;
-  int32_t foo3;
-}
-- (BOOL) hasFoo;
-- (BOOL) hasFoo2;
-- (BOOL) hasFoo3;
-@property (readonly) int32_t foo;
-@property (readonly) int32_t foo2;
-@property (readonly) int32_t foo3;
+@interface ComplexOptionType1 : PBExtendableMessage
+- (BOOL)hasFoo;
+- (BOOL)hasFoo2;
+- (BOOL)hasFoo3;
+@property (nonatomic, readonly) int32_t foo;
+@property (nonatomic, readonly) int32_t foo2;
+@property (nonatomic, readonly) int32_t foo3;
 
 + (ComplexOptionType1*) defaultInstance;
 - (ComplexOptionType1*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (ComplexOptionType1_Builder*) builder;
 + (ComplexOptionType1_Builder*) builder;
 + (ComplexOptionType1_Builder*) builderWithPrototype:(ComplexOptionType1*) prototype;
 - (ComplexOptionType1_Builder*) toBuilder;
-
-+ (ComplexOptionType1*) parseFromData:(NSData*) data;
-+ (ComplexOptionType1*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOptionType1*) parseFromInputStream:(NSInputStream*) input;
-+ (ComplexOptionType1*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOptionType1*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (ComplexOptionType1*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface ComplexOptionType1_Builder : PBExtendableMessage_Builder {
-@private
-  ComplexOptionType1* result;
-}
+@interface ComplexOptionType1_Builder : PBExtendableMessage_Builder
 
 - (ComplexOptionType1*) defaultInstance;
 
-- (ComplexOptionType1_Builder*) clear;
-- (ComplexOptionType1_Builder*) clone;
-
 - (ComplexOptionType1*) build;
 - (ComplexOptionType1*) buildPartial;
 
 - (ComplexOptionType1_Builder*) mergeFrom:(ComplexOptionType1*) other;
-- (ComplexOptionType1_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (ComplexOptionType1_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasFoo;
 - (int32_t) foo;
+- (BOOL)hasFoo;
+- (ComplexOptionType1_Builder*)clearFoo;
 - (ComplexOptionType1_Builder*) setFoo:(int32_t) value;
-- (ComplexOptionType1_Builder*) clearFoo;
 
-- (BOOL) hasFoo2;
 - (int32_t) foo2;
+- (BOOL)hasFoo2;
+- (ComplexOptionType1_Builder*)clearFoo2;
 - (ComplexOptionType1_Builder*) setFoo2:(int32_t) value;
-- (ComplexOptionType1_Builder*) clearFoo2;
 
-- (BOOL) hasFoo3;
 - (int32_t) foo3;
+- (BOOL)hasFoo3;
+- (ComplexOptionType1_Builder*)clearFoo3;
 - (ComplexOptionType1_Builder*) setFoo3:(int32_t) value;
-- (ComplexOptionType1_Builder*) clearFoo3;
 @end
 
-@interface ComplexOptionType2 : PBExtendableMessage {
-@private
-  BOOL hasBaz_:1;
-  BOOL hasBar_:1;
-  BOOL hasFred_:1;
-  int32_t baz;
-  ComplexOptionType1* bar;
-  ComplexOptionType2_ComplexOptionType4* fred;
-}
-- (BOOL) hasBar;
-- (BOOL) hasBaz;
-- (BOOL) hasFred;
-@property (readonly, strong) ComplexOptionType1* bar;
-@property (readonly) int32_t baz;
-@property (readonly, strong) ComplexOptionType2_ComplexOptionType4* fred;
+@interface ComplexOptionType2 : PBExtendableMessage
+- (BOOL)hasBar;
+- (BOOL)hasBaz;
+- (BOOL)hasFred;
+@property (nonatomic, readonly) ComplexOptionType1* bar;
+@property (nonatomic, readonly) int32_t baz;
+@property (nonatomic, readonly) ComplexOptionType2_ComplexOptionType4* fred;
 
 + (ComplexOptionType2*) defaultInstance;
 - (ComplexOptionType2*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (ComplexOptionType2_Builder*) builder;
 + (ComplexOptionType2_Builder*) builder;
 + (ComplexOptionType2_Builder*) builderWithPrototype:(ComplexOptionType2*) prototype;
 - (ComplexOptionType2_Builder*) toBuilder;
-
-+ (ComplexOptionType2*) parseFromData:(NSData*) data;
-+ (ComplexOptionType2*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOptionType2*) parseFromInputStream:(NSInputStream*) input;
-+ (ComplexOptionType2*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOptionType2*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (ComplexOptionType2*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface ComplexOptionType2_ComplexOptionType4 : PBGeneratedMessage {
-@private
-  BOOL hasWaldo_:1;
-  int32_t waldo;
-}
-- (BOOL) hasWaldo;
-@property (readonly) int32_t waldo;
+@interface ComplexOptionType2_ComplexOptionType4 : PBGeneratedMessage
+- (BOOL)hasWaldo;
+@property (nonatomic, readonly) int32_t waldo;
++ (id<PBExtensionField>) complexOpt4;
 
 + (ComplexOptionType2_ComplexOptionType4*) defaultInstance;
 - (ComplexOptionType2_ComplexOptionType4*) defaultInstance;
 
-+ (id<PBExtensionField>) complexOpt4;
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (ComplexOptionType2_ComplexOptionType4_Builder*) builder;
 + (ComplexOptionType2_ComplexOptionType4_Builder*) builder;
 + (ComplexOptionType2_ComplexOptionType4_Builder*) builderWithPrototype:(ComplexOptionType2_ComplexOptionType4*) prototype;
 - (ComplexOptionType2_ComplexOptionType4_Builder*) toBuilder;
-
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromData:(NSData*) data;
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromInputStream:(NSInputStream*) input;
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface ComplexOptionType2_ComplexOptionType4_Builder : PBGeneratedMessage_Builder {
-@private
-  ComplexOptionType2_ComplexOptionType4* result;
-}
-
+@interface ComplexOptionType2_ComplexOptionType4_Builder : PBGeneratedMessage_Builder
 - (ComplexOptionType2_ComplexOptionType4*) defaultInstance;
 
-- (ComplexOptionType2_ComplexOptionType4_Builder*) clear;
-- (ComplexOptionType2_ComplexOptionType4_Builder*) clone;
-
 - (ComplexOptionType2_ComplexOptionType4*) build;
 - (ComplexOptionType2_ComplexOptionType4*) buildPartial;
 
 - (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFrom:(ComplexOptionType2_ComplexOptionType4*) other;
-- (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasWaldo;
 - (int32_t) waldo;
+- (BOOL)hasWaldo;
+- (ComplexOptionType2_ComplexOptionType4_Builder*)clearWaldo;
 - (ComplexOptionType2_ComplexOptionType4_Builder*) setWaldo:(int32_t) value;
-- (ComplexOptionType2_ComplexOptionType4_Builder*) clearWaldo;
 @end
 
-@interface ComplexOptionType2_Builder : PBExtendableMessage_Builder {
-@private
-  ComplexOptionType2* result;
-}
+@interface ComplexOptionType2_Builder : PBExtendableMessage_Builder
 
 - (ComplexOptionType2*) defaultInstance;
 
-- (ComplexOptionType2_Builder*) clear;
-- (ComplexOptionType2_Builder*) clone;
-
 - (ComplexOptionType2*) build;
 - (ComplexOptionType2*) buildPartial;
 
 - (ComplexOptionType2_Builder*) mergeFrom:(ComplexOptionType2*) other;
-- (ComplexOptionType2_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (ComplexOptionType2_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasBar;
 - (ComplexOptionType1*) bar;
+- (BOOL)hasBar;
+- (ComplexOptionType2_Builder*)clearBar;
 - (ComplexOptionType2_Builder*) setBar:(ComplexOptionType1*) value;
 - (ComplexOptionType2_Builder*) setBarBuilder:(ComplexOptionType1_Builder*) builderForValue;
 - (ComplexOptionType2_Builder*) mergeBar:(ComplexOptionType1*) value;
-- (ComplexOptionType2_Builder*) clearBar;
 
-- (BOOL) hasBaz;
 - (int32_t) baz;
+- (BOOL)hasBaz;
+- (ComplexOptionType2_Builder*)clearBaz;
 - (ComplexOptionType2_Builder*) setBaz:(int32_t) value;
-- (ComplexOptionType2_Builder*) clearBaz;
 
-- (BOOL) hasFred;
 - (ComplexOptionType2_ComplexOptionType4*) fred;
+- (BOOL)hasFred;
+- (ComplexOptionType2_Builder*)clearFred;
 - (ComplexOptionType2_Builder*) setFred:(ComplexOptionType2_ComplexOptionType4*) value;
 - (ComplexOptionType2_Builder*) setFredBuilder:(ComplexOptionType2_ComplexOptionType4_Builder*) builderForValue;
 - (ComplexOptionType2_Builder*) mergeFred:(ComplexOptionType2_ComplexOptionType4*) value;
-- (ComplexOptionType2_Builder*) clearFred;
 @end
 
-@interface ComplexOptionType3 : PBGeneratedMessage {
-@private
-  BOOL hasQux_:1;
-  BOOL hasComplexOptionType5_:1;
-  int32_t qux;
-  ComplexOptionType3_ComplexOptionType5* complexOptionType5;
-}
-- (BOOL) hasQux;
-- (BOOL) hasComplexOptionType5;
-@property (readonly) int32_t qux;
-@property (readonly, strong) ComplexOptionType3_ComplexOptionType5* complexOptionType5;
+@interface ComplexOptionType3 : PBGeneratedMessage
+- (BOOL)hasQux;
+- (BOOL)hasComplexOptionType5;
+@property (nonatomic, readonly) int32_t qux;
+@property (nonatomic, readonly) ComplexOptionType3_ComplexOptionType5* complexOptionType5;
 
 + (ComplexOptionType3*) defaultInstance;
 - (ComplexOptionType3*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (ComplexOptionType3_Builder*) builder;
 + (ComplexOptionType3_Builder*) builder;
 + (ComplexOptionType3_Builder*) builderWithPrototype:(ComplexOptionType3*) prototype;
 - (ComplexOptionType3_Builder*) toBuilder;
-
-+ (ComplexOptionType3*) parseFromData:(NSData*) data;
-+ (ComplexOptionType3*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOptionType3*) parseFromInputStream:(NSInputStream*) input;
-+ (ComplexOptionType3*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOptionType3*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (ComplexOptionType3*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface ComplexOptionType3_ComplexOptionType5 : PBGeneratedMessage {
-@private
-  BOOL hasPlugh_:1;
-  int32_t plugh;
-}
-- (BOOL) hasPlugh;
-@property (readonly) int32_t plugh;
+@interface ComplexOptionType3_ComplexOptionType5 : PBGeneratedMessage
+- (BOOL)hasPlugh;
+@property (nonatomic, readonly) int32_t plugh;
 
 + (ComplexOptionType3_ComplexOptionType5*) defaultInstance;
 - (ComplexOptionType3_ComplexOptionType5*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (ComplexOptionType3_ComplexOptionType5_Builder*) builder;
 + (ComplexOptionType3_ComplexOptionType5_Builder*) builder;
 + (ComplexOptionType3_ComplexOptionType5_Builder*) builderWithPrototype:(ComplexOptionType3_ComplexOptionType5*) prototype;
 - (ComplexOptionType3_ComplexOptionType5_Builder*) toBuilder;
-
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromData:(NSData*) data;
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromInputStream:(NSInputStream*) input;
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface ComplexOptionType3_ComplexOptionType5_Builder : PBGeneratedMessage_Builder {
-@private
-  ComplexOptionType3_ComplexOptionType5* result;
-}
-
+@interface ComplexOptionType3_ComplexOptionType5_Builder : PBGeneratedMessage_Builder
 - (ComplexOptionType3_ComplexOptionType5*) defaultInstance;
 
-- (ComplexOptionType3_ComplexOptionType5_Builder*) clear;
-- (ComplexOptionType3_ComplexOptionType5_Builder*) clone;
-
 - (ComplexOptionType3_ComplexOptionType5*) build;
 - (ComplexOptionType3_ComplexOptionType5*) buildPartial;
 
 - (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFrom:(ComplexOptionType3_ComplexOptionType5*) other;
-- (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasPlugh;
 - (int32_t) plugh;
+- (BOOL)hasPlugh;
+- (ComplexOptionType3_ComplexOptionType5_Builder*)clearPlugh;
 - (ComplexOptionType3_ComplexOptionType5_Builder*) setPlugh:(int32_t) value;
-- (ComplexOptionType3_ComplexOptionType5_Builder*) clearPlugh;
 @end
 
-@interface ComplexOptionType3_Builder : PBGeneratedMessage_Builder {
-@private
-  ComplexOptionType3* result;
-}
-
+@interface ComplexOptionType3_Builder : PBGeneratedMessage_Builder
 - (ComplexOptionType3*) defaultInstance;
 
-- (ComplexOptionType3_Builder*) clear;
-- (ComplexOptionType3_Builder*) clone;
-
 - (ComplexOptionType3*) build;
 - (ComplexOptionType3*) buildPartial;
 
 - (ComplexOptionType3_Builder*) mergeFrom:(ComplexOptionType3*) other;
-- (ComplexOptionType3_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (ComplexOptionType3_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasQux;
 - (int32_t) qux;
+- (BOOL)hasQux;
+- (ComplexOptionType3_Builder*)clearQux;
 - (ComplexOptionType3_Builder*) setQux:(int32_t) value;
-- (ComplexOptionType3_Builder*) clearQux;
 
-- (BOOL) hasComplexOptionType5;
 - (ComplexOptionType3_ComplexOptionType5*) complexOptionType5;
+- (BOOL)hasComplexOptionType5;
+- (ComplexOptionType3_Builder*)clearComplexOptionType5;
 - (ComplexOptionType3_Builder*) setComplexOptionType5:(ComplexOptionType3_ComplexOptionType5*) value;
 - (ComplexOptionType3_Builder*) setComplexOptionType5Builder:(ComplexOptionType3_ComplexOptionType5_Builder*) builderForValue;
 - (ComplexOptionType3_Builder*) mergeComplexOptionType5:(ComplexOptionType3_ComplexOptionType5*) value;
-- (ComplexOptionType3_Builder*) clearComplexOptionType5;
 @end
 
-@interface ComplexOpt6 : PBGeneratedMessage {
-@private
-  BOOL hasXyzzy_:1;
-  int32_t xyzzy;
-}
-- (BOOL) hasXyzzy;
-@property (readonly) int32_t xyzzy;
+@interface ComplexOpt6 : PBGeneratedMessage
+- (BOOL)hasXyzzy;
+@property (nonatomic, readonly) int32_t xyzzy;
 
 + (ComplexOpt6*) defaultInstance;
 - (ComplexOpt6*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (ComplexOpt6_Builder*) builder;
 + (ComplexOpt6_Builder*) builder;
 + (ComplexOpt6_Builder*) builderWithPrototype:(ComplexOpt6*) prototype;
 - (ComplexOpt6_Builder*) toBuilder;
-
-+ (ComplexOpt6*) parseFromData:(NSData*) data;
-+ (ComplexOpt6*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOpt6*) parseFromInputStream:(NSInputStream*) input;
-+ (ComplexOpt6*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ComplexOpt6*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (ComplexOpt6*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface ComplexOpt6_Builder : PBGeneratedMessage_Builder {
-@private
-  ComplexOpt6* result;
-}
-
+@interface ComplexOpt6_Builder : PBGeneratedMessage_Builder
 - (ComplexOpt6*) defaultInstance;
 
-- (ComplexOpt6_Builder*) clear;
-- (ComplexOpt6_Builder*) clone;
-
 - (ComplexOpt6*) build;
 - (ComplexOpt6*) buildPartial;
 
 - (ComplexOpt6_Builder*) mergeFrom:(ComplexOpt6*) other;
-- (ComplexOpt6_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (ComplexOpt6_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasXyzzy;
 - (int32_t) xyzzy;
+- (BOOL)hasXyzzy;
+- (ComplexOpt6_Builder*)clearXyzzy;
 - (ComplexOpt6_Builder*) setXyzzy:(int32_t) value;
-- (ComplexOpt6_Builder*) clearXyzzy;
 @end
 
-@interface VariousComplexOptions : PBGeneratedMessage {
-@private
-}
+@interface VariousComplexOptions : PBGeneratedMessage
 
 + (VariousComplexOptions*) defaultInstance;
 - (VariousComplexOptions*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (VariousComplexOptions_Builder*) builder;
 + (VariousComplexOptions_Builder*) builder;
 + (VariousComplexOptions_Builder*) builderWithPrototype:(VariousComplexOptions*) prototype;
 - (VariousComplexOptions_Builder*) toBuilder;
-
-+ (VariousComplexOptions*) parseFromData:(NSData*) data;
-+ (VariousComplexOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (VariousComplexOptions*) parseFromInputStream:(NSInputStream*) input;
-+ (VariousComplexOptions*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (VariousComplexOptions*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (VariousComplexOptions*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface VariousComplexOptions_Builder : PBGeneratedMessage_Builder {
-@private
-  VariousComplexOptions* result;
-}
-
+@interface VariousComplexOptions_Builder : PBGeneratedMessage_Builder
 - (VariousComplexOptions*) defaultInstance;
 
-- (VariousComplexOptions_Builder*) clear;
-- (VariousComplexOptions_Builder*) clone;
-
 - (VariousComplexOptions*) build;
 - (VariousComplexOptions*) buildPartial;
 
 - (VariousComplexOptions_Builder*) mergeFrom:(VariousComplexOptions*) other;
-- (VariousComplexOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (VariousComplexOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface AggregateMessageSet : PBExtendableMessage {
-@private
-}
+@interface AggregateMessageSet : PBExtendableMessage
 
 + (AggregateMessageSet*) defaultInstance;
 - (AggregateMessageSet*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (AggregateMessageSet_Builder*) builder;
 + (AggregateMessageSet_Builder*) builder;
 + (AggregateMessageSet_Builder*) builderWithPrototype:(AggregateMessageSet*) prototype;
 - (AggregateMessageSet_Builder*) toBuilder;
-
-+ (AggregateMessageSet*) parseFromData:(NSData*) data;
-+ (AggregateMessageSet*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (AggregateMessageSet*) parseFromInputStream:(NSInputStream*) input;
-+ (AggregateMessageSet*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (AggregateMessageSet*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (AggregateMessageSet*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface AggregateMessageSet_Builder : PBExtendableMessage_Builder {
-@private
-  AggregateMessageSet* result;
-}
+@interface AggregateMessageSet_Builder : PBExtendableMessage_Builder
 
 - (AggregateMessageSet*) defaultInstance;
 
-- (AggregateMessageSet_Builder*) clear;
-- (AggregateMessageSet_Builder*) clone;
-
 - (AggregateMessageSet*) build;
 - (AggregateMessageSet*) buildPartial;
 
 - (AggregateMessageSet_Builder*) mergeFrom:(AggregateMessageSet*) other;
-- (AggregateMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (AggregateMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface AggregateMessageSetElement : PBGeneratedMessage {
-@private
-  BOOL hasS_:1;
-  NSString* s;
-}
-- (BOOL) hasS;
-@property (readonly, strong) NSString* s;
+@interface AggregateMessageSetElement : PBGeneratedMessage
+- (BOOL)hasS;
+@property (nonatomic, readonly) NSString* s;
++ (id<PBExtensionField>) messageSetExtension;
 
 + (AggregateMessageSetElement*) defaultInstance;
 - (AggregateMessageSetElement*) defaultInstance;
 
-+ (id<PBExtensionField>) messageSetExtension;
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (AggregateMessageSetElement_Builder*) builder;
 + (AggregateMessageSetElement_Builder*) builder;
 + (AggregateMessageSetElement_Builder*) builderWithPrototype:(AggregateMessageSetElement*) prototype;
 - (AggregateMessageSetElement_Builder*) toBuilder;
-
-+ (AggregateMessageSetElement*) parseFromData:(NSData*) data;
-+ (AggregateMessageSetElement*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (AggregateMessageSetElement*) parseFromInputStream:(NSInputStream*) input;
-+ (AggregateMessageSetElement*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (AggregateMessageSetElement*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (AggregateMessageSetElement*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface AggregateMessageSetElement_Builder : PBGeneratedMessage_Builder {
-@private
-  AggregateMessageSetElement* result;
-}
-
+@interface AggregateMessageSetElement_Builder : PBGeneratedMessage_Builder
 - (AggregateMessageSetElement*) defaultInstance;
 
-- (AggregateMessageSetElement_Builder*) clear;
-- (AggregateMessageSetElement_Builder*) clone;
-
 - (AggregateMessageSetElement*) build;
 - (AggregateMessageSetElement*) buildPartial;
 
 - (AggregateMessageSetElement_Builder*) mergeFrom:(AggregateMessageSetElement*) other;
-- (AggregateMessageSetElement_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (AggregateMessageSetElement_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasS;
 - (NSString*) s;
+- (BOOL)hasS;
+- (AggregateMessageSetElement_Builder*)clearS;
 - (AggregateMessageSetElement_Builder*) setS:(NSString*) value;
-- (AggregateMessageSetElement_Builder*) clearS;
 @end
 
-@interface Aggregate : PBGeneratedMessage {
-@private
-  BOOL hasI_:1;
-  BOOL hasS_:1;
-  BOOL hasSub_:1;
-  BOOL hasFile_:1;
-  BOOL hasMset_:1;
-  int32_t i;
-  NSString* s;
-  Aggregate* sub;
-  PBFileOptions* file;
-  AggregateMessageSet* mset;
-}
-- (BOOL) hasI;
-- (BOOL) hasS;
-- (BOOL) hasSub;
-- (BOOL) hasFile;
-- (BOOL) hasMset;
-@property (readonly) int32_t i;
-@property (readonly, strong) NSString* s;
-@property (readonly, strong) Aggregate* sub;
-@property (readonly, strong) PBFileOptions* file;
-@property (readonly, strong) AggregateMessageSet* mset;
+@interface Aggregate : PBGeneratedMessage
+- (BOOL)hasI;
+- (BOOL)hasS;
+- (BOOL)hasSub;
+- (BOOL)hasFile;
+- (BOOL)hasMset;
+@property (nonatomic, readonly) int32_t i;
+@property (nonatomic, readonly) NSString* s;
+@property (nonatomic, readonly) Aggregate* sub;
+@property (nonatomic, readonly) PBFileOptions* file;
+@property (nonatomic, readonly) AggregateMessageSet* mset;
++ (id<PBExtensionField>) nested;
 
 + (Aggregate*) defaultInstance;
 - (Aggregate*) defaultInstance;
 
-+ (id<PBExtensionField>) nested;
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (Aggregate_Builder*) builder;
 + (Aggregate_Builder*) builder;
 + (Aggregate_Builder*) builderWithPrototype:(Aggregate*) prototype;
 - (Aggregate_Builder*) toBuilder;
-
-+ (Aggregate*) parseFromData:(NSData*) data;
-+ (Aggregate*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (Aggregate*) parseFromInputStream:(NSInputStream*) input;
-+ (Aggregate*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (Aggregate*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (Aggregate*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface Aggregate_Builder : PBGeneratedMessage_Builder {
-@private
-  Aggregate* result;
-}
-
+@interface Aggregate_Builder : PBGeneratedMessage_Builder
 - (Aggregate*) defaultInstance;
 
-- (Aggregate_Builder*) clear;
-- (Aggregate_Builder*) clone;
-
 - (Aggregate*) build;
 - (Aggregate*) buildPartial;
 
 - (Aggregate_Builder*) mergeFrom:(Aggregate*) other;
-- (Aggregate_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (Aggregate_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasI;
 - (int32_t) i;
+- (BOOL)hasI;
+- (Aggregate_Builder*)clearI;
 - (Aggregate_Builder*) setI:(int32_t) value;
-- (Aggregate_Builder*) clearI;
 
-- (BOOL) hasS;
 - (NSString*) s;
+- (BOOL)hasS;
+- (Aggregate_Builder*)clearS;
 - (Aggregate_Builder*) setS:(NSString*) value;
-- (Aggregate_Builder*) clearS;
 
-- (BOOL) hasSub;
 - (Aggregate*) sub;
+- (BOOL)hasSub;
+- (Aggregate_Builder*)clearSub;
 - (Aggregate_Builder*) setSub:(Aggregate*) value;
 - (Aggregate_Builder*) setSubBuilder:(Aggregate_Builder*) builderForValue;
 - (Aggregate_Builder*) mergeSub:(Aggregate*) value;
-- (Aggregate_Builder*) clearSub;
 
-- (BOOL) hasFile;
 - (PBFileOptions*) file;
+- (BOOL)hasFile;
+- (Aggregate_Builder*)clearFile;
 - (Aggregate_Builder*) setFile:(PBFileOptions*) value;
 - (Aggregate_Builder*) setFileBuilder:(PBFileOptions_Builder*) builderForValue;
 - (Aggregate_Builder*) mergeFile:(PBFileOptions*) value;
-- (Aggregate_Builder*) clearFile;
 
-- (BOOL) hasMset;
 - (AggregateMessageSet*) mset;
+- (BOOL)hasMset;
+- (Aggregate_Builder*)clearMset;
 - (Aggregate_Builder*) setMset:(AggregateMessageSet*) value;
 - (Aggregate_Builder*) setMsetBuilder:(AggregateMessageSet_Builder*) builderForValue;
 - (Aggregate_Builder*) mergeMset:(AggregateMessageSet*) value;
-- (Aggregate_Builder*) clearMset;
 @end
 
-@interface AggregateMessage : PBGeneratedMessage {
-@private
-  BOOL hasFieldname_:1;
-  int32_t fieldname;
-}
-- (BOOL) hasFieldname;
-@property (readonly) int32_t fieldname;
+@interface AggregateMessage : PBGeneratedMessage
+- (BOOL)hasFieldname;
+@property (nonatomic, readonly) int32_t fieldname;
 
 + (AggregateMessage*) defaultInstance;
 - (AggregateMessage*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (AggregateMessage_Builder*) builder;
 + (AggregateMessage_Builder*) builder;
 + (AggregateMessage_Builder*) builderWithPrototype:(AggregateMessage*) prototype;
 - (AggregateMessage_Builder*) toBuilder;
-
-+ (AggregateMessage*) parseFromData:(NSData*) data;
-+ (AggregateMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (AggregateMessage*) parseFromInputStream:(NSInputStream*) input;
-+ (AggregateMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (AggregateMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (AggregateMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface AggregateMessage_Builder : PBGeneratedMessage_Builder {
-@private
-  AggregateMessage* result;
-}
-
+@interface AggregateMessage_Builder : PBGeneratedMessage_Builder
 - (AggregateMessage*) defaultInstance;
 
-- (AggregateMessage_Builder*) clear;
-- (AggregateMessage_Builder*) clone;
-
 - (AggregateMessage*) build;
 - (AggregateMessage*) buildPartial;
 
 - (AggregateMessage_Builder*) mergeFrom:(AggregateMessage*) other;
-- (AggregateMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (AggregateMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasFieldname;
 - (int32_t) fieldname;
+- (BOOL)hasFieldname;
+- (AggregateMessage_Builder*)clearFieldname;
 - (AggregateMessage_Builder*) setFieldname:(int32_t) value;
-- (AggregateMessage_Builder*) clearFieldname;
 @end
 
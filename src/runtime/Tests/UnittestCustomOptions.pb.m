@@ -2,6 +2,9 @@
 
 #import "UnittestCustomOptions.pb.h"
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wshadow-ivar"
+
 @implementation UnittestCustomOptionsRoot
 static id<PBExtensionField> UnittestCustomOptionsRoot_fileOpt1 = nil;
 static id<PBExtensionField> UnittestCustomOptionsRoot_messageOpt1 = nil;
@@ -46,8 +49,15 @@ static id<PBExtensionField> UnittestCustomOptionsRoot_methodopt = nil;
 static id<PBExtensionField> ComplexOptionType2_ComplexOptionType4_complexOpt4 = nil;
 static id<PBExtensionField> AggregateMessageSetElement_messageSetExtension = nil;
 static id<PBExtensionField> Aggregate_nested = nil;
-static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static PBExtensionRegistry* extensionRegistry = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestCustomOptionsRoot registerAllExtensions:registry];
+    [PBDescriptorRoot registerAllExtensions:registry];
+    extensionRegistry = registry;
+  });
   return extensionRegistry;
 }
 
@@ -57,7 +67,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeUInt64
                                      extendedClass:[PBFileOptions class]
                                        fieldNumber:7736974
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -66,7 +76,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt32
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7739036
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -75,7 +85,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeFixed64
                                      extendedClass:[PBFieldOptions class]
                                        fieldNumber:7740936
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -84,7 +94,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt32
                                      extendedClass:[PBFieldOptions class]
                                        fieldNumber:7753913
-                                      defaultValue:[NSNumber numberWithInt:42]
+                                      defaultValue:@(42)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -93,7 +103,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSFixed32
                                      extendedClass:[PBEnumOptions class]
                                        fieldNumber:7753576
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -102,7 +112,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt32
                                      extendedClass:[PBEnumValueOptions class]
                                        fieldNumber:1560678
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -111,7 +121,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSInt64
                                      extendedClass:[PBServiceOptions class]
                                        fieldNumber:7887650
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -120,7 +130,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[PBMethodOptions class]
                                        fieldNumber:7890860
-                                      defaultValue:[NSNumber numberWithInt:MethodOpt1Methodopt1Val1]
+                                      defaultValue:@(MethodOpt1Methodopt1Val1)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -129,7 +139,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeBool
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7706090
-                                      defaultValue:[NSNumber numberWithBool:NO]
+                                      defaultValue:@(NO)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -138,7 +148,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt32
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7705709
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -147,7 +157,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt64
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7705542
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -156,7 +166,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeUInt32
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7704880
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -165,7 +175,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeUInt64
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7702367
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -174,7 +184,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSInt32
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7701568
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -183,7 +193,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSInt64
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7700863
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -192,7 +202,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeFixed32
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7700307
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -201,7 +211,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeFixed64
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7700194
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -210,7 +220,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSFixed32
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7698645
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -219,7 +229,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSFixed64
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7685475
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -228,7 +238,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeFloat
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7675390
-                                      defaultValue:[NSNumber numberWithFloat:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -237,7 +247,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeDouble
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7673293
-                                      defaultValue:[NSNumber numberWithDouble:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -264,7 +274,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[PBMessageOptions class]
                                        fieldNumber:7673233
-                                      defaultValue:[NSNumber numberWithInt:DummyMessageContainingEnum_TestEnumTypeTestOptionEnumType1]
+                                      defaultValue:@(DummyMessageContainingEnum_TestEnumTypeTestOptionEnumType1)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -282,7 +292,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt32
                                      extendedClass:[ComplexOptionType1 class]
                                        fieldNumber:7663707
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -300,7 +310,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt32
                                      extendedClass:[ComplexOptionType2 class]
                                        fieldNumber:7650927
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -440,10 +450,6 @@ static PBExtensionRegistry* extensionRegistry = nil;
                                         isRepeated:NO
                                           isPacked:NO
                             isMessageSetWireFormat:NO];
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    [PBDescriptorRoot registerAllExtensions:registry];
-    extensionRegistry = registry;
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -614,53 +620,66 @@ static PBExtensionRegistry* extensionRegistry = nil;
 @end
 
 BOOL MethodOpt1IsValidValue(MethodOpt1 value) {
-  switch (value) {
-    case MethodOpt1Methodopt1Val1:
-    case MethodOpt1Methodopt1Val2:
-      return YES;
-    default:
-      return NO;
-  }
+  return (uint32_t)value - 1U < 2U;
+}
+static const char* const MethodOpt1TextFormatNames[] = {
+  "METHODOPT1_VAL1",
+  "METHODOPT1_VAL2",
+};
+static const int32_t MethodOpt1TextFormatValues[] = {
+  1,
+  2,
+};
+MethodOpt1 MethodOpt1ReadTextFormat(PBTextFormatReader* reader) {
+  return (MethodOpt1)PBTextFormatReaderReadEnum(reader, MethodOpt1TextFormatNames, MethodOpt1TextFormatValues, 2);
+}
+void MethodOpt1WriteJSON(PBJSONWriter* writer, const char* name, MethodOpt1 value) {
+  PBJSONWriteEnum(writer, name, value, MethodOpt1TextFormatNames, MethodOpt1TextFormatValues, 2);
+}
+MethodOpt1 MethodOpt1ReadJSON(PBJSONReader* reader) {
+  return (MethodOpt1)PBJSONReaderReadEnum(reader, MethodOpt1TextFormatNames, MethodOpt1TextFormatValues, 2);
 }
 BOOL AggregateEnumIsValidValue(AggregateEnum value) {
-  switch (value) {
-    case AggregateEnumValue:
-      return YES;
-    default:
-      return NO;
-  }
+  return (uint32_t)value - 1U < 1U;
+}
+static const char* const AggregateEnumTextFormatNames[] = {
+  "VALUE",
+};
+static const int32_t AggregateEnumTextFormatValues[] = {
+  1,
+};
+AggregateEnum AggregateEnumReadTextFormat(PBTextFormatReader* reader) {
+  return (AggregateEnum)PBTextFormatReaderReadEnum(reader, AggregateEnumTextFormatNames, AggregateEnumTextFormatValues, 1);
+}
+void AggregateEnumWriteJSON(PBJSONWriter* writer, const char* name, AggregateEnum value) {
+  PBJSONWriteEnum(writer, name, value, AggregateEnumTextFormatNames, AggregateEnumTextFormatValues, 1);
+}
+AggregateEnum AggregateEnumReadJSON(PBJSONReader* reader) {
+  return (AggregateEnum)PBJSONReaderReadEnum(reader, AggregateEnumTextFormatNames, AggregateEnumTextFormatValues, 1);
 }
 @interface TestMessageWithCustomOptions ()
-@property (strong) NSString* field1;
+@property (nonatomic, readwrite) BOOL hasField1;
+@property (nonatomic, readwrite) NSString* field1;
 @end
 
 @implementation TestMessageWithCustomOptions
 
-- (BOOL) hasField1 {
-  return !!hasField1_;
-}
-- (void) setHasField1:(BOOL) value {
-  hasField1_ = !!value;
-}
-@synthesize field1;
-
 - (id) init {
   if ((self = [super init])) {
     self.field1 = @"";
   }
   return self;
 }
-static TestMessageWithCustomOptions* defaultTestMessageWithCustomOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [TestMessageWithCustomOptions class]) {
-    defaultTestMessageWithCustomOptionsInstance = [[TestMessageWithCustomOptions alloc] init];
-  }
-}
 + (TestMessageWithCustomOptions*) defaultInstance {
+  static TestMessageWithCustomOptions* defaultTestMessageWithCustomOptionsInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageWithCustomOptionsInstance = [[TestMessageWithCustomOptions alloc] init];
+  });
   return defaultTestMessageWithCustomOptionsInstance;
 }
 - (TestMessageWithCustomOptions*) defaultInstance {
-  return defaultTestMessageWithCustomOptionsInstance;
+  return [TestMessageWithCustomOptions defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -672,39 +691,21 @@ static TestMessageWithCustomOptions* defaultTestMessageWithCustomOptionsInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasField1) {
-    size += computeStringSize(1, self.field1);
+    size_ += computeStringSize(1, self.field1);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestMessageWithCustomOptions*) parseFromData:(NSData*) data {
-  return (TestMessageWithCustomOptions*)[[[TestMessageWithCustomOptions builder] mergeFromData:data] build];
-}
-+ (TestMessageWithCustomOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageWithCustomOptions*)[[[TestMessageWithCustomOptions builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessageWithCustomOptions*) parseFromInputStream:(NSInputStream*) input {
-  return (TestMessageWithCustomOptions*)[[[TestMessageWithCustomOptions builder] mergeFromInputStream:input] build];
-}
-+ (TestMessageWithCustomOptions*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageWithCustomOptions*)[[[TestMessageWithCustomOptions builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessageWithCustomOptions*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestMessageWithCustomOptions*)[[[TestMessageWithCustomOptions builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestMessageWithCustomOptions*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageWithCustomOptions*)[[[TestMessageWithCustomOptions builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestMessageWithCustomOptions_Builder*) builder {
-  return [[TestMessageWithCustomOptions_Builder alloc] init] ;
+  return [[TestMessageWithCustomOptions_Builder alloc] init];
 }
 + (TestMessageWithCustomOptions_Builder*) builderWithPrototype:(TestMessageWithCustomOptions*) prototype {
   return [[TestMessageWithCustomOptions builder] mergeFrom:prototype];
@@ -715,11 +716,11 @@ static TestMessageWithCustomOptions* defaultTestMessageWithCustomOptionsInstance
 - (TestMessageWithCustomOptions_Builder*) toBuilder {
   return [TestMessageWithCustomOptions builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasField1) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"field1", self.field1];
+    PBTextFormatWriteObject(writer, "field1", self.field1);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -732,7 +733,6 @@ static TestMessageWithCustomOptions* defaultTestMessageWithCustomOptionsInstance
   return
       self.hasField1 == otherMessage.hasField1 &&
       (!self.hasField1 || [self.field1 isEqual:otherMessage.field1]) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
@@ -743,39 +743,47 @@ static TestMessageWithCustomOptions* defaultTestMessageWithCustomOptionsInstance
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasField1) {
+    PBJSONWriteString(writer, "field1", self.field1);
+  }
+}
 @end
 
 BOOL TestMessageWithCustomOptions_AnEnumIsValidValue(TestMessageWithCustomOptions_AnEnum value) {
-  switch (value) {
-    case TestMessageWithCustomOptions_AnEnumAnenumVal1:
-    case TestMessageWithCustomOptions_AnEnumAnenumVal2:
-      return YES;
-    default:
-      return NO;
-  }
+  return (uint32_t)value - 1U < 2U;
+}
+static const char* const TestMessageWithCustomOptions_AnEnumTextFormatNames[] = {
+  "ANENUM_VAL1",
+  "ANENUM_VAL2",
+};
+static const int32_t TestMessageWithCustomOptions_AnEnumTextFormatValues[] = {
+  1,
+  2,
+};
+TestMessageWithCustomOptions_AnEnum TestMessageWithCustomOptions_AnEnumReadTextFormat(PBTextFormatReader* reader) {
+  return (TestMessageWithCustomOptions_AnEnum)PBTextFormatReaderReadEnum(reader, TestMessageWithCustomOptions_AnEnumTextFormatNames, TestMessageWithCustomOptions_AnEnumTextFormatValues, 2);
+}
+void TestMessageWithCustomOptions_AnEnumWriteJSON(PBJSONWriter* writer, const char* name, TestMessageWithCustomOptions_AnEnum value) {
+  PBJSONWriteEnum(writer, name, value, TestMessageWithCustomOptions_AnEnumTextFormatNames, TestMessageWithCustomOptions_AnEnumTextFormatValues, 2);
+}
+TestMessageWithCustomOptions_AnEnum TestMessageWithCustomOptions_AnEnumReadJSON(PBJSONReader* reader) {
+  return (TestMessageWithCustomOptions_AnEnum)PBJSONReaderReadEnum(reader, TestMessageWithCustomOptions_AnEnumTextFormatNames, TestMessageWithCustomOptions_AnEnumTextFormatValues, 2);
 }
 @interface TestMessageWithCustomOptions_Builder()
-@property (strong) TestMessageWithCustomOptions* result;
+@property (strong) TestMessageWithCustomOptions* builder_result;
 @end
 
 @implementation TestMessageWithCustomOptions_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestMessageWithCustomOptions alloc] init] ;
+    self.builder_result = [[TestMessageWithCustomOptions alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestMessageWithCustomOptions_Builder*) clear {
-  self.result = [[TestMessageWithCustomOptions alloc] init] ;
-  return self;
-}
-- (TestMessageWithCustomOptions_Builder*) clone {
-  return [TestMessageWithCustomOptions builderWithPrototype:result];
+  return builder_result;
 }
 - (TestMessageWithCustomOptions*) defaultInstance {
   return [TestMessageWithCustomOptions defaultInstance];
@@ -785,8 +793,8 @@ BOOL TestMessageWithCustomOptions_AnEnumIsValidValue(TestMessageWithCustomOption
   return [self buildPartial];
 }
 - (TestMessageWithCustomOptions*) buildPartial {
-  TestMessageWithCustomOptions* returnMe = result;
-  self.result = nil;
+  TestMessageWithCustomOptions* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestMessageWithCustomOptions_Builder*) mergeFrom:(TestMessageWithCustomOptions*) other {
@@ -799,9 +807,6 @@ BOOL TestMessageWithCustomOptions_AnEnumIsValidValue(TestMessageWithCustomOption
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestMessageWithCustomOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestMessageWithCustomOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -824,20 +829,61 @@ BOOL TestMessageWithCustomOptions_AnEnumIsValidValue(TestMessageWithCustomOption
     }
   }
 }
-- (BOOL) hasField1 {
-  return result.hasField1;
+- (TestMessageWithCustomOptions_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 6:
+        if (memcmp(name, "field1", 6) == 0) {
+          [self setField1:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (NSString*) field1 {
-  return result.field1;
+- (TestMessageWithCustomOptions_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 6:
+        if (memcmp(name, "field1", 6) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setField1:PBJSONReaderReadString(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestMessageWithCustomOptions_Builder*) setField1:(NSString*) value {
-  result.hasField1 = YES;
-  result.field1 = value;
+  builder_result.hasField1 = YES;
+  builder_result.field1 = value;
   return self;
 }
-- (TestMessageWithCustomOptions_Builder*) clearField1 {
-  result.hasField1 = NO;
-  result.field1 = @"";
+- (NSString*) field1 {
+  return builder_result.field1;
+}
+- (BOOL)hasField1 {
+ return builder_result.hasField1;
+}
+- (TestMessageWithCustomOptions_Builder*)clearField1 {
+  builder_result.hasField1 = NO;
+  builder_result.field1 = @"";
   return self;
 }
 @end
@@ -847,23 +893,21 @@ BOOL TestMessageWithCustomOptions_AnEnumIsValidValue(TestMessageWithCustomOption
 
 @implementation CustomOptionFooRequest
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
-+ (void) initialize {
-  if (self == [CustomOptionFooRequest class]) {
-    defaultCustomOptionFooRequestInstance = [[CustomOptionFooRequest alloc] init];
-  }
-}
 + (CustomOptionFooRequest*) defaultInstance {
+  static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultCustomOptionFooRequestInstance = [[CustomOptionFooRequest alloc] init];
+  });
   return defaultCustomOptionFooRequestInstance;
 }
 - (CustomOptionFooRequest*) defaultInstance {
-  return defaultCustomOptionFooRequestInstance;
+  return [CustomOptionFooRequest defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -872,36 +916,18 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (CustomOptionFooRequest*) parseFromData:(NSData*) data {
-  return (CustomOptionFooRequest*)[[[CustomOptionFooRequest builder] mergeFromData:data] build];
-}
-+ (CustomOptionFooRequest*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionFooRequest*)[[[CustomOptionFooRequest builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (CustomOptionFooRequest*) parseFromInputStream:(NSInputStream*) input {
-  return (CustomOptionFooRequest*)[[[CustomOptionFooRequest builder] mergeFromInputStream:input] build];
-}
-+ (CustomOptionFooRequest*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionFooRequest*)[[[CustomOptionFooRequest builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (CustomOptionFooRequest*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (CustomOptionFooRequest*)[[[CustomOptionFooRequest builder] mergeFromCodedInputStream:input] build];
-}
-+ (CustomOptionFooRequest*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionFooRequest*)[[[CustomOptionFooRequest builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (CustomOptionFooRequest_Builder*) builder {
-  return [[CustomOptionFooRequest_Builder alloc] init] ;
+  return [[CustomOptionFooRequest_Builder alloc] init];
 }
 + (CustomOptionFooRequest_Builder*) builderWithPrototype:(CustomOptionFooRequest*) prototype {
   return [[CustomOptionFooRequest builder] mergeFrom:prototype];
@@ -912,8 +938,8 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
 - (CustomOptionFooRequest_Builder*) toBuilder {
   return [CustomOptionFooRequest builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -931,30 +957,24 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface CustomOptionFooRequest_Builder()
-@property (strong) CustomOptionFooRequest* result;
+@property (strong) CustomOptionFooRequest* builder_result;
 @end
 
 @implementation CustomOptionFooRequest_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[CustomOptionFooRequest alloc] init] ;
+    self.builder_result = [[CustomOptionFooRequest alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (CustomOptionFooRequest_Builder*) clear {
-  self.result = [[CustomOptionFooRequest alloc] init] ;
-  return self;
-}
-- (CustomOptionFooRequest_Builder*) clone {
-  return [CustomOptionFooRequest builderWithPrototype:result];
+  return builder_result;
 }
 - (CustomOptionFooRequest*) defaultInstance {
   return [CustomOptionFooRequest defaultInstance];
@@ -964,8 +984,8 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
   return [self buildPartial];
 }
 - (CustomOptionFooRequest*) buildPartial {
-  CustomOptionFooRequest* returnMe = result;
-  self.result = nil;
+  CustomOptionFooRequest* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (CustomOptionFooRequest_Builder*) mergeFrom:(CustomOptionFooRequest*) other {
@@ -975,9 +995,6 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (CustomOptionFooRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (CustomOptionFooRequest_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -996,6 +1013,25 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
     }
   }
 }
+- (CustomOptionFooRequest_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (CustomOptionFooRequest_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface CustomOptionFooResponse ()
@@ -1003,23 +1039,21 @@ static CustomOptionFooRequest* defaultCustomOptionFooRequestInstance = nil;
 
 @implementation CustomOptionFooResponse
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
-+ (void) initialize {
-  if (self == [CustomOptionFooResponse class]) {
-    defaultCustomOptionFooResponseInstance = [[CustomOptionFooResponse alloc] init];
-  }
-}
 + (CustomOptionFooResponse*) defaultInstance {
+  static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultCustomOptionFooResponseInstance = [[CustomOptionFooResponse alloc] init];
+  });
   return defaultCustomOptionFooResponseInstance;
 }
 - (CustomOptionFooResponse*) defaultInstance {
-  return defaultCustomOptionFooResponseInstance;
+  return [CustomOptionFooResponse defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1028,36 +1062,18 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (CustomOptionFooResponse*) parseFromData:(NSData*) data {
-  return (CustomOptionFooResponse*)[[[CustomOptionFooResponse builder] mergeFromData:data] build];
-}
-+ (CustomOptionFooResponse*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionFooResponse*)[[[CustomOptionFooResponse builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (CustomOptionFooResponse*) parseFromInputStream:(NSInputStream*) input {
-  return (CustomOptionFooResponse*)[[[CustomOptionFooResponse builder] mergeFromInputStream:input] build];
-}
-+ (CustomOptionFooResponse*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionFooResponse*)[[[CustomOptionFooResponse builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (CustomOptionFooResponse*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (CustomOptionFooResponse*)[[[CustomOptionFooResponse builder] mergeFromCodedInputStream:input] build];
-}
-+ (CustomOptionFooResponse*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionFooResponse*)[[[CustomOptionFooResponse builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (CustomOptionFooResponse_Builder*) builder {
-  return [[CustomOptionFooResponse_Builder alloc] init] ;
+  return [[CustomOptionFooResponse_Builder alloc] init];
 }
 + (CustomOptionFooResponse_Builder*) builderWithPrototype:(CustomOptionFooResponse*) prototype {
   return [[CustomOptionFooResponse builder] mergeFrom:prototype];
@@ -1068,8 +1084,8 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
 - (CustomOptionFooResponse_Builder*) toBuilder {
   return [CustomOptionFooResponse builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -1087,30 +1103,24 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface CustomOptionFooResponse_Builder()
-@property (strong) CustomOptionFooResponse* result;
+@property (strong) CustomOptionFooResponse* builder_result;
 @end
 
 @implementation CustomOptionFooResponse_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[CustomOptionFooResponse alloc] init] ;
+    self.builder_result = [[CustomOptionFooResponse alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (CustomOptionFooResponse_Builder*) clear {
-  self.result = [[CustomOptionFooResponse alloc] init] ;
-  return self;
-}
-- (CustomOptionFooResponse_Builder*) clone {
-  return [CustomOptionFooResponse builderWithPrototype:result];
+  return builder_result;
 }
 - (CustomOptionFooResponse*) defaultInstance {
   return [CustomOptionFooResponse defaultInstance];
@@ -1120,8 +1130,8 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
   return [self buildPartial];
 }
 - (CustomOptionFooResponse*) buildPartial {
-  CustomOptionFooResponse* returnMe = result;
-  self.result = nil;
+  CustomOptionFooResponse* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (CustomOptionFooResponse_Builder*) mergeFrom:(CustomOptionFooResponse*) other {
@@ -1131,9 +1141,6 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (CustomOptionFooResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (CustomOptionFooResponse_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -1152,6 +1159,25 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
     }
   }
 }
+- (CustomOptionFooResponse_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (CustomOptionFooResponse_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface DummyMessageContainingEnum ()
@@ -1159,23 +1185,21 @@ static CustomOptionFooResponse* defaultCustomOptionFooResponseInstance = nil;
 
 @implementation DummyMessageContainingEnum
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static DummyMessageContainingEnum* defaultDummyMessageContainingEnumInstance = nil;
-+ (void) initialize {
-  if (self == [DummyMessageContainingEnum class]) {
-    defaultDummyMessageContainingEnumInstance = [[DummyMessageContainingEnum alloc] init];
-  }
-}
 + (DummyMessageContainingEnum*) defaultInstance {
+  static DummyMessageContainingEnum* defaultDummyMessageContainingEnumInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultDummyMessageContainingEnumInstance = [[DummyMessageContainingEnum alloc] init];
+  });
   return defaultDummyMessageContainingEnumInstance;
 }
 - (DummyMessageContainingEnum*) defaultInstance {
-  return defaultDummyMessageContainingEnumInstance;
+  return [DummyMessageContainingEnum defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1184,36 +1208,18 @@ static DummyMessageContainingEnum* defaultDummyMessageContainingEnumInstance = n
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (DummyMessageContainingEnum*) parseFromData:(NSData*) data {
-  return (DummyMessageContainingEnum*)[[[DummyMessageContainingEnum builder] mergeFromData:data] build];
-}
-+ (DummyMessageContainingEnum*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (DummyMessageContainingEnum*)[[[DummyMessageContainingEnum builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (DummyMessageContainingEnum*) parseFromInputStream:(NSInputStream*) input {
-  return (DummyMessageContainingEnum*)[[[DummyMessageContainingEnum builder] mergeFromInputStream:input] build];
-}
-+ (DummyMessageContainingEnum*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (DummyMessageContainingEnum*)[[[DummyMessageContainingEnum builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (DummyMessageContainingEnum*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (DummyMessageContainingEnum*)[[[DummyMessageContainingEnum builder] mergeFromCodedInputStream:input] build];
-}
-+ (DummyMessageContainingEnum*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (DummyMessageContainingEnum*)[[[DummyMessageContainingEnum builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (DummyMessageContainingEnum_Builder*) builder {
-  return [[DummyMessageContainingEnum_Builder alloc] init] ;
+  return [[DummyMessageContainingEnum_Builder alloc] init];
 }
 + (DummyMessageContainingEnum_Builder*) builderWithPrototype:(DummyMessageContainingEnum*) prototype {
   return [[DummyMessageContainingEnum builder] mergeFrom:prototype];
@@ -1224,8 +1230,8 @@ static DummyMessageContainingEnum* defaultDummyMessageContainingEnumInstance = n
 - (DummyMessageContainingEnum_Builder*) toBuilder {
   return [DummyMessageContainingEnum builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -1243,39 +1249,49 @@ static DummyMessageContainingEnum* defaultDummyMessageContainingEnumInstance = n
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
+static const uint32_t DummyMessageContainingEnum_TestEnumTypeValidBits[] = {
+  0x00000001U,
+  0x00002000U,
+};
 BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingEnum_TestEnumType value) {
-  switch (value) {
-    case DummyMessageContainingEnum_TestEnumTypeTestOptionEnumType1:
-    case DummyMessageContainingEnum_TestEnumTypeTestOptionEnumType2:
-      return YES;
-    default:
-      return NO;
-  }
+  uint32_t offset = (uint32_t)value - 4294967273U;
+  return offset < 46U && (DummyMessageContainingEnum_TestEnumTypeValidBits[offset >> 5] & (1U << (offset & 31))) != 0;
+}
+static const char* const DummyMessageContainingEnum_TestEnumTypeTextFormatNames[] = {
+  "TEST_OPTION_ENUM_TYPE1",
+  "TEST_OPTION_ENUM_TYPE2",
+};
+static const int32_t DummyMessageContainingEnum_TestEnumTypeTextFormatValues[] = {
+  22,
+  -23,
+};
+DummyMessageContainingEnum_TestEnumType DummyMessageContainingEnum_TestEnumTypeReadTextFormat(PBTextFormatReader* reader) {
+  return (DummyMessageContainingEnum_TestEnumType)PBTextFormatReaderReadEnum(reader, DummyMessageContainingEnum_TestEnumTypeTextFormatNames, DummyMessageContainingEnum_TestEnumTypeTextFormatValues, 2);
+}
+void DummyMessageContainingEnum_TestEnumTypeWriteJSON(PBJSONWriter* writer, const char* name, DummyMessageContainingEnum_TestEnumType value) {
+  PBJSONWriteEnum(writer, name, value, DummyMessageContainingEnum_TestEnumTypeTextFormatNames, DummyMessageContainingEnum_TestEnumTypeTextFormatValues, 2);
+}
+DummyMessageContainingEnum_TestEnumType DummyMessageContainingEnum_TestEnumTypeReadJSON(PBJSONReader* reader) {
+  return (DummyMessageContainingEnum_TestEnumType)PBJSONReaderReadEnum(reader, DummyMessageContainingEnum_TestEnumTypeTextFormatNames, DummyMessageContainingEnum_TestEnumTypeTextFormatValues, 2);
 }
 @interface DummyMessageContainingEnum_Builder()
-@property (strong) DummyMessageContainingEnum* result;
+@property (strong) DummyMessageContainingEnum* builder_result;
 @end
 
 @implementation DummyMessageContainingEnum_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[DummyMessageContainingEnum alloc] init] ;
+    self.builder_result = [[DummyMessageContainingEnum alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (DummyMessageContainingEnum_Builder*) clear {
-  self.result = [[DummyMessageContainingEnum alloc] init] ;
-  return self;
-}
-- (DummyMessageContainingEnum_Builder*) clone {
-  return [DummyMessageContainingEnum builderWithPrototype:result];
+  return builder_result;
 }
 - (DummyMessageContainingEnum*) defaultInstance {
   return [DummyMessageContainingEnum defaultInstance];
@@ -1285,8 +1301,8 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
   return [self buildPartial];
 }
 - (DummyMessageContainingEnum*) buildPartial {
-  DummyMessageContainingEnum* returnMe = result;
-  self.result = nil;
+  DummyMessageContainingEnum* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (DummyMessageContainingEnum_Builder*) mergeFrom:(DummyMessageContainingEnum*) other {
@@ -1296,9 +1312,6 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (DummyMessageContainingEnum_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (DummyMessageContainingEnum_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -1317,6 +1330,25 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
     }
   }
 }
+- (DummyMessageContainingEnum_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (DummyMessageContainingEnum_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface DummyMessageInvalidAsOptionType ()
@@ -1324,23 +1356,21 @@ BOOL DummyMessageContainingEnum_TestEnumTypeIsValidValue(DummyMessageContainingE
 
 @implementation DummyMessageInvalidAsOptionType
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeInstance = nil;
-+ (void) initialize {
-  if (self == [DummyMessageInvalidAsOptionType class]) {
-    defaultDummyMessageInvalidAsOptionTypeInstance = [[DummyMessageInvalidAsOptionType alloc] init];
-  }
-}
 + (DummyMessageInvalidAsOptionType*) defaultInstance {
+  static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultDummyMessageInvalidAsOptionTypeInstance = [[DummyMessageInvalidAsOptionType alloc] init];
+  });
   return defaultDummyMessageInvalidAsOptionTypeInstance;
 }
 - (DummyMessageInvalidAsOptionType*) defaultInstance {
-  return defaultDummyMessageInvalidAsOptionTypeInstance;
+  return [DummyMessageInvalidAsOptionType defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1349,36 +1379,18 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (DummyMessageInvalidAsOptionType*) parseFromData:(NSData*) data {
-  return (DummyMessageInvalidAsOptionType*)[[[DummyMessageInvalidAsOptionType builder] mergeFromData:data] build];
-}
-+ (DummyMessageInvalidAsOptionType*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (DummyMessageInvalidAsOptionType*)[[[DummyMessageInvalidAsOptionType builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (DummyMessageInvalidAsOptionType*) parseFromInputStream:(NSInputStream*) input {
-  return (DummyMessageInvalidAsOptionType*)[[[DummyMessageInvalidAsOptionType builder] mergeFromInputStream:input] build];
-}
-+ (DummyMessageInvalidAsOptionType*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (DummyMessageInvalidAsOptionType*)[[[DummyMessageInvalidAsOptionType builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (DummyMessageInvalidAsOptionType*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (DummyMessageInvalidAsOptionType*)[[[DummyMessageInvalidAsOptionType builder] mergeFromCodedInputStream:input] build];
-}
-+ (DummyMessageInvalidAsOptionType*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (DummyMessageInvalidAsOptionType*)[[[DummyMessageInvalidAsOptionType builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (DummyMessageInvalidAsOptionType_Builder*) builder {
-  return [[DummyMessageInvalidAsOptionType_Builder alloc] init] ;
+  return [[DummyMessageInvalidAsOptionType_Builder alloc] init];
 }
 + (DummyMessageInvalidAsOptionType_Builder*) builderWithPrototype:(DummyMessageInvalidAsOptionType*) prototype {
   return [[DummyMessageInvalidAsOptionType builder] mergeFrom:prototype];
@@ -1389,8 +1401,8 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
 - (DummyMessageInvalidAsOptionType_Builder*) toBuilder {
   return [DummyMessageInvalidAsOptionType builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -1408,30 +1420,24 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface DummyMessageInvalidAsOptionType_Builder()
-@property (strong) DummyMessageInvalidAsOptionType* result;
+@property (strong) DummyMessageInvalidAsOptionType* builder_result;
 @end
 
 @implementation DummyMessageInvalidAsOptionType_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[DummyMessageInvalidAsOptionType alloc] init] ;
+    self.builder_result = [[DummyMessageInvalidAsOptionType alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (DummyMessageInvalidAsOptionType_Builder*) clear {
-  self.result = [[DummyMessageInvalidAsOptionType alloc] init] ;
-  return self;
-}
-- (DummyMessageInvalidAsOptionType_Builder*) clone {
-  return [DummyMessageInvalidAsOptionType builderWithPrototype:result];
+  return builder_result;
 }
 - (DummyMessageInvalidAsOptionType*) defaultInstance {
   return [DummyMessageInvalidAsOptionType defaultInstance];
@@ -1441,8 +1447,8 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
   return [self buildPartial];
 }
 - (DummyMessageInvalidAsOptionType*) buildPartial {
-  DummyMessageInvalidAsOptionType* returnMe = result;
-  self.result = nil;
+  DummyMessageInvalidAsOptionType* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (DummyMessageInvalidAsOptionType_Builder*) mergeFrom:(DummyMessageInvalidAsOptionType*) other {
@@ -1452,9 +1458,6 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (DummyMessageInvalidAsOptionType_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (DummyMessageInvalidAsOptionType_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -1473,6 +1476,25 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
     }
   }
 }
+- (DummyMessageInvalidAsOptionType_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (DummyMessageInvalidAsOptionType_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface CustomOptionMinIntegerValues ()
@@ -1480,23 +1502,21 @@ static DummyMessageInvalidAsOptionType* defaultDummyMessageInvalidAsOptionTypeIn
 
 @implementation CustomOptionMinIntegerValues
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance = nil;
-+ (void) initialize {
-  if (self == [CustomOptionMinIntegerValues class]) {
-    defaultCustomOptionMinIntegerValuesInstance = [[CustomOptionMinIntegerValues alloc] init];
-  }
-}
 + (CustomOptionMinIntegerValues*) defaultInstance {
+  static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultCustomOptionMinIntegerValuesInstance = [[CustomOptionMinIntegerValues alloc] init];
+  });
   return defaultCustomOptionMinIntegerValuesInstance;
 }
 - (CustomOptionMinIntegerValues*) defaultInstance {
-  return defaultCustomOptionMinIntegerValuesInstance;
+  return [CustomOptionMinIntegerValues defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1505,36 +1525,18 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (CustomOptionMinIntegerValues*) parseFromData:(NSData*) data {
-  return (CustomOptionMinIntegerValues*)[[[CustomOptionMinIntegerValues builder] mergeFromData:data] build];
-}
-+ (CustomOptionMinIntegerValues*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionMinIntegerValues*)[[[CustomOptionMinIntegerValues builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (CustomOptionMinIntegerValues*) parseFromInputStream:(NSInputStream*) input {
-  return (CustomOptionMinIntegerValues*)[[[CustomOptionMinIntegerValues builder] mergeFromInputStream:input] build];
-}
-+ (CustomOptionMinIntegerValues*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionMinIntegerValues*)[[[CustomOptionMinIntegerValues builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (CustomOptionMinIntegerValues*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (CustomOptionMinIntegerValues*)[[[CustomOptionMinIntegerValues builder] mergeFromCodedInputStream:input] build];
-}
-+ (CustomOptionMinIntegerValues*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionMinIntegerValues*)[[[CustomOptionMinIntegerValues builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (CustomOptionMinIntegerValues_Builder*) builder {
-  return [[CustomOptionMinIntegerValues_Builder alloc] init] ;
+  return [[CustomOptionMinIntegerValues_Builder alloc] init];
 }
 + (CustomOptionMinIntegerValues_Builder*) builderWithPrototype:(CustomOptionMinIntegerValues*) prototype {
   return [[CustomOptionMinIntegerValues builder] mergeFrom:prototype];
@@ -1545,8 +1547,8 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
 - (CustomOptionMinIntegerValues_Builder*) toBuilder {
   return [CustomOptionMinIntegerValues builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -1564,30 +1566,24 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface CustomOptionMinIntegerValues_Builder()
-@property (strong) CustomOptionMinIntegerValues* result;
+@property (strong) CustomOptionMinIntegerValues* builder_result;
 @end
 
 @implementation CustomOptionMinIntegerValues_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[CustomOptionMinIntegerValues alloc] init] ;
+    self.builder_result = [[CustomOptionMinIntegerValues alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (CustomOptionMinIntegerValues_Builder*) clear {
-  self.result = [[CustomOptionMinIntegerValues alloc] init] ;
-  return self;
-}
-- (CustomOptionMinIntegerValues_Builder*) clone {
-  return [CustomOptionMinIntegerValues builderWithPrototype:result];
+  return builder_result;
 }
 - (CustomOptionMinIntegerValues*) defaultInstance {
   return [CustomOptionMinIntegerValues defaultInstance];
@@ -1597,8 +1593,8 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
   return [self buildPartial];
 }
 - (CustomOptionMinIntegerValues*) buildPartial {
-  CustomOptionMinIntegerValues* returnMe = result;
-  self.result = nil;
+  CustomOptionMinIntegerValues* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (CustomOptionMinIntegerValues_Builder*) mergeFrom:(CustomOptionMinIntegerValues*) other {
@@ -1608,9 +1604,6 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (CustomOptionMinIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (CustomOptionMinIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -1629,6 +1622,25 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
     }
   }
 }
+- (CustomOptionMinIntegerValues_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (CustomOptionMinIntegerValues_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface CustomOptionMaxIntegerValues ()
@@ -1636,23 +1648,21 @@ static CustomOptionMinIntegerValues* defaultCustomOptionMinIntegerValuesInstance
 
 @implementation CustomOptionMaxIntegerValues
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance = nil;
-+ (void) initialize {
-  if (self == [CustomOptionMaxIntegerValues class]) {
-    defaultCustomOptionMaxIntegerValuesInstance = [[CustomOptionMaxIntegerValues alloc] init];
-  }
-}
 + (CustomOptionMaxIntegerValues*) defaultInstance {
+  static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultCustomOptionMaxIntegerValuesInstance = [[CustomOptionMaxIntegerValues alloc] init];
+  });
   return defaultCustomOptionMaxIntegerValuesInstance;
 }
 - (CustomOptionMaxIntegerValues*) defaultInstance {
-  return defaultCustomOptionMaxIntegerValuesInstance;
+  return [CustomOptionMaxIntegerValues defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1661,36 +1671,18 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (CustomOptionMaxIntegerValues*) parseFromData:(NSData*) data {
-  return (CustomOptionMaxIntegerValues*)[[[CustomOptionMaxIntegerValues builder] mergeFromData:data] build];
-}
-+ (CustomOptionMaxIntegerValues*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionMaxIntegerValues*)[[[CustomOptionMaxIntegerValues builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (CustomOptionMaxIntegerValues*) parseFromInputStream:(NSInputStream*) input {
-  return (CustomOptionMaxIntegerValues*)[[[CustomOptionMaxIntegerValues builder] mergeFromInputStream:input] build];
-}
-+ (CustomOptionMaxIntegerValues*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionMaxIntegerValues*)[[[CustomOptionMaxIntegerValues builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (CustomOptionMaxIntegerValues*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (CustomOptionMaxIntegerValues*)[[[CustomOptionMaxIntegerValues builder] mergeFromCodedInputStream:input] build];
-}
-+ (CustomOptionMaxIntegerValues*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionMaxIntegerValues*)[[[CustomOptionMaxIntegerValues builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (CustomOptionMaxIntegerValues_Builder*) builder {
-  return [[CustomOptionMaxIntegerValues_Builder alloc] init] ;
+  return [[CustomOptionMaxIntegerValues_Builder alloc] init];
 }
 + (CustomOptionMaxIntegerValues_Builder*) builderWithPrototype:(CustomOptionMaxIntegerValues*) prototype {
   return [[CustomOptionMaxIntegerValues builder] mergeFrom:prototype];
@@ -1701,8 +1693,8 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
 - (CustomOptionMaxIntegerValues_Builder*) toBuilder {
   return [CustomOptionMaxIntegerValues builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -1720,30 +1712,24 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface CustomOptionMaxIntegerValues_Builder()
-@property (strong) CustomOptionMaxIntegerValues* result;
+@property (strong) CustomOptionMaxIntegerValues* builder_result;
 @end
 
 @implementation CustomOptionMaxIntegerValues_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[CustomOptionMaxIntegerValues alloc] init] ;
+    self.builder_result = [[CustomOptionMaxIntegerValues alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (CustomOptionMaxIntegerValues_Builder*) clear {
-  self.result = [[CustomOptionMaxIntegerValues alloc] init] ;
-  return self;
-}
-- (CustomOptionMaxIntegerValues_Builder*) clone {
-  return [CustomOptionMaxIntegerValues builderWithPrototype:result];
+  return builder_result;
 }
 - (CustomOptionMaxIntegerValues*) defaultInstance {
   return [CustomOptionMaxIntegerValues defaultInstance];
@@ -1753,8 +1739,8 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
   return [self buildPartial];
 }
 - (CustomOptionMaxIntegerValues*) buildPartial {
-  CustomOptionMaxIntegerValues* returnMe = result;
-  self.result = nil;
+  CustomOptionMaxIntegerValues* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (CustomOptionMaxIntegerValues_Builder*) mergeFrom:(CustomOptionMaxIntegerValues*) other {
@@ -1764,9 +1750,6 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (CustomOptionMaxIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (CustomOptionMaxIntegerValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -1785,6 +1768,25 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
     }
   }
 }
+- (CustomOptionMaxIntegerValues_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (CustomOptionMaxIntegerValues_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface CustomOptionOtherValues ()
@@ -1792,23 +1794,21 @@ static CustomOptionMaxIntegerValues* defaultCustomOptionMaxIntegerValuesInstance
 
 @implementation CustomOptionOtherValues
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
-+ (void) initialize {
-  if (self == [CustomOptionOtherValues class]) {
-    defaultCustomOptionOtherValuesInstance = [[CustomOptionOtherValues alloc] init];
-  }
-}
 + (CustomOptionOtherValues*) defaultInstance {
+  static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultCustomOptionOtherValuesInstance = [[CustomOptionOtherValues alloc] init];
+  });
   return defaultCustomOptionOtherValuesInstance;
 }
 - (CustomOptionOtherValues*) defaultInstance {
-  return defaultCustomOptionOtherValuesInstance;
+  return [CustomOptionOtherValues defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1817,36 +1817,18 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (CustomOptionOtherValues*) parseFromData:(NSData*) data {
-  return (CustomOptionOtherValues*)[[[CustomOptionOtherValues builder] mergeFromData:data] build];
-}
-+ (CustomOptionOtherValues*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionOtherValues*)[[[CustomOptionOtherValues builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (CustomOptionOtherValues*) parseFromInputStream:(NSInputStream*) input {
-  return (CustomOptionOtherValues*)[[[CustomOptionOtherValues builder] mergeFromInputStream:input] build];
-}
-+ (CustomOptionOtherValues*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionOtherValues*)[[[CustomOptionOtherValues builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (CustomOptionOtherValues*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (CustomOptionOtherValues*)[[[CustomOptionOtherValues builder] mergeFromCodedInputStream:input] build];
-}
-+ (CustomOptionOtherValues*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (CustomOptionOtherValues*)[[[CustomOptionOtherValues builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (CustomOptionOtherValues_Builder*) builder {
-  return [[CustomOptionOtherValues_Builder alloc] init] ;
+  return [[CustomOptionOtherValues_Builder alloc] init];
 }
 + (CustomOptionOtherValues_Builder*) builderWithPrototype:(CustomOptionOtherValues*) prototype {
   return [[CustomOptionOtherValues builder] mergeFrom:prototype];
@@ -1857,8 +1839,8 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
 - (CustomOptionOtherValues_Builder*) toBuilder {
   return [CustomOptionOtherValues builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -1876,30 +1858,24 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface CustomOptionOtherValues_Builder()
-@property (strong) CustomOptionOtherValues* result;
+@property (strong) CustomOptionOtherValues* builder_result;
 @end
 
 @implementation CustomOptionOtherValues_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[CustomOptionOtherValues alloc] init] ;
+    self.builder_result = [[CustomOptionOtherValues alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (CustomOptionOtherValues_Builder*) clear {
-  self.result = [[CustomOptionOtherValues alloc] init] ;
-  return self;
-}
-- (CustomOptionOtherValues_Builder*) clone {
-  return [CustomOptionOtherValues builderWithPrototype:result];
+  return builder_result;
 }
 - (CustomOptionOtherValues*) defaultInstance {
   return [CustomOptionOtherValues defaultInstance];
@@ -1909,8 +1885,8 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
   return [self buildPartial];
 }
 - (CustomOptionOtherValues*) buildPartial {
-  CustomOptionOtherValues* returnMe = result;
-  self.result = nil;
+  CustomOptionOtherValues* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (CustomOptionOtherValues_Builder*) mergeFrom:(CustomOptionOtherValues*) other {
@@ -1920,9 +1896,6 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (CustomOptionOtherValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (CustomOptionOtherValues_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -1941,6 +1914,25 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
     }
   }
 }
+- (CustomOptionOtherValues_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (CustomOptionOtherValues_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface SettingRealsFromPositiveInts ()
@@ -1948,23 +1940,21 @@ static CustomOptionOtherValues* defaultCustomOptionOtherValuesInstance = nil;
 
 @implementation SettingRealsFromPositiveInts
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance = nil;
-+ (void) initialize {
-  if (self == [SettingRealsFromPositiveInts class]) {
-    defaultSettingRealsFromPositiveIntsInstance = [[SettingRealsFromPositiveInts alloc] init];
-  }
-}
 + (SettingRealsFromPositiveInts*) defaultInstance {
+  static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultSettingRealsFromPositiveIntsInstance = [[SettingRealsFromPositiveInts alloc] init];
+  });
   return defaultSettingRealsFromPositiveIntsInstance;
 }
 - (SettingRealsFromPositiveInts*) defaultInstance {
-  return defaultSettingRealsFromPositiveIntsInstance;
+  return [SettingRealsFromPositiveInts defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -1973,36 +1963,18 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (SettingRealsFromPositiveInts*) parseFromData:(NSData*) data {
-  return (SettingRealsFromPositiveInts*)[[[SettingRealsFromPositiveInts builder] mergeFromData:data] build];
-}
-+ (SettingRealsFromPositiveInts*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (SettingRealsFromPositiveInts*)[[[SettingRealsFromPositiveInts builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (SettingRealsFromPositiveInts*) parseFromInputStream:(NSInputStream*) input {
-  return (SettingRealsFromPositiveInts*)[[[SettingRealsFromPositiveInts builder] mergeFromInputStream:input] build];
-}
-+ (SettingRealsFromPositiveInts*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (SettingRealsFromPositiveInts*)[[[SettingRealsFromPositiveInts builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (SettingRealsFromPositiveInts*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (SettingRealsFromPositiveInts*)[[[SettingRealsFromPositiveInts builder] mergeFromCodedInputStream:input] build];
-}
-+ (SettingRealsFromPositiveInts*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (SettingRealsFromPositiveInts*)[[[SettingRealsFromPositiveInts builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (SettingRealsFromPositiveInts_Builder*) builder {
-  return [[SettingRealsFromPositiveInts_Builder alloc] init] ;
+  return [[SettingRealsFromPositiveInts_Builder alloc] init];
 }
 + (SettingRealsFromPositiveInts_Builder*) builderWithPrototype:(SettingRealsFromPositiveInts*) prototype {
   return [[SettingRealsFromPositiveInts builder] mergeFrom:prototype];
@@ -2013,8 +1985,8 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
 - (SettingRealsFromPositiveInts_Builder*) toBuilder {
   return [SettingRealsFromPositiveInts builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -2032,30 +2004,24 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface SettingRealsFromPositiveInts_Builder()
-@property (strong) SettingRealsFromPositiveInts* result;
+@property (strong) SettingRealsFromPositiveInts* builder_result;
 @end
 
 @implementation SettingRealsFromPositiveInts_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[SettingRealsFromPositiveInts alloc] init] ;
+    self.builder_result = [[SettingRealsFromPositiveInts alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (SettingRealsFromPositiveInts_Builder*) clear {
-  self.result = [[SettingRealsFromPositiveInts alloc] init] ;
-  return self;
-}
-- (SettingRealsFromPositiveInts_Builder*) clone {
-  return [SettingRealsFromPositiveInts builderWithPrototype:result];
+  return builder_result;
 }
 - (SettingRealsFromPositiveInts*) defaultInstance {
   return [SettingRealsFromPositiveInts defaultInstance];
@@ -2065,8 +2031,8 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
   return [self buildPartial];
 }
 - (SettingRealsFromPositiveInts*) buildPartial {
-  SettingRealsFromPositiveInts* returnMe = result;
-  self.result = nil;
+  SettingRealsFromPositiveInts* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (SettingRealsFromPositiveInts_Builder*) mergeFrom:(SettingRealsFromPositiveInts*) other {
@@ -2076,9 +2042,6 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (SettingRealsFromPositiveInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (SettingRealsFromPositiveInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -2097,6 +2060,25 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
     }
   }
 }
+- (SettingRealsFromPositiveInts_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (SettingRealsFromPositiveInts_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface SettingRealsFromNegativeInts ()
@@ -2104,23 +2086,21 @@ static SettingRealsFromPositiveInts* defaultSettingRealsFromPositiveIntsInstance
 
 @implementation SettingRealsFromNegativeInts
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance = nil;
-+ (void) initialize {
-  if (self == [SettingRealsFromNegativeInts class]) {
-    defaultSettingRealsFromNegativeIntsInstance = [[SettingRealsFromNegativeInts alloc] init];
-  }
-}
 + (SettingRealsFromNegativeInts*) defaultInstance {
+  static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultSettingRealsFromNegativeIntsInstance = [[SettingRealsFromNegativeInts alloc] init];
+  });
   return defaultSettingRealsFromNegativeIntsInstance;
 }
 - (SettingRealsFromNegativeInts*) defaultInstance {
-  return defaultSettingRealsFromNegativeIntsInstance;
+  return [SettingRealsFromNegativeInts defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -2129,36 +2109,18 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (SettingRealsFromNegativeInts*) parseFromData:(NSData*) data {
-  return (SettingRealsFromNegativeInts*)[[[SettingRealsFromNegativeInts builder] mergeFromData:data] build];
-}
-+ (SettingRealsFromNegativeInts*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (SettingRealsFromNegativeInts*)[[[SettingRealsFromNegativeInts builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (SettingRealsFromNegativeInts*) parseFromInputStream:(NSInputStream*) input {
-  return (SettingRealsFromNegativeInts*)[[[SettingRealsFromNegativeInts builder] mergeFromInputStream:input] build];
-}
-+ (SettingRealsFromNegativeInts*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (SettingRealsFromNegativeInts*)[[[SettingRealsFromNegativeInts builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (SettingRealsFromNegativeInts*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (SettingRealsFromNegativeInts*)[[[SettingRealsFromNegativeInts builder] mergeFromCodedInputStream:input] build];
-}
-+ (SettingRealsFromNegativeInts*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (SettingRealsFromNegativeInts*)[[[SettingRealsFromNegativeInts builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (SettingRealsFromNegativeInts_Builder*) builder {
-  return [[SettingRealsFromNegativeInts_Builder alloc] init] ;
+  return [[SettingRealsFromNegativeInts_Builder alloc] init];
 }
 + (SettingRealsFromNegativeInts_Builder*) builderWithPrototype:(SettingRealsFromNegativeInts*) prototype {
   return [[SettingRealsFromNegativeInts builder] mergeFrom:prototype];
@@ -2169,8 +2131,8 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
 - (SettingRealsFromNegativeInts_Builder*) toBuilder {
   return [SettingRealsFromNegativeInts builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -2188,30 +2150,24 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface SettingRealsFromNegativeInts_Builder()
-@property (strong) SettingRealsFromNegativeInts* result;
+@property (strong) SettingRealsFromNegativeInts* builder_result;
 @end
 
 @implementation SettingRealsFromNegativeInts_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[SettingRealsFromNegativeInts alloc] init] ;
+    self.builder_result = [[SettingRealsFromNegativeInts alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (SettingRealsFromNegativeInts_Builder*) clear {
-  self.result = [[SettingRealsFromNegativeInts alloc] init] ;
-  return self;
-}
-- (SettingRealsFromNegativeInts_Builder*) clone {
-  return [SettingRealsFromNegativeInts builderWithPrototype:result];
+  return builder_result;
 }
 - (SettingRealsFromNegativeInts*) defaultInstance {
   return [SettingRealsFromNegativeInts defaultInstance];
@@ -2221,8 +2177,8 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
   return [self buildPartial];
 }
 - (SettingRealsFromNegativeInts*) buildPartial {
-  SettingRealsFromNegativeInts* returnMe = result;
-  self.result = nil;
+  SettingRealsFromNegativeInts* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (SettingRealsFromNegativeInts_Builder*) mergeFrom:(SettingRealsFromNegativeInts*) other {
@@ -2232,9 +2188,6 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (SettingRealsFromNegativeInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (SettingRealsFromNegativeInts_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -2253,38 +2206,38 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
     }
   }
 }
+- (SettingRealsFromNegativeInts_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (SettingRealsFromNegativeInts_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface ComplexOptionType1 ()
-@property int32_t foo;
-@property int32_t foo2;
-@property int32_t foo3;
+@property (nonatomic, readwrite) BOOL hasFoo;
+@property (nonatomic, readwrite) int32_t foo;
+@property (nonatomic, readwrite) BOOL hasFoo2;
+@property (nonatomic, readwrite) int32_t foo2;
+@property (nonatomic, readwrite) BOOL hasFoo3;
+@property (nonatomic, readwrite) int32_t foo3;
 @end
 
 @implementation ComplexOptionType1
 
-- (BOOL) hasFoo {
-  return !!hasFoo_;
-}
-- (void) setHasFoo:(BOOL) value {
-  hasFoo_ = !!value;
-}
-@synthesize foo;
-- (BOOL) hasFoo2 {
-  return !!hasFoo2_;
-}
-- (void) setHasFoo2:(BOOL) value {
-  hasFoo2_ = !!value;
-}
-@synthesize foo2;
-- (BOOL) hasFoo3 {
-  return !!hasFoo3_;
-}
-- (void) setHasFoo3:(BOOL) value {
-  hasFoo3_ = !!value;
-}
-@synthesize foo3;
-
 - (id) init {
   if ((self = [super init])) {
     self.foo = 0;
@@ -2293,17 +2246,16 @@ static SettingRealsFromNegativeInts* defaultSettingRealsFromNegativeIntsInstance
   }
   return self;
 }
-static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOptionType1 class]) {
-    defaultComplexOptionType1Instance = [[ComplexOptionType1 alloc] init];
-  }
-}
 + (ComplexOptionType1*) defaultInstance {
+  static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOptionType1Instance = [[ComplexOptionType1 alloc] init];
+  });
   return defaultComplexOptionType1Instance;
 }
 - (ComplexOptionType1*) defaultInstance {
-  return defaultComplexOptionType1Instance;
+  return [ComplexOptionType1 defaultInstance];
 }
 - (BOOL) isInitialized {
   if (!self.extensionsAreInitialized) {
@@ -2327,46 +2279,28 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasFoo) {
-    size += computeInt32Size(1, self.foo);
+    size_ += computeInt32Size(1, self.foo);
   }
   if (self.hasFoo2) {
-    size += computeInt32Size(2, self.foo2);
+    size_ += computeInt32Size(2, self.foo2);
   }
   if (self.hasFoo3) {
-    size += computeInt32Size(3, self.foo3);
+    size_ += computeInt32Size(3, self.foo3);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (ComplexOptionType1*) parseFromData:(NSData*) data {
-  return (ComplexOptionType1*)[[[ComplexOptionType1 builder] mergeFromData:data] build];
-}
-+ (ComplexOptionType1*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType1*)[[[ComplexOptionType1 builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOptionType1*) parseFromInputStream:(NSInputStream*) input {
-  return (ComplexOptionType1*)[[[ComplexOptionType1 builder] mergeFromInputStream:input] build];
-}
-+ (ComplexOptionType1*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType1*)[[[ComplexOptionType1 builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOptionType1*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (ComplexOptionType1*)[[[ComplexOptionType1 builder] mergeFromCodedInputStream:input] build];
-}
-+ (ComplexOptionType1*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType1*)[[[ComplexOptionType1 builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (ComplexOptionType1_Builder*) builder {
-  return [[ComplexOptionType1_Builder alloc] init] ;
+  return [[ComplexOptionType1_Builder alloc] init];
 }
 + (ComplexOptionType1_Builder*) builderWithPrototype:(ComplexOptionType1*) prototype {
   return [[ComplexOptionType1 builder] mergeFrom:prototype];
@@ -2377,21 +2311,20 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
 - (ComplexOptionType1_Builder*) toBuilder {
   return [ComplexOptionType1 builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasFoo) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"foo", [NSNumber numberWithInt:self.foo]];
+    PBTextFormatWriteInt32(writer, "foo", self.foo);
   }
   if (self.hasFoo2) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"foo2", [NSNumber numberWithInt:self.foo2]];
+    PBTextFormatWriteInt32(writer, "foo2", self.foo2);
   }
   if (self.hasFoo3) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"foo3", [NSNumber numberWithInt:self.foo3]];
+    PBTextFormatWriteInt32(writer, "foo3", self.foo3);
   }
-  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
-                                            from:100
-                                              to:536870912
-                                      withIndent:indent];
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self writeExtensionTextFormatTo:writer
+                              from:100
+                                to:536870912];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -2404,56 +2337,56 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
   return
       self.hasFoo == otherMessage.hasFoo &&
       (!self.hasFoo || self.foo == otherMessage.foo) &&
-      
       self.hasFoo2 == otherMessage.hasFoo2 &&
       (!self.hasFoo2 || self.foo2 == otherMessage.foo2) &&
-      
       self.hasFoo3 == otherMessage.hasFoo3 &&
       (!self.hasFoo3 || self.foo3 == otherMessage.foo3) &&
-      
       [self isEqualExtensionsInOther:otherMessage from:100 to:536870912] &&
-      
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasFoo) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.foo] hash];
+    hashCode = hashCode * 31 + [@(self.foo) hash];
   }
   if (self.hasFoo2) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.foo2] hash];
+    hashCode = hashCode * 31 + [@(self.foo2) hash];
   }
   if (self.hasFoo3) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.foo3] hash];
+    hashCode = hashCode * 31 + [@(self.foo3) hash];
   }
   hashCode = hashCode * 31 + [self hashExtensionsFrom:100 to:536870912];
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasFoo) {
+    PBJSONWriteInt32(writer, "foo", self.foo);
+  }
+  if (self.hasFoo2) {
+    PBJSONWriteInt32(writer, "foo2", self.foo2);
+  }
+  if (self.hasFoo3) {
+    PBJSONWriteInt32(writer, "foo3", self.foo3);
+  }
+}
 @end
 
 @interface ComplexOptionType1_Builder()
-@property (strong) ComplexOptionType1* result;
+@property (strong) ComplexOptionType1* builder_result;
 @end
 
 @implementation ComplexOptionType1_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[ComplexOptionType1 alloc] init] ;
+    self.builder_result = [[ComplexOptionType1 alloc] init];
   }
   return self;
 }
 - (PBExtendableMessage*) internalGetResult {
-  return result;
-}
-- (ComplexOptionType1_Builder*) clear {
-  self.result = [[ComplexOptionType1 alloc] init] ;
-  return self;
-}
-- (ComplexOptionType1_Builder*) clone {
-  return [ComplexOptionType1 builderWithPrototype:result];
+  return builder_result;
 }
 - (ComplexOptionType1*) defaultInstance {
   return [ComplexOptionType1 defaultInstance];
@@ -2463,8 +2396,8 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
   return [self buildPartial];
 }
 - (ComplexOptionType1*) buildPartial {
-  ComplexOptionType1* returnMe = result;
-  self.result = nil;
+  ComplexOptionType1* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (ComplexOptionType1_Builder*) mergeFrom:(ComplexOptionType1*) other {
@@ -2484,9 +2417,6 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (ComplexOptionType1_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (ComplexOptionType1_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -2517,86 +2447,133 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
     }
   }
 }
-- (BOOL) hasFoo {
-  return result.hasFoo;
+- (ComplexOptionType1_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 3:
+        if (memcmp(name, "foo", 3) == 0) {
+          [self setFoo:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+      case 4:
+        if (memcmp(name, "foo2", 4) == 0) {
+          [self setFoo2:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "foo3", 4) == 0) {
+          [self setFoo3:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) foo {
-  return result.foo;
+- (ComplexOptionType1_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 3:
+        if (memcmp(name, "foo", 3) == 0) {
+          number = 1;
+        }
+        break;
+      case 4:
+        if (memcmp(name, "foo2", 4) == 0) {
+          number = 2;
+        } else if (memcmp(name, "foo3", 4) == 0) {
+          number = 3;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setFoo:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 2: {
+        [self setFoo2:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 3: {
+        [self setFoo3:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (ComplexOptionType1_Builder*) setFoo:(int32_t) value {
-  result.hasFoo = YES;
-  result.foo = value;
+  builder_result.hasFoo = YES;
+  builder_result.foo = value;
   return self;
 }
-- (ComplexOptionType1_Builder*) clearFoo {
-  result.hasFoo = NO;
-  result.foo = 0;
-  return self;
+- (int32_t) foo {
+  return builder_result.foo;
 }
-- (BOOL) hasFoo2 {
-  return result.hasFoo2;
+- (BOOL)hasFoo {
+ return builder_result.hasFoo;
 }
-- (int32_t) foo2 {
-  return result.foo2;
+- (ComplexOptionType1_Builder*)clearFoo {
+  builder_result.hasFoo = NO;
+  builder_result.foo = 0;
+  return self;
 }
 - (ComplexOptionType1_Builder*) setFoo2:(int32_t) value {
-  result.hasFoo2 = YES;
-  result.foo2 = value;
+  builder_result.hasFoo2 = YES;
+  builder_result.foo2 = value;
   return self;
 }
-- (ComplexOptionType1_Builder*) clearFoo2 {
-  result.hasFoo2 = NO;
-  result.foo2 = 0;
-  return self;
+- (int32_t) foo2 {
+  return builder_result.foo2;
 }
-- (BOOL) hasFoo3 {
-  return result.hasFoo3;
+- (BOOL)hasFoo2 {
+ return builder_result.hasFoo2;
 }
-- (int32_t) foo3 {
-  return result.foo3;
+- (ComplexOptionType1_Builder*)clearFoo2 {
+  builder_result.hasFoo2 = NO;
+  builder_result.foo2 = 0;
+  return self;
 }
 - (ComplexOptionType1_Builder*) setFoo3:(int32_t) value {
-  result.hasFoo3 = YES;
-  result.foo3 = value;
+  builder_result.hasFoo3 = YES;
+  builder_result.foo3 = value;
   return self;
 }
-- (ComplexOptionType1_Builder*) clearFoo3 {
-  result.hasFoo3 = NO;
-  result.foo3 = 0;
+- (int32_t) foo3 {
+  return builder_result.foo3;
+}
+- (BOOL)hasFoo3 {
+ return builder_result.hasFoo3;
+}
+- (ComplexOptionType1_Builder*)clearFoo3 {
+  builder_result.hasFoo3 = NO;
+  builder_result.foo3 = 0;
   return self;
 }
 @end
 
 @interface ComplexOptionType2 ()
-@property (strong) ComplexOptionType1* bar;
-@property int32_t baz;
-@property (strong) ComplexOptionType2_ComplexOptionType4* fred;
+@property (nonatomic, readwrite) BOOL hasBar;
+@property (nonatomic, readwrite) ComplexOptionType1* bar;
+@property (nonatomic, readwrite) BOOL hasBaz;
+@property (nonatomic, readwrite) int32_t baz;
+@property (nonatomic, readwrite) BOOL hasFred;
+@property (nonatomic, readwrite) ComplexOptionType2_ComplexOptionType4* fred;
 @end
 
 @implementation ComplexOptionType2
 
-- (BOOL) hasBar {
-  return !!hasBar_;
-}
-- (void) setHasBar:(BOOL) value {
-  hasBar_ = !!value;
-}
-@synthesize bar;
-- (BOOL) hasBaz {
-  return !!hasBaz_;
-}
-- (void) setHasBaz:(BOOL) value {
-  hasBaz_ = !!value;
-}
-@synthesize baz;
-- (BOOL) hasFred {
-  return !!hasFred_;
-}
-- (void) setHasFred:(BOOL) value {
-  hasFred_ = !!value;
-}
-@synthesize fred;
-
 - (id) init {
   if ((self = [super init])) {
     self.bar = [ComplexOptionType1 defaultInstance];
@@ -2605,17 +2582,16 @@ static ComplexOptionType1* defaultComplexOptionType1Instance = nil;
   }
   return self;
 }
-static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOptionType2 class]) {
-    defaultComplexOptionType2Instance = [[ComplexOptionType2 alloc] init];
-  }
-}
 + (ComplexOptionType2*) defaultInstance {
+  static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOptionType2Instance = [[ComplexOptionType2 alloc] init];
+  });
   return defaultComplexOptionType2Instance;
 }
 - (ComplexOptionType2*) defaultInstance {
-  return defaultComplexOptionType2Instance;
+  return [ComplexOptionType2 defaultInstance];
 }
 - (BOOL) isInitialized {
   if (self.hasBar) {
@@ -2644,46 +2620,28 @@ static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasBar) {
-    size += computeMessageSize(1, self.bar);
+    size_ += computeMessageSize(1, self.bar);
   }
   if (self.hasBaz) {
-    size += computeInt32Size(2, self.baz);
+    size_ += computeInt32Size(2, self.baz);
   }
   if (self.hasFred) {
-    size += computeMessageSize(3, self.fred);
+    size_ += computeMessageSize(3, self.fred);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (ComplexOptionType2*) parseFromData:(NSData*) data {
-  return (ComplexOptionType2*)[[[ComplexOptionType2 builder] mergeFromData:data] build];
-}
-+ (ComplexOptionType2*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType2*)[[[ComplexOptionType2 builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOptionType2*) parseFromInputStream:(NSInputStream*) input {
-  return (ComplexOptionType2*)[[[ComplexOptionType2 builder] mergeFromInputStream:input] build];
-}
-+ (ComplexOptionType2*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType2*)[[[ComplexOptionType2 builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOptionType2*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (ComplexOptionType2*)[[[ComplexOptionType2 builder] mergeFromCodedInputStream:input] build];
-}
-+ (ComplexOptionType2*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType2*)[[[ComplexOptionType2 builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (ComplexOptionType2_Builder*) builder {
-  return [[ComplexOptionType2_Builder alloc] init] ;
+  return [[ComplexOptionType2_Builder alloc] init];
 }
 + (ComplexOptionType2_Builder*) builderWithPrototype:(ComplexOptionType2*) prototype {
   return [[ComplexOptionType2 builder] mergeFrom:prototype];
@@ -2694,27 +2652,20 @@ static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
 - (ComplexOptionType2_Builder*) toBuilder {
   return [ComplexOptionType2 builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasBar) {
-    [output appendFormat:@"%@%@ {\n", indent, @"bar"];
-    [self.bar writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "bar", self.bar);
   }
   if (self.hasBaz) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"baz", [NSNumber numberWithInt:self.baz]];
+    PBTextFormatWriteInt32(writer, "baz", self.baz);
   }
   if (self.hasFred) {
-    [output appendFormat:@"%@%@ {\n", indent, @"fred"];
-    [self.fred writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "fred", self.fred);
   }
-  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
-                                            from:100
-                                              to:536870912
-                                      withIndent:indent];
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self writeExtensionTextFormatTo:writer
+                              from:100
+                                to:536870912];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -2727,15 +2678,12 @@ static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
   return
       self.hasBar == otherMessage.hasBar &&
       (!self.hasBar || [self.bar isEqual:otherMessage.bar]) &&
-      
       self.hasBaz == otherMessage.hasBaz &&
       (!self.hasBaz || self.baz == otherMessage.baz) &&
-      
       self.hasFred == otherMessage.hasFred &&
       (!self.hasFred || [self.fred isEqual:otherMessage.fred]) &&
-      
       [self isEqualExtensionsInOther:otherMessage from:100 to:536870912] &&
-      
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
@@ -2744,7 +2692,7 @@ static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
     hashCode = hashCode * 31 + [self.bar hash];
   }
   if (self.hasBaz) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.baz] hash];
+    hashCode = hashCode * 31 + [@(self.baz) hash];
   }
   if (self.hasFred) {
     hashCode = hashCode * 31 + [self.fred hash];
@@ -2753,42 +2701,45 @@ static ComplexOptionType2* defaultComplexOptionType2Instance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasBar) {
+    PBJSONWriteMessage(writer, "bar", self.bar);
+  }
+  if (self.hasBaz) {
+    PBJSONWriteInt32(writer, "baz", self.baz);
+  }
+  if (self.hasFred) {
+    PBJSONWriteMessage(writer, "fred", self.fred);
+  }
+}
 @end
 
 @interface ComplexOptionType2_ComplexOptionType4 ()
-@property int32_t waldo;
+@property (nonatomic, readwrite) BOOL hasWaldo;
+@property (nonatomic, readwrite) int32_t waldo;
 @end
 
 @implementation ComplexOptionType2_ComplexOptionType4
 
-- (BOOL) hasWaldo {
-  return !!hasWaldo_;
-}
-- (void) setHasWaldo:(BOOL) value {
-  hasWaldo_ = !!value;
-}
-@synthesize waldo;
-
 - (id) init {
   if ((self = [super init])) {
     self.waldo = 0;
   }
   return self;
 }
-+ (id<PBExtensionField>) complexOpt4 {
-  return ComplexOptionType2_ComplexOptionType4_complexOpt4;
-}
-static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexOptionType4Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOptionType2_ComplexOptionType4 class]) {
-    defaultComplexOptionType2_ComplexOptionType4Instance = [[ComplexOptionType2_ComplexOptionType4 alloc] init];
-  }
-}
 + (ComplexOptionType2_ComplexOptionType4*) defaultInstance {
+  static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexOptionType4Instance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOptionType2_ComplexOptionType4Instance = [[ComplexOptionType2_ComplexOptionType4 alloc] init];
+  });
   return defaultComplexOptionType2_ComplexOptionType4Instance;
 }
 - (ComplexOptionType2_ComplexOptionType4*) defaultInstance {
-  return defaultComplexOptionType2_ComplexOptionType4Instance;
+  return [ComplexOptionType2_ComplexOptionType4 defaultInstance];
+}
++ (id<PBExtensionField>) complexOpt4 {
+  return ComplexOptionType2_ComplexOptionType4_complexOpt4;
 }
 - (BOOL) isInitialized {
   return YES;
@@ -2800,39 +2751,21 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasWaldo) {
-    size += computeInt32Size(1, self.waldo);
+    size_ += computeInt32Size(1, self.waldo);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromData:(NSData*) data {
-  return (ComplexOptionType2_ComplexOptionType4*)[[[ComplexOptionType2_ComplexOptionType4 builder] mergeFromData:data] build];
-}
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType2_ComplexOptionType4*)[[[ComplexOptionType2_ComplexOptionType4 builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromInputStream:(NSInputStream*) input {
-  return (ComplexOptionType2_ComplexOptionType4*)[[[ComplexOptionType2_ComplexOptionType4 builder] mergeFromInputStream:input] build];
-}
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType2_ComplexOptionType4*)[[[ComplexOptionType2_ComplexOptionType4 builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (ComplexOptionType2_ComplexOptionType4*)[[[ComplexOptionType2_ComplexOptionType4 builder] mergeFromCodedInputStream:input] build];
-}
-+ (ComplexOptionType2_ComplexOptionType4*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType2_ComplexOptionType4*)[[[ComplexOptionType2_ComplexOptionType4 builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (ComplexOptionType2_ComplexOptionType4_Builder*) builder {
-  return [[ComplexOptionType2_ComplexOptionType4_Builder alloc] init] ;
+  return [[ComplexOptionType2_ComplexOptionType4_Builder alloc] init];
 }
 + (ComplexOptionType2_ComplexOptionType4_Builder*) builderWithPrototype:(ComplexOptionType2_ComplexOptionType4*) prototype {
   return [[ComplexOptionType2_ComplexOptionType4 builder] mergeFrom:prototype];
@@ -2843,11 +2776,11 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
 - (ComplexOptionType2_ComplexOptionType4_Builder*) toBuilder {
   return [ComplexOptionType2_ComplexOptionType4 builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasWaldo) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"waldo", [NSNumber numberWithInt:self.waldo]];
+    PBTextFormatWriteInt32(writer, "waldo", self.waldo);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -2860,41 +2793,37 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   return
       self.hasWaldo == otherMessage.hasWaldo &&
       (!self.hasWaldo || self.waldo == otherMessage.waldo) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasWaldo) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.waldo] hash];
+    hashCode = hashCode * 31 + [@(self.waldo) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasWaldo) {
+    PBJSONWriteInt32(writer, "waldo", self.waldo);
+  }
+}
 @end
 
 @interface ComplexOptionType2_ComplexOptionType4_Builder()
-@property (strong) ComplexOptionType2_ComplexOptionType4* result;
+@property (strong) ComplexOptionType2_ComplexOptionType4* builder_result;
 @end
 
 @implementation ComplexOptionType2_ComplexOptionType4_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[ComplexOptionType2_ComplexOptionType4 alloc] init] ;
+    self.builder_result = [[ComplexOptionType2_ComplexOptionType4 alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (ComplexOptionType2_ComplexOptionType4_Builder*) clear {
-  self.result = [[ComplexOptionType2_ComplexOptionType4 alloc] init] ;
-  return self;
-}
-- (ComplexOptionType2_ComplexOptionType4_Builder*) clone {
-  return [ComplexOptionType2_ComplexOptionType4 builderWithPrototype:result];
+  return builder_result;
 }
 - (ComplexOptionType2_ComplexOptionType4*) defaultInstance {
   return [ComplexOptionType2_ComplexOptionType4 defaultInstance];
@@ -2904,8 +2833,8 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   return [self buildPartial];
 }
 - (ComplexOptionType2_ComplexOptionType4*) buildPartial {
-  ComplexOptionType2_ComplexOptionType4* returnMe = result;
-  self.result = nil;
+  ComplexOptionType2_ComplexOptionType4* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFrom:(ComplexOptionType2_ComplexOptionType4*) other {
@@ -2918,9 +2847,6 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -2943,46 +2869,79 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
     }
   }
 }
-- (BOOL) hasWaldo {
-  return result.hasWaldo;
+- (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 5:
+        if (memcmp(name, "waldo", 5) == 0) {
+          [self setWaldo:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) waldo {
-  return result.waldo;
+- (ComplexOptionType2_ComplexOptionType4_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 5:
+        if (memcmp(name, "waldo", 5) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setWaldo:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (ComplexOptionType2_ComplexOptionType4_Builder*) setWaldo:(int32_t) value {
-  result.hasWaldo = YES;
-  result.waldo = value;
+  builder_result.hasWaldo = YES;
+  builder_result.waldo = value;
   return self;
 }
-- (ComplexOptionType2_ComplexOptionType4_Builder*) clearWaldo {
-  result.hasWaldo = NO;
-  result.waldo = 0;
+- (int32_t) waldo {
+  return builder_result.waldo;
+}
+- (BOOL)hasWaldo {
+ return builder_result.hasWaldo;
+}
+- (ComplexOptionType2_ComplexOptionType4_Builder*)clearWaldo {
+  builder_result.hasWaldo = NO;
+  builder_result.waldo = 0;
   return self;
 }
 @end
 
 @interface ComplexOptionType2_Builder()
-@property (strong) ComplexOptionType2* result;
+@property (strong) ComplexOptionType2* builder_result;
 @end
 
 @implementation ComplexOptionType2_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[ComplexOptionType2 alloc] init] ;
+    self.builder_result = [[ComplexOptionType2 alloc] init];
   }
   return self;
 }
 - (PBExtendableMessage*) internalGetResult {
-  return result;
-}
-- (ComplexOptionType2_Builder*) clear {
-  self.result = [[ComplexOptionType2 alloc] init] ;
-  return self;
-}
-- (ComplexOptionType2_Builder*) clone {
-  return [ComplexOptionType2 builderWithPrototype:result];
+  return builder_result;
 }
 - (ComplexOptionType2*) defaultInstance {
   return [ComplexOptionType2 defaultInstance];
@@ -2992,8 +2951,8 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   return [self buildPartial];
 }
 - (ComplexOptionType2*) buildPartial {
-  ComplexOptionType2* returnMe = result;
-  self.result = nil;
+  ComplexOptionType2* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (ComplexOptionType2_Builder*) mergeFrom:(ComplexOptionType2*) other {
@@ -3013,9 +2972,6 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (ComplexOptionType2_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (ComplexOptionType2_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -3033,8 +2989,8 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
       }
       case 10: {
         ComplexOptionType1_Builder* subBuilder = [ComplexOptionType1 builder];
-        if (self.hasBar) {
-          [subBuilder mergeFrom:self.bar];
+        if (self.builder_result.hasBar) {
+          [subBuilder mergeFrom:self.builder_result.bar];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setBar:[subBuilder buildPartial]];
@@ -3046,8 +3002,8 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
       }
       case 26: {
         ComplexOptionType2_ComplexOptionType4_Builder* subBuilder = [ComplexOptionType2_ComplexOptionType4 builder];
-        if (self.hasFred) {
-          [subBuilder mergeFrom:self.fred];
+        if (self.builder_result.hasFred) {
+          [subBuilder mergeFrom:self.builder_result.fred];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setFred:[subBuilder buildPartial]];
@@ -3056,106 +3012,179 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
     }
   }
 }
-- (BOOL) hasBar {
-  return result.hasBar;
+- (ComplexOptionType2_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 3:
+        if (memcmp(name, "bar", 3) == 0) {
+          ComplexOptionType1_Builder* subBuilder = [ComplexOptionType1 builder];
+          if (self.builder_result.hasBar) {
+            [subBuilder mergeFrom:self.builder_result.bar];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setBar:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "baz", 3) == 0) {
+          [self setBaz:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+      case 4:
+        if (memcmp(name, "fred", 4) == 0) {
+          ComplexOptionType2_ComplexOptionType4_Builder* subBuilder = [ComplexOptionType2_ComplexOptionType4 builder];
+          if (self.builder_result.hasFred) {
+            [subBuilder mergeFrom:self.builder_result.fred];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setFred:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (ComplexOptionType1*) bar {
-  return result.bar;
+- (ComplexOptionType2_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 3:
+        if (memcmp(name, "bar", 3) == 0) {
+          number = 1;
+        } else if (memcmp(name, "baz", 3) == 0) {
+          number = 2;
+        }
+        break;
+      case 4:
+        if (memcmp(name, "fred", 4) == 0) {
+          number = 3;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        ComplexOptionType1_Builder* subBuilder = [ComplexOptionType1 builder];
+        if (self.builder_result.hasBar) {
+          [subBuilder mergeFrom:self.builder_result.bar];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setBar:[subBuilder buildPartial]];
+        continue;
+      }
+      case 2: {
+        [self setBaz:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 3: {
+        ComplexOptionType2_ComplexOptionType4_Builder* subBuilder = [ComplexOptionType2_ComplexOptionType4 builder];
+        if (self.builder_result.hasFred) {
+          [subBuilder mergeFrom:self.builder_result.fred];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setFred:[subBuilder buildPartial]];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (ComplexOptionType2_Builder*) setBar:(ComplexOptionType1*) value {
-  result.hasBar = YES;
-  result.bar = value;
+  builder_result.hasBar = YES;
+  builder_result.bar = value;
   return self;
 }
 - (ComplexOptionType2_Builder*) setBarBuilder:(ComplexOptionType1_Builder*) builderForValue {
   return [self setBar:[builderForValue build]];
 }
 - (ComplexOptionType2_Builder*) mergeBar:(ComplexOptionType1*) value {
-  if (result.hasBar &&
-      result.bar != [ComplexOptionType1 defaultInstance]) {
-    result.bar =
-      [[[ComplexOptionType1 builderWithPrototype:result.bar] mergeFrom:value] buildPartial];
+  if (builder_result.hasBar &&
+      builder_result.bar != [ComplexOptionType1 defaultInstance]) {
+    builder_result.bar =
+      [[[ComplexOptionType1 builderWithPrototype:builder_result.bar] mergeFrom:value] buildPartial];
   } else {
-    result.bar = value;
+    builder_result.bar = value;
   }
-  result.hasBar = YES;
+  builder_result.hasBar = YES;
   return self;
 }
-- (ComplexOptionType2_Builder*) clearBar {
-  result.hasBar = NO;
-  result.bar = [ComplexOptionType1 defaultInstance];
-  return self;
+- (ComplexOptionType1*) bar {
+  return builder_result.bar;
 }
-- (BOOL) hasBaz {
-  return result.hasBaz;
+- (BOOL)hasBar {
+ return builder_result.hasBar;
 }
-- (int32_t) baz {
-  return result.baz;
+- (ComplexOptionType2_Builder*)clearBar {
+  builder_result.hasBar = NO;
+  builder_result.bar = [ComplexOptionType1 defaultInstance];
+  return self;
 }
 - (ComplexOptionType2_Builder*) setBaz:(int32_t) value {
-  result.hasBaz = YES;
-  result.baz = value;
+  builder_result.hasBaz = YES;
+  builder_result.baz = value;
   return self;
 }
-- (ComplexOptionType2_Builder*) clearBaz {
-  result.hasBaz = NO;
-  result.baz = 0;
-  return self;
+- (int32_t) baz {
+  return builder_result.baz;
 }
-- (BOOL) hasFred {
-  return result.hasFred;
+- (BOOL)hasBaz {
+ return builder_result.hasBaz;
 }
-- (ComplexOptionType2_ComplexOptionType4*) fred {
-  return result.fred;
+- (ComplexOptionType2_Builder*)clearBaz {
+  builder_result.hasBaz = NO;
+  builder_result.baz = 0;
+  return self;
 }
 - (ComplexOptionType2_Builder*) setFred:(ComplexOptionType2_ComplexOptionType4*) value {
-  result.hasFred = YES;
-  result.fred = value;
+  builder_result.hasFred = YES;
+  builder_result.fred = value;
   return self;
 }
 - (ComplexOptionType2_Builder*) setFredBuilder:(ComplexOptionType2_ComplexOptionType4_Builder*) builderForValue {
   return [self setFred:[builderForValue build]];
 }
 - (ComplexOptionType2_Builder*) mergeFred:(ComplexOptionType2_ComplexOptionType4*) value {
-  if (result.hasFred &&
-      result.fred != [ComplexOptionType2_ComplexOptionType4 defaultInstance]) {
-    result.fred =
-      [[[ComplexOptionType2_ComplexOptionType4 builderWithPrototype:result.fred] mergeFrom:value] buildPartial];
+  if (builder_result.hasFred &&
+      builder_result.fred != [ComplexOptionType2_ComplexOptionType4 defaultInstance]) {
+    builder_result.fred =
+      [[[ComplexOptionType2_ComplexOptionType4 builderWithPrototype:builder_result.fred] mergeFrom:value] buildPartial];
   } else {
-    result.fred = value;
+    builder_result.fred = value;
   }
-  result.hasFred = YES;
+  builder_result.hasFred = YES;
   return self;
 }
-- (ComplexOptionType2_Builder*) clearFred {
-  result.hasFred = NO;
-  result.fred = [ComplexOptionType2_ComplexOptionType4 defaultInstance];
+- (ComplexOptionType2_ComplexOptionType4*) fred {
+  return builder_result.fred;
+}
+- (BOOL)hasFred {
+ return builder_result.hasFred;
+}
+- (ComplexOptionType2_Builder*)clearFred {
+  builder_result.hasFred = NO;
+  builder_result.fred = [ComplexOptionType2_ComplexOptionType4 defaultInstance];
   return self;
 }
 @end
 
 @interface ComplexOptionType3 ()
-@property int32_t qux;
-@property (strong) ComplexOptionType3_ComplexOptionType5* complexOptionType5;
+@property (nonatomic, readwrite) BOOL hasQux;
+@property (nonatomic, readwrite) int32_t qux;
+@property (nonatomic, readwrite) BOOL hasComplexOptionType5;
+@property (nonatomic, readwrite) ComplexOptionType3_ComplexOptionType5* complexOptionType5;
 @end
 
 @implementation ComplexOptionType3
 
-- (BOOL) hasQux {
-  return !!hasQux_;
-}
-- (void) setHasQux:(BOOL) value {
-  hasQux_ = !!value;
-}
-@synthesize qux;
-- (BOOL) hasComplexOptionType5 {
-  return !!hasComplexOptionType5_;
-}
-- (void) setHasComplexOptionType5:(BOOL) value {
-  hasComplexOptionType5_ = !!value;
-}
-@synthesize complexOptionType5;
-
 - (id) init {
   if ((self = [super init])) {
     self.qux = 0;
@@ -3163,17 +3192,16 @@ static ComplexOptionType2_ComplexOptionType4* defaultComplexOptionType2_ComplexO
   }
   return self;
 }
-static ComplexOptionType3* defaultComplexOptionType3Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOptionType3 class]) {
-    defaultComplexOptionType3Instance = [[ComplexOptionType3 alloc] init];
-  }
-}
 + (ComplexOptionType3*) defaultInstance {
+  static ComplexOptionType3* defaultComplexOptionType3Instance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOptionType3Instance = [[ComplexOptionType3 alloc] init];
+  });
   return defaultComplexOptionType3Instance;
 }
 - (ComplexOptionType3*) defaultInstance {
-  return defaultComplexOptionType3Instance;
+  return [ComplexOptionType3 defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -3188,42 +3216,24 @@ static ComplexOptionType3* defaultComplexOptionType3Instance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasQux) {
-    size += computeInt32Size(1, self.qux);
+    size_ += computeInt32Size(1, self.qux);
   }
   if (self.hasComplexOptionType5) {
-    size += computeGroupSize(2, self.complexOptionType5);
+    size_ += computeGroupSize(2, self.complexOptionType5);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (ComplexOptionType3*) parseFromData:(NSData*) data {
-  return (ComplexOptionType3*)[[[ComplexOptionType3 builder] mergeFromData:data] build];
-}
-+ (ComplexOptionType3*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType3*)[[[ComplexOptionType3 builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOptionType3*) parseFromInputStream:(NSInputStream*) input {
-  return (ComplexOptionType3*)[[[ComplexOptionType3 builder] mergeFromInputStream:input] build];
-}
-+ (ComplexOptionType3*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType3*)[[[ComplexOptionType3 builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOptionType3*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (ComplexOptionType3*)[[[ComplexOptionType3 builder] mergeFromCodedInputStream:input] build];
-}
-+ (ComplexOptionType3*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType3*)[[[ComplexOptionType3 builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (ComplexOptionType3_Builder*) builder {
-  return [[ComplexOptionType3_Builder alloc] init] ;
+  return [[ComplexOptionType3_Builder alloc] init];
 }
 + (ComplexOptionType3_Builder*) builderWithPrototype:(ComplexOptionType3*) prototype {
   return [[ComplexOptionType3 builder] mergeFrom:prototype];
@@ -3234,17 +3244,14 @@ static ComplexOptionType3* defaultComplexOptionType3Instance = nil;
 - (ComplexOptionType3_Builder*) toBuilder {
   return [ComplexOptionType3 builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasQux) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"qux", [NSNumber numberWithInt:self.qux]];
+    PBTextFormatWriteInt32(writer, "qux", self.qux);
   }
   if (self.hasComplexOptionType5) {
-    [output appendFormat:@"%@%@ {\n", indent, @"complexOptionType5"];
-    [self.complexOptionType5 writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "complexOptionType5", self.complexOptionType5);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -3257,16 +3264,14 @@ static ComplexOptionType3* defaultComplexOptionType3Instance = nil;
   return
       self.hasQux == otherMessage.hasQux &&
       (!self.hasQux || self.qux == otherMessage.qux) &&
-      
       self.hasComplexOptionType5 == otherMessage.hasComplexOptionType5 &&
       (!self.hasComplexOptionType5 || [self.complexOptionType5 isEqual:otherMessage.complexOptionType5]) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasQux) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.qux] hash];
+    hashCode = hashCode * 31 + [@(self.qux) hash];
   }
   if (self.hasComplexOptionType5) {
     hashCode = hashCode * 31 + [self.complexOptionType5 hash];
@@ -3274,21 +3279,22 @@ static ComplexOptionType3* defaultComplexOptionType3Instance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasQux) {
+    PBJSONWriteInt32(writer, "qux", self.qux);
+  }
+  if (self.hasComplexOptionType5) {
+    PBJSONWriteMessage(writer, "complexoptiontype5", self.complexOptionType5);
+  }
+}
 @end
 
-@interface ComplexOptionType3_ComplexOptionType5 ()
-@property int32_t plugh;
-@end
-
-@implementation ComplexOptionType3_ComplexOptionType5
+@interface ComplexOptionType3_ComplexOptionType5 ()
+@property (nonatomic, readwrite) BOOL hasPlugh;
+@property (nonatomic, readwrite) int32_t plugh;
+@end
 
-- (BOOL) hasPlugh {
-  return !!hasPlugh_;
-}
-- (void) setHasPlugh:(BOOL) value {
-  hasPlugh_ = !!value;
-}
-@synthesize plugh;
+@implementation ComplexOptionType3_ComplexOptionType5
 
 - (id) init {
   if ((self = [super init])) {
@@ -3296,17 +3302,16 @@ static ComplexOptionType3* defaultComplexOptionType3Instance = nil;
   }
   return self;
 }
-static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexOptionType5Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOptionType3_ComplexOptionType5 class]) {
-    defaultComplexOptionType3_ComplexOptionType5Instance = [[ComplexOptionType3_ComplexOptionType5 alloc] init];
-  }
-}
 + (ComplexOptionType3_ComplexOptionType5*) defaultInstance {
+  static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexOptionType5Instance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOptionType3_ComplexOptionType5Instance = [[ComplexOptionType3_ComplexOptionType5 alloc] init];
+  });
   return defaultComplexOptionType3_ComplexOptionType5Instance;
 }
 - (ComplexOptionType3_ComplexOptionType5*) defaultInstance {
-  return defaultComplexOptionType3_ComplexOptionType5Instance;
+  return [ComplexOptionType3_ComplexOptionType5 defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -3318,39 +3323,21 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasPlugh) {
-    size += computeInt32Size(3, self.plugh);
+    size_ += computeInt32Size(3, self.plugh);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromData:(NSData*) data {
-  return (ComplexOptionType3_ComplexOptionType5*)[[[ComplexOptionType3_ComplexOptionType5 builder] mergeFromData:data] build];
-}
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType3_ComplexOptionType5*)[[[ComplexOptionType3_ComplexOptionType5 builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromInputStream:(NSInputStream*) input {
-  return (ComplexOptionType3_ComplexOptionType5*)[[[ComplexOptionType3_ComplexOptionType5 builder] mergeFromInputStream:input] build];
-}
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType3_ComplexOptionType5*)[[[ComplexOptionType3_ComplexOptionType5 builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (ComplexOptionType3_ComplexOptionType5*)[[[ComplexOptionType3_ComplexOptionType5 builder] mergeFromCodedInputStream:input] build];
-}
-+ (ComplexOptionType3_ComplexOptionType5*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOptionType3_ComplexOptionType5*)[[[ComplexOptionType3_ComplexOptionType5 builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (ComplexOptionType3_ComplexOptionType5_Builder*) builder {
-  return [[ComplexOptionType3_ComplexOptionType5_Builder alloc] init] ;
+  return [[ComplexOptionType3_ComplexOptionType5_Builder alloc] init];
 }
 + (ComplexOptionType3_ComplexOptionType5_Builder*) builderWithPrototype:(ComplexOptionType3_ComplexOptionType5*) prototype {
   return [[ComplexOptionType3_ComplexOptionType5 builder] mergeFrom:prototype];
@@ -3361,11 +3348,11 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
 - (ComplexOptionType3_ComplexOptionType5_Builder*) toBuilder {
   return [ComplexOptionType3_ComplexOptionType5 builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasPlugh) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"plugh", [NSNumber numberWithInt:self.plugh]];
+    PBTextFormatWriteInt32(writer, "plugh", self.plugh);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -3378,41 +3365,37 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   return
       self.hasPlugh == otherMessage.hasPlugh &&
       (!self.hasPlugh || self.plugh == otherMessage.plugh) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasPlugh) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.plugh] hash];
+    hashCode = hashCode * 31 + [@(self.plugh) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasPlugh) {
+    PBJSONWriteInt32(writer, "plugh", self.plugh);
+  }
+}
 @end
 
 @interface ComplexOptionType3_ComplexOptionType5_Builder()
-@property (strong) ComplexOptionType3_ComplexOptionType5* result;
+@property (strong) ComplexOptionType3_ComplexOptionType5* builder_result;
 @end
 
 @implementation ComplexOptionType3_ComplexOptionType5_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[ComplexOptionType3_ComplexOptionType5 alloc] init] ;
+    self.builder_result = [[ComplexOptionType3_ComplexOptionType5 alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (ComplexOptionType3_ComplexOptionType5_Builder*) clear {
-  self.result = [[ComplexOptionType3_ComplexOptionType5 alloc] init] ;
-  return self;
-}
-- (ComplexOptionType3_ComplexOptionType5_Builder*) clone {
-  return [ComplexOptionType3_ComplexOptionType5 builderWithPrototype:result];
+  return builder_result;
 }
 - (ComplexOptionType3_ComplexOptionType5*) defaultInstance {
   return [ComplexOptionType3_ComplexOptionType5 defaultInstance];
@@ -3422,8 +3405,8 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   return [self buildPartial];
 }
 - (ComplexOptionType3_ComplexOptionType5*) buildPartial {
-  ComplexOptionType3_ComplexOptionType5* returnMe = result;
-  self.result = nil;
+  ComplexOptionType3_ComplexOptionType5* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFrom:(ComplexOptionType3_ComplexOptionType5*) other {
@@ -3436,9 +3419,6 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -3461,46 +3441,79 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
     }
   }
 }
-- (BOOL) hasPlugh {
-  return result.hasPlugh;
+- (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 5:
+        if (memcmp(name, "plugh", 5) == 0) {
+          [self setPlugh:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) plugh {
-  return result.plugh;
+- (ComplexOptionType3_ComplexOptionType5_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 5:
+        if (memcmp(name, "plugh", 5) == 0) {
+          number = 3;
+        }
+        break;
+    }
+    switch (number) {
+      case 3: {
+        [self setPlugh:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (ComplexOptionType3_ComplexOptionType5_Builder*) setPlugh:(int32_t) value {
-  result.hasPlugh = YES;
-  result.plugh = value;
+  builder_result.hasPlugh = YES;
+  builder_result.plugh = value;
   return self;
 }
-- (ComplexOptionType3_ComplexOptionType5_Builder*) clearPlugh {
-  result.hasPlugh = NO;
-  result.plugh = 0;
+- (int32_t) plugh {
+  return builder_result.plugh;
+}
+- (BOOL)hasPlugh {
+ return builder_result.hasPlugh;
+}
+- (ComplexOptionType3_ComplexOptionType5_Builder*)clearPlugh {
+  builder_result.hasPlugh = NO;
+  builder_result.plugh = 0;
   return self;
 }
 @end
 
 @interface ComplexOptionType3_Builder()
-@property (strong) ComplexOptionType3* result;
+@property (strong) ComplexOptionType3* builder_result;
 @end
 
 @implementation ComplexOptionType3_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[ComplexOptionType3 alloc] init] ;
+    self.builder_result = [[ComplexOptionType3 alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (ComplexOptionType3_Builder*) clear {
-  self.result = [[ComplexOptionType3 alloc] init] ;
-  return self;
-}
-- (ComplexOptionType3_Builder*) clone {
-  return [ComplexOptionType3 builderWithPrototype:result];
+  return builder_result;
 }
 - (ComplexOptionType3*) defaultInstance {
   return [ComplexOptionType3 defaultInstance];
@@ -3510,8 +3523,8 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   return [self buildPartial];
 }
 - (ComplexOptionType3*) buildPartial {
-  ComplexOptionType3* returnMe = result;
-  self.result = nil;
+  ComplexOptionType3* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (ComplexOptionType3_Builder*) mergeFrom:(ComplexOptionType3*) other {
@@ -3527,9 +3540,6 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (ComplexOptionType3_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (ComplexOptionType3_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -3551,8 +3561,8 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
       }
       case 19: {
         ComplexOptionType3_ComplexOptionType5_Builder* subBuilder = [ComplexOptionType3_ComplexOptionType5 builder];
-        if (self.hasComplexOptionType5) {
-          [subBuilder mergeFrom:self.complexOptionType5];
+        if (self.builder_result.hasComplexOptionType5) {
+          [subBuilder mergeFrom:self.builder_result.complexOptionType5];
         }
         [input readGroup:2 builder:subBuilder extensionRegistry:extensionRegistry];
         [self setComplexOptionType5:[subBuilder buildPartial]];
@@ -3561,85 +3571,143 @@ static ComplexOptionType3_ComplexOptionType5* defaultComplexOptionType3_ComplexO
     }
   }
 }
-- (BOOL) hasQux {
-  return result.hasQux;
+- (ComplexOptionType3_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 3:
+        if (memcmp(name, "qux", 3) == 0) {
+          [self setQux:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+      case 18:
+        if (memcmp(name, "ComplexOptionType5", 18) == 0) {
+          ComplexOptionType3_ComplexOptionType5_Builder* subBuilder = [ComplexOptionType3_ComplexOptionType5 builder];
+          if (self.builder_result.hasComplexOptionType5) {
+            [subBuilder mergeFrom:self.builder_result.complexOptionType5];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setComplexOptionType5:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) qux {
-  return result.qux;
+- (ComplexOptionType3_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 3:
+        if (memcmp(name, "qux", 3) == 0) {
+          number = 1;
+        }
+        break;
+      case 18:
+        if (memcmp(name, "complexoptiontype5", 18) == 0) {
+          number = 2;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setQux:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 2: {
+        ComplexOptionType3_ComplexOptionType5_Builder* subBuilder = [ComplexOptionType3_ComplexOptionType5 builder];
+        if (self.builder_result.hasComplexOptionType5) {
+          [subBuilder mergeFrom:self.builder_result.complexOptionType5];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setComplexOptionType5:[subBuilder buildPartial]];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (ComplexOptionType3_Builder*) setQux:(int32_t) value {
-  result.hasQux = YES;
-  result.qux = value;
+  builder_result.hasQux = YES;
+  builder_result.qux = value;
   return self;
 }
-- (ComplexOptionType3_Builder*) clearQux {
-  result.hasQux = NO;
-  result.qux = 0;
-  return self;
+- (int32_t) qux {
+  return builder_result.qux;
 }
-- (BOOL) hasComplexOptionType5 {
-  return result.hasComplexOptionType5;
+- (BOOL)hasQux {
+ return builder_result.hasQux;
 }
-- (ComplexOptionType3_ComplexOptionType5*) complexOptionType5 {
-  return result.complexOptionType5;
+- (ComplexOptionType3_Builder*)clearQux {
+  builder_result.hasQux = NO;
+  builder_result.qux = 0;
+  return self;
 }
 - (ComplexOptionType3_Builder*) setComplexOptionType5:(ComplexOptionType3_ComplexOptionType5*) value {
-  result.hasComplexOptionType5 = YES;
-  result.complexOptionType5 = value;
+  builder_result.hasComplexOptionType5 = YES;
+  builder_result.complexOptionType5 = value;
   return self;
 }
 - (ComplexOptionType3_Builder*) setComplexOptionType5Builder:(ComplexOptionType3_ComplexOptionType5_Builder*) builderForValue {
   return [self setComplexOptionType5:[builderForValue build]];
 }
 - (ComplexOptionType3_Builder*) mergeComplexOptionType5:(ComplexOptionType3_ComplexOptionType5*) value {
-  if (result.hasComplexOptionType5 &&
-      result.complexOptionType5 != [ComplexOptionType3_ComplexOptionType5 defaultInstance]) {
-    result.complexOptionType5 =
-      [[[ComplexOptionType3_ComplexOptionType5 builderWithPrototype:result.complexOptionType5] mergeFrom:value] buildPartial];
+  if (builder_result.hasComplexOptionType5 &&
+      builder_result.complexOptionType5 != [ComplexOptionType3_ComplexOptionType5 defaultInstance]) {
+    builder_result.complexOptionType5 =
+      [[[ComplexOptionType3_ComplexOptionType5 builderWithPrototype:builder_result.complexOptionType5] mergeFrom:value] buildPartial];
   } else {
-    result.complexOptionType5 = value;
+    builder_result.complexOptionType5 = value;
   }
-  result.hasComplexOptionType5 = YES;
+  builder_result.hasComplexOptionType5 = YES;
   return self;
 }
-- (ComplexOptionType3_Builder*) clearComplexOptionType5 {
-  result.hasComplexOptionType5 = NO;
-  result.complexOptionType5 = [ComplexOptionType3_ComplexOptionType5 defaultInstance];
+- (ComplexOptionType3_ComplexOptionType5*) complexOptionType5 {
+  return builder_result.complexOptionType5;
+}
+- (BOOL)hasComplexOptionType5 {
+ return builder_result.hasComplexOptionType5;
+}
+- (ComplexOptionType3_Builder*)clearComplexOptionType5 {
+  builder_result.hasComplexOptionType5 = NO;
+  builder_result.complexOptionType5 = [ComplexOptionType3_ComplexOptionType5 defaultInstance];
   return self;
 }
 @end
 
 @interface ComplexOpt6 ()
-@property int32_t xyzzy;
+@property (nonatomic, readwrite) BOOL hasXyzzy;
+@property (nonatomic, readwrite) int32_t xyzzy;
 @end
 
 @implementation ComplexOpt6
 
-- (BOOL) hasXyzzy {
-  return !!hasXyzzy_;
-}
-- (void) setHasXyzzy:(BOOL) value {
-  hasXyzzy_ = !!value;
-}
-@synthesize xyzzy;
-
 - (id) init {
   if ((self = [super init])) {
     self.xyzzy = 0;
   }
   return self;
 }
-static ComplexOpt6* defaultComplexOpt6Instance = nil;
-+ (void) initialize {
-  if (self == [ComplexOpt6 class]) {
-    defaultComplexOpt6Instance = [[ComplexOpt6 alloc] init];
-  }
-}
 + (ComplexOpt6*) defaultInstance {
+  static ComplexOpt6* defaultComplexOpt6Instance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultComplexOpt6Instance = [[ComplexOpt6 alloc] init];
+  });
   return defaultComplexOpt6Instance;
 }
 - (ComplexOpt6*) defaultInstance {
-  return defaultComplexOpt6Instance;
+  return [ComplexOpt6 defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -3651,39 +3719,21 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasXyzzy) {
-    size += computeInt32Size(7593951, self.xyzzy);
+    size_ += computeInt32Size(7593951, self.xyzzy);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (ComplexOpt6*) parseFromData:(NSData*) data {
-  return (ComplexOpt6*)[[[ComplexOpt6 builder] mergeFromData:data] build];
-}
-+ (ComplexOpt6*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOpt6*)[[[ComplexOpt6 builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOpt6*) parseFromInputStream:(NSInputStream*) input {
-  return (ComplexOpt6*)[[[ComplexOpt6 builder] mergeFromInputStream:input] build];
-}
-+ (ComplexOpt6*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOpt6*)[[[ComplexOpt6 builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (ComplexOpt6*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (ComplexOpt6*)[[[ComplexOpt6 builder] mergeFromCodedInputStream:input] build];
-}
-+ (ComplexOpt6*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ComplexOpt6*)[[[ComplexOpt6 builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (ComplexOpt6_Builder*) builder {
-  return [[ComplexOpt6_Builder alloc] init] ;
+  return [[ComplexOpt6_Builder alloc] init];
 }
 + (ComplexOpt6_Builder*) builderWithPrototype:(ComplexOpt6*) prototype {
   return [[ComplexOpt6 builder] mergeFrom:prototype];
@@ -3694,11 +3744,11 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
 - (ComplexOpt6_Builder*) toBuilder {
   return [ComplexOpt6 builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasXyzzy) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"xyzzy", [NSNumber numberWithInt:self.xyzzy]];
+    PBTextFormatWriteInt32(writer, "xyzzy", self.xyzzy);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -3711,41 +3761,37 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
   return
       self.hasXyzzy == otherMessage.hasXyzzy &&
       (!self.hasXyzzy || self.xyzzy == otherMessage.xyzzy) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasXyzzy) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.xyzzy] hash];
+    hashCode = hashCode * 31 + [@(self.xyzzy) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasXyzzy) {
+    PBJSONWriteInt32(writer, "xyzzy", self.xyzzy);
+  }
+}
 @end
 
 @interface ComplexOpt6_Builder()
-@property (strong) ComplexOpt6* result;
+@property (strong) ComplexOpt6* builder_result;
 @end
 
 @implementation ComplexOpt6_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[ComplexOpt6 alloc] init] ;
+    self.builder_result = [[ComplexOpt6 alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (ComplexOpt6_Builder*) clear {
-  self.result = [[ComplexOpt6 alloc] init] ;
-  return self;
-}
-- (ComplexOpt6_Builder*) clone {
-  return [ComplexOpt6 builderWithPrototype:result];
+  return builder_result;
 }
 - (ComplexOpt6*) defaultInstance {
   return [ComplexOpt6 defaultInstance];
@@ -3755,8 +3801,8 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
   return [self buildPartial];
 }
 - (ComplexOpt6*) buildPartial {
-  ComplexOpt6* returnMe = result;
-  self.result = nil;
+  ComplexOpt6* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (ComplexOpt6_Builder*) mergeFrom:(ComplexOpt6*) other {
@@ -3769,9 +3815,6 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (ComplexOpt6_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (ComplexOpt6_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -3794,20 +3837,61 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
     }
   }
 }
-- (BOOL) hasXyzzy {
-  return result.hasXyzzy;
+- (ComplexOpt6_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 5:
+        if (memcmp(name, "xyzzy", 5) == 0) {
+          [self setXyzzy:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) xyzzy {
-  return result.xyzzy;
+- (ComplexOpt6_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 5:
+        if (memcmp(name, "xyzzy", 5) == 0) {
+          number = 7593951;
+        }
+        break;
+    }
+    switch (number) {
+      case 7593951: {
+        [self setXyzzy:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (ComplexOpt6_Builder*) setXyzzy:(int32_t) value {
-  result.hasXyzzy = YES;
-  result.xyzzy = value;
+  builder_result.hasXyzzy = YES;
+  builder_result.xyzzy = value;
   return self;
 }
-- (ComplexOpt6_Builder*) clearXyzzy {
-  result.hasXyzzy = NO;
-  result.xyzzy = 0;
+- (int32_t) xyzzy {
+  return builder_result.xyzzy;
+}
+- (BOOL)hasXyzzy {
+ return builder_result.hasXyzzy;
+}
+- (ComplexOpt6_Builder*)clearXyzzy {
+  builder_result.hasXyzzy = NO;
+  builder_result.xyzzy = 0;
   return self;
 }
 @end
@@ -3817,23 +3901,21 @@ static ComplexOpt6* defaultComplexOpt6Instance = nil;
 
 @implementation VariousComplexOptions
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
-+ (void) initialize {
-  if (self == [VariousComplexOptions class]) {
-    defaultVariousComplexOptionsInstance = [[VariousComplexOptions alloc] init];
-  }
-}
 + (VariousComplexOptions*) defaultInstance {
+  static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultVariousComplexOptionsInstance = [[VariousComplexOptions alloc] init];
+  });
   return defaultVariousComplexOptionsInstance;
 }
 - (VariousComplexOptions*) defaultInstance {
-  return defaultVariousComplexOptionsInstance;
+  return [VariousComplexOptions defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -3842,36 +3924,18 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (VariousComplexOptions*) parseFromData:(NSData*) data {
-  return (VariousComplexOptions*)[[[VariousComplexOptions builder] mergeFromData:data] build];
-}
-+ (VariousComplexOptions*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (VariousComplexOptions*)[[[VariousComplexOptions builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (VariousComplexOptions*) parseFromInputStream:(NSInputStream*) input {
-  return (VariousComplexOptions*)[[[VariousComplexOptions builder] mergeFromInputStream:input] build];
-}
-+ (VariousComplexOptions*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (VariousComplexOptions*)[[[VariousComplexOptions builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (VariousComplexOptions*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (VariousComplexOptions*)[[[VariousComplexOptions builder] mergeFromCodedInputStream:input] build];
-}
-+ (VariousComplexOptions*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (VariousComplexOptions*)[[[VariousComplexOptions builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (VariousComplexOptions_Builder*) builder {
-  return [[VariousComplexOptions_Builder alloc] init] ;
+  return [[VariousComplexOptions_Builder alloc] init];
 }
 + (VariousComplexOptions_Builder*) builderWithPrototype:(VariousComplexOptions*) prototype {
   return [[VariousComplexOptions builder] mergeFrom:prototype];
@@ -3882,8 +3946,8 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
 - (VariousComplexOptions_Builder*) toBuilder {
   return [VariousComplexOptions builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -3901,30 +3965,24 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface VariousComplexOptions_Builder()
-@property (strong) VariousComplexOptions* result;
+@property (strong) VariousComplexOptions* builder_result;
 @end
 
 @implementation VariousComplexOptions_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[VariousComplexOptions alloc] init] ;
+    self.builder_result = [[VariousComplexOptions alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (VariousComplexOptions_Builder*) clear {
-  self.result = [[VariousComplexOptions alloc] init] ;
-  return self;
-}
-- (VariousComplexOptions_Builder*) clone {
-  return [VariousComplexOptions builderWithPrototype:result];
+  return builder_result;
 }
 - (VariousComplexOptions*) defaultInstance {
   return [VariousComplexOptions defaultInstance];
@@ -3934,8 +3992,8 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
   return [self buildPartial];
 }
 - (VariousComplexOptions*) buildPartial {
-  VariousComplexOptions* returnMe = result;
-  self.result = nil;
+  VariousComplexOptions* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (VariousComplexOptions_Builder*) mergeFrom:(VariousComplexOptions*) other {
@@ -3945,9 +4003,6 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (VariousComplexOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (VariousComplexOptions_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -3966,6 +4021,25 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
     }
   }
 }
+- (VariousComplexOptions_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (VariousComplexOptions_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface AggregateMessageSet ()
@@ -3973,23 +4047,21 @@ static VariousComplexOptions* defaultVariousComplexOptionsInstance = nil;
 
 @implementation AggregateMessageSet
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
-+ (void) initialize {
-  if (self == [AggregateMessageSet class]) {
-    defaultAggregateMessageSetInstance = [[AggregateMessageSet alloc] init];
-  }
-}
 + (AggregateMessageSet*) defaultInstance {
+  static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultAggregateMessageSetInstance = [[AggregateMessageSet alloc] init];
+  });
   return defaultAggregateMessageSetInstance;
 }
 - (AggregateMessageSet*) defaultInstance {
-  return defaultAggregateMessageSetInstance;
+  return [AggregateMessageSet defaultInstance];
 }
 - (BOOL) isInitialized {
   if (!self.extensionsAreInitialized) {
@@ -4000,41 +4072,23 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
   [self writeExtensionsToCodedOutputStream:output
                                       from:4
-                                        to:536870912];
+                                        to:2147483647];
   [self.unknownFields writeAsMessageSetTo:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSizeAsMessageSet;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (AggregateMessageSet*) parseFromData:(NSData*) data {
-  return (AggregateMessageSet*)[[[AggregateMessageSet builder] mergeFromData:data] build];
-}
-+ (AggregateMessageSet*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (AggregateMessageSet*)[[[AggregateMessageSet builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (AggregateMessageSet*) parseFromInputStream:(NSInputStream*) input {
-  return (AggregateMessageSet*)[[[AggregateMessageSet builder] mergeFromInputStream:input] build];
-}
-+ (AggregateMessageSet*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (AggregateMessageSet*)[[[AggregateMessageSet builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (AggregateMessageSet*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (AggregateMessageSet*)[[[AggregateMessageSet builder] mergeFromCodedInputStream:input] build];
-}
-+ (AggregateMessageSet*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (AggregateMessageSet*)[[[AggregateMessageSet builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSizeAsMessageSet;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (AggregateMessageSet_Builder*) builder {
-  return [[AggregateMessageSet_Builder alloc] init] ;
+  return [[AggregateMessageSet_Builder alloc] init];
 }
 + (AggregateMessageSet_Builder*) builderWithPrototype:(AggregateMessageSet*) prototype {
   return [[AggregateMessageSet builder] mergeFrom:prototype];
@@ -4045,12 +4099,11 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
 - (AggregateMessageSet_Builder*) toBuilder {
   return [AggregateMessageSet builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
-                                            from:4
-                                              to:536870912
-                                      withIndent:indent];
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self writeExtensionTextFormatTo:writer
+                              from:4
+                                to:2147483647];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -4061,40 +4114,34 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
   }
   AggregateMessageSet *otherMessage = other;
   return
-      [self isEqualExtensionsInOther:otherMessage from:4 to:536870912] &&
-      
+      [self isEqualExtensionsInOther:otherMessage from:4 to:2147483647] &&
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self hashExtensionsFrom:4 to:536870912];
+  hashCode = hashCode * 31 + [self hashExtensionsFrom:4 to:2147483647];
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface AggregateMessageSet_Builder()
-@property (strong) AggregateMessageSet* result;
+@property (strong) AggregateMessageSet* builder_result;
 @end
 
 @implementation AggregateMessageSet_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[AggregateMessageSet alloc] init] ;
+    self.builder_result = [[AggregateMessageSet alloc] init];
   }
   return self;
 }
 - (PBExtendableMessage*) internalGetResult {
-  return result;
-}
-- (AggregateMessageSet_Builder*) clear {
-  self.result = [[AggregateMessageSet alloc] init] ;
-  return self;
-}
-- (AggregateMessageSet_Builder*) clone {
-  return [AggregateMessageSet builderWithPrototype:result];
+  return builder_result;
 }
 - (AggregateMessageSet*) defaultInstance {
   return [AggregateMessageSet defaultInstance];
@@ -4104,8 +4151,8 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
   return [self buildPartial];
 }
 - (AggregateMessageSet*) buildPartial {
-  AggregateMessageSet* returnMe = result;
-  self.result = nil;
+  AggregateMessageSet* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (AggregateMessageSet_Builder*) mergeFrom:(AggregateMessageSet*) other {
@@ -4116,9 +4163,6 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (AggregateMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (AggregateMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -4137,42 +4181,53 @@ static AggregateMessageSet* defaultAggregateMessageSetInstance = nil;
     }
   }
 }
+- (AggregateMessageSet_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (AggregateMessageSet_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface AggregateMessageSetElement ()
-@property (strong) NSString* s;
+@property (nonatomic, readwrite) BOOL hasS;
+@property (nonatomic, readwrite) NSString* s;
 @end
 
 @implementation AggregateMessageSetElement
 
-- (BOOL) hasS {
-  return !!hasS_;
-}
-- (void) setHasS:(BOOL) value {
-  hasS_ = !!value;
-}
-@synthesize s;
-
 - (id) init {
   if ((self = [super init])) {
     self.s = @"";
   }
   return self;
 }
-+ (id<PBExtensionField>) messageSetExtension {
-  return AggregateMessageSetElement_messageSetExtension;
-}
-static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = nil;
-+ (void) initialize {
-  if (self == [AggregateMessageSetElement class]) {
-    defaultAggregateMessageSetElementInstance = [[AggregateMessageSetElement alloc] init];
-  }
-}
 + (AggregateMessageSetElement*) defaultInstance {
+  static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultAggregateMessageSetElementInstance = [[AggregateMessageSetElement alloc] init];
+  });
   return defaultAggregateMessageSetElementInstance;
 }
 - (AggregateMessageSetElement*) defaultInstance {
-  return defaultAggregateMessageSetElementInstance;
+  return [AggregateMessageSetElement defaultInstance];
+}
++ (id<PBExtensionField>) messageSetExtension {
+  return AggregateMessageSetElement_messageSetExtension;
 }
 - (BOOL) isInitialized {
   return YES;
@@ -4184,39 +4239,21 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasS) {
-    size += computeStringSize(1, self.s);
+    size_ += computeStringSize(1, self.s);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (AggregateMessageSetElement*) parseFromData:(NSData*) data {
-  return (AggregateMessageSetElement*)[[[AggregateMessageSetElement builder] mergeFromData:data] build];
-}
-+ (AggregateMessageSetElement*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (AggregateMessageSetElement*)[[[AggregateMessageSetElement builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (AggregateMessageSetElement*) parseFromInputStream:(NSInputStream*) input {
-  return (AggregateMessageSetElement*)[[[AggregateMessageSetElement builder] mergeFromInputStream:input] build];
-}
-+ (AggregateMessageSetElement*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (AggregateMessageSetElement*)[[[AggregateMessageSetElement builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (AggregateMessageSetElement*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (AggregateMessageSetElement*)[[[AggregateMessageSetElement builder] mergeFromCodedInputStream:input] build];
-}
-+ (AggregateMessageSetElement*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (AggregateMessageSetElement*)[[[AggregateMessageSetElement builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (AggregateMessageSetElement_Builder*) builder {
-  return [[AggregateMessageSetElement_Builder alloc] init] ;
+  return [[AggregateMessageSetElement_Builder alloc] init];
 }
 + (AggregateMessageSetElement_Builder*) builderWithPrototype:(AggregateMessageSetElement*) prototype {
   return [[AggregateMessageSetElement builder] mergeFrom:prototype];
@@ -4227,11 +4264,11 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
 - (AggregateMessageSetElement_Builder*) toBuilder {
   return [AggregateMessageSetElement builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasS) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"s", self.s];
+    PBTextFormatWriteObject(writer, "s", self.s);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -4244,7 +4281,6 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
   return
       self.hasS == otherMessage.hasS &&
       (!self.hasS || [self.s isEqual:otherMessage.s]) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
@@ -4255,30 +4291,27 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasS) {
+    PBJSONWriteString(writer, "s", self.s);
+  }
+}
 @end
 
 @interface AggregateMessageSetElement_Builder()
-@property (strong) AggregateMessageSetElement* result;
+@property (strong) AggregateMessageSetElement* builder_result;
 @end
 
 @implementation AggregateMessageSetElement_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[AggregateMessageSetElement alloc] init] ;
+    self.builder_result = [[AggregateMessageSetElement alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (AggregateMessageSetElement_Builder*) clear {
-  self.result = [[AggregateMessageSetElement alloc] init] ;
-  return self;
-}
-- (AggregateMessageSetElement_Builder*) clone {
-  return [AggregateMessageSetElement builderWithPrototype:result];
+  return builder_result;
 }
 - (AggregateMessageSetElement*) defaultInstance {
   return [AggregateMessageSetElement defaultInstance];
@@ -4288,8 +4321,8 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
   return [self buildPartial];
 }
 - (AggregateMessageSetElement*) buildPartial {
-  AggregateMessageSetElement* returnMe = result;
-  self.result = nil;
+  AggregateMessageSetElement* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (AggregateMessageSetElement_Builder*) mergeFrom:(AggregateMessageSetElement*) other {
@@ -4302,9 +4335,6 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (AggregateMessageSetElement_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (AggregateMessageSetElement_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -4327,70 +4357,80 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
     }
   }
 }
-- (BOOL) hasS {
-  return result.hasS;
+- (AggregateMessageSetElement_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 1:
+        if (memcmp(name, "s", 1) == 0) {
+          [self setS:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (NSString*) s {
-  return result.s;
+- (AggregateMessageSetElement_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 1:
+        if (memcmp(name, "s", 1) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setS:PBJSONReaderReadString(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (AggregateMessageSetElement_Builder*) setS:(NSString*) value {
-  result.hasS = YES;
-  result.s = value;
+  builder_result.hasS = YES;
+  builder_result.s = value;
   return self;
 }
-- (AggregateMessageSetElement_Builder*) clearS {
-  result.hasS = NO;
-  result.s = @"";
+- (NSString*) s {
+  return builder_result.s;
+}
+- (BOOL)hasS {
+ return builder_result.hasS;
+}
+- (AggregateMessageSetElement_Builder*)clearS {
+  builder_result.hasS = NO;
+  builder_result.s = @"";
   return self;
 }
 @end
 
 @interface Aggregate ()
-@property int32_t i;
-@property (strong) NSString* s;
-@property (strong) Aggregate* sub;
-@property (strong) PBFileOptions* file;
-@property (strong) AggregateMessageSet* mset;
+@property (nonatomic, readwrite) BOOL hasI;
+@property (nonatomic, readwrite) int32_t i;
+@property (nonatomic, readwrite) BOOL hasS;
+@property (nonatomic, readwrite) NSString* s;
+@property (nonatomic, readwrite) BOOL hasSub;
+@property (nonatomic, readwrite) Aggregate* sub;
+@property (nonatomic, readwrite) BOOL hasFile;
+@property (nonatomic, readwrite) PBFileOptions* file;
+@property (nonatomic, readwrite) BOOL hasMset;
+@property (nonatomic, readwrite) AggregateMessageSet* mset;
 @end
 
 @implementation Aggregate
 
-- (BOOL) hasI {
-  return !!hasI_;
-}
-- (void) setHasI:(BOOL) value {
-  hasI_ = !!value;
-}
-@synthesize i;
-- (BOOL) hasS {
-  return !!hasS_;
-}
-- (void) setHasS:(BOOL) value {
-  hasS_ = !!value;
-}
-@synthesize s;
-- (BOOL) hasSub {
-  return !!hasSub_;
-}
-- (void) setHasSub:(BOOL) value {
-  hasSub_ = !!value;
-}
-@synthesize sub;
-- (BOOL) hasFile {
-  return !!hasFile_;
-}
-- (void) setHasFile:(BOOL) value {
-  hasFile_ = !!value;
-}
-@synthesize file;
-- (BOOL) hasMset {
-  return !!hasMset_;
-}
-- (void) setHasMset:(BOOL) value {
-  hasMset_ = !!value;
-}
-@synthesize mset;
-
 - (id) init {
   if ((self = [super init])) {
     self.i = 0;
@@ -4401,9 +4441,6 @@ static AggregateMessageSetElement* defaultAggregateMessageSetElementInstance = n
   }
   return self;
 }
-+ (id<PBExtensionField>) nested {
-  return Aggregate_nested;
-}
 static Aggregate* defaultAggregateInstance = nil;
 + (void) initialize {
   if (self == [Aggregate class]) {
@@ -4414,7 +4451,10 @@ static Aggregate* defaultAggregateInstance = nil;
   return defaultAggregateInstance;
 }
 - (Aggregate*) defaultInstance {
-  return defaultAggregateInstance;
+  return [Aggregate defaultInstance];
+}
++ (id<PBExtensionField>) nested {
+  return Aggregate_nested;
 }
 - (BOOL) isInitialized {
   if (self.hasSub) {
@@ -4453,51 +4493,33 @@ static Aggregate* defaultAggregateInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasI) {
-    size += computeInt32Size(1, self.i);
+    size_ += computeInt32Size(1, self.i);
   }
   if (self.hasS) {
-    size += computeStringSize(2, self.s);
+    size_ += computeStringSize(2, self.s);
   }
   if (self.hasSub) {
-    size += computeMessageSize(3, self.sub);
+    size_ += computeMessageSize(3, self.sub);
   }
   if (self.hasFile) {
-    size += computeMessageSize(4, self.file);
+    size_ += computeMessageSize(4, self.file);
   }
   if (self.hasMset) {
-    size += computeMessageSize(5, self.mset);
+    size_ += computeMessageSize(5, self.mset);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (Aggregate*) parseFromData:(NSData*) data {
-  return (Aggregate*)[[[Aggregate builder] mergeFromData:data] build];
-}
-+ (Aggregate*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (Aggregate*)[[[Aggregate builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (Aggregate*) parseFromInputStream:(NSInputStream*) input {
-  return (Aggregate*)[[[Aggregate builder] mergeFromInputStream:input] build];
-}
-+ (Aggregate*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (Aggregate*)[[[Aggregate builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (Aggregate*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (Aggregate*)[[[Aggregate builder] mergeFromCodedInputStream:input] build];
-}
-+ (Aggregate*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (Aggregate*)[[[Aggregate builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (Aggregate_Builder*) builder {
-  return [[Aggregate_Builder alloc] init] ;
+  return [[Aggregate_Builder alloc] init];
 }
 + (Aggregate_Builder*) builderWithPrototype:(Aggregate*) prototype {
   return [[Aggregate builder] mergeFrom:prototype];
@@ -4508,32 +4530,23 @@ static Aggregate* defaultAggregateInstance = nil;
 - (Aggregate_Builder*) toBuilder {
   return [Aggregate builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasI) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"i", [NSNumber numberWithInt:self.i]];
+    PBTextFormatWriteInt32(writer, "i", self.i);
   }
   if (self.hasS) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"s", self.s];
+    PBTextFormatWriteObject(writer, "s", self.s);
   }
   if (self.hasSub) {
-    [output appendFormat:@"%@%@ {\n", indent, @"sub"];
-    [self.sub writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "sub", self.sub);
   }
   if (self.hasFile) {
-    [output appendFormat:@"%@%@ {\n", indent, @"file"];
-    [self.file writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "file", self.file);
   }
   if (self.hasMset) {
-    [output appendFormat:@"%@%@ {\n", indent, @"mset"];
-    [self.mset writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "mset", self.mset);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -4546,25 +4559,20 @@ static Aggregate* defaultAggregateInstance = nil;
   return
       self.hasI == otherMessage.hasI &&
       (!self.hasI || self.i == otherMessage.i) &&
-      
       self.hasS == otherMessage.hasS &&
       (!self.hasS || [self.s isEqual:otherMessage.s]) &&
-      
       self.hasSub == otherMessage.hasSub &&
       (!self.hasSub || [self.sub isEqual:otherMessage.sub]) &&
-      
       self.hasFile == otherMessage.hasFile &&
       (!self.hasFile || [self.file isEqual:otherMessage.file]) &&
-      
       self.hasMset == otherMessage.hasMset &&
       (!self.hasMset || [self.mset isEqual:otherMessage.mset]) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasI) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.i] hash];
+    hashCode = hashCode * 31 + [@(self.i) hash];
   }
   if (self.hasS) {
     hashCode = hashCode * 31 + [self.s hash];
@@ -4581,30 +4589,39 @@ static Aggregate* defaultAggregateInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasI) {
+    PBJSONWriteInt32(writer, "i", self.i);
+  }
+  if (self.hasS) {
+    PBJSONWriteString(writer, "s", self.s);
+  }
+  if (self.hasSub) {
+    PBJSONWriteMessage(writer, "sub", self.sub);
+  }
+  if (self.hasFile) {
+    PBJSONWriteMessage(writer, "file", self.file);
+  }
+  if (self.hasMset) {
+    PBJSONWriteMessage(writer, "mset", self.mset);
+  }
+}
 @end
 
 @interface Aggregate_Builder()
-@property (strong) Aggregate* result;
+@property (strong) Aggregate* builder_result;
 @end
 
 @implementation Aggregate_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[Aggregate alloc] init] ;
+    self.builder_result = [[Aggregate alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (Aggregate_Builder*) clear {
-  self.result = [[Aggregate alloc] init] ;
-  return self;
-}
-- (Aggregate_Builder*) clone {
-  return [Aggregate builderWithPrototype:result];
+  return builder_result;
 }
 - (Aggregate*) defaultInstance {
   return [Aggregate defaultInstance];
@@ -4614,8 +4631,8 @@ static Aggregate* defaultAggregateInstance = nil;
   return [self buildPartial];
 }
 - (Aggregate*) buildPartial {
-  Aggregate* returnMe = result;
-  self.result = nil;
+  Aggregate* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (Aggregate_Builder*) mergeFrom:(Aggregate*) other {
@@ -4640,9 +4657,6 @@ static Aggregate* defaultAggregateInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (Aggregate_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (Aggregate_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -4668,8 +4682,8 @@ static Aggregate* defaultAggregateInstance = nil;
       }
       case 26: {
         Aggregate_Builder* subBuilder = [Aggregate builder];
-        if (self.hasSub) {
-          [subBuilder mergeFrom:self.sub];
+        if (self.builder_result.hasSub) {
+          [subBuilder mergeFrom:self.builder_result.sub];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setSub:[subBuilder buildPartial]];
@@ -4677,8 +4691,8 @@ static Aggregate* defaultAggregateInstance = nil;
       }
       case 34: {
         PBFileOptions_Builder* subBuilder = [PBFileOptions builder];
-        if (self.hasFile) {
-          [subBuilder mergeFrom:self.file];
+        if (self.builder_result.hasFile) {
+          [subBuilder mergeFrom:self.builder_result.file];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setFile:[subBuilder buildPartial]];
@@ -4686,8 +4700,8 @@ static Aggregate* defaultAggregateInstance = nil;
       }
       case 42: {
         AggregateMessageSet_Builder* subBuilder = [AggregateMessageSet builder];
-        if (self.hasMset) {
-          [subBuilder mergeFrom:self.mset];
+        if (self.builder_result.hasMset) {
+          [subBuilder mergeFrom:self.builder_result.mset];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setMset:[subBuilder buildPartial]];
@@ -4696,161 +4710,274 @@ static Aggregate* defaultAggregateInstance = nil;
     }
   }
 }
-- (BOOL) hasI {
-  return result.hasI;
+- (Aggregate_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 1:
+        if (memcmp(name, "i", 1) == 0) {
+          [self setI:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "s", 1) == 0) {
+          [self setS:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 3:
+        if (memcmp(name, "sub", 3) == 0) {
+          Aggregate_Builder* subBuilder = [Aggregate builder];
+          if (self.builder_result.hasSub) {
+            [subBuilder mergeFrom:self.builder_result.sub];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setSub:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 4:
+        if (memcmp(name, "file", 4) == 0) {
+          PBFileOptions_Builder* subBuilder = [PBFileOptions builder];
+          if (self.builder_result.hasFile) {
+            [subBuilder mergeFrom:self.builder_result.file];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setFile:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "mset", 4) == 0) {
+          AggregateMessageSet_Builder* subBuilder = [AggregateMessageSet builder];
+          if (self.builder_result.hasMset) {
+            [subBuilder mergeFrom:self.builder_result.mset];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setMset:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) i {
-  return result.i;
+- (Aggregate_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 1:
+        if (memcmp(name, "i", 1) == 0) {
+          number = 1;
+        } else if (memcmp(name, "s", 1) == 0) {
+          number = 2;
+        }
+        break;
+      case 3:
+        if (memcmp(name, "sub", 3) == 0) {
+          number = 3;
+        }
+        break;
+      case 4:
+        if (memcmp(name, "file", 4) == 0) {
+          number = 4;
+        } else if (memcmp(name, "mset", 4) == 0) {
+          number = 5;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setI:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 2: {
+        [self setS:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 3: {
+        Aggregate_Builder* subBuilder = [Aggregate builder];
+        if (self.builder_result.hasSub) {
+          [subBuilder mergeFrom:self.builder_result.sub];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setSub:[subBuilder buildPartial]];
+        continue;
+      }
+      case 4: {
+        PBFileOptions_Builder* subBuilder = [PBFileOptions builder];
+        if (self.builder_result.hasFile) {
+          [subBuilder mergeFrom:self.builder_result.file];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setFile:[subBuilder buildPartial]];
+        continue;
+      }
+      case 5: {
+        AggregateMessageSet_Builder* subBuilder = [AggregateMessageSet builder];
+        if (self.builder_result.hasMset) {
+          [subBuilder mergeFrom:self.builder_result.mset];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setMset:[subBuilder buildPartial]];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (Aggregate_Builder*) setI:(int32_t) value {
-  result.hasI = YES;
-  result.i = value;
+  builder_result.hasI = YES;
+  builder_result.i = value;
   return self;
 }
-- (Aggregate_Builder*) clearI {
-  result.hasI = NO;
-  result.i = 0;
-  return self;
+- (int32_t) i {
+  return builder_result.i;
 }
-- (BOOL) hasS {
-  return result.hasS;
+- (BOOL)hasI {
+ return builder_result.hasI;
 }
-- (NSString*) s {
-  return result.s;
+- (Aggregate_Builder*)clearI {
+  builder_result.hasI = NO;
+  builder_result.i = 0;
+  return self;
 }
 - (Aggregate_Builder*) setS:(NSString*) value {
-  result.hasS = YES;
-  result.s = value;
+  builder_result.hasS = YES;
+  builder_result.s = value;
   return self;
 }
-- (Aggregate_Builder*) clearS {
-  result.hasS = NO;
-  result.s = @"";
-  return self;
+- (NSString*) s {
+  return builder_result.s;
 }
-- (BOOL) hasSub {
-  return result.hasSub;
+- (BOOL)hasS {
+ return builder_result.hasS;
 }
-- (Aggregate*) sub {
-  return result.sub;
+- (Aggregate_Builder*)clearS {
+  builder_result.hasS = NO;
+  builder_result.s = @"";
+  return self;
 }
 - (Aggregate_Builder*) setSub:(Aggregate*) value {
-  result.hasSub = YES;
-  result.sub = value;
+  builder_result.hasSub = YES;
+  builder_result.sub = value;
   return self;
 }
 - (Aggregate_Builder*) setSubBuilder:(Aggregate_Builder*) builderForValue {
   return [self setSub:[builderForValue build]];
 }
 - (Aggregate_Builder*) mergeSub:(Aggregate*) value {
-  if (result.hasSub &&
-      result.sub != [Aggregate defaultInstance]) {
-    result.sub =
-      [[[Aggregate builderWithPrototype:result.sub] mergeFrom:value] buildPartial];
+  if (builder_result.hasSub &&
+      builder_result.sub != [Aggregate defaultInstance]) {
+    builder_result.sub =
+      [[[Aggregate builderWithPrototype:builder_result.sub] mergeFrom:value] buildPartial];
   } else {
-    result.sub = value;
+    builder_result.sub = value;
   }
-  result.hasSub = YES;
+  builder_result.hasSub = YES;
   return self;
 }
-- (Aggregate_Builder*) clearSub {
-  result.hasSub = NO;
-  result.sub = [Aggregate defaultInstance];
-  return self;
+- (Aggregate*) sub {
+  return builder_result.sub;
 }
-- (BOOL) hasFile {
-  return result.hasFile;
+- (BOOL)hasSub {
+ return builder_result.hasSub;
 }
-- (PBFileOptions*) file {
-  return result.file;
+- (Aggregate_Builder*)clearSub {
+  builder_result.hasSub = NO;
+  builder_result.sub = [Aggregate defaultInstance];
+  return self;
 }
 - (Aggregate_Builder*) setFile:(PBFileOptions*) value {
-  result.hasFile = YES;
-  result.file = value;
+  builder_result.hasFile = YES;
+  builder_result.file = value;
   return self;
 }
 - (Aggregate_Builder*) setFileBuilder:(PBFileOptions_Builder*) builderForValue {
   return [self setFile:[builderForValue build]];
 }
 - (Aggregate_Builder*) mergeFile:(PBFileOptions*) value {
-  if (result.hasFile &&
-      result.file != [PBFileOptions defaultInstance]) {
-    result.file =
-      [[[PBFileOptions builderWithPrototype:result.file] mergeFrom:value] buildPartial];
+  if (builder_result.hasFile &&
+      builder_result.file != [PBFileOptions defaultInstance]) {
+    builder_result.file =
+      [[[PBFileOptions builderWithPrototype:builder_result.file] mergeFrom:value] buildPartial];
   } else {
-    result.file = value;
+    builder_result.file = value;
   }
-  result.hasFile = YES;
+  builder_result.hasFile = YES;
   return self;
 }
-- (Aggregate_Builder*) clearFile {
-  result.hasFile = NO;
-  result.file = [PBFileOptions defaultInstance];
-  return self;
+- (PBFileOptions*) file {
+  return builder_result.file;
 }
-- (BOOL) hasMset {
-  return result.hasMset;
+- (BOOL)hasFile {
+ return builder_result.hasFile;
 }
-- (AggregateMessageSet*) mset {
-  return result.mset;
+- (Aggregate_Builder*)clearFile {
+  builder_result.hasFile = NO;
+  builder_result.file = [PBFileOptions defaultInstance];
+  return self;
 }
 - (Aggregate_Builder*) setMset:(AggregateMessageSet*) value {
-  result.hasMset = YES;
-  result.mset = value;
+  builder_result.hasMset = YES;
+  builder_result.mset = value;
   return self;
 }
 - (Aggregate_Builder*) setMsetBuilder:(AggregateMessageSet_Builder*) builderForValue {
   return [self setMset:[builderForValue build]];
 }
 - (Aggregate_Builder*) mergeMset:(AggregateMessageSet*) value {
-  if (result.hasMset &&
-      result.mset != [AggregateMessageSet defaultInstance]) {
-    result.mset =
-      [[[AggregateMessageSet builderWithPrototype:result.mset] mergeFrom:value] buildPartial];
+  if (builder_result.hasMset &&
+      builder_result.mset != [AggregateMessageSet defaultInstance]) {
+    builder_result.mset =
+      [[[AggregateMessageSet builderWithPrototype:builder_result.mset] mergeFrom:value] buildPartial];
   } else {
-    result.mset = value;
+    builder_result.mset = value;
   }
-  result.hasMset = YES;
+  builder_result.hasMset = YES;
   return self;
 }
-- (Aggregate_Builder*) clearMset {
-  result.hasMset = NO;
-  result.mset = [AggregateMessageSet defaultInstance];
+- (AggregateMessageSet*) mset {
+  return builder_result.mset;
+}
+- (BOOL)hasMset {
+ return builder_result.hasMset;
+}
+- (Aggregate_Builder*)clearMset {
+  builder_result.hasMset = NO;
+  builder_result.mset = [AggregateMessageSet defaultInstance];
   return self;
 }
 @end
 
 @interface AggregateMessage ()
-@property int32_t fieldname;
+@property (nonatomic, readwrite) BOOL hasFieldname;
+@property (nonatomic, readwrite) int32_t fieldname;
 @end
 
 @implementation AggregateMessage
 
-- (BOOL) hasFieldname {
-  return !!hasFieldname_;
-}
-- (void) setHasFieldname:(BOOL) value {
-  hasFieldname_ = !!value;
-}
-@synthesize fieldname;
-
 - (id) init {
   if ((self = [super init])) {
     self.fieldname = 0;
   }
   return self;
 }
-static AggregateMessage* defaultAggregateMessageInstance = nil;
-+ (void) initialize {
-  if (self == [AggregateMessage class]) {
-    defaultAggregateMessageInstance = [[AggregateMessage alloc] init];
-  }
-}
 + (AggregateMessage*) defaultInstance {
+  static AggregateMessage* defaultAggregateMessageInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultAggregateMessageInstance = [[AggregateMessage alloc] init];
+  });
   return defaultAggregateMessageInstance;
 }
 - (AggregateMessage*) defaultInstance {
-  return defaultAggregateMessageInstance;
+  return [AggregateMessage defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -4862,39 +4989,21 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasFieldname) {
-    size += computeInt32Size(1, self.fieldname);
+    size_ += computeInt32Size(1, self.fieldname);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (AggregateMessage*) parseFromData:(NSData*) data {
-  return (AggregateMessage*)[[[AggregateMessage builder] mergeFromData:data] build];
-}
-+ (AggregateMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (AggregateMessage*)[[[AggregateMessage builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (AggregateMessage*) parseFromInputStream:(NSInputStream*) input {
-  return (AggregateMessage*)[[[AggregateMessage builder] mergeFromInputStream:input] build];
-}
-+ (AggregateMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (AggregateMessage*)[[[AggregateMessage builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (AggregateMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (AggregateMessage*)[[[AggregateMessage builder] mergeFromCodedInputStream:input] build];
-}
-+ (AggregateMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (AggregateMessage*)[[[AggregateMessage builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (AggregateMessage_Builder*) builder {
-  return [[AggregateMessage_Builder alloc] init] ;
+  return [[AggregateMessage_Builder alloc] init];
 }
 + (AggregateMessage_Builder*) builderWithPrototype:(AggregateMessage*) prototype {
   return [[AggregateMessage builder] mergeFrom:prototype];
@@ -4905,11 +5014,11 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
 - (AggregateMessage_Builder*) toBuilder {
   return [AggregateMessage builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasFieldname) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"fieldname", [NSNumber numberWithInt:self.fieldname]];
+    PBTextFormatWriteInt32(writer, "fieldname", self.fieldname);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -4922,41 +5031,37 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
   return
       self.hasFieldname == otherMessage.hasFieldname &&
       (!self.hasFieldname || self.fieldname == otherMessage.fieldname) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasFieldname) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.fieldname] hash];
+    hashCode = hashCode * 31 + [@(self.fieldname) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasFieldname) {
+    PBJSONWriteInt32(writer, "fieldname", self.fieldname);
+  }
+}
 @end
 
 @interface AggregateMessage_Builder()
-@property (strong) AggregateMessage* result;
+@property (strong) AggregateMessage* builder_result;
 @end
 
 @implementation AggregateMessage_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[AggregateMessage alloc] init] ;
+    self.builder_result = [[AggregateMessage alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (AggregateMessage_Builder*) clear {
-  self.result = [[AggregateMessage alloc] init] ;
-  return self;
-}
-- (AggregateMessage_Builder*) clone {
-  return [AggregateMessage builderWithPrototype:result];
+  return builder_result;
 }
 - (AggregateMessage*) defaultInstance {
   return [AggregateMessage defaultInstance];
@@ -4966,8 +5071,8 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
   return [self buildPartial];
 }
 - (AggregateMessage*) buildPartial {
-  AggregateMessage* returnMe = result;
-  self.result = nil;
+  AggregateMessage* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (AggregateMessage_Builder*) mergeFrom:(AggregateMessage*) other {
@@ -4980,9 +5085,6 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (AggregateMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (AggregateMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -5005,21 +5107,63 @@ static AggregateMessage* defaultAggregateMessageInstance = nil;
     }
   }
 }
-- (BOOL) hasFieldname {
-  return result.hasFieldname;
+- (AggregateMessage_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 9:
+        if (memcmp(name, "fieldname", 9) == 0) {
+          [self setFieldname:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) fieldname {
-  return result.fieldname;
+- (AggregateMessage_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 9:
+        if (memcmp(name, "fieldname", 9) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setFieldname:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (AggregateMessage_Builder*) setFieldname:(int32_t) value {
-  result.hasFieldname = YES;
-  result.fieldname = value;
+  builder_result.hasFieldname = YES;
+  builder_result.fieldname = value;
   return self;
 }
-- (AggregateMessage_Builder*) clearFieldname {
-  result.hasFieldname = NO;
-  result.fieldname = 0;
+- (int32_t) fieldname {
+  return builder_result.fieldname;
+}
+- (BOOL)hasFieldname {
+ return builder_result.hasFieldname;
+}
+- (AggregateMessage_Builder*)clearFieldname {
+  builder_result.hasFieldname = NO;
+  builder_result.fieldname = 0;
   return self;
 }
 @end
 
+#pragma clang diagnostic pop
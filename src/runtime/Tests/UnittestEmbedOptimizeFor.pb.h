@@ -115,64 +115,40 @@
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry;
 @end
 
-@interface TestEmbedOptimizedForSize : PBGeneratedMessage {
-@private
-  BOOL hasOptionalMessage_:1;
-  TestOptimizedForSize* optionalMessage;
-  NSMutableArray * repeatedMessageArray;
-}
-- (BOOL) hasOptionalMessage;
-@property (readonly, strong) TestOptimizedForSize* optionalMessage;
-@property (readonly, strong) NSMutableArray * repeatedMessage;
+@interface TestEmbedOptimizedForSize : PBGeneratedMessage
+- (BOOL)hasOptionalMessage;
+@property (nonatomic, readonly) TestOptimizedForSize* optionalMessage;
+@property (nonatomic, readonly, nullable) NSArray<TestOptimizedForSize*> * repeatedMessage;
 - (TestOptimizedForSize*)repeatedMessageAtIndex:(NSUInteger)index;
 
 + (TestEmbedOptimizedForSize*) defaultInstance;
 - (TestEmbedOptimizedForSize*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestEmbedOptimizedForSize_Builder*) builder;
 + (TestEmbedOptimizedForSize_Builder*) builder;
 + (TestEmbedOptimizedForSize_Builder*) builderWithPrototype:(TestEmbedOptimizedForSize*) prototype;
 - (TestEmbedOptimizedForSize_Builder*) toBuilder;
-
-+ (TestEmbedOptimizedForSize*) parseFromData:(NSData*) data;
-+ (TestEmbedOptimizedForSize*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestEmbedOptimizedForSize*) parseFromInputStream:(NSInputStream*) input;
-+ (TestEmbedOptimizedForSize*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestEmbedOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestEmbedOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestEmbedOptimizedForSize_Builder : PBGeneratedMessage_Builder {
-@private
-  TestEmbedOptimizedForSize* result;
-}
-
+@interface TestEmbedOptimizedForSize_Builder : PBGeneratedMessage_Builder
 - (TestEmbedOptimizedForSize*) defaultInstance;
 
-- (TestEmbedOptimizedForSize_Builder*) clear;
-- (TestEmbedOptimizedForSize_Builder*) clone;
-
 - (TestEmbedOptimizedForSize*) build;
 - (TestEmbedOptimizedForSize*) buildPartial;
 
 - (TestEmbedOptimizedForSize_Builder*) mergeFrom:(TestEmbedOptimizedForSize*) other;
-- (TestEmbedOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestEmbedOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasOptionalMessage;
 - (TestOptimizedForSize*) optionalMessage;
+- (BOOL)hasOptionalMessage;
+- (TestEmbedOptimizedForSize_Builder*)clearOptionalMessage;
 - (TestEmbedOptimizedForSize_Builder*) setOptionalMessage:(TestOptimizedForSize*) value;
 - (TestEmbedOptimizedForSize_Builder*) setOptionalMessageBuilder:(TestOptimizedForSize_Builder*) builderForValue;
 - (TestEmbedOptimizedForSize_Builder*) mergeOptionalMessage:(TestOptimizedForSize*) value;
-- (TestEmbedOptimizedForSize_Builder*) clearOptionalMessage;
 
-- (PBAppendableArray *)repeatedMessage;
-- (TestOptimizedForSize*)repeatedMessageAtIndex:(NSUInteger)index;
+- (NSMutableArray *)repeatedMessage;
+- (TestEmbedOptimizedForSize_Builder*)clearRepeatedMessage;
 - (TestEmbedOptimizedForSize_Builder *)addRepeatedMessage:(TestOptimizedForSize*)value;
-- (TestEmbedOptimizedForSize_Builder *)setRepeatedMessageArray:(NSArray *)array;
-- (TestEmbedOptimizedForSize_Builder *)setRepeatedMessageValues:(const TestOptimizedForSize* *)values count:(NSUInteger)count;
-- (TestEmbedOptimizedForSize_Builder *)clearRepeatedMessage;
+- (TestEmbedOptimizedForSize_Builder *)setRepeatedMessageArray:(NSArray<TestOptimizedForSize*> *)array NS_SWIFT_NAME(setRepeatedMessageArray(_:));
++ (Class)expectedElementTypeForRepeatedMessageArray;
 @end
 
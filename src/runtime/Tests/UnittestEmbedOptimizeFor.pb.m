@@ -2,64 +2,55 @@
 
 #import "UnittestEmbedOptimizeFor.pb.h"
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wshadow-ivar"
+
 @implementation UnittestEmbedOptimizeForRoot
-static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
-  return extensionRegistry;
-}
-
-+ (void) initialize {
-  if (self == [UnittestEmbedOptimizeForRoot class]) {
+  static PBExtensionRegistry* extensionRegistry = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
     PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
+    [UnittestEmbedOptimizeForRoot registerAllExtensions:registry];
     [UnittestOptimizeForRoot registerAllExtensions:registry];
     extensionRegistry = registry;
-  }
+  });
+  return extensionRegistry;
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
 }
 @end
 
 @interface TestEmbedOptimizedForSize ()
-@property (strong) TestOptimizedForSize* optionalMessage;
-@property (strong) NSMutableArray * repeatedMessageArray;
+@property (nonatomic, readwrite) BOOL hasOptionalMessage;
+@property (nonatomic, readwrite) TestOptimizedForSize* optionalMessage;
+@property (nonatomic, readwrite) NSMutableArray * repeatedMessageArray;
 @end
 
 @implementation TestEmbedOptimizedForSize
 
-- (BOOL) hasOptionalMessage {
-  return !!hasOptionalMessage_;
-}
-- (void) setHasOptionalMessage:(BOOL) value {
-  hasOptionalMessage_ = !!value;
-}
-@synthesize optionalMessage;
-@synthesize repeatedMessageArray;
-@dynamic repeatedMessage;
-
 - (id) init {
   if ((self = [super init])) {
     self.optionalMessage = [TestOptimizedForSize defaultInstance];
   }
   return self;
 }
-static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil;
-+ (void) initialize {
-  if (self == [TestEmbedOptimizedForSize class]) {
-    defaultTestEmbedOptimizedForSizeInstance = [[TestEmbedOptimizedForSize alloc] init];
-  }
-}
 + (TestEmbedOptimizedForSize*) defaultInstance {
+  static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestEmbedOptimizedForSizeInstance = [[TestEmbedOptimizedForSize alloc] init];
+  });
   return defaultTestEmbedOptimizedForSizeInstance;
 }
 - (TestEmbedOptimizedForSize*) defaultInstance {
-  return defaultTestEmbedOptimizedForSizeInstance;
+  return [TestEmbedOptimizedForSize defaultInstance];
 }
 - (NSArray *)repeatedMessage {
-  return repeatedMessageArray;
+  return self.repeatedMessageArray;
 }
 - (TestOptimizedForSize*)repeatedMessageAtIndex:(NSUInteger)index {
-  return [repeatedMessageArray objectAtIndex:index];
+  return self.repeatedMessageArray[index];
 }
 - (BOOL) isInitialized {
   if (self.hasOptionalMessage) {
@@ -84,42 +75,24 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasOptionalMessage) {
-    size += computeMessageSize(1, self.optionalMessage);
+    size_ += computeMessageSize(1, self.optionalMessage);
   }
   for (TestOptimizedForSize *element in self.repeatedMessageArray) {
-    size += computeMessageSize(2, element);
+    size_ += computeMessageSize(2, element);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestEmbedOptimizedForSize*) parseFromData:(NSData*) data {
-  return (TestEmbedOptimizedForSize*)[[[TestEmbedOptimizedForSize builder] mergeFromData:data] build];
-}
-+ (TestEmbedOptimizedForSize*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestEmbedOptimizedForSize*)[[[TestEmbedOptimizedForSize builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestEmbedOptimizedForSize*) parseFromInputStream:(NSInputStream*) input {
-  return (TestEmbedOptimizedForSize*)[[[TestEmbedOptimizedForSize builder] mergeFromInputStream:input] build];
-}
-+ (TestEmbedOptimizedForSize*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestEmbedOptimizedForSize*)[[[TestEmbedOptimizedForSize builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestEmbedOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestEmbedOptimizedForSize*)[[[TestEmbedOptimizedForSize builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestEmbedOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestEmbedOptimizedForSize*)[[[TestEmbedOptimizedForSize builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestEmbedOptimizedForSize_Builder*) builder {
-  return [[TestEmbedOptimizedForSize_Builder alloc] init] ;
+  return [[TestEmbedOptimizedForSize_Builder alloc] init];
 }
 + (TestEmbedOptimizedForSize_Builder*) builderWithPrototype:(TestEmbedOptimizedForSize*) prototype {
   return [[TestEmbedOptimizedForSize builder] mergeFrom:prototype];
@@ -130,20 +103,14 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
 - (TestEmbedOptimizedForSize_Builder*) toBuilder {
   return [TestEmbedOptimizedForSize builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasOptionalMessage) {
-    [output appendFormat:@"%@%@ {\n", indent, @"optionalMessage"];
-    [self.optionalMessage writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "optionalMessage", self.optionalMessage);
   }
   for (TestOptimizedForSize* element in self.repeatedMessageArray) {
-    [output appendFormat:@"%@%@ {\n", indent, @"repeatedMessage"];
-    [element writeDescriptionTo:output
-                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "repeatedMessage", element);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -156,9 +123,7 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
   return
       self.hasOptionalMessage == otherMessage.hasOptionalMessage &&
       (!self.hasOptionalMessage || [self.optionalMessage isEqual:otherMessage.optionalMessage]) &&
-      
-      [self.repeatedMessageArray isEqualToArray:otherMessage.repeatedMessageArray] &&
-      
+      (self.repeatedMessageArray == otherMessage.repeatedMessageArray || [self.repeatedMessageArray isEqualToArray:otherMessage.repeatedMessageArray]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
@@ -172,30 +137,34 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasOptionalMessage) {
+    PBJSONWriteMessage(writer, "optionalMessage", self.optionalMessage);
+  }
+  if (self.repeatedMessageArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedMessage");
+    for (TestOptimizedForSize* element in self.repeatedMessageArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 @interface TestEmbedOptimizedForSize_Builder()
-@property (strong) TestEmbedOptimizedForSize* result;
+@property (strong) TestEmbedOptimizedForSize* builder_result;
 @end
 
 @implementation TestEmbedOptimizedForSize_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestEmbedOptimizedForSize alloc] init] ;
+    self.builder_result = [[TestEmbedOptimizedForSize alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestEmbedOptimizedForSize_Builder*) clear {
-  self.result = [[TestEmbedOptimizedForSize alloc] init] ;
-  return self;
-}
-- (TestEmbedOptimizedForSize_Builder*) clone {
-  return [TestEmbedOptimizedForSize builderWithPrototype:result];
+  return builder_result;
 }
 - (TestEmbedOptimizedForSize*) defaultInstance {
   return [TestEmbedOptimizedForSize defaultInstance];
@@ -205,8 +174,8 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
   return [self buildPartial];
 }
 - (TestEmbedOptimizedForSize*) buildPartial {
-  TestEmbedOptimizedForSize* returnMe = result;
-  self.result = nil;
+  TestEmbedOptimizedForSize* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestEmbedOptimizedForSize_Builder*) mergeFrom:(TestEmbedOptimizedForSize*) other {
@@ -217,19 +186,11 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
     [self mergeOptionalMessage:other.optionalMessage];
   }
   if (other.repeatedMessageArray.count > 0) {
-    if (result.repeatedMessageArray == nil) {
-      result.repeatedMessageArray = [other.repeatedMessageArray copy] ;
-    } else {
-      [result.repeatedMessageArray addObjectsFromArray:other.repeatedMessageArray];
-      
-    }
+    builder_result.repeatedMessageArray = [[NSMutableArray alloc] initWithArray:other.repeatedMessageArray];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestEmbedOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestEmbedOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -247,8 +208,8 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
       }
       case 10: {
         TestOptimizedForSize_Builder* subBuilder = [TestOptimizedForSize builder];
-        if (self.hasOptionalMessage) {
-          [subBuilder mergeFrom:self.optionalMessage];
+        if (self.builder_result.hasOptionalMessage) {
+          [subBuilder mergeFrom:self.builder_result.optionalMessage];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setOptionalMessage:[subBuilder buildPartial]];
@@ -263,60 +224,132 @@ static TestEmbedOptimizedForSize* defaultTestEmbedOptimizedForSizeInstance = nil
     }
   }
 }
-- (BOOL) hasOptionalMessage {
-  return result.hasOptionalMessage;
+- (TestEmbedOptimizedForSize_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 16:
+        if (memcmp(name, "optional_message", 16) == 0) {
+          TestOptimizedForSize_Builder* subBuilder = [TestOptimizedForSize builder];
+          if (self.builder_result.hasOptionalMessage) {
+            [subBuilder mergeFrom:self.builder_result.optionalMessage];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptionalMessage:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "repeated_message", 16) == 0) {
+          TestOptimizedForSize_Builder* subBuilder = [TestOptimizedForSize builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addRepeatedMessage:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (TestOptimizedForSize*) optionalMessage {
-  return result.optionalMessage;
+- (TestEmbedOptimizedForSize_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 15:
+        if (memcmp(name, "optionalMessage", 15) == 0) {
+          number = 1;
+        } else if (memcmp(name, "repeatedMessage", 15) == 0) {
+          number = 2;
+        }
+        break;
+      case 16:
+        if (memcmp(name, "optional_message", 16) == 0) {
+          number = 1;
+        } else if (memcmp(name, "repeated_message", 16) == 0) {
+          number = 2;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        TestOptimizedForSize_Builder* subBuilder = [TestOptimizedForSize builder];
+        if (self.builder_result.hasOptionalMessage) {
+          [subBuilder mergeFrom:self.builder_result.optionalMessage];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptionalMessage:[subBuilder buildPartial]];
+        continue;
+      }
+      case 2: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          TestOptimizedForSize_Builder* subBuilder = [TestOptimizedForSize builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addRepeatedMessage:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestEmbedOptimizedForSize_Builder*) setOptionalMessage:(TestOptimizedForSize*) value {
-  result.hasOptionalMessage = YES;
-  result.optionalMessage = value;
+  builder_result.hasOptionalMessage = YES;
+  builder_result.optionalMessage = value;
   return self;
 }
 - (TestEmbedOptimizedForSize_Builder*) setOptionalMessageBuilder:(TestOptimizedForSize_Builder*) builderForValue {
   return [self setOptionalMessage:[builderForValue build]];
 }
 - (TestEmbedOptimizedForSize_Builder*) mergeOptionalMessage:(TestOptimizedForSize*) value {
-  if (result.hasOptionalMessage &&
-      result.optionalMessage != [TestOptimizedForSize defaultInstance]) {
-    result.optionalMessage =
-      [[[TestOptimizedForSize builderWithPrototype:result.optionalMessage] mergeFrom:value] buildPartial];
+  if (builder_result.hasOptionalMessage &&
+      builder_result.optionalMessage != [TestOptimizedForSize defaultInstance]) {
+    builder_result.optionalMessage =
+      [[[TestOptimizedForSize builderWithPrototype:builder_result.optionalMessage] mergeFrom:value] buildPartial];
   } else {
-    result.optionalMessage = value;
+    builder_result.optionalMessage = value;
   }
-  result.hasOptionalMessage = YES;
+  builder_result.hasOptionalMessage = YES;
   return self;
 }
-- (TestEmbedOptimizedForSize_Builder*) clearOptionalMessage {
-  result.hasOptionalMessage = NO;
-  result.optionalMessage = [TestOptimizedForSize defaultInstance];
-  return self;
+- (TestOptimizedForSize*) optionalMessage {
+  return builder_result.optionalMessage;
 }
-- (NSMutableArray *)repeatedMessage {
-  return result.repeatedMessageArray;
+- (BOOL)hasOptionalMessage {
+ return builder_result.hasOptionalMessage;
 }
-- (TestOptimizedForSize*)repeatedMessageAtIndex:(NSUInteger)index {
-  return [result repeatedMessageAtIndex:index];
+- (TestEmbedOptimizedForSize_Builder*)clearOptionalMessage {
+  builder_result.hasOptionalMessage = NO;
+  builder_result.optionalMessage = [TestOptimizedForSize defaultInstance];
+  return self;
 }
 - (TestEmbedOptimizedForSize_Builder *)addRepeatedMessage:(TestOptimizedForSize*)value {
-  if (result.repeatedMessageArray == nil) {
-      result.repeatedMessageArray =  [[NSMutableArray alloc] init ];
+  if (builder_result.repeatedMessageArray == nil) {
+    builder_result.repeatedMessageArray = [[NSMutableArray alloc]init];
   }
-  [result.repeatedMessageArray addObject:value];
+  [builder_result.repeatedMessageArray addObject:value];
   return self;
 }
 - (TestEmbedOptimizedForSize_Builder *)setRepeatedMessageArray:(NSArray *)array {
-  result.repeatedMessageArray = [[NSMutableArray alloc] init ];
+  builder_result.repeatedMessageArray = [[NSMutableArray alloc]initWithArray:array];
   return self;
 }
-- (TestEmbedOptimizedForSize_Builder *)setRepeatedMessageValues:(const TestOptimizedForSize* *)values count:(NSUInteger)count {
-  result.repeatedMessageArray = [[NSMutableArray alloc] init ];
-  return self;
++ (Class)expectedElementTypeForRepeatedMessageArray {
+  return [TestOptimizedForSize class];
+}
+- (NSMutableArray *)repeatedMessage {
+  return builder_result.repeatedMessageArray;
 }
 - (TestEmbedOptimizedForSize_Builder *)clearRepeatedMessage {
-  result.repeatedMessageArray = nil;
+  builder_result.repeatedMessageArray = nil;
   return self;
 }
 @end
 
+#pragma clang diagnostic pop
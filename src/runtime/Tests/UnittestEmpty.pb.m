@@ -2,20 +2,22 @@
 
 #import "UnittestEmpty.pb.h"
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wshadow-ivar"
+
 @implementation UnittestEmptyRoot
-static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
-  return extensionRegistry;
-}
-
-+ (void) initialize {
-  if (self == [UnittestEmptyRoot class]) {
+  static PBExtensionRegistry* extensionRegistry = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
     PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
+    [UnittestEmptyRoot registerAllExtensions:registry];
     extensionRegistry = registry;
-  }
+  });
+  return extensionRegistry;
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
 }
 @end
 
+#pragma clang diagnostic pop
@@ -16,13 +16,16 @@
   #endif
 #endif
 
-typedef enum {
+typedef NS_CLOSED_ENUM(int32_t, ImportEnum) {
   ImportEnumImportFoo = 7,
   ImportEnumImportBar = 8,
   ImportEnumImportBaz = 9,
-} ImportEnum;
+};
 
 BOOL ImportEnumIsValidValue(ImportEnum value);
+ImportEnum ImportEnumReadTextFormat(PBTextFormatReader* reader);
+void ImportEnumWriteJSON(PBJSONWriter* writer, const char* name, ImportEnum value);
+ImportEnum ImportEnumReadJSON(PBJSONReader* reader);
 
 
 @interface UnittestImportRoot : NSObject {
@@ -31,52 +34,30 @@ BOOL ImportEnumIsValidValue(ImportEnum value);
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry;
 @end
 
-@interface ImportMessage : PBGeneratedMessage {
-@private
-  BOOL hasD_:1;
-  int32_t d;
-}
-- (BOOL) hasD;
-@property (readonly) int32_t d;
+@interface ImportMessage : PBGeneratedMessage
+- (BOOL)hasD;
+@property (nonatomic, readonly) int32_t d;
 
 + (ImportMessage*) defaultInstance;
 - (ImportMessage*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (ImportMessage_Builder*) builder;
 + (ImportMessage_Builder*) builder;
 + (ImportMessage_Builder*) builderWithPrototype:(ImportMessage*) prototype;
 - (ImportMessage_Builder*) toBuilder;
-
-+ (ImportMessage*) parseFromData:(NSData*) data;
-+ (ImportMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ImportMessage*) parseFromInputStream:(NSInputStream*) input;
-+ (ImportMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ImportMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (ImportMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface ImportMessage_Builder : PBGeneratedMessage_Builder {
-@private
-  ImportMessage* result;
-}
-
+@interface ImportMessage_Builder : PBGeneratedMessage_Builder
 - (ImportMessage*) defaultInstance;
 
-- (ImportMessage_Builder*) clear;
-- (ImportMessage_Builder*) clone;
-
 - (ImportMessage*) build;
 - (ImportMessage*) buildPartial;
 
 - (ImportMessage_Builder*) mergeFrom:(ImportMessage*) other;
-- (ImportMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (ImportMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasD;
 - (int32_t) d;
+- (BOOL)hasD;
+- (ImportMessage_Builder*)clearD;
 - (ImportMessage_Builder*) setD:(int32_t) value;
-- (ImportMessage_Builder*) clearD;
 @end
 
@@ -2,64 +2,69 @@
 
 #import "UnittestImport.pb.h"
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wshadow-ivar"
+
 @implementation UnittestImportRoot
-static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
-  return extensionRegistry;
-}
-
-+ (void) initialize {
-  if (self == [UnittestImportRoot class]) {
+  static PBExtensionRegistry* extensionRegistry = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
     PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
+    [UnittestImportRoot registerAllExtensions:registry];
     extensionRegistry = registry;
-  }
+  });
+  return extensionRegistry;
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
 }
 @end
 
 BOOL ImportEnumIsValidValue(ImportEnum value) {
-  switch (value) {
-    case ImportEnumImportFoo:
-    case ImportEnumImportBar:
-    case ImportEnumImportBaz:
-      return YES;
-    default:
-      return NO;
-  }
+  return (uint32_t)value - 7U < 3U;
+}
+static const char* const ImportEnumTextFormatNames[] = {
+  "IMPORT_FOO",
+  "IMPORT_BAR",
+  "IMPORT_BAZ",
+};
+static const int32_t ImportEnumTextFormatValues[] = {
+  7,
+  8,
+  9,
+};
+ImportEnum ImportEnumReadTextFormat(PBTextFormatReader* reader) {
+  return (ImportEnum)PBTextFormatReaderReadEnum(reader, ImportEnumTextFormatNames, ImportEnumTextFormatValues, 3);
+}
+void ImportEnumWriteJSON(PBJSONWriter* writer, const char* name, ImportEnum value) {
+  PBJSONWriteEnum(writer, name, value, ImportEnumTextFormatNames, ImportEnumTextFormatValues, 3);
+}
+ImportEnum ImportEnumReadJSON(PBJSONReader* reader) {
+  return (ImportEnum)PBJSONReaderReadEnum(reader, ImportEnumTextFormatNames, ImportEnumTextFormatValues, 3);
 }
 @interface ImportMessage ()
-@property int32_t d;
+@property (nonatomic, readwrite) BOOL hasD;
+@property (nonatomic, readwrite) int32_t d;
 @end
 
 @implementation ImportMessage
 
-- (BOOL) hasD {
-  return !!hasD_;
-}
-- (void) setHasD:(BOOL) value {
-  hasD_ = !!value;
-}
-@synthesize d;
-
 - (id) init {
   if ((self = [super init])) {
     self.d = 0;
   }
   return self;
 }
-static ImportMessage* defaultImportMessageInstance = nil;
-+ (void) initialize {
-  if (self == [ImportMessage class]) {
-    defaultImportMessageInstance = [[ImportMessage alloc] init];
-  }
-}
 + (ImportMessage*) defaultInstance {
+  static ImportMessage* defaultImportMessageInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultImportMessageInstance = [[ImportMessage alloc] init];
+  });
   return defaultImportMessageInstance;
 }
 - (ImportMessage*) defaultInstance {
-  return defaultImportMessageInstance;
+  return [ImportMessage defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -71,39 +76,21 @@ static ImportMessage* defaultImportMessageInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasD) {
-    size += computeInt32Size(1, self.d);
+    size_ += computeInt32Size(1, self.d);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (ImportMessage*) parseFromData:(NSData*) data {
-  return (ImportMessage*)[[[ImportMessage builder] mergeFromData:data] build];
-}
-+ (ImportMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ImportMessage*)[[[ImportMessage builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (ImportMessage*) parseFromInputStream:(NSInputStream*) input {
-  return (ImportMessage*)[[[ImportMessage builder] mergeFromInputStream:input] build];
-}
-+ (ImportMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ImportMessage*)[[[ImportMessage builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (ImportMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (ImportMessage*)[[[ImportMessage builder] mergeFromCodedInputStream:input] build];
-}
-+ (ImportMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ImportMessage*)[[[ImportMessage builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (ImportMessage_Builder*) builder {
-  return [[ImportMessage_Builder alloc] init] ;
+  return [[ImportMessage_Builder alloc] init];
 }
 + (ImportMessage_Builder*) builderWithPrototype:(ImportMessage*) prototype {
   return [[ImportMessage builder] mergeFrom:prototype];
@@ -114,11 +101,11 @@ static ImportMessage* defaultImportMessageInstance = nil;
 - (ImportMessage_Builder*) toBuilder {
   return [ImportMessage builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasD) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"d", [NSNumber numberWithInt:self.d]];
+    PBTextFormatWriteInt32(writer, "d", self.d);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -131,41 +118,37 @@ static ImportMessage* defaultImportMessageInstance = nil;
   return
       self.hasD == otherMessage.hasD &&
       (!self.hasD || self.d == otherMessage.d) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasD) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.d] hash];
+    hashCode = hashCode * 31 + [@(self.d) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasD) {
+    PBJSONWriteInt32(writer, "d", self.d);
+  }
+}
 @end
 
 @interface ImportMessage_Builder()
-@property (strong) ImportMessage* result;
+@property (strong) ImportMessage* builder_result;
 @end
 
 @implementation ImportMessage_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[ImportMessage alloc] init] ;
+    self.builder_result = [[ImportMessage alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (ImportMessage_Builder*) clear {
-  self.result = [[ImportMessage alloc] init] ;
-  return self;
-}
-- (ImportMessage_Builder*) clone {
-  return [ImportMessage builderWithPrototype:result];
+  return builder_result;
 }
 - (ImportMessage*) defaultInstance {
   return [ImportMessage defaultInstance];
@@ -175,8 +158,8 @@ static ImportMessage* defaultImportMessageInstance = nil;
   return [self buildPartial];
 }
 - (ImportMessage*) buildPartial {
-  ImportMessage* returnMe = result;
-  self.result = nil;
+  ImportMessage* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (ImportMessage_Builder*) mergeFrom:(ImportMessage*) other {
@@ -189,9 +172,6 @@ static ImportMessage* defaultImportMessageInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (ImportMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (ImportMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -214,21 +194,63 @@ static ImportMessage* defaultImportMessageInstance = nil;
     }
   }
 }
-- (BOOL) hasD {
-  return result.hasD;
+- (ImportMessage_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 1:
+        if (memcmp(name, "d", 1) == 0) {
+          [self setD:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) d {
-  return result.d;
+- (ImportMessage_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 1:
+        if (memcmp(name, "d", 1) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setD:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (ImportMessage_Builder*) setD:(int32_t) value {
-  result.hasD = YES;
-  result.d = value;
+  builder_result.hasD = YES;
+  builder_result.d = value;
   return self;
 }
-- (ImportMessage_Builder*) clearD {
-  result.hasD = NO;
-  result.d = 0;
+- (int32_t) d {
+  return builder_result.d;
+}
+- (BOOL)hasD {
+ return builder_result.hasD;
+}
+- (ImportMessage_Builder*)clearD {
+  builder_result.hasD = NO;
+  builder_result.d = 0;
   return self;
 }
 @end
 
+#pragma clang diagnostic pop
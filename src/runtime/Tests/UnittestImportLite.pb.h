@@ -16,13 +16,16 @@
   #endif
 #endif
 
-typedef enum {
+typedef NS_CLOSED_ENUM(int32_t, ImportEnumLite) {
   ImportEnumLiteImportLiteFoo = 7,
   ImportEnumLiteImportLiteBar = 8,
   ImportEnumLiteImportLiteBaz = 9,
-} ImportEnumLite;
+};
 
 BOOL ImportEnumLiteIsValidValue(ImportEnumLite value);
+ImportEnumLite ImportEnumLiteReadTextFormat(PBTextFormatReader* reader);
+void ImportEnumLiteWriteJSON(PBJSONWriter* writer, const char* name, ImportEnumLite value);
+ImportEnumLite ImportEnumLiteReadJSON(PBJSONReader* reader);
 
 
 @interface UnittestImportLiteRoot : NSObject {
@@ -31,52 +34,30 @@ BOOL ImportEnumLiteIsValidValue(ImportEnumLite value);
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry;
 @end
 
-@interface ImportMessageLite : PBGeneratedMessage {
-@private
-  BOOL hasD_:1;
-  int32_t d;
-}
-- (BOOL) hasD;
-@property (readonly) int32_t d;
+@interface ImportMessageLite : PBGeneratedMessage
+- (BOOL)hasD;
+@property (nonatomic, readonly) int32_t d;
 
 + (ImportMessageLite*) defaultInstance;
 - (ImportMessageLite*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (ImportMessageLite_Builder*) builder;
 + (ImportMessageLite_Builder*) builder;
 + (ImportMessageLite_Builder*) builderWithPrototype:(ImportMessageLite*) prototype;
 - (ImportMessageLite_Builder*) toBuilder;
-
-+ (ImportMessageLite*) parseFromData:(NSData*) data;
-+ (ImportMessageLite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ImportMessageLite*) parseFromInputStream:(NSInputStream*) input;
-+ (ImportMessageLite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (ImportMessageLite*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (ImportMessageLite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface ImportMessageLite_Builder : PBGeneratedMessage_Builder {
-@private
-  ImportMessageLite* result;
-}
-
+@interface ImportMessageLite_Builder : PBGeneratedMessage_Builder
 - (ImportMessageLite*) defaultInstance;
 
-- (ImportMessageLite_Builder*) clear;
-- (ImportMessageLite_Builder*) clone;
-
 - (ImportMessageLite*) build;
 - (ImportMessageLite*) buildPartial;
 
 - (ImportMessageLite_Builder*) mergeFrom:(ImportMessageLite*) other;
-- (ImportMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (ImportMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasD;
 - (int32_t) d;
+- (BOOL)hasD;
+- (ImportMessageLite_Builder*)clearD;
 - (ImportMessageLite_Builder*) setD:(int32_t) value;
-- (ImportMessageLite_Builder*) clearD;
 @end
 
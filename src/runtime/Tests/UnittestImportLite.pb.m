@@ -2,64 +2,69 @@
 
 #import "UnittestImportLite.pb.h"
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wshadow-ivar"
+
 @implementation UnittestImportLiteRoot
-static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
-  return extensionRegistry;
-}
-
-+ (void) initialize {
-  if (self == [UnittestImportLiteRoot class]) {
+  static PBExtensionRegistry* extensionRegistry = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
     PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
+    [UnittestImportLiteRoot registerAllExtensions:registry];
     extensionRegistry = registry;
-  }
+  });
+  return extensionRegistry;
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
 }
 @end
 
 BOOL ImportEnumLiteIsValidValue(ImportEnumLite value) {
-  switch (value) {
-    case ImportEnumLiteImportLiteFoo:
-    case ImportEnumLiteImportLiteBar:
-    case ImportEnumLiteImportLiteBaz:
-      return YES;
-    default:
-      return NO;
-  }
+  return (uint32_t)value - 7U < 3U;
+}
+static const char* const ImportEnumLiteTextFormatNames[] = {
+  "IMPORT_LITE_FOO",
+  "IMPORT_LITE_BAR",
+  "IMPORT_LITE_BAZ",
+};
+static const int32_t ImportEnumLiteTextFormatValues[] = {
+  7,
+  8,
+  9,
+};
+ImportEnumLite ImportEnumLiteReadTextFormat(PBTextFormatReader* reader) {
+  return (ImportEnumLite)PBTextFormatReaderReadEnum(reader, ImportEnumLiteTextFormatNames, ImportEnumLiteTextFormatValues, 3);
+}
+void ImportEnumLiteWriteJSON(PBJSONWriter* writer, const char* name, ImportEnumLite value) {
+  PBJSONWriteEnum(writer, name, value, ImportEnumLiteTextFormatNames, ImportEnumLiteTextFormatValues, 3);
+}
+ImportEnumLite ImportEnumLiteReadJSON(PBJSONReader* reader) {
+  return (ImportEnumLite)PBJSONReaderReadEnum(reader, ImportEnumLiteTextFormatNames, ImportEnumLiteTextFormatValues, 3);
 }
 @interface ImportMessageLite ()
-@property int32_t d;
+@property (nonatomic, readwrite) BOOL hasD;
+@property (nonatomic, readwrite) int32_t d;
 @end
 
 @implementation ImportMessageLite
 
-- (BOOL) hasD {
-  return !!hasD_;
-}
-- (void) setHasD:(BOOL) value {
-  hasD_ = !!value;
-}
-@synthesize d;
-
 - (id) init {
   if ((self = [super init])) {
     self.d = 0;
   }
   return self;
 }
-static ImportMessageLite* defaultImportMessageLiteInstance = nil;
-+ (void) initialize {
-  if (self == [ImportMessageLite class]) {
-    defaultImportMessageLiteInstance = [[ImportMessageLite alloc] init];
-  }
-}
 + (ImportMessageLite*) defaultInstance {
+  static ImportMessageLite* defaultImportMessageLiteInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultImportMessageLiteInstance = [[ImportMessageLite alloc] init];
+  });
   return defaultImportMessageLiteInstance;
 }
 - (ImportMessageLite*) defaultInstance {
-  return defaultImportMessageLiteInstance;
+  return [ImportMessageLite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -71,39 +76,21 @@ static ImportMessageLite* defaultImportMessageLiteInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasD) {
-    size += computeInt32Size(1, self.d);
+    size_ += computeInt32Size(1, self.d);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (ImportMessageLite*) parseFromData:(NSData*) data {
-  return (ImportMessageLite*)[[[ImportMessageLite builder] mergeFromData:data] build];
-}
-+ (ImportMessageLite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ImportMessageLite*)[[[ImportMessageLite builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (ImportMessageLite*) parseFromInputStream:(NSInputStream*) input {
-  return (ImportMessageLite*)[[[ImportMessageLite builder] mergeFromInputStream:input] build];
-}
-+ (ImportMessageLite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ImportMessageLite*)[[[ImportMessageLite builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (ImportMessageLite*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (ImportMessageLite*)[[[ImportMessageLite builder] mergeFromCodedInputStream:input] build];
-}
-+ (ImportMessageLite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ImportMessageLite*)[[[ImportMessageLite builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (ImportMessageLite_Builder*) builder {
-  return [[ImportMessageLite_Builder alloc] init] ;
+  return [[ImportMessageLite_Builder alloc] init];
 }
 + (ImportMessageLite_Builder*) builderWithPrototype:(ImportMessageLite*) prototype {
   return [[ImportMessageLite builder] mergeFrom:prototype];
@@ -114,11 +101,11 @@ static ImportMessageLite* defaultImportMessageLiteInstance = nil;
 - (ImportMessageLite_Builder*) toBuilder {
   return [ImportMessageLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasD) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"d", [NSNumber numberWithInt:self.d]];
+    PBTextFormatWriteInt32(writer, "d", self.d);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -131,41 +118,37 @@ static ImportMessageLite* defaultImportMessageLiteInstance = nil;
   return
       self.hasD == otherMessage.hasD &&
       (!self.hasD || self.d == otherMessage.d) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasD) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.d] hash];
+    hashCode = hashCode * 31 + [@(self.d) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasD) {
+    PBJSONWriteInt32(writer, "d", self.d);
+  }
+}
 @end
 
 @interface ImportMessageLite_Builder()
-@property (strong) ImportMessageLite* result;
+@property (strong) ImportMessageLite* builder_result;
 @end
 
 @implementation ImportMessageLite_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[ImportMessageLite alloc] init] ;
+    self.builder_result = [[ImportMessageLite alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (ImportMessageLite_Builder*) clear {
-  self.result = [[ImportMessageLite alloc] init] ;
-  return self;
-}
-- (ImportMessageLite_Builder*) clone {
-  return [ImportMessageLite builderWithPrototype:result];
+  return builder_result;
 }
 - (ImportMessageLite*) defaultInstance {
   return [ImportMessageLite defaultInstance];
@@ -175,8 +158,8 @@ static ImportMessageLite* defaultImportMessageLiteInstance = nil;
   return [self buildPartial];
 }
 - (ImportMessageLite*) buildPartial {
-  ImportMessageLite* returnMe = result;
-  self.result = nil;
+  ImportMessageLite* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (ImportMessageLite_Builder*) mergeFrom:(ImportMessageLite*) other {
@@ -189,9 +172,6 @@ static ImportMessageLite* defaultImportMessageLiteInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (ImportMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (ImportMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -214,21 +194,63 @@ static ImportMessageLite* defaultImportMessageLiteInstance = nil;
     }
   }
 }
-- (BOOL) hasD {
-  return result.hasD;
+- (ImportMessageLite_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 1:
+        if (memcmp(name, "d", 1) == 0) {
+          [self setD:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) d {
-  return result.d;
+- (ImportMessageLite_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 1:
+        if (memcmp(name, "d", 1) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setD:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (ImportMessageLite_Builder*) setD:(int32_t) value {
-  result.hasD = YES;
-  result.d = value;
+  builder_result.hasD = YES;
+  builder_result.d = value;
   return self;
 }
-- (ImportMessageLite_Builder*) clearD {
-  result.hasD = NO;
-  result.d = 0;
+- (int32_t) d {
+  return builder_result.d;
+}
+- (BOOL)hasD {
+ return builder_result.hasD;
+}
+- (ImportMessageLite_Builder*)clearD {
+  builder_result.hasD = NO;
+  builder_result.d = 0;
   return self;
 }
 @end
 
+#pragma clang diagnostic pop
@@ -2,6 +2,9 @@
 
 #import "UnittestLite.pb.h"
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wshadow-ivar"
+
 @implementation UnittestLiteRoot
 static id<PBExtensionField> UnittestLiteRoot_optionalInt32ExtensionLite = nil;
 static id<PBExtensionField> UnittestLiteRoot_optionalInt64ExtensionLite = nil;
@@ -86,8 +89,15 @@ static id<PBExtensionField> UnittestLiteRoot_packedDoubleExtensionLite = nil;
 static id<PBExtensionField> UnittestLiteRoot_packedBoolExtensionLite = nil;
 static id<PBExtensionField> UnittestLiteRoot_packedEnumExtensionLite = nil;
 static id<PBExtensionField> TestNestedExtensionLite_nestedExtension = nil;
-static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static PBExtensionRegistry* extensionRegistry = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestLiteRoot registerAllExtensions:registry];
+    [UnittestImportLiteRoot registerAllExtensions:registry];
+    extensionRegistry = registry;
+  });
   return extensionRegistry;
 }
 
@@ -97,7 +107,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt32
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:1
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -106,7 +116,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt64
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:2
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -115,7 +125,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeUInt32
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:3
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -124,7 +134,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeUInt64
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:4
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -133,7 +143,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSInt32
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:5
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -142,7 +152,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSInt64
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:6
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -151,7 +161,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeFixed32
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:7
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -160,7 +170,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeFixed64
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:8
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -169,7 +179,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSFixed32
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:9
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -178,7 +188,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSFixed64
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:10
-                                      defaultValue:[NSNumber numberWithLongLong:0L]
+                                      defaultValue:@(0L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -187,7 +197,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeFloat
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:11
-                                      defaultValue:[NSNumber numberWithFloat:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -196,7 +206,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeDouble
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:12
-                                      defaultValue:[NSNumber numberWithDouble:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -205,7 +215,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeBool
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:13
-                                      defaultValue:[NSNumber numberWithBool:NO]
+                                      defaultValue:@(NO)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -268,7 +278,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:21
-                                      defaultValue:[NSNumber numberWithInt:TestAllTypesLite_NestedEnumFoo]
+                                      defaultValue:@(TestAllTypesLite_NestedEnumFoo)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -277,7 +287,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:22
-                                      defaultValue:[NSNumber numberWithInt:ForeignEnumLiteForeignLiteFoo]
+                                      defaultValue:@(ForeignEnumLiteForeignLiteFoo)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -286,7 +296,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:23
-                                      defaultValue:[NSNumber numberWithInt:ImportEnumLiteImportLiteFoo]
+                                      defaultValue:@(ImportEnumLiteImportLiteFoo)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -430,7 +440,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeString
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:44
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[NSString class]
                                         isRepeated:YES
                                           isPacked:NO
@@ -439,7 +449,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeBytes
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:45
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[NSData class]
                                         isRepeated:YES
                                           isPacked:NO
@@ -448,7 +458,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeGroup
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:46
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[RepeatedGroup_extension_lite class]
                                         isRepeated:YES
                                           isPacked:NO
@@ -457,7 +467,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeMessage
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:48
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[TestAllTypesLite_NestedMessage class]
                                         isRepeated:YES
                                           isPacked:NO
@@ -466,7 +476,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeMessage
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:49
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[ForeignMessageLite class]
                                         isRepeated:YES
                                           isPacked:NO
@@ -475,7 +485,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeMessage
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:50
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[ImportMessageLite class]
                                         isRepeated:YES
                                           isPacked:NO
@@ -484,7 +494,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:51
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:YES
                                           isPacked:NO
@@ -493,7 +503,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:52
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:YES
                                           isPacked:NO
@@ -502,7 +512,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:53
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:YES
                                           isPacked:NO
@@ -511,7 +521,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeString
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:54
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[NSString class]
                                         isRepeated:YES
                                           isPacked:NO
@@ -520,7 +530,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeString
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:55
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[NSString class]
                                         isRepeated:YES
                                           isPacked:NO
@@ -529,7 +539,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt32
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:61
-                                      defaultValue:[NSNumber numberWithInt:41]
+                                      defaultValue:@(41)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -538,7 +548,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt64
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:62
-                                      defaultValue:[NSNumber numberWithLongLong:42L]
+                                      defaultValue:@(42L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -547,7 +557,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeUInt32
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:63
-                                      defaultValue:[NSNumber numberWithInt:43]
+                                      defaultValue:@(43)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -556,7 +566,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeUInt64
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:64
-                                      defaultValue:[NSNumber numberWithLongLong:44L]
+                                      defaultValue:@(44L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -565,7 +575,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSInt32
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:65
-                                      defaultValue:[NSNumber numberWithInt:-45]
+                                      defaultValue:@(-45)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -574,7 +584,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSInt64
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:66
-                                      defaultValue:[NSNumber numberWithLongLong:46L]
+                                      defaultValue:@(46L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -583,7 +593,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeFixed32
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:67
-                                      defaultValue:[NSNumber numberWithInt:47]
+                                      defaultValue:@(47)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -592,7 +602,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeFixed64
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:68
-                                      defaultValue:[NSNumber numberWithLongLong:48L]
+                                      defaultValue:@(48L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -601,7 +611,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSFixed32
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:69
-                                      defaultValue:[NSNumber numberWithInt:49]
+                                      defaultValue:@(49)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -610,7 +620,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeSFixed64
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:70
-                                      defaultValue:[NSNumber numberWithLongLong:-50L]
+                                      defaultValue:@(-50L)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -619,7 +629,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeFloat
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:71
-                                      defaultValue:[NSNumber numberWithFloat:51.5]
+                                      defaultValue:@(51.5)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -628,7 +638,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeDouble
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:72
-                                      defaultValue:[NSNumber numberWithDouble:52000]
+                                      defaultValue:@(52000)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -637,7 +647,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeBool
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:73
-                                      defaultValue:[NSNumber numberWithBool:YES]
+                                      defaultValue:@(YES)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -664,7 +674,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:81
-                                      defaultValue:[NSNumber numberWithInt:TestAllTypesLite_NestedEnumBar]
+                                      defaultValue:@(TestAllTypesLite_NestedEnumBar)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -673,7 +683,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:82
-                                      defaultValue:[NSNumber numberWithInt:ForeignEnumLiteForeignLiteBar]
+                                      defaultValue:@(ForeignEnumLiteForeignLiteBar)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -682,7 +692,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:83
-                                      defaultValue:[NSNumber numberWithInt:ImportEnumLiteImportLiteBar]
+                                      defaultValue:@(ImportEnumLiteImportLiteBar)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
@@ -826,7 +836,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeEnum
                                      extendedClass:[TestPackedExtensionsLite class]
                                        fieldNumber:103
-                                      defaultValue:[[NSArray alloc ]init]
+                                      defaultValue:[[NSArray alloc] init]
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:YES
                                           isPacked:YES
@@ -835,15 +845,11 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt32
                                      extendedClass:[TestAllExtensionsLite class]
                                        fieldNumber:12345
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
                             isMessageSetWireFormat:NO];
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    [UnittestImportLiteRoot registerAllExtensions:registry];
-    extensionRegistry = registry;
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -1180,40 +1186,76 @@ static PBExtensionRegistry* extensionRegistry = nil;
 @end
 
 BOOL ForeignEnumLiteIsValidValue(ForeignEnumLite value) {
-  switch (value) {
-    case ForeignEnumLiteForeignLiteFoo:
-    case ForeignEnumLiteForeignLiteBar:
-    case ForeignEnumLiteForeignLiteBaz:
-      return YES;
-    default:
-      return NO;
-  }
+  return (uint32_t)value - 4U < 3U;
+}
+static const char* const ForeignEnumLiteTextFormatNames[] = {
+  "FOREIGN_LITE_FOO",
+  "FOREIGN_LITE_BAR",
+  "FOREIGN_LITE_BAZ",
+};
+static const int32_t ForeignEnumLiteTextFormatValues[] = {
+  4,
+  5,
+  6,
+};
+ForeignEnumLite ForeignEnumLiteReadTextFormat(PBTextFormatReader* reader) {
+  return (ForeignEnumLite)PBTextFormatReaderReadEnum(reader, ForeignEnumLiteTextFormatNames, ForeignEnumLiteTextFormatValues, 3);
+}
+void ForeignEnumLiteWriteJSON(PBJSONWriter* writer, const char* name, ForeignEnumLite value) {
+  PBJSONWriteEnum(writer, name, value, ForeignEnumLiteTextFormatNames, ForeignEnumLiteTextFormatValues, 3);
+}
+ForeignEnumLite ForeignEnumLiteReadJSON(PBJSONReader* reader) {
+  return (ForeignEnumLite)PBJSONReaderReadEnum(reader, ForeignEnumLiteTextFormatNames, ForeignEnumLiteTextFormatValues, 3);
 }
 @interface TestAllTypesLite ()
-@property int32_t optionalInt32;
-@property int64_t optionalInt64;
-@property uint32_t optionalUint32;
-@property uint64_t optionalUint64;
-@property int32_t optionalSint32;
-@property int64_t optionalSint64;
-@property uint32_t optionalFixed32;
-@property uint64_t optionalFixed64;
-@property int32_t optionalSfixed32;
-@property int64_t optionalSfixed64;
-@property Float32 optionalFloat;
-@property Float64 optionalDouble;
-@property BOOL optionalBool;
-@property (strong) NSString* optionalString;
-@property (strong) NSData* optionalBytes;
-@property (strong) TestAllTypesLite_OptionalGroup* optionalGroup;
-@property (strong) TestAllTypesLite_NestedMessage* optionalNestedMessage;
-@property (strong) ForeignMessageLite* optionalForeignMessage;
-@property (strong) ImportMessageLite* optionalImportMessage;
-@property TestAllTypesLite_NestedEnum optionalNestedEnum;
-@property ForeignEnumLite optionalForeignEnum;
-@property ImportEnumLite optionalImportEnum;
-@property (strong) NSString* optionalStringPiece;
-@property (strong) NSString* optionalCord;
+@property (nonatomic, readwrite) BOOL hasOptionalInt32;
+@property (nonatomic, readwrite) int32_t optionalInt32;
+@property (nonatomic, readwrite) BOOL hasOptionalInt64;
+@property (nonatomic, readwrite) int64_t optionalInt64;
+@property (nonatomic, readwrite) BOOL hasOptionalUint32;
+@property (nonatomic, readwrite) uint32_t optionalUint32;
+@property (nonatomic, readwrite) BOOL hasOptionalUint64;
+@property (nonatomic, readwrite) uint64_t optionalUint64;
+@property (nonatomic, readwrite) BOOL hasOptionalSint32;
+@property (nonatomic, readwrite) int32_t optionalSint32;
+@property (nonatomic, readwrite) BOOL hasOptionalSint64;
+@property (nonatomic, readwrite) int64_t optionalSint64;
+@property (nonatomic, readwrite) BOOL hasOptionalFixed32;
+@property (nonatomic, readwrite) uint32_t optionalFixed32;
+@property (nonatomic, readwrite) BOOL hasOptionalFixed64;
+@property (nonatomic, readwrite) uint64_t optionalFixed64;
+@property (nonatomic, readwrite) BOOL hasOptionalSfixed32;
+@property (nonatomic, readwrite) int32_t optionalSfixed32;
+@property (nonatomic, readwrite) BOOL hasOptionalSfixed64;
+@property (nonatomic, readwrite) int64_t optionalSfixed64;
+@property (nonatomic, readwrite) BOOL hasOptionalFloat;
+@property (nonatomic, readwrite) Float32 optionalFloat;
+@property (nonatomic, readwrite) BOOL hasOptionalDouble;
+@property (nonatomic, readwrite) Float64 optionalDouble;
+@property (nonatomic, readwrite) BOOL hasOptionalBool;
+@property (nonatomic, readwrite) BOOL optionalBool;
+@property (nonatomic, readwrite) BOOL hasOptionalString;
+@property (nonatomic, readwrite) NSString* optionalString;
+@property (nonatomic, readwrite) BOOL hasOptionalBytes;
+@property (nonatomic, readwrite) NSData* optionalBytes;
+@property (nonatomic, readwrite) BOOL hasOptionalGroup;
+@property (nonatomic, readwrite) TestAllTypesLite_OptionalGroup* optionalGroup;
+@property (nonatomic, readwrite) BOOL hasOptionalNestedMessage;
+@property (nonatomic, readwrite) TestAllTypesLite_NestedMessage* optionalNestedMessage;
+@property (nonatomic, readwrite) BOOL hasOptionalForeignMessage;
+@property (nonatomic, readwrite) ForeignMessageLite* optionalForeignMessage;
+@property (nonatomic, readwrite) BOOL hasOptionalImportMessage;
+@property (nonatomic, readwrite) ImportMessageLite* optionalImportMessage;
+@property (nonatomic, readwrite) BOOL hasOptionalNestedEnum;
+@property (nonatomic, readwrite) TestAllTypesLite_NestedEnum optionalNestedEnum;
+@property (nonatomic, readwrite) BOOL hasOptionalForeignEnum;
+@property (nonatomic, readwrite) ForeignEnumLite optionalForeignEnum;
+@property (nonatomic, readwrite) BOOL hasOptionalImportEnum;
+@property (nonatomic, readwrite) ImportEnumLite optionalImportEnum;
+@property (nonatomic, readwrite) BOOL hasOptionalStringPiece;
+@property (nonatomic, readwrite) NSString* optionalStringPiece;
+@property (nonatomic, readwrite) BOOL hasOptionalCord;
+@property (nonatomic, readwrite) NSString* optionalCord;
 @property (strong) PBAppendableArray * repeatedInt32Array;
 @property (strong) PBAppendableArray * repeatedInt64Array;
 @property (strong) PBAppendableArray * repeatedUint32Array;
@@ -1229,406 +1271,59 @@ BOOL ForeignEnumLiteIsValidValue(ForeignEnumLite value) {
 @property (strong) PBAppendableArray * repeatedBoolArray;
 @property (strong) NSMutableArray * repeatedStringArray;
 @property (strong) NSMutableArray * repeatedBytesArray;
-@property (strong) NSMutableArray * repeatedGroupArray;
-@property (strong) NSMutableArray * repeatedNestedMessageArray;
-@property (strong) NSMutableArray * repeatedForeignMessageArray;
-@property (strong) NSMutableArray * repeatedImportMessageArray;
-@property (strong) PBAppendableArray * repeatedNestedEnumArray;
-@property (strong) PBAppendableArray * repeatedForeignEnumArray;
-@property (strong) PBAppendableArray * repeatedImportEnumArray;
+@property (nonatomic, readwrite) NSMutableArray * repeatedGroupArray;
+@property (nonatomic, readwrite) NSMutableArray * repeatedNestedMessageArray;
+@property (nonatomic, readwrite) NSMutableArray * repeatedForeignMessageArray;
+@property (nonatomic, readwrite) NSMutableArray * repeatedImportMessageArray;
+@property (nonatomic, readwrite) PBAppendableArray * repeatedNestedEnumArray;
+@property (nonatomic, readwrite) PBAppendableArray * repeatedForeignEnumArray;
+@property (nonatomic, readwrite) PBAppendableArray * repeatedImportEnumArray;
 @property (strong) NSMutableArray * repeatedStringPieceArray;
 @property (strong) NSMutableArray * repeatedCordArray;
-@property int32_t defaultInt32;
-@property int64_t defaultInt64;
-@property uint32_t defaultUint32;
-@property uint64_t defaultUint64;
-@property int32_t defaultSint32;
-@property int64_t defaultSint64;
-@property uint32_t defaultFixed32;
-@property uint64_t defaultFixed64;
-@property int32_t defaultSfixed32;
-@property int64_t defaultSfixed64;
-@property Float32 defaultFloat;
-@property Float64 defaultDouble;
-@property BOOL defaultBool;
-@property (strong) NSString* defaultString;
-@property (strong) NSData* defaultBytes;
-@property TestAllTypesLite_NestedEnum defaultNestedEnum;
-@property ForeignEnumLite defaultForeignEnum;
-@property ImportEnumLite defaultImportEnum;
-@property (strong) NSString* defaultStringPiece;
-@property (strong) NSString* defaultCord;
+@property (nonatomic, readwrite) BOOL hasDefaultInt32;
+@property (nonatomic, readwrite) int32_t defaultInt32;
+@property (nonatomic, readwrite) BOOL hasDefaultInt64;
+@property (nonatomic, readwrite) int64_t defaultInt64;
+@property (nonatomic, readwrite) BOOL hasDefaultUint32;
+@property (nonatomic, readwrite) uint32_t defaultUint32;
+@property (nonatomic, readwrite) BOOL hasDefaultUint64;
+@property (nonatomic, readwrite) uint64_t defaultUint64;
+@property (nonatomic, readwrite) BOOL hasDefaultSint32;
+@property (nonatomic, readwrite) int32_t defaultSint32;
+@property (nonatomic, readwrite) BOOL hasDefaultSint64;
+@property (nonatomic, readwrite) int64_t defaultSint64;
+@property (nonatomic, readwrite) BOOL hasDefaultFixed32;
+@property (nonatomic, readwrite) uint32_t defaultFixed32;
+@property (nonatomic, readwrite) BOOL hasDefaultFixed64;
+@property (nonatomic, readwrite) uint64_t defaultFixed64;
+@property (nonatomic, readwrite) BOOL hasDefaultSfixed32;
+@property (nonatomic, readwrite) int32_t defaultSfixed32;
+@property (nonatomic, readwrite) BOOL hasDefaultSfixed64;
+@property (nonatomic, readwrite) int64_t defaultSfixed64;
+@property (nonatomic, readwrite) BOOL hasDefaultFloat;
+@property (nonatomic, readwrite) Float32 defaultFloat;
+@property (nonatomic, readwrite) BOOL hasDefaultDouble;
+@property (nonatomic, readwrite) Float64 defaultDouble;
+@property (nonatomic, readwrite) BOOL hasDefaultBool;
+@property (nonatomic, readwrite) BOOL defaultBool;
+@property (nonatomic, readwrite) BOOL hasDefaultString;
+@property (nonatomic, readwrite) NSString* defaultString;
+@property (nonatomic, readwrite) BOOL hasDefaultBytes;
+@property (nonatomic, readwrite) NSData* defaultBytes;
+@property (nonatomic, readwrite) BOOL hasDefaultNestedEnum;
+@property (nonatomic, readwrite) TestAllTypesLite_NestedEnum defaultNestedEnum;
+@property (nonatomic, readwrite) BOOL hasDefaultForeignEnum;
+@property (nonatomic, readwrite) ForeignEnumLite defaultForeignEnum;
+@property (nonatomic, readwrite) BOOL hasDefaultImportEnum;
+@property (nonatomic, readwrite) ImportEnumLite defaultImportEnum;
+@property (nonatomic, readwrite) BOOL hasDefaultStringPiece;
+@property (nonatomic, readwrite) NSString* defaultStringPiece;
+@property (nonatomic, readwrite) BOOL hasDefaultCord;
+@property (nonatomic, readwrite) NSString* defaultCord;
 @end
 
 @implementation TestAllTypesLite
 
-- (BOOL) hasOptionalInt32 {
-  return !!hasOptionalInt32_;
-}
-- (void) setHasOptionalInt32:(BOOL) value {
-  hasOptionalInt32_ = !!value;
-}
-@synthesize optionalInt32;
-- (BOOL) hasOptionalInt64 {
-  return !!hasOptionalInt64_;
-}
-- (void) setHasOptionalInt64:(BOOL) value {
-  hasOptionalInt64_ = !!value;
-}
-@synthesize optionalInt64;
-- (BOOL) hasOptionalUint32 {
-  return !!hasOptionalUint32_;
-}
-- (void) setHasOptionalUint32:(BOOL) value {
-  hasOptionalUint32_ = !!value;
-}
-@synthesize optionalUint32;
-- (BOOL) hasOptionalUint64 {
-  return !!hasOptionalUint64_;
-}
-- (void) setHasOptionalUint64:(BOOL) value {
-  hasOptionalUint64_ = !!value;
-}
-@synthesize optionalUint64;
-- (BOOL) hasOptionalSint32 {
-  return !!hasOptionalSint32_;
-}
-- (void) setHasOptionalSint32:(BOOL) value {
-  hasOptionalSint32_ = !!value;
-}
-@synthesize optionalSint32;
-- (BOOL) hasOptionalSint64 {
-  return !!hasOptionalSint64_;
-}
-- (void) setHasOptionalSint64:(BOOL) value {
-  hasOptionalSint64_ = !!value;
-}
-@synthesize optionalSint64;
-- (BOOL) hasOptionalFixed32 {
-  return !!hasOptionalFixed32_;
-}
-- (void) setHasOptionalFixed32:(BOOL) value {
-  hasOptionalFixed32_ = !!value;
-}
-@synthesize optionalFixed32;
-- (BOOL) hasOptionalFixed64 {
-  return !!hasOptionalFixed64_;
-}
-- (void) setHasOptionalFixed64:(BOOL) value {
-  hasOptionalFixed64_ = !!value;
-}
-@synthesize optionalFixed64;
-- (BOOL) hasOptionalSfixed32 {
-  return !!hasOptionalSfixed32_;
-}
-- (void) setHasOptionalSfixed32:(BOOL) value {
-  hasOptionalSfixed32_ = !!value;
-}
-@synthesize optionalSfixed32;
-- (BOOL) hasOptionalSfixed64 {
-  return !!hasOptionalSfixed64_;
-}
-- (void) setHasOptionalSfixed64:(BOOL) value {
-  hasOptionalSfixed64_ = !!value;
-}
-@synthesize optionalSfixed64;
-- (BOOL) hasOptionalFloat {
-  return !!hasOptionalFloat_;
-}
-- (void) setHasOptionalFloat:(BOOL) value {
-  hasOptionalFloat_ = !!value;
-}
-@synthesize optionalFloat;
-- (BOOL) hasOptionalDouble {
-  return !!hasOptionalDouble_;
-}
-- (void) setHasOptionalDouble:(BOOL) value {
-  hasOptionalDouble_ = !!value;
-}
-@synthesize optionalDouble;
-- (BOOL) hasOptionalBool {
-  return !!hasOptionalBool_;
-}
-- (void) setHasOptionalBool:(BOOL) value {
-  hasOptionalBool_ = !!value;
-}
-- (BOOL) optionalBool {
-  return !!optionalBool_;
-}
-- (void) setOptionalBool:(BOOL) value {
-  optionalBool_ = !!value;
-}
-- (BOOL) hasOptionalString {
-  return !!hasOptionalString_;
-}
-- (void) setHasOptionalString:(BOOL) value {
-  hasOptionalString_ = !!value;
-}
-@synthesize optionalString;
-- (BOOL) hasOptionalBytes {
-  return !!hasOptionalBytes_;
-}
-- (void) setHasOptionalBytes:(BOOL) value {
-  hasOptionalBytes_ = !!value;
-}
-@synthesize optionalBytes;
-- (BOOL) hasOptionalGroup {
-  return !!hasOptionalGroup_;
-}
-- (void) setHasOptionalGroup:(BOOL) value {
-  hasOptionalGroup_ = !!value;
-}
-@synthesize optionalGroup;
-- (BOOL) hasOptionalNestedMessage {
-  return !!hasOptionalNestedMessage_;
-}
-- (void) setHasOptionalNestedMessage:(BOOL) value {
-  hasOptionalNestedMessage_ = !!value;
-}
-@synthesize optionalNestedMessage;
-- (BOOL) hasOptionalForeignMessage {
-  return !!hasOptionalForeignMessage_;
-}
-- (void) setHasOptionalForeignMessage:(BOOL) value {
-  hasOptionalForeignMessage_ = !!value;
-}
-@synthesize optionalForeignMessage;
-- (BOOL) hasOptionalImportMessage {
-  return !!hasOptionalImportMessage_;
-}
-- (void) setHasOptionalImportMessage:(BOOL) value {
-  hasOptionalImportMessage_ = !!value;
-}
-@synthesize optionalImportMessage;
-- (BOOL) hasOptionalNestedEnum {
-  return !!hasOptionalNestedEnum_;
-}
-- (void) setHasOptionalNestedEnum:(BOOL) value {
-  hasOptionalNestedEnum_ = !!value;
-}
-@synthesize optionalNestedEnum;
-- (BOOL) hasOptionalForeignEnum {
-  return !!hasOptionalForeignEnum_;
-}
-- (void) setHasOptionalForeignEnum:(BOOL) value {
-  hasOptionalForeignEnum_ = !!value;
-}
-@synthesize optionalForeignEnum;
-- (BOOL) hasOptionalImportEnum {
-  return !!hasOptionalImportEnum_;
-}
-- (void) setHasOptionalImportEnum:(BOOL) value {
-  hasOptionalImportEnum_ = !!value;
-}
-@synthesize optionalImportEnum;
-- (BOOL) hasOptionalStringPiece {
-  return !!hasOptionalStringPiece_;
-}
-- (void) setHasOptionalStringPiece:(BOOL) value {
-  hasOptionalStringPiece_ = !!value;
-}
-@synthesize optionalStringPiece;
-- (BOOL) hasOptionalCord {
-  return !!hasOptionalCord_;
-}
-- (void) setHasOptionalCord:(BOOL) value {
-  hasOptionalCord_ = !!value;
-}
-@synthesize optionalCord;
-@synthesize repeatedInt32Array;
-@dynamic repeatedInt32;
-@synthesize repeatedInt64Array;
-@dynamic repeatedInt64;
-@synthesize repeatedUint32Array;
-@dynamic repeatedUint32;
-@synthesize repeatedUint64Array;
-@dynamic repeatedUint64;
-@synthesize repeatedSint32Array;
-@dynamic repeatedSint32;
-@synthesize repeatedSint64Array;
-@dynamic repeatedSint64;
-@synthesize repeatedFixed32Array;
-@dynamic repeatedFixed32;
-@synthesize repeatedFixed64Array;
-@dynamic repeatedFixed64;
-@synthesize repeatedSfixed32Array;
-@dynamic repeatedSfixed32;
-@synthesize repeatedSfixed64Array;
-@dynamic repeatedSfixed64;
-@synthesize repeatedFloatArray;
-@dynamic repeatedFloat;
-@synthesize repeatedDoubleArray;
-@dynamic repeatedDouble;
-@synthesize repeatedBoolArray;
-@dynamic repeatedBool;
-@synthesize repeatedStringArray;
-@dynamic repeatedString;
-@synthesize repeatedBytesArray;
-@dynamic repeatedBytes;
-@synthesize repeatedGroupArray;
-@dynamic repeatedGroup;
-@synthesize repeatedNestedMessageArray;
-@dynamic repeatedNestedMessage;
-@synthesize repeatedForeignMessageArray;
-@dynamic repeatedForeignMessage;
-@synthesize repeatedImportMessageArray;
-@dynamic repeatedImportMessage;
-@synthesize repeatedNestedEnumArray;
-@dynamic repeatedNestedEnum;
-@synthesize repeatedForeignEnumArray;
-@dynamic repeatedForeignEnum;
-@synthesize repeatedImportEnumArray;
-@dynamic repeatedImportEnum;
-@synthesize repeatedStringPieceArray;
-@dynamic repeatedStringPiece;
-@synthesize repeatedCordArray;
-@dynamic repeatedCord;
-- (BOOL) hasDefaultInt32 {
-  return !!hasDefaultInt32_;
-}
-- (void) setHasDefaultInt32:(BOOL) value {
-  hasDefaultInt32_ = !!value;
-}
-@synthesize defaultInt32;
-- (BOOL) hasDefaultInt64 {
-  return !!hasDefaultInt64_;
-}
-- (void) setHasDefaultInt64:(BOOL) value {
-  hasDefaultInt64_ = !!value;
-}
-@synthesize defaultInt64;
-- (BOOL) hasDefaultUint32 {
-  return !!hasDefaultUint32_;
-}
-- (void) setHasDefaultUint32:(BOOL) value {
-  hasDefaultUint32_ = !!value;
-}
-@synthesize defaultUint32;
-- (BOOL) hasDefaultUint64 {
-  return !!hasDefaultUint64_;
-}
-- (void) setHasDefaultUint64:(BOOL) value {
-  hasDefaultUint64_ = !!value;
-}
-@synthesize defaultUint64;
-- (BOOL) hasDefaultSint32 {
-  return !!hasDefaultSint32_;
-}
-- (void) setHasDefaultSint32:(BOOL) value {
-  hasDefaultSint32_ = !!value;
-}
-@synthesize defaultSint32;
-- (BOOL) hasDefaultSint64 {
-  return !!hasDefaultSint64_;
-}
-- (void) setHasDefaultSint64:(BOOL) value {
-  hasDefaultSint64_ = !!value;
-}
-@synthesize defaultSint64;
-- (BOOL) hasDefaultFixed32 {
-  return !!hasDefaultFixed32_;
-}
-- (void) setHasDefaultFixed32:(BOOL) value {
-  hasDefaultFixed32_ = !!value;
-}
-@synthesize defaultFixed32;
-- (BOOL) hasDefaultFixed64 {
-  return !!hasDefaultFixed64_;
-}
-- (void) setHasDefaultFixed64:(BOOL) value {
-  hasDefaultFixed64_ = !!value;
-}
-@synthesize defaultFixed64;
-- (BOOL) hasDefaultSfixed32 {
-  return !!hasDefaultSfixed32_;
-}
-- (void) setHasDefaultSfixed32:(BOOL) value {
-  hasDefaultSfixed32_ = !!value;
-}
-@synthesize defaultSfixed32;
-- (BOOL) hasDefaultSfixed64 {
-  return !!hasDefaultSfixed64_;
-}
-- (void) setHasDefaultSfixed64:(BOOL) value {
-  hasDefaultSfixed64_ = !!value;
-}
-@synthesize defaultSfixed64;
-- (BOOL) hasDefaultFloat {
-  return !!hasDefaultFloat_;
-}
-- (void) setHasDefaultFloat:(BOOL) value {
-  hasDefaultFloat_ = !!value;
-}
-@synthesize defaultFloat;
-- (BOOL) hasDefaultDouble {
-  return !!hasDefaultDouble_;
-}
-- (void) setHasDefaultDouble:(BOOL) value {
-  hasDefaultDouble_ = !!value;
-}
-@synthesize defaultDouble;
-- (BOOL) hasDefaultBool {
-  return !!hasDefaultBool_;
-}
-- (void) setHasDefaultBool:(BOOL) value {
-  hasDefaultBool_ = !!value;
-}
-- (BOOL) defaultBool {
-  return !!defaultBool_;
-}
-- (void) setDefaultBool:(BOOL) value {
-  defaultBool_ = !!value;
-}
-- (BOOL) hasDefaultString {
-  return !!hasDefaultString_;
-}
-- (void) setHasDefaultString:(BOOL) value {
-  hasDefaultString_ = !!value;
-}
-@synthesize defaultString;
-- (BOOL) hasDefaultBytes {
-  return !!hasDefaultBytes_;
-}
-- (void) setHasDefaultBytes:(BOOL) value {
-  hasDefaultBytes_ = !!value;
-}
-@synthesize defaultBytes;
-- (BOOL) hasDefaultNestedEnum {
-  return !!hasDefaultNestedEnum_;
-}
-- (void) setHasDefaultNestedEnum:(BOOL) value {
-  hasDefaultNestedEnum_ = !!value;
-}
-@synthesize defaultNestedEnum;
-- (BOOL) hasDefaultForeignEnum {
-  return !!hasDefaultForeignEnum_;
-}
-- (void) setHasDefaultForeignEnum:(BOOL) value {
-  hasDefaultForeignEnum_ = !!value;
-}
-@synthesize defaultForeignEnum;
-- (BOOL) hasDefaultImportEnum {
-  return !!hasDefaultImportEnum_;
-}
-- (void) setHasDefaultImportEnum:(BOOL) value {
-  hasDefaultImportEnum_ = !!value;
-}
-@synthesize defaultImportEnum;
-- (BOOL) hasDefaultStringPiece {
-  return !!hasDefaultStringPiece_;
-}
-- (void) setHasDefaultStringPiece:(BOOL) value {
-  hasDefaultStringPiece_ = !!value;
-}
-@synthesize defaultStringPiece;
-- (BOOL) hasDefaultCord {
-  return !!hasDefaultCord_;
-}
-- (void) setHasDefaultCord:(BOOL) value {
-  hasDefaultCord_ = !!value;
-}
-@synthesize defaultCord;
-
 - (id) init {
   if ((self = [super init])) {
     self.optionalInt32 = 0;
@@ -1678,161 +1373,160 @@ BOOL ForeignEnumLiteIsValidValue(ForeignEnumLite value) {
   }
   return self;
 }
-static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestAllTypesLite class]) {
-    defaultTestAllTypesLiteInstance = [[TestAllTypesLite alloc] init];
-  }
-}
 + (TestAllTypesLite*) defaultInstance {
+  static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestAllTypesLiteInstance = [[TestAllTypesLite alloc] init];
+  });
   return defaultTestAllTypesLiteInstance;
 }
 - (TestAllTypesLite*) defaultInstance {
-  return defaultTestAllTypesLiteInstance;
+  return [TestAllTypesLite defaultInstance];
 }
 - (PBArray *)repeatedInt32 {
-  return repeatedInt32Array;
+  return self.repeatedInt32Array;
 }
 - (int32_t)repeatedInt32AtIndex:(NSUInteger)index {
-  return [repeatedInt32Array int32AtIndex:index];
+  return [self.repeatedInt32Array int32AtIndex:index];
 }
 - (PBArray *)repeatedInt64 {
-  return repeatedInt64Array;
+  return self.repeatedInt64Array;
 }
 - (int64_t)repeatedInt64AtIndex:(NSUInteger)index {
-  return [repeatedInt64Array int64AtIndex:index];
+  return [self.repeatedInt64Array int64AtIndex:index];
 }
 - (PBArray *)repeatedUint32 {
-  return repeatedUint32Array;
+  return self.repeatedUint32Array;
 }
 - (uint32_t)repeatedUint32AtIndex:(NSUInteger)index {
-  return [repeatedUint32Array uint32AtIndex:index];
+  return [self.repeatedUint32Array uint32AtIndex:index];
 }
 - (PBArray *)repeatedUint64 {
-  return repeatedUint64Array;
+  return self.repeatedUint64Array;
 }
 - (uint64_t)repeatedUint64AtIndex:(NSUInteger)index {
-  return [repeatedUint64Array uint64AtIndex:index];
+  return [self.repeatedUint64Array uint64AtIndex:index];
 }
 - (PBArray *)repeatedSint32 {
-  return repeatedSint32Array;
+  return self.repeatedSint32Array;
 }
 - (int32_t)repeatedSint32AtIndex:(NSUInteger)index {
-  return [repeatedSint32Array int32AtIndex:index];
+  return [self.repeatedSint32Array int32AtIndex:index];
 }
 - (PBArray *)repeatedSint64 {
-  return repeatedSint64Array;
+  return self.repeatedSint64Array;
 }
 - (int64_t)repeatedSint64AtIndex:(NSUInteger)index {
-  return [repeatedSint64Array int64AtIndex:index];
+  return [self.repeatedSint64Array int64AtIndex:index];
 }
 - (PBArray *)repeatedFixed32 {
-  return repeatedFixed32Array;
+  return self.repeatedFixed32Array;
 }
 - (uint32_t)repeatedFixed32AtIndex:(NSUInteger)index {
-  return [repeatedFixed32Array uint32AtIndex:index];
+  return [self.repeatedFixed32Array uint32AtIndex:index];
 }
 - (PBArray *)repeatedFixed64 {
-  return repeatedFixed64Array;
+  return self.repeatedFixed64Array;
 }
 - (uint64_t)repeatedFixed64AtIndex:(NSUInteger)index {
-  return [repeatedFixed64Array uint64AtIndex:index];
+  return [self.repeatedFixed64Array uint64AtIndex:index];
 }
 - (PBArray *)repeatedSfixed32 {
-  return repeatedSfixed32Array;
+  return self.repeatedSfixed32Array;
 }
 - (int32_t)repeatedSfixed32AtIndex:(NSUInteger)index {
-  return [repeatedSfixed32Array int32AtIndex:index];
+  return [self.repeatedSfixed32Array int32AtIndex:index];
 }
 - (PBArray *)repeatedSfixed64 {
-  return repeatedSfixed64Array;
+  return self.repeatedSfixed64Array;
 }
 - (int64_t)repeatedSfixed64AtIndex:(NSUInteger)index {
-  return [repeatedSfixed64Array int64AtIndex:index];
+  return [self.repeatedSfixed64Array int64AtIndex:index];
 }
 - (PBArray *)repeatedFloat {
-  return repeatedFloatArray;
+  return self.repeatedFloatArray;
 }
 - (Float32)repeatedFloatAtIndex:(NSUInteger)index {
-  return [repeatedFloatArray floatAtIndex:index];
+  return [self.repeatedFloatArray floatAtIndex:index];
 }
 - (PBArray *)repeatedDouble {
-  return repeatedDoubleArray;
+  return self.repeatedDoubleArray;
 }
 - (Float64)repeatedDoubleAtIndex:(NSUInteger)index {
-  return [repeatedDoubleArray doubleAtIndex:index];
+  return [self.repeatedDoubleArray doubleAtIndex:index];
 }
 - (PBArray *)repeatedBool {
-  return repeatedBoolArray;
+  return self.repeatedBoolArray;
 }
 - (BOOL)repeatedBoolAtIndex:(NSUInteger)index {
-  return [repeatedBoolArray boolAtIndex:index];
+  return [self.repeatedBoolArray boolAtIndex:index];
 }
-- (NSMutableArray *)repeatedString {
-  return repeatedStringArray;
+- (NSArray *)repeatedString {
+  return self.repeatedStringArray;
 }
 - (NSString*)repeatedStringAtIndex:(NSUInteger)index {
-  return [repeatedStringArray objectAtIndex:index];
+  return self.repeatedStringArray[index];
 }
 - (NSArray *)repeatedBytes {
-  return repeatedBytesArray;
+  return self.repeatedBytesArray;
 }
 - (NSData*)repeatedBytesAtIndex:(NSUInteger)index {
-  return [repeatedBytesArray objectAtIndex:index];
+  return self.repeatedBytesArray[index];
 }
 - (NSArray *)repeatedGroup {
-  return repeatedGroupArray;
+  return self.repeatedGroupArray;
 }
 - (TestAllTypesLite_RepeatedGroup*)repeatedGroupAtIndex:(NSUInteger)index {
-  return [repeatedGroupArray objectAtIndex:index];
+  return self.repeatedGroupArray[index];
 }
 - (NSArray *)repeatedNestedMessage {
-  return repeatedNestedMessageArray;
+  return self.repeatedNestedMessageArray;
 }
 - (TestAllTypesLite_NestedMessage*)repeatedNestedMessageAtIndex:(NSUInteger)index {
-  return [repeatedNestedMessageArray objectAtIndex:index];
+  return self.repeatedNestedMessageArray[index];
 }
 - (NSArray *)repeatedForeignMessage {
-  return repeatedForeignMessageArray;
+  return self.repeatedForeignMessageArray;
 }
 - (ForeignMessageLite*)repeatedForeignMessageAtIndex:(NSUInteger)index {
-  return [repeatedForeignMessageArray objectAtIndex:index];
+  return self.repeatedForeignMessageArray[index];
 }
 - (NSArray *)repeatedImportMessage {
-  return repeatedImportMessageArray;
+  return self.repeatedImportMessageArray;
 }
 - (ImportMessageLite*)repeatedImportMessageAtIndex:(NSUInteger)index {
-  return [repeatedImportMessageArray objectAtIndex:index];
+  return self.repeatedImportMessageArray[index];
 }
 - (PBArray *)repeatedNestedEnum {
-  return repeatedNestedEnumArray;
+  return self.repeatedNestedEnumArray;
 }
 - (TestAllTypesLite_NestedEnum)repeatedNestedEnumAtIndex:(NSUInteger)index {
-  return [repeatedNestedEnumArray int32AtIndex:index];
+  return (TestAllTypesLite_NestedEnum)[self.repeatedNestedEnumArray int32AtIndex:index];
 }
 - (PBArray *)repeatedForeignEnum {
-  return repeatedForeignEnumArray;
+  return self.repeatedForeignEnumArray;
 }
 - (ForeignEnumLite)repeatedForeignEnumAtIndex:(NSUInteger)index {
-  return [repeatedForeignEnumArray int32AtIndex:index];
+  return (ForeignEnumLite)[self.repeatedForeignEnumArray int32AtIndex:index];
 }
 - (PBArray *)repeatedImportEnum {
-  return repeatedImportEnumArray;
+  return self.repeatedImportEnumArray;
 }
 - (ImportEnumLite)repeatedImportEnumAtIndex:(NSUInteger)index {
-  return [repeatedImportEnumArray int32AtIndex:index];
+  return (ImportEnumLite)[self.repeatedImportEnumArray int32AtIndex:index];
 }
 - (NSArray *)repeatedStringPiece {
-  return repeatedStringPieceArray;
+  return self.repeatedStringPieceArray;
 }
 - (NSString*)repeatedStringPieceAtIndex:(NSUInteger)index {
-  return [repeatedStringPieceArray objectAtIndex:index];
+  return self.repeatedStringPieceArray[index];
 }
 - (NSArray *)repeatedCord {
-  return repeatedCordArray;
+  return self.repeatedCordArray;
 }
 - (NSString*)repeatedCordAtIndex:(NSUInteger)index {
-  return [repeatedCordArray objectAtIndex:index];
+  return self.repeatedCordArray[index];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -2001,19 +1695,11 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
       [output writeBool:43 value:values[i]];
     }
   }
-  const NSUInteger repeatedStringArrayCount = self.repeatedStringArray.count;
-  if (repeatedStringArrayCount > 0) {
-
-      
-      for(NSString *value in   self.repeatedStringArray){
-          [output writeString:44 value:value];
-      }
+  for (NSString *element in self.repeatedStringArray) {
+    [output writeString:44 value:element];
   }
-  const NSUInteger repeatedBytesArrayCount = self.repeatedBytesArray.count;
-  if (repeatedBytesArrayCount > 0) {      
-      for(NSData *value in   self.repeatedBytesArray){
-          [output writeData:45 value:value];
-      }
+  for (NSData *element in self.repeatedBytesArray) {
+    [output writeData:45 value:element];
   }
   for (TestAllTypesLite_RepeatedGroup *element in self.repeatedGroupArray) {
     [output writeGroup:46 value:element];
@@ -2042,21 +1728,11 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
   for (NSUInteger i = 0; i < repeatedImportEnumArrayCount; ++i) {
     [output writeEnum:53 value:repeatedImportEnumArrayValues[i]];
   }
-  const NSUInteger repeatedStringPieceArrayCount = self.repeatedStringPieceArray.count;
-  if (repeatedStringPieceArrayCount > 0) {
-
-    
-      for(NSString *value in   self.repeatedStringPieceArray){
-          [output writeString:54 value:value];
-      }
+  for (NSString *element in self.repeatedStringPieceArray) {
+    [output writeString:54 value:element];
   }
-  const NSUInteger repeatedCordArrayCount = self.repeatedCordArray.count;
-  if (repeatedCordArrayCount > 0) {
-
-      for(NSString *value in   self.repeatedCordArray){
-          [output writeString:55 value:value];
-      }
-
+  for (NSString *element in self.repeatedCordArray) {
+    [output writeString:55 value:element];
   }
   if (self.hasDefaultInt32) {
     [output writeInt32:61 value:self.defaultInt32];
@@ -2121,83 +1797,83 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasOptionalInt32) {
-    size += computeInt32Size(1, self.optionalInt32);
+    size_ += computeInt32Size(1, self.optionalInt32);
   }
   if (self.hasOptionalInt64) {
-    size += computeInt64Size(2, self.optionalInt64);
+    size_ += computeInt64Size(2, self.optionalInt64);
   }
   if (self.hasOptionalUint32) {
-    size += computeUInt32Size(3, self.optionalUint32);
+    size_ += computeUInt32Size(3, self.optionalUint32);
   }
   if (self.hasOptionalUint64) {
-    size += computeUInt64Size(4, self.optionalUint64);
+    size_ += computeUInt64Size(4, self.optionalUint64);
   }
   if (self.hasOptionalSint32) {
-    size += computeSInt32Size(5, self.optionalSint32);
+    size_ += computeSInt32Size(5, self.optionalSint32);
   }
   if (self.hasOptionalSint64) {
-    size += computeSInt64Size(6, self.optionalSint64);
+    size_ += computeSInt64Size(6, self.optionalSint64);
   }
   if (self.hasOptionalFixed32) {
-    size += computeFixed32Size(7, self.optionalFixed32);
+    size_ += computeFixed32Size(7, self.optionalFixed32);
   }
   if (self.hasOptionalFixed64) {
-    size += computeFixed64Size(8, self.optionalFixed64);
+    size_ += computeFixed64Size(8, self.optionalFixed64);
   }
   if (self.hasOptionalSfixed32) {
-    size += computeSFixed32Size(9, self.optionalSfixed32);
+    size_ += computeSFixed32Size(9, self.optionalSfixed32);
   }
   if (self.hasOptionalSfixed64) {
-    size += computeSFixed64Size(10, self.optionalSfixed64);
+    size_ += computeSFixed64Size(10, self.optionalSfixed64);
   }
   if (self.hasOptionalFloat) {
-    size += computeFloatSize(11, self.optionalFloat);
+    size_ += computeFloatSize(11, self.optionalFloat);
   }
   if (self.hasOptionalDouble) {
-    size += computeDoubleSize(12, self.optionalDouble);
+    size_ += computeDoubleSize(12, self.optionalDouble);
   }
   if (self.hasOptionalBool) {
-    size += computeBoolSize(13, self.optionalBool);
+    size_ += computeBoolSize(13, self.optionalBool);
   }
   if (self.hasOptionalString) {
-    size += computeStringSize(14, self.optionalString);
+    size_ += computeStringSize(14, self.optionalString);
   }
   if (self.hasOptionalBytes) {
-    size += computeDataSize(15, self.optionalBytes);
+    size_ += computeDataSize(15, self.optionalBytes);
   }
   if (self.hasOptionalGroup) {
-    size += computeGroupSize(16, self.optionalGroup);
+    size_ += computeGroupSize(16, self.optionalGroup);
   }
   if (self.hasOptionalNestedMessage) {
-    size += computeMessageSize(18, self.optionalNestedMessage);
+    size_ += computeMessageSize(18, self.optionalNestedMessage);
   }
   if (self.hasOptionalForeignMessage) {
-    size += computeMessageSize(19, self.optionalForeignMessage);
+    size_ += computeMessageSize(19, self.optionalForeignMessage);
   }
   if (self.hasOptionalImportMessage) {
-    size += computeMessageSize(20, self.optionalImportMessage);
+    size_ += computeMessageSize(20, self.optionalImportMessage);
   }
   if (self.hasOptionalNestedEnum) {
-    size += computeEnumSize(21, self.optionalNestedEnum);
+    size_ += computeEnumSize(21, self.optionalNestedEnum);
   }
   if (self.hasOptionalForeignEnum) {
-    size += computeEnumSize(22, self.optionalForeignEnum);
+    size_ += computeEnumSize(22, self.optionalForeignEnum);
   }
   if (self.hasOptionalImportEnum) {
-    size += computeEnumSize(23, self.optionalImportEnum);
+    size_ += computeEnumSize(23, self.optionalImportEnum);
   }
   if (self.hasOptionalStringPiece) {
-    size += computeStringSize(24, self.optionalStringPiece);
+    size_ += computeStringSize(24, self.optionalStringPiece);
   }
   if (self.hasOptionalCord) {
-    size += computeStringSize(25, self.optionalCord);
+    size_ += computeStringSize(25, self.optionalCord);
   }
   {
     int32_t dataSize = 0;
@@ -2206,8 +1882,8 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
@@ -2216,8 +1892,8 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
@@ -2226,8 +1902,8 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeUInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
@@ -2236,8 +1912,8 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeUInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
@@ -2246,8 +1922,8 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeSInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
@@ -2256,88 +1932,87 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeSInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
     const NSUInteger count = self.repeatedFixed32Array.count;
     dataSize = 4 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
     const NSUInteger count = self.repeatedFixed64Array.count;
     dataSize = 8 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
     const NSUInteger count = self.repeatedSfixed32Array.count;
     dataSize = 4 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
     const NSUInteger count = self.repeatedSfixed64Array.count;
     dataSize = 8 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
     const NSUInteger count = self.repeatedFloatArray.count;
     dataSize = 4 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
     const NSUInteger count = self.repeatedDoubleArray.count;
     dataSize = 8 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
     const NSUInteger count = self.repeatedBoolArray.count;
     dataSize = 1 * count;
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
-    const NSUInteger count = [self.repeatedStringArray count];
-   for(NSString *value in self.repeatedStringArray){
-          dataSize += computeStringSizeNoTag(value);
-      }
-    size += dataSize;
-    size += 2 * count;
+    const NSUInteger count = self.repeatedStringArray.count;
+    for (NSString *element in self.repeatedStringArray) {
+      dataSize += computeStringSizeNoTag(element);
+    }
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
     const NSUInteger count = self.repeatedBytesArray.count;
-      
-      for(NSData *value in self.repeatedBytesArray){
-          dataSize += computeDataSizeNoTag(value);
-      } 
-    size += dataSize;
-    size += 2 * count;
+    for (NSData *element in self.repeatedBytesArray) {
+      dataSize += computeDataSizeNoTag(element);
+    }
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   for (TestAllTypesLite_RepeatedGroup *element in self.repeatedGroupArray) {
-    size += computeGroupSize(46, element);
+    size_ += computeGroupSize(46, element);
   }
   for (TestAllTypesLite_NestedMessage *element in self.repeatedNestedMessageArray) {
-    size += computeMessageSize(48, element);
+    size_ += computeMessageSize(48, element);
   }
   for (ForeignMessageLite *element in self.repeatedForeignMessageArray) {
-    size += computeMessageSize(49, element);
+    size_ += computeMessageSize(49, element);
   }
   for (ImportMessageLite *element in self.repeatedImportMessageArray) {
-    size += computeMessageSize(50, element);
+    size_ += computeMessageSize(50, element);
   }
   {
     int32_t dataSize = 0;
@@ -2346,8 +2021,8 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeEnumSizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
@@ -2356,8 +2031,8 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeEnumSizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
@@ -2366,115 +2041,93 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeEnumSizeNoTag(values[i]);
     }
-    size += dataSize;
-    size += 2 * count;
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
     const NSUInteger count = self.repeatedStringPieceArray.count;
-
-      for(NSString *value in self.repeatedStringPieceArray){
-          dataSize += computeStringSizeNoTag(value);
-      }  
-      
-    size += dataSize;
-    size += 2 * count;
+    for (NSString *element in self.repeatedStringPieceArray) {
+      dataSize += computeStringSizeNoTag(element);
+    }
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   {
     int32_t dataSize = 0;
     const NSUInteger count = self.repeatedCordArray.count;
-
-      for(NSString *value in self.repeatedCordArray){
-          dataSize += computeStringSizeNoTag(value);
-      }  
-
-    size += dataSize;
-    size += 2 * count;
+    for (NSString *element in self.repeatedCordArray) {
+      dataSize += computeStringSizeNoTag(element);
+    }
+    size_ += dataSize;
+    size_ += 2 * count;
   }
   if (self.hasDefaultInt32) {
-    size += computeInt32Size(61, self.defaultInt32);
+    size_ += computeInt32Size(61, self.defaultInt32);
   }
   if (self.hasDefaultInt64) {
-    size += computeInt64Size(62, self.defaultInt64);
+    size_ += computeInt64Size(62, self.defaultInt64);
   }
   if (self.hasDefaultUint32) {
-    size += computeUInt32Size(63, self.defaultUint32);
+    size_ += computeUInt32Size(63, self.defaultUint32);
   }
   if (self.hasDefaultUint64) {
-    size += computeUInt64Size(64, self.defaultUint64);
+    size_ += computeUInt64Size(64, self.defaultUint64);
   }
   if (self.hasDefaultSint32) {
-    size += computeSInt32Size(65, self.defaultSint32);
+    size_ += computeSInt32Size(65, self.defaultSint32);
   }
   if (self.hasDefaultSint64) {
-    size += computeSInt64Size(66, self.defaultSint64);
+    size_ += computeSInt64Size(66, self.defaultSint64);
   }
   if (self.hasDefaultFixed32) {
-    size += computeFixed32Size(67, self.defaultFixed32);
+    size_ += computeFixed32Size(67, self.defaultFixed32);
   }
   if (self.hasDefaultFixed64) {
-    size += computeFixed64Size(68, self.defaultFixed64);
+    size_ += computeFixed64Size(68, self.defaultFixed64);
   }
   if (self.hasDefaultSfixed32) {
-    size += computeSFixed32Size(69, self.defaultSfixed32);
+    size_ += computeSFixed32Size(69, self.defaultSfixed32);
   }
   if (self.hasDefaultSfixed64) {
-    size += computeSFixed64Size(70, self.defaultSfixed64);
+    size_ += computeSFixed64Size(70, self.defaultSfixed64);
   }
   if (self.hasDefaultFloat) {
-    size += computeFloatSize(71, self.defaultFloat);
+    size_ += computeFloatSize(71, self.defaultFloat);
   }
   if (self.hasDefaultDouble) {
-    size += computeDoubleSize(72, self.defaultDouble);
+    size_ += computeDoubleSize(72, self.defaultDouble);
   }
   if (self.hasDefaultBool) {
-    size += computeBoolSize(73, self.defaultBool);
+    size_ += computeBoolSize(73, self.defaultBool);
   }
   if (self.hasDefaultString) {
-    size += computeStringSize(74, self.defaultString);
+    size_ += computeStringSize(74, self.defaultString);
   }
   if (self.hasDefaultBytes) {
-    size += computeDataSize(75, self.defaultBytes);
+    size_ += computeDataSize(75, self.defaultBytes);
   }
   if (self.hasDefaultNestedEnum) {
-    size += computeEnumSize(81, self.defaultNestedEnum);
+    size_ += computeEnumSize(81, self.defaultNestedEnum);
   }
   if (self.hasDefaultForeignEnum) {
-    size += computeEnumSize(82, self.defaultForeignEnum);
+    size_ += computeEnumSize(82, self.defaultForeignEnum);
   }
   if (self.hasDefaultImportEnum) {
-    size += computeEnumSize(83, self.defaultImportEnum);
+    size_ += computeEnumSize(83, self.defaultImportEnum);
   }
   if (self.hasDefaultStringPiece) {
-    size += computeStringSize(84, self.defaultStringPiece);
+    size_ += computeStringSize(84, self.defaultStringPiece);
   }
   if (self.hasDefaultCord) {
-    size += computeStringSize(85, self.defaultCord);
+    size_ += computeStringSize(85, self.defaultCord);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestAllTypesLite*) parseFromData:(NSData*) data {
-  return (TestAllTypesLite*)[[[TestAllTypesLite builder] mergeFromData:data] build];
-}
-+ (TestAllTypesLite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite*)[[[TestAllTypesLite builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestAllTypesLite*) parseFromInputStream:(NSInputStream*) input {
-  return (TestAllTypesLite*)[[[TestAllTypesLite builder] mergeFromInputStream:input] build];
-}
-+ (TestAllTypesLite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite*)[[[TestAllTypesLite builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestAllTypesLite*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestAllTypesLite*)[[[TestAllTypesLite builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestAllTypesLite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite*)[[[TestAllTypesLite builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestAllTypesLite_Builder*) builder {
-  return [[TestAllTypesLite_Builder alloc] init] ;
+  return [[TestAllTypesLite_Builder alloc] init];
 }
 + (TestAllTypesLite_Builder*) builderWithPrototype:(TestAllTypesLite*) prototype {
   return [[TestAllTypesLite builder] mergeFrom:prototype];
@@ -2485,262 +2138,237 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
 - (TestAllTypesLite_Builder*) toBuilder {
   return [TestAllTypesLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasOptionalInt32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalInt32", [NSNumber numberWithInt:self.optionalInt32]];
+    PBTextFormatWriteInt32(writer, "optionalInt32", self.optionalInt32);
   }
   if (self.hasOptionalInt64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalInt64", [NSNumber numberWithLongLong:self.optionalInt64]];
+    PBTextFormatWriteInt64(writer, "optionalInt64", self.optionalInt64);
   }
   if (self.hasOptionalUint32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalUint32", [NSNumber numberWithInt:self.optionalUint32]];
+    PBTextFormatWriteUInt32(writer, "optionalUint32", self.optionalUint32);
   }
   if (self.hasOptionalUint64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalUint64", [NSNumber numberWithLongLong:self.optionalUint64]];
+    PBTextFormatWriteUInt64(writer, "optionalUint64", self.optionalUint64);
   }
   if (self.hasOptionalSint32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalSint32", [NSNumber numberWithInt:self.optionalSint32]];
+    PBTextFormatWriteInt32(writer, "optionalSint32", self.optionalSint32);
   }
   if (self.hasOptionalSint64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalSint64", [NSNumber numberWithLongLong:self.optionalSint64]];
+    PBTextFormatWriteInt64(writer, "optionalSint64", self.optionalSint64);
   }
   if (self.hasOptionalFixed32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalFixed32", [NSNumber numberWithInt:self.optionalFixed32]];
+    PBTextFormatWriteUInt32(writer, "optionalFixed32", self.optionalFixed32);
   }
   if (self.hasOptionalFixed64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalFixed64", [NSNumber numberWithLongLong:self.optionalFixed64]];
+    PBTextFormatWriteUInt64(writer, "optionalFixed64", self.optionalFixed64);
   }
   if (self.hasOptionalSfixed32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalSfixed32", [NSNumber numberWithInt:self.optionalSfixed32]];
+    PBTextFormatWriteInt32(writer, "optionalSfixed32", self.optionalSfixed32);
   }
   if (self.hasOptionalSfixed64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalSfixed64", [NSNumber numberWithLongLong:self.optionalSfixed64]];
+    PBTextFormatWriteInt64(writer, "optionalSfixed64", self.optionalSfixed64);
   }
   if (self.hasOptionalFloat) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalFloat", [NSNumber numberWithFloat:self.optionalFloat]];
+    PBTextFormatWriteFloat(writer, "optionalFloat", self.optionalFloat);
   }
   if (self.hasOptionalDouble) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalDouble", [NSNumber numberWithDouble:self.optionalDouble]];
+    PBTextFormatWriteDouble(writer, "optionalDouble", self.optionalDouble);
   }
   if (self.hasOptionalBool) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalBool", [NSNumber numberWithBool:self.optionalBool]];
+    PBTextFormatWriteBool(writer, "optionalBool", self.optionalBool);
   }
   if (self.hasOptionalString) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalString", self.optionalString];
+    PBTextFormatWriteObject(writer, "optionalString", self.optionalString);
   }
   if (self.hasOptionalBytes) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalBytes", self.optionalBytes];
+    PBTextFormatWriteObject(writer, "optionalBytes", self.optionalBytes);
   }
   if (self.hasOptionalGroup) {
-    [output appendFormat:@"%@%@ {\n", indent, @"optionalGroup"];
-    [self.optionalGroup writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "optionalGroup", self.optionalGroup);
   }
   if (self.hasOptionalNestedMessage) {
-    [output appendFormat:@"%@%@ {\n", indent, @"optionalNestedMessage"];
-    [self.optionalNestedMessage writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "optionalNestedMessage", self.optionalNestedMessage);
   }
   if (self.hasOptionalForeignMessage) {
-    [output appendFormat:@"%@%@ {\n", indent, @"optionalForeignMessage"];
-    [self.optionalForeignMessage writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "optionalForeignMessage", self.optionalForeignMessage);
   }
   if (self.hasOptionalImportMessage) {
-    [output appendFormat:@"%@%@ {\n", indent, @"optionalImportMessage"];
-    [self.optionalImportMessage writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "optionalImportMessage", self.optionalImportMessage);
   }
   if (self.hasOptionalNestedEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"optionalNestedEnum", self.optionalNestedEnum];
+    PBTextFormatWriteInt32(writer, "optionalNestedEnum", self.optionalNestedEnum);
   }
   if (self.hasOptionalForeignEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"optionalForeignEnum", self.optionalForeignEnum];
+    PBTextFormatWriteInt32(writer, "optionalForeignEnum", self.optionalForeignEnum);
   }
   if (self.hasOptionalImportEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"optionalImportEnum", self.optionalImportEnum];
+    PBTextFormatWriteInt32(writer, "optionalImportEnum", self.optionalImportEnum);
   }
   if (self.hasOptionalStringPiece) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalStringPiece", self.optionalStringPiece];
+    PBTextFormatWriteObject(writer, "optionalStringPiece", self.optionalStringPiece);
   }
   if (self.hasOptionalCord) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"optionalCord", self.optionalCord];
+    PBTextFormatWriteObject(writer, "optionalCord", self.optionalCord);
+  }
+  NSUInteger repeatedInt32ArrayCount=self.repeatedInt32Array.count;
+  for(NSUInteger i=0;i<repeatedInt32ArrayCount;i++){
+    PBTextFormatWriteInt32(writer, "repeatedInt32", [self.repeatedInt32Array int32AtIndex:i]);
+  }
+  NSUInteger repeatedInt64ArrayCount=self.repeatedInt64Array.count;
+  for(NSUInteger i=0;i<repeatedInt64ArrayCount;i++){
+    PBTextFormatWriteInt64(writer, "repeatedInt64", [self.repeatedInt64Array int64AtIndex:i]);
+  }
+  NSUInteger repeatedUint32ArrayCount=self.repeatedUint32Array.count;
+  for(NSUInteger i=0;i<repeatedUint32ArrayCount;i++){
+    PBTextFormatWriteUInt32(writer, "repeatedUint32", [self.repeatedUint32Array uint32AtIndex:i]);
+  }
+  NSUInteger repeatedUint64ArrayCount=self.repeatedUint64Array.count;
+  for(NSUInteger i=0;i<repeatedUint64ArrayCount;i++){
+    PBTextFormatWriteUInt64(writer, "repeatedUint64", [self.repeatedUint64Array uint64AtIndex:i]);
+  }
+  NSUInteger repeatedSint32ArrayCount=self.repeatedSint32Array.count;
+  for(NSUInteger i=0;i<repeatedSint32ArrayCount;i++){
+    PBTextFormatWriteInt32(writer, "repeatedSint32", [self.repeatedSint32Array int32AtIndex:i]);
+  }
+  NSUInteger repeatedSint64ArrayCount=self.repeatedSint64Array.count;
+  for(NSUInteger i=0;i<repeatedSint64ArrayCount;i++){
+    PBTextFormatWriteInt64(writer, "repeatedSint64", [self.repeatedSint64Array int64AtIndex:i]);
+  }
+  NSUInteger repeatedFixed32ArrayCount=self.repeatedFixed32Array.count;
+  for(NSUInteger i=0;i<repeatedFixed32ArrayCount;i++){
+    PBTextFormatWriteUInt32(writer, "repeatedFixed32", [self.repeatedFixed32Array uint32AtIndex:i]);
+  }
+  NSUInteger repeatedFixed64ArrayCount=self.repeatedFixed64Array.count;
+  for(NSUInteger i=0;i<repeatedFixed64ArrayCount;i++){
+    PBTextFormatWriteUInt64(writer, "repeatedFixed64", [self.repeatedFixed64Array uint64AtIndex:i]);
+  }
+  NSUInteger repeatedSfixed32ArrayCount=self.repeatedSfixed32Array.count;
+  for(NSUInteger i=0;i<repeatedSfixed32ArrayCount;i++){
+    PBTextFormatWriteInt32(writer, "repeatedSfixed32", [self.repeatedSfixed32Array int32AtIndex:i]);
+  }
+  NSUInteger repeatedSfixed64ArrayCount=self.repeatedSfixed64Array.count;
+  for(NSUInteger i=0;i<repeatedSfixed64ArrayCount;i++){
+    PBTextFormatWriteInt64(writer, "repeatedSfixed64", [self.repeatedSfixed64Array int64AtIndex:i]);
+  }
+  NSUInteger repeatedFloatArrayCount=self.repeatedFloatArray.count;
+  for(NSUInteger i=0;i<repeatedFloatArrayCount;i++){
+    PBTextFormatWriteFloat(writer, "repeatedFloat", [self.repeatedFloatArray floatAtIndex:i]);
+  }
+  NSUInteger repeatedDoubleArrayCount=self.repeatedDoubleArray.count;
+  for(NSUInteger i=0;i<repeatedDoubleArrayCount;i++){
+    PBTextFormatWriteDouble(writer, "repeatedDouble", [self.repeatedDoubleArray doubleAtIndex:i]);
+  }
+  NSUInteger repeatedBoolArrayCount=self.repeatedBoolArray.count;
+  for(NSUInteger i=0;i<repeatedBoolArrayCount;i++){
+    PBTextFormatWriteBool(writer, "repeatedBool", [self.repeatedBoolArray boolAtIndex:i]);
   }
-    
-    for(int i=0;i<self.repeatedInt32Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedInt32", [self.repeatedInt32Array int32AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedInt64Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedInt64", [self.repeatedInt64Array int64AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedUint32Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedUint32", [self.repeatedUint32Array uint32AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedUint64Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedUint64", [self.repeatedUint64Array uint64AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedSint32Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedSint32", [self.repeatedSint32Array int32AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedSint64Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedSint64", [self.repeatedSint64Array int64AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedFixed32Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedFixed32", [self.repeatedFixed32Array uint32AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedFixed64Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedFixed64", [self.repeatedFixed64Array uint64AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedSfixed32Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedSfixed32", [self.repeatedSfixed32Array int32AtIndex:i]];
-    }
-
-    for(int i=0;i<self.repeatedSfixed64Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedSfixed64", [self.repeatedSfixed64Array int64AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedFloatArray.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedFloat", [self.repeatedFloatArray floatAtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedDoubleArray.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedDouble", [self.repeatedDoubleArray doubleAtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedBoolArray.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedBool", [self.repeatedBoolArray boolAtIndex:i]];
-    }
-    
-    for(int i=0;i<self.repeatedInt32Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedInt32", [self.repeatedInt32Array int32AtIndex:i]];
-    }
-
-
-
   for (NSString* element in self.repeatedStringArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedString", element];
+    PBTextFormatWriteObject(writer, "repeatedString", element);
   }
   for (NSData* element in self.repeatedBytesArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedBytes", element];
+    PBTextFormatWriteObject(writer, "repeatedBytes", element);
   }
   for (TestAllTypesLite_RepeatedGroup* element in self.repeatedGroupArray) {
-    [output appendFormat:@"%@%@ {\n", indent, @"repeatedGroup"];
-    [element writeDescriptionTo:output
-                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "repeatedGroup", element);
   }
   for (TestAllTypesLite_NestedMessage* element in self.repeatedNestedMessageArray) {
-    [output appendFormat:@"%@%@ {\n", indent, @"repeatedNestedMessage"];
-    [element writeDescriptionTo:output
-                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "repeatedNestedMessage", element);
   }
   for (ForeignMessageLite* element in self.repeatedForeignMessageArray) {
-    [output appendFormat:@"%@%@ {\n", indent, @"repeatedForeignMessage"];
-    [element writeDescriptionTo:output
-                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "repeatedForeignMessage", element);
   }
   for (ImportMessageLite* element in self.repeatedImportMessageArray) {
-    [output appendFormat:@"%@%@ {\n", indent, @"repeatedImportMessage"];
-    [element writeDescriptionTo:output
-                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "repeatedImportMessage", element);
   }
-    for(int i=0;i<self.repeatedNestedEnumArray.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedNestedEnum", [self.repeatedNestedEnumArray uint32AtIndex:i]];
+  const NSUInteger repeatedNestedEnumArrayCount = self.repeatedNestedEnumArray.count;
+  if (repeatedNestedEnumArrayCount > 0) {
+    const TestAllTypesLite_NestedEnum *repeatedNestedEnumArrayValues = (const TestAllTypesLite_NestedEnum *)self.repeatedNestedEnumArray.data;
+    for (NSUInteger i = 0; i < repeatedNestedEnumArrayCount; ++i) {
+      PBTextFormatWriteInt32(writer, "repeatedNestedEnum", repeatedNestedEnumArrayValues[i]);
     }
-    
-    for(int i=0;i<self.repeatedForeignEnumArray.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedForeignEnum", [self.repeatedForeignEnumArray uint32AtIndex:i]];
+  }
+  const NSUInteger repeatedForeignEnumArrayCount = self.repeatedForeignEnumArray.count;
+  if (repeatedForeignEnumArrayCount > 0) {
+    const ForeignEnumLite *repeatedForeignEnumArrayValues = (const ForeignEnumLite *)self.repeatedForeignEnumArray.data;
+    for (NSUInteger i = 0; i < repeatedForeignEnumArrayCount; ++i) {
+      PBTextFormatWriteInt32(writer, "repeatedForeignEnum", repeatedForeignEnumArrayValues[i]);
     }
-    
-    for(int i=0;i<self.repeatedImportEnumArray.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"repeatedImportEnum", [self.repeatedImportEnumArray uint32AtIndex:i]];
+  }
+  const NSUInteger repeatedImportEnumArrayCount = self.repeatedImportEnumArray.count;
+  if (repeatedImportEnumArrayCount > 0) {
+    const ImportEnumLite *repeatedImportEnumArrayValues = (const ImportEnumLite *)self.repeatedImportEnumArray.data;
+    for (NSUInteger i = 0; i < repeatedImportEnumArrayCount; ++i) {
+      PBTextFormatWriteInt32(writer, "repeatedImportEnum", repeatedImportEnumArrayValues[i]);
     }
-    
-
-    
-
+  }
   for (NSString* element in self.repeatedStringPieceArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedStringPiece", element];
+    PBTextFormatWriteObject(writer, "repeatedStringPiece", element);
   }
   for (NSString* element in self.repeatedCordArray) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"repeatedCord", element];
+    PBTextFormatWriteObject(writer, "repeatedCord", element);
   }
   if (self.hasDefaultInt32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultInt32", [NSNumber numberWithInt:self.defaultInt32]];
+    PBTextFormatWriteInt32(writer, "defaultInt32", self.defaultInt32);
   }
   if (self.hasDefaultInt64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultInt64", [NSNumber numberWithLongLong:self.defaultInt64]];
+    PBTextFormatWriteInt64(writer, "defaultInt64", self.defaultInt64);
   }
   if (self.hasDefaultUint32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultUint32", [NSNumber numberWithInt:self.defaultUint32]];
+    PBTextFormatWriteUInt32(writer, "defaultUint32", self.defaultUint32);
   }
   if (self.hasDefaultUint64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultUint64", [NSNumber numberWithLongLong:self.defaultUint64]];
+    PBTextFormatWriteUInt64(writer, "defaultUint64", self.defaultUint64);
   }
   if (self.hasDefaultSint32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultSint32", [NSNumber numberWithInt:self.defaultSint32]];
+    PBTextFormatWriteInt32(writer, "defaultSint32", self.defaultSint32);
   }
   if (self.hasDefaultSint64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultSint64", [NSNumber numberWithLongLong:self.defaultSint64]];
+    PBTextFormatWriteInt64(writer, "defaultSint64", self.defaultSint64);
   }
   if (self.hasDefaultFixed32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultFixed32", [NSNumber numberWithInt:self.defaultFixed32]];
+    PBTextFormatWriteUInt32(writer, "defaultFixed32", self.defaultFixed32);
   }
   if (self.hasDefaultFixed64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultFixed64", [NSNumber numberWithLongLong:self.defaultFixed64]];
+    PBTextFormatWriteUInt64(writer, "defaultFixed64", self.defaultFixed64);
   }
   if (self.hasDefaultSfixed32) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultSfixed32", [NSNumber numberWithInt:self.defaultSfixed32]];
+    PBTextFormatWriteInt32(writer, "defaultSfixed32", self.defaultSfixed32);
   }
   if (self.hasDefaultSfixed64) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultSfixed64", [NSNumber numberWithLongLong:self.defaultSfixed64]];
+    PBTextFormatWriteInt64(writer, "defaultSfixed64", self.defaultSfixed64);
   }
   if (self.hasDefaultFloat) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultFloat", [NSNumber numberWithFloat:self.defaultFloat]];
+    PBTextFormatWriteFloat(writer, "defaultFloat", self.defaultFloat);
   }
   if (self.hasDefaultDouble) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultDouble", [NSNumber numberWithDouble:self.defaultDouble]];
+    PBTextFormatWriteDouble(writer, "defaultDouble", self.defaultDouble);
   }
   if (self.hasDefaultBool) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultBool", [NSNumber numberWithBool:self.defaultBool]];
+    PBTextFormatWriteBool(writer, "defaultBool", self.defaultBool);
   }
   if (self.hasDefaultString) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultString", self.defaultString];
+    PBTextFormatWriteObject(writer, "defaultString", self.defaultString);
   }
   if (self.hasDefaultBytes) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultBytes", self.defaultBytes];
+    PBTextFormatWriteObject(writer, "defaultBytes", self.defaultBytes);
   }
   if (self.hasDefaultNestedEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"defaultNestedEnum", self.defaultNestedEnum];
+    PBTextFormatWriteInt32(writer, "defaultNestedEnum", self.defaultNestedEnum);
   }
   if (self.hasDefaultForeignEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"defaultForeignEnum", self.defaultForeignEnum];
+    PBTextFormatWriteInt32(writer, "defaultForeignEnum", self.defaultForeignEnum);
   }
   if (self.hasDefaultImportEnum) {
-    [output appendFormat:@"%@%@: %d\n", indent, @"defaultImportEnum", self.defaultImportEnum];
+    PBTextFormatWriteInt32(writer, "defaultImportEnum", self.defaultImportEnum);
   }
   if (self.hasDefaultStringPiece) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultStringPiece", self.defaultStringPiece];
+    PBTextFormatWriteObject(writer, "defaultStringPiece", self.defaultStringPiece);
   }
   if (self.hasDefaultCord) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"defaultCord", self.defaultCord];
+    PBTextFormatWriteObject(writer, "defaultCord", self.defaultCord);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -2753,226 +2381,158 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
   return
       self.hasOptionalInt32 == otherMessage.hasOptionalInt32 &&
       (!self.hasOptionalInt32 || self.optionalInt32 == otherMessage.optionalInt32) &&
-      
       self.hasOptionalInt64 == otherMessage.hasOptionalInt64 &&
       (!self.hasOptionalInt64 || self.optionalInt64 == otherMessage.optionalInt64) &&
-      
       self.hasOptionalUint32 == otherMessage.hasOptionalUint32 &&
       (!self.hasOptionalUint32 || self.optionalUint32 == otherMessage.optionalUint32) &&
-      
       self.hasOptionalUint64 == otherMessage.hasOptionalUint64 &&
       (!self.hasOptionalUint64 || self.optionalUint64 == otherMessage.optionalUint64) &&
-      
       self.hasOptionalSint32 == otherMessage.hasOptionalSint32 &&
       (!self.hasOptionalSint32 || self.optionalSint32 == otherMessage.optionalSint32) &&
-      
       self.hasOptionalSint64 == otherMessage.hasOptionalSint64 &&
       (!self.hasOptionalSint64 || self.optionalSint64 == otherMessage.optionalSint64) &&
-      
       self.hasOptionalFixed32 == otherMessage.hasOptionalFixed32 &&
       (!self.hasOptionalFixed32 || self.optionalFixed32 == otherMessage.optionalFixed32) &&
-      
       self.hasOptionalFixed64 == otherMessage.hasOptionalFixed64 &&
       (!self.hasOptionalFixed64 || self.optionalFixed64 == otherMessage.optionalFixed64) &&
-      
       self.hasOptionalSfixed32 == otherMessage.hasOptionalSfixed32 &&
       (!self.hasOptionalSfixed32 || self.optionalSfixed32 == otherMessage.optionalSfixed32) &&
-      
       self.hasOptionalSfixed64 == otherMessage.hasOptionalSfixed64 &&
       (!self.hasOptionalSfixed64 || self.optionalSfixed64 == otherMessage.optionalSfixed64) &&
-      
       self.hasOptionalFloat == otherMessage.hasOptionalFloat &&
       (!self.hasOptionalFloat || self.optionalFloat == otherMessage.optionalFloat) &&
-      
       self.hasOptionalDouble == otherMessage.hasOptionalDouble &&
       (!self.hasOptionalDouble || self.optionalDouble == otherMessage.optionalDouble) &&
-      
       self.hasOptionalBool == otherMessage.hasOptionalBool &&
       (!self.hasOptionalBool || self.optionalBool == otherMessage.optionalBool) &&
-      
       self.hasOptionalString == otherMessage.hasOptionalString &&
       (!self.hasOptionalString || [self.optionalString isEqual:otherMessage.optionalString]) &&
-      
       self.hasOptionalBytes == otherMessage.hasOptionalBytes &&
       (!self.hasOptionalBytes || [self.optionalBytes isEqual:otherMessage.optionalBytes]) &&
-      
       self.hasOptionalGroup == otherMessage.hasOptionalGroup &&
       (!self.hasOptionalGroup || [self.optionalGroup isEqual:otherMessage.optionalGroup]) &&
-      
       self.hasOptionalNestedMessage == otherMessage.hasOptionalNestedMessage &&
       (!self.hasOptionalNestedMessage || [self.optionalNestedMessage isEqual:otherMessage.optionalNestedMessage]) &&
-      
       self.hasOptionalForeignMessage == otherMessage.hasOptionalForeignMessage &&
       (!self.hasOptionalForeignMessage || [self.optionalForeignMessage isEqual:otherMessage.optionalForeignMessage]) &&
-      
       self.hasOptionalImportMessage == otherMessage.hasOptionalImportMessage &&
       (!self.hasOptionalImportMessage || [self.optionalImportMessage isEqual:otherMessage.optionalImportMessage]) &&
-      
       self.hasOptionalNestedEnum == otherMessage.hasOptionalNestedEnum &&
-      (!self.hasOptionalNestedEnum || self.optionalNestedEnum != otherMessage.optionalNestedEnum) &&
-      
+      (!self.hasOptionalNestedEnum || self.optionalNestedEnum == otherMessage.optionalNestedEnum) &&
       self.hasOptionalForeignEnum == otherMessage.hasOptionalForeignEnum &&
-      (!self.hasOptionalForeignEnum || self.optionalForeignEnum != otherMessage.optionalForeignEnum) &&
-      
+      (!self.hasOptionalForeignEnum || self.optionalForeignEnum == otherMessage.optionalForeignEnum) &&
       self.hasOptionalImportEnum == otherMessage.hasOptionalImportEnum &&
-      (!self.hasOptionalImportEnum || self.optionalImportEnum != otherMessage.optionalImportEnum) &&
-      
+      (!self.hasOptionalImportEnum || self.optionalImportEnum == otherMessage.optionalImportEnum) &&
       self.hasOptionalStringPiece == otherMessage.hasOptionalStringPiece &&
       (!self.hasOptionalStringPiece || [self.optionalStringPiece isEqual:otherMessage.optionalStringPiece]) &&
-      
       self.hasOptionalCord == otherMessage.hasOptionalCord &&
       (!self.hasOptionalCord || [self.optionalCord isEqual:otherMessage.optionalCord]) &&
-      
-      [self.repeatedInt32Array isEqualToArray:otherMessage.repeatedInt32Array] &&
-      
-      [self.repeatedInt64Array isEqualToArray:otherMessage.repeatedInt64Array] &&
-      
-      [self.repeatedUint32Array isEqualToArray:otherMessage.repeatedUint32Array] &&
-      
-      [self.repeatedUint64Array isEqualToArray:otherMessage.repeatedUint64Array] &&
-      
-      [self.repeatedSint32Array isEqualToArray:otherMessage.repeatedSint32Array] &&
-      
-      [self.repeatedSint64Array isEqualToArray:otherMessage.repeatedSint64Array] &&
-      
-      [self.repeatedFixed32Array isEqualToArray:otherMessage.repeatedFixed32Array] &&
-      
-      [self.repeatedFixed64Array isEqualToArray:otherMessage.repeatedFixed64Array] &&
-      
-      [self.repeatedSfixed32Array isEqualToArray:otherMessage.repeatedSfixed32Array] &&
-      
-      [self.repeatedSfixed64Array isEqualToArray:otherMessage.repeatedSfixed64Array] &&
-      
-      [self.repeatedFloatArray isEqualToArray:otherMessage.repeatedFloatArray] &&
-      
-      [self.repeatedDoubleArray isEqualToArray:otherMessage.repeatedDoubleArray] &&
-      
-      [self.repeatedBoolArray isEqualToArray:otherMessage.repeatedBoolArray] &&
-      
-      [self.repeatedStringArray isEqualToArray:otherMessage.repeatedStringArray] &&
-      
-      [self.repeatedBytesArray isEqualToArray:otherMessage.repeatedBytesArray] &&
-      
-      [self.repeatedGroupArray isEqualToArray:otherMessage.repeatedGroupArray] &&
-      
-      [self.repeatedNestedMessageArray isEqualToArray:otherMessage.repeatedNestedMessageArray] &&
-      
-      [self.repeatedForeignMessageArray isEqualToArray:otherMessage.repeatedForeignMessageArray] &&
-      
-      [self.repeatedImportMessageArray isEqualToArray:otherMessage.repeatedImportMessageArray] &&
-      
-      [self.repeatedNestedEnumArray isEqualToArray:otherMessage.repeatedNestedEnumArray] &&
-      
-      [self.repeatedForeignEnumArray isEqualToArray:otherMessage.repeatedForeignEnumArray] &&
-      
-      [self.repeatedImportEnumArray isEqualToArray:otherMessage.repeatedImportEnumArray] &&
-      
-      [self.repeatedStringPieceArray isEqualToArray:otherMessage.repeatedStringPieceArray] &&
-      
-      [self.repeatedCordArray isEqualToArray:otherMessage.repeatedCordArray] &&
-      
+      (self.repeatedInt32Array == otherMessage.repeatedInt32Array || [self.repeatedInt32Array isEqualToArray:otherMessage.repeatedInt32Array]) &&
+      (self.repeatedInt64Array == otherMessage.repeatedInt64Array || [self.repeatedInt64Array isEqualToArray:otherMessage.repeatedInt64Array]) &&
+      (self.repeatedUint32Array == otherMessage.repeatedUint32Array || [self.repeatedUint32Array isEqualToArray:otherMessage.repeatedUint32Array]) &&
+      (self.repeatedUint64Array == otherMessage.repeatedUint64Array || [self.repeatedUint64Array isEqualToArray:otherMessage.repeatedUint64Array]) &&
+      (self.repeatedSint32Array == otherMessage.repeatedSint32Array || [self.repeatedSint32Array isEqualToArray:otherMessage.repeatedSint32Array]) &&
+      (self.repeatedSint64Array == otherMessage.repeatedSint64Array || [self.repeatedSint64Array isEqualToArray:otherMessage.repeatedSint64Array]) &&
+      (self.repeatedFixed32Array == otherMessage.repeatedFixed32Array || [self.repeatedFixed32Array isEqualToArray:otherMessage.repeatedFixed32Array]) &&
+      (self.repeatedFixed64Array == otherMessage.repeatedFixed64Array || [self.repeatedFixed64Array isEqualToArray:otherMessage.repeatedFixed64Array]) &&
+      (self.repeatedSfixed32Array == otherMessage.repeatedSfixed32Array || [self.repeatedSfixed32Array isEqualToArray:otherMessage.repeatedSfixed32Array]) &&
+      (self.repeatedSfixed64Array == otherMessage.repeatedSfixed64Array || [self.repeatedSfixed64Array isEqualToArray:otherMessage.repeatedSfixed64Array]) &&
+      (self.repeatedFloatArray == otherMessage.repeatedFloatArray || [self.repeatedFloatArray isEqualToArray:otherMessage.repeatedFloatArray]) &&
+      (self.repeatedDoubleArray == otherMessage.repeatedDoubleArray || [self.repeatedDoubleArray isEqualToArray:otherMessage.repeatedDoubleArray]) &&
+      (self.repeatedBoolArray == otherMessage.repeatedBoolArray || [self.repeatedBoolArray isEqualToArray:otherMessage.repeatedBoolArray]) &&
+      (self.repeatedStringArray == otherMessage.repeatedStringArray || [self.repeatedStringArray isEqualToArray:otherMessage.repeatedStringArray]) &&
+      (self.repeatedBytesArray == otherMessage.repeatedBytesArray || [self.repeatedBytesArray isEqualToArray:otherMessage.repeatedBytesArray]) &&
+      (self.repeatedGroupArray == otherMessage.repeatedGroupArray || [self.repeatedGroupArray isEqualToArray:otherMessage.repeatedGroupArray]) &&
+      (self.repeatedNestedMessageArray == otherMessage.repeatedNestedMessageArray || [self.repeatedNestedMessageArray isEqualToArray:otherMessage.repeatedNestedMessageArray]) &&
+      (self.repeatedForeignMessageArray == otherMessage.repeatedForeignMessageArray || [self.repeatedForeignMessageArray isEqualToArray:otherMessage.repeatedForeignMessageArray]) &&
+      (self.repeatedImportMessageArray == otherMessage.repeatedImportMessageArray || [self.repeatedImportMessageArray isEqualToArray:otherMessage.repeatedImportMessageArray]) &&
+      (self.repeatedNestedEnumArray == otherMessage.repeatedNestedEnumArray || [self.repeatedNestedEnumArray isEqualToArray:otherMessage.repeatedNestedEnumArray]) &&
+      (self.repeatedForeignEnumArray == otherMessage.repeatedForeignEnumArray || [self.repeatedForeignEnumArray isEqualToArray:otherMessage.repeatedForeignEnumArray]) &&
+      (self.repeatedImportEnumArray == otherMessage.repeatedImportEnumArray || [self.repeatedImportEnumArray isEqualToArray:otherMessage.repeatedImportEnumArray]) &&
+      (self.repeatedStringPieceArray == otherMessage.repeatedStringPieceArray || [self.repeatedStringPieceArray isEqualToArray:otherMessage.repeatedStringPieceArray]) &&
+      (self.repeatedCordArray == otherMessage.repeatedCordArray || [self.repeatedCordArray isEqualToArray:otherMessage.repeatedCordArray]) &&
       self.hasDefaultInt32 == otherMessage.hasDefaultInt32 &&
       (!self.hasDefaultInt32 || self.defaultInt32 == otherMessage.defaultInt32) &&
-      
       self.hasDefaultInt64 == otherMessage.hasDefaultInt64 &&
       (!self.hasDefaultInt64 || self.defaultInt64 == otherMessage.defaultInt64) &&
-      
       self.hasDefaultUint32 == otherMessage.hasDefaultUint32 &&
       (!self.hasDefaultUint32 || self.defaultUint32 == otherMessage.defaultUint32) &&
-      
       self.hasDefaultUint64 == otherMessage.hasDefaultUint64 &&
       (!self.hasDefaultUint64 || self.defaultUint64 == otherMessage.defaultUint64) &&
-      
       self.hasDefaultSint32 == otherMessage.hasDefaultSint32 &&
       (!self.hasDefaultSint32 || self.defaultSint32 == otherMessage.defaultSint32) &&
-      
       self.hasDefaultSint64 == otherMessage.hasDefaultSint64 &&
       (!self.hasDefaultSint64 || self.defaultSint64 == otherMessage.defaultSint64) &&
-      
       self.hasDefaultFixed32 == otherMessage.hasDefaultFixed32 &&
       (!self.hasDefaultFixed32 || self.defaultFixed32 == otherMessage.defaultFixed32) &&
-      
       self.hasDefaultFixed64 == otherMessage.hasDefaultFixed64 &&
       (!self.hasDefaultFixed64 || self.defaultFixed64 == otherMessage.defaultFixed64) &&
-      
       self.hasDefaultSfixed32 == otherMessage.hasDefaultSfixed32 &&
       (!self.hasDefaultSfixed32 || self.defaultSfixed32 == otherMessage.defaultSfixed32) &&
-      
       self.hasDefaultSfixed64 == otherMessage.hasDefaultSfixed64 &&
       (!self.hasDefaultSfixed64 || self.defaultSfixed64 == otherMessage.defaultSfixed64) &&
-      
       self.hasDefaultFloat == otherMessage.hasDefaultFloat &&
       (!self.hasDefaultFloat || self.defaultFloat == otherMessage.defaultFloat) &&
-      
       self.hasDefaultDouble == otherMessage.hasDefaultDouble &&
       (!self.hasDefaultDouble || self.defaultDouble == otherMessage.defaultDouble) &&
-      
       self.hasDefaultBool == otherMessage.hasDefaultBool &&
       (!self.hasDefaultBool || self.defaultBool == otherMessage.defaultBool) &&
-      
       self.hasDefaultString == otherMessage.hasDefaultString &&
       (!self.hasDefaultString || [self.defaultString isEqual:otherMessage.defaultString]) &&
-      
       self.hasDefaultBytes == otherMessage.hasDefaultBytes &&
       (!self.hasDefaultBytes || [self.defaultBytes isEqual:otherMessage.defaultBytes]) &&
-      
       self.hasDefaultNestedEnum == otherMessage.hasDefaultNestedEnum &&
-      (!self.hasDefaultNestedEnum || self.defaultNestedEnum != otherMessage.defaultNestedEnum) &&
-      
+      (!self.hasDefaultNestedEnum || self.defaultNestedEnum == otherMessage.defaultNestedEnum) &&
       self.hasDefaultForeignEnum == otherMessage.hasDefaultForeignEnum &&
-      (!self.hasDefaultForeignEnum || self.defaultForeignEnum != otherMessage.defaultForeignEnum) &&
-      
+      (!self.hasDefaultForeignEnum || self.defaultForeignEnum == otherMessage.defaultForeignEnum) &&
       self.hasDefaultImportEnum == otherMessage.hasDefaultImportEnum &&
-      (!self.hasDefaultImportEnum || self.defaultImportEnum != otherMessage.defaultImportEnum) &&
-      
+      (!self.hasDefaultImportEnum || self.defaultImportEnum == otherMessage.defaultImportEnum) &&
       self.hasDefaultStringPiece == otherMessage.hasDefaultStringPiece &&
       (!self.hasDefaultStringPiece || [self.defaultStringPiece isEqual:otherMessage.defaultStringPiece]) &&
-      
       self.hasDefaultCord == otherMessage.hasDefaultCord &&
       (!self.hasDefaultCord || [self.defaultCord isEqual:otherMessage.defaultCord]) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasOptionalInt32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.optionalInt32] hash];
+    hashCode = hashCode * 31 + [@(self.optionalInt32) hash];
   }
   if (self.hasOptionalInt64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.optionalInt64] hash];
+    hashCode = hashCode * 31 + [@(self.optionalInt64) hash];
   }
   if (self.hasOptionalUint32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.optionalUint32] hash];
+    hashCode = hashCode * 31 + [@(self.optionalUint32) hash];
   }
   if (self.hasOptionalUint64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.optionalUint64] hash];
+    hashCode = hashCode * 31 + [@(self.optionalUint64) hash];
   }
   if (self.hasOptionalSint32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.optionalSint32] hash];
+    hashCode = hashCode * 31 + [@(self.optionalSint32) hash];
   }
   if (self.hasOptionalSint64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.optionalSint64] hash];
+    hashCode = hashCode * 31 + [@(self.optionalSint64) hash];
   }
   if (self.hasOptionalFixed32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.optionalFixed32] hash];
+    hashCode = hashCode * 31 + [@(self.optionalFixed32) hash];
   }
   if (self.hasOptionalFixed64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.optionalFixed64] hash];
+    hashCode = hashCode * 31 + [@(self.optionalFixed64) hash];
   }
   if (self.hasOptionalSfixed32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.optionalSfixed32] hash];
+    hashCode = hashCode * 31 + [@(self.optionalSfixed32) hash];
   }
   if (self.hasOptionalSfixed64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.optionalSfixed64] hash];
+    hashCode = hashCode * 31 + [@(self.optionalSfixed64) hash];
   }
   if (self.hasOptionalFloat) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithFloat:self.optionalFloat] hash];
+    hashCode = hashCode * 31 + [@(self.optionalFloat) hash];
   }
   if (self.hasOptionalDouble) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithDouble:self.optionalDouble] hash];
+    hashCode = hashCode * 31 + [@(self.optionalDouble) hash];
   }
   if (self.hasOptionalBool) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithBool:self.optionalBool] hash];
+    hashCode = hashCode * 31 + [@(self.optionalBool) hash];
   }
   if (self.hasOptionalString) {
     hashCode = hashCode * 31 + [self.optionalString hash];
@@ -3007,61 +2567,58 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
   if (self.hasOptionalCord) {
     hashCode = hashCode * 31 + [self.optionalCord hash];
   }
-    
-    for(int i=0;i<self.repeatedInt32Array.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedInt32Array int32AtIndex:i];
-    }
-    
-    for(int i=0;i<self.repeatedInt64Array.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedInt64Array int64AtIndex:i];
-    }
-    
-    for(int i=0;i<self.repeatedUint32Array.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedUint32Array uint32AtIndex:i];
-    }
-    
-    for(int i=0;i<self.repeatedUint64Array.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedUint64Array uint64AtIndex:i];
-    }
-    
-    for(int i=0;i<self.repeatedSint32Array.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedSint32Array int32AtIndex:i];
-    }
-    
-    for(int i=0;i<self.repeatedSint64Array.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedSint64Array int64AtIndex:i];
-    }
-    
-    for(int i=0;i<self.repeatedFixed32Array.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedFixed32Array uint32AtIndex:i];
-    }
-    
-    for(int i=0;i<self.repeatedFixed64Array.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedFixed64Array uint64AtIndex:i];
-    }
-
-    for(int i=0;i<self.repeatedSfixed32Array.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedSfixed32Array int32AtIndex:i];
-    }
-    
-    for(int i=0;i<self.repeatedSfixed64Array.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedSfixed64Array int64AtIndex:i];
-    }
-    
-    for(int i=0;i<self.repeatedFloatArray.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedFloatArray floatAtIndex:i];
-    }
-    
-    for(int i=0;i<self.repeatedDoubleArray.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedDoubleArray doubleAtIndex:i];
-    }
-    
-    for(int i=0;i<self.repeatedBoolArray.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedBoolArray boolAtIndex:i];
-    }
-
-
-
+  NSUInteger repeatedInt32ArrayCount=self.repeatedInt32Array.count;
+  for(NSUInteger i=0;i<repeatedInt32ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedInt32Array int32AtIndex:i];
+  }
+  NSUInteger repeatedInt64ArrayCount=self.repeatedInt64Array.count;
+  for(NSUInteger i=0;i<repeatedInt64ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedInt64Array int64AtIndex:i];
+  }
+  NSUInteger repeatedUint32ArrayCount=self.repeatedUint32Array.count;
+  for(NSUInteger i=0;i<repeatedUint32ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedUint32Array uint32AtIndex:i];
+  }
+  NSUInteger repeatedUint64ArrayCount=self.repeatedUint64Array.count;
+  for(NSUInteger i=0;i<repeatedUint64ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedUint64Array uint64AtIndex:i];
+  }
+  NSUInteger repeatedSint32ArrayCount=self.repeatedSint32Array.count;
+  for(NSUInteger i=0;i<repeatedSint32ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedSint32Array int32AtIndex:i];
+  }
+  NSUInteger repeatedSint64ArrayCount=self.repeatedSint64Array.count;
+  for(NSUInteger i=0;i<repeatedSint64ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedSint64Array int64AtIndex:i];
+  }
+  NSUInteger repeatedFixed32ArrayCount=self.repeatedFixed32Array.count;
+  for(NSUInteger i=0;i<repeatedFixed32ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedFixed32Array uint32AtIndex:i];
+  }
+  NSUInteger repeatedFixed64ArrayCount=self.repeatedFixed64Array.count;
+  for(NSUInteger i=0;i<repeatedFixed64ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedFixed64Array uint64AtIndex:i];
+  }
+  NSUInteger repeatedSfixed32ArrayCount=self.repeatedSfixed32Array.count;
+  for(NSUInteger i=0;i<repeatedSfixed32ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedSfixed32Array int32AtIndex:i];
+  }
+  NSUInteger repeatedSfixed64ArrayCount=self.repeatedSfixed64Array.count;
+  for(NSUInteger i=0;i<repeatedSfixed64ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedSfixed64Array int64AtIndex:i];
+  }
+  NSUInteger repeatedFloatArrayCount=self.repeatedFloatArray.count;
+  for(NSUInteger i=0;i<repeatedFloatArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedFloatArray floatAtIndex:i];
+  }
+  NSUInteger repeatedDoubleArrayCount=self.repeatedDoubleArray.count;
+  for(NSUInteger i=0;i<repeatedDoubleArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedDoubleArray doubleAtIndex:i];
+  }
+  NSUInteger repeatedBoolArrayCount=self.repeatedBoolArray.count;
+  for(NSUInteger i=0;i<repeatedBoolArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.repeatedBoolArray boolAtIndex:i];
+  }
   for (NSString* element in self.repeatedStringArray) {
     hashCode = hashCode * 31 + [element hash];
   }
@@ -3080,21 +2637,27 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
   for (ImportMessageLite* element in self.repeatedImportMessageArray) {
     hashCode = hashCode * 31 + [element hash];
   }
-  
-    
-    for(int i=0;i<self.repeatedNestedEnumArray.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedNestedEnumArray uint32AtIndex:i];
+  const NSUInteger repeatedNestedEnumArrayCount = self.repeatedNestedEnumArray.count;
+  if (repeatedNestedEnumArrayCount > 0) {
+    const TestAllTypesLite_NestedEnum *repeatedNestedEnumArrayValues = (const TestAllTypesLite_NestedEnum *)self.repeatedNestedEnumArray.data;
+    for (NSUInteger i = 0; i < repeatedNestedEnumArrayCount; ++i) {
+      hashCode = hashCode * 31 + repeatedNestedEnumArrayValues[i];
     }
-    
-    for(int i=0;i<self.repeatedForeignEnumArray.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedForeignEnumArray uint32AtIndex:i];
+  }
+  const NSUInteger repeatedForeignEnumArrayCount = self.repeatedForeignEnumArray.count;
+  if (repeatedForeignEnumArrayCount > 0) {
+    const ForeignEnumLite *repeatedForeignEnumArrayValues = (const ForeignEnumLite *)self.repeatedForeignEnumArray.data;
+    for (NSUInteger i = 0; i < repeatedForeignEnumArrayCount; ++i) {
+      hashCode = hashCode * 31 + repeatedForeignEnumArrayValues[i];
     }
-    
-    for(int i=0;i<self.repeatedImportEnumArray.count;i++){
-        hashCode = hashCode * 31 + [self.repeatedImportEnumArray uint32AtIndex:i];
+  }
+  const NSUInteger repeatedImportEnumArrayCount = self.repeatedImportEnumArray.count;
+  if (repeatedImportEnumArrayCount > 0) {
+    const ImportEnumLite *repeatedImportEnumArrayValues = (const ImportEnumLite *)self.repeatedImportEnumArray.data;
+    for (NSUInteger i = 0; i < repeatedImportEnumArrayCount; ++i) {
+      hashCode = hashCode * 31 + repeatedImportEnumArrayValues[i];
     }
-    
-
+  }
   for (NSString* element in self.repeatedStringPieceArray) {
     hashCode = hashCode * 31 + [element hash];
   }
@@ -3102,43 +2665,43 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
     hashCode = hashCode * 31 + [element hash];
   }
   if (self.hasDefaultInt32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.defaultInt32] hash];
+    hashCode = hashCode * 31 + [@(self.defaultInt32) hash];
   }
   if (self.hasDefaultInt64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.defaultInt64] hash];
+    hashCode = hashCode * 31 + [@(self.defaultInt64) hash];
   }
   if (self.hasDefaultUint32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.defaultUint32] hash];
+    hashCode = hashCode * 31 + [@(self.defaultUint32) hash];
   }
   if (self.hasDefaultUint64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.defaultUint64] hash];
+    hashCode = hashCode * 31 + [@(self.defaultUint64) hash];
   }
   if (self.hasDefaultSint32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.defaultSint32] hash];
+    hashCode = hashCode * 31 + [@(self.defaultSint32) hash];
   }
   if (self.hasDefaultSint64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.defaultSint64] hash];
+    hashCode = hashCode * 31 + [@(self.defaultSint64) hash];
   }
   if (self.hasDefaultFixed32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.defaultFixed32] hash];
+    hashCode = hashCode * 31 + [@(self.defaultFixed32) hash];
   }
   if (self.hasDefaultFixed64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.defaultFixed64] hash];
+    hashCode = hashCode * 31 + [@(self.defaultFixed64) hash];
   }
   if (self.hasDefaultSfixed32) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.defaultSfixed32] hash];
+    hashCode = hashCode * 31 + [@(self.defaultSfixed32) hash];
   }
   if (self.hasDefaultSfixed64) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithLongLong:self.defaultSfixed64] hash];
+    hashCode = hashCode * 31 + [@(self.defaultSfixed64) hash];
   }
   if (self.hasDefaultFloat) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithFloat:self.defaultFloat] hash];
+    hashCode = hashCode * 31 + [@(self.defaultFloat) hash];
   }
   if (self.hasDefaultDouble) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithDouble:self.defaultDouble] hash];
+    hashCode = hashCode * 31 + [@(self.defaultDouble) hash];
   }
   if (self.hasDefaultBool) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithBool:self.defaultBool] hash];
+    hashCode = hashCode * 31 + [@(self.defaultBool) hash];
   }
   if (self.hasDefaultString) {
     hashCode = hashCode * 31 + [self.defaultString hash];
@@ -3164,155 +2727,458 @@ static TestAllTypesLite* defaultTestAllTypesLiteInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
-@end
-
-BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value) {
-  switch (value) {
-    case TestAllTypesLite_NestedEnumFoo:
-    case TestAllTypesLite_NestedEnumBar:
-    case TestAllTypesLite_NestedEnumBaz:
-      return YES;
-    default:
-      return NO;
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasOptionalInt32) {
+    PBJSONWriteInt32(writer, "optionalInt32", self.optionalInt32);
   }
-}
-@interface TestAllTypesLite_NestedMessage ()
-@property int32_t bb;
-@end
-
-@implementation TestAllTypesLite_NestedMessage
-
-- (BOOL) hasBb {
-  return !!hasBb_;
-}
-- (void) setHasBb:(BOOL) value {
-  hasBb_ = !!value;
-}
-@synthesize bb;
-
-- (id) init {
-  if ((self = [super init])) {
-    self.bb = 0;
+  if (self.hasOptionalInt64) {
+    PBJSONWriteInt64(writer, "optionalInt64", self.optionalInt64);
   }
-  return self;
-}
-static TestAllTypesLite_NestedMessage* defaultTestAllTypesLite_NestedMessageInstance = nil;
-+ (void) initialize {
-  if (self == [TestAllTypesLite_NestedMessage class]) {
-    defaultTestAllTypesLite_NestedMessageInstance = [[TestAllTypesLite_NestedMessage alloc] init];
+  if (self.hasOptionalUint32) {
+    PBJSONWriteUInt32(writer, "optionalUint32", self.optionalUint32);
   }
-}
-+ (TestAllTypesLite_NestedMessage*) defaultInstance {
-  return defaultTestAllTypesLite_NestedMessageInstance;
-}
-- (TestAllTypesLite_NestedMessage*) defaultInstance {
-  return defaultTestAllTypesLite_NestedMessageInstance;
-}
-- (BOOL) isInitialized {
-  return YES;
-}
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
-  if (self.hasBb) {
-    [output writeInt32:1 value:self.bb];
+  if (self.hasOptionalUint64) {
+    PBJSONWriteUInt64(writer, "optionalUint64", self.optionalUint64);
   }
-  [self.unknownFields writeToCodedOutputStream:output];
-}
-- (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  if (self.hasOptionalSint32) {
+    PBJSONWriteInt32(writer, "optionalSint32", self.optionalSint32);
   }
-
-  size = 0;
-  if (self.hasBb) {
-    size += computeInt32Size(1, self.bb);
+  if (self.hasOptionalSint64) {
+    PBJSONWriteInt64(writer, "optionalSint64", self.optionalSint64);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestAllTypesLite_NestedMessage*) parseFromData:(NSData*) data {
-  return (TestAllTypesLite_NestedMessage*)[[[TestAllTypesLite_NestedMessage builder] mergeFromData:data] build];
-}
-+ (TestAllTypesLite_NestedMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite_NestedMessage*)[[[TestAllTypesLite_NestedMessage builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestAllTypesLite_NestedMessage*) parseFromInputStream:(NSInputStream*) input {
-  return (TestAllTypesLite_NestedMessage*)[[[TestAllTypesLite_NestedMessage builder] mergeFromInputStream:input] build];
-}
-+ (TestAllTypesLite_NestedMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite_NestedMessage*)[[[TestAllTypesLite_NestedMessage builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestAllTypesLite_NestedMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestAllTypesLite_NestedMessage*)[[[TestAllTypesLite_NestedMessage builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestAllTypesLite_NestedMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite_NestedMessage*)[[[TestAllTypesLite_NestedMessage builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestAllTypesLite_NestedMessage_Builder*) builder {
-  return [[TestAllTypesLite_NestedMessage_Builder alloc] init] ;
-}
-+ (TestAllTypesLite_NestedMessage_Builder*) builderWithPrototype:(TestAllTypesLite_NestedMessage*) prototype {
-  return [[TestAllTypesLite_NestedMessage builder] mergeFrom:prototype];
-}
-- (TestAllTypesLite_NestedMessage_Builder*) builder {
-  return [TestAllTypesLite_NestedMessage builder];
-}
-- (TestAllTypesLite_NestedMessage_Builder*) toBuilder {
-  return [TestAllTypesLite_NestedMessage builderWithPrototype:self];
-}
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasBb) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"bb", [NSNumber numberWithInt:self.bb]];
+  if (self.hasOptionalFixed32) {
+    PBJSONWriteUInt32(writer, "optionalFixed32", self.optionalFixed32);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
-}
-- (BOOL) isEqual:(id)other {
-  if (other == self) {
-    return YES;
+  if (self.hasOptionalFixed64) {
+    PBJSONWriteUInt64(writer, "optionalFixed64", self.optionalFixed64);
   }
-  if (![other isKindOfClass:[TestAllTypesLite_NestedMessage class]]) {
-    return NO;
+  if (self.hasOptionalSfixed32) {
+    PBJSONWriteInt32(writer, "optionalSfixed32", self.optionalSfixed32);
   }
-  TestAllTypesLite_NestedMessage *otherMessage = other;
-  return
-      self.hasBb == otherMessage.hasBb &&
-      (!self.hasBb || self.bb == otherMessage.bb) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
-}
-- (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasBb) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.bb] hash];
+  if (self.hasOptionalSfixed64) {
+    PBJSONWriteInt64(writer, "optionalSfixed64", self.optionalSfixed64);
   }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
-}
-@end
-
-@interface TestAllTypesLite_NestedMessage_Builder()
-@property (strong) TestAllTypesLite_NestedMessage* result;
-@end
-
-@implementation TestAllTypesLite_NestedMessage_Builder
-@synthesize result;
-
-- (id) init {
-  if ((self = [super init])) {
-    self.result = [[TestAllTypesLite_NestedMessage alloc] init];
+  if (self.hasOptionalFloat) {
+    PBJSONWriteFloat(writer, "optionalFloat", self.optionalFloat);
   }
-  return self;
-}
-- (PBGeneratedMessage*) internalGetResult {
-  return result;
+  if (self.hasOptionalDouble) {
+    PBJSONWriteDouble(writer, "optionalDouble", self.optionalDouble);
+  }
+  if (self.hasOptionalBool) {
+    PBJSONWriteBool(writer, "optionalBool", self.optionalBool);
+  }
+  if (self.hasOptionalString) {
+    PBJSONWriteString(writer, "optionalString", self.optionalString);
+  }
+  if (self.hasOptionalBytes) {
+    PBJSONWriteData(writer, "optionalBytes", self.optionalBytes);
+  }
+  if (self.hasOptionalGroup) {
+    PBJSONWriteMessage(writer, "optionalgroup", self.optionalGroup);
+  }
+  if (self.hasOptionalNestedMessage) {
+    PBJSONWriteMessage(writer, "optionalNestedMessage", self.optionalNestedMessage);
+  }
+  if (self.hasOptionalForeignMessage) {
+    PBJSONWriteMessage(writer, "optionalForeignMessage", self.optionalForeignMessage);
+  }
+  if (self.hasOptionalImportMessage) {
+    PBJSONWriteMessage(writer, "optionalImportMessage", self.optionalImportMessage);
+  }
+  if (self.hasOptionalNestedEnum) {
+    TestAllTypesLite_NestedEnumWriteJSON(writer, "optionalNestedEnum", self.optionalNestedEnum);
+  }
+  if (self.hasOptionalForeignEnum) {
+    ForeignEnumLiteWriteJSON(writer, "optionalForeignEnum", self.optionalForeignEnum);
+  }
+  if (self.hasOptionalImportEnum) {
+    ImportEnumLiteWriteJSON(writer, "optionalImportEnum", self.optionalImportEnum);
+  }
+  if (self.hasOptionalStringPiece) {
+    PBJSONWriteString(writer, "optionalStringPiece", self.optionalStringPiece);
+  }
+  if (self.hasOptionalCord) {
+    PBJSONWriteString(writer, "optionalCord", self.optionalCord);
+  }
+  if (self.repeatedInt32Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedInt32");
+    NSUInteger repeatedInt32ArrayCount=self.repeatedInt32Array.count;
+    for(NSUInteger i=0;i<repeatedInt32ArrayCount;i++){
+      PBJSONWriteInt32(writer, NULL, [self.repeatedInt32Array int32AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedInt64Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedInt64");
+    NSUInteger repeatedInt64ArrayCount=self.repeatedInt64Array.count;
+    for(NSUInteger i=0;i<repeatedInt64ArrayCount;i++){
+      PBJSONWriteInt64(writer, NULL, [self.repeatedInt64Array int64AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedUint32Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedUint32");
+    NSUInteger repeatedUint32ArrayCount=self.repeatedUint32Array.count;
+    for(NSUInteger i=0;i<repeatedUint32ArrayCount;i++){
+      PBJSONWriteUInt32(writer, NULL, [self.repeatedUint32Array uint32AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedUint64Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedUint64");
+    NSUInteger repeatedUint64ArrayCount=self.repeatedUint64Array.count;
+    for(NSUInteger i=0;i<repeatedUint64ArrayCount;i++){
+      PBJSONWriteUInt64(writer, NULL, [self.repeatedUint64Array uint64AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedSint32Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedSint32");
+    NSUInteger repeatedSint32ArrayCount=self.repeatedSint32Array.count;
+    for(NSUInteger i=0;i<repeatedSint32ArrayCount;i++){
+      PBJSONWriteInt32(writer, NULL, [self.repeatedSint32Array int32AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedSint64Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedSint64");
+    NSUInteger repeatedSint64ArrayCount=self.repeatedSint64Array.count;
+    for(NSUInteger i=0;i<repeatedSint64ArrayCount;i++){
+      PBJSONWriteInt64(writer, NULL, [self.repeatedSint64Array int64AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedFixed32Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedFixed32");
+    NSUInteger repeatedFixed32ArrayCount=self.repeatedFixed32Array.count;
+    for(NSUInteger i=0;i<repeatedFixed32ArrayCount;i++){
+      PBJSONWriteUInt32(writer, NULL, [self.repeatedFixed32Array uint32AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedFixed64Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedFixed64");
+    NSUInteger repeatedFixed64ArrayCount=self.repeatedFixed64Array.count;
+    for(NSUInteger i=0;i<repeatedFixed64ArrayCount;i++){
+      PBJSONWriteUInt64(writer, NULL, [self.repeatedFixed64Array uint64AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedSfixed32Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedSfixed32");
+    NSUInteger repeatedSfixed32ArrayCount=self.repeatedSfixed32Array.count;
+    for(NSUInteger i=0;i<repeatedSfixed32ArrayCount;i++){
+      PBJSONWriteInt32(writer, NULL, [self.repeatedSfixed32Array int32AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedSfixed64Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedSfixed64");
+    NSUInteger repeatedSfixed64ArrayCount=self.repeatedSfixed64Array.count;
+    for(NSUInteger i=0;i<repeatedSfixed64ArrayCount;i++){
+      PBJSONWriteInt64(writer, NULL, [self.repeatedSfixed64Array int64AtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedFloatArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedFloat");
+    NSUInteger repeatedFloatArrayCount=self.repeatedFloatArray.count;
+    for(NSUInteger i=0;i<repeatedFloatArrayCount;i++){
+      PBJSONWriteFloat(writer, NULL, [self.repeatedFloatArray floatAtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedDoubleArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedDouble");
+    NSUInteger repeatedDoubleArrayCount=self.repeatedDoubleArray.count;
+    for(NSUInteger i=0;i<repeatedDoubleArrayCount;i++){
+      PBJSONWriteDouble(writer, NULL, [self.repeatedDoubleArray doubleAtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedBoolArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedBool");
+    NSUInteger repeatedBoolArrayCount=self.repeatedBoolArray.count;
+    for(NSUInteger i=0;i<repeatedBoolArrayCount;i++){
+      PBJSONWriteBool(writer, NULL, [self.repeatedBoolArray boolAtIndex:i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedStringArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedString");
+    for (NSString* element in self.repeatedStringArray) {
+      PBJSONWriteString(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedBytesArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedBytes");
+    for (NSData* element in self.repeatedBytesArray) {
+      PBJSONWriteData(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedGroupArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedgroup");
+    for (TestAllTypesLite_RepeatedGroup* element in self.repeatedGroupArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedNestedMessageArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedNestedMessage");
+    for (TestAllTypesLite_NestedMessage* element in self.repeatedNestedMessageArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedForeignMessageArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedForeignMessage");
+    for (ForeignMessageLite* element in self.repeatedForeignMessageArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedImportMessageArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedImportMessage");
+    for (ImportMessageLite* element in self.repeatedImportMessageArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  const NSUInteger repeatedNestedEnumArrayCount = self.repeatedNestedEnumArray.count;
+  if (repeatedNestedEnumArrayCount > 0) {
+    const TestAllTypesLite_NestedEnum *repeatedNestedEnumArrayValues = (const TestAllTypesLite_NestedEnum *)self.repeatedNestedEnumArray.data;
+    PBJSONWriterBeginArray(writer, "repeatedNestedEnum");
+    for (NSUInteger i = 0; i < repeatedNestedEnumArrayCount; ++i) {
+      TestAllTypesLite_NestedEnumWriteJSON(writer, NULL, repeatedNestedEnumArrayValues[i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  const NSUInteger repeatedForeignEnumArrayCount = self.repeatedForeignEnumArray.count;
+  if (repeatedForeignEnumArrayCount > 0) {
+    const ForeignEnumLite *repeatedForeignEnumArrayValues = (const ForeignEnumLite *)self.repeatedForeignEnumArray.data;
+    PBJSONWriterBeginArray(writer, "repeatedForeignEnum");
+    for (NSUInteger i = 0; i < repeatedForeignEnumArrayCount; ++i) {
+      ForeignEnumLiteWriteJSON(writer, NULL, repeatedForeignEnumArrayValues[i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  const NSUInteger repeatedImportEnumArrayCount = self.repeatedImportEnumArray.count;
+  if (repeatedImportEnumArrayCount > 0) {
+    const ImportEnumLite *repeatedImportEnumArrayValues = (const ImportEnumLite *)self.repeatedImportEnumArray.data;
+    PBJSONWriterBeginArray(writer, "repeatedImportEnum");
+    for (NSUInteger i = 0; i < repeatedImportEnumArrayCount; ++i) {
+      ImportEnumLiteWriteJSON(writer, NULL, repeatedImportEnumArrayValues[i]);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedStringPieceArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedStringPiece");
+    for (NSString* element in self.repeatedStringPieceArray) {
+      PBJSONWriteString(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.repeatedCordArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "repeatedCord");
+    for (NSString* element in self.repeatedCordArray) {
+      PBJSONWriteString(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.hasDefaultInt32) {
+    PBJSONWriteInt32(writer, "defaultInt32", self.defaultInt32);
+  }
+  if (self.hasDefaultInt64) {
+    PBJSONWriteInt64(writer, "defaultInt64", self.defaultInt64);
+  }
+  if (self.hasDefaultUint32) {
+    PBJSONWriteUInt32(writer, "defaultUint32", self.defaultUint32);
+  }
+  if (self.hasDefaultUint64) {
+    PBJSONWriteUInt64(writer, "defaultUint64", self.defaultUint64);
+  }
+  if (self.hasDefaultSint32) {
+    PBJSONWriteInt32(writer, "defaultSint32", self.defaultSint32);
+  }
+  if (self.hasDefaultSint64) {
+    PBJSONWriteInt64(writer, "defaultSint64", self.defaultSint64);
+  }
+  if (self.hasDefaultFixed32) {
+    PBJSONWriteUInt32(writer, "defaultFixed32", self.defaultFixed32);
+  }
+  if (self.hasDefaultFixed64) {
+    PBJSONWriteUInt64(writer, "defaultFixed64", self.defaultFixed64);
+  }
+  if (self.hasDefaultSfixed32) {
+    PBJSONWriteInt32(writer, "defaultSfixed32", self.defaultSfixed32);
+  }
+  if (self.hasDefaultSfixed64) {
+    PBJSONWriteInt64(writer, "defaultSfixed64", self.defaultSfixed64);
+  }
+  if (self.hasDefaultFloat) {
+    PBJSONWriteFloat(writer, "defaultFloat", self.defaultFloat);
+  }
+  if (self.hasDefaultDouble) {
+    PBJSONWriteDouble(writer, "defaultDouble", self.defaultDouble);
+  }
+  if (self.hasDefaultBool) {
+    PBJSONWriteBool(writer, "defaultBool", self.defaultBool);
+  }
+  if (self.hasDefaultString) {
+    PBJSONWriteString(writer, "defaultString", self.defaultString);
+  }
+  if (self.hasDefaultBytes) {
+    PBJSONWriteData(writer, "defaultBytes", self.defaultBytes);
+  }
+  if (self.hasDefaultNestedEnum) {
+    TestAllTypesLite_NestedEnumWriteJSON(writer, "defaultNestedEnum", self.defaultNestedEnum);
+  }
+  if (self.hasDefaultForeignEnum) {
+    ForeignEnumLiteWriteJSON(writer, "defaultForeignEnum", self.defaultForeignEnum);
+  }
+  if (self.hasDefaultImportEnum) {
+    ImportEnumLiteWriteJSON(writer, "defaultImportEnum", self.defaultImportEnum);
+  }
+  if (self.hasDefaultStringPiece) {
+    PBJSONWriteString(writer, "defaultStringPiece", self.defaultStringPiece);
+  }
+  if (self.hasDefaultCord) {
+    PBJSONWriteString(writer, "defaultCord", self.defaultCord);
+  }
+}
+@end
+
+BOOL TestAllTypesLite_NestedEnumIsValidValue(TestAllTypesLite_NestedEnum value) {
+  return (uint32_t)value - 1U < 3U;
+}
+static const char* const TestAllTypesLite_NestedEnumTextFormatNames[] = {
+  "FOO",
+  "BAR",
+  "BAZ",
+};
+static const int32_t TestAllTypesLite_NestedEnumTextFormatValues[] = {
+  1,
+  2,
+  3,
+};
+TestAllTypesLite_NestedEnum TestAllTypesLite_NestedEnumReadTextFormat(PBTextFormatReader* reader) {
+  return (TestAllTypesLite_NestedEnum)PBTextFormatReaderReadEnum(reader, TestAllTypesLite_NestedEnumTextFormatNames, TestAllTypesLite_NestedEnumTextFormatValues, 3);
+}
+void TestAllTypesLite_NestedEnumWriteJSON(PBJSONWriter* writer, const char* name, TestAllTypesLite_NestedEnum value) {
+  PBJSONWriteEnum(writer, name, value, TestAllTypesLite_NestedEnumTextFormatNames, TestAllTypesLite_NestedEnumTextFormatValues, 3);
+}
+TestAllTypesLite_NestedEnum TestAllTypesLite_NestedEnumReadJSON(PBJSONReader* reader) {
+  return (TestAllTypesLite_NestedEnum)PBJSONReaderReadEnum(reader, TestAllTypesLite_NestedEnumTextFormatNames, TestAllTypesLite_NestedEnumTextFormatValues, 3);
 }
-- (TestAllTypesLite_NestedMessage_Builder*) clear {
-  self.result = [[TestAllTypesLite_NestedMessage alloc] init];
+@interface TestAllTypesLite_NestedMessage ()
+@property (nonatomic, readwrite) BOOL hasBb;
+@property (nonatomic, readwrite) int32_t bb;
+@end
+
+@implementation TestAllTypesLite_NestedMessage
+
+- (id) init {
+  if ((self = [super init])) {
+    self.bb = 0;
+  }
   return self;
 }
-- (TestAllTypesLite_NestedMessage_Builder*) clone {
-  return [TestAllTypesLite_NestedMessage builderWithPrototype:result];
++ (TestAllTypesLite_NestedMessage*) defaultInstance {
+  static TestAllTypesLite_NestedMessage* defaultTestAllTypesLite_NestedMessageInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestAllTypesLite_NestedMessageInstance = [[TestAllTypesLite_NestedMessage alloc] init];
+  });
+  return defaultTestAllTypesLite_NestedMessageInstance;
+}
+- (TestAllTypesLite_NestedMessage*) defaultInstance {
+  return [TestAllTypesLite_NestedMessage defaultInstance];
+}
+- (BOOL) isInitialized {
+  return YES;
+}
+- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
+  if (self.hasBb) {
+    [output writeInt32:1 value:self.bb];
+  }
+  [self.unknownFields writeToCodedOutputStream:output];
+}
+- (int32_t) serializedSize {
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
+  }
+
+  size_ = 0;
+  if (self.hasBb) {
+    size_ += computeInt32Size(1, self.bb);
+  }
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
+}
++ (TestAllTypesLite_NestedMessage_Builder*) builder {
+  return [[TestAllTypesLite_NestedMessage_Builder alloc] init];
+}
++ (TestAllTypesLite_NestedMessage_Builder*) builderWithPrototype:(TestAllTypesLite_NestedMessage*) prototype {
+  return [[TestAllTypesLite_NestedMessage builder] mergeFrom:prototype];
+}
+- (TestAllTypesLite_NestedMessage_Builder*) builder {
+  return [TestAllTypesLite_NestedMessage builder];
+}
+- (TestAllTypesLite_NestedMessage_Builder*) toBuilder {
+  return [TestAllTypesLite_NestedMessage builderWithPrototype:self];
+}
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  if (self.hasBb) {
+    PBTextFormatWriteInt32(writer, "bb", self.bb);
+  }
+  [self.unknownFields writeTextFormatTo:writer];
+}
+- (BOOL) isEqual:(id)other {
+  if (other == self) {
+    return YES;
+  }
+  if (![other isKindOfClass:[TestAllTypesLite_NestedMessage class]]) {
+    return NO;
+  }
+  TestAllTypesLite_NestedMessage *otherMessage = other;
+  return
+      self.hasBb == otherMessage.hasBb &&
+      (!self.hasBb || self.bb == otherMessage.bb) &&
+      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+}
+- (NSUInteger) hash {
+  NSUInteger hashCode = 7;
+  if (self.hasBb) {
+    hashCode = hashCode * 31 + [@(self.bb) hash];
+  }
+  hashCode = hashCode * 31 + [self.unknownFields hash];
+  return hashCode;
+}
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasBb) {
+    PBJSONWriteInt32(writer, "bb", self.bb);
+  }
+}
+@end
+
+@interface TestAllTypesLite_NestedMessage_Builder()
+@property (strong) TestAllTypesLite_NestedMessage* builder_result;
+@end
+
+@implementation TestAllTypesLite_NestedMessage_Builder
+@synthesize builder_result;
+- (id) init {
+  if ((self = [super init])) {
+    self.builder_result = [[TestAllTypesLite_NestedMessage alloc] init];
+  }
+  return self;
+}
+- (PBGeneratedMessage*) internalGetResult {
+  return builder_result;
 }
 - (TestAllTypesLite_NestedMessage*) defaultInstance {
   return [TestAllTypesLite_NestedMessage defaultInstance];
@@ -3322,8 +3188,8 @@ static TestAllTypesLite_NestedMessage* defaultTestAllTypesLite_NestedMessageInst
   return [self buildPartial];
 }
 - (TestAllTypesLite_NestedMessage*) buildPartial {
-  TestAllTypesLite_NestedMessage* returnMe = result;
-  self.result = nil;
+  TestAllTypesLite_NestedMessage* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestAllTypesLite_NestedMessage_Builder*) mergeFrom:(TestAllTypesLite_NestedMessage*) other {
@@ -3336,9 +3202,6 @@ static TestAllTypesLite_NestedMessage* defaultTestAllTypesLite_NestedMessageInst
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestAllTypesLite_NestedMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestAllTypesLite_NestedMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -3361,55 +3224,88 @@ static TestAllTypesLite_NestedMessage* defaultTestAllTypesLite_NestedMessageInst
     }
   }
 }
-- (BOOL) hasBb {
-  return result.hasBb;
+- (TestAllTypesLite_NestedMessage_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 2:
+        if (memcmp(name, "bb", 2) == 0) {
+          [self setBb:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) bb {
-  return result.bb;
+- (TestAllTypesLite_NestedMessage_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 2:
+        if (memcmp(name, "bb", 2) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setBb:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestAllTypesLite_NestedMessage_Builder*) setBb:(int32_t) value {
-  result.hasBb = YES;
-  result.bb = value;
+  builder_result.hasBb = YES;
+  builder_result.bb = value;
   return self;
 }
-- (TestAllTypesLite_NestedMessage_Builder*) clearBb {
-  result.hasBb = NO;
-  result.bb = 0;
+- (int32_t) bb {
+  return builder_result.bb;
+}
+- (BOOL)hasBb {
+ return builder_result.hasBb;
+}
+- (TestAllTypesLite_NestedMessage_Builder*)clearBb {
+  builder_result.hasBb = NO;
+  builder_result.bb = 0;
   return self;
 }
 @end
 
 @interface TestAllTypesLite_OptionalGroup ()
-@property int32_t a;
+@property (nonatomic, readwrite) BOOL hasA;
+@property (nonatomic, readwrite) int32_t a;
 @end
 
 @implementation TestAllTypesLite_OptionalGroup
 
-- (BOOL) hasA {
-  return !!hasA_;
-}
-- (void) setHasA:(BOOL) value {
-  hasA_ = !!value;
-}
-@synthesize a;
-
 - (id) init {
   if ((self = [super init])) {
     self.a = 0;
   }
   return self;
 }
-static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInstance = nil;
-+ (void) initialize {
-  if (self == [TestAllTypesLite_OptionalGroup class]) {
-    defaultTestAllTypesLite_OptionalGroupInstance = [[TestAllTypesLite_OptionalGroup alloc] init];
-  }
-}
 + (TestAllTypesLite_OptionalGroup*) defaultInstance {
+  static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestAllTypesLite_OptionalGroupInstance = [[TestAllTypesLite_OptionalGroup alloc] init];
+  });
   return defaultTestAllTypesLite_OptionalGroupInstance;
 }
 - (TestAllTypesLite_OptionalGroup*) defaultInstance {
-  return defaultTestAllTypesLite_OptionalGroupInstance;
+  return [TestAllTypesLite_OptionalGroup defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -3421,36 +3317,18 @@ static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInst
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasA) {
-    size += computeInt32Size(17, self.a);
+    size_ += computeInt32Size(17, self.a);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestAllTypesLite_OptionalGroup*) parseFromData:(NSData*) data {
-  return (TestAllTypesLite_OptionalGroup*)[[[TestAllTypesLite_OptionalGroup builder] mergeFromData:data] build];
-}
-+ (TestAllTypesLite_OptionalGroup*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite_OptionalGroup*)[[[TestAllTypesLite_OptionalGroup builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestAllTypesLite_OptionalGroup*) parseFromInputStream:(NSInputStream*) input {
-  return (TestAllTypesLite_OptionalGroup*)[[[TestAllTypesLite_OptionalGroup builder] mergeFromInputStream:input] build];
-}
-+ (TestAllTypesLite_OptionalGroup*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite_OptionalGroup*)[[[TestAllTypesLite_OptionalGroup builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestAllTypesLite_OptionalGroup*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestAllTypesLite_OptionalGroup*)[[[TestAllTypesLite_OptionalGroup builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestAllTypesLite_OptionalGroup*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite_OptionalGroup*)[[[TestAllTypesLite_OptionalGroup builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestAllTypesLite_OptionalGroup_Builder*) builder {
   return [[TestAllTypesLite_OptionalGroup_Builder alloc] init];
@@ -3464,11 +3342,11 @@ static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInst
 - (TestAllTypesLite_OptionalGroup_Builder*) toBuilder {
   return [TestAllTypesLite_OptionalGroup builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasA) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"a", [NSNumber numberWithInt:self.a]];
+    PBTextFormatWriteInt32(writer, "a", self.a);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -3481,41 +3359,37 @@ static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInst
   return
       self.hasA == otherMessage.hasA &&
       (!self.hasA || self.a == otherMessage.a) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasA) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.a] hash];
+    hashCode = hashCode * 31 + [@(self.a) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasA) {
+    PBJSONWriteInt32(writer, "a", self.a);
+  }
+}
 @end
 
 @interface TestAllTypesLite_OptionalGroup_Builder()
-@property (strong) TestAllTypesLite_OptionalGroup* result;
+@property (strong) TestAllTypesLite_OptionalGroup* builder_result;
 @end
 
 @implementation TestAllTypesLite_OptionalGroup_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestAllTypesLite_OptionalGroup alloc] init];
+    self.builder_result = [[TestAllTypesLite_OptionalGroup alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestAllTypesLite_OptionalGroup_Builder*) clear {
-  self.result = [[TestAllTypesLite_OptionalGroup alloc] init];
-  return self;
-}
-- (TestAllTypesLite_OptionalGroup_Builder*) clone {
-  return [TestAllTypesLite_OptionalGroup builderWithPrototype:result];
+  return builder_result;
 }
 - (TestAllTypesLite_OptionalGroup*) defaultInstance {
   return [TestAllTypesLite_OptionalGroup defaultInstance];
@@ -3525,8 +3399,8 @@ static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInst
   return [self buildPartial];
 }
 - (TestAllTypesLite_OptionalGroup*) buildPartial {
-  TestAllTypesLite_OptionalGroup* returnMe = result;
-  self.result = nil;
+  TestAllTypesLite_OptionalGroup* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestAllTypesLite_OptionalGroup_Builder*) mergeFrom:(TestAllTypesLite_OptionalGroup*) other {
@@ -3539,9 +3413,6 @@ static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInst
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestAllTypesLite_OptionalGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestAllTypesLite_OptionalGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -3564,55 +3435,88 @@ static TestAllTypesLite_OptionalGroup* defaultTestAllTypesLite_OptionalGroupInst
     }
   }
 }
-- (BOOL) hasA {
-  return result.hasA;
+- (TestAllTypesLite_OptionalGroup_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 1:
+        if (memcmp(name, "a", 1) == 0) {
+          [self setA:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) a {
-  return result.a;
+- (TestAllTypesLite_OptionalGroup_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 1:
+        if (memcmp(name, "a", 1) == 0) {
+          number = 17;
+        }
+        break;
+    }
+    switch (number) {
+      case 17: {
+        [self setA:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestAllTypesLite_OptionalGroup_Builder*) setA:(int32_t) value {
-  result.hasA = YES;
-  result.a = value;
+  builder_result.hasA = YES;
+  builder_result.a = value;
   return self;
 }
-- (TestAllTypesLite_OptionalGroup_Builder*) clearA {
-  result.hasA = NO;
-  result.a = 0;
+- (int32_t) a {
+  return builder_result.a;
+}
+- (BOOL)hasA {
+ return builder_result.hasA;
+}
+- (TestAllTypesLite_OptionalGroup_Builder*)clearA {
+  builder_result.hasA = NO;
+  builder_result.a = 0;
   return self;
 }
 @end
 
 @interface TestAllTypesLite_RepeatedGroup ()
-@property int32_t a;
+@property (nonatomic, readwrite) BOOL hasA;
+@property (nonatomic, readwrite) int32_t a;
 @end
 
 @implementation TestAllTypesLite_RepeatedGroup
 
-- (BOOL) hasA {
-  return !!hasA_;
-}
-- (void) setHasA:(BOOL) value {
-  hasA_ = !!value;
-}
-@synthesize a;
-
 - (id) init {
   if ((self = [super init])) {
     self.a = 0;
   }
   return self;
 }
-static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInstance = nil;
-+ (void) initialize {
-  if (self == [TestAllTypesLite_RepeatedGroup class]) {
-    defaultTestAllTypesLite_RepeatedGroupInstance = [[TestAllTypesLite_RepeatedGroup alloc] init];
-  }
-}
 + (TestAllTypesLite_RepeatedGroup*) defaultInstance {
+  static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestAllTypesLite_RepeatedGroupInstance = [[TestAllTypesLite_RepeatedGroup alloc] init];
+  });
   return defaultTestAllTypesLite_RepeatedGroupInstance;
 }
 - (TestAllTypesLite_RepeatedGroup*) defaultInstance {
-  return defaultTestAllTypesLite_RepeatedGroupInstance;
+  return [TestAllTypesLite_RepeatedGroup defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -3624,36 +3528,18 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasA) {
-    size += computeInt32Size(47, self.a);
+    size_ += computeInt32Size(47, self.a);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestAllTypesLite_RepeatedGroup*) parseFromData:(NSData*) data {
-  return (TestAllTypesLite_RepeatedGroup*)[[[TestAllTypesLite_RepeatedGroup builder] mergeFromData:data] build];
-}
-+ (TestAllTypesLite_RepeatedGroup*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite_RepeatedGroup*)[[[TestAllTypesLite_RepeatedGroup builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestAllTypesLite_RepeatedGroup*) parseFromInputStream:(NSInputStream*) input {
-  return (TestAllTypesLite_RepeatedGroup*)[[[TestAllTypesLite_RepeatedGroup builder] mergeFromInputStream:input] build];
-}
-+ (TestAllTypesLite_RepeatedGroup*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite_RepeatedGroup*)[[[TestAllTypesLite_RepeatedGroup builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestAllTypesLite_RepeatedGroup*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestAllTypesLite_RepeatedGroup*)[[[TestAllTypesLite_RepeatedGroup builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestAllTypesLite_RepeatedGroup*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllTypesLite_RepeatedGroup*)[[[TestAllTypesLite_RepeatedGroup builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestAllTypesLite_RepeatedGroup_Builder*) builder {
   return [[TestAllTypesLite_RepeatedGroup_Builder alloc] init];
@@ -3667,11 +3553,11 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
 - (TestAllTypesLite_RepeatedGroup_Builder*) toBuilder {
   return [TestAllTypesLite_RepeatedGroup builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasA) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"a", [NSNumber numberWithInt:self.a]];
+    PBTextFormatWriteInt32(writer, "a", self.a);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -3684,41 +3570,37 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   return
       self.hasA == otherMessage.hasA &&
       (!self.hasA || self.a == otherMessage.a) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasA) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.a] hash];
+    hashCode = hashCode * 31 + [@(self.a) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasA) {
+    PBJSONWriteInt32(writer, "a", self.a);
+  }
+}
 @end
 
 @interface TestAllTypesLite_RepeatedGroup_Builder()
-@property (strong) TestAllTypesLite_RepeatedGroup* result;
+@property (strong) TestAllTypesLite_RepeatedGroup* builder_result;
 @end
 
 @implementation TestAllTypesLite_RepeatedGroup_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestAllTypesLite_RepeatedGroup alloc] init];
+    self.builder_result = [[TestAllTypesLite_RepeatedGroup alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestAllTypesLite_RepeatedGroup_Builder*) clear {
-  self.result = [[TestAllTypesLite_RepeatedGroup alloc] init];
-  return self;
-}
-- (TestAllTypesLite_RepeatedGroup_Builder*) clone {
-  return [TestAllTypesLite_RepeatedGroup builderWithPrototype:result];
+  return builder_result;
 }
 - (TestAllTypesLite_RepeatedGroup*) defaultInstance {
   return [TestAllTypesLite_RepeatedGroup defaultInstance];
@@ -3728,8 +3610,8 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   return [self buildPartial];
 }
 - (TestAllTypesLite_RepeatedGroup*) buildPartial {
-  TestAllTypesLite_RepeatedGroup* returnMe = result;
-  self.result = nil;
+  TestAllTypesLite_RepeatedGroup* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestAllTypesLite_RepeatedGroup_Builder*) mergeFrom:(TestAllTypesLite_RepeatedGroup*) other {
@@ -3742,9 +3624,6 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestAllTypesLite_RepeatedGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestAllTypesLite_RepeatedGroup_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -3767,46 +3646,79 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
     }
   }
 }
-- (BOOL) hasA {
-  return result.hasA;
+- (TestAllTypesLite_RepeatedGroup_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 1:
+        if (memcmp(name, "a", 1) == 0) {
+          [self setA:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) a {
-  return result.a;
+- (TestAllTypesLite_RepeatedGroup_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 1:
+        if (memcmp(name, "a", 1) == 0) {
+          number = 47;
+        }
+        break;
+    }
+    switch (number) {
+      case 47: {
+        [self setA:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestAllTypesLite_RepeatedGroup_Builder*) setA:(int32_t) value {
-  result.hasA = YES;
-  result.a = value;
+  builder_result.hasA = YES;
+  builder_result.a = value;
   return self;
 }
-- (TestAllTypesLite_RepeatedGroup_Builder*) clearA {
-  result.hasA = NO;
-  result.a = 0;
+- (int32_t) a {
+  return builder_result.a;
+}
+- (BOOL)hasA {
+ return builder_result.hasA;
+}
+- (TestAllTypesLite_RepeatedGroup_Builder*)clearA {
+  builder_result.hasA = NO;
+  builder_result.a = 0;
   return self;
 }
 @end
 
 @interface TestAllTypesLite_Builder()
-@property (strong) TestAllTypesLite* result;
+@property (strong) TestAllTypesLite* builder_result;
 @end
 
 @implementation TestAllTypesLite_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestAllTypesLite alloc] init];
+    self.builder_result = [[TestAllTypesLite alloc] init];
   }
   return self;
 }
-- (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestAllTypesLite_Builder*) clear {
-  self.result = [[TestAllTypesLite alloc] init];
-  return self;
-}
-- (TestAllTypesLite_Builder*) clone {
-  return [TestAllTypesLite builderWithPrototype:result];
+- (PBGeneratedMessage*) internalGetResult {
+  return builder_result;
 }
 - (TestAllTypesLite*) defaultInstance {
   return [TestAllTypesLite defaultInstance];
@@ -3816,8 +3728,8 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   return [self buildPartial];
 }
 - (TestAllTypesLite*) buildPartial {
-  TestAllTypesLite* returnMe = result;
-  self.result = nil;
+  TestAllTypesLite* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestAllTypesLite_Builder*) mergeFrom:(TestAllTypesLite*) other {
@@ -3897,172 +3809,76 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
     [self setOptionalCord:other.optionalCord];
   }
   if (other.repeatedInt32Array.count > 0) {
-    if (result.repeatedInt32Array == nil) {
-      result.repeatedInt32Array = [other.repeatedInt32Array copy];
-    } else {
-      [result.repeatedInt32Array appendArray:other.repeatedInt32Array];
-    }
+    builder_result.repeatedInt32Array = [other.repeatedInt32Array copy];
   }
   if (other.repeatedInt64Array.count > 0) {
-    if (result.repeatedInt64Array == nil) {
-      result.repeatedInt64Array = [other.repeatedInt64Array copy];
-    } else {
-      [result.repeatedInt64Array appendArray:other.repeatedInt64Array];
-    }
+    builder_result.repeatedInt64Array = [other.repeatedInt64Array copy];
   }
   if (other.repeatedUint32Array.count > 0) {
-    if (result.repeatedUint32Array == nil) {
-      result.repeatedUint32Array = [other.repeatedUint32Array copy];
-    } else {
-      [result.repeatedUint32Array appendArray:other.repeatedUint32Array];
-    }
+    builder_result.repeatedUint32Array = [other.repeatedUint32Array copy];
   }
   if (other.repeatedUint64Array.count > 0) {
-    if (result.repeatedUint64Array == nil) {
-      result.repeatedUint64Array = [other.repeatedUint64Array copy];
-    } else {
-      [result.repeatedUint64Array appendArray:other.repeatedUint64Array];
-    }
+    builder_result.repeatedUint64Array = [other.repeatedUint64Array copy];
   }
   if (other.repeatedSint32Array.count > 0) {
-    if (result.repeatedSint32Array == nil) {
-      result.repeatedSint32Array = [other.repeatedSint32Array copy];
-    } else {
-      [result.repeatedSint32Array appendArray:other.repeatedSint32Array];
-    }
+    builder_result.repeatedSint32Array = [other.repeatedSint32Array copy];
   }
   if (other.repeatedSint64Array.count > 0) {
-    if (result.repeatedSint64Array == nil) {
-      result.repeatedSint64Array = [other.repeatedSint64Array copy];
-    } else {
-      [result.repeatedSint64Array appendArray:other.repeatedSint64Array];
-    }
+    builder_result.repeatedSint64Array = [other.repeatedSint64Array copy];
   }
   if (other.repeatedFixed32Array.count > 0) {
-    if (result.repeatedFixed32Array == nil) {
-      result.repeatedFixed32Array = [other.repeatedFixed32Array copy];
-    } else {
-      [result.repeatedFixed32Array appendArray:other.repeatedFixed32Array];
-    }
+    builder_result.repeatedFixed32Array = [other.repeatedFixed32Array copy];
   }
   if (other.repeatedFixed64Array.count > 0) {
-    if (result.repeatedFixed64Array == nil) {
-      result.repeatedFixed64Array = [other.repeatedFixed64Array copy];
-    } else {
-      [result.repeatedFixed64Array appendArray:other.repeatedFixed64Array];
-    }
+    builder_result.repeatedFixed64Array = [other.repeatedFixed64Array copy];
   }
   if (other.repeatedSfixed32Array.count > 0) {
-    if (result.repeatedSfixed32Array == nil) {
-      result.repeatedSfixed32Array = [other.repeatedSfixed32Array copy];
-    } else {
-      [result.repeatedSfixed32Array appendArray:other.repeatedSfixed32Array];
-    }
+    builder_result.repeatedSfixed32Array = [other.repeatedSfixed32Array copy];
   }
   if (other.repeatedSfixed64Array.count > 0) {
-    if (result.repeatedSfixed64Array == nil) {
-      result.repeatedSfixed64Array = [other.repeatedSfixed64Array copy];
-    } else {
-      [result.repeatedSfixed64Array appendArray:other.repeatedSfixed64Array];
-    }
+    builder_result.repeatedSfixed64Array = [other.repeatedSfixed64Array copy];
   }
   if (other.repeatedFloatArray.count > 0) {
-    if (result.repeatedFloatArray == nil) {
-      result.repeatedFloatArray = [other.repeatedFloatArray copy];
-    } else {
-      [result.repeatedFloatArray appendArray:other.repeatedFloatArray];
-    }
+    builder_result.repeatedFloatArray = [other.repeatedFloatArray copy];
   }
   if (other.repeatedDoubleArray.count > 0) {
-    if (result.repeatedDoubleArray == nil) {
-      result.repeatedDoubleArray = [other.repeatedDoubleArray copy];
-    } else {
-      [result.repeatedDoubleArray appendArray:other.repeatedDoubleArray];
-    }
+    builder_result.repeatedDoubleArray = [other.repeatedDoubleArray copy];
   }
   if (other.repeatedBoolArray.count > 0) {
-    if (result.repeatedBoolArray == nil) {
-      result.repeatedBoolArray = [other.repeatedBoolArray copy];
-    } else {
-      [result.repeatedBoolArray appendArray:other.repeatedBoolArray];
-    }
+    builder_result.repeatedBoolArray = [other.repeatedBoolArray copy];
   }
   if (other.repeatedStringArray.count > 0) {
-    if (result.repeatedStringArray == nil) {
-      result.repeatedStringArray = [other.repeatedStringArray copy];
-    } else {
-      [result.repeatedStringArray addObjectsFromArray:other.repeatedStringArray];
-    }
+    builder_result.repeatedStringArray = [[NSMutableArray alloc] initWithArray:other.repeatedStringArray];
   }
   if (other.repeatedBytesArray.count > 0) {
-    if (result.repeatedBytesArray == nil) {
-      result.repeatedBytesArray = [other.repeatedBytesArray copy];
-    } else {
-      [result.repeatedBytesArray addObjectsFromArray:other.repeatedBytesArray];
-    }
+    builder_result.repeatedBytesArray = [[NSMutableArray alloc] initWithArray:other.repeatedBytesArray];
   }
   if (other.repeatedGroupArray.count > 0) {
-    if (result.repeatedGroupArray == nil) {
-      result.repeatedGroupArray = [other.repeatedGroupArray copy];
-    } else {
-      [result.repeatedGroupArray addObjectsFromArray:other.repeatedGroupArray];
-    }
+    builder_result.repeatedGroupArray = [[NSMutableArray alloc] initWithArray:other.repeatedGroupArray];
   }
   if (other.repeatedNestedMessageArray.count > 0) {
-    if (result.repeatedNestedMessageArray == nil) {
-      result.repeatedNestedMessageArray = [other.repeatedNestedMessageArray copy];
-    } else {
-      [result.repeatedNestedMessageArray addObjectsFromArray:other.repeatedNestedMessageArray];
-    }
+    builder_result.repeatedNestedMessageArray = [[NSMutableArray alloc] initWithArray:other.repeatedNestedMessageArray];
   }
   if (other.repeatedForeignMessageArray.count > 0) {
-    if (result.repeatedForeignMessageArray == nil) {
-      result.repeatedForeignMessageArray = [other.repeatedForeignMessageArray copy];
-    } else {
-      [result.repeatedForeignMessageArray addObjectsFromArray:other.repeatedForeignMessageArray];
-    }
+    builder_result.repeatedForeignMessageArray = [[NSMutableArray alloc] initWithArray:other.repeatedForeignMessageArray];
   }
   if (other.repeatedImportMessageArray.count > 0) {
-    if (result.repeatedImportMessageArray == nil) {
-      result.repeatedImportMessageArray = [other.repeatedImportMessageArray copy];
-    } else {
-      [result.repeatedImportMessageArray addObjectsFromArray:other.repeatedImportMessageArray];
-    }
+    builder_result.repeatedImportMessageArray = [[NSMutableArray alloc] initWithArray:other.repeatedImportMessageArray];
   }
   if (other.repeatedNestedEnumArray.count > 0) {
-    if (result.repeatedNestedEnumArray == nil) {
-      result.repeatedNestedEnumArray = [other.repeatedNestedEnumArray copy];
-    } else {
-      [result.repeatedNestedEnumArray appendArray:other.repeatedNestedEnumArray];
-    }
+    builder_result.repeatedNestedEnumArray = [other.repeatedNestedEnumArray copy];
   }
   if (other.repeatedForeignEnumArray.count > 0) {
-    if (result.repeatedForeignEnumArray == nil) {
-      result.repeatedForeignEnumArray = [other.repeatedForeignEnumArray copy];
-    } else {
-      [result.repeatedForeignEnumArray appendArray:other.repeatedForeignEnumArray];
-    }
+    builder_result.repeatedForeignEnumArray = [other.repeatedForeignEnumArray copy];
   }
   if (other.repeatedImportEnumArray.count > 0) {
-    if (result.repeatedImportEnumArray == nil) {
-      result.repeatedImportEnumArray = [other.repeatedImportEnumArray copy];
-    } else {
-      [result.repeatedImportEnumArray appendArray:other.repeatedImportEnumArray];
-    }
+    builder_result.repeatedImportEnumArray = [other.repeatedImportEnumArray copy];
   }
   if (other.repeatedStringPieceArray.count > 0) {
-    if (result.repeatedStringPieceArray == nil) {
-      result.repeatedStringPieceArray = [other.repeatedStringPieceArray copy];
-    } else {
-      [result.repeatedStringPieceArray addObjectsFromArray:other.repeatedStringPieceArray];
-    }
+    builder_result.repeatedStringPieceArray = [[NSMutableArray alloc] initWithArray:other.repeatedStringPieceArray];
   }
   if (other.repeatedCordArray.count > 0) {
-    if (result.repeatedCordArray == nil) {
-      result.repeatedCordArray = [other.repeatedCordArray copy];
-    } else {
-      [result.repeatedCordArray addObjectsFromArray:other.repeatedCordArray];
-    }
+    builder_result.repeatedCordArray = [[NSMutableArray alloc] initWithArray:other.repeatedCordArray];
   }
   if (other.hasDefaultInt32) {
     [self setDefaultInt32:other.defaultInt32];
@@ -4127,9 +3943,6 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestAllTypesLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestAllTypesLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -4207,8 +4020,8 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
       }
       case 131: {
         TestAllTypesLite_OptionalGroup_Builder* subBuilder = [TestAllTypesLite_OptionalGroup builder];
-        if (self.hasOptionalGroup) {
-          [subBuilder mergeFrom:self.optionalGroup];
+        if (self.builder_result.hasOptionalGroup) {
+          [subBuilder mergeFrom:self.builder_result.optionalGroup];
         }
         [input readGroup:16 builder:subBuilder extensionRegistry:extensionRegistry];
         [self setOptionalGroup:[subBuilder buildPartial]];
@@ -4216,8 +4029,8 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
       }
       case 146: {
         TestAllTypesLite_NestedMessage_Builder* subBuilder = [TestAllTypesLite_NestedMessage builder];
-        if (self.hasOptionalNestedMessage) {
-          [subBuilder mergeFrom:self.optionalNestedMessage];
+        if (self.builder_result.hasOptionalNestedMessage) {
+          [subBuilder mergeFrom:self.builder_result.optionalNestedMessage];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setOptionalNestedMessage:[subBuilder buildPartial]];
@@ -4225,8 +4038,8 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
       }
       case 154: {
         ForeignMessageLite_Builder* subBuilder = [ForeignMessageLite builder];
-        if (self.hasOptionalForeignMessage) {
-          [subBuilder mergeFrom:self.optionalForeignMessage];
+        if (self.builder_result.hasOptionalForeignMessage) {
+          [subBuilder mergeFrom:self.builder_result.optionalForeignMessage];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setOptionalForeignMessage:[subBuilder buildPartial]];
@@ -4234,15 +4047,15 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
       }
       case 162: {
         ImportMessageLite_Builder* subBuilder = [ImportMessageLite builder];
-        if (self.hasOptionalImportMessage) {
-          [subBuilder mergeFrom:self.optionalImportMessage];
+        if (self.builder_result.hasOptionalImportMessage) {
+          [subBuilder mergeFrom:self.builder_result.optionalImportMessage];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setOptionalImportMessage:[subBuilder buildPartial]];
         break;
       }
       case 168: {
-        int32_t value = [input readEnum];
+        TestAllTypesLite_NestedEnum value = (TestAllTypesLite_NestedEnum)[input readEnum];
         if (TestAllTypesLite_NestedEnumIsValidValue(value)) {
           [self setOptionalNestedEnum:value];
         } else {
@@ -4251,7 +4064,7 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         break;
       }
       case 176: {
-        int32_t value = [input readEnum];
+        ForeignEnumLite value = (ForeignEnumLite)[input readEnum];
         if (ForeignEnumLiteIsValidValue(value)) {
           [self setOptionalForeignEnum:value];
         } else {
@@ -4260,7 +4073,7 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         break;
       }
       case 184: {
-        int32_t value = [input readEnum];
+        ImportEnumLite value = (ImportEnumLite)[input readEnum];
         if (ImportEnumLiteIsValidValue(value)) {
           [self setOptionalImportEnum:value];
         } else {
@@ -4361,7 +4174,7 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         break;
       }
       case 408: {
-        int32_t value = [input readEnum];
+        TestAllTypesLite_NestedEnum value = (TestAllTypesLite_NestedEnum)[input readEnum];
         if (TestAllTypesLite_NestedEnumIsValidValue(value)) {
           [self addRepeatedNestedEnum:value];
         } else {
@@ -4370,7 +4183,7 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         break;
       }
       case 416: {
-        int32_t value = [input readEnum];
+        ForeignEnumLite value = (ForeignEnumLite)[input readEnum];
         if (ForeignEnumLiteIsValidValue(value)) {
           [self addRepeatedForeignEnum:value];
         } else {
@@ -4379,7 +4192,7 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         break;
       }
       case 424: {
-        int32_t value = [input readEnum];
+        ImportEnumLite value = (ImportEnumLite)[input readEnum];
         if (ImportEnumLiteIsValidValue(value)) {
           [self addRepeatedImportEnum:value];
         } else {
@@ -4456,7 +4269,7 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         break;
       }
       case 648: {
-        int32_t value = [input readEnum];
+        TestAllTypesLite_NestedEnum value = (TestAllTypesLite_NestedEnum)[input readEnum];
         if (TestAllTypesLite_NestedEnumIsValidValue(value)) {
           [self setDefaultNestedEnum:value];
         } else {
@@ -4465,7 +4278,7 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         break;
       }
       case 656: {
-        int32_t value = [input readEnum];
+        ForeignEnumLite value = (ForeignEnumLite)[input readEnum];
         if (ForeignEnumLiteIsValidValue(value)) {
           [self setDefaultForeignEnum:value];
         } else {
@@ -4474,7 +4287,7 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
         break;
       }
       case 664: {
-        int32_t value = [input readEnum];
+        ImportEnumLite value = (ImportEnumLite)[input readEnum];
         if (ImportEnumLiteIsValidValue(value)) {
           [self setDefaultImportEnum:value];
         } else {
@@ -4493,1375 +4306,2283 @@ static TestAllTypesLite_RepeatedGroup* defaultTestAllTypesLite_RepeatedGroupInst
     }
   }
 }
-- (BOOL) hasOptionalInt32 {
-  return result.hasOptionalInt32;
+- (TestAllTypesLite_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 12:
+        if (memcmp(name, "default_bool", 12) == 0) {
+          [self setDefaultBool:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_cord", 12) == 0) {
+          [self setDefaultCord:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 13:
+        if (memcmp(name, "optional_bool", 13) == 0) {
+          [self setOptionalBool:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        if (memcmp(name, "OptionalGroup", 13) == 0) {
+          TestAllTypesLite_OptionalGroup_Builder* subBuilder = [TestAllTypesLite_OptionalGroup builder];
+          if (self.builder_result.hasOptionalGroup) {
+            [subBuilder mergeFrom:self.builder_result.optionalGroup];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptionalGroup:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "optional_cord", 13) == 0) {
+          [self setOptionalCord:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_bool", 13) == 0) {
+          [self addRepeatedBool:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        if (memcmp(name, "RepeatedGroup", 13) == 0) {
+          TestAllTypesLite_RepeatedGroup_Builder* subBuilder = [TestAllTypesLite_RepeatedGroup builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addRepeatedGroup:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "repeated_cord", 13) == 0) {
+          [self addRepeatedCord:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_int32", 13) == 0) {
+          [self setDefaultInt32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_int64", 13) == 0) {
+          [self setDefaultInt64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_float", 13) == 0) {
+          [self setDefaultFloat:PBTextFormatReaderReadFloat(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_bytes", 13) == 0) {
+          [self setDefaultBytes:PBTextFormatReaderReadData(reader)];
+          continue;
+        }
+        break;
+      case 14:
+        if (memcmp(name, "optional_int32", 14) == 0) {
+          [self setOptionalInt32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_int64", 14) == 0) {
+          [self setOptionalInt64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_float", 14) == 0) {
+          [self setOptionalFloat:PBTextFormatReaderReadFloat(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_bytes", 14) == 0) {
+          [self setOptionalBytes:PBTextFormatReaderReadData(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_int32", 14) == 0) {
+          [self addRepeatedInt32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_int64", 14) == 0) {
+          [self addRepeatedInt64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_float", 14) == 0) {
+          [self addRepeatedFloat:PBTextFormatReaderReadFloat(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_bytes", 14) == 0) {
+          [self addRepeatedBytes:PBTextFormatReaderReadData(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_uint32", 14) == 0) {
+          [self setDefaultUint32:PBTextFormatReaderReadUInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_uint64", 14) == 0) {
+          [self setDefaultUint64:PBTextFormatReaderReadUInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_sint32", 14) == 0) {
+          [self setDefaultSint32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_sint64", 14) == 0) {
+          [self setDefaultSint64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_double", 14) == 0) {
+          [self setDefaultDouble:PBTextFormatReaderReadDouble(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_string", 14) == 0) {
+          [self setDefaultString:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 15:
+        if (memcmp(name, "optional_uint32", 15) == 0) {
+          [self setOptionalUint32:PBTextFormatReaderReadUInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_uint64", 15) == 0) {
+          [self setOptionalUint64:PBTextFormatReaderReadUInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_sint32", 15) == 0) {
+          [self setOptionalSint32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_sint64", 15) == 0) {
+          [self setOptionalSint64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_double", 15) == 0) {
+          [self setOptionalDouble:PBTextFormatReaderReadDouble(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_string", 15) == 0) {
+          [self setOptionalString:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_uint32", 15) == 0) {
+          [self addRepeatedUint32:PBTextFormatReaderReadUInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_uint64", 15) == 0) {
+          [self addRepeatedUint64:PBTextFormatReaderReadUInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_sint32", 15) == 0) {
+          [self addRepeatedSint32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_sint64", 15) == 0) {
+          [self addRepeatedSint64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_double", 15) == 0) {
+          [self addRepeatedDouble:PBTextFormatReaderReadDouble(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_string", 15) == 0) {
+          [self addRepeatedString:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_fixed32", 15) == 0) {
+          [self setDefaultFixed32:PBTextFormatReaderReadUInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_fixed64", 15) == 0) {
+          [self setDefaultFixed64:PBTextFormatReaderReadUInt64(reader)];
+          continue;
+        }
+        break;
+      case 16:
+        if (memcmp(name, "optional_fixed32", 16) == 0) {
+          [self setOptionalFixed32:PBTextFormatReaderReadUInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_fixed64", 16) == 0) {
+          [self setOptionalFixed64:PBTextFormatReaderReadUInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_fixed32", 16) == 0) {
+          [self addRepeatedFixed32:PBTextFormatReaderReadUInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_fixed64", 16) == 0) {
+          [self addRepeatedFixed64:PBTextFormatReaderReadUInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_sfixed32", 16) == 0) {
+          [self setDefaultSfixed32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_sfixed64", 16) == 0) {
+          [self setDefaultSfixed64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        break;
+      case 17:
+        if (memcmp(name, "optional_sfixed32", 17) == 0) {
+          [self setOptionalSfixed32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_sfixed64", 17) == 0) {
+          [self setOptionalSfixed64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_sfixed32", 17) == 0) {
+          [self addRepeatedSfixed32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_sfixed64", 17) == 0) {
+          [self addRepeatedSfixed64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        break;
+      case 19:
+        if (memcmp(name, "default_nested_enum", 19) == 0) {
+          [self setDefaultNestedEnum:TestAllTypesLite_NestedEnumReadTextFormat(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_import_enum", 19) == 0) {
+          [self setDefaultImportEnum:ImportEnumLiteReadTextFormat(reader)];
+          continue;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "optional_nested_enum", 20) == 0) {
+          [self setOptionalNestedEnum:TestAllTypesLite_NestedEnumReadTextFormat(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_import_enum", 20) == 0) {
+          [self setOptionalImportEnum:ImportEnumLiteReadTextFormat(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_nested_enum", 20) == 0) {
+          [self addRepeatedNestedEnum:TestAllTypesLite_NestedEnumReadTextFormat(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_import_enum", 20) == 0) {
+          [self addRepeatedImportEnum:ImportEnumLiteReadTextFormat(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_foreign_enum", 20) == 0) {
+          [self setDefaultForeignEnum:ForeignEnumLiteReadTextFormat(reader)];
+          continue;
+        }
+        if (memcmp(name, "default_string_piece", 20) == 0) {
+          [self setDefaultStringPiece:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 21:
+        if (memcmp(name, "optional_foreign_enum", 21) == 0) {
+          [self setOptionalForeignEnum:ForeignEnumLiteReadTextFormat(reader)];
+          continue;
+        }
+        if (memcmp(name, "optional_string_piece", 21) == 0) {
+          [self setOptionalStringPiece:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_foreign_enum", 21) == 0) {
+          [self addRepeatedForeignEnum:ForeignEnumLiteReadTextFormat(reader)];
+          continue;
+        }
+        if (memcmp(name, "repeated_string_piece", 21) == 0) {
+          [self addRepeatedStringPiece:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+      case 23:
+        if (memcmp(name, "optional_nested_message", 23) == 0) {
+          TestAllTypesLite_NestedMessage_Builder* subBuilder = [TestAllTypesLite_NestedMessage builder];
+          if (self.builder_result.hasOptionalNestedMessage) {
+            [subBuilder mergeFrom:self.builder_result.optionalNestedMessage];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptionalNestedMessage:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "optional_import_message", 23) == 0) {
+          ImportMessageLite_Builder* subBuilder = [ImportMessageLite builder];
+          if (self.builder_result.hasOptionalImportMessage) {
+            [subBuilder mergeFrom:self.builder_result.optionalImportMessage];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptionalImportMessage:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "repeated_nested_message", 23) == 0) {
+          TestAllTypesLite_NestedMessage_Builder* subBuilder = [TestAllTypesLite_NestedMessage builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addRepeatedNestedMessage:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "repeated_import_message", 23) == 0) {
+          ImportMessageLite_Builder* subBuilder = [ImportMessageLite builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addRepeatedImportMessage:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+      case 24:
+        if (memcmp(name, "optional_foreign_message", 24) == 0) {
+          ForeignMessageLite_Builder* subBuilder = [ForeignMessageLite builder];
+          if (self.builder_result.hasOptionalForeignMessage) {
+            [subBuilder mergeFrom:self.builder_result.optionalForeignMessage];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setOptionalForeignMessage:[subBuilder buildPartial]];
+          continue;
+        }
+        if (memcmp(name, "repeated_foreign_message", 24) == 0) {
+          ForeignMessageLite_Builder* subBuilder = [ForeignMessageLite builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addRepeatedForeignMessage:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) optionalInt32 {
-  return result.optionalInt32;
+- (TestAllTypesLite_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 11:
+        if (memcmp(name, "defaultBool", 11) == 0) {
+          number = 73;
+        } else if (memcmp(name, "defaultCord", 11) == 0) {
+          number = 85;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "optionalBool", 12) == 0) {
+          number = 13;
+        } else if (memcmp(name, "optionalCord", 12) == 0) {
+          number = 25;
+        } else if (memcmp(name, "repeatedBool", 12) == 0) {
+          number = 43;
+        } else if (memcmp(name, "repeatedCord", 12) == 0) {
+          number = 55;
+        } else if (memcmp(name, "defaultInt32", 12) == 0) {
+          number = 61;
+        } else if (memcmp(name, "defaultInt64", 12) == 0) {
+          number = 62;
+        } else if (memcmp(name, "defaultFloat", 12) == 0) {
+          number = 71;
+        } else if (memcmp(name, "default_bool", 12) == 0) {
+          number = 73;
+        } else if (memcmp(name, "defaultBytes", 12) == 0) {
+          number = 75;
+        } else if (memcmp(name, "default_cord", 12) == 0) {
+          number = 85;
+        }
+        break;
+      case 13:
+        if (memcmp(name, "optionalInt32", 13) == 0) {
+          number = 1;
+        } else if (memcmp(name, "optionalInt64", 13) == 0) {
+          number = 2;
+        } else if (memcmp(name, "optionalFloat", 13) == 0) {
+          number = 11;
+        } else if (memcmp(name, "optional_bool", 13) == 0) {
+          number = 13;
+        } else if (memcmp(name, "optionalBytes", 13) == 0) {
+          number = 15;
+        } else if (memcmp(name, "optionalgroup", 13) == 0) {
+          number = 16;
+        } else if (memcmp(name, "optional_cord", 13) == 0) {
+          number = 25;
+        } else if (memcmp(name, "repeatedInt32", 13) == 0) {
+          number = 31;
+        } else if (memcmp(name, "repeatedInt64", 13) == 0) {
+          number = 32;
+        } else if (memcmp(name, "repeatedFloat", 13) == 0) {
+          number = 41;
+        } else if (memcmp(name, "repeated_bool", 13) == 0) {
+          number = 43;
+        } else if (memcmp(name, "repeatedBytes", 13) == 0) {
+          number = 45;
+        } else if (memcmp(name, "repeatedgroup", 13) == 0) {
+          number = 46;
+        } else if (memcmp(name, "repeated_cord", 13) == 0) {
+          number = 55;
+        } else if (memcmp(name, "default_int32", 13) == 0) {
+          number = 61;
+        } else if (memcmp(name, "default_int64", 13) == 0) {
+          number = 62;
+        } else if (memcmp(name, "defaultUint32", 13) == 0) {
+          number = 63;
+        } else if (memcmp(name, "defaultUint64", 13) == 0) {
+          number = 64;
+        } else if (memcmp(name, "defaultSint32", 13) == 0) {
+          number = 65;
+        } else if (memcmp(name, "defaultSint64", 13) == 0) {
+          number = 66;
+        } else if (memcmp(name, "default_float", 13) == 0) {
+          number = 71;
+        } else if (memcmp(name, "defaultDouble", 13) == 0) {
+          number = 72;
+        } else if (memcmp(name, "defaultString", 13) == 0) {
+          number = 74;
+        } else if (memcmp(name, "default_bytes", 13) == 0) {
+          number = 75;
+        }
+        break;
+      case 14:
+        if (memcmp(name, "optional_int32", 14) == 0) {
+          number = 1;
+        } else if (memcmp(name, "optional_int64", 14) == 0) {
+          number = 2;
+        } else if (memcmp(name, "optionalUint32", 14) == 0) {
+          number = 3;
+        } else if (memcmp(name, "optionalUint64", 14) == 0) {
+          number = 4;
+        } else if (memcmp(name, "optionalSint32", 14) == 0) {
+          number = 5;
+        } else if (memcmp(name, "optionalSint64", 14) == 0) {
+          number = 6;
+        } else if (memcmp(name, "optional_float", 14) == 0) {
+          number = 11;
+        } else if (memcmp(name, "optionalDouble", 14) == 0) {
+          number = 12;
+        } else if (memcmp(name, "optionalString", 14) == 0) {
+          number = 14;
+        } else if (memcmp(name, "optional_bytes", 14) == 0) {
+          number = 15;
+        } else if (memcmp(name, "repeated_int32", 14) == 0) {
+          number = 31;
+        } else if (memcmp(name, "repeated_int64", 14) == 0) {
+          number = 32;
+        } else if (memcmp(name, "repeatedUint32", 14) == 0) {
+          number = 33;
+        } else if (memcmp(name, "repeatedUint64", 14) == 0) {
+          number = 34;
+        } else if (memcmp(name, "repeatedSint32", 14) == 0) {
+          number = 35;
+        } else if (memcmp(name, "repeatedSint64", 14) == 0) {
+          number = 36;
+        } else if (memcmp(name, "repeated_float", 14) == 0) {
+          number = 41;
+        } else if (memcmp(name, "repeatedDouble", 14) == 0) {
+          number = 42;
+        } else if (memcmp(name, "repeatedString", 14) == 0) {
+          number = 44;
+        } else if (memcmp(name, "repeated_bytes", 14) == 0) {
+          number = 45;
+        } else if (memcmp(name, "default_uint32", 14) == 0) {
+          number = 63;
+        } else if (memcmp(name, "default_uint64", 14) == 0) {
+          number = 64;
+        } else if (memcmp(name, "default_sint32", 14) == 0) {
+          number = 65;
+        } else if (memcmp(name, "default_sint64", 14) == 0) {
+          number = 66;
+        } else if (memcmp(name, "defaultFixed32", 14) == 0) {
+          number = 67;
+        } else if (memcmp(name, "defaultFixed64", 14) == 0) {
+          number = 68;
+        } else if (memcmp(name, "default_double", 14) == 0) {
+          number = 72;
+        } else if (memcmp(name, "default_string", 14) == 0) {
+          number = 74;
+        }
+        break;
+      case 15:
+        if (memcmp(name, "optional_uint32", 15) == 0) {
+          number = 3;
+        } else if (memcmp(name, "optional_uint64", 15) == 0) {
+          number = 4;
+        } else if (memcmp(name, "optional_sint32", 15) == 0) {
+          number = 5;
+        } else if (memcmp(name, "optional_sint64", 15) == 0) {
+          number = 6;
+        } else if (memcmp(name, "optionalFixed32", 15) == 0) {
+          number = 7;
+        } else if (memcmp(name, "optionalFixed64", 15) == 0) {
+          number = 8;
+        } else if (memcmp(name, "optional_double", 15) == 0) {
+          number = 12;
+        } else if (memcmp(name, "optional_string", 15) == 0) {
+          number = 14;
+        } else if (memcmp(name, "repeated_uint32", 15) == 0) {
+          number = 33;
+        } else if (memcmp(name, "repeated_uint64", 15) == 0) {
+          number = 34;
+        } else if (memcmp(name, "repeated_sint32", 15) == 0) {
+          number = 35;
+        } else if (memcmp(name, "repeated_sint64", 15) == 0) {
+          number = 36;
+        } else if (memcmp(name, "repeatedFixed32", 15) == 0) {
+          number = 37;
+        } else if (memcmp(name, "repeatedFixed64", 15) == 0) {
+          number = 38;
+        } else if (memcmp(name, "repeated_double", 15) == 0) {
+          number = 42;
+        } else if (memcmp(name, "repeated_string", 15) == 0) {
+          number = 44;
+        } else if (memcmp(name, "default_fixed32", 15) == 0) {
+          number = 67;
+        } else if (memcmp(name, "default_fixed64", 15) == 0) {
+          number = 68;
+        } else if (memcmp(name, "defaultSfixed32", 15) == 0) {
+          number = 69;
+        } else if (memcmp(name, "defaultSfixed64", 15) == 0) {
+          number = 70;
+        }
+        break;
+      case 16:
+        if (memcmp(name, "optional_fixed32", 16) == 0) {
+          number = 7;
+        } else if (memcmp(name, "optional_fixed64", 16) == 0) {
+          number = 8;
+        } else if (memcmp(name, "optionalSfixed32", 16) == 0) {
+          number = 9;
+        } else if (memcmp(name, "optionalSfixed64", 16) == 0) {
+          number = 10;
+        } else if (memcmp(name, "repeated_fixed32", 16) == 0) {
+          number = 37;
+        } else if (memcmp(name, "repeated_fixed64", 16) == 0) {
+          number = 38;
+        } else if (memcmp(name, "repeatedSfixed32", 16) == 0) {
+          number = 39;
+        } else if (memcmp(name, "repeatedSfixed64", 16) == 0) {
+          number = 40;
+        } else if (memcmp(name, "default_sfixed32", 16) == 0) {
+          number = 69;
+        } else if (memcmp(name, "default_sfixed64", 16) == 0) {
+          number = 70;
+        }
+        break;
+      case 17:
+        if (memcmp(name, "optional_sfixed32", 17) == 0) {
+          number = 9;
+        } else if (memcmp(name, "optional_sfixed64", 17) == 0) {
+          number = 10;
+        } else if (memcmp(name, "repeated_sfixed32", 17) == 0) {
+          number = 39;
+        } else if (memcmp(name, "repeated_sfixed64", 17) == 0) {
+          number = 40;
+        } else if (memcmp(name, "defaultNestedEnum", 17) == 0) {
+          number = 81;
+        } else if (memcmp(name, "defaultImportEnum", 17) == 0) {
+          number = 83;
+        }
+        break;
+      case 18:
+        if (memcmp(name, "optionalNestedEnum", 18) == 0) {
+          number = 21;
+        } else if (memcmp(name, "optionalImportEnum", 18) == 0) {
+          number = 23;
+        } else if (memcmp(name, "repeatedNestedEnum", 18) == 0) {
+          number = 51;
+        } else if (memcmp(name, "repeatedImportEnum", 18) == 0) {
+          number = 53;
+        } else if (memcmp(name, "defaultForeignEnum", 18) == 0) {
+          number = 82;
+        } else if (memcmp(name, "defaultStringPiece", 18) == 0) {
+          number = 84;
+        }
+        break;
+      case 19:
+        if (memcmp(name, "optionalForeignEnum", 19) == 0) {
+          number = 22;
+        } else if (memcmp(name, "optionalStringPiece", 19) == 0) {
+          number = 24;
+        } else if (memcmp(name, "repeatedForeignEnum", 19) == 0) {
+          number = 52;
+        } else if (memcmp(name, "repeatedStringPiece", 19) == 0) {
+          number = 54;
+        } else if (memcmp(name, "default_nested_enum", 19) == 0) {
+          number = 81;
+        } else if (memcmp(name, "default_import_enum", 19) == 0) {
+          number = 83;
+        }
+        break;
+      case 20:
+        if (memcmp(name, "optional_nested_enum", 20) == 0) {
+          number = 21;
+        } else if (memcmp(name, "optional_import_enum", 20) == 0) {
+          number = 23;
+        } else if (memcmp(name, "repeated_nested_enum", 20) == 0) {
+          number = 51;
+        } else if (memcmp(name, "repeated_import_enum", 20) == 0) {
+          number = 53;
+        } else if (memcmp(name, "default_foreign_enum", 20) == 0) {
+          number = 82;
+        } else if (memcmp(name, "default_string_piece", 20) == 0) {
+          number = 84;
+        }
+        break;
+      case 21:
+        if (memcmp(name, "optionalNestedMessage", 21) == 0) {
+          number = 18;
+        } else if (memcmp(name, "optionalImportMessage", 21) == 0) {
+          number = 20;
+        } else if (memcmp(name, "optional_foreign_enum", 21) == 0) {
+          number = 22;
+        } else if (memcmp(name, "optional_string_piece", 21) == 0) {
+          number = 24;
+        } else if (memcmp(name, "repeatedNestedMessage", 21) == 0) {
+          number = 48;
+        } else if (memcmp(name, "repeatedImportMessage", 21) == 0) {
+          number = 50;
+        } else if (memcmp(name, "repeated_foreign_enum", 21) == 0) {
+          number = 52;
+        } else if (memcmp(name, "repeated_string_piece", 21) == 0) {
+          number = 54;
+        }
+        break;
+      case 22:
+        if (memcmp(name, "optionalForeignMessage", 22) == 0) {
+          number = 19;
+        } else if (memcmp(name, "repeatedForeignMessage", 22) == 0) {
+          number = 49;
+        }
+        break;
+      case 23:
+        if (memcmp(name, "optional_nested_message", 23) == 0) {
+          number = 18;
+        } else if (memcmp(name, "optional_import_message", 23) == 0) {
+          number = 20;
+        } else if (memcmp(name, "repeated_nested_message", 23) == 0) {
+          number = 48;
+        } else if (memcmp(name, "repeated_import_message", 23) == 0) {
+          number = 50;
+        }
+        break;
+      case 24:
+        if (memcmp(name, "optional_foreign_message", 24) == 0) {
+          number = 19;
+        } else if (memcmp(name, "repeated_foreign_message", 24) == 0) {
+          number = 49;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setOptionalInt32:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 2: {
+        [self setOptionalInt64:PBJSONReaderReadInt64(reader)];
+        continue;
+      }
+      case 3: {
+        [self setOptionalUint32:PBJSONReaderReadUInt32(reader)];
+        continue;
+      }
+      case 4: {
+        [self setOptionalUint64:PBJSONReaderReadUInt64(reader)];
+        continue;
+      }
+      case 5: {
+        [self setOptionalSint32:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 6: {
+        [self setOptionalSint64:PBJSONReaderReadInt64(reader)];
+        continue;
+      }
+      case 7: {
+        [self setOptionalFixed32:PBJSONReaderReadUInt32(reader)];
+        continue;
+      }
+      case 8: {
+        [self setOptionalFixed64:PBJSONReaderReadUInt64(reader)];
+        continue;
+      }
+      case 9: {
+        [self setOptionalSfixed32:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 10: {
+        [self setOptionalSfixed64:PBJSONReaderReadInt64(reader)];
+        continue;
+      }
+      case 11: {
+        [self setOptionalFloat:PBJSONReaderReadFloat(reader)];
+        continue;
+      }
+      case 12: {
+        [self setOptionalDouble:PBJSONReaderReadDouble(reader)];
+        continue;
+      }
+      case 13: {
+        [self setOptionalBool:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 14: {
+        [self setOptionalString:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 15: {
+        [self setOptionalBytes:PBJSONReaderReadData(reader)];
+        continue;
+      }
+      case 16: {
+        TestAllTypesLite_OptionalGroup_Builder* subBuilder = [TestAllTypesLite_OptionalGroup builder];
+        if (self.builder_result.hasOptionalGroup) {
+          [subBuilder mergeFrom:self.builder_result.optionalGroup];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptionalGroup:[subBuilder buildPartial]];
+        continue;
+      }
+      case 18: {
+        TestAllTypesLite_NestedMessage_Builder* subBuilder = [TestAllTypesLite_NestedMessage builder];
+        if (self.builder_result.hasOptionalNestedMessage) {
+          [subBuilder mergeFrom:self.builder_result.optionalNestedMessage];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptionalNestedMessage:[subBuilder buildPartial]];
+        continue;
+      }
+      case 19: {
+        ForeignMessageLite_Builder* subBuilder = [ForeignMessageLite builder];
+        if (self.builder_result.hasOptionalForeignMessage) {
+          [subBuilder mergeFrom:self.builder_result.optionalForeignMessage];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptionalForeignMessage:[subBuilder buildPartial]];
+        continue;
+      }
+      case 20: {
+        ImportMessageLite_Builder* subBuilder = [ImportMessageLite builder];
+        if (self.builder_result.hasOptionalImportMessage) {
+          [subBuilder mergeFrom:self.builder_result.optionalImportMessage];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setOptionalImportMessage:[subBuilder buildPartial]];
+        continue;
+      }
+      case 21: {
+        [self setOptionalNestedEnum:TestAllTypesLite_NestedEnumReadJSON(reader)];
+        continue;
+      }
+      case 22: {
+        [self setOptionalForeignEnum:ForeignEnumLiteReadJSON(reader)];
+        continue;
+      }
+      case 23: {
+        [self setOptionalImportEnum:ImportEnumLiteReadJSON(reader)];
+        continue;
+      }
+      case 24: {
+        [self setOptionalStringPiece:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 25: {
+        [self setOptionalCord:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 31: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedInt32:PBJSONReaderReadInt32(reader)];
+        }
+        continue;
+      }
+      case 32: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedInt64:PBJSONReaderReadInt64(reader)];
+        }
+        continue;
+      }
+      case 33: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedUint32:PBJSONReaderReadUInt32(reader)];
+        }
+        continue;
+      }
+      case 34: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedUint64:PBJSONReaderReadUInt64(reader)];
+        }
+        continue;
+      }
+      case 35: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedSint32:PBJSONReaderReadInt32(reader)];
+        }
+        continue;
+      }
+      case 36: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedSint64:PBJSONReaderReadInt64(reader)];
+        }
+        continue;
+      }
+      case 37: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedFixed32:PBJSONReaderReadUInt32(reader)];
+        }
+        continue;
+      }
+      case 38: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedFixed64:PBJSONReaderReadUInt64(reader)];
+        }
+        continue;
+      }
+      case 39: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedSfixed32:PBJSONReaderReadInt32(reader)];
+        }
+        continue;
+      }
+      case 40: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedSfixed64:PBJSONReaderReadInt64(reader)];
+        }
+        continue;
+      }
+      case 41: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedFloat:PBJSONReaderReadFloat(reader)];
+        }
+        continue;
+      }
+      case 42: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedDouble:PBJSONReaderReadDouble(reader)];
+        }
+        continue;
+      }
+      case 43: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedBool:PBJSONReaderReadBool(reader)];
+        }
+        continue;
+      }
+      case 44: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedString:PBJSONReaderReadString(reader)];
+        }
+        continue;
+      }
+      case 45: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedBytes:PBJSONReaderReadData(reader)];
+        }
+        continue;
+      }
+      case 46: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          TestAllTypesLite_RepeatedGroup_Builder* subBuilder = [TestAllTypesLite_RepeatedGroup builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addRepeatedGroup:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 48: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          TestAllTypesLite_NestedMessage_Builder* subBuilder = [TestAllTypesLite_NestedMessage builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addRepeatedNestedMessage:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 49: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          ForeignMessageLite_Builder* subBuilder = [ForeignMessageLite builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addRepeatedForeignMessage:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 50: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          ImportMessageLite_Builder* subBuilder = [ImportMessageLite builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addRepeatedImportMessage:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+      case 51: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedNestedEnum:TestAllTypesLite_NestedEnumReadJSON(reader)];
+        }
+        continue;
+      }
+      case 52: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedForeignEnum:ForeignEnumLiteReadJSON(reader)];
+        }
+        continue;
+      }
+      case 53: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedImportEnum:ImportEnumLiteReadJSON(reader)];
+        }
+        continue;
+      }
+      case 54: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedStringPiece:PBJSONReaderReadString(reader)];
+        }
+        continue;
+      }
+      case 55: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addRepeatedCord:PBJSONReaderReadString(reader)];
+        }
+        continue;
+      }
+      case 61: {
+        [self setDefaultInt32:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 62: {
+        [self setDefaultInt64:PBJSONReaderReadInt64(reader)];
+        continue;
+      }
+      case 63: {
+        [self setDefaultUint32:PBJSONReaderReadUInt32(reader)];
+        continue;
+      }
+      case 64: {
+        [self setDefaultUint64:PBJSONReaderReadUInt64(reader)];
+        continue;
+      }
+      case 65: {
+        [self setDefaultSint32:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 66: {
+        [self setDefaultSint64:PBJSONReaderReadInt64(reader)];
+        continue;
+      }
+      case 67: {
+        [self setDefaultFixed32:PBJSONReaderReadUInt32(reader)];
+        continue;
+      }
+      case 68: {
+        [self setDefaultFixed64:PBJSONReaderReadUInt64(reader)];
+        continue;
+      }
+      case 69: {
+        [self setDefaultSfixed32:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 70: {
+        [self setDefaultSfixed64:PBJSONReaderReadInt64(reader)];
+        continue;
+      }
+      case 71: {
+        [self setDefaultFloat:PBJSONReaderReadFloat(reader)];
+        continue;
+      }
+      case 72: {
+        [self setDefaultDouble:PBJSONReaderReadDouble(reader)];
+        continue;
+      }
+      case 73: {
+        [self setDefaultBool:PBJSONReaderReadBool(reader)];
+        continue;
+      }
+      case 74: {
+        [self setDefaultString:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 75: {
+        [self setDefaultBytes:PBJSONReaderReadData(reader)];
+        continue;
+      }
+      case 81: {
+        [self setDefaultNestedEnum:TestAllTypesLite_NestedEnumReadJSON(reader)];
+        continue;
+      }
+      case 82: {
+        [self setDefaultForeignEnum:ForeignEnumLiteReadJSON(reader)];
+        continue;
+      }
+      case 83: {
+        [self setDefaultImportEnum:ImportEnumLiteReadJSON(reader)];
+        continue;
+      }
+      case 84: {
+        [self setDefaultStringPiece:PBJSONReaderReadString(reader)];
+        continue;
+      }
+      case 85: {
+        [self setDefaultCord:PBJSONReaderReadString(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalInt32:(int32_t) value {
-  result.hasOptionalInt32 = YES;
-  result.optionalInt32 = value;
+  builder_result.hasOptionalInt32 = YES;
+  builder_result.optionalInt32 = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalInt32 {
-  result.hasOptionalInt32 = NO;
-  result.optionalInt32 = 0;
-  return self;
+- (int32_t) optionalInt32 {
+  return builder_result.optionalInt32;
 }
-- (BOOL) hasOptionalInt64 {
-  return result.hasOptionalInt64;
+- (BOOL)hasOptionalInt32 {
+ return builder_result.hasOptionalInt32;
 }
-- (int64_t) optionalInt64 {
-  return result.optionalInt64;
+- (TestAllTypesLite_Builder*)clearOptionalInt32 {
+  builder_result.hasOptionalInt32 = NO;
+  builder_result.optionalInt32 = 0;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalInt64:(int64_t) value {
-  result.hasOptionalInt64 = YES;
-  result.optionalInt64 = value;
+  builder_result.hasOptionalInt64 = YES;
+  builder_result.optionalInt64 = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalInt64 {
-  result.hasOptionalInt64 = NO;
-  result.optionalInt64 = 0L;
-  return self;
+- (int64_t) optionalInt64 {
+  return builder_result.optionalInt64;
 }
-- (BOOL) hasOptionalUint32 {
-  return result.hasOptionalUint32;
+- (BOOL)hasOptionalInt64 {
+ return builder_result.hasOptionalInt64;
 }
-- (uint32_t) optionalUint32 {
-  return result.optionalUint32;
+- (TestAllTypesLite_Builder*)clearOptionalInt64 {
+  builder_result.hasOptionalInt64 = NO;
+  builder_result.optionalInt64 = 0L;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalUint32:(uint32_t) value {
-  result.hasOptionalUint32 = YES;
-  result.optionalUint32 = value;
+  builder_result.hasOptionalUint32 = YES;
+  builder_result.optionalUint32 = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalUint32 {
-  result.hasOptionalUint32 = NO;
-  result.optionalUint32 = 0;
-  return self;
+- (uint32_t) optionalUint32 {
+  return builder_result.optionalUint32;
 }
-- (BOOL) hasOptionalUint64 {
-  return result.hasOptionalUint64;
+- (BOOL)hasOptionalUint32 {
+ return builder_result.hasOptionalUint32;
 }
-- (uint64_t) optionalUint64 {
-  return result.optionalUint64;
+- (TestAllTypesLite_Builder*)clearOptionalUint32 {
+  builder_result.hasOptionalUint32 = NO;
+  builder_result.optionalUint32 = 0;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalUint64:(uint64_t) value {
-  result.hasOptionalUint64 = YES;
-  result.optionalUint64 = value;
+  builder_result.hasOptionalUint64 = YES;
+  builder_result.optionalUint64 = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalUint64 {
-  result.hasOptionalUint64 = NO;
-  result.optionalUint64 = 0L;
-  return self;
+- (uint64_t) optionalUint64 {
+  return builder_result.optionalUint64;
 }
-- (BOOL) hasOptionalSint32 {
-  return result.hasOptionalSint32;
+- (BOOL)hasOptionalUint64 {
+ return builder_result.hasOptionalUint64;
 }
-- (int32_t) optionalSint32 {
-  return result.optionalSint32;
+- (TestAllTypesLite_Builder*)clearOptionalUint64 {
+  builder_result.hasOptionalUint64 = NO;
+  builder_result.optionalUint64 = 0L;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalSint32:(int32_t) value {
-  result.hasOptionalSint32 = YES;
-  result.optionalSint32 = value;
+  builder_result.hasOptionalSint32 = YES;
+  builder_result.optionalSint32 = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalSint32 {
-  result.hasOptionalSint32 = NO;
-  result.optionalSint32 = 0;
-  return self;
+- (int32_t) optionalSint32 {
+  return builder_result.optionalSint32;
 }
-- (BOOL) hasOptionalSint64 {
-  return result.hasOptionalSint64;
+- (BOOL)hasOptionalSint32 {
+ return builder_result.hasOptionalSint32;
 }
-- (int64_t) optionalSint64 {
-  return result.optionalSint64;
+- (TestAllTypesLite_Builder*)clearOptionalSint32 {
+  builder_result.hasOptionalSint32 = NO;
+  builder_result.optionalSint32 = 0;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalSint64:(int64_t) value {
-  result.hasOptionalSint64 = YES;
-  result.optionalSint64 = value;
+  builder_result.hasOptionalSint64 = YES;
+  builder_result.optionalSint64 = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalSint64 {
-  result.hasOptionalSint64 = NO;
-  result.optionalSint64 = 0L;
-  return self;
+- (int64_t) optionalSint64 {
+  return builder_result.optionalSint64;
 }
-- (BOOL) hasOptionalFixed32 {
-  return result.hasOptionalFixed32;
+- (BOOL)hasOptionalSint64 {
+ return builder_result.hasOptionalSint64;
 }
-- (uint32_t) optionalFixed32 {
-  return result.optionalFixed32;
+- (TestAllTypesLite_Builder*)clearOptionalSint64 {
+  builder_result.hasOptionalSint64 = NO;
+  builder_result.optionalSint64 = 0L;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalFixed32:(uint32_t) value {
-  result.hasOptionalFixed32 = YES;
-  result.optionalFixed32 = value;
+  builder_result.hasOptionalFixed32 = YES;
+  builder_result.optionalFixed32 = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalFixed32 {
-  result.hasOptionalFixed32 = NO;
-  result.optionalFixed32 = 0;
-  return self;
+- (uint32_t) optionalFixed32 {
+  return builder_result.optionalFixed32;
 }
-- (BOOL) hasOptionalFixed64 {
-  return result.hasOptionalFixed64;
+- (BOOL)hasOptionalFixed32 {
+ return builder_result.hasOptionalFixed32;
 }
-- (uint64_t) optionalFixed64 {
-  return result.optionalFixed64;
+- (TestAllTypesLite_Builder*)clearOptionalFixed32 {
+  builder_result.hasOptionalFixed32 = NO;
+  builder_result.optionalFixed32 = 0;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalFixed64:(uint64_t) value {
-  result.hasOptionalFixed64 = YES;
-  result.optionalFixed64 = value;
+  builder_result.hasOptionalFixed64 = YES;
+  builder_result.optionalFixed64 = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalFixed64 {
-  result.hasOptionalFixed64 = NO;
-  result.optionalFixed64 = 0L;
-  return self;
+- (uint64_t) optionalFixed64 {
+  return builder_result.optionalFixed64;
 }
-- (BOOL) hasOptionalSfixed32 {
-  return result.hasOptionalSfixed32;
+- (BOOL)hasOptionalFixed64 {
+ return builder_result.hasOptionalFixed64;
 }
-- (int32_t) optionalSfixed32 {
-  return result.optionalSfixed32;
+- (TestAllTypesLite_Builder*)clearOptionalFixed64 {
+  builder_result.hasOptionalFixed64 = NO;
+  builder_result.optionalFixed64 = 0L;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalSfixed32:(int32_t) value {
-  result.hasOptionalSfixed32 = YES;
-  result.optionalSfixed32 = value;
+  builder_result.hasOptionalSfixed32 = YES;
+  builder_result.optionalSfixed32 = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalSfixed32 {
-  result.hasOptionalSfixed32 = NO;
-  result.optionalSfixed32 = 0;
-  return self;
+- (int32_t) optionalSfixed32 {
+  return builder_result.optionalSfixed32;
 }
-- (BOOL) hasOptionalSfixed64 {
-  return result.hasOptionalSfixed64;
+- (BOOL)hasOptionalSfixed32 {
+ return builder_result.hasOptionalSfixed32;
 }
-- (int64_t) optionalSfixed64 {
-  return result.optionalSfixed64;
+- (TestAllTypesLite_Builder*)clearOptionalSfixed32 {
+  builder_result.hasOptionalSfixed32 = NO;
+  builder_result.optionalSfixed32 = 0;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalSfixed64:(int64_t) value {
-  result.hasOptionalSfixed64 = YES;
-  result.optionalSfixed64 = value;
+  builder_result.hasOptionalSfixed64 = YES;
+  builder_result.optionalSfixed64 = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalSfixed64 {
-  result.hasOptionalSfixed64 = NO;
-  result.optionalSfixed64 = 0L;
-  return self;
+- (int64_t) optionalSfixed64 {
+  return builder_result.optionalSfixed64;
 }
-- (BOOL) hasOptionalFloat {
-  return result.hasOptionalFloat;
+- (BOOL)hasOptionalSfixed64 {
+ return builder_result.hasOptionalSfixed64;
 }
-- (Float32) optionalFloat {
-  return result.optionalFloat;
+- (TestAllTypesLite_Builder*)clearOptionalSfixed64 {
+  builder_result.hasOptionalSfixed64 = NO;
+  builder_result.optionalSfixed64 = 0L;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalFloat:(Float32) value {
-  result.hasOptionalFloat = YES;
-  result.optionalFloat = value;
+  builder_result.hasOptionalFloat = YES;
+  builder_result.optionalFloat = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalFloat {
-  result.hasOptionalFloat = NO;
-  result.optionalFloat = 0;
-  return self;
+- (Float32) optionalFloat {
+  return builder_result.optionalFloat;
 }
-- (BOOL) hasOptionalDouble {
-  return result.hasOptionalDouble;
+- (BOOL)hasOptionalFloat {
+ return builder_result.hasOptionalFloat;
 }
-- (Float64) optionalDouble {
-  return result.optionalDouble;
+- (TestAllTypesLite_Builder*)clearOptionalFloat {
+  builder_result.hasOptionalFloat = NO;
+  builder_result.optionalFloat = 0;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalDouble:(Float64) value {
-  result.hasOptionalDouble = YES;
-  result.optionalDouble = value;
+  builder_result.hasOptionalDouble = YES;
+  builder_result.optionalDouble = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalDouble {
-  result.hasOptionalDouble = NO;
-  result.optionalDouble = 0;
-  return self;
+- (Float64) optionalDouble {
+  return builder_result.optionalDouble;
 }
-- (BOOL) hasOptionalBool {
-  return result.hasOptionalBool;
+- (BOOL)hasOptionalDouble {
+ return builder_result.hasOptionalDouble;
 }
-- (BOOL) optionalBool {
-  return result.optionalBool;
+- (TestAllTypesLite_Builder*)clearOptionalDouble {
+  builder_result.hasOptionalDouble = NO;
+  builder_result.optionalDouble = 0;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalBool:(BOOL) value {
-  result.hasOptionalBool = YES;
-  result.optionalBool = value;
+  builder_result.hasOptionalBool = YES;
+  builder_result.optionalBool = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalBool {
-  result.hasOptionalBool = NO;
-  result.optionalBool = NO;
-  return self;
+- (BOOL) optionalBool {
+  return builder_result.optionalBool;
 }
-- (BOOL) hasOptionalString {
-  return result.hasOptionalString;
+- (BOOL)hasOptionalBool {
+ return builder_result.hasOptionalBool;
 }
-- (NSString*) optionalString {
-  return result.optionalString;
+- (TestAllTypesLite_Builder*)clearOptionalBool {
+  builder_result.hasOptionalBool = NO;
+  builder_result.optionalBool = NO;
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalString:(NSString*) value {
-  result.hasOptionalString = YES;
-  result.optionalString = value;
+  builder_result.hasOptionalString = YES;
+  builder_result.optionalString = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalString {
-  result.hasOptionalString = NO;
-  result.optionalString = @"";
-  return self;
+- (NSString*) optionalString {
+  return builder_result.optionalString;
 }
-- (BOOL) hasOptionalBytes {
-  return result.hasOptionalBytes;
+- (BOOL)hasOptionalString {
+ return builder_result.hasOptionalString;
 }
-- (NSData*) optionalBytes {
-  return result.optionalBytes;
+- (TestAllTypesLite_Builder*)clearOptionalString {
+  builder_result.hasOptionalString = NO;
+  builder_result.optionalString = @"";
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalBytes:(NSData*) value {
-  result.hasOptionalBytes = YES;
-  result.optionalBytes = value;
+  builder_result.hasOptionalBytes = YES;
+  builder_result.optionalBytes = value;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalBytes {
-  result.hasOptionalBytes = NO;
-  result.optionalBytes = [NSData data];
-  return self;
+- (NSData*) optionalBytes {
+  return builder_result.optionalBytes;
 }
-- (BOOL) hasOptionalGroup {
-  return result.hasOptionalGroup;
+- (BOOL)hasOptionalBytes {
+ return builder_result.hasOptionalBytes;
 }
-- (TestAllTypesLite_OptionalGroup*) optionalGroup {
-  return result.optionalGroup;
+- (TestAllTypesLite_Builder*)clearOptionalBytes {
+  builder_result.hasOptionalBytes = NO;
+  builder_result.optionalBytes = [NSData data];
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalGroup:(TestAllTypesLite_OptionalGroup*) value {
-  result.hasOptionalGroup = YES;
-  result.optionalGroup = value;
+  builder_result.hasOptionalGroup = YES;
+  builder_result.optionalGroup = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalGroupBuilder:(TestAllTypesLite_OptionalGroup_Builder*) builderForValue {
   return [self setOptionalGroup:[builderForValue build]];
 }
 - (TestAllTypesLite_Builder*) mergeOptionalGroup:(TestAllTypesLite_OptionalGroup*) value {
-  if (result.hasOptionalGroup &&
-      result.optionalGroup != [TestAllTypesLite_OptionalGroup defaultInstance]) {
-    result.optionalGroup =
-      [[[TestAllTypesLite_OptionalGroup builderWithPrototype:result.optionalGroup] mergeFrom:value] buildPartial];
+  if (builder_result.hasOptionalGroup &&
+      builder_result.optionalGroup != [TestAllTypesLite_OptionalGroup defaultInstance]) {
+    builder_result.optionalGroup =
+      [[[TestAllTypesLite_OptionalGroup builderWithPrototype:builder_result.optionalGroup] mergeFrom:value] buildPartial];
   } else {
-    result.optionalGroup = value;
+    builder_result.optionalGroup = value;
   }
-  result.hasOptionalGroup = YES;
+  builder_result.hasOptionalGroup = YES;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalGroup {
-  result.hasOptionalGroup = NO;
-  result.optionalGroup = [TestAllTypesLite_OptionalGroup defaultInstance];
-  return self;
+- (TestAllTypesLite_OptionalGroup*) optionalGroup {
+  return builder_result.optionalGroup;
 }
-- (BOOL) hasOptionalNestedMessage {
-  return result.hasOptionalNestedMessage;
+- (BOOL)hasOptionalGroup {
+ return builder_result.hasOptionalGroup;
 }
-- (TestAllTypesLite_NestedMessage*) optionalNestedMessage {
-  return result.optionalNestedMessage;
+- (TestAllTypesLite_Builder*)clearOptionalGroup {
+  builder_result.hasOptionalGroup = NO;
+  builder_result.optionalGroup = [TestAllTypesLite_OptionalGroup defaultInstance];
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalNestedMessage:(TestAllTypesLite_NestedMessage*) value {
-  result.hasOptionalNestedMessage = YES;
-  result.optionalNestedMessage = value;
+  builder_result.hasOptionalNestedMessage = YES;
+  builder_result.optionalNestedMessage = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalNestedMessageBuilder:(TestAllTypesLite_NestedMessage_Builder*) builderForValue {
   return [self setOptionalNestedMessage:[builderForValue build]];
 }
 - (TestAllTypesLite_Builder*) mergeOptionalNestedMessage:(TestAllTypesLite_NestedMessage*) value {
-  if (result.hasOptionalNestedMessage &&
-      result.optionalNestedMessage != [TestAllTypesLite_NestedMessage defaultInstance]) {
-    result.optionalNestedMessage =
-      [[[TestAllTypesLite_NestedMessage builderWithPrototype:result.optionalNestedMessage] mergeFrom:value] buildPartial];
+  if (builder_result.hasOptionalNestedMessage &&
+      builder_result.optionalNestedMessage != [TestAllTypesLite_NestedMessage defaultInstance]) {
+    builder_result.optionalNestedMessage =
+      [[[TestAllTypesLite_NestedMessage builderWithPrototype:builder_result.optionalNestedMessage] mergeFrom:value] buildPartial];
   } else {
-    result.optionalNestedMessage = value;
+    builder_result.optionalNestedMessage = value;
   }
-  result.hasOptionalNestedMessage = YES;
+  builder_result.hasOptionalNestedMessage = YES;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalNestedMessage {
-  result.hasOptionalNestedMessage = NO;
-  result.optionalNestedMessage = [TestAllTypesLite_NestedMessage defaultInstance];
-  return self;
+- (TestAllTypesLite_NestedMessage*) optionalNestedMessage {
+  return builder_result.optionalNestedMessage;
 }
-- (BOOL) hasOptionalForeignMessage {
-  return result.hasOptionalForeignMessage;
+- (BOOL)hasOptionalNestedMessage {
+ return builder_result.hasOptionalNestedMessage;
 }
-- (ForeignMessageLite*) optionalForeignMessage {
-  return result.optionalForeignMessage;
+- (TestAllTypesLite_Builder*)clearOptionalNestedMessage {
+  builder_result.hasOptionalNestedMessage = NO;
+  builder_result.optionalNestedMessage = [TestAllTypesLite_NestedMessage defaultInstance];
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalForeignMessage:(ForeignMessageLite*) value {
-  result.hasOptionalForeignMessage = YES;
-  result.optionalForeignMessage = value;
+  builder_result.hasOptionalForeignMessage = YES;
+  builder_result.optionalForeignMessage = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalForeignMessageBuilder:(ForeignMessageLite_Builder*) builderForValue {
   return [self setOptionalForeignMessage:[builderForValue build]];
 }
 - (TestAllTypesLite_Builder*) mergeOptionalForeignMessage:(ForeignMessageLite*) value {
-  if (result.hasOptionalForeignMessage &&
-      result.optionalForeignMessage != [ForeignMessageLite defaultInstance]) {
-    result.optionalForeignMessage =
-      [[[ForeignMessageLite builderWithPrototype:result.optionalForeignMessage] mergeFrom:value] buildPartial];
+  if (builder_result.hasOptionalForeignMessage &&
+      builder_result.optionalForeignMessage != [ForeignMessageLite defaultInstance]) {
+    builder_result.optionalForeignMessage =
+      [[[ForeignMessageLite builderWithPrototype:builder_result.optionalForeignMessage] mergeFrom:value] buildPartial];
   } else {
-    result.optionalForeignMessage = value;
+    builder_result.optionalForeignMessage = value;
   }
-  result.hasOptionalForeignMessage = YES;
+  builder_result.hasOptionalForeignMessage = YES;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalForeignMessage {
-  result.hasOptionalForeignMessage = NO;
-  result.optionalForeignMessage = [ForeignMessageLite defaultInstance];
-  return self;
+- (ForeignMessageLite*) optionalForeignMessage {
+  return builder_result.optionalForeignMessage;
 }
-- (BOOL) hasOptionalImportMessage {
-  return result.hasOptionalImportMessage;
+- (BOOL)hasOptionalForeignMessage {
+ return builder_result.hasOptionalForeignMessage;
 }
-- (ImportMessageLite*) optionalImportMessage {
-  return result.optionalImportMessage;
+- (TestAllTypesLite_Builder*)clearOptionalForeignMessage {
+  builder_result.hasOptionalForeignMessage = NO;
+  builder_result.optionalForeignMessage = [ForeignMessageLite defaultInstance];
+  return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalImportMessage:(ImportMessageLite*) value {
-  result.hasOptionalImportMessage = YES;
-  result.optionalImportMessage = value;
+  builder_result.hasOptionalImportMessage = YES;
+  builder_result.optionalImportMessage = value;
   return self;
 }
 - (TestAllTypesLite_Builder*) setOptionalImportMessageBuilder:(ImportMessageLite_Builder*) builderForValue {
   return [self setOptionalImportMessage:[builderForValue build]];
 }
 - (TestAllTypesLite_Builder*) mergeOptionalImportMessage:(ImportMessageLite*) value {
-  if (result.hasOptionalImportMessage &&
-      result.optionalImportMessage != [ImportMessageLite defaultInstance]) {
-    result.optionalImportMessage =
-      [[[ImportMessageLite builderWithPrototype:result.optionalImportMessage] mergeFrom:value] buildPartial];
+  if (builder_result.hasOptionalImportMessage &&
+      builder_result.optionalImportMessage != [ImportMessageLite defaultInstance]) {
+    builder_result.optionalImportMessage =
+      [[[ImportMessageLite builderWithPrototype:builder_result.optionalImportMessage] mergeFrom:value] buildPartial];
   } else {
-    result.optionalImportMessage = value;
+    builder_result.optionalImportMessage = value;
   }
-  result.hasOptionalImportMessage = YES;
-  return self;
-}
-- (TestAllTypesLite_Builder*) clearOptionalImportMessage {
-  result.hasOptionalImportMessage = NO;
-  result.optionalImportMessage = [ImportMessageLite defaultInstance];
+  builder_result.hasOptionalImportMessage = YES;
   return self;
 }
-- (BOOL) hasOptionalNestedEnum {
-  return result.hasOptionalNestedEnum;
+- (ImportMessageLite*) optionalImportMessage {
+  return builder_result.optionalImportMessage;
 }
-- (TestAllTypesLite_NestedEnum) optionalNestedEnum {
-  return result.optionalNestedEnum;
+- (BOOL)hasOptionalImportMessage {
+ return builder_result.hasOptionalImportMessage;
 }
-- (TestAllTypesLite_Builder*) setOptionalNestedEnum:(TestAllTypesLite_NestedEnum) value {
-  result.hasOptionalNestedEnum = YES;
-  result.optionalNestedEnum = value;
+- (TestAllTypesLite_Builder*)clearOptionalImportMessage {
+  builder_result.hasOptionalImportMessage = NO;
+  builder_result.optionalImportMessage = [ImportMessageLite defaultInstance];
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalNestedEnum {
-  result.hasOptionalNestedEnum = NO;
-  result.optionalNestedEnum = TestAllTypesLite_NestedEnumFoo;
+- (TestAllTypesLite_Builder*)setOptionalNestedEnum:(TestAllTypesLite_NestedEnum) value {
+  NSAssert(TestAllTypesLite_NestedEnumIsValidValue(value), @"The value '%d' is invalid for TestAllTypesLite_NestedEnum", value);
+  builder_result.hasOptionalNestedEnum = YES;
+  builder_result.optionalNestedEnum = value;
   return self;
 }
-- (BOOL) hasOptionalForeignEnum {
-  return result.hasOptionalForeignEnum;
+- (TestAllTypesLite_NestedEnum)optionalNestedEnum {
+  return builder_result.optionalNestedEnum;
 }
-- (ForeignEnumLite) optionalForeignEnum {
-  return result.optionalForeignEnum;
+- (BOOL)hasOptionalNestedEnum {
+ return builder_result.hasOptionalNestedEnum;
 }
-- (TestAllTypesLite_Builder*) setOptionalForeignEnum:(ForeignEnumLite) value {
-  result.hasOptionalForeignEnum = YES;
-  result.optionalForeignEnum = value;
+- (TestAllTypesLite_Builder*)clearOptionalNestedEnum {
+  builder_result.hasOptionalNestedEnum = NO;
+  builder_result.optionalNestedEnum = TestAllTypesLite_NestedEnumFoo;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalForeignEnum {
-  result.hasOptionalForeignEnum = NO;
-  result.optionalForeignEnum = ForeignEnumLiteForeignLiteFoo;
+- (TestAllTypesLite_Builder*)setOptionalForeignEnum:(ForeignEnumLite) value {
+  NSAssert(ForeignEnumLiteIsValidValue(value), @"The value '%d' is invalid for ForeignEnumLite", value);
+  builder_result.hasOptionalForeignEnum = YES;
+  builder_result.optionalForeignEnum = value;
   return self;
 }
-- (BOOL) hasOptionalImportEnum {
-  return result.hasOptionalImportEnum;
+- (ForeignEnumLite)optionalForeignEnum {
+  return builder_result.optionalForeignEnum;
 }
-- (ImportEnumLite) optionalImportEnum {
-  return result.optionalImportEnum;
+- (BOOL)hasOptionalForeignEnum {
+ return builder_result.hasOptionalForeignEnum;
 }
-- (TestAllTypesLite_Builder*) setOptionalImportEnum:(ImportEnumLite) value {
-  result.hasOptionalImportEnum = YES;
-  result.optionalImportEnum = value;
+- (TestAllTypesLite_Builder*)clearOptionalForeignEnum {
+  builder_result.hasOptionalForeignEnum = NO;
+  builder_result.optionalForeignEnum = ForeignEnumLiteForeignLiteFoo;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalImportEnum {
-  result.hasOptionalImportEnum = NO;
-  result.optionalImportEnum = ImportEnumLiteImportLiteFoo;
+- (TestAllTypesLite_Builder*)setOptionalImportEnum:(ImportEnumLite) value {
+  NSAssert(ImportEnumLiteIsValidValue(value), @"The value '%d' is invalid for ImportEnumLite", value);
+  builder_result.hasOptionalImportEnum = YES;
+  builder_result.optionalImportEnum = value;
   return self;
 }
-- (BOOL) hasOptionalStringPiece {
-  return result.hasOptionalStringPiece;
+- (ImportEnumLite)optionalImportEnum {
+  return builder_result.optionalImportEnum;
 }
-- (NSString*) optionalStringPiece {
-  return result.optionalStringPiece;
+- (BOOL)hasOptionalImportEnum {
+ return builder_result.hasOptionalImportEnum;
 }
-- (TestAllTypesLite_Builder*) setOptionalStringPiece:(NSString*) value {
-  result.hasOptionalStringPiece = YES;
-  result.optionalStringPiece = value;
+- (TestAllTypesLite_Builder*)clearOptionalImportEnum {
+  builder_result.hasOptionalImportEnum = NO;
+  builder_result.optionalImportEnum = ImportEnumLiteImportLiteFoo;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalStringPiece {
-  result.hasOptionalStringPiece = NO;
-  result.optionalStringPiece = @"";
+- (TestAllTypesLite_Builder*) setOptionalStringPiece:(NSString*) value {
+  builder_result.hasOptionalStringPiece = YES;
+  builder_result.optionalStringPiece = value;
   return self;
 }
-- (BOOL) hasOptionalCord {
-  return result.hasOptionalCord;
+- (NSString*) optionalStringPiece {
+  return builder_result.optionalStringPiece;
 }
-- (NSString*) optionalCord {
-  return result.optionalCord;
+- (BOOL)hasOptionalStringPiece {
+ return builder_result.hasOptionalStringPiece;
 }
-- (TestAllTypesLite_Builder*) setOptionalCord:(NSString*) value {
-  result.hasOptionalCord = YES;
-  result.optionalCord = value;
+- (TestAllTypesLite_Builder*)clearOptionalStringPiece {
+  builder_result.hasOptionalStringPiece = NO;
+  builder_result.optionalStringPiece = @"";
   return self;
 }
-- (TestAllTypesLite_Builder*) clearOptionalCord {
-  result.hasOptionalCord = NO;
-  result.optionalCord = @"";
+- (TestAllTypesLite_Builder*) setOptionalCord:(NSString*) value {
+  builder_result.hasOptionalCord = YES;
+  builder_result.optionalCord = value;
   return self;
 }
-- (PBAppendableArray *)repeatedInt32 {
-  return result.repeatedInt32Array;
+- (NSString*) optionalCord {
+  return builder_result.optionalCord;
+}
+- (BOOL)hasOptionalCord {
+ return builder_result.hasOptionalCord;
 }
-- (int32_t)repeatedInt32AtIndex:(NSUInteger)index {
-  return [result repeatedInt32AtIndex:index];
+- (TestAllTypesLite_Builder*)clearOptionalCord {
+  builder_result.hasOptionalCord = NO;
+  builder_result.optionalCord = @"";
+  return self;
 }
 - (TestAllTypesLite_Builder *)addRepeatedInt32:(int32_t)value {
-  if (result.repeatedInt32Array == nil) {
-    result.repeatedInt32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (builder_result.repeatedInt32Array == nil) {
+    builder_result.repeatedInt32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
   }
-  [result.repeatedInt32Array addInt32:value];
+  [builder_result.repeatedInt32Array addInt32:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedInt32Array:(NSArray *)array {
-  result.repeatedInt32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  builder_result.repeatedInt32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedInt32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.repeatedInt32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
-  return self;
+- (PBAppendableArray *) repeatedInt32 {
+  return builder_result.repeatedInt32Array;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedInt32 {
-  result.repeatedInt32Array = nil;
+  builder_result.repeatedInt32Array = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedInt64 {
-  return result.repeatedInt64Array;
-}
-- (int64_t)repeatedInt64AtIndex:(NSUInteger)index {
-  return [result repeatedInt64AtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedInt64:(int64_t)value {
-  if (result.repeatedInt64Array == nil) {
-    result.repeatedInt64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (builder_result.repeatedInt64Array == nil) {
+    builder_result.repeatedInt64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
   }
-  [result.repeatedInt64Array addInt64:value];
+  [builder_result.repeatedInt64Array addInt64:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedInt64Array:(NSArray *)array {
-  result.repeatedInt64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  builder_result.repeatedInt64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedInt64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.repeatedInt64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
-  return self;
+- (PBAppendableArray *) repeatedInt64 {
+  return builder_result.repeatedInt64Array;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedInt64 {
-  result.repeatedInt64Array = nil;
+  builder_result.repeatedInt64Array = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedUint32 {
-  return result.repeatedUint32Array;
-}
-- (uint32_t)repeatedUint32AtIndex:(NSUInteger)index {
-  return [result repeatedUint32AtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedUint32:(uint32_t)value {
-  if (result.repeatedUint32Array == nil) {
-    result.repeatedUint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+  if (builder_result.repeatedUint32Array == nil) {
+    builder_result.repeatedUint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
   }
-  [result.repeatedUint32Array addUint32:value];
+  [builder_result.repeatedUint32Array addUint32:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedUint32Array:(NSArray *)array {
-  result.repeatedUint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  builder_result.repeatedUint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedUint32Values:(const uint32_t *)values count:(NSUInteger)count {
-  result.repeatedUint32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
-  return self;
+- (PBAppendableArray *) repeatedUint32 {
+  return builder_result.repeatedUint32Array;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedUint32 {
-  result.repeatedUint32Array = nil;
+  builder_result.repeatedUint32Array = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedUint64 {
-  return result.repeatedUint64Array;
-}
-- (uint64_t)repeatedUint64AtIndex:(NSUInteger)index {
-  return [result repeatedUint64AtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedUint64:(uint64_t)value {
-  if (result.repeatedUint64Array == nil) {
-    result.repeatedUint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+  if (builder_result.repeatedUint64Array == nil) {
+    builder_result.repeatedUint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
   }
-  [result.repeatedUint64Array addUint64:value];
+  [builder_result.repeatedUint64Array addUint64:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedUint64Array:(NSArray *)array {
-  result.repeatedUint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
+  builder_result.repeatedUint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedUint64Values:(const uint64_t *)values count:(NSUInteger)count {
-  result.repeatedUint64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
-  return self;
+- (PBAppendableArray *) repeatedUint64 {
+  return builder_result.repeatedUint64Array;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedUint64 {
-  result.repeatedUint64Array = nil;
+  builder_result.repeatedUint64Array = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedSint32 {
-  return result.repeatedSint32Array;
-}
-- (int32_t)repeatedSint32AtIndex:(NSUInteger)index {
-  return [result repeatedSint32AtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedSint32:(int32_t)value {
-  if (result.repeatedSint32Array == nil) {
-    result.repeatedSint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (builder_result.repeatedSint32Array == nil) {
+    builder_result.repeatedSint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
   }
-  [result.repeatedSint32Array addInt32:value];
+  [builder_result.repeatedSint32Array addInt32:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSint32Array:(NSArray *)array {
-  result.repeatedSint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  builder_result.repeatedSint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedSint32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.repeatedSint32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
-  return self;
+- (PBAppendableArray *) repeatedSint32 {
+  return builder_result.repeatedSint32Array;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedSint32 {
-  result.repeatedSint32Array = nil;
+  builder_result.repeatedSint32Array = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedSint64 {
-  return result.repeatedSint64Array;
-}
-- (int64_t)repeatedSint64AtIndex:(NSUInteger)index {
-  return [result repeatedSint64AtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedSint64:(int64_t)value {
-  if (result.repeatedSint64Array == nil) {
-    result.repeatedSint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (builder_result.repeatedSint64Array == nil) {
+    builder_result.repeatedSint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
   }
-  [result.repeatedSint64Array addInt64:value];
+  [builder_result.repeatedSint64Array addInt64:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSint64Array:(NSArray *)array {
-  result.repeatedSint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  builder_result.repeatedSint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedSint64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.repeatedSint64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
-  return self;
+- (PBAppendableArray *) repeatedSint64 {
+  return builder_result.repeatedSint64Array;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedSint64 {
-  result.repeatedSint64Array = nil;
+  builder_result.repeatedSint64Array = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedFixed32 {
-  return result.repeatedFixed32Array;
-}
-- (uint32_t)repeatedFixed32AtIndex:(NSUInteger)index {
-  return [result repeatedFixed32AtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedFixed32:(uint32_t)value {
-  if (result.repeatedFixed32Array == nil) {
-    result.repeatedFixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+  if (builder_result.repeatedFixed32Array == nil) {
+    builder_result.repeatedFixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
   }
-  [result.repeatedFixed32Array addUint32:value];
+  [builder_result.repeatedFixed32Array addUint32:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedFixed32Array:(NSArray *)array {
-  result.repeatedFixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  builder_result.repeatedFixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedFixed32Values:(const uint32_t *)values count:(NSUInteger)count {
-  result.repeatedFixed32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
-  return self;
+- (PBAppendableArray *) repeatedFixed32 {
+  return builder_result.repeatedFixed32Array;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedFixed32 {
-  result.repeatedFixed32Array = nil;
+  builder_result.repeatedFixed32Array = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedFixed64 {
-  return result.repeatedFixed64Array;
-}
-- (uint64_t)repeatedFixed64AtIndex:(NSUInteger)index {
-  return [result repeatedFixed64AtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedFixed64:(uint64_t)value {
-  if (result.repeatedFixed64Array == nil) {
-    result.repeatedFixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+  if (builder_result.repeatedFixed64Array == nil) {
+    builder_result.repeatedFixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
   }
-  [result.repeatedFixed64Array addUint64:value];
+  [builder_result.repeatedFixed64Array addUint64:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedFixed64Array:(NSArray *)array {
-  result.repeatedFixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
+  builder_result.repeatedFixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedFixed64Values:(const uint64_t *)values count:(NSUInteger)count {
-  result.repeatedFixed64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
-  return self;
+- (PBAppendableArray *) repeatedFixed64 {
+  return builder_result.repeatedFixed64Array;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedFixed64 {
-  result.repeatedFixed64Array = nil;
+  builder_result.repeatedFixed64Array = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedSfixed32 {
-  return result.repeatedSfixed32Array;
-}
-- (int32_t)repeatedSfixed32AtIndex:(NSUInteger)index {
-  return [result repeatedSfixed32AtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedSfixed32:(int32_t)value {
-  if (result.repeatedSfixed32Array == nil) {
-    result.repeatedSfixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (builder_result.repeatedSfixed32Array == nil) {
+    builder_result.repeatedSfixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
   }
-  [result.repeatedSfixed32Array addInt32:value];
+  [builder_result.repeatedSfixed32Array addInt32:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSfixed32Array:(NSArray *)array {
-  result.repeatedSfixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  builder_result.repeatedSfixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedSfixed32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.repeatedSfixed32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
-  return self;
+- (PBAppendableArray *) repeatedSfixed32 {
+  return builder_result.repeatedSfixed32Array;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedSfixed32 {
-  result.repeatedSfixed32Array = nil;
+  builder_result.repeatedSfixed32Array = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedSfixed64 {
-  return result.repeatedSfixed64Array;
-}
-- (int64_t)repeatedSfixed64AtIndex:(NSUInteger)index {
-  return [result repeatedSfixed64AtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedSfixed64:(int64_t)value {
-  if (result.repeatedSfixed64Array == nil) {
-    result.repeatedSfixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (builder_result.repeatedSfixed64Array == nil) {
+    builder_result.repeatedSfixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
   }
-  [result.repeatedSfixed64Array addInt64:value];
+  [builder_result.repeatedSfixed64Array addInt64:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedSfixed64Array:(NSArray *)array {
-  result.repeatedSfixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  builder_result.repeatedSfixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedSfixed64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.repeatedSfixed64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
-  return self;
+- (PBAppendableArray *) repeatedSfixed64 {
+  return builder_result.repeatedSfixed64Array;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedSfixed64 {
-  result.repeatedSfixed64Array = nil;
+  builder_result.repeatedSfixed64Array = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedFloat {
-  return result.repeatedFloatArray;
-}
-- (Float32)repeatedFloatAtIndex:(NSUInteger)index {
-  return [result repeatedFloatAtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedFloat:(Float32)value {
-  if (result.repeatedFloatArray == nil) {
-    result.repeatedFloatArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeFloat];
+  if (builder_result.repeatedFloatArray == nil) {
+    builder_result.repeatedFloatArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeFloat];
   }
-  [result.repeatedFloatArray addFloat:value];
+  [builder_result.repeatedFloatArray addFloat:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedFloatArray:(NSArray *)array {
-  result.repeatedFloatArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeFloat];
+  builder_result.repeatedFloatArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeFloat];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedFloatValues:(const Float32 *)values count:(NSUInteger)count {
-  result.repeatedFloatArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeFloat];
-  return self;
+- (PBAppendableArray *) repeatedFloat {
+  return builder_result.repeatedFloatArray;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedFloat {
-  result.repeatedFloatArray = nil;
+  builder_result.repeatedFloatArray = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedDouble {
-  return result.repeatedDoubleArray;
-}
-- (Float64)repeatedDoubleAtIndex:(NSUInteger)index {
-  return [result repeatedDoubleAtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedDouble:(Float64)value {
-  if (result.repeatedDoubleArray == nil) {
-    result.repeatedDoubleArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeDouble];
+  if (builder_result.repeatedDoubleArray == nil) {
+    builder_result.repeatedDoubleArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeDouble];
   }
-  [result.repeatedDoubleArray addDouble:value];
+  [builder_result.repeatedDoubleArray addDouble:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedDoubleArray:(NSArray *)array {
-  result.repeatedDoubleArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeDouble];
+  builder_result.repeatedDoubleArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeDouble];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedDoubleValues:(const Float64 *)values count:(NSUInteger)count {
-  result.repeatedDoubleArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeDouble];
-  return self;
+- (PBAppendableArray *) repeatedDouble {
+  return builder_result.repeatedDoubleArray;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedDouble {
-  result.repeatedDoubleArray = nil;
+  builder_result.repeatedDoubleArray = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedBool {
-  return result.repeatedBoolArray;
-}
-- (BOOL)repeatedBoolAtIndex:(NSUInteger)index {
-  return [result repeatedBoolAtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedBool:(BOOL)value {
-  if (result.repeatedBoolArray == nil) {
-    result.repeatedBoolArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeBool];
+  if (builder_result.repeatedBoolArray == nil) {
+    builder_result.repeatedBoolArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeBool];
   }
-  [result.repeatedBoolArray addBool:value];
+  [builder_result.repeatedBoolArray addBool:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedBoolArray:(NSArray *)array {
-  result.repeatedBoolArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeBool];
+  builder_result.repeatedBoolArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeBool];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedBoolValues:(const BOOL *)values count:(NSUInteger)count {
-  result.repeatedBoolArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeBool];
-  return self;
+- (PBAppendableArray *) repeatedBool {
+  return builder_result.repeatedBoolArray;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedBool {
-  result.repeatedBoolArray = nil;
+  builder_result.repeatedBoolArray = nil;
   return self;
 }
-- (NSMutableArray *)repeatedString {
-  return result.repeatedStringArray;
-}
-- (NSString*)repeatedStringAtIndex:(NSUInteger)index {
-  return [result repeatedStringAtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedString:(NSString*)value {
-  if (result.repeatedStringArray == nil) {
-    result.repeatedStringArray = [[NSMutableArray alloc] init];
+  if (builder_result.repeatedStringArray == nil) {
+    builder_result.repeatedStringArray = [[NSMutableArray alloc]init];
   }
-  [result.repeatedStringArray addObject:value];
+  [builder_result.repeatedStringArray addObject:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedStringArray:(NSArray *)array {
-    result.repeatedStringArray = [[NSMutableArray alloc ] initWithArray:array] ;
+  builder_result.repeatedStringArray = [[NSMutableArray alloc] initWithArray:array];
   return self;
 }
-
-- (TestAllTypesLite_Builder *)clearRepeatedString {
-  result.repeatedStringArray = nil;
-  return self;
++ (Class)expectedElementTypeForRepeatedStringArray {
+  return [NSString class];
 }
-- (NSMutableArray *)repeatedBytes {
-  return result.repeatedBytesArray;
+- (NSMutableArray *) repeatedString {
+  return builder_result.repeatedStringArray;
 }
-- (NSData*)repeatedBytesAtIndex:(NSUInteger)index {
-  return [result repeatedBytesAtIndex:index];
+- (TestAllTypesLite_Builder *)clearRepeatedString {
+  builder_result.repeatedStringArray = nil;
+  return self;
 }
 - (TestAllTypesLite_Builder *)addRepeatedBytes:(NSData*)value {
-  if (result.repeatedBytesArray == nil) {
-    result.repeatedBytesArray = [[NSMutableArray alloc] init];
+  if (builder_result.repeatedBytesArray == nil) {
+    builder_result.repeatedBytesArray = [[NSMutableArray alloc]init];
   }
-  [result.repeatedBytesArray addObject:value];
+  [builder_result.repeatedBytesArray addObject:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedBytesArray:(NSArray *)array {
-  result.repeatedBytesArray = [[NSMutableArray alloc ] initWithArray:array];
+  builder_result.repeatedBytesArray = [[NSMutableArray alloc] initWithArray:array];
   return self;
 }
-
-- (TestAllTypesLite_Builder *)clearRepeatedBytes {
-  result.repeatedBytesArray = nil;
-  return self;
++ (Class)expectedElementTypeForRepeatedBytesArray {
+  return [NSData class];
 }
-- (NSMutableArray *)repeatedGroup {
-  return result.repeatedGroupArray;
+- (NSMutableArray *) repeatedBytes {
+  return builder_result.repeatedBytesArray;
 }
-- (TestAllTypesLite_RepeatedGroup*)repeatedGroupAtIndex:(NSUInteger)index {
-  return [result repeatedGroupAtIndex:index];
+- (TestAllTypesLite_Builder *)clearRepeatedBytes {
+  builder_result.repeatedBytesArray = nil;
+  return self;
 }
 - (TestAllTypesLite_Builder *)addRepeatedGroup:(TestAllTypesLite_RepeatedGroup*)value {
-  if (result.repeatedGroupArray == nil) {
-    result.repeatedGroupArray = [[NSMutableArray alloc] init];
+  if (builder_result.repeatedGroupArray == nil) {
+    builder_result.repeatedGroupArray = [[NSMutableArray alloc]init];
   }
-  [result.repeatedGroupArray addObject:value];
+  [builder_result.repeatedGroupArray addObject:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedGroupArray:(NSArray *)array {
-  result.repeatedGroupArray = [[NSMutableArray alloc ] initWithArray:array];
+  builder_result.repeatedGroupArray = [[NSMutableArray alloc]initWithArray:array];
   return self;
 }
-
-- (TestAllTypesLite_Builder *)clearRepeatedGroup {
-  result.repeatedGroupArray = nil;
-  return self;
++ (Class)expectedElementTypeForRepeatedGroupArray {
+  return [TestAllTypesLite_RepeatedGroup class];
 }
-- (NSMutableArray *)repeatedNestedMessage {
-  return result.repeatedNestedMessageArray;
+- (NSMutableArray *)repeatedGroup {
+  return builder_result.repeatedGroupArray;
 }
-- (TestAllTypesLite_NestedMessage*)repeatedNestedMessageAtIndex:(NSUInteger)index {
-  return [result repeatedNestedMessageAtIndex:index];
+- (TestAllTypesLite_Builder *)clearRepeatedGroup {
+  builder_result.repeatedGroupArray = nil;
+  return self;
 }
 - (TestAllTypesLite_Builder *)addRepeatedNestedMessage:(TestAllTypesLite_NestedMessage*)value {
-  if (result.repeatedNestedMessageArray == nil) {
-    result.repeatedNestedMessageArray = [[NSMutableArray alloc] init];
+  if (builder_result.repeatedNestedMessageArray == nil) {
+    builder_result.repeatedNestedMessageArray = [[NSMutableArray alloc]init];
   }
-  [result.repeatedNestedMessageArray addObject:value];
+  [builder_result.repeatedNestedMessageArray addObject:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedNestedMessageArray:(NSArray *)array {
-  result.repeatedNestedMessageArray = [[NSMutableArray alloc ] initWithArray:array];
+  builder_result.repeatedNestedMessageArray = [[NSMutableArray alloc]initWithArray:array];
   return self;
 }
-
-- (TestAllTypesLite_Builder *)clearRepeatedNestedMessage {
-  result.repeatedNestedMessageArray = nil;
-  return self;
++ (Class)expectedElementTypeForRepeatedNestedMessageArray {
+  return [TestAllTypesLite_NestedMessage class];
 }
-- (NSMutableArray *)repeatedForeignMessage {
-  return result.repeatedForeignMessageArray;
+- (NSMutableArray *)repeatedNestedMessage {
+  return builder_result.repeatedNestedMessageArray;
 }
-- (ForeignMessageLite*)repeatedForeignMessageAtIndex:(NSUInteger)index {
-  return [result repeatedForeignMessageAtIndex:index];
+- (TestAllTypesLite_Builder *)clearRepeatedNestedMessage {
+  builder_result.repeatedNestedMessageArray = nil;
+  return self;
 }
 - (TestAllTypesLite_Builder *)addRepeatedForeignMessage:(ForeignMessageLite*)value {
-  if (result.repeatedForeignMessageArray == nil) {
-    result.repeatedForeignMessageArray = [[NSMutableArray alloc] init];
+  if (builder_result.repeatedForeignMessageArray == nil) {
+    builder_result.repeatedForeignMessageArray = [[NSMutableArray alloc]init];
   }
-  [result.repeatedForeignMessageArray addObject:value];
+  [builder_result.repeatedForeignMessageArray addObject:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedForeignMessageArray:(NSArray *)array {
-  result.repeatedForeignMessageArray = [[NSMutableArray alloc ] initWithArray:array];
+  builder_result.repeatedForeignMessageArray = [[NSMutableArray alloc]initWithArray:array];
   return self;
 }
-
-- (TestAllTypesLite_Builder *)clearRepeatedForeignMessage {
-  result.repeatedForeignMessageArray = nil;
-  return self;
++ (Class)expectedElementTypeForRepeatedForeignMessageArray {
+  return [ForeignMessageLite class];
 }
-- (NSMutableArray *)repeatedImportMessage {
-  return result.repeatedImportMessageArray;
+- (NSMutableArray *)repeatedForeignMessage {
+  return builder_result.repeatedForeignMessageArray;
 }
-- (ImportMessageLite*)repeatedImportMessageAtIndex:(NSUInteger)index {
-  return [result repeatedImportMessageAtIndex:index];
+- (TestAllTypesLite_Builder *)clearRepeatedForeignMessage {
+  builder_result.repeatedForeignMessageArray = nil;
+  return self;
 }
 - (TestAllTypesLite_Builder *)addRepeatedImportMessage:(ImportMessageLite*)value {
-  if (result.repeatedImportMessageArray == nil) {
-    result.repeatedImportMessageArray = [[NSMutableArray alloc] init];
+  if (builder_result.repeatedImportMessageArray == nil) {
+    builder_result.repeatedImportMessageArray = [[NSMutableArray alloc]init];
   }
-  [result.repeatedImportMessageArray addObject:value];
+  [builder_result.repeatedImportMessageArray addObject:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedImportMessageArray:(NSArray *)array {
-  result.repeatedImportMessageArray = [[NSMutableArray alloc ] initWithArray:array];
+  builder_result.repeatedImportMessageArray = [[NSMutableArray alloc]initWithArray:array];
   return self;
 }
-
-- (TestAllTypesLite_Builder *)clearRepeatedImportMessage {
-  result.repeatedImportMessageArray = nil;
-  return self;
++ (Class)expectedElementTypeForRepeatedImportMessageArray {
+  return [ImportMessageLite class];
 }
-- (PBAppendableArray *)repeatedNestedEnum {
-  return result.repeatedNestedEnumArray;
+- (NSMutableArray *)repeatedImportMessage {
+  return builder_result.repeatedImportMessageArray;
 }
-- (TestAllTypesLite_NestedEnum)repeatedNestedEnumAtIndex:(NSUInteger)index {
-  return [result repeatedNestedEnumAtIndex:index];
+- (TestAllTypesLite_Builder *)clearRepeatedImportMessage {
+  builder_result.repeatedImportMessageArray = nil;
+  return self;
 }
 - (TestAllTypesLite_Builder *)addRepeatedNestedEnum:(TestAllTypesLite_NestedEnum)value {
-  if (result.repeatedNestedEnumArray == nil) {
-    result.repeatedNestedEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (builder_result.repeatedNestedEnumArray == nil) {
+    builder_result.repeatedNestedEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
   }
-  [result.repeatedNestedEnumArray addInt32:value];
+  [builder_result.repeatedNestedEnumArray addInt32:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedNestedEnumArray:(NSArray *)array {
-  result.repeatedNestedEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  builder_result.repeatedNestedEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedNestedEnumValues:(const TestAllTypesLite_NestedEnum *)values count:(NSUInteger)count {
-  result.repeatedNestedEnumArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
-  return self;
+- (PBAppendableArray *)repeatedNestedEnum {
+  return builder_result.repeatedNestedEnumArray;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedNestedEnum {
-  result.repeatedNestedEnumArray = nil;
+  builder_result.repeatedNestedEnumArray = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedForeignEnum {
-  return result.repeatedForeignEnumArray;
-}
-- (ForeignEnumLite)repeatedForeignEnumAtIndex:(NSUInteger)index {
-  return [result repeatedForeignEnumAtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedForeignEnum:(ForeignEnumLite)value {
-  if (result.repeatedForeignEnumArray == nil) {
-    result.repeatedForeignEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (builder_result.repeatedForeignEnumArray == nil) {
+    builder_result.repeatedForeignEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
   }
-  [result.repeatedForeignEnumArray addInt32:value];
+  [builder_result.repeatedForeignEnumArray addInt32:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedForeignEnumArray:(NSArray *)array {
-  result.repeatedForeignEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  builder_result.repeatedForeignEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedForeignEnumValues:(const ForeignEnumLite *)values count:(NSUInteger)count {
-  result.repeatedForeignEnumArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
-  return self;
+- (PBAppendableArray *)repeatedForeignEnum {
+  return builder_result.repeatedForeignEnumArray;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedForeignEnum {
-  result.repeatedForeignEnumArray = nil;
+  builder_result.repeatedForeignEnumArray = nil;
   return self;
 }
-- (PBAppendableArray *)repeatedImportEnum {
-  return result.repeatedImportEnumArray;
-}
-- (ImportEnumLite)repeatedImportEnumAtIndex:(NSUInteger)index {
-  return [result repeatedImportEnumAtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedImportEnum:(ImportEnumLite)value {
-  if (result.repeatedImportEnumArray == nil) {
-    result.repeatedImportEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (builder_result.repeatedImportEnumArray == nil) {
+    builder_result.repeatedImportEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
   }
-  [result.repeatedImportEnumArray addInt32:value];
+  [builder_result.repeatedImportEnumArray addInt32:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedImportEnumArray:(NSArray *)array {
-  result.repeatedImportEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  builder_result.repeatedImportEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
   return self;
 }
-- (TestAllTypesLite_Builder *)setRepeatedImportEnumValues:(const ImportEnumLite *)values count:(NSUInteger)count {
-  result.repeatedImportEnumArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
-  return self;
+- (PBAppendableArray *)repeatedImportEnum {
+  return builder_result.repeatedImportEnumArray;
 }
 - (TestAllTypesLite_Builder *)clearRepeatedImportEnum {
-  result.repeatedImportEnumArray = nil;
+  builder_result.repeatedImportEnumArray = nil;
   return self;
 }
-- (NSMutableArray *)repeatedStringPiece {
-  return result.repeatedStringPieceArray;
-}
-- (NSString*)repeatedStringPieceAtIndex:(NSUInteger)index {
-  return [result repeatedStringPieceAtIndex:index];
-}
 - (TestAllTypesLite_Builder *)addRepeatedStringPiece:(NSString*)value {
-  if (result.repeatedStringPieceArray == nil) {
-    result.repeatedStringPieceArray = [[NSMutableArray alloc] init];
+  if (builder_result.repeatedStringPieceArray == nil) {
+    builder_result.repeatedStringPieceArray = [[NSMutableArray alloc]init];
   }
-  [result.repeatedStringPieceArray addObject:value];
+  [builder_result.repeatedStringPieceArray addObject:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedStringPieceArray:(NSArray *)array {
-  result.repeatedStringPieceArray = [[NSMutableArray alloc ] initWithArray:array];
+  builder_result.repeatedStringPieceArray = [[NSMutableArray alloc] initWithArray:array];
   return self;
 }
-
-- (TestAllTypesLite_Builder *)clearRepeatedStringPiece {
-  result.repeatedStringPieceArray = nil;
-  return self;
++ (Class)expectedElementTypeForRepeatedStringPieceArray {
+  return [NSString class];
 }
-- (NSMutableArray *)repeatedCord {
-  return result.repeatedCordArray;
+- (NSMutableArray *) repeatedStringPiece {
+  return builder_result.repeatedStringPieceArray;
 }
-- (NSString*)repeatedCordAtIndex:(NSUInteger)index {
-  return [result repeatedCordAtIndex:index];
+- (TestAllTypesLite_Builder *)clearRepeatedStringPiece {
+  builder_result.repeatedStringPieceArray = nil;
+  return self;
 }
 - (TestAllTypesLite_Builder *)addRepeatedCord:(NSString*)value {
-  if (result.repeatedCordArray == nil) {
-    result.repeatedCordArray = [[NSMutableArray alloc] init];
+  if (builder_result.repeatedCordArray == nil) {
+    builder_result.repeatedCordArray = [[NSMutableArray alloc]init];
   }
-  [result.repeatedCordArray addObject:value];
+  [builder_result.repeatedCordArray addObject:value];
   return self;
 }
 - (TestAllTypesLite_Builder *)setRepeatedCordArray:(NSArray *)array {
-  result.repeatedCordArray = [[NSMutableArray alloc ] initWithArray:array];
+  builder_result.repeatedCordArray = [[NSMutableArray alloc] initWithArray:array];
   return self;
 }
-
++ (Class)expectedElementTypeForRepeatedCordArray {
+  return [NSString class];
+}
+- (NSMutableArray *) repeatedCord {
+  return builder_result.repeatedCordArray;
+}
 - (TestAllTypesLite_Builder *)clearRepeatedCord {
-  result.repeatedCordArray = nil;
+  builder_result.repeatedCordArray = nil;
   return self;
 }
-- (BOOL) hasDefaultInt32 {
-  return result.hasDefaultInt32;
+- (TestAllTypesLite_Builder*) setDefaultInt32:(int32_t) value {
+  builder_result.hasDefaultInt32 = YES;
+  builder_result.defaultInt32 = value;
+  return self;
 }
 - (int32_t) defaultInt32 {
-  return result.defaultInt32;
+  return builder_result.defaultInt32;
 }
-- (TestAllTypesLite_Builder*) setDefaultInt32:(int32_t) value {
-  result.hasDefaultInt32 = YES;
-  result.defaultInt32 = value;
-  return self;
+- (BOOL)hasDefaultInt32 {
+ return builder_result.hasDefaultInt32;
 }
-- (TestAllTypesLite_Builder*) clearDefaultInt32 {
-  result.hasDefaultInt32 = NO;
-  result.defaultInt32 = 41;
+- (TestAllTypesLite_Builder*)clearDefaultInt32 {
+  builder_result.hasDefaultInt32 = NO;
+  builder_result.defaultInt32 = 41;
   return self;
 }
-- (BOOL) hasDefaultInt64 {
-  return result.hasDefaultInt64;
+- (TestAllTypesLite_Builder*) setDefaultInt64:(int64_t) value {
+  builder_result.hasDefaultInt64 = YES;
+  builder_result.defaultInt64 = value;
+  return self;
 }
 - (int64_t) defaultInt64 {
-  return result.defaultInt64;
+  return builder_result.defaultInt64;
 }
-- (TestAllTypesLite_Builder*) setDefaultInt64:(int64_t) value {
-  result.hasDefaultInt64 = YES;
-  result.defaultInt64 = value;
-  return self;
+- (BOOL)hasDefaultInt64 {
+ return builder_result.hasDefaultInt64;
 }
-- (TestAllTypesLite_Builder*) clearDefaultInt64 {
-  result.hasDefaultInt64 = NO;
-  result.defaultInt64 = 42L;
+- (TestAllTypesLite_Builder*)clearDefaultInt64 {
+  builder_result.hasDefaultInt64 = NO;
+  builder_result.defaultInt64 = 42L;
   return self;
 }
-- (BOOL) hasDefaultUint32 {
-  return result.hasDefaultUint32;
+- (TestAllTypesLite_Builder*) setDefaultUint32:(uint32_t) value {
+  builder_result.hasDefaultUint32 = YES;
+  builder_result.defaultUint32 = value;
+  return self;
 }
 - (uint32_t) defaultUint32 {
-  return result.defaultUint32;
+  return builder_result.defaultUint32;
 }
-- (TestAllTypesLite_Builder*) setDefaultUint32:(uint32_t) value {
-  result.hasDefaultUint32 = YES;
-  result.defaultUint32 = value;
-  return self;
+- (BOOL)hasDefaultUint32 {
+ return builder_result.hasDefaultUint32;
 }
-- (TestAllTypesLite_Builder*) clearDefaultUint32 {
-  result.hasDefaultUint32 = NO;
-  result.defaultUint32 = 43;
+- (TestAllTypesLite_Builder*)clearDefaultUint32 {
+  builder_result.hasDefaultUint32 = NO;
+  builder_result.defaultUint32 = 43;
   return self;
 }
-- (BOOL) hasDefaultUint64 {
-  return result.hasDefaultUint64;
+- (TestAllTypesLite_Builder*) setDefaultUint64:(uint64_t) value {
+  builder_result.hasDefaultUint64 = YES;
+  builder_result.defaultUint64 = value;
+  return self;
 }
 - (uint64_t) defaultUint64 {
-  return result.defaultUint64;
+  return builder_result.defaultUint64;
 }
-- (TestAllTypesLite_Builder*) setDefaultUint64:(uint64_t) value {
-  result.hasDefaultUint64 = YES;
-  result.defaultUint64 = value;
-  return self;
+- (BOOL)hasDefaultUint64 {
+ return builder_result.hasDefaultUint64;
 }
-- (TestAllTypesLite_Builder*) clearDefaultUint64 {
-  result.hasDefaultUint64 = NO;
-  result.defaultUint64 = 44L;
+- (TestAllTypesLite_Builder*)clearDefaultUint64 {
+  builder_result.hasDefaultUint64 = NO;
+  builder_result.defaultUint64 = 44L;
   return self;
 }
-- (BOOL) hasDefaultSint32 {
-  return result.hasDefaultSint32;
+- (TestAllTypesLite_Builder*) setDefaultSint32:(int32_t) value {
+  builder_result.hasDefaultSint32 = YES;
+  builder_result.defaultSint32 = value;
+  return self;
 }
 - (int32_t) defaultSint32 {
-  return result.defaultSint32;
+  return builder_result.defaultSint32;
 }
-- (TestAllTypesLite_Builder*) setDefaultSint32:(int32_t) value {
-  result.hasDefaultSint32 = YES;
-  result.defaultSint32 = value;
-  return self;
+- (BOOL)hasDefaultSint32 {
+ return builder_result.hasDefaultSint32;
 }
-- (TestAllTypesLite_Builder*) clearDefaultSint32 {
-  result.hasDefaultSint32 = NO;
-  result.defaultSint32 = -45;
+- (TestAllTypesLite_Builder*)clearDefaultSint32 {
+  builder_result.hasDefaultSint32 = NO;
+  builder_result.defaultSint32 = -45;
   return self;
 }
-- (BOOL) hasDefaultSint64 {
-  return result.hasDefaultSint64;
+- (TestAllTypesLite_Builder*) setDefaultSint64:(int64_t) value {
+  builder_result.hasDefaultSint64 = YES;
+  builder_result.defaultSint64 = value;
+  return self;
 }
 - (int64_t) defaultSint64 {
-  return result.defaultSint64;
+  return builder_result.defaultSint64;
 }
-- (TestAllTypesLite_Builder*) setDefaultSint64:(int64_t) value {
-  result.hasDefaultSint64 = YES;
-  result.defaultSint64 = value;
-  return self;
+- (BOOL)hasDefaultSint64 {
+ return builder_result.hasDefaultSint64;
 }
-- (TestAllTypesLite_Builder*) clearDefaultSint64 {
-  result.hasDefaultSint64 = NO;
-  result.defaultSint64 = 46L;
+- (TestAllTypesLite_Builder*)clearDefaultSint64 {
+  builder_result.hasDefaultSint64 = NO;
+  builder_result.defaultSint64 = 46L;
   return self;
 }
-- (BOOL) hasDefaultFixed32 {
-  return result.hasDefaultFixed32;
+- (TestAllTypesLite_Builder*) setDefaultFixed32:(uint32_t) value {
+  builder_result.hasDefaultFixed32 = YES;
+  builder_result.defaultFixed32 = value;
+  return self;
 }
 - (uint32_t) defaultFixed32 {
-  return result.defaultFixed32;
+  return builder_result.defaultFixed32;
 }
-- (TestAllTypesLite_Builder*) setDefaultFixed32:(uint32_t) value {
-  result.hasDefaultFixed32 = YES;
-  result.defaultFixed32 = value;
-  return self;
+- (BOOL)hasDefaultFixed32 {
+ return builder_result.hasDefaultFixed32;
 }
-- (TestAllTypesLite_Builder*) clearDefaultFixed32 {
-  result.hasDefaultFixed32 = NO;
-  result.defaultFixed32 = 47;
+- (TestAllTypesLite_Builder*)clearDefaultFixed32 {
+  builder_result.hasDefaultFixed32 = NO;
+  builder_result.defaultFixed32 = 47;
   return self;
 }
-- (BOOL) hasDefaultFixed64 {
-  return result.hasDefaultFixed64;
+- (TestAllTypesLite_Builder*) setDefaultFixed64:(uint64_t) value {
+  builder_result.hasDefaultFixed64 = YES;
+  builder_result.defaultFixed64 = value;
+  return self;
 }
 - (uint64_t) defaultFixed64 {
-  return result.defaultFixed64;
+  return builder_result.defaultFixed64;
 }
-- (TestAllTypesLite_Builder*) setDefaultFixed64:(uint64_t) value {
-  result.hasDefaultFixed64 = YES;
-  result.defaultFixed64 = value;
-  return self;
+- (BOOL)hasDefaultFixed64 {
+ return builder_result.hasDefaultFixed64;
 }
-- (TestAllTypesLite_Builder*) clearDefaultFixed64 {
-  result.hasDefaultFixed64 = NO;
-  result.defaultFixed64 = 48L;
+- (TestAllTypesLite_Builder*)clearDefaultFixed64 {
+  builder_result.hasDefaultFixed64 = NO;
+  builder_result.defaultFixed64 = 48L;
   return self;
 }
-- (BOOL) hasDefaultSfixed32 {
-  return result.hasDefaultSfixed32;
+- (TestAllTypesLite_Builder*) setDefaultSfixed32:(int32_t) value {
+  builder_result.hasDefaultSfixed32 = YES;
+  builder_result.defaultSfixed32 = value;
+  return self;
 }
 - (int32_t) defaultSfixed32 {
-  return result.defaultSfixed32;
+  return builder_result.defaultSfixed32;
 }
-- (TestAllTypesLite_Builder*) setDefaultSfixed32:(int32_t) value {
-  result.hasDefaultSfixed32 = YES;
-  result.defaultSfixed32 = value;
-  return self;
+- (BOOL)hasDefaultSfixed32 {
+ return builder_result.hasDefaultSfixed32;
 }
-- (TestAllTypesLite_Builder*) clearDefaultSfixed32 {
-  result.hasDefaultSfixed32 = NO;
-  result.defaultSfixed32 = 49;
+- (TestAllTypesLite_Builder*)clearDefaultSfixed32 {
+  builder_result.hasDefaultSfixed32 = NO;
+  builder_result.defaultSfixed32 = 49;
   return self;
 }
-- (BOOL) hasDefaultSfixed64 {
-  return result.hasDefaultSfixed64;
+- (TestAllTypesLite_Builder*) setDefaultSfixed64:(int64_t) value {
+  builder_result.hasDefaultSfixed64 = YES;
+  builder_result.defaultSfixed64 = value;
+  return self;
 }
 - (int64_t) defaultSfixed64 {
-  return result.defaultSfixed64;
+  return builder_result.defaultSfixed64;
 }
-- (TestAllTypesLite_Builder*) setDefaultSfixed64:(int64_t) value {
-  result.hasDefaultSfixed64 = YES;
-  result.defaultSfixed64 = value;
-  return self;
+- (BOOL)hasDefaultSfixed64 {
+ return builder_result.hasDefaultSfixed64;
 }
-- (TestAllTypesLite_Builder*) clearDefaultSfixed64 {
-  result.hasDefaultSfixed64 = NO;
-  result.defaultSfixed64 = -50L;
+- (TestAllTypesLite_Builder*)clearDefaultSfixed64 {
+  builder_result.hasDefaultSfixed64 = NO;
+  builder_result.defaultSfixed64 = -50L;
   return self;
 }
-- (BOOL) hasDefaultFloat {
-  return result.hasDefaultFloat;
+- (TestAllTypesLite_Builder*) setDefaultFloat:(Float32) value {
+  builder_result.hasDefaultFloat = YES;
+  builder_result.defaultFloat = value;
+  return self;
 }
 - (Float32) defaultFloat {
-  return result.defaultFloat;
+  return builder_result.defaultFloat;
 }
-- (TestAllTypesLite_Builder*) setDefaultFloat:(Float32) value {
-  result.hasDefaultFloat = YES;
-  result.defaultFloat = value;
-  return self;
+- (BOOL)hasDefaultFloat {
+ return builder_result.hasDefaultFloat;
 }
-- (TestAllTypesLite_Builder*) clearDefaultFloat {
-  result.hasDefaultFloat = NO;
-  result.defaultFloat = 51.5;
+- (TestAllTypesLite_Builder*)clearDefaultFloat {
+  builder_result.hasDefaultFloat = NO;
+  builder_result.defaultFloat = 51.5;
   return self;
 }
-- (BOOL) hasDefaultDouble {
-  return result.hasDefaultDouble;
+- (TestAllTypesLite_Builder*) setDefaultDouble:(Float64) value {
+  builder_result.hasDefaultDouble = YES;
+  builder_result.defaultDouble = value;
+  return self;
 }
 - (Float64) defaultDouble {
-  return result.defaultDouble;
+  return builder_result.defaultDouble;
 }
-- (TestAllTypesLite_Builder*) setDefaultDouble:(Float64) value {
-  result.hasDefaultDouble = YES;
-  result.defaultDouble = value;
-  return self;
+- (BOOL)hasDefaultDouble {
+ return builder_result.hasDefaultDouble;
 }
-- (TestAllTypesLite_Builder*) clearDefaultDouble {
-  result.hasDefaultDouble = NO;
-  result.defaultDouble = 52000;
+- (TestAllTypesLite_Builder*)clearDefaultDouble {
+  builder_result.hasDefaultDouble = NO;
+  builder_result.defaultDouble = 52000;
   return self;
 }
-- (BOOL) hasDefaultBool {
-  return result.hasDefaultBool;
+- (TestAllTypesLite_Builder*) setDefaultBool:(BOOL) value {
+  builder_result.hasDefaultBool = YES;
+  builder_result.defaultBool = value;
+  return self;
 }
 - (BOOL) defaultBool {
-  return result.defaultBool;
+  return builder_result.defaultBool;
 }
-- (TestAllTypesLite_Builder*) setDefaultBool:(BOOL) value {
-  result.hasDefaultBool = YES;
-  result.defaultBool = value;
-  return self;
+- (BOOL)hasDefaultBool {
+ return builder_result.hasDefaultBool;
 }
-- (TestAllTypesLite_Builder*) clearDefaultBool {
-  result.hasDefaultBool = NO;
-  result.defaultBool = YES;
+- (TestAllTypesLite_Builder*)clearDefaultBool {
+  builder_result.hasDefaultBool = NO;
+  builder_result.defaultBool = YES;
   return self;
 }
-- (BOOL) hasDefaultString {
-  return result.hasDefaultString;
+- (TestAllTypesLite_Builder*) setDefaultString:(NSString*) value {
+  builder_result.hasDefaultString = YES;
+  builder_result.defaultString = value;
+  return self;
 }
 - (NSString*) defaultString {
-  return result.defaultString;
+  return builder_result.defaultString;
 }
-- (TestAllTypesLite_Builder*) setDefaultString:(NSString*) value {
-  result.hasDefaultString = YES;
-  result.defaultString = value;
-  return self;
+- (BOOL)hasDefaultString {
+ return builder_result.hasDefaultString;
 }
-- (TestAllTypesLite_Builder*) clearDefaultString {
-  result.hasDefaultString = NO;
-  result.defaultString = @"hello";
+- (TestAllTypesLite_Builder*)clearDefaultString {
+  builder_result.hasDefaultString = NO;
+  builder_result.defaultString = @"hello";
   return self;
 }
-- (BOOL) hasDefaultBytes {
-  return result.hasDefaultBytes;
+- (TestAllTypesLite_Builder*) setDefaultBytes:(NSData*) value {
+  builder_result.hasDefaultBytes = YES;
+  builder_result.defaultBytes = value;
+  return self;
 }
 - (NSData*) defaultBytes {
-  return result.defaultBytes;
+  return builder_result.defaultBytes;
 }
-- (TestAllTypesLite_Builder*) setDefaultBytes:(NSData*) value {
-  result.hasDefaultBytes = YES;
-  result.defaultBytes = value;
+- (BOOL)hasDefaultBytes {
+ return builder_result.hasDefaultBytes;
+}
+- (TestAllTypesLite_Builder*)clearDefaultBytes {
+  builder_result.hasDefaultBytes = NO;
+  builder_result.defaultBytes = [NSData dataWithBytes:"world" length:5];
   return self;
 }
-- (TestAllTypesLite_Builder*) clearDefaultBytes {
-  result.hasDefaultBytes = NO;
-  result.defaultBytes = [NSData dataWithBytes:"world" length:5];
+- (TestAllTypesLite_Builder*)setDefaultNestedEnum:(TestAllTypesLite_NestedEnum) value {
+  NSAssert(TestAllTypesLite_NestedEnumIsValidValue(value), @"The value '%d' is invalid for TestAllTypesLite_NestedEnum", value);
+  builder_result.hasDefaultNestedEnum = YES;
+  builder_result.defaultNestedEnum = value;
   return self;
 }
-- (BOOL) hasDefaultNestedEnum {
-  return result.hasDefaultNestedEnum;
+- (TestAllTypesLite_NestedEnum)defaultNestedEnum {
+  return builder_result.defaultNestedEnum;
 }
-- (TestAllTypesLite_NestedEnum) defaultNestedEnum {
-  return result.defaultNestedEnum;
+- (BOOL)hasDefaultNestedEnum {
+ return builder_result.hasDefaultNestedEnum;
 }
-- (TestAllTypesLite_Builder*) setDefaultNestedEnum:(TestAllTypesLite_NestedEnum) value {
-  result.hasDefaultNestedEnum = YES;
-  result.defaultNestedEnum = value;
+- (TestAllTypesLite_Builder*)clearDefaultNestedEnum {
+  builder_result.hasDefaultNestedEnum = NO;
+  builder_result.defaultNestedEnum = TestAllTypesLite_NestedEnumBar;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearDefaultNestedEnum {
-  result.hasDefaultNestedEnum = NO;
-  result.defaultNestedEnum = TestAllTypesLite_NestedEnumBar;
+- (TestAllTypesLite_Builder*)setDefaultForeignEnum:(ForeignEnumLite) value {
+  NSAssert(ForeignEnumLiteIsValidValue(value), @"The value '%d' is invalid for ForeignEnumLite", value);
+  builder_result.hasDefaultForeignEnum = YES;
+  builder_result.defaultForeignEnum = value;
   return self;
 }
-- (BOOL) hasDefaultForeignEnum {
-  return result.hasDefaultForeignEnum;
+- (ForeignEnumLite)defaultForeignEnum {
+  return builder_result.defaultForeignEnum;
 }
-- (ForeignEnumLite) defaultForeignEnum {
-  return result.defaultForeignEnum;
+- (BOOL)hasDefaultForeignEnum {
+ return builder_result.hasDefaultForeignEnum;
 }
-- (TestAllTypesLite_Builder*) setDefaultForeignEnum:(ForeignEnumLite) value {
-  result.hasDefaultForeignEnum = YES;
-  result.defaultForeignEnum = value;
+- (TestAllTypesLite_Builder*)clearDefaultForeignEnum {
+  builder_result.hasDefaultForeignEnum = NO;
+  builder_result.defaultForeignEnum = ForeignEnumLiteForeignLiteBar;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearDefaultForeignEnum {
-  result.hasDefaultForeignEnum = NO;
-  result.defaultForeignEnum = ForeignEnumLiteForeignLiteBar;
+- (TestAllTypesLite_Builder*)setDefaultImportEnum:(ImportEnumLite) value {
+  NSAssert(ImportEnumLiteIsValidValue(value), @"The value '%d' is invalid for ImportEnumLite", value);
+  builder_result.hasDefaultImportEnum = YES;
+  builder_result.defaultImportEnum = value;
   return self;
 }
-- (BOOL) hasDefaultImportEnum {
-  return result.hasDefaultImportEnum;
+- (ImportEnumLite)defaultImportEnum {
+  return builder_result.defaultImportEnum;
 }
-- (ImportEnumLite) defaultImportEnum {
-  return result.defaultImportEnum;
+- (BOOL)hasDefaultImportEnum {
+ return builder_result.hasDefaultImportEnum;
 }
-- (TestAllTypesLite_Builder*) setDefaultImportEnum:(ImportEnumLite) value {
-  result.hasDefaultImportEnum = YES;
-  result.defaultImportEnum = value;
+- (TestAllTypesLite_Builder*)clearDefaultImportEnum {
+  builder_result.hasDefaultImportEnum = NO;
+  builder_result.defaultImportEnum = ImportEnumLiteImportLiteBar;
   return self;
 }
-- (TestAllTypesLite_Builder*) clearDefaultImportEnum {
-  result.hasDefaultImportEnum = NO;
-  result.defaultImportEnum = ImportEnumLiteImportLiteBar;
+- (TestAllTypesLite_Builder*) setDefaultStringPiece:(NSString*) value {
+  builder_result.hasDefaultStringPiece = YES;
+  builder_result.defaultStringPiece = value;
   return self;
 }
-- (BOOL) hasDefaultStringPiece {
-  return result.hasDefaultStringPiece;
-}
 - (NSString*) defaultStringPiece {
-  return result.defaultStringPiece;
+  return builder_result.defaultStringPiece;
 }
-- (TestAllTypesLite_Builder*) setDefaultStringPiece:(NSString*) value {
-  result.hasDefaultStringPiece = YES;
-  result.defaultStringPiece = value;
-  return self;
+- (BOOL)hasDefaultStringPiece {
+ return builder_result.hasDefaultStringPiece;
 }
-- (TestAllTypesLite_Builder*) clearDefaultStringPiece {
-  result.hasDefaultStringPiece = NO;
-  result.defaultStringPiece = @"abc";
+- (TestAllTypesLite_Builder*)clearDefaultStringPiece {
+  builder_result.hasDefaultStringPiece = NO;
+  builder_result.defaultStringPiece = @"abc";
   return self;
 }
-- (BOOL) hasDefaultCord {
-  return result.hasDefaultCord;
+- (TestAllTypesLite_Builder*) setDefaultCord:(NSString*) value {
+  builder_result.hasDefaultCord = YES;
+  builder_result.defaultCord = value;
+  return self;
 }
 - (NSString*) defaultCord {
-  return result.defaultCord;
+  return builder_result.defaultCord;
 }
-- (TestAllTypesLite_Builder*) setDefaultCord:(NSString*) value {
-  result.hasDefaultCord = YES;
-  result.defaultCord = value;
-  return self;
+- (BOOL)hasDefaultCord {
+ return builder_result.hasDefaultCord;
 }
-- (TestAllTypesLite_Builder*) clearDefaultCord {
-  result.hasDefaultCord = NO;
-  result.defaultCord = @"123";
+- (TestAllTypesLite_Builder*)clearDefaultCord {
+  builder_result.hasDefaultCord = NO;
+  builder_result.defaultCord = @"123";
   return self;
 }
 @end
 
 @interface ForeignMessageLite ()
-@property int32_t c;
+@property (nonatomic, readwrite) BOOL hasC;
+@property (nonatomic, readwrite) int32_t c;
 @end
 
 @implementation ForeignMessageLite
 
-- (BOOL) hasC {
-  return !!hasC_;
-}
-- (void) setHasC:(BOOL) value {
-  hasC_ = !!value;
-}
-@synthesize c;
-
 - (id) init {
   if ((self = [super init])) {
     self.c = 0;
   }
   return self;
 }
-static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
-+ (void) initialize {
-  if (self == [ForeignMessageLite class]) {
-    defaultForeignMessageLiteInstance = [[ForeignMessageLite alloc] init];
-  }
-}
 + (ForeignMessageLite*) defaultInstance {
+  static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultForeignMessageLiteInstance = [[ForeignMessageLite alloc] init];
+  });
   return defaultForeignMessageLiteInstance;
 }
 - (ForeignMessageLite*) defaultInstance {
-  return defaultForeignMessageLiteInstance;
+  return [ForeignMessageLite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -5873,36 +6594,18 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasC) {
-    size += computeInt32Size(1, self.c);
+    size_ += computeInt32Size(1, self.c);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (ForeignMessageLite*) parseFromData:(NSData*) data {
-  return (ForeignMessageLite*)[[[ForeignMessageLite builder] mergeFromData:data] build];
-}
-+ (ForeignMessageLite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ForeignMessageLite*)[[[ForeignMessageLite builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (ForeignMessageLite*) parseFromInputStream:(NSInputStream*) input {
-  return (ForeignMessageLite*)[[[ForeignMessageLite builder] mergeFromInputStream:input] build];
-}
-+ (ForeignMessageLite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ForeignMessageLite*)[[[ForeignMessageLite builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (ForeignMessageLite*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (ForeignMessageLite*)[[[ForeignMessageLite builder] mergeFromCodedInputStream:input] build];
-}
-+ (ForeignMessageLite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (ForeignMessageLite*)[[[ForeignMessageLite builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (ForeignMessageLite_Builder*) builder {
   return [[ForeignMessageLite_Builder alloc] init];
@@ -5916,11 +6619,11 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
 - (ForeignMessageLite_Builder*) toBuilder {
   return [ForeignMessageLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasC) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"c", [NSNumber numberWithInt:self.c]];
+    PBTextFormatWriteInt32(writer, "c", self.c);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -5933,41 +6636,37 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
   return
       self.hasC == otherMessage.hasC &&
       (!self.hasC || self.c == otherMessage.c) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasC) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.c] hash];
+    hashCode = hashCode * 31 + [@(self.c) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasC) {
+    PBJSONWriteInt32(writer, "c", self.c);
+  }
+}
 @end
 
 @interface ForeignMessageLite_Builder()
-@property (strong) ForeignMessageLite* result;
+@property (strong) ForeignMessageLite* builder_result;
 @end
 
 @implementation ForeignMessageLite_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[ForeignMessageLite alloc] init];
+    self.builder_result = [[ForeignMessageLite alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (ForeignMessageLite_Builder*) clear {
-  self.result = [[ForeignMessageLite alloc] init];
-  return self;
-}
-- (ForeignMessageLite_Builder*) clone {
-  return [ForeignMessageLite builderWithPrototype:result];
+  return builder_result;
 }
 - (ForeignMessageLite*) defaultInstance {
   return [ForeignMessageLite defaultInstance];
@@ -5977,8 +6676,8 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
   return [self buildPartial];
 }
 - (ForeignMessageLite*) buildPartial {
-  ForeignMessageLite* returnMe = result;
-  self.result = nil;
+  ForeignMessageLite* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (ForeignMessageLite_Builder*) mergeFrom:(ForeignMessageLite*) other {
@@ -5991,9 +6690,6 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (ForeignMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (ForeignMessageLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -6016,20 +6712,61 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
     }
   }
 }
-- (BOOL) hasC {
-  return result.hasC;
+- (ForeignMessageLite_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 1:
+        if (memcmp(name, "c", 1) == 0) {
+          [self setC:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) c {
-  return result.c;
+- (ForeignMessageLite_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 1:
+        if (memcmp(name, "c", 1) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setC:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (ForeignMessageLite_Builder*) setC:(int32_t) value {
-  result.hasC = YES;
-  result.c = value;
+  builder_result.hasC = YES;
+  builder_result.c = value;
   return self;
 }
-- (ForeignMessageLite_Builder*) clearC {
-  result.hasC = NO;
-  result.c = 0;
+- (int32_t) c {
+  return builder_result.c;
+}
+- (BOOL)hasC {
+ return builder_result.hasC;
+}
+- (ForeignMessageLite_Builder*)clearC {
+  builder_result.hasC = NO;
+  builder_result.c = 0;
   return self;
 }
 @end
@@ -6048,140 +6785,110 @@ static ForeignMessageLite* defaultForeignMessageLiteInstance = nil;
 @property (strong) PBAppendableArray * packedFloatArray;
 @property (strong) PBAppendableArray * packedDoubleArray;
 @property (strong) PBAppendableArray * packedBoolArray;
-@property (strong) PBAppendableArray * packedEnumArray;
+@property (nonatomic, readwrite) PBAppendableArray * packedEnumArray;
 @end
 
 @implementation TestPackedTypesLite
 
-@synthesize packedInt32Array;
-@dynamic packedInt32;
-@synthesize packedInt64Array;
-@dynamic packedInt64;
-@synthesize packedUint32Array;
-@dynamic packedUint32;
-@synthesize packedUint64Array;
-@dynamic packedUint64;
-@synthesize packedSint32Array;
-@dynamic packedSint32;
-@synthesize packedSint64Array;
-@dynamic packedSint64;
-@synthesize packedFixed32Array;
-@dynamic packedFixed32;
-@synthesize packedFixed64Array;
-@dynamic packedFixed64;
-@synthesize packedSfixed32Array;
-@dynamic packedSfixed32;
-@synthesize packedSfixed64Array;
-@dynamic packedSfixed64;
-@synthesize packedFloatArray;
-@dynamic packedFloat;
-@synthesize packedDoubleArray;
-@dynamic packedDouble;
-@synthesize packedBoolArray;
-@dynamic packedBool;
-@synthesize packedEnumArray;
-@dynamic packedEnum;
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestPackedTypesLite class]) {
-    defaultTestPackedTypesLiteInstance = [[TestPackedTypesLite alloc] init];
-  }
-}
 + (TestPackedTypesLite*) defaultInstance {
+  static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestPackedTypesLiteInstance = [[TestPackedTypesLite alloc] init];
+  });
   return defaultTestPackedTypesLiteInstance;
 }
 - (TestPackedTypesLite*) defaultInstance {
-  return defaultTestPackedTypesLiteInstance;
+  return [TestPackedTypesLite defaultInstance];
 }
 - (PBArray *)packedInt32 {
-  return packedInt32Array;
+  return self.packedInt32Array;
 }
 - (int32_t)packedInt32AtIndex:(NSUInteger)index {
-  return [packedInt32Array int32AtIndex:index];
+  return [self.packedInt32Array int32AtIndex:index];
 }
 - (PBArray *)packedInt64 {
-  return packedInt64Array;
+  return self.packedInt64Array;
 }
 - (int64_t)packedInt64AtIndex:(NSUInteger)index {
-  return [packedInt64Array int64AtIndex:index];
+  return [self.packedInt64Array int64AtIndex:index];
 }
 - (PBArray *)packedUint32 {
-  return packedUint32Array;
+  return self.packedUint32Array;
 }
 - (uint32_t)packedUint32AtIndex:(NSUInteger)index {
-  return [packedUint32Array uint32AtIndex:index];
+  return [self.packedUint32Array uint32AtIndex:index];
 }
 - (PBArray *)packedUint64 {
-  return packedUint64Array;
+  return self.packedUint64Array;
 }
 - (uint64_t)packedUint64AtIndex:(NSUInteger)index {
-  return [packedUint64Array uint64AtIndex:index];
+  return [self.packedUint64Array uint64AtIndex:index];
 }
 - (PBArray *)packedSint32 {
-  return packedSint32Array;
+  return self.packedSint32Array;
 }
 - (int32_t)packedSint32AtIndex:(NSUInteger)index {
-  return [packedSint32Array int32AtIndex:index];
+  return [self.packedSint32Array int32AtIndex:index];
 }
 - (PBArray *)packedSint64 {
-  return packedSint64Array;
+  return self.packedSint64Array;
 }
 - (int64_t)packedSint64AtIndex:(NSUInteger)index {
-  return [packedSint64Array int64AtIndex:index];
+  return [self.packedSint64Array int64AtIndex:index];
 }
 - (PBArray *)packedFixed32 {
-  return packedFixed32Array;
+  return self.packedFixed32Array;
 }
 - (uint32_t)packedFixed32AtIndex:(NSUInteger)index {
-  return [packedFixed32Array uint32AtIndex:index];
+  return [self.packedFixed32Array uint32AtIndex:index];
 }
 - (PBArray *)packedFixed64 {
-  return packedFixed64Array;
+  return self.packedFixed64Array;
 }
 - (uint64_t)packedFixed64AtIndex:(NSUInteger)index {
-  return [packedFixed64Array uint64AtIndex:index];
+  return [self.packedFixed64Array uint64AtIndex:index];
 }
 - (PBArray *)packedSfixed32 {
-  return packedSfixed32Array;
+  return self.packedSfixed32Array;
 }
 - (int32_t)packedSfixed32AtIndex:(NSUInteger)index {
-  return [packedSfixed32Array int32AtIndex:index];
+  return [self.packedSfixed32Array int32AtIndex:index];
 }
 - (PBArray *)packedSfixed64 {
-  return packedSfixed64Array;
+  return self.packedSfixed64Array;
 }
 - (int64_t)packedSfixed64AtIndex:(NSUInteger)index {
-  return [packedSfixed64Array int64AtIndex:index];
+  return [self.packedSfixed64Array int64AtIndex:index];
 }
 - (PBArray *)packedFloat {
-  return packedFloatArray;
+  return self.packedFloatArray;
 }
 - (Float32)packedFloatAtIndex:(NSUInteger)index {
-  return [packedFloatArray floatAtIndex:index];
+  return [self.packedFloatArray floatAtIndex:index];
 }
 - (PBArray *)packedDouble {
-  return packedDoubleArray;
+  return self.packedDoubleArray;
 }
 - (Float64)packedDoubleAtIndex:(NSUInteger)index {
-  return [packedDoubleArray doubleAtIndex:index];
+  return [self.packedDoubleArray doubleAtIndex:index];
 }
 - (PBArray *)packedBool {
-  return packedBoolArray;
+  return self.packedBoolArray;
 }
 - (BOOL)packedBoolAtIndex:(NSUInteger)index {
-  return [packedBoolArray boolAtIndex:index];
+  return [self.packedBoolArray boolAtIndex:index];
 }
 - (PBArray *)packedEnum {
-  return packedEnumArray;
+  return self.packedEnumArray;
 }
 - (ForeignEnumLite)packedEnumAtIndex:(NSUInteger)index {
-  return [packedEnumArray int32AtIndex:index];
+  return (ForeignEnumLite)[self.packedEnumArray int32AtIndex:index];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -6316,12 +7023,12 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   {
     int32_t dataSize = 0;
     const NSUInteger count = self.packedInt32Array.count;
@@ -6329,10 +7036,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedInt32MemoizedSerializedSize = dataSize;
   }
@@ -6343,10 +7050,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedInt64MemoizedSerializedSize = dataSize;
   }
@@ -6357,10 +7064,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeUInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedUint32MemoizedSerializedSize = dataSize;
   }
@@ -6371,10 +7078,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeUInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedUint64MemoizedSerializedSize = dataSize;
   }
@@ -6385,10 +7092,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeSInt32SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedSint32MemoizedSerializedSize = dataSize;
   }
@@ -6399,10 +7106,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeSInt64SizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedSint64MemoizedSerializedSize = dataSize;
   }
@@ -6410,10 +7117,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     int32_t dataSize = 0;
     const NSUInteger count = self.packedFixed32Array.count;
     dataSize = 4 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedFixed32MemoizedSerializedSize = dataSize;
   }
@@ -6421,10 +7128,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     int32_t dataSize = 0;
     const NSUInteger count = self.packedFixed64Array.count;
     dataSize = 8 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedFixed64MemoizedSerializedSize = dataSize;
   }
@@ -6432,10 +7139,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     int32_t dataSize = 0;
     const NSUInteger count = self.packedSfixed32Array.count;
     dataSize = 4 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedSfixed32MemoizedSerializedSize = dataSize;
   }
@@ -6443,10 +7150,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     int32_t dataSize = 0;
     const NSUInteger count = self.packedSfixed64Array.count;
     dataSize = 8 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedSfixed64MemoizedSerializedSize = dataSize;
   }
@@ -6454,10 +7161,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     int32_t dataSize = 0;
     const NSUInteger count = self.packedFloatArray.count;
     dataSize = 4 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedFloatMemoizedSerializedSize = dataSize;
   }
@@ -6465,10 +7172,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     int32_t dataSize = 0;
     const NSUInteger count = self.packedDoubleArray.count;
     dataSize = 8 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedDoubleMemoizedSerializedSize = dataSize;
   }
@@ -6476,10 +7183,10 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     int32_t dataSize = 0;
     const NSUInteger count = self.packedBoolArray.count;
     dataSize = 1 * count;
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeInt32SizeNoTag(dataSize);
+      size_ += 2;
+      size_ += computeInt32SizeNoTag(dataSize);
     }
     packedBoolMemoizedSerializedSize = dataSize;
   }
@@ -6490,37 +7197,19 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     for (NSUInteger i = 0; i < count; ++i) {
       dataSize += computeEnumSizeNoTag(values[i]);
     }
-    size += dataSize;
+    size_ += dataSize;
     if (count > 0) {
-      size += 2;
-      size += computeRawVarint32Size(dataSize);
+      size_ += 2;
+      size_ += computeRawVarint32Size(dataSize);
     }
     packedEnumMemoizedSerializedSize = dataSize;
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestPackedTypesLite*) parseFromData:(NSData*) data {
-  return (TestPackedTypesLite*)[[[TestPackedTypesLite builder] mergeFromData:data] build];
-}
-+ (TestPackedTypesLite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestPackedTypesLite*)[[[TestPackedTypesLite builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestPackedTypesLite*) parseFromInputStream:(NSInputStream*) input {
-  return (TestPackedTypesLite*)[[[TestPackedTypesLite builder] mergeFromInputStream:input] build];
-}
-+ (TestPackedTypesLite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestPackedTypesLite*)[[[TestPackedTypesLite builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestPackedTypesLite*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestPackedTypesLite*)[[[TestPackedTypesLite builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestPackedTypesLite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestPackedTypesLite*)[[[TestPackedTypesLite builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestPackedTypesLite_Builder*) builder {
-  return [[TestPackedTypesLite_Builder alloc] init] ;
+  return [[TestPackedTypesLite_Builder alloc] init];
 }
 + (TestPackedTypesLite_Builder*) builderWithPrototype:(TestPackedTypesLite*) prototype {
   return [[TestPackedTypesLite builder] mergeFrom:prototype];
@@ -6531,66 +7220,67 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
 - (TestPackedTypesLite_Builder*) toBuilder {
   return [TestPackedTypesLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-
-    for(int i=0;i<self.packedInt32Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedInt32", [self.packedInt32Array int32AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.packedInt64Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedInt64", [self.packedInt64Array int64AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.packedUint32Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedUint32", [self.packedUint32Array uint32AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.packedUint64Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedUint64", [self.packedUint64Array uint64AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.packedSint32Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedSint32", [self.packedSint32Array int32AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.packedSint64Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedSint64", [self.packedSint64Array int64AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.packedFixed32Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedFixed32", [self.packedFixed32Array uint32AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.packedFixed64Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedFixed64", [self.packedFixed64Array uint64AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.packedSfixed32Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedSfixed32", [self.packedSfixed32Array int32AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.packedFixed64Array.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedSfixed64", [self.packedSfixed64Array int64AtIndex:i]];
-    }
-    
-    for(int i=0;i<self.packedFloatArray.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedFloat", [self.packedFloatArray floatAtIndex:i]];
-    }
-    
-    for(int i=0;i<self.packedDoubleArray.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedDouble", [self.packedDoubleArray doubleAtIndex:i]];
-    }
-
-    for(int i=0;i<self.packedBoolArray.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedBool", [self.packedBoolArray boolAtIndex:i]];
-    }
-
-    for(int i=0;i<self.packedEnumArray.count;i++){
-        [output appendFormat:@"%@%@: %@\n", indent, @"packedEnum", [self.packedEnumArray uint32AtIndex:i]];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  NSUInteger packedInt32ArrayCount=self.packedInt32Array.count;
+  for(NSUInteger i=0;i<packedInt32ArrayCount;i++){
+    PBTextFormatWriteInt32(writer, "packedInt32", [self.packedInt32Array int32AtIndex:i]);
+  }
+  NSUInteger packedInt64ArrayCount=self.packedInt64Array.count;
+  for(NSUInteger i=0;i<packedInt64ArrayCount;i++){
+    PBTextFormatWriteInt64(writer, "packedInt64", [self.packedInt64Array int64AtIndex:i]);
+  }
+  NSUInteger packedUint32ArrayCount=self.packedUint32Array.count;
+  for(NSUInteger i=0;i<packedUint32ArrayCount;i++){
+    PBTextFormatWriteUInt32(writer, "packedUint32", [self.packedUint32Array uint32AtIndex:i]);
+  }
+  NSUInteger packedUint64ArrayCount=self.packedUint64Array.count;
+  for(NSUInteger i=0;i<packedUint64ArrayCount;i++){
+    PBTextFormatWriteUInt64(writer, "packedUint64", [self.packedUint64Array uint64AtIndex:i]);
+  }
+  NSUInteger packedSint32ArrayCount=self.packedSint32Array.count;
+  for(NSUInteger i=0;i<packedSint32ArrayCount;i++){
+    PBTextFormatWriteInt32(writer, "packedSint32", [self.packedSint32Array int32AtIndex:i]);
+  }
+  NSUInteger packedSint64ArrayCount=self.packedSint64Array.count;
+  for(NSUInteger i=0;i<packedSint64ArrayCount;i++){
+    PBTextFormatWriteInt64(writer, "packedSint64", [self.packedSint64Array int64AtIndex:i]);
+  }
+  NSUInteger packedFixed32ArrayCount=self.packedFixed32Array.count;
+  for(NSUInteger i=0;i<packedFixed32ArrayCount;i++){
+    PBTextFormatWriteUInt32(writer, "packedFixed32", [self.packedFixed32Array uint32AtIndex:i]);
+  }
+  NSUInteger packedFixed64ArrayCount=self.packedFixed64Array.count;
+  for(NSUInteger i=0;i<packedFixed64ArrayCount;i++){
+    PBTextFormatWriteUInt64(writer, "packedFixed64", [self.packedFixed64Array uint64AtIndex:i]);
+  }
+  NSUInteger packedSfixed32ArrayCount=self.packedSfixed32Array.count;
+  for(NSUInteger i=0;i<packedSfixed32ArrayCount;i++){
+    PBTextFormatWriteInt32(writer, "packedSfixed32", [self.packedSfixed32Array int32AtIndex:i]);
+  }
+  NSUInteger packedSfixed64ArrayCount=self.packedSfixed64Array.count;
+  for(NSUInteger i=0;i<packedSfixed64ArrayCount;i++){
+    PBTextFormatWriteInt64(writer, "packedSfixed64", [self.packedSfixed64Array int64AtIndex:i]);
+  }
+  NSUInteger packedFloatArrayCount=self.packedFloatArray.count;
+  for(NSUInteger i=0;i<packedFloatArrayCount;i++){
+    PBTextFormatWriteFloat(writer, "packedFloat", [self.packedFloatArray floatAtIndex:i]);
+  }
+  NSUInteger packedDoubleArrayCount=self.packedDoubleArray.count;
+  for(NSUInteger i=0;i<packedDoubleArrayCount;i++){
+    PBTextFormatWriteDouble(writer, "packedDouble", [self.packedDoubleArray doubleAtIndex:i]);
+  }
+  NSUInteger packedBoolArrayCount=self.packedBoolArray.count;
+  for(NSUInteger i=0;i<packedBoolArrayCount;i++){
+    PBTextFormatWriteBool(writer, "packedBool", [self.packedBoolArray boolAtIndex:i]);
+  }
+  const NSUInteger packedEnumArrayCount = self.packedEnumArray.count;
+  if (packedEnumArrayCount > 0) {
+    const ForeignEnumLite *packedEnumArrayValues = (const ForeignEnumLite *)self.packedEnumArray.data;
+    for (NSUInteger i = 0; i < packedEnumArrayCount; ++i) {
+      PBTextFormatWriteInt32(writer, "packedEnum", packedEnumArrayValues[i]);
     }
-
-
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  }
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -6601,124 +7291,217 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
   }
   TestPackedTypesLite *otherMessage = other;
   return
-      [self.packedInt32Array isEqualToArray:otherMessage.packedInt32Array] &&
-      
-      [self.packedInt64Array isEqualToArray:otherMessage.packedInt64Array] &&
-      
-      [self.packedUint32Array isEqualToArray:otherMessage.packedUint32Array] &&
-      
-      [self.packedUint64Array isEqualToArray:otherMessage.packedUint64Array] &&
-      
-      [self.packedSint32Array isEqualToArray:otherMessage.packedSint32Array] &&
-      
-      [self.packedSint64Array isEqualToArray:otherMessage.packedSint64Array] &&
-      
-      [self.packedFixed32Array isEqualToArray:otherMessage.packedFixed32Array] &&
-      
-      [self.packedFixed64Array isEqualToArray:otherMessage.packedFixed64Array] &&
-      
-      [self.packedSfixed32Array isEqualToArray:otherMessage.packedSfixed32Array] &&
-      
-      [self.packedSfixed64Array isEqualToArray:otherMessage.packedSfixed64Array] &&
-      
-      [self.packedFloatArray isEqualToArray:otherMessage.packedFloatArray] &&
-      
-      [self.packedDoubleArray isEqualToArray:otherMessage.packedDoubleArray] &&
-      
-      [self.packedBoolArray isEqualToArray:otherMessage.packedBoolArray] &&
-      
-      [self.packedEnumArray isEqualToArray:otherMessage.packedEnumArray] &&
-      
+      (self.packedInt32Array == otherMessage.packedInt32Array || [self.packedInt32Array isEqualToArray:otherMessage.packedInt32Array]) &&
+      (self.packedInt64Array == otherMessage.packedInt64Array || [self.packedInt64Array isEqualToArray:otherMessage.packedInt64Array]) &&
+      (self.packedUint32Array == otherMessage.packedUint32Array || [self.packedUint32Array isEqualToArray:otherMessage.packedUint32Array]) &&
+      (self.packedUint64Array == otherMessage.packedUint64Array || [self.packedUint64Array isEqualToArray:otherMessage.packedUint64Array]) &&
+      (self.packedSint32Array == otherMessage.packedSint32Array || [self.packedSint32Array isEqualToArray:otherMessage.packedSint32Array]) &&
+      (self.packedSint64Array == otherMessage.packedSint64Array || [self.packedSint64Array isEqualToArray:otherMessage.packedSint64Array]) &&
+      (self.packedFixed32Array == otherMessage.packedFixed32Array || [self.packedFixed32Array isEqualToArray:otherMessage.packedFixed32Array]) &&
+      (self.packedFixed64Array == otherMessage.packedFixed64Array || [self.packedFixed64Array isEqualToArray:otherMessage.packedFixed64Array]) &&
+      (self.packedSfixed32Array == otherMessage.packedSfixed32Array || [self.packedSfixed32Array isEqualToArray:otherMessage.packedSfixed32Array]) &&
+      (self.packedSfixed64Array == otherMessage.packedSfixed64Array || [self.packedSfixed64Array isEqualToArray:otherMessage.packedSfixed64Array]) &&
+      (self.packedFloatArray == otherMessage.packedFloatArray || [self.packedFloatArray isEqualToArray:otherMessage.packedFloatArray]) &&
+      (self.packedDoubleArray == otherMessage.packedDoubleArray || [self.packedDoubleArray isEqualToArray:otherMessage.packedDoubleArray]) &&
+      (self.packedBoolArray == otherMessage.packedBoolArray || [self.packedBoolArray isEqualToArray:otherMessage.packedBoolArray]) &&
+      (self.packedEnumArray == otherMessage.packedEnumArray || [self.packedEnumArray isEqualToArray:otherMessage.packedEnumArray]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
-    
-    
-    for(int i=0;i<self.packedInt32Array.count;i++){
-        hashCode = hashCode * 31 + [self.packedInt32Array int32AtIndex:i];
+  NSUInteger packedInt32ArrayCount=self.packedInt32Array.count;
+  for(NSUInteger i=0;i<packedInt32ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedInt32Array int32AtIndex:i];
+  }
+  NSUInteger packedInt64ArrayCount=self.packedInt64Array.count;
+  for(NSUInteger i=0;i<packedInt64ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedInt64Array int64AtIndex:i];
+  }
+  NSUInteger packedUint32ArrayCount=self.packedUint32Array.count;
+  for(NSUInteger i=0;i<packedUint32ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedUint32Array uint32AtIndex:i];
+  }
+  NSUInteger packedUint64ArrayCount=self.packedUint64Array.count;
+  for(NSUInteger i=0;i<packedUint64ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedUint64Array uint64AtIndex:i];
+  }
+  NSUInteger packedSint32ArrayCount=self.packedSint32Array.count;
+  for(NSUInteger i=0;i<packedSint32ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedSint32Array int32AtIndex:i];
+  }
+  NSUInteger packedSint64ArrayCount=self.packedSint64Array.count;
+  for(NSUInteger i=0;i<packedSint64ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedSint64Array int64AtIndex:i];
+  }
+  NSUInteger packedFixed32ArrayCount=self.packedFixed32Array.count;
+  for(NSUInteger i=0;i<packedFixed32ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedFixed32Array uint32AtIndex:i];
+  }
+  NSUInteger packedFixed64ArrayCount=self.packedFixed64Array.count;
+  for(NSUInteger i=0;i<packedFixed64ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedFixed64Array uint64AtIndex:i];
+  }
+  NSUInteger packedSfixed32ArrayCount=self.packedSfixed32Array.count;
+  for(NSUInteger i=0;i<packedSfixed32ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedSfixed32Array int32AtIndex:i];
+  }
+  NSUInteger packedSfixed64ArrayCount=self.packedSfixed64Array.count;
+  for(NSUInteger i=0;i<packedSfixed64ArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedSfixed64Array int64AtIndex:i];
+  }
+  NSUInteger packedFloatArrayCount=self.packedFloatArray.count;
+  for(NSUInteger i=0;i<packedFloatArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedFloatArray floatAtIndex:i];
+  }
+  NSUInteger packedDoubleArrayCount=self.packedDoubleArray.count;
+  for(NSUInteger i=0;i<packedDoubleArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedDoubleArray doubleAtIndex:i];
+  }
+  NSUInteger packedBoolArrayCount=self.packedBoolArray.count;
+  for(NSUInteger i=0;i<packedBoolArrayCount;i++){
+  	hashCode = hashCode * 31 + [self.packedBoolArray boolAtIndex:i];
+  }
+  const NSUInteger packedEnumArrayCount = self.packedEnumArray.count;
+  if (packedEnumArrayCount > 0) {
+    const ForeignEnumLite *packedEnumArrayValues = (const ForeignEnumLite *)self.packedEnumArray.data;
+    for (NSUInteger i = 0; i < packedEnumArrayCount; ++i) {
+      hashCode = hashCode * 31 + packedEnumArrayValues[i];
+    }
+  }
+  hashCode = hashCode * 31 + [self.unknownFields hash];
+  return hashCode;
+}
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.packedInt32Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedInt32");
+    NSUInteger packedInt32ArrayCount=self.packedInt32Array.count;
+    for(NSUInteger i=0;i<packedInt32ArrayCount;i++){
+      PBJSONWriteInt32(writer, NULL, [self.packedInt32Array int32AtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedInt64Array.count;i++){
-        hashCode = hashCode * 31 + [self.packedInt64Array int64AtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedInt64Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedInt64");
+    NSUInteger packedInt64ArrayCount=self.packedInt64Array.count;
+    for(NSUInteger i=0;i<packedInt64ArrayCount;i++){
+      PBJSONWriteInt64(writer, NULL, [self.packedInt64Array int64AtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedUint32Array.count;i++){
-        hashCode = hashCode * 31 + [self.packedUint32Array uint32AtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedUint32Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedUint32");
+    NSUInteger packedUint32ArrayCount=self.packedUint32Array.count;
+    for(NSUInteger i=0;i<packedUint32ArrayCount;i++){
+      PBJSONWriteUInt32(writer, NULL, [self.packedUint32Array uint32AtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedUint64Array.count;i++){
-        hashCode = hashCode * 31 + [self.packedUint64Array uint64AtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedUint64Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedUint64");
+    NSUInteger packedUint64ArrayCount=self.packedUint64Array.count;
+    for(NSUInteger i=0;i<packedUint64ArrayCount;i++){
+      PBJSONWriteUInt64(writer, NULL, [self.packedUint64Array uint64AtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedSint32Array.count;i++){
-        hashCode = hashCode * 31 + [self.packedSint32Array int32AtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedSint32Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedSint32");
+    NSUInteger packedSint32ArrayCount=self.packedSint32Array.count;
+    for(NSUInteger i=0;i<packedSint32ArrayCount;i++){
+      PBJSONWriteInt32(writer, NULL, [self.packedSint32Array int32AtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedSint64Array.count;i++){
-        hashCode = hashCode * 31 + [self.packedSint64Array int64AtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedSint64Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedSint64");
+    NSUInteger packedSint64ArrayCount=self.packedSint64Array.count;
+    for(NSUInteger i=0;i<packedSint64ArrayCount;i++){
+      PBJSONWriteInt64(writer, NULL, [self.packedSint64Array int64AtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedFixed32Array.count;i++){
-        hashCode = hashCode * 31 + [self.packedFixed32Array uint32AtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedFixed32Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedFixed32");
+    NSUInteger packedFixed32ArrayCount=self.packedFixed32Array.count;
+    for(NSUInteger i=0;i<packedFixed32ArrayCount;i++){
+      PBJSONWriteUInt32(writer, NULL, [self.packedFixed32Array uint32AtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedFixed64Array.count;i++){
-        hashCode = hashCode * 31 + [self.packedFixed64Array uint64AtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedFixed64Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedFixed64");
+    NSUInteger packedFixed64ArrayCount=self.packedFixed64Array.count;
+    for(NSUInteger i=0;i<packedFixed64ArrayCount;i++){
+      PBJSONWriteUInt64(writer, NULL, [self.packedFixed64Array uint64AtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedSfixed32Array.count;i++){
-        hashCode = hashCode * 31 + [self.packedSfixed32Array int32AtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedSfixed32Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedSfixed32");
+    NSUInteger packedSfixed32ArrayCount=self.packedSfixed32Array.count;
+    for(NSUInteger i=0;i<packedSfixed32ArrayCount;i++){
+      PBJSONWriteInt32(writer, NULL, [self.packedSfixed32Array int32AtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedSfixed64Array.count;i++){
-        hashCode = hashCode * 31 + [self.packedSfixed64Array int64AtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedSfixed64Array.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedSfixed64");
+    NSUInteger packedSfixed64ArrayCount=self.packedSfixed64Array.count;
+    for(NSUInteger i=0;i<packedSfixed64ArrayCount;i++){
+      PBJSONWriteInt64(writer, NULL, [self.packedSfixed64Array int64AtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedFloatArray.count;i++){
-        hashCode = hashCode * 31 + [self.packedFloatArray floatAtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedFloatArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedFloat");
+    NSUInteger packedFloatArrayCount=self.packedFloatArray.count;
+    for(NSUInteger i=0;i<packedFloatArrayCount;i++){
+      PBJSONWriteFloat(writer, NULL, [self.packedFloatArray floatAtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedDoubleArray.count;i++){
-        hashCode = hashCode * 31 + [self.packedDoubleArray doubleAtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedDoubleArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedDouble");
+    NSUInteger packedDoubleArrayCount=self.packedDoubleArray.count;
+    for(NSUInteger i=0;i<packedDoubleArrayCount;i++){
+      PBJSONWriteDouble(writer, NULL, [self.packedDoubleArray doubleAtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedBoolArray.count;i++){
-        hashCode = hashCode * 31 + [self.packedBoolArray boolAtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  if (self.packedBoolArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "packedBool");
+    NSUInteger packedBoolArrayCount=self.packedBoolArray.count;
+    for(NSUInteger i=0;i<packedBoolArrayCount;i++){
+      PBJSONWriteBool(writer, NULL, [self.packedBoolArray boolAtIndex:i]);
     }
-    
-    for(int i=0;i<self.packedEnumArray.count;i++){
-        hashCode = hashCode * 31 + [self.packedEnumArray uint32AtIndex:i];
+    PBJSONWriterEndArray(writer);
+  }
+  const NSUInteger packedEnumArrayCount = self.packedEnumArray.count;
+  if (packedEnumArrayCount > 0) {
+    const ForeignEnumLite *packedEnumArrayValues = (const ForeignEnumLite *)self.packedEnumArray.data;
+    PBJSONWriterBeginArray(writer, "packedEnum");
+    for (NSUInteger i = 0; i < packedEnumArrayCount; ++i) {
+      ForeignEnumLiteWriteJSON(writer, NULL, packedEnumArrayValues[i]);
     }
-
-
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+    PBJSONWriterEndArray(writer);
+  }
 }
 @end
 
 @interface TestPackedTypesLite_Builder()
-@property (strong) TestPackedTypesLite* result;
+@property (strong) TestPackedTypesLite* builder_result;
 @end
 
 @implementation TestPackedTypesLite_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestPackedTypesLite alloc] init] ;
+    self.builder_result = [[TestPackedTypesLite alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestPackedTypesLite_Builder*) clear {
-  self.result = [[TestPackedTypesLite alloc] init] ;
-  return self;
-}
-- (TestPackedTypesLite_Builder*) clone {
-  return [TestPackedTypesLite builderWithPrototype:result];
+  return builder_result;
 }
 - (TestPackedTypesLite*) defaultInstance {
   return [TestPackedTypesLite defaultInstance];
@@ -6728,8 +7511,8 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
   return [self buildPartial];
 }
 - (TestPackedTypesLite*) buildPartial {
-  TestPackedTypesLite* returnMe = result;
-  self.result = nil;
+  TestPackedTypesLite* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestPackedTypesLite_Builder*) mergeFrom:(TestPackedTypesLite*) other {
@@ -6737,109 +7520,50 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     return self;
   }
   if (other.packedInt32Array.count > 0) {
-    if (result.packedInt32Array == nil) {
-      result.packedInt32Array = [other.packedInt32Array copy];
-    } else {
-      [result.packedInt32Array appendArray:other.packedInt32Array];
-    }
+    builder_result.packedInt32Array = [other.packedInt32Array copy];
   }
   if (other.packedInt64Array.count > 0) {
-    if (result.packedInt64Array == nil) {
-      result.packedInt64Array = [other.packedInt64Array copy];
-    } else {
-      [result.packedInt64Array appendArray:other.packedInt64Array];
-    }
+    builder_result.packedInt64Array = [other.packedInt64Array copy];
   }
   if (other.packedUint32Array.count > 0) {
-    if (result.packedUint32Array == nil) {
-      result.packedUint32Array = [other.packedUint32Array copy];
-    } else {
-      [result.packedUint32Array appendArray:other.packedUint32Array];
-    }
+    builder_result.packedUint32Array = [other.packedUint32Array copy];
   }
   if (other.packedUint64Array.count > 0) {
-    if (result.packedUint64Array == nil) {
-      result.packedUint64Array = [other.packedUint64Array copy];
-    } else {
-      [result.packedUint64Array appendArray:other.packedUint64Array];
-    }
+    builder_result.packedUint64Array = [other.packedUint64Array copy];
   }
   if (other.packedSint32Array.count > 0) {
-    if (result.packedSint32Array == nil) {
-      result.packedSint32Array = [other.packedSint32Array copy];
-    } else {
-      [result.packedSint32Array appendArray:other.packedSint32Array];
-    }
+    builder_result.packedSint32Array = [other.packedSint32Array copy];
   }
   if (other.packedSint64Array.count > 0) {
-    if (result.packedSint64Array == nil) {
-      result.packedSint64Array = [other.packedSint64Array copy];
-    } else {
-      [result.packedSint64Array appendArray:other.packedSint64Array];
-    }
+    builder_result.packedSint64Array = [other.packedSint64Array copy];
   }
   if (other.packedFixed32Array.count > 0) {
-    if (result.packedFixed32Array == nil) {
-      result.packedFixed32Array = [other.packedFixed32Array copy];
-    } else {
-      [result.packedFixed32Array appendArray:other.packedFixed32Array];
-    }
+    builder_result.packedFixed32Array = [other.packedFixed32Array copy];
   }
   if (other.packedFixed64Array.count > 0) {
-    if (result.packedFixed64Array == nil) {
-      result.packedFixed64Array = [other.packedFixed64Array copy];
-    } else {
-      [result.packedFixed64Array appendArray:other.packedFixed64Array];
-    }
+    builder_result.packedFixed64Array = [other.packedFixed64Array copy];
   }
   if (other.packedSfixed32Array.count > 0) {
-    if (result.packedSfixed32Array == nil) {
-      result.packedSfixed32Array = [other.packedSfixed32Array copy];
-    } else {
-      [result.packedSfixed32Array appendArray:other.packedSfixed32Array];
-    }
+    builder_result.packedSfixed32Array = [other.packedSfixed32Array copy];
   }
   if (other.packedSfixed64Array.count > 0) {
-    if (result.packedSfixed64Array == nil) {
-      result.packedSfixed64Array = [other.packedSfixed64Array copy];
-    } else {
-      [result.packedSfixed64Array appendArray:other.packedSfixed64Array];
-    }
+    builder_result.packedSfixed64Array = [other.packedSfixed64Array copy];
   }
   if (other.packedFloatArray.count > 0) {
-    if (result.packedFloatArray == nil) {
-      result.packedFloatArray = [other.packedFloatArray copy];
-    } else {
-      [result.packedFloatArray appendArray:other.packedFloatArray];
-    }
+    builder_result.packedFloatArray = [other.packedFloatArray copy];
   }
   if (other.packedDoubleArray.count > 0) {
-    if (result.packedDoubleArray == nil) {
-      result.packedDoubleArray = [other.packedDoubleArray copy];
-    } else {
-      [result.packedDoubleArray appendArray:other.packedDoubleArray];
-    }
+    builder_result.packedDoubleArray = [other.packedDoubleArray copy];
   }
   if (other.packedBoolArray.count > 0) {
-    if (result.packedBoolArray == nil) {
-      result.packedBoolArray = [other.packedBoolArray copy];
-    } else {
-      [result.packedBoolArray appendArray:other.packedBoolArray];
-    }
+    builder_result.packedBoolArray = [other.packedBoolArray copy];
   }
   if (other.packedEnumArray.count > 0) {
-    if (result.packedEnumArray == nil) {
-      result.packedEnumArray = [other.packedEnumArray copy];
-    } else {
-      [result.packedEnumArray appendArray:other.packedEnumArray];
-    }
+    builder_result.packedEnumArray = [other.packedEnumArray copy];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestPackedTypesLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestPackedTypesLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -6858,11 +7582,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 722: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedInt32Array == nil) {
-          result.packedInt32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+        if (builder_result.packedInt32Array == nil) {
+          builder_result.packedInt32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedInt32Array addInt32:[input readInt32]];
+          [builder_result.packedInt32Array addInt32:[input readInt32]];
         }
         [input popLimit:limit];
         break;
@@ -6870,11 +7594,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 730: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedInt64Array == nil) {
-          result.packedInt64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+        if (builder_result.packedInt64Array == nil) {
+          builder_result.packedInt64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedInt64Array addInt64:[input readInt64]];
+          [builder_result.packedInt64Array addInt64:[input readInt64]];
         }
         [input popLimit:limit];
         break;
@@ -6882,11 +7606,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 738: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedUint32Array == nil) {
-          result.packedUint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+        if (builder_result.packedUint32Array == nil) {
+          builder_result.packedUint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedUint32Array addUint32:[input readUInt32]];
+          [builder_result.packedUint32Array addUint32:[input readUInt32]];
         }
         [input popLimit:limit];
         break;
@@ -6894,11 +7618,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 746: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedUint64Array == nil) {
-          result.packedUint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+        if (builder_result.packedUint64Array == nil) {
+          builder_result.packedUint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedUint64Array addUint64:[input readUInt64]];
+          [builder_result.packedUint64Array addUint64:[input readUInt64]];
         }
         [input popLimit:limit];
         break;
@@ -6906,11 +7630,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 754: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedSint32Array == nil) {
-          result.packedSint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+        if (builder_result.packedSint32Array == nil) {
+          builder_result.packedSint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedSint32Array addInt32:[input readSInt32]];
+          [builder_result.packedSint32Array addInt32:[input readSInt32]];
         }
         [input popLimit:limit];
         break;
@@ -6918,11 +7642,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 762: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedSint64Array == nil) {
-          result.packedSint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+        if (builder_result.packedSint64Array == nil) {
+          builder_result.packedSint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedSint64Array addInt64:[input readSInt64]];
+          [builder_result.packedSint64Array addInt64:[input readSInt64]];
         }
         [input popLimit:limit];
         break;
@@ -6930,11 +7654,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 770: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedFixed32Array == nil) {
-          result.packedFixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+        if (builder_result.packedFixed32Array == nil) {
+          builder_result.packedFixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedFixed32Array addUint32:[input readFixed32]];
+          [builder_result.packedFixed32Array addUint32:[input readFixed32]];
         }
         [input popLimit:limit];
         break;
@@ -6942,11 +7666,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 778: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedFixed64Array == nil) {
-          result.packedFixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+        if (builder_result.packedFixed64Array == nil) {
+          builder_result.packedFixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedFixed64Array addUint64:[input readFixed64]];
+          [builder_result.packedFixed64Array addUint64:[input readFixed64]];
         }
         [input popLimit:limit];
         break;
@@ -6954,11 +7678,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 786: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedSfixed32Array == nil) {
-          result.packedSfixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+        if (builder_result.packedSfixed32Array == nil) {
+          builder_result.packedSfixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedSfixed32Array addInt32:[input readSFixed32]];
+          [builder_result.packedSfixed32Array addInt32:[input readSFixed32]];
         }
         [input popLimit:limit];
         break;
@@ -6966,11 +7690,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 794: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedSfixed64Array == nil) {
-          result.packedSfixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+        if (builder_result.packedSfixed64Array == nil) {
+          builder_result.packedSfixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedSfixed64Array addInt64:[input readSFixed64]];
+          [builder_result.packedSfixed64Array addInt64:[input readSFixed64]];
         }
         [input popLimit:limit];
         break;
@@ -6978,11 +7702,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 802: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedFloatArray == nil) {
-          result.packedFloatArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeFloat];
+        if (builder_result.packedFloatArray == nil) {
+          builder_result.packedFloatArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeFloat];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedFloatArray addFloat:[input readFloat]];
+          [builder_result.packedFloatArray addFloat:[input readFloat]];
         }
         [input popLimit:limit];
         break;
@@ -6990,11 +7714,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 810: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedDoubleArray == nil) {
-          result.packedDoubleArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeDouble];
+        if (builder_result.packedDoubleArray == nil) {
+          builder_result.packedDoubleArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeDouble];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedDoubleArray addDouble:[input readDouble]];
+          [builder_result.packedDoubleArray addDouble:[input readDouble]];
         }
         [input popLimit:limit];
         break;
@@ -7002,11 +7726,11 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
       case 818: {
         int32_t length = [input readRawVarint32];
         int32_t limit = [input pushLimit:length];
-        if (result.packedBoolArray == nil) {
-          result.packedBoolArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeBool];
+        if (builder_result.packedBoolArray == nil) {
+          builder_result.packedBoolArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeBool];
         }
         while (input.bytesUntilLimit > 0) {
-          [result.packedBoolArray addBool:[input readBool]];
+          [builder_result.packedBoolArray addBool:[input readBool]];
         }
         [input popLimit:limit];
         break;
@@ -7015,7 +7739,7 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
         int32_t length = [input readRawVarint32];
         int32_t oldLimit = [input pushLimit:length];
         while (input.bytesUntilLimit > 0) {
-          int32_t value = [input readEnum];
+          ForeignEnumLite value = (ForeignEnumLite)[input readEnum];
           if (ForeignEnumLiteIsValidValue(value)) {
             [self addPackedEnum:value];
           } else {
@@ -7028,354 +7752,520 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
     }
   }
 }
-- (PBAppendableArray *)packedInt32 {
-  return result.packedInt32Array;
+- (TestPackedTypesLite_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 11:
+        if (memcmp(name, "packed_bool", 11) == 0) {
+          [self addPackedBool:PBTextFormatReaderReadBool(reader)];
+          continue;
+        }
+        if (memcmp(name, "packed_enum", 11) == 0) {
+          [self addPackedEnum:ForeignEnumLiteReadTextFormat(reader)];
+          continue;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "packed_int32", 12) == 0) {
+          [self addPackedInt32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "packed_int64", 12) == 0) {
+          [self addPackedInt64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "packed_float", 12) == 0) {
+          [self addPackedFloat:PBTextFormatReaderReadFloat(reader)];
+          continue;
+        }
+        break;
+      case 13:
+        if (memcmp(name, "packed_uint32", 13) == 0) {
+          [self addPackedUint32:PBTextFormatReaderReadUInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "packed_uint64", 13) == 0) {
+          [self addPackedUint64:PBTextFormatReaderReadUInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "packed_sint32", 13) == 0) {
+          [self addPackedSint32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "packed_sint64", 13) == 0) {
+          [self addPackedSint64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        if (memcmp(name, "packed_double", 13) == 0) {
+          [self addPackedDouble:PBTextFormatReaderReadDouble(reader)];
+          continue;
+        }
+        break;
+      case 14:
+        if (memcmp(name, "packed_fixed32", 14) == 0) {
+          [self addPackedFixed32:PBTextFormatReaderReadUInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "packed_fixed64", 14) == 0) {
+          [self addPackedFixed64:PBTextFormatReaderReadUInt64(reader)];
+          continue;
+        }
+        break;
+      case 15:
+        if (memcmp(name, "packed_sfixed32", 15) == 0) {
+          [self addPackedSfixed32:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "packed_sfixed64", 15) == 0) {
+          [self addPackedSfixed64:PBTextFormatReaderReadInt64(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t)packedInt32AtIndex:(NSUInteger)index {
-  return [result packedInt32AtIndex:index];
+- (TestPackedTypesLite_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 10:
+        if (memcmp(name, "packedBool", 10) == 0) {
+          number = 102;
+        } else if (memcmp(name, "packedEnum", 10) == 0) {
+          number = 103;
+        }
+        break;
+      case 11:
+        if (memcmp(name, "packedInt32", 11) == 0) {
+          number = 90;
+        } else if (memcmp(name, "packedInt64", 11) == 0) {
+          number = 91;
+        } else if (memcmp(name, "packedFloat", 11) == 0) {
+          number = 100;
+        } else if (memcmp(name, "packed_bool", 11) == 0) {
+          number = 102;
+        } else if (memcmp(name, "packed_enum", 11) == 0) {
+          number = 103;
+        }
+        break;
+      case 12:
+        if (memcmp(name, "packed_int32", 12) == 0) {
+          number = 90;
+        } else if (memcmp(name, "packed_int64", 12) == 0) {
+          number = 91;
+        } else if (memcmp(name, "packedUint32", 12) == 0) {
+          number = 92;
+        } else if (memcmp(name, "packedUint64", 12) == 0) {
+          number = 93;
+        } else if (memcmp(name, "packedSint32", 12) == 0) {
+          number = 94;
+        } else if (memcmp(name, "packedSint64", 12) == 0) {
+          number = 95;
+        } else if (memcmp(name, "packed_float", 12) == 0) {
+          number = 100;
+        } else if (memcmp(name, "packedDouble", 12) == 0) {
+          number = 101;
+        }
+        break;
+      case 13:
+        if (memcmp(name, "packed_uint32", 13) == 0) {
+          number = 92;
+        } else if (memcmp(name, "packed_uint64", 13) == 0) {
+          number = 93;
+        } else if (memcmp(name, "packed_sint32", 13) == 0) {
+          number = 94;
+        } else if (memcmp(name, "packed_sint64", 13) == 0) {
+          number = 95;
+        } else if (memcmp(name, "packedFixed32", 13) == 0) {
+          number = 96;
+        } else if (memcmp(name, "packedFixed64", 13) == 0) {
+          number = 97;
+        } else if (memcmp(name, "packed_double", 13) == 0) {
+          number = 101;
+        }
+        break;
+      case 14:
+        if (memcmp(name, "packed_fixed32", 14) == 0) {
+          number = 96;
+        } else if (memcmp(name, "packed_fixed64", 14) == 0) {
+          number = 97;
+        } else if (memcmp(name, "packedSfixed32", 14) == 0) {
+          number = 98;
+        } else if (memcmp(name, "packedSfixed64", 14) == 0) {
+          number = 99;
+        }
+        break;
+      case 15:
+        if (memcmp(name, "packed_sfixed32", 15) == 0) {
+          number = 98;
+        } else if (memcmp(name, "packed_sfixed64", 15) == 0) {
+          number = 99;
+        }
+        break;
+    }
+    switch (number) {
+      case 90: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedInt32:PBJSONReaderReadInt32(reader)];
+        }
+        continue;
+      }
+      case 91: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedInt64:PBJSONReaderReadInt64(reader)];
+        }
+        continue;
+      }
+      case 92: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedUint32:PBJSONReaderReadUInt32(reader)];
+        }
+        continue;
+      }
+      case 93: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedUint64:PBJSONReaderReadUInt64(reader)];
+        }
+        continue;
+      }
+      case 94: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedSint32:PBJSONReaderReadInt32(reader)];
+        }
+        continue;
+      }
+      case 95: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedSint64:PBJSONReaderReadInt64(reader)];
+        }
+        continue;
+      }
+      case 96: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedFixed32:PBJSONReaderReadUInt32(reader)];
+        }
+        continue;
+      }
+      case 97: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedFixed64:PBJSONReaderReadUInt64(reader)];
+        }
+        continue;
+      }
+      case 98: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedSfixed32:PBJSONReaderReadInt32(reader)];
+        }
+        continue;
+      }
+      case 99: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedSfixed64:PBJSONReaderReadInt64(reader)];
+        }
+        continue;
+      }
+      case 100: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedFloat:PBJSONReaderReadFloat(reader)];
+        }
+        continue;
+      }
+      case 101: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedDouble:PBJSONReaderReadDouble(reader)];
+        }
+        continue;
+      }
+      case 102: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedBool:PBJSONReaderReadBool(reader)];
+        }
+        continue;
+      }
+      case 103: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          [self addPackedEnum:ForeignEnumLiteReadJSON(reader)];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestPackedTypesLite_Builder *)addPackedInt32:(int32_t)value {
-  if (result.packedInt32Array == nil) {
-    result.packedInt32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (builder_result.packedInt32Array == nil) {
+    builder_result.packedInt32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
   }
-  [result.packedInt32Array addInt32:value];
+  [builder_result.packedInt32Array addInt32:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedInt32Array:(NSArray *)array {
-  result.packedInt32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  builder_result.packedInt32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedInt32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.packedInt32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
-  return self;
+- (PBAppendableArray *) packedInt32 {
+  return builder_result.packedInt32Array;
 }
 - (TestPackedTypesLite_Builder *)clearPackedInt32 {
-  result.packedInt32Array = nil;
+  builder_result.packedInt32Array = nil;
   return self;
 }
-- (PBAppendableArray *)packedInt64 {
-  return result.packedInt64Array;
-}
-- (int64_t)packedInt64AtIndex:(NSUInteger)index {
-  return [result packedInt64AtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedInt64:(int64_t)value {
-  if (result.packedInt64Array == nil) {
-    result.packedInt64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (builder_result.packedInt64Array == nil) {
+    builder_result.packedInt64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
   }
-  [result.packedInt64Array addInt64:value];
+  [builder_result.packedInt64Array addInt64:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedInt64Array:(NSArray *)array {
-  result.packedInt64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  builder_result.packedInt64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedInt64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.packedInt64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
-  return self;
+- (PBAppendableArray *) packedInt64 {
+  return builder_result.packedInt64Array;
 }
 - (TestPackedTypesLite_Builder *)clearPackedInt64 {
-  result.packedInt64Array = nil;
+  builder_result.packedInt64Array = nil;
   return self;
 }
-- (PBAppendableArray *)packedUint32 {
-  return result.packedUint32Array;
-}
-- (uint32_t)packedUint32AtIndex:(NSUInteger)index {
-  return [result packedUint32AtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedUint32:(uint32_t)value {
-  if (result.packedUint32Array == nil) {
-    result.packedUint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+  if (builder_result.packedUint32Array == nil) {
+    builder_result.packedUint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
   }
-  [result.packedUint32Array addUint32:value];
+  [builder_result.packedUint32Array addUint32:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedUint32Array:(NSArray *)array {
-  result.packedUint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  builder_result.packedUint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedUint32Values:(const uint32_t *)values count:(NSUInteger)count {
-  result.packedUint32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
-  return self;
+- (PBAppendableArray *) packedUint32 {
+  return builder_result.packedUint32Array;
 }
 - (TestPackedTypesLite_Builder *)clearPackedUint32 {
-  result.packedUint32Array = nil;
+  builder_result.packedUint32Array = nil;
   return self;
 }
-- (PBAppendableArray *)packedUint64 {
-  return result.packedUint64Array;
-}
-- (uint64_t)packedUint64AtIndex:(NSUInteger)index {
-  return [result packedUint64AtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedUint64:(uint64_t)value {
-  if (result.packedUint64Array == nil) {
-    result.packedUint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+  if (builder_result.packedUint64Array == nil) {
+    builder_result.packedUint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
   }
-  [result.packedUint64Array addUint64:value];
+  [builder_result.packedUint64Array addUint64:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedUint64Array:(NSArray *)array {
-  result.packedUint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
-  return self;
-}
-- (TestPackedTypesLite_Builder *)setPackedUint64Values:(const uint64_t *)values count:(NSUInteger)count {
-  result.packedUint64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
-  return self;
-}
-- (TestPackedTypesLite_Builder *)clearPackedUint64 {
-  result.packedUint64Array = nil;
+  builder_result.packedUint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
   return self;
 }
-- (PBAppendableArray *)packedSint32 {
-  return result.packedSint32Array;
+- (PBAppendableArray *) packedUint64 {
+  return builder_result.packedUint64Array;
 }
-- (int32_t)packedSint32AtIndex:(NSUInteger)index {
-  return [result packedSint32AtIndex:index];
+- (TestPackedTypesLite_Builder *)clearPackedUint64 {
+  builder_result.packedUint64Array = nil;
+  return self;
 }
 - (TestPackedTypesLite_Builder *)addPackedSint32:(int32_t)value {
-  if (result.packedSint32Array == nil) {
-    result.packedSint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (builder_result.packedSint32Array == nil) {
+    builder_result.packedSint32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
   }
-  [result.packedSint32Array addInt32:value];
+  [builder_result.packedSint32Array addInt32:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSint32Array:(NSArray *)array {
-  result.packedSint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  builder_result.packedSint32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedSint32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.packedSint32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
-  return self;
+- (PBAppendableArray *) packedSint32 {
+  return builder_result.packedSint32Array;
 }
 - (TestPackedTypesLite_Builder *)clearPackedSint32 {
-  result.packedSint32Array = nil;
+  builder_result.packedSint32Array = nil;
   return self;
 }
-- (PBAppendableArray *)packedSint64 {
-  return result.packedSint64Array;
-}
-- (int64_t)packedSint64AtIndex:(NSUInteger)index {
-  return [result packedSint64AtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedSint64:(int64_t)value {
-  if (result.packedSint64Array == nil) {
-    result.packedSint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (builder_result.packedSint64Array == nil) {
+    builder_result.packedSint64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
   }
-  [result.packedSint64Array addInt64:value];
+  [builder_result.packedSint64Array addInt64:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSint64Array:(NSArray *)array {
-  result.packedSint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  builder_result.packedSint64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedSint64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.packedSint64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
-  return self;
+- (PBAppendableArray *) packedSint64 {
+  return builder_result.packedSint64Array;
 }
 - (TestPackedTypesLite_Builder *)clearPackedSint64 {
-  result.packedSint64Array = nil;
+  builder_result.packedSint64Array = nil;
   return self;
 }
-- (PBAppendableArray *)packedFixed32 {
-  return result.packedFixed32Array;
-}
-- (uint32_t)packedFixed32AtIndex:(NSUInteger)index {
-  return [result packedFixed32AtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedFixed32:(uint32_t)value {
-  if (result.packedFixed32Array == nil) {
-    result.packedFixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
+  if (builder_result.packedFixed32Array == nil) {
+    builder_result.packedFixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt32];
   }
-  [result.packedFixed32Array addUint32:value];
+  [builder_result.packedFixed32Array addUint32:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedFixed32Array:(NSArray *)array {
-  result.packedFixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
+  builder_result.packedFixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt32];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedFixed32Values:(const uint32_t *)values count:(NSUInteger)count {
-  result.packedFixed32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt32];
-  return self;
+- (PBAppendableArray *) packedFixed32 {
+  return builder_result.packedFixed32Array;
 }
 - (TestPackedTypesLite_Builder *)clearPackedFixed32 {
-  result.packedFixed32Array = nil;
+  builder_result.packedFixed32Array = nil;
   return self;
 }
-- (PBAppendableArray *)packedFixed64 {
-  return result.packedFixed64Array;
-}
-- (uint64_t)packedFixed64AtIndex:(NSUInteger)index {
-  return [result packedFixed64AtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedFixed64:(uint64_t)value {
-  if (result.packedFixed64Array == nil) {
-    result.packedFixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
+  if (builder_result.packedFixed64Array == nil) {
+    builder_result.packedFixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeUInt64];
   }
-  [result.packedFixed64Array addUint64:value];
+  [builder_result.packedFixed64Array addUint64:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedFixed64Array:(NSArray *)array {
-  result.packedFixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
+  builder_result.packedFixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeUInt64];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedFixed64Values:(const uint64_t *)values count:(NSUInteger)count {
-  result.packedFixed64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeUInt64];
-  return self;
+- (PBAppendableArray *) packedFixed64 {
+  return builder_result.packedFixed64Array;
 }
 - (TestPackedTypesLite_Builder *)clearPackedFixed64 {
-  result.packedFixed64Array = nil;
+  builder_result.packedFixed64Array = nil;
   return self;
 }
-- (PBAppendableArray *)packedSfixed32 {
-  return result.packedSfixed32Array;
-}
-- (int32_t)packedSfixed32AtIndex:(NSUInteger)index {
-  return [result packedSfixed32AtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedSfixed32:(int32_t)value {
-  if (result.packedSfixed32Array == nil) {
-    result.packedSfixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (builder_result.packedSfixed32Array == nil) {
+    builder_result.packedSfixed32Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
   }
-  [result.packedSfixed32Array addInt32:value];
+  [builder_result.packedSfixed32Array addInt32:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSfixed32Array:(NSArray *)array {
-  result.packedSfixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  builder_result.packedSfixed32Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedSfixed32Values:(const int32_t *)values count:(NSUInteger)count {
-  result.packedSfixed32Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
-  return self;
+- (PBAppendableArray *) packedSfixed32 {
+  return builder_result.packedSfixed32Array;
 }
 - (TestPackedTypesLite_Builder *)clearPackedSfixed32 {
-  result.packedSfixed32Array = nil;
+  builder_result.packedSfixed32Array = nil;
   return self;
 }
-- (PBAppendableArray *)packedSfixed64 {
-  return result.packedSfixed64Array;
-}
-- (int64_t)packedSfixed64AtIndex:(NSUInteger)index {
-  return [result packedSfixed64AtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedSfixed64:(int64_t)value {
-  if (result.packedSfixed64Array == nil) {
-    result.packedSfixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  if (builder_result.packedSfixed64Array == nil) {
+    builder_result.packedSfixed64Array = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
   }
-  [result.packedSfixed64Array addInt64:value];
+  [builder_result.packedSfixed64Array addInt64:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedSfixed64Array:(NSArray *)array {
-  result.packedSfixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  builder_result.packedSfixed64Array = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedSfixed64Values:(const int64_t *)values count:(NSUInteger)count {
-  result.packedSfixed64Array = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt64];
-  return self;
+- (PBAppendableArray *) packedSfixed64 {
+  return builder_result.packedSfixed64Array;
 }
 - (TestPackedTypesLite_Builder *)clearPackedSfixed64 {
-  result.packedSfixed64Array = nil;
+  builder_result.packedSfixed64Array = nil;
   return self;
 }
-- (PBAppendableArray *)packedFloat {
-  return result.packedFloatArray;
-}
-- (Float32)packedFloatAtIndex:(NSUInteger)index {
-  return [result packedFloatAtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedFloat:(Float32)value {
-  if (result.packedFloatArray == nil) {
-    result.packedFloatArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeFloat];
+  if (builder_result.packedFloatArray == nil) {
+    builder_result.packedFloatArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeFloat];
   }
-  [result.packedFloatArray addFloat:value];
+  [builder_result.packedFloatArray addFloat:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedFloatArray:(NSArray *)array {
-  result.packedFloatArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeFloat];
+  builder_result.packedFloatArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeFloat];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedFloatValues:(const Float32 *)values count:(NSUInteger)count {
-  result.packedFloatArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeFloat];
-  return self;
+- (PBAppendableArray *) packedFloat {
+  return builder_result.packedFloatArray;
 }
 - (TestPackedTypesLite_Builder *)clearPackedFloat {
-  result.packedFloatArray = nil;
+  builder_result.packedFloatArray = nil;
   return self;
 }
-- (PBAppendableArray *)packedDouble {
-  return result.packedDoubleArray;
-}
-- (Float64)packedDoubleAtIndex:(NSUInteger)index {
-  return [result packedDoubleAtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedDouble:(Float64)value {
-  if (result.packedDoubleArray == nil) {
-    result.packedDoubleArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeDouble];
+  if (builder_result.packedDoubleArray == nil) {
+    builder_result.packedDoubleArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeDouble];
   }
-  [result.packedDoubleArray addDouble:value];
+  [builder_result.packedDoubleArray addDouble:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedDoubleArray:(NSArray *)array {
-  result.packedDoubleArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeDouble];
+  builder_result.packedDoubleArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeDouble];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedDoubleValues:(const Float64 *)values count:(NSUInteger)count {
-  result.packedDoubleArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeDouble];
-  return self;
+- (PBAppendableArray *) packedDouble {
+  return builder_result.packedDoubleArray;
 }
 - (TestPackedTypesLite_Builder *)clearPackedDouble {
-  result.packedDoubleArray = nil;
+  builder_result.packedDoubleArray = nil;
   return self;
 }
-- (PBAppendableArray *)packedBool {
-  return result.packedBoolArray;
-}
-- (BOOL)packedBoolAtIndex:(NSUInteger)index {
-  return [result packedBoolAtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedBool:(BOOL)value {
-  if (result.packedBoolArray == nil) {
-    result.packedBoolArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeBool];
+  if (builder_result.packedBoolArray == nil) {
+    builder_result.packedBoolArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeBool];
   }
-  [result.packedBoolArray addBool:value];
+  [builder_result.packedBoolArray addBool:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedBoolArray:(NSArray *)array {
-  result.packedBoolArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeBool];
+  builder_result.packedBoolArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeBool];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedBoolValues:(const BOOL *)values count:(NSUInteger)count {
-  result.packedBoolArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeBool];
-  return self;
+- (PBAppendableArray *) packedBool {
+  return builder_result.packedBoolArray;
 }
 - (TestPackedTypesLite_Builder *)clearPackedBool {
-  result.packedBoolArray = nil;
+  builder_result.packedBoolArray = nil;
   return self;
 }
-- (PBAppendableArray *)packedEnum {
-  return result.packedEnumArray;
-}
-- (ForeignEnumLite)packedEnumAtIndex:(NSUInteger)index {
-  return [result packedEnumAtIndex:index];
-}
 - (TestPackedTypesLite_Builder *)addPackedEnum:(ForeignEnumLite)value {
-  if (result.packedEnumArray == nil) {
-    result.packedEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
+  if (builder_result.packedEnumArray == nil) {
+    builder_result.packedEnumArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt32];
   }
-  [result.packedEnumArray addInt32:value];
+  [builder_result.packedEnumArray addInt32:value];
   return self;
 }
 - (TestPackedTypesLite_Builder *)setPackedEnumArray:(NSArray *)array {
-  result.packedEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
+  builder_result.packedEnumArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt32];
   return self;
 }
-- (TestPackedTypesLite_Builder *)setPackedEnumValues:(const ForeignEnumLite *)values count:(NSUInteger)count {
-  result.packedEnumArray = [PBAppendableArray arrayWithValues:values count:count valueType:PBArrayValueTypeInt32];
-  return self;
+- (PBAppendableArray *)packedEnum {
+  return builder_result.packedEnumArray;
 }
 - (TestPackedTypesLite_Builder *)clearPackedEnum {
-  result.packedEnumArray = nil;
+  builder_result.packedEnumArray = nil;
   return self;
 }
 @end
@@ -7385,23 +8275,21 @@ static TestPackedTypesLite* defaultTestPackedTypesLiteInstance = nil;
 
 @implementation TestAllExtensionsLite
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestAllExtensionsLite class]) {
-    defaultTestAllExtensionsLiteInstance = [[TestAllExtensionsLite alloc] init];
-  }
-}
 + (TestAllExtensionsLite*) defaultInstance {
+  static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestAllExtensionsLiteInstance = [[TestAllExtensionsLite alloc] init];
+  });
   return defaultTestAllExtensionsLiteInstance;
 }
 - (TestAllExtensionsLite*) defaultInstance {
-  return defaultTestAllExtensionsLiteInstance;
+  return [TestAllExtensionsLite defaultInstance];
 }
 - (BOOL) isInitialized {
   if (!self.extensionsAreInitialized) {
@@ -7416,34 +8304,16 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestAllExtensionsLite*) parseFromData:(NSData*) data {
-  return (TestAllExtensionsLite*)[[[TestAllExtensionsLite builder] mergeFromData:data] build];
-}
-+ (TestAllExtensionsLite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllExtensionsLite*)[[[TestAllExtensionsLite builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestAllExtensionsLite*) parseFromInputStream:(NSInputStream*) input {
-  return (TestAllExtensionsLite*)[[[TestAllExtensionsLite builder] mergeFromInputStream:input] build];
-}
-+ (TestAllExtensionsLite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllExtensionsLite*)[[[TestAllExtensionsLite builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestAllExtensionsLite*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestAllExtensionsLite*)[[[TestAllExtensionsLite builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestAllExtensionsLite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestAllExtensionsLite*)[[[TestAllExtensionsLite builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestAllExtensionsLite_Builder*) builder {
   return [[TestAllExtensionsLite_Builder alloc] init];
@@ -7457,12 +8327,11 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
 - (TestAllExtensionsLite_Builder*) toBuilder {
   return [TestAllExtensionsLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
-                                            from:1
-                                              to:536870912
-                                      withIndent:indent];
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self writeExtensionTextFormatTo:writer
+                              from:1
+                                to:536870912];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -7474,7 +8343,7 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
   TestAllExtensionsLite *otherMessage = other;
   return
       [self isEqualExtensionsInOther:otherMessage from:1 to:536870912] &&
-      
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
@@ -7483,30 +8352,24 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface TestAllExtensionsLite_Builder()
-@property (strong) TestAllExtensionsLite* result;
+@property (strong) TestAllExtensionsLite* builder_result;
 @end
 
 @implementation TestAllExtensionsLite_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestAllExtensionsLite alloc] init];
+    self.builder_result = [[TestAllExtensionsLite alloc] init];
   }
   return self;
 }
 - (PBExtendableMessage*) internalGetResult {
-  return result;
-}
-- (TestAllExtensionsLite_Builder*) clear {
-  self.result = [[TestAllExtensionsLite alloc] init];
-  return self;
-}
-- (TestAllExtensionsLite_Builder*) clone {
-  return [TestAllExtensionsLite builderWithPrototype:result];
+  return builder_result;
 }
 - (TestAllExtensionsLite*) defaultInstance {
   return [TestAllExtensionsLite defaultInstance];
@@ -7516,8 +8379,8 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
   return [self buildPartial];
 }
 - (TestAllExtensionsLite*) buildPartial {
-  TestAllExtensionsLite* returnMe = result;
-  self.result = nil;
+  TestAllExtensionsLite* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestAllExtensionsLite_Builder*) mergeFrom:(TestAllExtensionsLite*) other {
@@ -7528,9 +8391,6 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestAllExtensionsLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestAllExtensionsLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -7549,39 +8409,50 @@ static TestAllExtensionsLite* defaultTestAllExtensionsLiteInstance = nil;
     }
   }
 }
+- (TestAllExtensionsLite_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (TestAllExtensionsLite_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface OptionalGroup_extension_lite ()
-@property int32_t a;
+@property (nonatomic, readwrite) BOOL hasA;
+@property (nonatomic, readwrite) int32_t a;
 @end
 
 @implementation OptionalGroup_extension_lite
 
-- (BOOL) hasA {
-  return !!hasA_;
-}
-- (void) setHasA:(BOOL) value {
-  hasA_ = !!value;
-}
-@synthesize a;
-
 - (id) init {
   if ((self = [super init])) {
     self.a = 0;
   }
   return self;
 }
-static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance = nil;
-+ (void) initialize {
-  if (self == [OptionalGroup_extension_lite class]) {
-    defaultOptionalGroup_extension_liteInstance = [[OptionalGroup_extension_lite alloc] init];
-  }
-}
 + (OptionalGroup_extension_lite*) defaultInstance {
+  static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultOptionalGroup_extension_liteInstance = [[OptionalGroup_extension_lite alloc] init];
+  });
   return defaultOptionalGroup_extension_liteInstance;
 }
 - (OptionalGroup_extension_lite*) defaultInstance {
-  return defaultOptionalGroup_extension_liteInstance;
+  return [OptionalGroup_extension_lite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -7593,36 +8464,18 @@ static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasA) {
-    size += computeInt32Size(17, self.a);
+    size_ += computeInt32Size(17, self.a);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (OptionalGroup_extension_lite*) parseFromData:(NSData*) data {
-  return (OptionalGroup_extension_lite*)[[[OptionalGroup_extension_lite builder] mergeFromData:data] build];
-}
-+ (OptionalGroup_extension_lite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (OptionalGroup_extension_lite*)[[[OptionalGroup_extension_lite builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (OptionalGroup_extension_lite*) parseFromInputStream:(NSInputStream*) input {
-  return (OptionalGroup_extension_lite*)[[[OptionalGroup_extension_lite builder] mergeFromInputStream:input] build];
-}
-+ (OptionalGroup_extension_lite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (OptionalGroup_extension_lite*)[[[OptionalGroup_extension_lite builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (OptionalGroup_extension_lite*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (OptionalGroup_extension_lite*)[[[OptionalGroup_extension_lite builder] mergeFromCodedInputStream:input] build];
-}
-+ (OptionalGroup_extension_lite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (OptionalGroup_extension_lite*)[[[OptionalGroup_extension_lite builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (OptionalGroup_extension_lite_Builder*) builder {
   return [[OptionalGroup_extension_lite_Builder alloc] init];
@@ -7636,11 +8489,11 @@ static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance
 - (OptionalGroup_extension_lite_Builder*) toBuilder {
   return [OptionalGroup_extension_lite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasA) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"a", [NSNumber numberWithInt:self.a]];
+    PBTextFormatWriteInt32(writer, "a", self.a);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -7653,41 +8506,37 @@ static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance
   return
       self.hasA == otherMessage.hasA &&
       (!self.hasA || self.a == otherMessage.a) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasA) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.a] hash];
+    hashCode = hashCode * 31 + [@(self.a) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasA) {
+    PBJSONWriteInt32(writer, "a", self.a);
+  }
+}
 @end
 
 @interface OptionalGroup_extension_lite_Builder()
-@property (strong) OptionalGroup_extension_lite* result;
+@property (strong) OptionalGroup_extension_lite* builder_result;
 @end
 
 @implementation OptionalGroup_extension_lite_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[OptionalGroup_extension_lite alloc] init];
+    self.builder_result = [[OptionalGroup_extension_lite alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (OptionalGroup_extension_lite_Builder*) clear {
-  self.result = [[OptionalGroup_extension_lite alloc] init];
-  return self;
-}
-- (OptionalGroup_extension_lite_Builder*) clone {
-  return [OptionalGroup_extension_lite builderWithPrototype:result];
+  return builder_result;
 }
 - (OptionalGroup_extension_lite*) defaultInstance {
   return [OptionalGroup_extension_lite defaultInstance];
@@ -7697,8 +8546,8 @@ static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance
   return [self buildPartial];
 }
 - (OptionalGroup_extension_lite*) buildPartial {
-  OptionalGroup_extension_lite* returnMe = result;
-  self.result = nil;
+  OptionalGroup_extension_lite* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (OptionalGroup_extension_lite_Builder*) mergeFrom:(OptionalGroup_extension_lite*) other {
@@ -7711,9 +8560,6 @@ static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (OptionalGroup_extension_lite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (OptionalGroup_extension_lite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -7736,55 +8582,88 @@ static OptionalGroup_extension_lite* defaultOptionalGroup_extension_liteInstance
     }
   }
 }
-- (BOOL) hasA {
-  return result.hasA;
+- (OptionalGroup_extension_lite_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 1:
+        if (memcmp(name, "a", 1) == 0) {
+          [self setA:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) a {
-  return result.a;
+- (OptionalGroup_extension_lite_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 1:
+        if (memcmp(name, "a", 1) == 0) {
+          number = 17;
+        }
+        break;
+    }
+    switch (number) {
+      case 17: {
+        [self setA:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (OptionalGroup_extension_lite_Builder*) setA:(int32_t) value {
-  result.hasA = YES;
-  result.a = value;
+  builder_result.hasA = YES;
+  builder_result.a = value;
   return self;
 }
-- (OptionalGroup_extension_lite_Builder*) clearA {
-  result.hasA = NO;
-  result.a = 0;
+- (int32_t) a {
+  return builder_result.a;
+}
+- (BOOL)hasA {
+ return builder_result.hasA;
+}
+- (OptionalGroup_extension_lite_Builder*)clearA {
+  builder_result.hasA = NO;
+  builder_result.a = 0;
   return self;
 }
 @end
 
 @interface RepeatedGroup_extension_lite ()
-@property int32_t a;
+@property (nonatomic, readwrite) BOOL hasA;
+@property (nonatomic, readwrite) int32_t a;
 @end
 
 @implementation RepeatedGroup_extension_lite
 
-- (BOOL) hasA {
-  return !!hasA_;
-}
-- (void) setHasA:(BOOL) value {
-  hasA_ = !!value;
-}
-@synthesize a;
-
 - (id) init {
   if ((self = [super init])) {
     self.a = 0;
   }
   return self;
 }
-static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance = nil;
-+ (void) initialize {
-  if (self == [RepeatedGroup_extension_lite class]) {
-    defaultRepeatedGroup_extension_liteInstance = [[RepeatedGroup_extension_lite alloc] init];
-  }
-}
 + (RepeatedGroup_extension_lite*) defaultInstance {
+  static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultRepeatedGroup_extension_liteInstance = [[RepeatedGroup_extension_lite alloc] init];
+  });
   return defaultRepeatedGroup_extension_liteInstance;
 }
 - (RepeatedGroup_extension_lite*) defaultInstance {
-  return defaultRepeatedGroup_extension_liteInstance;
+  return [RepeatedGroup_extension_lite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -7796,36 +8675,18 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasA) {
-    size += computeInt32Size(47, self.a);
+    size_ += computeInt32Size(47, self.a);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (RepeatedGroup_extension_lite*) parseFromData:(NSData*) data {
-  return (RepeatedGroup_extension_lite*)[[[RepeatedGroup_extension_lite builder] mergeFromData:data] build];
-}
-+ (RepeatedGroup_extension_lite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (RepeatedGroup_extension_lite*)[[[RepeatedGroup_extension_lite builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (RepeatedGroup_extension_lite*) parseFromInputStream:(NSInputStream*) input {
-  return (RepeatedGroup_extension_lite*)[[[RepeatedGroup_extension_lite builder] mergeFromInputStream:input] build];
-}
-+ (RepeatedGroup_extension_lite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (RepeatedGroup_extension_lite*)[[[RepeatedGroup_extension_lite builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (RepeatedGroup_extension_lite*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (RepeatedGroup_extension_lite*)[[[RepeatedGroup_extension_lite builder] mergeFromCodedInputStream:input] build];
-}
-+ (RepeatedGroup_extension_lite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (RepeatedGroup_extension_lite*)[[[RepeatedGroup_extension_lite builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (RepeatedGroup_extension_lite_Builder*) builder {
   return [[RepeatedGroup_extension_lite_Builder alloc] init];
@@ -7839,11 +8700,11 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
 - (RepeatedGroup_extension_lite_Builder*) toBuilder {
   return [RepeatedGroup_extension_lite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasA) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"a", [NSNumber numberWithInt:self.a]];
+    PBTextFormatWriteInt32(writer, "a", self.a);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -7856,41 +8717,37 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
   return
       self.hasA == otherMessage.hasA &&
       (!self.hasA || self.a == otherMessage.a) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasA) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.a] hash];
+    hashCode = hashCode * 31 + [@(self.a) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasA) {
+    PBJSONWriteInt32(writer, "a", self.a);
+  }
+}
 @end
 
 @interface RepeatedGroup_extension_lite_Builder()
-@property (strong) RepeatedGroup_extension_lite* result;
+@property (strong) RepeatedGroup_extension_lite* builder_result;
 @end
 
 @implementation RepeatedGroup_extension_lite_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[RepeatedGroup_extension_lite alloc] init];
+    self.builder_result = [[RepeatedGroup_extension_lite alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (RepeatedGroup_extension_lite_Builder*) clear {
-  self.result = [[RepeatedGroup_extension_lite alloc] init];
-  return self;
-}
-- (RepeatedGroup_extension_lite_Builder*) clone {
-  return [RepeatedGroup_extension_lite builderWithPrototype:result];
+  return builder_result;
 }
 - (RepeatedGroup_extension_lite*) defaultInstance {
   return [RepeatedGroup_extension_lite defaultInstance];
@@ -7900,8 +8757,8 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
   return [self buildPartial];
 }
 - (RepeatedGroup_extension_lite*) buildPartial {
-  RepeatedGroup_extension_lite* returnMe = result;
-  self.result = nil;
+  RepeatedGroup_extension_lite* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (RepeatedGroup_extension_lite_Builder*) mergeFrom:(RepeatedGroup_extension_lite*) other {
@@ -7914,9 +8771,6 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (RepeatedGroup_extension_lite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (RepeatedGroup_extension_lite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -7939,20 +8793,61 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
     }
   }
 }
-- (BOOL) hasA {
-  return result.hasA;
+- (RepeatedGroup_extension_lite_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 1:
+        if (memcmp(name, "a", 1) == 0) {
+          [self setA:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) a {
-  return result.a;
+- (RepeatedGroup_extension_lite_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 1:
+        if (memcmp(name, "a", 1) == 0) {
+          number = 47;
+        }
+        break;
+    }
+    switch (number) {
+      case 47: {
+        [self setA:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (RepeatedGroup_extension_lite_Builder*) setA:(int32_t) value {
-  result.hasA = YES;
-  result.a = value;
+  builder_result.hasA = YES;
+  builder_result.a = value;
   return self;
 }
-- (RepeatedGroup_extension_lite_Builder*) clearA {
-  result.hasA = NO;
-  result.a = 0;
+- (int32_t) a {
+  return builder_result.a;
+}
+- (BOOL)hasA {
+ return builder_result.hasA;
+}
+- (RepeatedGroup_extension_lite_Builder*)clearA {
+  builder_result.hasA = NO;
+  builder_result.a = 0;
   return self;
 }
 @end
@@ -7962,23 +8857,21 @@ static RepeatedGroup_extension_lite* defaultRepeatedGroup_extension_liteInstance
 
 @implementation TestPackedExtensionsLite
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestPackedExtensionsLite class]) {
-    defaultTestPackedExtensionsLiteInstance = [[TestPackedExtensionsLite alloc] init];
-  }
-}
 + (TestPackedExtensionsLite*) defaultInstance {
+  static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestPackedExtensionsLiteInstance = [[TestPackedExtensionsLite alloc] init];
+  });
   return defaultTestPackedExtensionsLiteInstance;
 }
 - (TestPackedExtensionsLite*) defaultInstance {
-  return defaultTestPackedExtensionsLiteInstance;
+  return [TestPackedExtensionsLite defaultInstance];
 }
 - (BOOL) isInitialized {
   if (!self.extensionsAreInitialized) {
@@ -7993,34 +8886,16 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestPackedExtensionsLite*) parseFromData:(NSData*) data {
-  return (TestPackedExtensionsLite*)[[[TestPackedExtensionsLite builder] mergeFromData:data] build];
-}
-+ (TestPackedExtensionsLite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestPackedExtensionsLite*)[[[TestPackedExtensionsLite builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestPackedExtensionsLite*) parseFromInputStream:(NSInputStream*) input {
-  return (TestPackedExtensionsLite*)[[[TestPackedExtensionsLite builder] mergeFromInputStream:input] build];
-}
-+ (TestPackedExtensionsLite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestPackedExtensionsLite*)[[[TestPackedExtensionsLite builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestPackedExtensionsLite*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestPackedExtensionsLite*)[[[TestPackedExtensionsLite builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestPackedExtensionsLite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestPackedExtensionsLite*)[[[TestPackedExtensionsLite builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestPackedExtensionsLite_Builder*) builder {
   return [[TestPackedExtensionsLite_Builder alloc] init];
@@ -8034,12 +8909,11 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
 - (TestPackedExtensionsLite_Builder*) toBuilder {
   return [TestPackedExtensionsLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
-                                            from:1
-                                              to:536870912
-                                      withIndent:indent];
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self writeExtensionTextFormatTo:writer
+                              from:1
+                                to:536870912];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -8051,7 +8925,7 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
   TestPackedExtensionsLite *otherMessage = other;
   return
       [self isEqualExtensionsInOther:otherMessage from:1 to:536870912] &&
-      
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
@@ -8060,30 +8934,24 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface TestPackedExtensionsLite_Builder()
-@property (strong) TestPackedExtensionsLite* result;
+@property (strong) TestPackedExtensionsLite* builder_result;
 @end
 
 @implementation TestPackedExtensionsLite_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestPackedExtensionsLite alloc] init];
+    self.builder_result = [[TestPackedExtensionsLite alloc] init];
   }
   return self;
 }
 - (PBExtendableMessage*) internalGetResult {
-  return result;
-}
-- (TestPackedExtensionsLite_Builder*) clear {
-  self.result = [[TestPackedExtensionsLite alloc] init];
-  return self;
-}
-- (TestPackedExtensionsLite_Builder*) clone {
-  return [TestPackedExtensionsLite builderWithPrototype:result];
+  return builder_result;
 }
 - (TestPackedExtensionsLite*) defaultInstance {
   return [TestPackedExtensionsLite defaultInstance];
@@ -8093,8 +8961,8 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
   return [self buildPartial];
 }
 - (TestPackedExtensionsLite*) buildPartial {
-  TestPackedExtensionsLite* returnMe = result;
-  self.result = nil;
+  TestPackedExtensionsLite* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestPackedExtensionsLite_Builder*) mergeFrom:(TestPackedExtensionsLite*) other {
@@ -8105,9 +8973,6 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestPackedExtensionsLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestPackedExtensionsLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -8126,6 +8991,25 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
     }
   }
 }
+- (TestPackedExtensionsLite_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (TestPackedExtensionsLite_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface TestNestedExtensionLite ()
@@ -8133,26 +9017,24 @@ static TestPackedExtensionsLite* defaultTestPackedExtensionsLiteInstance = nil;
 
 @implementation TestNestedExtensionLite
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-+ (id<PBExtensionField>) nestedExtension {
-  return TestNestedExtensionLite_nestedExtension;
-}
-static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestNestedExtensionLite class]) {
-    defaultTestNestedExtensionLiteInstance = [[TestNestedExtensionLite alloc] init];
-  }
-}
 + (TestNestedExtensionLite*) defaultInstance {
+  static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestNestedExtensionLiteInstance = [[TestNestedExtensionLite alloc] init];
+  });
   return defaultTestNestedExtensionLiteInstance;
 }
 - (TestNestedExtensionLite*) defaultInstance {
-  return defaultTestNestedExtensionLiteInstance;
+  return [TestNestedExtensionLite defaultInstance];
+}
++ (id<PBExtensionField>) nestedExtension {
+  return TestNestedExtensionLite_nestedExtension;
 }
 - (BOOL) isInitialized {
   return YES;
@@ -8161,33 +9043,15 @@ static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestNestedExtensionLite*) parseFromData:(NSData*) data {
-  return (TestNestedExtensionLite*)[[[TestNestedExtensionLite builder] mergeFromData:data] build];
-}
-+ (TestNestedExtensionLite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestNestedExtensionLite*)[[[TestNestedExtensionLite builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestNestedExtensionLite*) parseFromInputStream:(NSInputStream*) input {
-  return (TestNestedExtensionLite*)[[[TestNestedExtensionLite builder] mergeFromInputStream:input] build];
-}
-+ (TestNestedExtensionLite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestNestedExtensionLite*)[[[TestNestedExtensionLite builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestNestedExtensionLite*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestNestedExtensionLite*)[[[TestNestedExtensionLite builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestNestedExtensionLite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestNestedExtensionLite*)[[[TestNestedExtensionLite builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestNestedExtensionLite_Builder*) builder {
   return [[TestNestedExtensionLite_Builder alloc] init];
@@ -8201,8 +9065,8 @@ static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
 - (TestNestedExtensionLite_Builder*) toBuilder {
   return [TestNestedExtensionLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -8220,30 +9084,24 @@ static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface TestNestedExtensionLite_Builder()
-@property (strong) TestNestedExtensionLite* result;
+@property (strong) TestNestedExtensionLite* builder_result;
 @end
 
 @implementation TestNestedExtensionLite_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestNestedExtensionLite alloc] init];
+    self.builder_result = [[TestNestedExtensionLite alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestNestedExtensionLite_Builder*) clear {
-  self.result = [[TestNestedExtensionLite alloc] init];
-  return self;
-}
-- (TestNestedExtensionLite_Builder*) clone {
-  return [TestNestedExtensionLite builderWithPrototype:result];
+  return builder_result;
 }
 - (TestNestedExtensionLite*) defaultInstance {
   return [TestNestedExtensionLite defaultInstance];
@@ -8253,8 +9111,8 @@ static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
   return [self buildPartial];
 }
 - (TestNestedExtensionLite*) buildPartial {
-  TestNestedExtensionLite* returnMe = result;
-  self.result = nil;
+  TestNestedExtensionLite* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestNestedExtensionLite_Builder*) mergeFrom:(TestNestedExtensionLite*) other {
@@ -8264,9 +9122,6 @@ static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestNestedExtensionLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestNestedExtensionLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -8285,39 +9140,50 @@ static TestNestedExtensionLite* defaultTestNestedExtensionLiteInstance = nil;
     }
   }
 }
+- (TestNestedExtensionLite_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (TestNestedExtensionLite_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface TestDeprecatedLite ()
-@property int32_t deprecatedField;
+@property (nonatomic, readwrite) BOOL hasDeprecatedField;
+@property (nonatomic, readwrite) int32_t deprecatedField;
 @end
 
 @implementation TestDeprecatedLite
 
-- (BOOL) hasDeprecatedField {
-  return !!hasDeprecatedField_;
-}
-- (void) setHasDeprecatedField:(BOOL) value {
-  hasDeprecatedField_ = !!value;
-}
-@synthesize deprecatedField;
-
 - (id) init {
   if ((self = [super init])) {
     self.deprecatedField = 0;
   }
   return self;
 }
-static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
-+ (void) initialize {
-  if (self == [TestDeprecatedLite class]) {
-    defaultTestDeprecatedLiteInstance = [[TestDeprecatedLite alloc] init];
-  }
-}
 + (TestDeprecatedLite*) defaultInstance {
+  static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestDeprecatedLiteInstance = [[TestDeprecatedLite alloc] init];
+  });
   return defaultTestDeprecatedLiteInstance;
 }
 - (TestDeprecatedLite*) defaultInstance {
-  return defaultTestDeprecatedLiteInstance;
+  return [TestDeprecatedLite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -8329,36 +9195,18 @@ static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasDeprecatedField) {
-    size += computeInt32Size(1, self.deprecatedField);
+    size_ += computeInt32Size(1, self.deprecatedField);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestDeprecatedLite*) parseFromData:(NSData*) data {
-  return (TestDeprecatedLite*)[[[TestDeprecatedLite builder] mergeFromData:data] build];
-}
-+ (TestDeprecatedLite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestDeprecatedLite*)[[[TestDeprecatedLite builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestDeprecatedLite*) parseFromInputStream:(NSInputStream*) input {
-  return (TestDeprecatedLite*)[[[TestDeprecatedLite builder] mergeFromInputStream:input] build];
-}
-+ (TestDeprecatedLite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestDeprecatedLite*)[[[TestDeprecatedLite builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestDeprecatedLite*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestDeprecatedLite*)[[[TestDeprecatedLite builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestDeprecatedLite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestDeprecatedLite*)[[[TestDeprecatedLite builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestDeprecatedLite_Builder*) builder {
   return [[TestDeprecatedLite_Builder alloc] init];
@@ -8372,11 +9220,11 @@ static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
 - (TestDeprecatedLite_Builder*) toBuilder {
   return [TestDeprecatedLite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasDeprecatedField) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"deprecatedField", [NSNumber numberWithInt:self.deprecatedField]];
+    PBTextFormatWriteInt32(writer, "deprecatedField", self.deprecatedField);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -8389,41 +9237,37 @@ static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
   return
       self.hasDeprecatedField == otherMessage.hasDeprecatedField &&
       (!self.hasDeprecatedField || self.deprecatedField == otherMessage.deprecatedField) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasDeprecatedField) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.deprecatedField] hash];
+    hashCode = hashCode * 31 + [@(self.deprecatedField) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasDeprecatedField) {
+    PBJSONWriteInt32(writer, "deprecatedField", self.deprecatedField);
+  }
+}
 @end
 
 @interface TestDeprecatedLite_Builder()
-@property (strong) TestDeprecatedLite* result;
+@property (strong) TestDeprecatedLite* builder_result;
 @end
 
 @implementation TestDeprecatedLite_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestDeprecatedLite alloc] init];
+    self.builder_result = [[TestDeprecatedLite alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestDeprecatedLite_Builder*) clear {
-  self.result = [[TestDeprecatedLite alloc] init];
-  return self;
-}
-- (TestDeprecatedLite_Builder*) clone {
-  return [TestDeprecatedLite builderWithPrototype:result];
+  return builder_result;
 }
 - (TestDeprecatedLite*) defaultInstance {
   return [TestDeprecatedLite defaultInstance];
@@ -8433,8 +9277,8 @@ static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
   return [self buildPartial];
 }
 - (TestDeprecatedLite*) buildPartial {
-  TestDeprecatedLite* returnMe = result;
-  self.result = nil;
+  TestDeprecatedLite* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestDeprecatedLite_Builder*) mergeFrom:(TestDeprecatedLite*) other {
@@ -8447,9 +9291,6 @@ static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestDeprecatedLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestDeprecatedLite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -8472,21 +9313,68 @@ static TestDeprecatedLite* defaultTestDeprecatedLiteInstance = nil;
     }
   }
 }
-- (BOOL) hasDeprecatedField {
-  return result.hasDeprecatedField;
+- (TestDeprecatedLite_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 16:
+        if (memcmp(name, "deprecated_field", 16) == 0) {
+          [self setDeprecatedField:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) deprecatedField {
-  return result.deprecatedField;
+- (TestDeprecatedLite_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 15:
+        if (memcmp(name, "deprecatedField", 15) == 0) {
+          number = 1;
+        }
+        break;
+      case 16:
+        if (memcmp(name, "deprecated_field", 16) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setDeprecatedField:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestDeprecatedLite_Builder*) setDeprecatedField:(int32_t) value {
-  result.hasDeprecatedField = YES;
-  result.deprecatedField = value;
+  builder_result.hasDeprecatedField = YES;
+  builder_result.deprecatedField = value;
   return self;
 }
-- (TestDeprecatedLite_Builder*) clearDeprecatedField {
-  result.hasDeprecatedField = NO;
-  result.deprecatedField = 0;
+- (int32_t) deprecatedField {
+  return builder_result.deprecatedField;
+}
+- (BOOL)hasDeprecatedField {
+ return builder_result.hasDeprecatedField;
+}
+- (TestDeprecatedLite_Builder*)clearDeprecatedField {
+  builder_result.hasDeprecatedField = NO;
+  builder_result.deprecatedField = 0;
   return self;
 }
 @end
 
+#pragma clang diagnostic pop
@@ -109,54 +109,32 @@
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry;
 @end
 
-@interface TestLiteImportsNonlite : PBGeneratedMessage {
-@private
-  BOOL hasMessage_:1;
-  TestAllTypes* message;
-}
-- (BOOL) hasMessage;
-@property (readonly, strong) TestAllTypes* message;
+@interface TestLiteImportsNonlite : PBGeneratedMessage
+- (BOOL)hasMessage;
+@property (nonatomic, readonly) TestAllTypes* message;
 
 + (TestLiteImportsNonlite*) defaultInstance;
 - (TestLiteImportsNonlite*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestLiteImportsNonlite_Builder*) builder;
 + (TestLiteImportsNonlite_Builder*) builder;
 + (TestLiteImportsNonlite_Builder*) builderWithPrototype:(TestLiteImportsNonlite*) prototype;
 - (TestLiteImportsNonlite_Builder*) toBuilder;
-
-+ (TestLiteImportsNonlite*) parseFromData:(NSData*) data;
-+ (TestLiteImportsNonlite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestLiteImportsNonlite*) parseFromInputStream:(NSInputStream*) input;
-+ (TestLiteImportsNonlite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestLiteImportsNonlite*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestLiteImportsNonlite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestLiteImportsNonlite_Builder : PBGeneratedMessage_Builder {
-@private
-  TestLiteImportsNonlite* result;
-}
-
+@interface TestLiteImportsNonlite_Builder : PBGeneratedMessage_Builder
 - (TestLiteImportsNonlite*) defaultInstance;
 
-- (TestLiteImportsNonlite_Builder*) clear;
-- (TestLiteImportsNonlite_Builder*) clone;
-
 - (TestLiteImportsNonlite*) build;
 - (TestLiteImportsNonlite*) buildPartial;
 
 - (TestLiteImportsNonlite_Builder*) mergeFrom:(TestLiteImportsNonlite*) other;
-- (TestLiteImportsNonlite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestLiteImportsNonlite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasMessage;
 - (TestAllTypes*) message;
+- (BOOL)hasMessage;
+- (TestLiteImportsNonlite_Builder*)clearMessage;
 - (TestLiteImportsNonlite_Builder*) setMessage:(TestAllTypes*) value;
 - (TestLiteImportsNonlite_Builder*) setMessageBuilder:(TestAllTypes_Builder*) builderForValue;
 - (TestLiteImportsNonlite_Builder*) mergeMessage:(TestAllTypes*) value;
-- (TestLiteImportsNonlite_Builder*) clearMessage;
 @end
 
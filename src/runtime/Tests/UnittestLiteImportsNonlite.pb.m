@@ -2,55 +2,48 @@
 
 #import "UnittestLiteImportsNonlite.pb.h"
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wshadow-ivar"
+
 @implementation UnittestLiteImportsNonliteRoot
-static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
-  return extensionRegistry;
-}
-
-+ (void) initialize {
-  if (self == [UnittestLiteImportsNonliteRoot class]) {
+  static PBExtensionRegistry* extensionRegistry = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
     PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
+    [UnittestLiteImportsNonliteRoot registerAllExtensions:registry];
     [UnittestRoot registerAllExtensions:registry];
     extensionRegistry = registry;
-  }
+  });
+  return extensionRegistry;
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
 }
 @end
 
 @interface TestLiteImportsNonlite ()
-@property (strong) TestAllTypes* message;
+@property (nonatomic, readwrite) BOOL hasMessage;
+@property (nonatomic, readwrite) TestAllTypes* message;
 @end
 
 @implementation TestLiteImportsNonlite
 
-- (BOOL) hasMessage {
-  return !!hasMessage_;
-}
-- (void) setHasMessage:(BOOL) value {
-  hasMessage_ = !!value;
-}
-@synthesize message;
-
 - (id) init {
   if ((self = [super init])) {
     self.message = [TestAllTypes defaultInstance];
   }
   return self;
 }
-static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
-+ (void) initialize {
-  if (self == [TestLiteImportsNonlite class]) {
-    defaultTestLiteImportsNonliteInstance = [[TestLiteImportsNonlite alloc] init];
-  }
-}
 + (TestLiteImportsNonlite*) defaultInstance {
+  static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestLiteImportsNonliteInstance = [[TestLiteImportsNonlite alloc] init];
+  });
   return defaultTestLiteImportsNonliteInstance;
 }
 - (TestLiteImportsNonlite*) defaultInstance {
-  return defaultTestLiteImportsNonliteInstance;
+  return [TestLiteImportsNonlite defaultInstance];
 }
 - (BOOL) isInitialized {
   return YES;
@@ -62,39 +55,21 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasMessage) {
-    size += computeMessageSize(1, self.message);
+    size_ += computeMessageSize(1, self.message);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestLiteImportsNonlite*) parseFromData:(NSData*) data {
-  return (TestLiteImportsNonlite*)[[[TestLiteImportsNonlite builder] mergeFromData:data] build];
-}
-+ (TestLiteImportsNonlite*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestLiteImportsNonlite*)[[[TestLiteImportsNonlite builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestLiteImportsNonlite*) parseFromInputStream:(NSInputStream*) input {
-  return (TestLiteImportsNonlite*)[[[TestLiteImportsNonlite builder] mergeFromInputStream:input] build];
-}
-+ (TestLiteImportsNonlite*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestLiteImportsNonlite*)[[[TestLiteImportsNonlite builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestLiteImportsNonlite*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestLiteImportsNonlite*)[[[TestLiteImportsNonlite builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestLiteImportsNonlite*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestLiteImportsNonlite*)[[[TestLiteImportsNonlite builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestLiteImportsNonlite_Builder*) builder {
-  return [[TestLiteImportsNonlite_Builder alloc] init] ;
+  return [[TestLiteImportsNonlite_Builder alloc] init];
 }
 + (TestLiteImportsNonlite_Builder*) builderWithPrototype:(TestLiteImportsNonlite*) prototype {
   return [[TestLiteImportsNonlite builder] mergeFrom:prototype];
@@ -105,14 +80,11 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
 - (TestLiteImportsNonlite_Builder*) toBuilder {
   return [TestLiteImportsNonlite builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasMessage) {
-    [output appendFormat:@"%@%@ {\n", indent, @"message"];
-    [self.message writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "message", self.message);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -125,7 +97,6 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
   return
       self.hasMessage == otherMessage.hasMessage &&
       (!self.hasMessage || [self.message isEqual:otherMessage.message]) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
@@ -136,30 +107,27 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasMessage) {
+    PBJSONWriteMessage(writer, "message", self.message);
+  }
+}
 @end
 
 @interface TestLiteImportsNonlite_Builder()
-@property (strong) TestLiteImportsNonlite* result;
+@property (strong) TestLiteImportsNonlite* builder_result;
 @end
 
 @implementation TestLiteImportsNonlite_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestLiteImportsNonlite alloc] init] ;
+    self.builder_result = [[TestLiteImportsNonlite alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestLiteImportsNonlite_Builder*) clear {
-  self.result = [[TestLiteImportsNonlite alloc] init] ;
-  return self;
-}
-- (TestLiteImportsNonlite_Builder*) clone {
-  return [TestLiteImportsNonlite builderWithPrototype:result];
+  return builder_result;
 }
 - (TestLiteImportsNonlite*) defaultInstance {
   return [TestLiteImportsNonlite defaultInstance];
@@ -169,8 +137,8 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
   return [self buildPartial];
 }
 - (TestLiteImportsNonlite*) buildPartial {
-  TestLiteImportsNonlite* returnMe = result;
-  self.result = nil;
+  TestLiteImportsNonlite* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestLiteImportsNonlite_Builder*) mergeFrom:(TestLiteImportsNonlite*) other {
@@ -183,9 +151,6 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestLiteImportsNonlite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestLiteImportsNonlite_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -203,8 +168,8 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
       }
       case 10: {
         TestAllTypes_Builder* subBuilder = [TestAllTypes builder];
-        if (self.hasMessage) {
-          [subBuilder mergeFrom:self.message];
+        if (self.builder_result.hasMessage) {
+          [subBuilder mergeFrom:self.builder_result.message];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setMessage:[subBuilder buildPartial]];
@@ -213,35 +178,87 @@ static TestLiteImportsNonlite* defaultTestLiteImportsNonliteInstance = nil;
     }
   }
 }
-- (BOOL) hasMessage {
-  return result.hasMessage;
+- (TestLiteImportsNonlite_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 7:
+        if (memcmp(name, "message", 7) == 0) {
+          TestAllTypes_Builder* subBuilder = [TestAllTypes builder];
+          if (self.builder_result.hasMessage) {
+            [subBuilder mergeFrom:self.builder_result.message];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setMessage:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (TestAllTypes*) message {
-  return result.message;
+- (TestLiteImportsNonlite_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 7:
+        if (memcmp(name, "message", 7) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        TestAllTypes_Builder* subBuilder = [TestAllTypes builder];
+        if (self.builder_result.hasMessage) {
+          [subBuilder mergeFrom:self.builder_result.message];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setMessage:[subBuilder buildPartial]];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestLiteImportsNonlite_Builder*) setMessage:(TestAllTypes*) value {
-  result.hasMessage = YES;
-  result.message = value;
+  builder_result.hasMessage = YES;
+  builder_result.message = value;
   return self;
 }
 - (TestLiteImportsNonlite_Builder*) setMessageBuilder:(TestAllTypes_Builder*) builderForValue {
   return [self setMessage:[builderForValue build]];
 }
 - (TestLiteImportsNonlite_Builder*) mergeMessage:(TestAllTypes*) value {
-  if (result.hasMessage &&
-      result.message != [TestAllTypes defaultInstance]) {
-    result.message =
-      [[[TestAllTypes builderWithPrototype:result.message] mergeFrom:value] buildPartial];
+  if (builder_result.hasMessage &&
+      builder_result.message != [TestAllTypes defaultInstance]) {
+    builder_result.message =
+      [[[TestAllTypes builderWithPrototype:builder_result.message] mergeFrom:value] buildPartial];
   } else {
-    result.message = value;
+    builder_result.message = value;
   }
-  result.hasMessage = YES;
+  builder_result.hasMessage = YES;
   return self;
 }
-- (TestLiteImportsNonlite_Builder*) clearMessage {
-  result.hasMessage = NO;
-  result.message = [TestAllTypes defaultInstance];
+- (TestAllTypes*) message {
+  return builder_result.message;
+}
+- (BOOL)hasMessage {
+ return builder_result.hasMessage;
+}
+- (TestLiteImportsNonlite_Builder*)clearMessage {
+  builder_result.hasMessage = NO;
+  builder_result.message = [TestAllTypes defaultInstance];
   return self;
 }
 @end
 
+#pragma clang diagnostic pop
@@ -2,11 +2,20 @@
 
 #import "UnittestMset.pb.h"
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wshadow-ivar"
+
 @implementation UnittestMsetRoot
 static id<PBExtensionField> TestMessageSetExtension1_messageSetExtension = nil;
 static id<PBExtensionField> TestMessageSetExtension2_messageSetExtension = nil;
-static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static PBExtensionRegistry* extensionRegistry = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestMsetRoot registerAllExtensions:registry];
+    extensionRegistry = registry;
+  });
   return extensionRegistry;
 }
 
@@ -20,7 +29,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
                                messageOrGroupClass:[TestMessageSetExtension1 class]
                                         isRepeated:NO
                                           isPacked:NO
-                            isMessageSetWireFormat:YES] ;
+                            isMessageSetWireFormat:YES];
     TestMessageSetExtension2_messageSetExtension =
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeMessage
                                      extendedClass:[TestMessageSet class]
@@ -30,9 +39,6 @@ static PBExtensionRegistry* extensionRegistry = nil;
                                         isRepeated:NO
                                           isPacked:NO
                             isMessageSetWireFormat:YES];
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    extensionRegistry = registry ;
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -46,23 +52,21 @@ static PBExtensionRegistry* extensionRegistry = nil;
 
 @implementation TestMessageSet
 
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static TestMessageSet* defaultTestMessageSetInstance = nil;
-+ (void) initialize {
-  if (self == [TestMessageSet class]) {
-    defaultTestMessageSetInstance = [[TestMessageSet alloc] init];
-  }
-}
 + (TestMessageSet*) defaultInstance {
+  static TestMessageSet* defaultTestMessageSetInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageSetInstance = [[TestMessageSet alloc] init];
+  });
   return defaultTestMessageSetInstance;
 }
 - (TestMessageSet*) defaultInstance {
-  return defaultTestMessageSetInstance;
+  return [TestMessageSet defaultInstance];
 }
 - (BOOL) isInitialized {
   if (!self.extensionsAreInitialized) {
@@ -73,41 +77,23 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
 - (void) writeToCodedOutputStream:(PBCodedOutputStream*) output {
   [self writeExtensionsToCodedOutputStream:output
                                       from:4
-                                        to:536870912];
+                                        to:2147483647];
   [self.unknownFields writeAsMessageSetTo:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSizeAsMessageSet;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestMessageSet*) parseFromData:(NSData*) data {
-  return (TestMessageSet*)[[[TestMessageSet builder] mergeFromData:data] build];
-}
-+ (TestMessageSet*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSet*)[[[TestMessageSet builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessageSet*) parseFromInputStream:(NSInputStream*) input {
-  return (TestMessageSet*)[[[TestMessageSet builder] mergeFromInputStream:input] build];
-}
-+ (TestMessageSet*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSet*)[[[TestMessageSet builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessageSet*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestMessageSet*)[[[TestMessageSet builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestMessageSet*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSet*)[[[TestMessageSet builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ = 0;
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSizeAsMessageSet;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestMessageSet_Builder*) builder {
-  return [[TestMessageSet_Builder alloc] init] ;
+  return [[TestMessageSet_Builder alloc] init];
 }
 + (TestMessageSet_Builder*) builderWithPrototype:(TestMessageSet*) prototype {
   return [[TestMessageSet builder] mergeFrom:prototype];
@@ -118,12 +104,11 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
 - (TestMessageSet_Builder*) toBuilder {
   return [TestMessageSet builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
-                                            from:4
-                                              to:536870912
-                                      withIndent:indent];
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  [self writeExtensionTextFormatTo:writer
+                              from:4
+                                to:2147483647];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -134,40 +119,34 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
   }
   TestMessageSet *otherMessage = other;
   return
-      [self isEqualExtensionsInOther:otherMessage from:4 to:536870912] &&
-      
+      [self isEqualExtensionsInOther:otherMessage from:4 to:2147483647] &&
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
-  hashCode = hashCode * 31 + [self hashExtensionsFrom:4 to:536870912];
+  hashCode = hashCode * 31 + [self hashExtensionsFrom:4 to:2147483647];
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+}
 @end
 
 @interface TestMessageSet_Builder()
-@property (strong) TestMessageSet* result;
+@property (strong) TestMessageSet* builder_result;
 @end
 
 @implementation TestMessageSet_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestMessageSet alloc] init];
+    self.builder_result = [[TestMessageSet alloc] init];
   }
   return self;
 }
 - (PBExtendableMessage*) internalGetResult {
-  return result;
-}
-- (TestMessageSet_Builder*) clear {
-  self.result = [[TestMessageSet alloc] init];
-  return self;
-}
-- (TestMessageSet_Builder*) clone {
-  return [TestMessageSet builderWithPrototype:result];
+  return builder_result;
 }
 - (TestMessageSet*) defaultInstance {
   return [TestMessageSet defaultInstance];
@@ -177,8 +156,8 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
   return [self buildPartial];
 }
 - (TestMessageSet*) buildPartial {
-  TestMessageSet* returnMe = result;
-  self.result = nil;
+  TestMessageSet* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestMessageSet_Builder*) mergeFrom:(TestMessageSet*) other {
@@ -189,9 +168,6 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -210,39 +186,50 @@ static TestMessageSet* defaultTestMessageSetInstance = nil;
     }
   }
 }
+- (TestMessageSet_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
+}
+- (TestMessageSet_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
+}
 @end
 
 @interface TestMessageSetContainer ()
-@property (strong) TestMessageSet* messageSet;
+@property (nonatomic, readwrite) BOOL hasMessageSet;
+@property (nonatomic, readwrite) TestMessageSet* messageSet;
 @end
 
 @implementation TestMessageSetContainer
 
-- (BOOL) hasMessageSet {
-  return !!hasMessageSet_;
-}
-- (void) setHasMessageSet:(BOOL) value {
-  hasMessageSet_ = !!value;
-}
-@synthesize messageSet;
-
 - (id) init {
   if ((self = [super init])) {
     self.messageSet = [TestMessageSet defaultInstance];
   }
   return self;
 }
-static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
-+ (void) initialize {
-  if (self == [TestMessageSetContainer class]) {
-    defaultTestMessageSetContainerInstance = [[TestMessageSetContainer alloc] init];
-  }
-}
 + (TestMessageSetContainer*) defaultInstance {
+  static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageSetContainerInstance = [[TestMessageSetContainer alloc] init];
+  });
   return defaultTestMessageSetContainerInstance;
 }
 - (TestMessageSetContainer*) defaultInstance {
-  return defaultTestMessageSetContainerInstance;
+  return [TestMessageSetContainer defaultInstance];
 }
 - (BOOL) isInitialized {
   if (self.hasMessageSet) {
@@ -259,39 +246,21 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasMessageSet) {
-    size += computeMessageSize(1, self.messageSet);
+    size_ += computeMessageSize(1, self.messageSet);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestMessageSetContainer*) parseFromData:(NSData*) data {
-  return (TestMessageSetContainer*)[[[TestMessageSetContainer builder] mergeFromData:data] build];
-}
-+ (TestMessageSetContainer*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSetContainer*)[[[TestMessageSetContainer builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessageSetContainer*) parseFromInputStream:(NSInputStream*) input {
-  return (TestMessageSetContainer*)[[[TestMessageSetContainer builder] mergeFromInputStream:input] build];
-}
-+ (TestMessageSetContainer*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSetContainer*)[[[TestMessageSetContainer builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessageSetContainer*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestMessageSetContainer*)[[[TestMessageSetContainer builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestMessageSetContainer*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSetContainer*)[[[TestMessageSetContainer builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestMessageSetContainer_Builder*) builder {
-  return [[TestMessageSetContainer_Builder alloc] init] ;
+  return [[TestMessageSetContainer_Builder alloc] init];
 }
 + (TestMessageSetContainer_Builder*) builderWithPrototype:(TestMessageSetContainer*) prototype {
   return [[TestMessageSetContainer builder] mergeFrom:prototype];
@@ -302,14 +271,11 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
 - (TestMessageSetContainer_Builder*) toBuilder {
   return [TestMessageSetContainer builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasMessageSet) {
-    [output appendFormat:@"%@%@ {\n", indent, @"messageSet"];
-    [self.messageSet writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "messageSet", self.messageSet);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -322,7 +288,6 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
   return
       self.hasMessageSet == otherMessage.hasMessageSet &&
       (!self.hasMessageSet || [self.messageSet isEqual:otherMessage.messageSet]) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
@@ -333,30 +298,27 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasMessageSet) {
+    PBJSONWriteMessage(writer, "messageSet", self.messageSet);
+  }
+}
 @end
 
 @interface TestMessageSetContainer_Builder()
-@property (strong) TestMessageSetContainer* result;
+@property (strong) TestMessageSetContainer* builder_result;
 @end
 
 @implementation TestMessageSetContainer_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestMessageSetContainer alloc] init] ;
+    self.builder_result = [[TestMessageSetContainer alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestMessageSetContainer_Builder*) clear {
-  self.result = [[TestMessageSetContainer alloc] init] ;
-  return self;
-}
-- (TestMessageSetContainer_Builder*) clone {
-  return [TestMessageSetContainer builderWithPrototype:result];
+  return builder_result;
 }
 - (TestMessageSetContainer*) defaultInstance {
   return [TestMessageSetContainer defaultInstance];
@@ -366,8 +328,8 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
   return [self buildPartial];
 }
 - (TestMessageSetContainer*) buildPartial {
-  TestMessageSetContainer* returnMe = result;
-  self.result = nil;
+  TestMessageSetContainer* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestMessageSetContainer_Builder*) mergeFrom:(TestMessageSetContainer*) other {
@@ -380,9 +342,6 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestMessageSetContainer_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestMessageSetContainer_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -400,8 +359,8 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
       }
       case 10: {
         TestMessageSet_Builder* subBuilder = [TestMessageSet builder];
-        if (self.hasMessageSet) {
-          [subBuilder mergeFrom:self.messageSet];
+        if (self.builder_result.hasMessageSet) {
+          [subBuilder mergeFrom:self.builder_result.messageSet];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setMessageSet:[subBuilder buildPartial]];
@@ -410,72 +369,120 @@ static TestMessageSetContainer* defaultTestMessageSetContainerInstance = nil;
     }
   }
 }
-- (BOOL) hasMessageSet {
-  return result.hasMessageSet;
+- (TestMessageSetContainer_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 11:
+        if (memcmp(name, "message_set", 11) == 0) {
+          TestMessageSet_Builder* subBuilder = [TestMessageSet builder];
+          if (self.builder_result.hasMessageSet) {
+            [subBuilder mergeFrom:self.builder_result.messageSet];
+          }
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self setMessageSet:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (TestMessageSet*) messageSet {
-  return result.messageSet;
+- (TestMessageSetContainer_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 10:
+        if (memcmp(name, "messageSet", 10) == 0) {
+          number = 1;
+        }
+        break;
+      case 11:
+        if (memcmp(name, "message_set", 11) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        TestMessageSet_Builder* subBuilder = [TestMessageSet builder];
+        if (self.builder_result.hasMessageSet) {
+          [subBuilder mergeFrom:self.builder_result.messageSet];
+        }
+        PBJSONReaderReadMessage(reader, subBuilder);
+        [self setMessageSet:[subBuilder buildPartial]];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestMessageSetContainer_Builder*) setMessageSet:(TestMessageSet*) value {
-  result.hasMessageSet = YES;
-  result.messageSet = value;
+  builder_result.hasMessageSet = YES;
+  builder_result.messageSet = value;
   return self;
 }
 - (TestMessageSetContainer_Builder*) setMessageSetBuilder:(TestMessageSet_Builder*) builderForValue {
   return [self setMessageSet:[builderForValue build]];
 }
 - (TestMessageSetContainer_Builder*) mergeMessageSet:(TestMessageSet*) value {
-  if (result.hasMessageSet &&
-      result.messageSet != [TestMessageSet defaultInstance]) {
-    result.messageSet =
-      [[[TestMessageSet builderWithPrototype:result.messageSet] mergeFrom:value] buildPartial];
+  if (builder_result.hasMessageSet &&
+      builder_result.messageSet != [TestMessageSet defaultInstance]) {
+    builder_result.messageSet =
+      [[[TestMessageSet builderWithPrototype:builder_result.messageSet] mergeFrom:value] buildPartial];
   } else {
-    result.messageSet = value;
+    builder_result.messageSet = value;
   }
-  result.hasMessageSet = YES;
+  builder_result.hasMessageSet = YES;
   return self;
 }
-- (TestMessageSetContainer_Builder*) clearMessageSet {
-  result.hasMessageSet = NO;
-  result.messageSet = [TestMessageSet defaultInstance];
+- (TestMessageSet*) messageSet {
+  return builder_result.messageSet;
+}
+- (BOOL)hasMessageSet {
+ return builder_result.hasMessageSet;
+}
+- (TestMessageSetContainer_Builder*)clearMessageSet {
+  builder_result.hasMessageSet = NO;
+  builder_result.messageSet = [TestMessageSet defaultInstance];
   return self;
 }
 @end
 
 @interface TestMessageSetExtension1 ()
-@property int32_t i;
+@property (nonatomic, readwrite) BOOL hasI;
+@property (nonatomic, readwrite) int32_t i;
 @end
 
 @implementation TestMessageSetExtension1
 
-- (BOOL) hasI {
-  return !!hasI_;
-}
-- (void) setHasI:(BOOL) value {
-  hasI_ = !!value;
-}
-@synthesize i;
-
 - (id) init {
   if ((self = [super init])) {
     self.i = 0;
   }
   return self;
 }
-+ (id<PBExtensionField>) messageSetExtension {
-  return TestMessageSetExtension1_messageSetExtension;
-}
-static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
-+ (void) initialize {
-  if (self == [TestMessageSetExtension1 class]) {
-    defaultTestMessageSetExtension1Instance = [[TestMessageSetExtension1 alloc] init];
-  }
-}
 + (TestMessageSetExtension1*) defaultInstance {
+  static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageSetExtension1Instance = [[TestMessageSetExtension1 alloc] init];
+  });
   return defaultTestMessageSetExtension1Instance;
 }
 - (TestMessageSetExtension1*) defaultInstance {
-  return defaultTestMessageSetExtension1Instance;
+  return [TestMessageSetExtension1 defaultInstance];
+}
++ (id<PBExtensionField>) messageSetExtension {
+  return TestMessageSetExtension1_messageSetExtension;
 }
 - (BOOL) isInitialized {
   return YES;
@@ -487,39 +494,21 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasI) {
-    size += computeInt32Size(15, self.i);
+    size_ += computeInt32Size(15, self.i);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestMessageSetExtension1*) parseFromData:(NSData*) data {
-  return (TestMessageSetExtension1*)[[[TestMessageSetExtension1 builder] mergeFromData:data] build];
-}
-+ (TestMessageSetExtension1*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSetExtension1*)[[[TestMessageSetExtension1 builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessageSetExtension1*) parseFromInputStream:(NSInputStream*) input {
-  return (TestMessageSetExtension1*)[[[TestMessageSetExtension1 builder] mergeFromInputStream:input] build];
-}
-+ (TestMessageSetExtension1*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSetExtension1*)[[[TestMessageSetExtension1 builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessageSetExtension1*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestMessageSetExtension1*)[[[TestMessageSetExtension1 builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestMessageSetExtension1*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSetExtension1*)[[[TestMessageSetExtension1 builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestMessageSetExtension1_Builder*) builder {
-  return [[TestMessageSetExtension1_Builder alloc] init] ;
+  return [[TestMessageSetExtension1_Builder alloc] init];
 }
 + (TestMessageSetExtension1_Builder*) builderWithPrototype:(TestMessageSetExtension1*) prototype {
   return [[TestMessageSetExtension1 builder] mergeFrom:prototype];
@@ -530,11 +519,11 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
 - (TestMessageSetExtension1_Builder*) toBuilder {
   return [TestMessageSetExtension1 builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasI) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"i", [NSNumber numberWithInt:self.i]];
+    PBTextFormatWriteInt32(writer, "i", self.i);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -547,41 +536,37 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
   return
       self.hasI == otherMessage.hasI &&
       (!self.hasI || self.i == otherMessage.i) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasI) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.i] hash];
+    hashCode = hashCode * 31 + [@(self.i) hash];
   }
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasI) {
+    PBJSONWriteInt32(writer, "i", self.i);
+  }
+}
 @end
 
 @interface TestMessageSetExtension1_Builder()
-@property (strong) TestMessageSetExtension1* result;
+@property (strong) TestMessageSetExtension1* builder_result;
 @end
 
 @implementation TestMessageSetExtension1_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestMessageSetExtension1 alloc] init] ;
+    self.builder_result = [[TestMessageSetExtension1 alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestMessageSetExtension1_Builder*) clear {
-  self.result = [[TestMessageSetExtension1 alloc] init] ;
-  return self;
-}
-- (TestMessageSetExtension1_Builder*) clone {
-  return [TestMessageSetExtension1 builderWithPrototype:result];
+  return builder_result;
 }
 - (TestMessageSetExtension1*) defaultInstance {
   return [TestMessageSetExtension1 defaultInstance];
@@ -591,8 +576,8 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
   return [self buildPartial];
 }
 - (TestMessageSetExtension1*) buildPartial {
-  TestMessageSetExtension1* returnMe = result;
-  self.result = nil;
+  TestMessageSetExtension1* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestMessageSetExtension1_Builder*) mergeFrom:(TestMessageSetExtension1*) other {
@@ -605,9 +590,6 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestMessageSetExtension1_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestMessageSetExtension1_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -630,58 +612,91 @@ static TestMessageSetExtension1* defaultTestMessageSetExtension1Instance = nil;
     }
   }
 }
-- (BOOL) hasI {
-  return result.hasI;
+- (TestMessageSetExtension1_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 1:
+        if (memcmp(name, "i", 1) == 0) {
+          [self setI:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) i {
-  return result.i;
+- (TestMessageSetExtension1_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 1:
+        if (memcmp(name, "i", 1) == 0) {
+          number = 15;
+        }
+        break;
+    }
+    switch (number) {
+      case 15: {
+        [self setI:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestMessageSetExtension1_Builder*) setI:(int32_t) value {
-  result.hasI = YES;
-  result.i = value;
+  builder_result.hasI = YES;
+  builder_result.i = value;
   return self;
 }
-- (TestMessageSetExtension1_Builder*) clearI {
-  result.hasI = NO;
-  result.i = 0;
+- (int32_t) i {
+  return builder_result.i;
+}
+- (BOOL)hasI {
+ return builder_result.hasI;
+}
+- (TestMessageSetExtension1_Builder*)clearI {
+  builder_result.hasI = NO;
+  builder_result.i = 0;
   return self;
 }
 @end
 
 @interface TestMessageSetExtension2 ()
-@property (strong) NSString* str;
+@property (nonatomic, readwrite) BOOL hasStr;
+@property (nonatomic, readwrite) NSString* str;
 @end
 
 @implementation TestMessageSetExtension2
 
-- (BOOL) hasStr {
-  return !!hasStr_;
-}
-- (void) setHasStr:(BOOL) value {
-  hasStr_ = !!value;
-}
-@synthesize str;
-
 - (id) init {
   if ((self = [super init])) {
     self.str = @"";
   }
   return self;
 }
-+ (id<PBExtensionField>) messageSetExtension {
-  return TestMessageSetExtension2_messageSetExtension;
-}
-static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
-+ (void) initialize {
-  if (self == [TestMessageSetExtension2 class]) {
-    defaultTestMessageSetExtension2Instance = [[TestMessageSetExtension2 alloc] init];
-  }
-}
 + (TestMessageSetExtension2*) defaultInstance {
+  static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageSetExtension2Instance = [[TestMessageSetExtension2 alloc] init];
+  });
   return defaultTestMessageSetExtension2Instance;
 }
 - (TestMessageSetExtension2*) defaultInstance {
-  return defaultTestMessageSetExtension2Instance;
+  return [TestMessageSetExtension2 defaultInstance];
+}
++ (id<PBExtensionField>) messageSetExtension {
+  return TestMessageSetExtension2_messageSetExtension;
 }
 - (BOOL) isInitialized {
   return YES;
@@ -693,39 +708,21 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasStr) {
-    size += computeStringSize(25, self.str);
+    size_ += computeStringSize(25, self.str);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestMessageSetExtension2*) parseFromData:(NSData*) data {
-  return (TestMessageSetExtension2*)[[[TestMessageSetExtension2 builder] mergeFromData:data] build];
-}
-+ (TestMessageSetExtension2*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSetExtension2*)[[[TestMessageSetExtension2 builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessageSetExtension2*) parseFromInputStream:(NSInputStream*) input {
-  return (TestMessageSetExtension2*)[[[TestMessageSetExtension2 builder] mergeFromInputStream:input] build];
-}
-+ (TestMessageSetExtension2*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSetExtension2*)[[[TestMessageSetExtension2 builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessageSetExtension2*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestMessageSetExtension2*)[[[TestMessageSetExtension2 builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestMessageSetExtension2*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessageSetExtension2*)[[[TestMessageSetExtension2 builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestMessageSetExtension2_Builder*) builder {
-  return [[TestMessageSetExtension2_Builder alloc] init] ;
+  return [[TestMessageSetExtension2_Builder alloc] init];
 }
 + (TestMessageSetExtension2_Builder*) builderWithPrototype:(TestMessageSetExtension2*) prototype {
   return [[TestMessageSetExtension2 builder] mergeFrom:prototype];
@@ -736,11 +733,11 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
 - (TestMessageSetExtension2_Builder*) toBuilder {
   return [TestMessageSetExtension2 builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasStr) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"str", self.str];
+    PBTextFormatWriteObject(writer, "str", self.str);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -753,7 +750,6 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
   return
       self.hasStr == otherMessage.hasStr &&
       (!self.hasStr || [self.str isEqual:otherMessage.str]) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
@@ -764,30 +760,27 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasStr) {
+    PBJSONWriteString(writer, "str", self.str);
+  }
+}
 @end
 
 @interface TestMessageSetExtension2_Builder()
-@property (strong) TestMessageSetExtension2* result;
+@property (strong) TestMessageSetExtension2* builder_result;
 @end
 
 @implementation TestMessageSetExtension2_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestMessageSetExtension2 alloc] init] ;
+    self.builder_result = [[TestMessageSetExtension2 alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestMessageSetExtension2_Builder*) clear {
-  self.result = [[TestMessageSetExtension2 alloc] init] ;
-  return self;
-}
-- (TestMessageSetExtension2_Builder*) clone {
-  return [TestMessageSetExtension2 builderWithPrototype:result];
+  return builder_result;
 }
 - (TestMessageSetExtension2*) defaultInstance {
   return [TestMessageSetExtension2 defaultInstance];
@@ -797,8 +790,8 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
   return [self buildPartial];
 }
 - (TestMessageSetExtension2*) buildPartial {
-  TestMessageSetExtension2* returnMe = result;
-  self.result = nil;
+  TestMessageSetExtension2* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestMessageSetExtension2_Builder*) mergeFrom:(TestMessageSetExtension2*) other {
@@ -811,9 +804,6 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestMessageSetExtension2_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestMessageSetExtension2_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -836,55 +826,92 @@ static TestMessageSetExtension2* defaultTestMessageSetExtension2Instance = nil;
     }
   }
 }
-- (BOOL) hasStr {
-  return result.hasStr;
+- (TestMessageSetExtension2_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 3:
+        if (memcmp(name, "str", 3) == 0) {
+          [self setStr:PBTextFormatReaderReadString(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (NSString*) str {
-  return result.str;
+- (TestMessageSetExtension2_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 3:
+        if (memcmp(name, "str", 3) == 0) {
+          number = 25;
+        }
+        break;
+    }
+    switch (number) {
+      case 25: {
+        [self setStr:PBJSONReaderReadString(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestMessageSetExtension2_Builder*) setStr:(NSString*) value {
-  result.hasStr = YES;
-  result.str = value;
+  builder_result.hasStr = YES;
+  builder_result.str = value;
   return self;
 }
-- (TestMessageSetExtension2_Builder*) clearStr {
-  result.hasStr = NO;
-  result.str = @"";
+- (NSString*) str {
+  return builder_result.str;
+}
+- (BOOL)hasStr {
+ return builder_result.hasStr;
+}
+- (TestMessageSetExtension2_Builder*)clearStr {
+  builder_result.hasStr = NO;
+  builder_result.str = @"";
   return self;
 }
 @end
 
 @interface RawMessageSet ()
-@property (strong) NSMutableArray * itemArray;
+@property (nonatomic, readwrite) NSMutableArray * itemArray;
 @end
 
 @implementation RawMessageSet
 
-@synthesize itemArray;
-@dynamic item;
-
 - (id) init {
   if ((self = [super init])) {
   }
   return self;
 }
-static RawMessageSet* defaultRawMessageSetInstance = nil;
-+ (void) initialize {
-  if (self == [RawMessageSet class]) {
-    defaultRawMessageSetInstance = [[RawMessageSet alloc] init];
-  }
-}
 + (RawMessageSet*) defaultInstance {
+  static RawMessageSet* defaultRawMessageSetInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultRawMessageSetInstance = [[RawMessageSet alloc] init];
+  });
   return defaultRawMessageSetInstance;
 }
 - (RawMessageSet*) defaultInstance {
-  return defaultRawMessageSetInstance;
+  return [RawMessageSet defaultInstance];
 }
 - (NSArray *)item {
-  return itemArray;
+  return self.itemArray;
 }
 - (RawMessageSet_Item*)itemAtIndex:(NSUInteger)index {
-  return [itemArray objectAtIndex:index];
+  return self.itemArray[index];
 }
 - (BOOL) isInitialized {
   for (RawMessageSet_Item* element in self.item) {
@@ -901,39 +928,21 @@ static RawMessageSet* defaultRawMessageSetInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   for (RawMessageSet_Item *element in self.itemArray) {
-    size += computeGroupSize(1, element);
+    size_ += computeGroupSize(1, element);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (RawMessageSet*) parseFromData:(NSData*) data {
-  return (RawMessageSet*)[[[RawMessageSet builder] mergeFromData:data] build];
-}
-+ (RawMessageSet*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (RawMessageSet*)[[[RawMessageSet builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (RawMessageSet*) parseFromInputStream:(NSInputStream*) input {
-  return (RawMessageSet*)[[[RawMessageSet builder] mergeFromInputStream:input] build];
-}
-+ (RawMessageSet*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (RawMessageSet*)[[[RawMessageSet builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (RawMessageSet*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (RawMessageSet*)[[[RawMessageSet builder] mergeFromCodedInputStream:input] build];
-}
-+ (RawMessageSet*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (RawMessageSet*)[[[RawMessageSet builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (RawMessageSet_Builder*) builder {
-  return [[RawMessageSet_Builder alloc] init] ;
+  return [[RawMessageSet_Builder alloc] init];
 }
 + (RawMessageSet_Builder*) builderWithPrototype:(RawMessageSet*) prototype {
   return [[RawMessageSet builder] mergeFrom:prototype];
@@ -944,14 +953,11 @@ static RawMessageSet* defaultRawMessageSetInstance = nil;
 - (RawMessageSet_Builder*) toBuilder {
   return [RawMessageSet builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   for (RawMessageSet_Item* element in self.itemArray) {
-    [output appendFormat:@"%@%@ {\n", indent, @"item"];
-    [element writeDescriptionTo:output
-                     withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
+    PBTextFormatWriteMessage(writer, "item", element);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -962,8 +968,7 @@ static RawMessageSet* defaultRawMessageSetInstance = nil;
   }
   RawMessageSet *otherMessage = other;
   return
-      [self.itemArray isEqualToArray:otherMessage.itemArray] &&
-      
+      (self.itemArray == otherMessage.itemArray || [self.itemArray isEqualToArray:otherMessage.itemArray]) &&
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
@@ -974,30 +979,26 @@ static RawMessageSet* defaultRawMessageSetInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.itemArray.count > 0) {
+    PBJSONWriterBeginArray(writer, "item");
+    for (RawMessageSet_Item* element in self.itemArray) {
+      PBJSONWriteMessage(writer, NULL, element);
+    }
+    PBJSONWriterEndArray(writer);
+  }
+}
 @end
 
 @interface RawMessageSet_Item ()
-@property int32_t typeId;
-@property (strong) NSData* message;
+@property (nonatomic, readwrite) BOOL hasTypeId;
+@property (nonatomic, readwrite) int32_t typeId;
+@property (nonatomic, readwrite) BOOL hasMessage;
+@property (nonatomic, readwrite) NSData* message;
 @end
 
 @implementation RawMessageSet_Item
 
-- (BOOL) hasTypeId {
-  return !!hasTypeId_;
-}
-- (void) setHasTypeId:(BOOL) value {
-  hasTypeId_ = !!value;
-}
-@synthesize typeId;
-- (BOOL) hasMessage {
-  return !!hasMessage_;
-}
-- (void) setHasMessage:(BOOL) value {
-  hasMessage_ = !!value;
-}
-@synthesize message;
-
 - (id) init {
   if ((self = [super init])) {
     self.typeId = 0;
@@ -1005,17 +1006,16 @@ static RawMessageSet* defaultRawMessageSetInstance = nil;
   }
   return self;
 }
-static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
-+ (void) initialize {
-  if (self == [RawMessageSet_Item class]) {
-    defaultRawMessageSet_ItemInstance = [[RawMessageSet_Item alloc] init];
-  }
-}
 + (RawMessageSet_Item*) defaultInstance {
+  static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultRawMessageSet_ItemInstance = [[RawMessageSet_Item alloc] init];
+  });
   return defaultRawMessageSet_ItemInstance;
 }
 - (RawMessageSet_Item*) defaultInstance {
-  return defaultRawMessageSet_ItemInstance;
+  return [RawMessageSet_Item defaultInstance];
 }
 - (BOOL) isInitialized {
   if (!self.hasTypeId) {
@@ -1036,42 +1036,24 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasTypeId) {
-    size += computeInt32Size(2, self.typeId);
+    size_ += computeInt32Size(2, self.typeId);
   }
   if (self.hasMessage) {
-    size += computeDataSize(3, self.message);
+    size_ += computeDataSize(3, self.message);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (RawMessageSet_Item*) parseFromData:(NSData*) data {
-  return (RawMessageSet_Item*)[[[RawMessageSet_Item builder] mergeFromData:data] build];
-}
-+ (RawMessageSet_Item*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (RawMessageSet_Item*)[[[RawMessageSet_Item builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (RawMessageSet_Item*) parseFromInputStream:(NSInputStream*) input {
-  return (RawMessageSet_Item*)[[[RawMessageSet_Item builder] mergeFromInputStream:input] build];
-}
-+ (RawMessageSet_Item*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (RawMessageSet_Item*)[[[RawMessageSet_Item builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (RawMessageSet_Item*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (RawMessageSet_Item*)[[[RawMessageSet_Item builder] mergeFromCodedInputStream:input] build];
-}
-+ (RawMessageSet_Item*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (RawMessageSet_Item*)[[[RawMessageSet_Item builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (RawMessageSet_Item_Builder*) builder {
-  return [[RawMessageSet_Item_Builder alloc] init] ;
+  return [[RawMessageSet_Item_Builder alloc] init];
 }
 + (RawMessageSet_Item_Builder*) builderWithPrototype:(RawMessageSet_Item*) prototype {
   return [[RawMessageSet_Item builder] mergeFrom:prototype];
@@ -1082,14 +1064,14 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
 - (RawMessageSet_Item_Builder*) toBuilder {
   return [RawMessageSet_Item builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasTypeId) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"typeId", [NSNumber numberWithInt:self.typeId]];
+    PBTextFormatWriteInt32(writer, "typeId", self.typeId);
   }
   if (self.hasMessage) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"message", self.message];
+    PBTextFormatWriteObject(writer, "message", self.message);
   }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -1102,16 +1084,14 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
   return
       self.hasTypeId == otherMessage.hasTypeId &&
       (!self.hasTypeId || self.typeId == otherMessage.typeId) &&
-      
       self.hasMessage == otherMessage.hasMessage &&
       (!self.hasMessage || [self.message isEqual:otherMessage.message]) &&
-      
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasTypeId) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.typeId] hash];
+    hashCode = hashCode * 31 + [@(self.typeId) hash];
   }
   if (self.hasMessage) {
     hashCode = hashCode * 31 + [self.message hash];
@@ -1119,30 +1099,30 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasTypeId) {
+    PBJSONWriteInt32(writer, "typeId", self.typeId);
+  }
+  if (self.hasMessage) {
+    PBJSONWriteData(writer, "message", self.message);
+  }
+}
 @end
 
 @interface RawMessageSet_Item_Builder()
-@property (strong) RawMessageSet_Item* result;
+@property (strong) RawMessageSet_Item* builder_result;
 @end
 
 @implementation RawMessageSet_Item_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[RawMessageSet_Item alloc] init] ;
+    self.builder_result = [[RawMessageSet_Item alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (RawMessageSet_Item_Builder*) clear {
-  self.result = [[RawMessageSet_Item alloc] init] ;
-  return self;
-}
-- (RawMessageSet_Item_Builder*) clone {
-  return [RawMessageSet_Item builderWithPrototype:result];
+  return builder_result;
 }
 - (RawMessageSet_Item*) defaultInstance {
   return [RawMessageSet_Item defaultInstance];
@@ -1152,8 +1132,8 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
   return [self buildPartial];
 }
 - (RawMessageSet_Item*) buildPartial {
-  RawMessageSet_Item* returnMe = result;
-  self.result = nil;
+  RawMessageSet_Item* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (RawMessageSet_Item_Builder*) mergeFrom:(RawMessageSet_Item*) other {
@@ -1169,9 +1149,6 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (RawMessageSet_Item_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (RawMessageSet_Item_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -1198,62 +1175,110 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
     }
   }
 }
-- (BOOL) hasTypeId {
-  return result.hasTypeId;
+- (RawMessageSet_Item_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 7:
+        if (memcmp(name, "type_id", 7) == 0) {
+          [self setTypeId:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        if (memcmp(name, "message", 7) == 0) {
+          [self setMessage:PBTextFormatReaderReadData(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) typeId {
-  return result.typeId;
+- (RawMessageSet_Item_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 6:
+        if (memcmp(name, "typeId", 6) == 0) {
+          number = 2;
+        }
+        break;
+      case 7:
+        if (memcmp(name, "type_id", 7) == 0) {
+          number = 2;
+        } else if (memcmp(name, "message", 7) == 0) {
+          number = 3;
+        }
+        break;
+    }
+    switch (number) {
+      case 2: {
+        [self setTypeId:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+      case 3: {
+        [self setMessage:PBJSONReaderReadData(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (RawMessageSet_Item_Builder*) setTypeId:(int32_t) value {
-  result.hasTypeId = YES;
-  result.typeId = value;
+  builder_result.hasTypeId = YES;
+  builder_result.typeId = value;
   return self;
 }
-- (RawMessageSet_Item_Builder*) clearTypeId {
-  result.hasTypeId = NO;
-  result.typeId = 0;
-  return self;
+- (int32_t) typeId {
+  return builder_result.typeId;
 }
-- (BOOL) hasMessage {
-  return result.hasMessage;
+- (BOOL)hasTypeId {
+ return builder_result.hasTypeId;
 }
-- (NSData*) message {
-  return result.message;
+- (RawMessageSet_Item_Builder*)clearTypeId {
+  builder_result.hasTypeId = NO;
+  builder_result.typeId = 0;
+  return self;
 }
 - (RawMessageSet_Item_Builder*) setMessage:(NSData*) value {
-  result.hasMessage = YES;
-  result.message = value;
+  builder_result.hasMessage = YES;
+  builder_result.message = value;
   return self;
 }
-- (RawMessageSet_Item_Builder*) clearMessage {
-  result.hasMessage = NO;
-  result.message = [NSData data];
+- (NSData*) message {
+  return builder_result.message;
+}
+- (BOOL)hasMessage {
+ return builder_result.hasMessage;
+}
+- (RawMessageSet_Item_Builder*)clearMessage {
+  builder_result.hasMessage = NO;
+  builder_result.message = [NSData data];
   return self;
 }
 @end
 
 @interface RawMessageSet_Builder()
-@property (strong) RawMessageSet* result;
+@property (strong) RawMessageSet* builder_result;
 @end
 
 @implementation RawMessageSet_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[RawMessageSet alloc] init] ;
+    self.builder_result = [[RawMessageSet alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (RawMessageSet_Builder*) clear {
-  self.result = [[RawMessageSet alloc] init] ;
-  return self;
-}
-- (RawMessageSet_Builder*) clone {
-  return [RawMessageSet builderWithPrototype:result];
+  return builder_result;
 }
 - (RawMessageSet*) defaultInstance {
   return [RawMessageSet defaultInstance];
@@ -1263,8 +1288,8 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
   return [self buildPartial];
 }
 - (RawMessageSet*) buildPartial {
-  RawMessageSet* returnMe = result;
-  self.result = nil;
+  RawMessageSet* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (RawMessageSet_Builder*) mergeFrom:(RawMessageSet*) other {
@@ -1272,18 +1297,11 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
     return self;
   }
   if (other.itemArray.count > 0) {
-    if (result.itemArray == nil) {
-      result.itemArray = [other.itemArray copy] ;
-    } else {
-      [result.itemArray addObjectsFromArray:other.itemArray];
-    }
+    builder_result.itemArray = [[NSMutableArray alloc] initWithArray:other.itemArray];
   }
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (RawMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (RawMessageSet_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -1308,27 +1326,75 @@ static RawMessageSet_Item* defaultRawMessageSet_ItemInstance = nil;
     }
   }
 }
-- (NSMutableArray *)item {
-  return result.itemArray;
+- (RawMessageSet_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 4:
+        if (memcmp(name, "Item", 4) == 0) {
+          RawMessageSet_Item_Builder* subBuilder = [RawMessageSet_Item builder];
+          PBTextFormatReaderReadMessage(reader, subBuilder);
+          [self addItem:[subBuilder buildPartial]];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (RawMessageSet_Item*)itemAtIndex:(NSUInteger)index {
-  return [result itemAtIndex:index];
+- (RawMessageSet_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 4:
+        if (memcmp(name, "item", 4) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        PBJSONReaderBeginArray(reader);
+        while (PBJSONReaderHasNextElement(reader)) {
+          RawMessageSet_Item_Builder* subBuilder = [RawMessageSet_Item builder];
+          PBJSONReaderReadMessage(reader, subBuilder);
+          [self addItem:[subBuilder buildPartial]];
+        }
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (RawMessageSet_Builder *)addItem:(RawMessageSet_Item*)value {
-  if (result.itemArray == nil) {
-    result.itemArray = [[NSMutableArray alloc]initWithCapacity:1];
+  if (builder_result.itemArray == nil) {
+    builder_result.itemArray = [[NSMutableArray alloc]init];
   }
-  [result.itemArray addObject:value];
+  [builder_result.itemArray addObject:value];
   return self;
 }
 - (RawMessageSet_Builder *)setItemArray:(NSArray *)array {
-    result.itemArray = [[NSMutableArray alloc]initWithArray:array];
+  builder_result.itemArray = [[NSMutableArray alloc]initWithArray:array];
   return self;
 }
-
++ (Class)expectedElementTypeForItemArray {
+  return [RawMessageSet_Item class];
+}
+- (NSMutableArray *)item {
+  return builder_result.itemArray;
+}
 - (RawMessageSet_Builder *)clearItem {
-  result.itemArray = nil;
+  builder_result.itemArray = nil;
   return self;
 }
 @end
 
+#pragma clang diagnostic pop
@@ -16,11 +16,14 @@
   #endif
 #endif
 
-typedef enum {
+typedef NS_CLOSED_ENUM(int32_t, TestEnum) {
   TestEnumFoo = 1,
-} TestEnum;
+};
 
 BOOL TestEnumIsValidValue(TestEnum value);
+TestEnum TestEnumReadTextFormat(PBTextFormatReader* reader);
+void TestEnumWriteJSON(PBJSONWriter* writer, const char* name, TestEnum value);
+TestEnum TestEnumReadJSON(PBJSONReader* reader);
 
 
 @interface UnittestNoGenericServicesRoot : NSObject {
@@ -30,52 +33,31 @@ BOOL TestEnumIsValidValue(TestEnum value);
 + (id<PBExtensionField>) testExtension;
 @end
 
-@interface TestMessage : PBExtendableMessage {
-@private
-  BOOL hasA_:1;
-  int32_t a;
-}
-- (BOOL) hasA;
-@property (readonly) int32_t a;
+@interface TestMessage : PBExtendableMessage
+- (BOOL)hasA;
+@property (nonatomic, readonly) int32_t a;
 
 + (TestMessage*) defaultInstance;
 - (TestMessage*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestMessage_Builder*) builder;
 + (TestMessage_Builder*) builder;
 + (TestMessage_Builder*) builderWithPrototype:(TestMessage*) prototype;
 - (TestMessage_Builder*) toBuilder;
-
-+ (TestMessage*) parseFromData:(NSData*) data;
-+ (TestMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestMessage*) parseFromInputStream:(NSInputStream*) input;
-+ (TestMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestMessage_Builder : PBExtendableMessage_Builder {
-@private
-  TestMessage* result;
-}
+@interface TestMessage_Builder : PBExtendableMessage_Builder
 
 - (TestMessage*) defaultInstance;
 
-- (TestMessage_Builder*) clear;
-- (TestMessage_Builder*) clone;
-
 - (TestMessage*) build;
 - (TestMessage*) buildPartial;
 
 - (TestMessage_Builder*) mergeFrom:(TestMessage*) other;
-- (TestMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasA;
 - (int32_t) a;
+- (BOOL)hasA;
+- (TestMessage_Builder*)clearA;
 - (TestMessage_Builder*) setA:(int32_t) value;
-- (TestMessage_Builder*) clearA;
 @end
 
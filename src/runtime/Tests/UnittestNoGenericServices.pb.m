@@ -2,10 +2,19 @@
 
 #import "UnittestNoGenericServices.pb.h"
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wshadow-ivar"
+
 @implementation UnittestNoGenericServicesRoot
 static id<PBExtensionField> UnittestNoGenericServicesRoot_testExtension = nil;
-static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static PBExtensionRegistry* extensionRegistry = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestNoGenericServicesRoot registerAllExtensions:registry];
+    extensionRegistry = registry;
+  });
   return extensionRegistry;
 }
 
@@ -15,14 +24,11 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt32
                                      extendedClass:[TestMessage class]
                                        fieldNumber:1000
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
-                            isMessageSetWireFormat:NO] ;
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    extensionRegistry = registry;
+                            isMessageSetWireFormat:NO];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -34,44 +40,46 @@ static PBExtensionRegistry* extensionRegistry = nil;
 @end
 
 BOOL TestEnumIsValidValue(TestEnum value) {
-  switch (value) {
-    case TestEnumFoo:
-      return YES;
-    default:
-      return NO;
-  }
+  return (uint32_t)value - 1U < 1U;
+}
+static const char* const TestEnumTextFormatNames[] = {
+  "FOO",
+};
+static const int32_t TestEnumTextFormatValues[] = {
+  1,
+};
+TestEnum TestEnumReadTextFormat(PBTextFormatReader* reader) {
+  return (TestEnum)PBTextFormatReaderReadEnum(reader, TestEnumTextFormatNames, TestEnumTextFormatValues, 1);
+}
+void TestEnumWriteJSON(PBJSONWriter* writer, const char* name, TestEnum value) {
+  PBJSONWriteEnum(writer, name, value, TestEnumTextFormatNames, TestEnumTextFormatValues, 1);
+}
+TestEnum TestEnumReadJSON(PBJSONReader* reader) {
+  return (TestEnum)PBJSONReaderReadEnum(reader, TestEnumTextFormatNames, TestEnumTextFormatValues, 1);
 }
 @interface TestMessage ()
-@property int32_t a;
+@property (nonatomic, readwrite) BOOL hasA;
+@property (nonatomic, readwrite) int32_t a;
 @end
 
 @implementation TestMessage
 
-- (BOOL) hasA {
-  return !!hasA_;
-}
-- (void) setHasA:(BOOL) value {
-  hasA_ = !!value;
-}
-@synthesize a;
-
 - (id) init {
   if ((self = [super init])) {
     self.a = 0;
   }
   return self;
 }
-static TestMessage* defaultTestMessageInstance = nil;
-+ (void) initialize {
-  if (self == [TestMessage class]) {
-    defaultTestMessageInstance = [[TestMessage alloc] init];
-  }
-}
 + (TestMessage*) defaultInstance {
+  static TestMessage* defaultTestMessageInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestMessageInstance = [[TestMessage alloc] init];
+  });
   return defaultTestMessageInstance;
 }
 - (TestMessage*) defaultInstance {
-  return defaultTestMessageInstance;
+  return [TestMessage defaultInstance];
 }
 - (BOOL) isInitialized {
   if (!self.extensionsAreInitialized) {
@@ -89,40 +97,22 @@ static TestMessage* defaultTestMessageInstance = nil;
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasA) {
-    size += computeInt32Size(1, self.a);
+    size_ += computeInt32Size(1, self.a);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestMessage*) parseFromData:(NSData*) data {
-  return (TestMessage*)[[[TestMessage builder] mergeFromData:data] build];
-}
-+ (TestMessage*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessage*)[[[TestMessage builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessage*) parseFromInputStream:(NSInputStream*) input {
-  return (TestMessage*)[[[TestMessage builder] mergeFromInputStream:input] build];
-}
-+ (TestMessage*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessage*)[[[TestMessage builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestMessage*)[[[TestMessage builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestMessage*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestMessage*)[[[TestMessage builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestMessage_Builder*) builder {
-  return [[TestMessage_Builder alloc] init] ;
+  return [[TestMessage_Builder alloc] init];
 }
 + (TestMessage_Builder*) builderWithPrototype:(TestMessage*) prototype {
   return [[TestMessage builder] mergeFrom:prototype];
@@ -133,15 +123,14 @@ static TestMessage* defaultTestMessageInstance = nil;
 - (TestMessage_Builder*) toBuilder {
   return [TestMessage builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
   if (self.hasA) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"a", [NSNumber numberWithInt:self.a]];
+    PBTextFormatWriteInt32(writer, "a", self.a);
   }
-  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
-                                            from:1000
-                                              to:536870912
-                                      withIndent:indent];
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+  [self writeExtensionTextFormatTo:writer
+                              from:1000
+                                to:536870912];
+  [self.unknownFields writeTextFormatTo:writer];
 }
 - (BOOL) isEqual:(id)other {
   if (other == self) {
@@ -154,44 +143,40 @@ static TestMessage* defaultTestMessageInstance = nil;
   return
       self.hasA == otherMessage.hasA &&
       (!self.hasA || self.a == otherMessage.a) &&
-      
       [self isEqualExtensionsInOther:otherMessage from:1000 to:536870912] &&
-      
+
       (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
 }
 - (NSUInteger) hash {
   NSUInteger hashCode = 7;
   if (self.hasA) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.a] hash];
+    hashCode = hashCode * 31 + [@(self.a) hash];
   }
   hashCode = hashCode * 31 + [self hashExtensionsFrom:1000 to:536870912];
   hashCode = hashCode * 31 + [self.unknownFields hash];
   return hashCode;
 }
+- (void) writeJSONTo:(PBJSONWriter*) writer {
+  if (self.hasA) {
+    PBJSONWriteInt32(writer, "a", self.a);
+  }
+}
 @end
 
 @interface TestMessage_Builder()
-@property (strong) TestMessage* result;
+@property (strong) TestMessage* builder_result;
 @end
 
 @implementation TestMessage_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestMessage alloc] init] ;
+    self.builder_result = [[TestMessage alloc] init];
   }
   return self;
 }
 - (PBExtendableMessage*) internalGetResult {
-  return result;
-}
-- (TestMessage_Builder*) clear {
-  self.result = [[TestMessage alloc] init] ;
-  return self;
-}
-- (TestMessage_Builder*) clone {
-  return [TestMessage builderWithPrototype:result];
+  return builder_result;
 }
 - (TestMessage*) defaultInstance {
   return [TestMessage defaultInstance];
@@ -201,8 +186,8 @@ static TestMessage* defaultTestMessageInstance = nil;
   return [self buildPartial];
 }
 - (TestMessage*) buildPartial {
-  TestMessage* returnMe = result;
-  self.result = nil;
+  TestMessage* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestMessage_Builder*) mergeFrom:(TestMessage*) other {
@@ -216,9 +201,6 @@ static TestMessage* defaultTestMessageInstance = nil;
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestMessage_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -241,21 +223,63 @@ static TestMessage* defaultTestMessageInstance = nil;
     }
   }
 }
-- (BOOL) hasA {
-  return result.hasA;
+- (TestMessage_Builder*) mergeFromTextFormatReader:(PBTextFormatReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBTextFormatReaderReadFieldName(reader, &name, &length)) {
+    switch (length) {
+      case 1:
+        if (memcmp(name, "a", 1) == 0) {
+          [self setA:PBTextFormatReaderReadInt32(reader)];
+          continue;
+        }
+        break;
+    }
+    PBTextFormatReaderUnknownField(reader, name, length);
+  }
+  return self;
 }
-- (int32_t) a {
-  return result.a;
+- (TestMessage_Builder*) mergeFromJSONReader:(PBJSONReader*) reader {
+  const char* name;
+  NSUInteger length;
+  while (PBJSONReaderReadMemberName(reader, &name, &length)) {
+    if (PBJSONReaderReadNull(reader)) {
+      continue;
+    }
+    int32_t number = 0;
+    switch (length) {
+      case 1:
+        if (memcmp(name, "a", 1) == 0) {
+          number = 1;
+        }
+        break;
+    }
+    switch (number) {
+      case 1: {
+        [self setA:PBJSONReaderReadInt32(reader)];
+        continue;
+      }
+    }
+    PBJSONReaderUnknownMember(reader, name, length);
+  }
+  return self;
 }
 - (TestMessage_Builder*) setA:(int32_t) value {
-  result.hasA = YES;
-  result.a = value;
+  builder_result.hasA = YES;
+  builder_result.a = value;
   return self;
 }
-- (TestMessage_Builder*) clearA {
-  result.hasA = NO;
-  result.a = 0;
+- (int32_t) a {
+  return builder_result.a;
+}
+- (BOOL)hasA {
+ return builder_result.hasA;
+}
+- (TestMessage_Builder*)clearA {
+  builder_result.hasA = NO;
+  builder_result.a = 0;
   return self;
 }
 @end
 
+#pragma clang diagnostic pop
@@ -113,165 +113,113 @@
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry;
 @end
 
-@interface TestOptimizedForSize : PBExtendableMessage {
-@private
-  BOOL hasI_:1;
-  BOOL hasMsg_:1;
-  int32_t i;
-  ForeignMessage* msg;
-}
-- (BOOL) hasI;
-- (BOOL) hasMsg;
-@property (readonly) int32_t i;
-@property (readonly, strong) ForeignMessage* msg;
+@interface TestOptimizedForSize : PBExtendableMessage
+- (BOOL)hasI;
+- (BOOL)hasMsg;
+@property (nonatomic, readonly) int32_t i;
+@property (nonatomic, readonly) ForeignMessage* msg;
+@property (nonatomic, readonly, nullable) PBArray * repeatedI;
+@property (nonatomic, readonly, nullable) NSArray<ForeignMessage*> * repeatedMsg;
+- (int64_t)repeatedIAtIndex:(NSUInteger)index;
+- (ForeignMessage*)repeatedMsgAtIndex:(NSUInteger)index;
++ (id<PBExtensionField>) testExtension;
++ (id<PBExtensionField>) testExtension2;
 
 + (TestOptimizedForSize*) defaultInstance;
 - (TestOptimizedForSize*) defaultInstance;
 
-+ (id<PBExtensionField>) testExtension;
-+ (id<PBExtensionField>) testExtension2;
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestOptimizedForSize_Builder*) builder;
 + (TestOptimizedForSize_Builder*) builder;
 + (TestOptimizedForSize_Builder*) builderWithPrototype:(TestOptimizedForSize*) prototype;
 - (TestOptimizedForSize_Builder*) toBuilder;
-
-+ (TestOptimizedForSize*) parseFromData:(NSData*) data;
-+ (TestOptimizedForSize*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestOptimizedForSize*) parseFromInputStream:(NSInputStream*) input;
-+ (TestOptimizedForSize*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestOptimizedForSize_Builder : PBExtendableMessage_Builder {
-@private
-  TestOptimizedForSize* result;
-}
+@interface TestOptimizedForSize_Builder : PBExtendableMessage_Builder
 
 - (TestOptimizedForSize*) defaultInstance;
 
-- (TestOptimizedForSize_Builder*) clear;
-- (TestOptimizedForSize_Builder*) clone;
-
 - (TestOptimizedForSize*) build;
 - (TestOptimizedForSize*) buildPartial;
 
 - (TestOptimizedForSize_Builder*) mergeFrom:(TestOptimizedForSize*) other;
-- (TestOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasI;
 - (int32_t) i;
+- (BOOL)hasI;
+- (TestOptimizedForSize_Builder*)clearI;
 - (TestOptimizedForSize_Builder*) setI:(int32_t) value;
-- (TestOptimizedForSize_Builder*) clearI;
 
-- (BOOL) hasMsg;
 - (ForeignMessage*) msg;
+- (BOOL)hasMsg;
+- (TestOptimizedForSize_Builder*)clearMsg;
 - (TestOptimizedForSize_Builder*) setMsg:(ForeignMessage*) value;
 - (TestOptimizedForSize_Builder*) setMsgBuilder:(ForeignMessage_Builder*) builderForValue;
 - (TestOptimizedForSize_Builder*) mergeMsg:(ForeignMessage*) value;
-- (TestOptimizedForSize_Builder*) clearMsg;
+
+- (PBAppendableArray *)repeatedI;
+- (TestOptimizedForSize_Builder*)clearRepeatedI;
+- (TestOptimizedForSize_Builder *)addRepeatedI:(int64_t)value;
+- (TestOptimizedForSize_Builder *)setRepeatedIArray:(NSArray<NSNumber *> *)array NS_SWIFT_NAME(setRepeatedIArray(_:));
+
+- (NSMutableArray *)repeatedMsg;
+- (TestOptimizedForSize_Builder*)clearRepeatedMsg;
+- (TestOptimizedForSize_Builder *)addRepeatedMsg:(ForeignMessage*)value;
+- (TestOptimizedForSize_Builder *)setRepeatedMsgArray:(NSArray<ForeignMessage*> *)array NS_SWIFT_NAME(setRepeatedMsgArray(_:));
++ (Class)expectedElementTypeForRepeatedMsgArray;
 @end
 
-@interface TestRequiredOptimizedForSize : PBGeneratedMessage {
-@private
-  BOOL hasX_:1;
-  int32_t x;
-}
-- (BOOL) hasX;
-@property (readonly) int32_t x;
+@interface TestRequiredOptimizedForSize : PBGeneratedMessage
+- (BOOL)hasX;
+@property (nonatomic, readonly) int32_t x;
 
 + (TestRequiredOptimizedForSize*) defaultInstance;
 - (TestRequiredOptimizedForSize*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestRequiredOptimizedForSize_Builder*) builder;
 + (TestRequiredOptimizedForSize_Builder*) builder;
 + (TestRequiredOptimizedForSize_Builder*) builderWithPrototype:(TestRequiredOptimizedForSize*) prototype;
 - (TestRequiredOptimizedForSize_Builder*) toBuilder;
-
-+ (TestRequiredOptimizedForSize*) parseFromData:(NSData*) data;
-+ (TestRequiredOptimizedForSize*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestRequiredOptimizedForSize*) parseFromInputStream:(NSInputStream*) input;
-+ (TestRequiredOptimizedForSize*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestRequiredOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestRequiredOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestRequiredOptimizedForSize_Builder : PBGeneratedMessage_Builder {
-@private
-  TestRequiredOptimizedForSize* result;
-}
-
+@interface TestRequiredOptimizedForSize_Builder : PBGeneratedMessage_Builder
 - (TestRequiredOptimizedForSize*) defaultInstance;
 
-- (TestRequiredOptimizedForSize_Builder*) clear;
-- (TestRequiredOptimizedForSize_Builder*) clone;
-
 - (TestRequiredOptimizedForSize*) build;
 - (TestRequiredOptimizedForSize*) buildPartial;
 
 - (TestRequiredOptimizedForSize_Builder*) mergeFrom:(TestRequiredOptimizedForSize*) other;
-- (TestRequiredOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestRequiredOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasX;
 - (int32_t) x;
+- (BOOL)hasX;
+- (TestRequiredOptimizedForSize_Builder*)clearX;
 - (TestRequiredOptimizedForSize_Builder*) setX:(int32_t) value;
-- (TestRequiredOptimizedForSize_Builder*) clearX;
 @end
 
-@interface TestOptionalOptimizedForSize : PBGeneratedMessage {
-@private
-  BOOL hasO_:1;
-  TestRequiredOptimizedForSize* o;
-}
-- (BOOL) hasO;
-@property (readonly, strong) TestRequiredOptimizedForSize* o;
+@interface TestOptionalOptimizedForSize : PBGeneratedMessage
+- (BOOL)hasO;
+@property (nonatomic, readonly) TestRequiredOptimizedForSize* o;
 
 + (TestOptionalOptimizedForSize*) defaultInstance;
 - (TestOptionalOptimizedForSize*) defaultInstance;
 
-- (BOOL) isInitialized;
-- (void) writeToCodedOutputStream:(PBCodedOutputStream*) output;
 - (TestOptionalOptimizedForSize_Builder*) builder;
 + (TestOptionalOptimizedForSize_Builder*) builder;
 + (TestOptionalOptimizedForSize_Builder*) builderWithPrototype:(TestOptionalOptimizedForSize*) prototype;
 - (TestOptionalOptimizedForSize_Builder*) toBuilder;
-
-+ (TestOptionalOptimizedForSize*) parseFromData:(NSData*) data;
-+ (TestOptionalOptimizedForSize*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestOptionalOptimizedForSize*) parseFromInputStream:(NSInputStream*) input;
-+ (TestOptionalOptimizedForSize*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
-+ (TestOptionalOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input;
-+ (TestOptionalOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 @end
 
-@interface TestOptionalOptimizedForSize_Builder : PBGeneratedMessage_Builder {
-@private
-  TestOptionalOptimizedForSize* result;
-}
-
+@interface TestOptionalOptimizedForSize_Builder : PBGeneratedMessage_Builder
 - (TestOptionalOptimizedForSize*) defaultInstance;
 
-- (TestOptionalOptimizedForSize_Builder*) clear;
-- (TestOptionalOptimizedForSize_Builder*) clone;
-
 - (TestOptionalOptimizedForSize*) build;
 - (TestOptionalOptimizedForSize*) buildPartial;
 
 - (TestOptionalOptimizedForSize_Builder*) mergeFrom:(TestOptionalOptimizedForSize*) other;
-- (TestOptionalOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input;
-- (TestOptionalOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry;
 
-- (BOOL) hasO;
 - (TestRequiredOptimizedForSize*) o;
+- (BOOL)hasO;
+- (TestOptionalOptimizedForSize_Builder*)clearO;
 - (TestOptionalOptimizedForSize_Builder*) setO:(TestRequiredOptimizedForSize*) value;
 - (TestOptionalOptimizedForSize_Builder*) setOBuilder:(TestRequiredOptimizedForSize_Builder*) builderForValue;
 - (TestOptionalOptimizedForSize_Builder*) mergeO:(TestRequiredOptimizedForSize*) value;
-- (TestOptionalOptimizedForSize_Builder*) clearO;
 @end
 
@@ -2,11 +2,21 @@
 
 #import "UnittestOptimizeFor.pb.h"
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wshadow-ivar"
+
 @implementation UnittestOptimizeForRoot
 static id<PBExtensionField> TestOptimizedForSize_testExtension = nil;
 static id<PBExtensionField> TestOptimizedForSize_testExtension2 = nil;
-static PBExtensionRegistry* extensionRegistry = nil;
 + (PBExtensionRegistry*) extensionRegistry {
+  static PBExtensionRegistry* extensionRegistry = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
+    [UnittestOptimizeForRoot registerAllExtensions:registry];
+    [UnittestRoot registerAllExtensions:registry];
+    extensionRegistry = registry;
+  });
   return extensionRegistry;
 }
 
@@ -16,11 +26,11 @@ static PBExtensionRegistry* extensionRegistry = nil;
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeInt32
                                      extendedClass:[TestOptimizedForSize class]
                                        fieldNumber:1234
-                                      defaultValue:[NSNumber numberWithInt:0]
+                                      defaultValue:@(0)
                                messageOrGroupClass:[NSNumber class]
                                         isRepeated:NO
                                           isPacked:NO
-                            isMessageSetWireFormat:NO] ;
+                            isMessageSetWireFormat:NO];
     TestOptimizedForSize_testExtension2 =
       [PBConcreteExtensionField extensionWithType:PBExtensionTypeMessage
                                      extendedClass:[TestOptimizedForSize class]
@@ -29,11 +39,7 @@ static PBExtensionRegistry* extensionRegistry = nil;
                                messageOrGroupClass:[TestRequiredOptimizedForSize class]
                                         isRepeated:NO
                                           isPacked:NO
-                            isMessageSetWireFormat:NO] ;
-    PBMutableExtensionRegistry* registry = [PBMutableExtensionRegistry registry];
-    [self registerAllExtensions:registry];
-    [UnittestRoot registerAllExtensions:registry];
-    extensionRegistry = registry;
+                            isMessageSetWireFormat:NO];
   }
 }
 + (void) registerAllExtensions:(PBMutableExtensionRegistry*) registry {
@@ -43,27 +49,16 @@ static PBExtensionRegistry* extensionRegistry = nil;
 @end
 
 @interface TestOptimizedForSize ()
-@property int32_t i;
-@property (strong) ForeignMessage* msg;
+@property (nonatomic, readwrite) BOOL hasI;
+@property (nonatomic, readwrite) int32_t i;
+@property (nonatomic, readwrite) BOOL hasMsg;
+@property (nonatomic, readwrite) ForeignMessage* msg;
+@property (strong) PBAppendableArray * repeatedIArray;
+@property (nonatomic, readwrite) NSMutableArray * repeatedMsgArray;
 @end
 
 @implementation TestOptimizedForSize
 
-- (BOOL) hasI {
-  return !!hasI_;
-}
-- (void) setHasI:(BOOL) value {
-  hasI_ = !!value;
-}
-@synthesize i;
-- (BOOL) hasMsg {
-  return !!hasMsg_;
-}
-- (void) setHasMsg:(BOOL) value {
-  hasMsg_ = !!value;
-}
-@synthesize msg;
-
 - (id) init {
   if ((self = [super init])) {
     self.i = 0;
@@ -71,23 +66,34 @@ static PBExtensionRegistry* extensionRegistry = nil;
   }
   return self;
 }
++ (TestOptimizedForSize*) defaultInstance {
+  static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestOptimizedForSizeInstance = [[TestOptimizedForSize alloc] init];
+  });
+  return defaultTestOptimizedForSizeInstance;
+}
+- (TestOptimizedForSize*) defaultInstance {
+  return [TestOptimizedForSize defaultInstance];
+}
 + (id<PBExtensionField>) testExtension {
   return TestOptimizedForSize_testExtension;
 }
 + (id<PBExtensionField>) testExtension2 {
   return TestOptimizedForSize_testExtension2;
 }
-static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
-+ (void) initialize {
-  if (self == [TestOptimizedForSize class]) {
-    defaultTestOptimizedForSizeInstance = [[TestOptimizedForSize alloc] init];
-  }
+- (PBArray *)repeatedI {
+  return self.repeatedIArray;
 }
-+ (TestOptimizedForSize*) defaultInstance {
-  return defaultTestOptimizedForSizeInstance;
+- (int64_t)repeatedIAtIndex:(NSUInteger)index {
+  return [self.repeatedIArray int64AtIndex:index];
 }
-- (TestOptimizedForSize*) defaultInstance {
-  return defaultTestOptimizedForSizeInstance;
+- (NSArray *)repeatedMsg {
+  return self.repeatedMsgArray;
+}
+- (ForeignMessage*)repeatedMsgAtIndex:(NSUInteger)index {
+  return self.repeatedMsgArray[index];
 }
 - (BOOL) isInitialized {
   if (!self.extensionsAreInitialized) {
@@ -99,52 +105,57 @@ static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
   if (self.hasI) {
     [output writeInt32:1 value:self.i];
   }
+  const NSUInteger repeatedIArrayCount = self.repeatedIArray.count;
+  if (repeatedIArrayCount > 0) {
+    const int64_t *values = (const int64_t *)self.repeatedIArray.data;
+    for (NSUInteger i = 0; i < repeatedIArrayCount; ++i) {
+      [output writeInt64:2 value:values[i]];
+    }
+  }
   if (self.hasMsg) {
     [output writeMessage:19 value:self.msg];
   }
+  for (ForeignMessage *element in self.repeatedMsgArray) {
+    [output writeMessage:20 value:element];
+  }
   [self writeExtensionsToCodedOutputStream:output
                                       from:1000
                                         to:536870912];
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasI) {
-    size += computeInt32Size(1, self.i);
+    size_ += computeInt32Size(1, self.i);
+  }
+  {
+    int32_t dataSize = 0;
+    const NSUInteger count = self.repeatedIArray.count;
+    const int64_t *values = (const int64_t *)self.repeatedIArray.data;
+    for (NSUInteger i = 0; i < count; ++i) {
+      dataSize += computeInt64SizeNoTag(values[i]);
+    }
+    size_ += dataSize;
+    size_ += 1 * count;
   }
   if (self.hasMsg) {
-    size += computeMessageSize(19, self.msg);
+    size_ += computeMessageSize(19, self.msg);
   }
-  size += [self extensionsSerializedSize];
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestOptimizedForSize*) parseFromData:(NSData*) data {
-  return (TestOptimizedForSize*)[[[TestOptimizedForSize builder] mergeFromData:data] build];
-}
-+ (TestOptimizedForSize*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestOptimizedForSize*)[[[TestOptimizedForSize builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestOptimizedForSize*) parseFromInputStream:(NSInputStream*) input {
-  return (TestOptimizedForSize*)[[[TestOptimizedForSize builder] mergeFromInputStream:input] build];
-}
-+ (TestOptimizedForSize*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestOptimizedForSize*)[[[TestOptimizedForSize builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestOptimizedForSize*)[[[TestOptimizedForSize builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestOptimizedForSize*)[[[TestOptimizedForSize builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  for (ForeignMessage *element in self.repeatedMsgArray) {
+    size_ += computeMessageSize(20, element);
+  }
+  size_ += [self extensionsSerializedSize];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestOptimizedForSize_Builder*) builder {
-  return [[TestOptimizedForSize_Builder alloc] init] ;
+  return [[TestOptimizedForSize_Builder alloc] init];
 }
 + (TestOptimizedForSize_Builder*) builderWithPrototype:(TestOptimizedForSize*) prototype {
   return [[TestOptimizedForSize builder] mergeFrom:prototype];
@@ -155,77 +166,39 @@ static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
 - (TestOptimizedForSize_Builder*) toBuilder {
   return [TestOptimizedForSize builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasI) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"i", [NSNumber numberWithInt:self.i]];
-  }
-  if (self.hasMsg) {
-    [output appendFormat:@"%@%@ {\n", indent, @"msg"];
-    [self.msg writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
-  }
-  [self writeExtensionDescriptionToMutableString:(NSMutableString*)output
-                                            from:1000
-                                              to:536870912
-                                      withIndent:indent];
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+static const PBFieldTableEntry TestOptimizedForSizeFieldTableEntries[] = {
+  { "i", "hasI", PBFieldTableTypeInt32, 1, 0 },
+  { "repeatedI", NULL, PBFieldTableTypeInt64, 2, 0 },
+  { "msg", "hasMsg", PBFieldTableTypeMessage, 19, 0 },
+  { "repeatedMsg", NULL, PBFieldTableTypeMessage, 20, 0 },
+  { NULL, NULL, PBFieldTableTypeExtensionRange, 1000, 536870912 },
+};
+static PBFieldTable TestOptimizedForSizeFieldTable = { TestOptimizedForSizeFieldTableEntries, 5 };
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  PBFieldTableWriteTextFormat(&TestOptimizedForSizeFieldTable, self, writer);
 }
 - (BOOL) isEqual:(id)other {
-  if (other == self) {
-    return YES;
-  }
-  if (![other isKindOfClass:[TestOptimizedForSize class]]) {
-    return NO;
-  }
-  TestOptimizedForSize *otherMessage = other;
-  return
-      self.hasI == otherMessage.hasI &&
-      (!self.hasI || self.i == otherMessage.i) &&
-      
-      self.hasMsg == otherMessage.hasMsg &&
-      (!self.hasMsg || [self.msg isEqual:otherMessage.msg]) &&
-      
-      [self isEqualExtensionsInOther:otherMessage from:1000 to:536870912] &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+  return PBFieldTableIsEqual(&TestOptimizedForSizeFieldTable, self, other);
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasI) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.i] hash];
-  }
-  if (self.hasMsg) {
-    hashCode = hashCode * 31 + [self.msg hash];
-  }
-  hashCode = hashCode * 31 + [self hashExtensionsFrom:1000 to:536870912];
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+  return PBFieldTableHash(&TestOptimizedForSizeFieldTable, self);
 }
 @end
 
 @interface TestOptimizedForSize_Builder()
-@property (strong) TestOptimizedForSize* result;
+@property (strong) TestOptimizedForSize* builder_result;
 @end
 
 @implementation TestOptimizedForSize_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestOptimizedForSize alloc] init] ;
+    self.builder_result = [[TestOptimizedForSize alloc] init];
   }
   return self;
 }
 - (PBExtendableMessage*) internalGetResult {
-  return result;
-}
-- (TestOptimizedForSize_Builder*) clear {
-  self.result = [[TestOptimizedForSize alloc] init] ;
-  return self;
-}
-- (TestOptimizedForSize_Builder*) clone {
-  return [TestOptimizedForSize builderWithPrototype:result];
+  return builder_result;
 }
 - (TestOptimizedForSize*) defaultInstance {
   return [TestOptimizedForSize defaultInstance];
@@ -235,8 +208,8 @@ static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
   return [self buildPartial];
 }
 - (TestOptimizedForSize*) buildPartial {
-  TestOptimizedForSize* returnMe = result;
-  self.result = nil;
+  TestOptimizedForSize* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestOptimizedForSize_Builder*) mergeFrom:(TestOptimizedForSize*) other {
@@ -249,13 +222,16 @@ static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
   if (other.hasMsg) {
     [self mergeMsg:other.msg];
   }
+  if (other.repeatedIArray.count > 0) {
+    builder_result.repeatedIArray = [other.repeatedIArray copy];
+  }
+  if (other.repeatedMsgArray.count > 0) {
+    builder_result.repeatedMsgArray = [[NSMutableArray alloc] initWithArray:other.repeatedMsgArray];
+  }
   [self mergeExtensionFields:other];
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -275,97 +251,138 @@ static TestOptimizedForSize* defaultTestOptimizedForSizeInstance = nil;
         [self setI:[input readInt32]];
         break;
       }
+      case 16: {
+        [self addRepeatedI:[input readInt64]];
+        break;
+      }
       case 154: {
         ForeignMessage_Builder* subBuilder = [ForeignMessage builder];
-        if (self.hasMsg) {
-          [subBuilder mergeFrom:self.msg];
+        if (self.builder_result.hasMsg) {
+          [subBuilder mergeFrom:self.builder_result.msg];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setMsg:[subBuilder buildPartial]];
         break;
       }
+      case 162: {
+        ForeignMessage_Builder* subBuilder = [ForeignMessage builder];
+        [input readMessage:subBuilder extensionRegistry:extensionRegistry];
+        [self addRepeatedMsg:[subBuilder buildPartial]];
+        break;
+      }
     }
   }
 }
-- (BOOL) hasI {
-  return result.hasI;
-}
-- (int32_t) i {
-  return result.i;
-}
 - (TestOptimizedForSize_Builder*) setI:(int32_t) value {
-  result.hasI = YES;
-  result.i = value;
+  builder_result.hasI = YES;
+  builder_result.i = value;
   return self;
 }
-- (TestOptimizedForSize_Builder*) clearI {
-  result.hasI = NO;
-  result.i = 0;
-  return self;
+- (int32_t) i {
+  return builder_result.i;
 }
-- (BOOL) hasMsg {
-  return result.hasMsg;
+- (BOOL)hasI {
+ return builder_result.hasI;
 }
-- (ForeignMessage*) msg {
-  return result.msg;
+- (TestOptimizedForSize_Builder*)clearI {
+  builder_result.hasI = NO;
+  builder_result.i = 0;
+  return self;
 }
 - (TestOptimizedForSize_Builder*) setMsg:(ForeignMessage*) value {
-  result.hasMsg = YES;
-  result.msg = value;
+  builder_result.hasMsg = YES;
+  builder_result.msg = value;
   return self;
 }
 - (TestOptimizedForSize_Builder*) setMsgBuilder:(ForeignMessage_Builder*) builderForValue {
   return [self setMsg:[builderForValue build]];
 }
 - (TestOptimizedForSize_Builder*) mergeMsg:(ForeignMessage*) value {
-  if (result.hasMsg &&
-      result.msg != [ForeignMessage defaultInstance]) {
-    result.msg =
-      [[[ForeignMessage builderWithPrototype:result.msg] mergeFrom:value] buildPartial];
+  if (builder_result.hasMsg &&
+      builder_result.msg != [ForeignMessage defaultInstance]) {
+    builder_result.msg =
+      [[[ForeignMessage builderWithPrototype:builder_result.msg] mergeFrom:value] buildPartial];
   } else {
-    result.msg = value;
+    builder_result.msg = value;
   }
-  result.hasMsg = YES;
+  builder_result.hasMsg = YES;
   return self;
 }
-- (TestOptimizedForSize_Builder*) clearMsg {
-  result.hasMsg = NO;
-  result.msg = [ForeignMessage defaultInstance];
+- (ForeignMessage*) msg {
+  return builder_result.msg;
+}
+- (BOOL)hasMsg {
+ return builder_result.hasMsg;
+}
+- (TestOptimizedForSize_Builder*)clearMsg {
+  builder_result.hasMsg = NO;
+  builder_result.msg = [ForeignMessage defaultInstance];
+  return self;
+}
+- (TestOptimizedForSize_Builder *)addRepeatedI:(int64_t)value {
+  if (builder_result.repeatedIArray == nil) {
+    builder_result.repeatedIArray = [PBAppendableArray arrayWithValueType:PBArrayValueTypeInt64];
+  }
+  [builder_result.repeatedIArray addInt64:value];
+  return self;
+}
+- (TestOptimizedForSize_Builder *)setRepeatedIArray:(NSArray *)array {
+  builder_result.repeatedIArray = [PBAppendableArray arrayWithArray:array valueType:PBArrayValueTypeInt64];
+  return self;
+}
+- (PBAppendableArray *) repeatedI {
+  return builder_result.repeatedIArray;
+}
+- (TestOptimizedForSize_Builder *)clearRepeatedI {
+  builder_result.repeatedIArray = nil;
+  return self;
+}
+- (TestOptimizedForSize_Builder *)addRepeatedMsg:(ForeignMessage*)value {
+  if (builder_result.repeatedMsgArray == nil) {
+    builder_result.repeatedMsgArray = [[NSMutableArray alloc]init];
+  }
+  [builder_result.repeatedMsgArray addObject:value];
+  return self;
+}
+- (TestOptimizedForSize_Builder *)setRepeatedMsgArray:(NSArray *)array {
+  builder_result.repeatedMsgArray = [[NSMutableArray alloc]initWithArray:array];
+  return self;
+}
++ (Class)expectedElementTypeForRepeatedMsgArray {
+  return [ForeignMessage class];
+}
+- (NSMutableArray *)repeatedMsg {
+  return builder_result.repeatedMsgArray;
+}
+- (TestOptimizedForSize_Builder *)clearRepeatedMsg {
+  builder_result.repeatedMsgArray = nil;
   return self;
 }
 @end
 
 @interface TestRequiredOptimizedForSize ()
-@property int32_t x;
+@property (nonatomic, readwrite) BOOL hasX;
+@property (nonatomic, readwrite) int32_t x;
 @end
 
 @implementation TestRequiredOptimizedForSize
 
-- (BOOL) hasX {
-  return !!hasX_;
-}
-- (void) setHasX:(BOOL) value {
-  hasX_ = !!value;
-}
-@synthesize x;
-
 - (id) init {
   if ((self = [super init])) {
     self.x = 0;
   }
   return self;
 }
-static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance = nil;
-+ (void) initialize {
-  if (self == [TestRequiredOptimizedForSize class]) {
-    defaultTestRequiredOptimizedForSizeInstance = [[TestRequiredOptimizedForSize alloc] init];
-  }
-}
 + (TestRequiredOptimizedForSize*) defaultInstance {
+  static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestRequiredOptimizedForSizeInstance = [[TestRequiredOptimizedForSize alloc] init];
+  });
   return defaultTestRequiredOptimizedForSizeInstance;
 }
 - (TestRequiredOptimizedForSize*) defaultInstance {
-  return defaultTestRequiredOptimizedForSizeInstance;
+  return [TestRequiredOptimizedForSize defaultInstance];
 }
 - (BOOL) isInitialized {
   if (!self.hasX) {
@@ -380,39 +397,21 @@ static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasX) {
-    size += computeInt32Size(1, self.x);
+    size_ += computeInt32Size(1, self.x);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestRequiredOptimizedForSize*) parseFromData:(NSData*) data {
-  return (TestRequiredOptimizedForSize*)[[[TestRequiredOptimizedForSize builder] mergeFromData:data] build];
-}
-+ (TestRequiredOptimizedForSize*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestRequiredOptimizedForSize*)[[[TestRequiredOptimizedForSize builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestRequiredOptimizedForSize*) parseFromInputStream:(NSInputStream*) input {
-  return (TestRequiredOptimizedForSize*)[[[TestRequiredOptimizedForSize builder] mergeFromInputStream:input] build];
-}
-+ (TestRequiredOptimizedForSize*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestRequiredOptimizedForSize*)[[[TestRequiredOptimizedForSize builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestRequiredOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestRequiredOptimizedForSize*)[[[TestRequiredOptimizedForSize builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestRequiredOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestRequiredOptimizedForSize*)[[[TestRequiredOptimizedForSize builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestRequiredOptimizedForSize_Builder*) builder {
-  return [[TestRequiredOptimizedForSize_Builder alloc] init] ;
+  return [[TestRequiredOptimizedForSize_Builder alloc] init];
 }
 + (TestRequiredOptimizedForSize_Builder*) builderWithPrototype:(TestRequiredOptimizedForSize*) prototype {
   return [[TestRequiredOptimizedForSize builder] mergeFrom:prototype];
@@ -423,58 +422,35 @@ static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance
 - (TestRequiredOptimizedForSize_Builder*) toBuilder {
   return [TestRequiredOptimizedForSize builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasX) {
-    [output appendFormat:@"%@%@: %@\n", indent, @"x", [NSNumber numberWithInt:self.x]];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+static const PBFieldTableEntry TestRequiredOptimizedForSizeFieldTableEntries[] = {
+  { "x", "hasX", PBFieldTableTypeInt32, 1, 0 },
+};
+static PBFieldTable TestRequiredOptimizedForSizeFieldTable = { TestRequiredOptimizedForSizeFieldTableEntries, 1 };
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  PBFieldTableWriteTextFormat(&TestRequiredOptimizedForSizeFieldTable, self, writer);
 }
 - (BOOL) isEqual:(id)other {
-  if (other == self) {
-    return YES;
-  }
-  if (![other isKindOfClass:[TestRequiredOptimizedForSize class]]) {
-    return NO;
-  }
-  TestRequiredOptimizedForSize *otherMessage = other;
-  return
-      self.hasX == otherMessage.hasX &&
-      (!self.hasX || self.x == otherMessage.x) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+  return PBFieldTableIsEqual(&TestRequiredOptimizedForSizeFieldTable, self, other);
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasX) {
-    hashCode = hashCode * 31 + [[NSNumber numberWithInt:self.x] hash];
-  }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+  return PBFieldTableHash(&TestRequiredOptimizedForSizeFieldTable, self);
 }
 @end
 
 @interface TestRequiredOptimizedForSize_Builder()
-@property (strong) TestRequiredOptimizedForSize* result;
+@property (strong) TestRequiredOptimizedForSize* builder_result;
 @end
 
 @implementation TestRequiredOptimizedForSize_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestRequiredOptimizedForSize alloc] init] ;
+    self.builder_result = [[TestRequiredOptimizedForSize alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestRequiredOptimizedForSize_Builder*) clear {
-  self.result = [[TestRequiredOptimizedForSize alloc] init] ;
-  return self;
-}
-- (TestRequiredOptimizedForSize_Builder*) clone {
-  return [TestRequiredOptimizedForSize builderWithPrototype:result];
+  return builder_result;
 }
 - (TestRequiredOptimizedForSize*) defaultInstance {
   return [TestRequiredOptimizedForSize defaultInstance];
@@ -484,8 +460,8 @@ static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance
   return [self buildPartial];
 }
 - (TestRequiredOptimizedForSize*) buildPartial {
-  TestRequiredOptimizedForSize* returnMe = result;
-  self.result = nil;
+  TestRequiredOptimizedForSize* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestRequiredOptimizedForSize_Builder*) mergeFrom:(TestRequiredOptimizedForSize*) other {
@@ -498,9 +474,6 @@ static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestRequiredOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestRequiredOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -523,55 +496,47 @@ static TestRequiredOptimizedForSize* defaultTestRequiredOptimizedForSizeInstance
     }
   }
 }
-- (BOOL) hasX {
-  return result.hasX;
+- (TestRequiredOptimizedForSize_Builder*) setX:(int32_t) value {
+  builder_result.hasX = YES;
+  builder_result.x = value;
+  return self;
 }
 - (int32_t) x {
-  return result.x;
+  return builder_result.x;
 }
-- (TestRequiredOptimizedForSize_Builder*) setX:(int32_t) value {
-  result.hasX = YES;
-  result.x = value;
-  return self;
+- (BOOL)hasX {
+ return builder_result.hasX;
 }
-- (TestRequiredOptimizedForSize_Builder*) clearX {
-  result.hasX = NO;
-  result.x = 0;
+- (TestRequiredOptimizedForSize_Builder*)clearX {
+  builder_result.hasX = NO;
+  builder_result.x = 0;
   return self;
 }
 @end
 
 @interface TestOptionalOptimizedForSize ()
-@property (strong) TestRequiredOptimizedForSize* o;
+@property (nonatomic, readwrite) BOOL hasO;
+@property (nonatomic, readwrite) TestRequiredOptimizedForSize* o;
 @end
 
 @implementation TestOptionalOptimizedForSize
 
-- (BOOL) hasO {
-  return !!hasO_;
-}
-- (void) setHasO:(BOOL) value {
-  hasO_ = !!value;
-}
-@synthesize o;
-
 - (id) init {
   if ((self = [super init])) {
     self.o = [TestRequiredOptimizedForSize defaultInstance];
   }
   return self;
 }
-static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance = nil;
-+ (void) initialize {
-  if (self == [TestOptionalOptimizedForSize class]) {
-    defaultTestOptionalOptimizedForSizeInstance = [[TestOptionalOptimizedForSize alloc] init];
-  }
-}
 + (TestOptionalOptimizedForSize*) defaultInstance {
+  static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance = nil;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    defaultTestOptionalOptimizedForSizeInstance = [[TestOptionalOptimizedForSize alloc] init];
+  });
   return defaultTestOptionalOptimizedForSizeInstance;
 }
 - (TestOptionalOptimizedForSize*) defaultInstance {
-  return defaultTestOptionalOptimizedForSizeInstance;
+  return [TestOptionalOptimizedForSize defaultInstance];
 }
 - (BOOL) isInitialized {
   if (self.hasO) {
@@ -588,39 +553,21 @@ static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance
   [self.unknownFields writeToCodedOutputStream:output];
 }
 - (int32_t) serializedSize {
-  int32_t size = memoizedSerializedSize;
-  if (size != -1) {
-    return size;
+  int32_t size_ = memoizedSerializedSize;
+  if (size_ != -1) {
+    return size_;
   }
 
-  size = 0;
+  size_ = 0;
   if (self.hasO) {
-    size += computeMessageSize(1, self.o);
+    size_ += computeMessageSize(1, self.o);
   }
-  size += self.unknownFields.serializedSize;
-  memoizedSerializedSize = size;
-  return size;
-}
-+ (TestOptionalOptimizedForSize*) parseFromData:(NSData*) data {
-  return (TestOptionalOptimizedForSize*)[[[TestOptionalOptimizedForSize builder] mergeFromData:data] build];
-}
-+ (TestOptionalOptimizedForSize*) parseFromData:(NSData*) data extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestOptionalOptimizedForSize*)[[[TestOptionalOptimizedForSize builder] mergeFromData:data extensionRegistry:extensionRegistry] build];
-}
-+ (TestOptionalOptimizedForSize*) parseFromInputStream:(NSInputStream*) input {
-  return (TestOptionalOptimizedForSize*)[[[TestOptionalOptimizedForSize builder] mergeFromInputStream:input] build];
-}
-+ (TestOptionalOptimizedForSize*) parseFromInputStream:(NSInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestOptionalOptimizedForSize*)[[[TestOptionalOptimizedForSize builder] mergeFromInputStream:input extensionRegistry:extensionRegistry] build];
-}
-+ (TestOptionalOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input {
-  return (TestOptionalOptimizedForSize*)[[[TestOptionalOptimizedForSize builder] mergeFromCodedInputStream:input] build];
-}
-+ (TestOptionalOptimizedForSize*) parseFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
-  return (TestOptionalOptimizedForSize*)[[[TestOptionalOptimizedForSize builder] mergeFromCodedInputStream:input extensionRegistry:extensionRegistry] build];
+  size_ += self.unknownFields.serializedSize;
+  memoizedSerializedSize = size_;
+  return size_;
 }
 + (TestOptionalOptimizedForSize_Builder*) builder {
-  return [[TestOptionalOptimizedForSize_Builder alloc] init] ;
+  return [[TestOptionalOptimizedForSize_Builder alloc] init];
 }
 + (TestOptionalOptimizedForSize_Builder*) builderWithPrototype:(TestOptionalOptimizedForSize*) prototype {
   return [[TestOptionalOptimizedForSize builder] mergeFrom:prototype];
@@ -631,61 +578,35 @@ static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance
 - (TestOptionalOptimizedForSize_Builder*) toBuilder {
   return [TestOptionalOptimizedForSize builderWithPrototype:self];
 }
-- (void) writeDescriptionTo:(NSMutableString*) output withIndent:(NSString*) indent {
-  if (self.hasO) {
-    [output appendFormat:@"%@%@ {\n", indent, @"o"];
-    [self.o writeDescriptionTo:output
-                         withIndent:[NSString stringWithFormat:@"%@  ", indent]];
-    [output appendFormat:@"%@}\n", indent];
-  }
-  [self.unknownFields writeDescriptionTo:output withIndent:indent];
+static const PBFieldTableEntry TestOptionalOptimizedForSizeFieldTableEntries[] = {
+  { "o", "hasO", PBFieldTableTypeMessage, 1, 0 },
+};
+static PBFieldTable TestOptionalOptimizedForSizeFieldTable = { TestOptionalOptimizedForSizeFieldTableEntries, 1 };
+- (void) writeTextFormatTo:(PBTextFormatWriter*) writer {
+  PBFieldTableWriteTextFormat(&TestOptionalOptimizedForSizeFieldTable, self, writer);
 }
 - (BOOL) isEqual:(id)other {
-  if (other == self) {
-    return YES;
-  }
-  if (![other isKindOfClass:[TestOptionalOptimizedForSize class]]) {
-    return NO;
-  }
-  TestOptionalOptimizedForSize *otherMessage = other;
-  return
-      self.hasO == otherMessage.hasO &&
-      (!self.hasO || [self.o isEqual:otherMessage.o]) &&
-      
-      (self.unknownFields == otherMessage.unknownFields || (self.unknownFields != nil && [self.unknownFields isEqual:otherMessage.unknownFields]));
+  return PBFieldTableIsEqual(&TestOptionalOptimizedForSizeFieldTable, self, other);
 }
 - (NSUInteger) hash {
-  NSUInteger hashCode = 7;
-  if (self.hasO) {
-    hashCode = hashCode * 31 + [self.o hash];
-  }
-  hashCode = hashCode * 31 + [self.unknownFields hash];
-  return hashCode;
+  return PBFieldTableHash(&TestOptionalOptimizedForSizeFieldTable, self);
 }
 @end
 
 @interface TestOptionalOptimizedForSize_Builder()
-@property (strong) TestOptionalOptimizedForSize* result;
+@property (strong) TestOptionalOptimizedForSize* builder_result;
 @end
 
 @implementation TestOptionalOptimizedForSize_Builder
-@synthesize result;
-
+@synthesize builder_result;
 - (id) init {
   if ((self = [super init])) {
-    self.result = [[TestOptionalOptimizedForSize alloc] init] ;
+    self.builder_result = [[TestOptionalOptimizedForSize alloc] init];
   }
   return self;
 }
 - (PBGeneratedMessage*) internalGetResult {
-  return result;
-}
-- (TestOptionalOptimizedForSize_Builder*) clear {
-  self.result = [[TestOptionalOptimizedForSize alloc] init] ;
-  return self;
-}
-- (TestOptionalOptimizedForSize_Builder*) clone {
-  return [TestOptionalOptimizedForSize builderWithPrototype:result];
+  return builder_result;
 }
 - (TestOptionalOptimizedForSize*) defaultInstance {
   return [TestOptionalOptimizedForSize defaultInstance];
@@ -695,8 +616,8 @@ static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance
   return [self buildPartial];
 }
 - (TestOptionalOptimizedForSize*) buildPartial {
-  TestOptionalOptimizedForSize* returnMe = result;
-  self.result = nil;
+  TestOptionalOptimizedForSize* returnMe = builder_result;
+  self.builder_result = nil;
   return returnMe;
 }
 - (TestOptionalOptimizedForSize_Builder*) mergeFrom:(TestOptionalOptimizedForSize*) other {
@@ -709,9 +630,6 @@ static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance
   [self mergeUnknownFields:other.unknownFields];
   return self;
 }
-- (TestOptionalOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input {
-  return [self mergeFromCodedInputStream:input extensionRegistry:[PBExtensionRegistry emptyRegistry]];
-}
 - (TestOptionalOptimizedForSize_Builder*) mergeFromCodedInputStream:(PBCodedInputStream*) input extensionRegistry:(PBExtensionRegistry*) extensionRegistry {
   PBUnknownFieldSet_Builder* unknownFields = [PBUnknownFieldSet builderWithUnknownFields:self.unknownFields];
   while (YES) {
@@ -729,8 +647,8 @@ static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance
       }
       case 10: {
         TestRequiredOptimizedForSize_Builder* subBuilder = [TestRequiredOptimizedForSize builder];
-        if (self.hasO) {
-          [subBuilder mergeFrom:self.o];
+        if (self.builder_result.hasO) {
+          [subBuilder mergeFrom:self.builder_result.o];
         }
         [input readMessage:subBuilder extensionRegistry:extensionRegistry];
         [self setO:[subBuilder buildPartial]];
@@ -739,35 +657,36 @@ static TestOptionalOptimizedForSize* defaultTestOptionalOptimizedForSizeInstance
     }
   }
 }
-- (BOOL) hasO {
-  return result.hasO;
-}
-- (TestRequiredOptimizedForSize*) o {
-  return result.o;
-}
 - (TestOptionalOptimizedForSize_Builder*) setO:(TestRequiredOptimizedForSize*) value {
-  result.hasO = YES;
-  result.o = value;
+  builder_result.hasO = YES;
+  builder_result.o = value;
   return self;
 }
 - (TestOptionalOptimizedForSize_Builder*) setOBuilder:(TestRequiredOptimizedForSize_Builder*) builderForValue {
   return [self setO:[builderForValue build]];
 }
 - (TestOptionalOptimizedForSize_Builder*) mergeO:(TestRequiredOptimizedForSize*) value {
-  if (result.hasO &&
-      result.o != [TestRequiredOptimizedForSize defaultInstance]) {
-    result.o =
-      [[[TestRequiredOptimizedForSize builderWithPrototype:result.o] mergeFrom:value] buildPartial];
+  if (builder_result.hasO &&
+      builder_result.o != [TestRequiredOptimizedForSize defaultInstance]) {
+    builder_result.o =
+      [[[TestRequiredOptimizedForSize builderWithPrototype:builder_result.o] mergeFrom:value] buildPartial];
   } else {
-    result.o = value;
+    builder_result.o = value;
   }
-  result.hasO = YES;
+  builder_result.hasO = YES;
   return self;
 }
-- (TestOptionalOptimizedForSize_Builder*) clearO {
-  result.hasO = NO;
-  result.o = [TestRequiredOptimizedForSize defaultInstance];
+- (TestRequiredOptimizedForSize*) o {
+  return builder_result.o;
+}
+- (BOOL)hasO {
+ return builder_result.hasO;
+}
+- (TestOptionalOptimizedForSize_Builder*)clearO {
+  builder_result.hasO = NO;
+  builder_result.o = [TestRequiredOptimizedForSize defaultInstance];
   return self;
 }
 @end
 
+#pragma clang diagnostic pop
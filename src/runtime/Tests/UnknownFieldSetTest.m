@@ -32,7 +32,7 @@
 - (void) setUp {
   self.allFields = [TestUtilities allSet];
   self.allFieldsData = [allFields data];
-  self.emptyMessage = [TestEmptyMessage parseFromData:allFieldsData];
+  self.emptyMessage = [(TestEmptyMessage_Builder*)[[TestEmptyMessage builder] mergeFromData:allFieldsData] build];
   self.unknownFields = emptyMessage.unknownFields;
 }
 
@@ -145,7 +145,7 @@
                                                               forNumber:123456] build];
 
   NSData* data = fields.data;
-  TestAllTypes* destination = [TestAllTypes parseFromData:data];
+  TestAllTypes* destination = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromData:data] build];
 
   [TestUtilities assertAllFieldsSet:destination];
   STAssertTrue(1 == destination.unknownFields.fields.count, @"");
@@ -161,8 +161,8 @@
   // when parsing.
 
   NSData* bizarroData = [self getBizarroData];
-  TestAllTypes* allTypesMessage = [TestAllTypes parseFromData:bizarroData];
-  TestEmptyMessage* emptyMessage_ = [TestEmptyMessage parseFromData:bizarroData];
+  TestAllTypes* allTypesMessage = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromData:bizarroData] build];
+  TestEmptyMessage* emptyMessage_ = [(TestEmptyMessage_Builder*)[[TestEmptyMessage builder] mergeFromData:bizarroData] build];
 
   // All fields should have been interpreted as unknown, so the debug strings
   // should be the same.
@@ -175,7 +175,7 @@
   // they are declared as extension numbers.
 
   TestEmptyMessageWithExtensions* message =
-  [TestEmptyMessageWithExtensions parseFromData:allFieldsData];
+  [(TestEmptyMessageWithExtensions_Builder*)[[TestEmptyMessageWithExtensions builder] mergeFromData:allFieldsData] build];
 
   STAssertTrue(unknownFields.fields.count ==  message.unknownFields.fields.count, @"");
   STAssertEqualObjects(allFieldsData, message.data, @"");
@@ -187,8 +187,8 @@
   // when parsing extensions.
 
   NSData* bizarroData = [self getBizarroData];
-  TestAllExtensions* allExtensionsMessage = [TestAllExtensions parseFromData:bizarroData];
-  TestEmptyMessage* emptyMessage_ = [TestEmptyMessage parseFromData:bizarroData];
+  TestAllExtensions* allExtensionsMessage = [(TestAllExtensions_Builder*)[[TestAllExtensions builder] mergeFromData:bizarroData] build];
+  TestEmptyMessage* emptyMessage_ = [(TestEmptyMessage_Builder*)[[TestEmptyMessage builder] mergeFromData:bizarroData] build];
 
   // All fields should have been interpreted as unknown, so the debug strings
   // should be the same.
@@ -29,4 +29,54 @@
   STAssertEquals(logicalRightShift64((1LL << 63), 63), 1LL, nil);
 }
 
+
+- (void) assertUTF8:(const char*) text valid:(BOOL) valid ascii:(BOOL) ascii {
+  BOOL isASCII = NO;
+  STAssertEquals(isValidUTF8((const uint8_t*)text, (int32_t)strlen(text), &isASCII), valid, @"%s", text);
+  if (valid) {
+    STAssertEquals(isASCII, ascii, @"%s", text);
+  }
+}
+
+
+- (void) testIsValidUTF8 {
+  [self assertUTF8:"" valid:YES ascii:YES];
+  [self assertUTF8:"hello" valid:YES ascii:YES];
+  [self assertUTF8:"a string that is longer than one sixteen byte vector" valid:YES ascii:YES];
+  [self assertUTF8:"caf\xc3\xa9" valid:YES ascii:NO];
+  [self assertUTF8:"sixteen ascii b\xe2\x82\xac and more ascii after the euro" valid:YES ascii:NO];
+  [self assertUTF8:"\xf0\x9f\x98\x80" valid:YES ascii:NO];
+  [self assertUTF8:"\xf4\x8f\xbf\xbf" valid:YES ascii:NO];
+
+  // Truncated sequences.
+  [self assertUTF8:"\xc3" valid:NO ascii:NO];
+  [self assertUTF8:"\xe2\x82" valid:NO ascii:NO];
+  // Stray continuation byte.
+  [self assertUTF8:"abc\x80" valid:NO ascii:NO];
+  // Overlong encodings.
+  [self assertUTF8:"\xc0\xaf" valid:NO ascii:NO];
+  [self assertUTF8:"\xe0\x80\xaf" valid:NO ascii:NO];
+  [self assertUTF8:"\xf0\x80\x80\xaf" valid:NO ascii:NO];
+  // UTF-16 surrogate.
+  [self assertUTF8:"\xed\xa0\x80" valid:NO ascii:NO];
+  // Beyond U+10FFFF.
+  [self assertUTF8:"\xf4\x90\x80\x80" valid:NO ascii:NO];
+  [self assertUTF8:"\xf5\x80\x80\x80" valid:NO ascii:NO];
+}
+
+- (void) testComputeCRC32C {
+  STAssertTrue(0 == computeCRC32C(0, NULL, 0), @"");
+  STAssertTrue(0xe3069283 == computeCRC32C(0, (const uint8_t*)"123456789", 9), @"");
+
+  // Chained ranges, at every alignment, match one pass over the table.
+  uint8_t bytes[300];
+  for (int32_t i = 0; i < 300; i++) {
+    bytes[i] = (uint8_t)(i * 7 + 3);
+  }
+  uint32_t whole = computeCRC32C(0, bytes, 300);
+  for (int32_t split = 0; split <= 300; split += 13) {
+    STAssertTrue(whole == computeCRC32C(computeCRC32C(0, bytes, split), bytes + split, 300 - split), @"");
+  }
+}
+
 @end
@@ -29,7 +29,7 @@
   NSData* rawBytes = message.data;
   STAssertTrue(rawBytes.length == message.serializedSize, @"");
 
-  TestAllTypes* message2 = [TestAllTypes parseFromData:rawBytes];
+  TestAllTypes* message2 = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromData:rawBytes] build];
 
   [TestUtilities assertAllFieldsSet:message2];
 }
@@ -40,7 +40,7 @@
   NSData* rawBytes = message.data;
   STAssertTrue(rawBytes.length == message.serializedSize, @"");
 
-  TestPackedTypes* message2 = [TestPackedTypes parseFromData:rawBytes];
+  TestPackedTypes* message2 = [(TestPackedTypes_Builder*)[[TestPackedTypes builder] mergeFromData:rawBytes] build];
 
   [TestUtilities assertPackedFieldsSet:message2];
 }
@@ -55,7 +55,7 @@
   NSData* rawBytes = message.data;
   STAssertTrue(rawBytes.length == message.serializedSize, @"");
 
-  TestAllTypes* message2 = [TestAllTypes parseFromData:rawBytes];
+  TestAllTypes* message2 = [(TestAllTypes_Builder*)[[TestAllTypes builder] mergeFromData:rawBytes] build];
 
   [TestUtilities assertAllFieldsSet:message2];
 }
@@ -86,7 +86,7 @@
   [TestUtilities registerAllExtensions:registry];
 
   TestAllExtensions* message2 =
-  [TestAllExtensions parseFromData:rawBytes extensionRegistry:registry];
+  [(TestAllExtensions_Builder*)[[TestAllExtensions builder] mergeFromData:rawBytes extensionRegistry:registry] build];
 
   [TestUtilities assertAllExtensionsSet:message2];
 }
@@ -105,7 +105,7 @@
   PBExtensionRegistry* registry = [TestUtilities extensionRegistry];
 
   TestPackedExtensions* message2 =
-  [TestPackedExtensions parseFromData:rawBytes extensionRegistry:registry];
+  [(TestPackedExtensions_Builder*)[[TestPackedExtensions builder] mergeFromData:rawBytes extensionRegistry:registry] build];
 
   [TestUtilities assertPackedExtensionsSet:message2];
 }
@@ -0,0 +1,102 @@
+#!/bin/bash
+# Builds runtime-benchmark twice, once from a baseline revision and once from
+# the working tree, runs the compare suite of both and fails if any case got
+# slower by more than the threshold, significantly.
+#
+# usage: bench_compare.sh [baseline] [threshold-percent]
+#
+# The baseline defaults to HEAD and the threshold to 5 percent.  Both
+# executables are built from the working tree's Benchmarks/ with the same
+# flags; the runtime classes and the protoc-gen-objc that generates
+# unittest.proto and unittest_import.proto come from their own revision, so
+# changes to the generated code are measured as well as changes to the
+# runtime.  They run in turns, RUNS (default 3) times each, so drift in the
+# machine's speed hits both alike.  Each run takes SAMPLES (default 15)
+# samples of MIN_TIME (default 0.05) seconds per case.
+#
+# OBJC, GNUSTEP_OBJCFLAGS and GNUSTEP_LIBS are taken from the environment,
+# as "make bench-compare" passes them, or else from gnustep-config.  The
+# plugins are built with CXX (default c++) against the installed protobuf
+# and protoc libraries, and run by PROTOC (default protoc).  Their stubs
+# include the config.h that configure writes; CONFIG_H_DIR names its
+# directory, and without it an empty one is used, which leaves hash_map out.
+
+set -e
+
+SRCDIR=$(cd "$(dirname "$0")" && pwd)
+BASELINE=${1:-HEAD}
+THRESHOLD=${2:-5}
+RUNS=${RUNS:-3}
+SAMPLES=${SAMPLES:-15}
+MIN_TIME=${MIN_TIME:-0.05}
+OBJC=${OBJC:-clang}
+CXX=${CXX:-c++}
+PROTOC=${PROTOC:-protoc}
+GNUSTEP_OBJCFLAGS=${GNUSTEP_OBJCFLAGS:-$(gnustep-config --objc-flags)}
+GNUSTEP_LIBS=${GNUSTEP_LIBS:-$(gnustep-config --base-libs)}
+
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' EXIT
+
+# git archive wants the runtime's and the compiler's paths from the top of
+# the repository.
+TOPLEVEL=$(git -C "$SRCDIR" rev-parse --show-toplevel)
+PREFIX=$(git -C "$SRCDIR" rev-parse --show-prefix)
+COMPILER_PREFIX=$(git -C "$SRCDIR/../compiler" rev-parse --show-prefix)
+mkdir "$WORKDIR/tree"
+if [ -z "$CONFIG_H_DIR" ]; then
+    CONFIG_H_DIR="$WORKDIR/config"
+    mkdir "$CONFIG_H_DIR"
+    : > "$CONFIG_H_DIR/config.h"
+fi
+git -C "$TOPLEVEL" archive "$BASELINE" "$PREFIX" "$COMPILER_PREFIX" | tar -x -C "$WORKDIR/tree"
+
+# build <name> <runtime directory> <compiler directory>
+build() {
+    mkdir -p "$WORKDIR/$1/include" "$WORKDIR/$1/generated" "$WORKDIR/$1/protos/google/protobuf"
+    ln -s "$2/Classes" "$WORKDIR/$1/include/ProtocolBuffers"
+    "$CXX" -O2 -std=c++17 -pthread -I"$3" -I"$CONFIG_H_DIR" -o "$WORKDIR/$1/protoc-gen-objc" \
+        "$3"/*.cc "$3/google/protobuf/objectivec-descriptor.pb.cc" -lprotoc -lprotobuf
+    # Newer protoc rejects the duplicate values in TestEnumWithDupValue
+    # unless aliases are allowed, as in benchmark_generation.sh.
+    cp "$3/google/protobuf/unittest_import.proto" "$WORKDIR/$1/protos/google/protobuf/"
+    sed -e "s|^enum TestEnumWithDupValue {|&\\
+  option allow_alias = true;|" \
+        "$3/google/protobuf/unittest.proto" > "$WORKDIR/$1/protos/google/protobuf/unittest.proto"
+    # protoc has a built-in --objc_out, so the plugin is registered under another name.
+    "$PROTOC" -I"$WORKDIR/$1/protos" -I"$3" --plugin=protoc-gen-pbobjc="$WORKDIR/$1/protoc-gen-objc" \
+        --pbobjc_out="$WORKDIR/$1/generated" \
+        "$WORKDIR/$1/protos/google/protobuf/unittest.proto" \
+        "$WORKDIR/$1/protos/google/protobuf/unittest_import.proto"
+    "$OBJC" -O2 -c -o "$WORKDIR/$1/AllocationCounter.o" "$SRCDIR/Benchmarks/AllocationCounter.c"
+    "$OBJC" -O2 -c -o "$WORKDIR/$1/Reallocf.o" "$SRCDIR/Benchmarks/Reallocf.c"
+    # Older runtimes call the BSD reallocf, which glibc lacks.
+    "$OBJC" -O2 -fobjc-arc -fblocks $GNUSTEP_OBJCFLAGS \
+        -include "$2/ProtocolBuffers_Prefix.pch" -include "$SRCDIR/Benchmarks/Reallocf.h" \
+        -I"$WORKDIR/$1/include" -I"$2/Classes" -I"$WORKDIR/$1/generated" -I"$SRCDIR/Benchmarks" \
+        -DPB_BENCHMARK_DATA_DIR="\"$SRCDIR\"" \
+        -o "$WORKDIR/$1/runtime-benchmark" \
+        "$SRCDIR"/Benchmarks/*.m "$2"/Classes/*.m \
+        "$WORKDIR/$1/generated/Unittest.pb.m" "$WORKDIR/$1/generated/Unittest_import.pb.m" \
+        "$WORKDIR/$1/AllocationCounter.o" "$WORKDIR/$1/Reallocf.o" $GNUSTEP_LIBS -ldispatch -lz
+}
+
+echo "building $BASELINE"
+build baseline "$WORKDIR/tree/$PREFIX" "$WORKDIR/tree/$COMPILER_PREFIX"
+echo "building the working tree"
+build current "$SRCDIR" "$SRCDIR/../compiler"
+
+BASELINE_REPORTS=()
+CURRENT_REPORTS=()
+for ((i = 1; i <= RUNS; i++)); do
+    for side in baseline current; do
+        echo "run $i of $RUNS: $side"
+        "$WORKDIR/$side/runtime-benchmark" --suite compare --samples "$SAMPLES" \
+            --min-time "$MIN_TIME" > "$WORKDIR/$side.$i.json"
+    done
+    BASELINE_REPORTS+=("$WORKDIR/baseline.$i.json")
+    CURRENT_REPORTS+=("$WORKDIR/current.$i.json")
+done
+
+"$WORKDIR/current/runtime-benchmark" --compare --threshold "$THRESHOLD" \
+    --baseline "${BASELINE_REPORTS[@]}" --current "${CURRENT_REPORTS[@]}"
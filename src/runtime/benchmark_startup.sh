@@ -0,0 +1,137 @@
+#!/bin/bash
+# Measures what the first use of generated classes costs, across many
+# generated files: the first +defaultInstance of one message per file, then
+# the first +extensionRegistry of every file's root class, then both again
+# once everything is built.
+#
+# usage: benchmark_startup.sh [copies] [baseline]
+#
+# The copies are made the same way as in ../compiler/benchmark_generation.sh.
+# As in bench_compare.sh, the measurement runs twice: with protoc-gen-objc
+# and the runtime from the baseline revision (default HEAD), then from the
+# working tree.  Everything is compiled into one executable with the runtime
+# sources, so this needs clang and Foundation.  The plugins are built with
+# CXX (default c++) against the installed protobuf and protoc libraries, and
+# CONFIG_H_DIR names the directory of the config.h their stubs include.
+
+set -e
+
+COPIES=${1:-50}
+BASELINE=${2:-HEAD}
+SRCDIR=$(cd "$(dirname "$0")" && pwd)
+CXX=${CXX:-c++}
+PROTOC=${PROTOC:-protoc}
+
+PROTOS="unittest unittest_import unittest_mset unittest_empty
+        unittest_optimize_for unittest_embed_optimize_for
+        unittest_no_generic_services unittest_enormous_descriptor"
+
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' EXIT
+
+# git archive wants the runtime's and the compiler's paths from the top of
+# the repository.
+TOPLEVEL=$(git -C "$SRCDIR" rev-parse --show-toplevel)
+PREFIX=$(git -C "$SRCDIR" rev-parse --show-prefix)
+COMPILER_PREFIX=$(git -C "$SRCDIR/../compiler" rev-parse --show-prefix)
+mkdir "$WORKDIR/tree"
+if [ -z "$CONFIG_H_DIR" ]; then
+    CONFIG_H_DIR="$WORKDIR/config"
+    mkdir "$CONFIG_H_DIR"
+    : > "$CONFIG_H_DIR/config.h"
+fi
+git -C "$TOPLEVEL" archive "$BASELINE" "$PREFIX" "$COMPILER_PREFIX" | tar -x -C "$WORKDIR/tree"
+
+cat > "$WORKDIR/main.m" <<'MAIN'
+#import <Foundation/Foundation.h>
+#import <objc/message.h>
+#import <objc/runtime.h>
+
+typedef id (*Getter)(Class, SEL);
+
+// Calls selector on each class and returns how long that took, in milliseconds.
+static double timeClasses(NSArray* classes, SEL selector) {
+  CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+  for (Class cls in classes) {
+    ((Getter)objc_msgSend)(cls, selector);
+  }
+  return (CFAbsoluteTimeGetCurrent() - start) * 1000;
+}
+
+int main(int argc, char** argv) {
+  @autoreleasepool {
+    NSMutableArray* messages = [NSMutableArray array];
+    NSMutableArray* roots = [NSMutableArray array];
+    unsigned int count = 0;
+    Class* classes = objc_copyClassList(&count);
+    for (unsigned int i = 0; i < count; ++i) {
+      NSString* name = @(class_getName(classes[i]));
+      if (![name hasPrefix:@"C"]) {
+        continue;
+      }
+      if ([name hasSuffix:@"TestAllTypes"]) {
+        [messages addObject:classes[i]];
+      } else if ([name hasSuffix:@"Root"]) {
+        [roots addObject:classes[i]];
+      }
+    }
+    free(classes);
+
+    double firstInstances = timeClasses(messages, @selector(defaultInstance));
+    double firstRegistries = timeClasses(roots, @selector(extensionRegistry));
+    double instances = timeClasses(messages, @selector(defaultInstance));
+    double registries = timeClasses(roots, @selector(extensionRegistry));
+    printf("first defaultInstance of %lu messages: %.2f ms (then %.3f ms)\n",
+           (unsigned long)messages.count, firstInstances, instances);
+    printf("first extensionRegistry of %lu roots: %.2f ms (then %.3f ms)\n",
+           (unsigned long)roots.count, firstRegistries, registries);
+  }
+  return 0;
+}
+MAIN
+
+# build <name> <runtime directory> <compiler directory>
+build() {
+    local dir="$WORKDIR/$1"
+    mkdir -p "$dir/include" "$dir/out"
+    # Generated code imports <ProtocolBuffers/ProtocolBuffers.h>, the framework
+    # path, so the headers are linked in under that name as Makefile.am does.
+    ln -s "$2/Classes" "$dir/include/ProtocolBuffers"
+    "$CXX" -O2 -std=c++17 -pthread -I"$3" -I"$CONFIG_H_DIR" -o "$dir/protoc-gen-objc" \
+        "$3"/*.cc "$3/google/protobuf/objectivec-descriptor.pb.cc" -lprotoc -lprotobuf
+
+    for ((i = 1; i <= COPIES; i++)); do
+        mkdir -p "$dir/copy$i"
+        for name in $PROTOS; do
+            sed -e "s|\"google/protobuf/\(unittest[a-z_]*\)\.proto\"|\"copy$i/c${i}_\1.proto\"|" \
+                -e "s|^package \(.*\);|package copy$i.\1;\\
+import \"google/protobuf/objectivec-descriptor.proto\";\\
+option (.google.protobuf.objectivec_file_options).class_prefix = \"C$i\";|" \
+                -e "s|^enum TestEnumWithDupValue {|&\\
+  option allow_alias = true;|" \
+                "$3/google/protobuf/$name.proto" > "$dir/copy$i/c${i}_$name.proto"
+        done
+    done
+
+    # protoc has a built-in --objc_out, so the plugin is registered under another name.
+    (cd "$dir" && "$PROTOC" -I. -I"$3" --plugin=protoc-gen-pbobjc="$dir/protoc-gen-objc" \
+        --pbobjc_out=out google/protobuf/objectivec-descriptor.proto copy*/*.proto)
+    echo "$1: $(find "$dir/out" -name '*.pb.m' | wc -l) generated files"
+
+    local includes
+    includes=$(find "$dir/out" -name '*.pb.h' -exec dirname {} \; | sort -u | sed 's/^/-I/')
+    clang -Os -fobjc-arc -include "$2/ProtocolBuffers_Prefix.pch" \
+        -I"$dir/include" -I"$2/Classes" $includes -o "$dir/startup" \
+        "$2"/Classes/*.m $(find "$dir/out" -name '*.pb.m') "$WORKDIR/main.m" -framework Foundation -lz
+}
+
+echo "building $BASELINE"
+build baseline "$WORKDIR/tree/$PREFIX" "$WORKDIR/tree/$COMPILER_PREFIX"
+echo "building the working tree"
+build current "$SRCDIR" "$SRCDIR/../compiler"
+
+TIMEFORMAT="process: %R s wall"
+for side in baseline current; do
+    echo "$side:"
+    time "$WORKDIR/$side/startup"
+done
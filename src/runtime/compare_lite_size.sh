@@ -0,0 +1,59 @@
+#!/bin/bash
+# Compares the size of the runtime and of generated code with and without the
+# lite profile.
+#
+# usage: compare_lite_size.sh [plugin]
+#
+# The runtime is built with xcodebuild in the Release and ReleaseLite
+# configurations, and unittest.proto and the unittest_import.proto it imports
+# are generated with and without lite_runtime and compiled on their own
+# against the matching headers.  Sizes are the "dec" totals of size(1),
+# summed over every member of the library.
+
+set -e
+
+SRCDIR=$(cd "$(dirname "$0")" && pwd)
+PLUGIN=${1:-$SRCDIR/../compiler/protoc-gen-objc}
+PROTOC=${PROTOC:-protoc}
+PROTODIR=$SRCDIR/../compiler
+
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' EXIT
+
+# Generated code imports <ProtocolBuffers/ProtocolBuffers.h>, the framework
+# path, so the headers are linked in under that name as Makefile.am does.
+mkdir "$WORKDIR/include"
+ln -s "$SRCDIR/Classes" "$WORKDIR/include/ProtocolBuffers"
+
+for config in Release ReleaseLite; do
+    xcodebuild -quiet -project "$SRCDIR/ProtocolBuffers.xcodeproj" -target ProtocolBuffers \
+        -configuration $config SYMROOT="$WORKDIR/$config" OBJROOT="$WORKDIR/$config/obj"
+done
+
+generate() {
+    mkdir "$WORKDIR/$2"
+    # protoc has a built-in --objc_out, so the plugin is registered under another name.
+    "$PROTOC" -I"$PROTODIR" --plugin=protoc-gen-pbobjc="$PLUGIN" --pbobjc_out="${1:+$1:}$WORKDIR/$2" \
+        "$PROTODIR/google/protobuf/unittest.proto" "$PROTODIR/google/protobuf/unittest_import.proto"
+    for name in Unittest Unittest_import; do
+        clang -c -Os -fobjc-arc $3 -include "$SRCDIR/ProtocolBuffers_Prefix.pch" \
+            -I"$WORKDIR/include" -I"$SRCDIR/Classes" -I"$WORKDIR/$2" \
+            -o "$WORKDIR/$2/$name.pb.o" "$WORKDIR/$2/$name.pb.m"
+    done
+}
+
+# Sums the "dec" column, which both the GNU and the Apple size print.
+total() {
+    size "$@" | awk 'NR == 1 { for (i = 1; i <= NF; i++) if ($i == "dec") column = i; next }
+                     { sum += $column } END { print sum }'
+}
+
+generate "" full ""
+generate lite_runtime lite -DPB_LITE_RUNTIME=1
+
+printf '%-28s %10s %10s\n' "" full lite
+printf '%-28s %10d %10d\n' libProtocolBuffers.a \
+    "$(total "$WORKDIR/Release/Release/libProtocolBuffers.a")" \
+    "$(total "$WORKDIR/ReleaseLite/ReleaseLite/libProtocolBuffers.a")"
+printf '%-28s %10d %10d\n' "Unittest*.pb.o" \
+    "$(total "$WORKDIR"/full/*.pb.o)" "$(total "$WORKDIR"/lite/*.pb.o)"
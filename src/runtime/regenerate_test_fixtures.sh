@@ -0,0 +1,85 @@
+#!/bin/bash
+# Regenerates the unittest fixtures in Tests/ with protoc-gen-objc.
+#
+# usage: regenerate_test_fixtures.sh [plugin]
+#
+# The tests read fields back from builders and clear them, so builder
+# getters and clear methods are generated for every class, the delta
+# methods for the classes MessageTests.m diffs, and the string functions
+# for one enum of each lookup form: a range, a bitmap and a sorted array.
+# The plugin keeps the underscores of the .proto names; the fixtures are
+# renamed, imports included, to the CamelCase names that the Xcode project
+# and Makefile.am list.
+
+set -e
+
+SRCDIR=$(cd "$(dirname "$0")" && pwd)
+PLUGIN=${1:-$SRCDIR/../compiler/protoc-gen-objc}
+PROTOC=${PROTOC:-protoc}
+PROTODIR=$SRCDIR/../compiler
+
+PROTOS="unittest unittest_import unittest_mset unittest_empty
+        unittest_optimize_for unittest_embed_optimize_for
+        unittest_no_generic_services unittest_enormous_descriptor
+        unittest_custom_options unittest_lite unittest_import_lite
+        unittest_lite_imports_nonlite"
+DELTA_CLASSES="TestAllTypes,TestAllTypes_NestedMessage"
+STRING_ENUMS="ForeignEnum,TestSemiDenseEnum,TestSparseEnum"
+
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' EXIT
+
+# Newer protoc rejects the duplicate values in TestEnumWithDupValue unless
+# aliases are allowed, as in ../compiler/benchmark_generation.sh.
+mkdir -p "$WORKDIR/protos/google/protobuf"
+FILES=
+for name in $PROTOS; do
+    sed -e "s|^enum TestEnumWithDupValue {|&\\
+  option allow_alias = true;|" \
+        "$PROTODIR/google/protobuf/$name.proto" > "$WORKDIR/protos/google/protobuf/$name.proto"
+    FILES="$FILES $WORKDIR/protos/google/protobuf/$name.proto"
+done
+
+# generate <output directory>
+generate() {
+    mkdir "$1"
+    # protoc has a built-in --objc_out, so the plugin is registered under another name.
+    "$PROTOC" -I"$WORKDIR/protos" -I"$PROTODIR" --plugin=protoc-gen-pbobjc="$PLUGIN" \
+        --pbobjc_out="$1" $FILES
+}
+
+# The class-specific options take explicit class names, so a first pass
+# finds them all.  protoc would split the parameters' colon-separated lists,
+# so they are passed in the environment instead.
+generate "$WORKDIR/classes"
+CLASSES=$(sed -n 's/^@interface \([A-Za-z0-9_]*\) : PBGeneratedMessage$/\1/p;
+                  s/^@interface \([A-Za-z0-9_]*\) : PBExtendableMessage$/\1/p' \
+              "$WORKDIR"/classes/*.pb.h | sort -u | paste -sd, -)
+PROTOC_GEN_OBJC_CLASSES_WITH_BUILDER_GETTERS=$CLASSES \
+PROTOC_GEN_OBJC_CLASSES_WITH_BUILDER_CLEAR=$CLASSES \
+PROTOC_GEN_OBJC_CLASSES_WITH_DELTA=$DELTA_CLASSES \
+PROTOC_GEN_OBJC_ENUM_WITH_STRING_REPRESENTATION=$STRING_ENUMS \
+    generate "$WORKDIR/out"
+
+# camel_case <proto name> prints unittest_import as UnittestImport.
+camel_case() {
+    local part result=
+    IFS=_ read -ra parts <<< "$1"
+    for part in "${parts[@]}"; do
+        result+=$(echo "${part:0:1}" | tr a-z A-Z)${part:1}
+    done
+    echo "$result"
+}
+
+# The generated files only capitalize the first letter.
+RENAMES=
+for name in $PROTOS; do
+    generated=$(camel_case "${name%%_*}")${name#unittest}
+    RENAMES="$RENAMES -e s|\"$generated\.pb\.h\"|\"$(camel_case "$name").pb.h\"|"
+done
+for name in $PROTOS; do
+    generated=$(camel_case "${name%%_*}")${name#unittest}
+    for extension in h m; do
+        sed $RENAMES "$WORKDIR/out/$generated.pb.$extension" > "$SRCDIR/Tests/$(camel_case "$name").pb.$extension"
+    done
+done